@@ -0,0 +1,368 @@
+// Asynchronous file I/O.
+//
+// aiosetup() maps a struct aioring (see aio.h) at AIORING in the
+// calling address space: a submission queue that the process fills and
+// a completion queue that the kernel fills, so that many reads
+// and writes can be started and reaped with one aioenter() call,
+// or with none at all for a process that polls the completions.
+//
+// aioenter() takes the new submissions, duplicates each request's
+// file and hands the request to a pool of kernel threads, which
+// perform it through a bounce page with filereadat() or
+// filewriteat() and post the result.  Completions may arrive in
+// any order.  xv6's log commits every write before filewriteat()
+// returns, so AIO_FSYNC has nothing to flush: it completes once
+// every write submitted before it has completed.
+//
+// The rings belong to the address space, so threads that share it
+// with clone() share them too; each submission's fd is looked up
+// in the file table of the thread that calls aioenter().  munmap()
+// refuses the ring page, which the kernel keeps using through
+// ctx->ring: it goes only with the address space, after aiofree().
+//
+// Only inode files are supported.  As with write(), a write may
+// not start past the end of the file, and requests run in any
+// order, so a process extending a file must wait for each write
+// before submitting the next.  No request may be in flight into
+// an address space when it is freed or replaced by exec(), so
+// exit() and exec() wait for them with aiodrain().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "vmspace.h"
+#include "fs.h"
+#include "file.h"
+#include "vm.h"
+#include "aio.h"
+
+#define NAIOWORKER 4                // kernel threads performing requests
+#define NEPOCH     (2*AIO_NENT)     // fsync epochs tracked; a power of 2
+
+// An address space's rings.  Writes submitted between two fsyncs belong
+// to one epoch; the fsync that ends epoch e completes once the
+// writes of every epoch up to e have.
+struct aioctx {
+  struct spinlock lock;
+  struct aioring *ring;       // kernel address of the shared page
+  struct vmspace *vm;         // address space the buffers are in
+  uint sqhead;                // next submission to take
+  uint cqtail;                // next completion to post
+  int inflight;               // requests taken but not completed
+  uint fhead;                 // oldest fsync not yet completed
+  uint ftail;                 // current epoch: fsyncs submitted
+  uint fdata[AIO_NENT];       // data of pending fsyncs
+  int nwrite[NEPOCH];         // writes in flight per epoch
+};
+
+struct aioreq {
+  struct aioctx *ctx;
+  int op;
+  struct file *f;
+  uint off;
+  uint buf;                   // user address
+  uint n;
+  uint data;
+  uint epoch;                 // for writes
+  struct aioreq *next;
+};
+
+static struct {
+  struct spinlock lock;
+  struct aioreq *head;        // requests waiting for a worker
+  struct aioreq *tail;
+  int nworker;
+  struct kmem_cache *ctxcache;
+  struct kmem_cache *reqcache;
+} aioq;
+
+static void
+aioctxctor(void *v)
+{
+  struct aioctx *ctx = v;
+
+  initlock(&ctx->lock, "aioctx");
+}
+
+void
+aioinit(void)
+{
+  initlock(&aioq.lock, "aioq");
+  aioq.ctxcache = kmem_cache_create("aioctx", sizeof(struct aioctx),
+                                    aioctxctor);
+  aioq.reqcache = kmem_cache_create("aioreq", sizeof(struct aioreq), 0);
+}
+
+// Post a completion.  Caller holds ctx->lock; the room for it
+// was reserved when the request was taken.
+static void
+aiopost(struct aioctx *ctx, uint data, int res)
+{
+  struct aiocqe *cqe;
+
+  cqe = &ctx->ring->cq[ctx->cqtail % AIO_NENT];
+  cqe->data = data;
+  cqe->res = res;
+  ctx->cqtail++;
+  __sync_synchronize();
+  ctx->ring->cqtail = ctx->cqtail;
+  ctx->inflight--;
+  wakeup(ctx);
+}
+
+// Complete the pending fsyncs whose epochs have no writes left.
+// Caller holds ctx->lock.
+static void
+aiofsyncs(struct aioctx *ctx)
+{
+  while(ctx->fhead != ctx->ftail && ctx->nwrite[ctx->fhead % NEPOCH] == 0){
+    aiopost(ctx, ctx->fdata[ctx->fhead % AIO_NENT], 0);
+    ctx->fhead++;
+  }
+}
+
+// Completions posted but not yet consumed by the process.
+// Caller holds ctx->lock.
+static uint
+aiounread(struct aioctx *ctx)
+{
+  uint n;
+
+  n = ctx->cqtail - ctx->ring->cqhead;
+  return n > AIO_NENT ? AIO_NENT : n;
+}
+
+// Perform r using bounce page buf.  Returns bytes transferred,
+// or -1 if nothing could be.
+static int
+aiodo(struct aioreq *r, char *buf)
+{
+  uint done, m;
+  int n;
+
+  for(done = 0; done < r->n; done += n){
+    m = r->n - done;
+    if(m > PGSIZE)
+      m = PGSIZE;
+    if(r->op == AIO_READ){
+      n = filereadat(r->f, buf, m, r->off + done);
+      if(n > 0 && vmcopy(r->ctx->vm, r->buf + done, buf, n, 1) < 0)
+        return -1;
+    } else {
+      if(vmcopy(r->ctx->vm, r->buf + done, buf, m, 0) < 0)
+        return -1;
+      n = filewriteat(r->f, buf, m, r->off + done);
+    }
+    if(n < 0)
+      return done > 0 ? done : -1;
+    if(n < m)
+      return done + n;
+  }
+  return done;
+}
+
+static void
+aioworker(void)
+{
+  struct aioreq *r;
+  struct aioctx *ctx;
+  char *buf;
+  int res;
+
+  if((buf = kalloc()) == 0)
+    panic("aioworker");
+  for(;;){
+    acquire(&aioq.lock);
+    while(aioq.head == 0)
+      sleep(&aioq, &aioq.lock);
+    r = aioq.head;
+    if((aioq.head = r->next) == 0)
+      aioq.tail = 0;
+    release(&aioq.lock);
+
+    res = aiodo(r, buf);
+    fileclose(r->f);
+
+    ctx = r->ctx;
+    acquire(&ctx->lock);
+    aiopost(ctx, r->data, res);
+    if(r->op == AIO_WRITE){
+      ctx->nwrite[r->epoch % NEPOCH]--;
+      aiofsyncs(ctx);
+    }
+    release(&ctx->lock);
+    kmem_cache_free(aioq.reqcache, r);
+  }
+}
+
+// Map the rings into the current address space and return their
+// user address, starting the worker threads if they are not
+// already running.  Returns -1 if the address space already has
+// rings or if out of memory.
+int
+aiosetup(void)
+{
+  struct vmspace *vm = myproc()->vm;
+  struct aioctx *ctx;
+  char *mem;
+
+  acquire(&aioq.lock);
+  while(aioq.nworker < NAIOWORKER && kthread("aiod", aioworker) == 0)
+    aioq.nworker++;
+  release(&aioq.lock);
+  if(aioq.nworker == 0)
+    return -1;
+
+  // Threads sharing vm may race here; vm->lock makes one win.
+  ctx = 0;
+  mem = 0;
+  acquiresleep(&vm->lock);
+  if(vm->aio || uva2ka(vm->pgdir, (char*)AIORING) != 0)
+    goto bad;
+  if((ctx = kmem_cache_alloc(aioq.ctxcache)) == 0)
+    goto bad;
+  if((mem = kalloc()) == 0)
+    goto bad;
+  memset(mem, 0, PGSIZE);
+  if(mappages(vm->pgdir, (char*)AIORING, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0)
+    goto bad;
+  ctx->ring = (struct aioring*)mem;
+  ctx->vm = vm;
+  ctx->sqhead = ctx->cqtail = 0;
+  ctx->inflight = 0;
+  ctx->fhead = ctx->ftail = 0;
+  memset(ctx->nwrite, 0, sizeof(ctx->nwrite));
+  vm->aio = ctx;
+  releasesleep(&vm->lock);
+  return AIORING;
+
+bad:
+  releasesleep(&vm->lock);
+  if(mem)
+    kfree(mem);
+  if(ctx)
+    kmem_cache_free(aioq.ctxcache, ctx);
+  return -1;
+}
+
+// Check submission e and turn it into a request, with a
+// reference to its file.  Returns 0 if e is invalid.
+static struct aioreq*
+aioreq(struct aioctx *ctx, struct aiosqe *e)
+{
+  struct file *f;
+  struct aioreq *r;
+
+  if(e->fd < 0 || e->fd >= NOFILE || (f = myproc()->ofile[e->fd]) == 0)
+    return 0;
+  if(f->type != FD_INODE)
+    return 0;
+  if((e->op == AIO_READ && !f->readable) || (e->op == AIO_WRITE && !f->writable))
+    return 0;
+  if((uint)e->buf + e->n < (uint)e->buf || (uint)e->buf + e->n > AIORING)
+    return 0;
+  if((r = kmem_cache_alloc(aioq.reqcache)) == 0)
+    return 0;
+  r->ctx = ctx;
+  r->op = e->op;
+  r->f = filedup(f);
+  r->off = e->off;
+  r->buf = (uint)e->buf;
+  r->n = e->n;
+  r->data = e->data;
+  r->next = 0;
+  return r;
+}
+
+// Take up to n new submissions, then wait until at least minwait
+// completions are waiting to be consumed.  Returns the number of
+// submissions taken, which is less than asked for if the rings
+// are full, or -1 if the address space has no rings.
+int
+aioenter(int n, int minwait)
+{
+  struct aioctx *ctx;
+  struct aioring *ring;
+  struct aiosqe e;
+  struct aioreq *r;
+  int i;
+
+  if((ctx = myproc()->vm->aio) == 0)
+    return -1;
+  ring = ctx->ring;
+  acquire(&ctx->lock);
+  for(i = 0; i < n && ctx->sqhead != ring->sqtail; i++){
+    // Completions are posted only where the process has read,
+    // so leave room for every request in flight.
+    if(ctx->inflight + aiounread(ctx) >= AIO_NENT)
+      break;
+    __sync_synchronize();
+    e = ring->sq[ctx->sqhead % AIO_NENT];
+    ctx->sqhead++;
+    ring->sqhead = ctx->sqhead;
+    ctx->inflight++;
+
+    if(e.op == AIO_FSYNC){
+      ctx->fdata[ctx->ftail % AIO_NENT] = e.data;
+      ctx->ftail++;
+      aiofsyncs(ctx);
+      continue;
+    }
+    if((e.op != AIO_READ && e.op != AIO_WRITE) || (r = aioreq(ctx, &e)) == 0){
+      aiopost(ctx, e.data, -1);
+      continue;
+    }
+    if(r->op == AIO_WRITE){
+      r->epoch = ctx->ftail;
+      ctx->nwrite[r->epoch % NEPOCH]++;
+    }
+    acquire(&aioq.lock);
+    if(aioq.tail)
+      aioq.tail->next = r;
+    else
+      aioq.head = r;
+    aioq.tail = r;
+    wakeup(&aioq);
+    release(&aioq.lock);
+  }
+
+  while((int)aiounread(ctx) < minwait && ctx->inflight > 0 &&
+        !myproc()->killed)
+    sleep(ctx, &ctx->lock);
+  release(&ctx->lock);
+  return i;
+}
+
+// Wait until no request is in flight into vm.  The rings stay;
+// other threads sharing vm may go on using them.
+void
+aiodrain(struct vmspace *vm)
+{
+  struct aioctx *ctx;
+
+  if((ctx = vm->aio) == 0)
+    return;
+  acquire(&ctx->lock);
+  while(ctx->inflight > 0)
+    sleep(ctx, &ctx->lock);
+  release(&ctx->lock);
+}
+
+// Free vm's rings' state, when vm is being freed or its image
+// replaced and nothing is in flight into it.  The ring page
+// itself goes with vm's page table.
+void
+aiofree(struct vmspace *vm)
+{
+  if(vm->aio == 0)
+    return;
+  if(vm->aio->inflight > 0)
+    panic("aiofree");
+  kmem_cache_free(aioq.ctxcache, vm->aio);
+  vm->aio = 0;
+}
@@ -0,0 +1,38 @@
+// Asynchronous I/O rings, shared between a process and the kernel.
+// See aio.c.
+
+#define AIORING   0x7FFFD000   // user address of struct aioring
+#define AIO_NENT  64           // entries in each ring; a power of 2
+
+#define AIO_READ  1            // read n bytes at off into buf
+#define AIO_WRITE 2            // write n bytes from buf at off
+#define AIO_FSYNC 3            // complete once earlier writes are on disk
+
+// Submission queue entry, filled in by the process.
+struct aiosqe {
+  int op;                      // AIO_READ, AIO_WRITE or AIO_FSYNC
+  int fd;
+  uint off;                    // file offset; f->off is not used
+  char *buf;
+  uint n;
+  uint data;                   // copied to the completion
+};
+
+// Completion queue entry, filled in by the kernel.
+struct aiocqe {
+  uint data;                   // from the submission
+  int res;                     // bytes transferred, or -1
+};
+
+// The process adds entries at sqtail and the kernel consumes
+// them from sqhead; the kernel adds completions at cqtail and
+// the process consumes them from cqhead.  Indices only increase;
+// entry i is at [i % AIO_NENT].
+struct aioring {
+  volatile uint sqhead;
+  volatile uint sqtail;
+  volatile uint cqhead;
+  volatile uint cqtail;
+  struct aiosqe sq[AIO_NENT];
+  struct aiocqe cq[AIO_NENT];
+};
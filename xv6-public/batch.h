@@ -0,0 +1,10 @@
+// Records for the batch() system call.
+
+#define BATCH_NARG    6   // most arguments of any system call
+#define BATCH_STOPERR 1   // flag: stop at the first call that returns -1
+
+struct batchcall {
+  int num;               // system call number, from syscall.h
+  int args[BATCH_NARG];  // its arguments, as they would be on the stack
+  int ret;               // set to its return value
+};
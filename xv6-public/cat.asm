@@ -0,0 +1,2086 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 92 06 00 00       	call   6d9 <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 cc 06 00 00       	call   727 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 c3 0e 00 00       	push   $0xec3
+  6c:	6a 01                	push   $0x1
+  6e:	e8 4d 0a 00 00       	call   ac0 <printf>
+      exit();
+  73:	e8 df 05 00 00       	call   657 <exit>
+  }
+  exit();
+  78:	e8 da 05 00 00       	call   657 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 cb 05 00 00       	call   657 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 00 14 00 00       	push   $0x1400
+  a9:	6a 01                	push   $0x1
+  ab:	e8 0f 06 00 00       	call   6bf <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 00 14 00 00       	push   $0x1400
+  c4:	56                   	push   %esi
+  c5:	e8 db 05 00 00       	call   6a5 <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 a0 0e 00 00       	push   $0xea0
+  e4:	6a 01                	push   $0x1
+  e6:	e8 d5 09 00 00       	call   ac0 <printf>
+      exit();
+  eb:	e8 67 05 00 00       	call   657 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 b2 0e 00 00       	push   $0xeb2
+  f7:	6a 01                	push   $0x1
+  f9:	e8 c2 09 00 00       	call   ac0 <printf>
+    exit();
+  fe:	e8 54 05 00 00       	call   657 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 58 04 00 00       	call   6a5 <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 85 04 00 00       	call   727 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 be 04 00 00       	call   775 <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 18 04 00 00       	call   6d9 <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 35c:	5d                   	pop    %ebp
+ 35d:	c3                   	ret
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 360:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 361:	31 c0                	xor    %eax,%eax
+ 363:	ba 01 00 00 00       	mov    $0x1,%edx
+ 368:	89 e5                	mov    %esp,%ebp
+ 36a:	56                   	push   %esi
+ 36b:	53                   	push   %ebx
+ 36c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 36f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 373:	85 c0                	test   %eax,%eax
+ 375:	74 32                	je     3a9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 377:	83 f8 02             	cmp    $0x2,%eax
+ 37a:	74 0c                	je     388 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 37c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 381:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 384:	85 c0                	test   %eax,%eax
+ 386:	74 21                	je     3a9 <mutex_lock+0x49>
+ 388:	be 02 00 00 00       	mov    $0x2,%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 02                	push   $0x2
+ 395:	6a 00                	push   $0x0
+ 397:	53                   	push   %ebx
+ 398:	e8 2a 05 00 00       	call   8c7 <futex>
+ 39d:	89 f0                	mov    %esi,%eax
+ 39f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	75 e7                	jne    390 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 3a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3ac:	5b                   	pop    %ebx
+ 3ad:	5e                   	pop    %esi
+ 3ae:	5d                   	pop    %ebp
+ 3af:	c3                   	ret
+
+000003b0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	31 c0                	xor    %eax,%eax
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3be:	83 f8 02             	cmp    $0x2,%eax
+ 3c1:	74 05                	je     3c8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	6a 01                	push   $0x1
+ 3cd:	6a 01                	push   $0x1
+ 3cf:	52                   	push   %edx
+ 3d0:	e8 f2 04 00 00       	call   8c7 <futex>
+ 3d5:	83 c4 10             	add    $0x10,%esp
+}
+ 3d8:	c9                   	leave
+ 3d9:	c3                   	ret
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003e0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ec:	5d                   	pop    %ebp
+ 3ed:	c3                   	ret
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	31 c0                	xor    %eax,%eax
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	57                   	push   %edi
+ 3f6:	56                   	push   %esi
+ 3f7:	53                   	push   %ebx
+ 3f8:	83 ec 0c             	sub    $0xc,%esp
+ 3fb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 401:	8b 3e                	mov    (%esi),%edi
+ 403:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 406:	83 f8 02             	cmp    $0x2,%eax
+ 409:	74 5d                	je     468 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 40b:	83 ec 04             	sub    $0x4,%esp
+ 40e:	57                   	push   %edi
+ 40f:	6a 00                	push   $0x0
+ 411:	56                   	push   %esi
+ 412:	e8 b0 04 00 00       	call   8c7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 417:	31 c0                	xor    %eax,%eax
+ 419:	ba 01 00 00 00       	mov    $0x1,%edx
+ 41e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 422:	83 c4 10             	add    $0x10,%esp
+ 425:	85 c0                	test   %eax,%eax
+ 427:	74 30                	je     459 <cond_wait+0x69>
+  if(c != 2)
+ 429:	83 f8 02             	cmp    $0x2,%eax
+ 42c:	74 0c                	je     43a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 42e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 433:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 436:	85 c0                	test   %eax,%eax
+ 438:	74 1f                	je     459 <cond_wait+0x69>
+ 43a:	be 02 00 00 00       	mov    $0x2,%esi
+ 43f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 440:	83 ec 04             	sub    $0x4,%esp
+ 443:	6a 02                	push   $0x2
+ 445:	6a 00                	push   $0x0
+ 447:	53                   	push   %ebx
+ 448:	e8 7a 04 00 00       	call   8c7 <futex>
+ 44d:	89 f0                	mov    %esi,%eax
+ 44f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 452:	83 c4 10             	add    $0x10,%esp
+ 455:	85 c0                	test   %eax,%eax
+ 457:	75 e7                	jne    440 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 45c:	5b                   	pop    %ebx
+ 45d:	5e                   	pop    %esi
+ 45e:	5f                   	pop    %edi
+ 45f:	5d                   	pop    %ebp
+ 460:	c3                   	ret
+ 461:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 468:	83 ec 04             	sub    $0x4,%esp
+ 46b:	6a 01                	push   $0x1
+ 46d:	6a 01                	push   $0x1
+ 46f:	53                   	push   %ebx
+ 470:	e8 52 04 00 00       	call   8c7 <futex>
+ 475:	83 c4 10             	add    $0x10,%esp
+ 478:	eb 91                	jmp    40b <cond_wait+0x1b>
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000480 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	53                   	push   %ebx
+ 484:	83 ec 04             	sub    $0x4,%esp
+ 487:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 490:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 492:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 495:	89 c8                	mov    %ecx,%eax
+ 497:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 49b:	39 c1                	cmp    %eax,%ecx
+ 49d:	75 f1                	jne    490 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 49f:	83 ec 04             	sub    $0x4,%esp
+ 4a2:	6a 01                	push   $0x1
+ 4a4:	6a 01                	push   $0x1
+ 4a6:	52                   	push   %edx
+ 4a7:	e8 1b 04 00 00       	call   8c7 <futex>
+}
+ 4ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4af:	83 c4 10             	add    $0x10,%esp
+ 4b2:	c9                   	leave
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	83 ec 04             	sub    $0x4,%esp
+ 4c7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4d0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4d2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 4d5:	89 c8                	mov    %ecx,%eax
+ 4d7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4db:	39 c1                	cmp    %eax,%ecx
+ 4dd:	75 f1                	jne    4d0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 4df:	83 ec 04             	sub    $0x4,%esp
+ 4e2:	6a 40                	push   $0x40
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	52                   	push   %edx
+ 4e7:	e8 db 03 00 00       	call   8c7 <futex>
+}
+ 4ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	c9                   	leave
+ 4f3:	c3                   	ret
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 500:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 505:	c3                   	ret
+ 506:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 510:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 515:	85 c0                	test   %eax,%eax
+ 517:	74 07                	je     520 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 519:	c3                   	ret
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 520:	e9 d2 02 00 00       	jmp    7f7 <getpid>
+ 525:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 539:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 53b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 541:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 547:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 54c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 552:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 555:	89 d0                	mov    %edx,%eax
+ 557:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 55a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 560:	29 d9                	sub    %ebx,%ecx
+ 562:	89 c6                	mov    %eax,%esi
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	0f a5 c7             	shld   %cl,%eax,%edi
+ 569:	d3 e6                	shl    %cl,%esi
+ 56b:	31 c0                	xor    %eax,%eax
+ 56d:	f6 c1 20             	test   $0x20,%cl
+ 570:	0f 45 fe             	cmovne %esi,%edi
+ 573:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 576:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 579:	89 d9                	mov    %ebx,%ecx
+ 57b:	31 db                	xor    %ebx,%ebx
+ 57d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 583:	0f ad d0             	shrd   %cl,%edx,%eax
+ 586:	d3 ea                	shr    %cl,%edx
+ 588:	f6 c1 20             	test   $0x20,%cl
+ 58b:	0f 45 c2             	cmovne %edx,%eax
+ 58e:	0f 45 d3             	cmovne %ebx,%edx
+ 591:	01 f0                	add    %esi,%eax
+ 593:	11 fa                	adc    %edi,%edx
+}
+ 595:	83 c4 0c             	add    $0xc,%esp
+ 598:	5b                   	pop    %ebx
+ 599:	5e                   	pop    %esi
+ 59a:	5f                   	pop    %edi
+ 59b:	5d                   	pop    %ebp
+ 59c:	c3                   	ret
+ 59d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005a0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 5a9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 5b0:	74 0e                	je     5c0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 5b2:	83 c4 1c             	add    $0x1c,%esp
+ 5b5:	5b                   	pop    %ebx
+ 5b6:	5e                   	pop    %esi
+ 5b7:	5f                   	pop    %edi
+ 5b8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 5b9:	e9 a5 03 00 00       	jmp    963 <clock_gettime>
+ 5be:	66 90                	xchg   %ax,%ax
+ 5c0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 5c2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 5c8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5ce:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 5d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5db:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5e1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 5e7:	89 c6                	mov    %eax,%esi
+ 5e9:	89 d7                	mov    %edx,%edi
+ 5eb:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5ee:	d3 e6                	shl    %cl,%esi
+ 5f0:	31 c0                	xor    %eax,%eax
+ 5f2:	f6 c1 20             	test   $0x20,%cl
+ 5f5:	0f 45 fe             	cmovne %esi,%edi
+ 5f8:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5fe:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 605:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 60b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 60e:	d3 ea                	shr    %cl,%edx
+ 610:	f6 c1 20             	test   $0x20,%cl
+ 613:	74 04                	je     619 <vclock_gettime+0x79>
+ 615:	89 d0                	mov    %edx,%eax
+ 617:	31 d2                	xor    %edx,%edx
+ 619:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 61b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 620:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 622:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 624:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 626:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 628:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 62e:	29 c1                	sub    %eax,%ecx
+}
+ 630:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 632:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 635:	83 c4 1c             	add    $0x1c,%esp
+ 638:	5b                   	pop    %ebx
+ 639:	5e                   	pop    %esi
+ 63a:	5f                   	pop    %edi
+ 63b:	5d                   	pop    %ebp
+ 63c:	c3                   	ret
+
+0000063d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 63d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 642:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 649:	74 09                	je     654 <fork+0x17>
+ 64b:	89 e1                	mov    %esp,%ecx
+ 64d:	ba 56 06 00 00       	mov    $0x656,%edx
+ 652:	0f 34                	sysenter
+ 654:	cd 40                	int    $0x40
+ 656:	c3                   	ret
+
+00000657 <exit>:
+SYSCALL(exit)
+ 657:	b8 02 00 00 00       	mov    $0x2,%eax
+ 65c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 663:	74 09                	je     66e <exit+0x17>
+ 665:	89 e1                	mov    %esp,%ecx
+ 667:	ba 70 06 00 00       	mov    $0x670,%edx
+ 66c:	0f 34                	sysenter
+ 66e:	cd 40                	int    $0x40
+ 670:	c3                   	ret
+
+00000671 <wait>:
+SYSCALL(wait)
+ 671:	b8 03 00 00 00       	mov    $0x3,%eax
+ 676:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 67d:	74 09                	je     688 <wait+0x17>
+ 67f:	89 e1                	mov    %esp,%ecx
+ 681:	ba 8a 06 00 00       	mov    $0x68a,%edx
+ 686:	0f 34                	sysenter
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <pipe>:
+SYSCALL(pipe)
+ 68b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 690:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 697:	74 09                	je     6a2 <pipe+0x17>
+ 699:	89 e1                	mov    %esp,%ecx
+ 69b:	ba a4 06 00 00       	mov    $0x6a4,%edx
+ 6a0:	0f 34                	sysenter
+ 6a2:	cd 40                	int    $0x40
+ 6a4:	c3                   	ret
+
+000006a5 <read>:
+SYSCALL(read)
+ 6a5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6aa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6b1:	74 09                	je     6bc <read+0x17>
+ 6b3:	89 e1                	mov    %esp,%ecx
+ 6b5:	ba be 06 00 00       	mov    $0x6be,%edx
+ 6ba:	0f 34                	sysenter
+ 6bc:	cd 40                	int    $0x40
+ 6be:	c3                   	ret
+
+000006bf <write>:
+SYSCALL(write)
+ 6bf:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6c4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6cb:	74 09                	je     6d6 <write+0x17>
+ 6cd:	89 e1                	mov    %esp,%ecx
+ 6cf:	ba d8 06 00 00       	mov    $0x6d8,%edx
+ 6d4:	0f 34                	sysenter
+ 6d6:	cd 40                	int    $0x40
+ 6d8:	c3                   	ret
+
+000006d9 <close>:
+SYSCALL(close)
+ 6d9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6de:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6e5:	74 09                	je     6f0 <close+0x17>
+ 6e7:	89 e1                	mov    %esp,%ecx
+ 6e9:	ba f2 06 00 00       	mov    $0x6f2,%edx
+ 6ee:	0f 34                	sysenter
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <kill>:
+SYSCALL(kill)
+ 6f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6f8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6ff:	74 09                	je     70a <kill+0x17>
+ 701:	89 e1                	mov    %esp,%ecx
+ 703:	ba 0c 07 00 00       	mov    $0x70c,%edx
+ 708:	0f 34                	sysenter
+ 70a:	cd 40                	int    $0x40
+ 70c:	c3                   	ret
+
+0000070d <exec>:
+SYSCALL(exec)
+ 70d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 712:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 719:	74 09                	je     724 <exec+0x17>
+ 71b:	89 e1                	mov    %esp,%ecx
+ 71d:	ba 26 07 00 00       	mov    $0x726,%edx
+ 722:	0f 34                	sysenter
+ 724:	cd 40                	int    $0x40
+ 726:	c3                   	ret
+
+00000727 <open>:
+SYSCALL(open)
+ 727:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 72c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 733:	74 09                	je     73e <open+0x17>
+ 735:	89 e1                	mov    %esp,%ecx
+ 737:	ba 40 07 00 00       	mov    $0x740,%edx
+ 73c:	0f 34                	sysenter
+ 73e:	cd 40                	int    $0x40
+ 740:	c3                   	ret
+
+00000741 <mknod>:
+SYSCALL(mknod)
+ 741:	b8 11 00 00 00       	mov    $0x11,%eax
+ 746:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 74d:	74 09                	je     758 <mknod+0x17>
+ 74f:	89 e1                	mov    %esp,%ecx
+ 751:	ba 5a 07 00 00       	mov    $0x75a,%edx
+ 756:	0f 34                	sysenter
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <unlink>:
+SYSCALL(unlink)
+ 75b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 760:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 767:	74 09                	je     772 <unlink+0x17>
+ 769:	89 e1                	mov    %esp,%ecx
+ 76b:	ba 74 07 00 00       	mov    $0x774,%edx
+ 770:	0f 34                	sysenter
+ 772:	cd 40                	int    $0x40
+ 774:	c3                   	ret
+
+00000775 <fstat>:
+SYSCALL(fstat)
+ 775:	b8 08 00 00 00       	mov    $0x8,%eax
+ 77a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 781:	74 09                	je     78c <fstat+0x17>
+ 783:	89 e1                	mov    %esp,%ecx
+ 785:	ba 8e 07 00 00       	mov    $0x78e,%edx
+ 78a:	0f 34                	sysenter
+ 78c:	cd 40                	int    $0x40
+ 78e:	c3                   	ret
+
+0000078f <link>:
+SYSCALL(link)
+ 78f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 794:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 79b:	74 09                	je     7a6 <link+0x17>
+ 79d:	89 e1                	mov    %esp,%ecx
+ 79f:	ba a8 07 00 00       	mov    $0x7a8,%edx
+ 7a4:	0f 34                	sysenter
+ 7a6:	cd 40                	int    $0x40
+ 7a8:	c3                   	ret
+
+000007a9 <mkdir>:
+SYSCALL(mkdir)
+ 7a9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7ae:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7b5:	74 09                	je     7c0 <mkdir+0x17>
+ 7b7:	89 e1                	mov    %esp,%ecx
+ 7b9:	ba c2 07 00 00       	mov    $0x7c2,%edx
+ 7be:	0f 34                	sysenter
+ 7c0:	cd 40                	int    $0x40
+ 7c2:	c3                   	ret
+
+000007c3 <chdir>:
+SYSCALL(chdir)
+ 7c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7c8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7cf:	74 09                	je     7da <chdir+0x17>
+ 7d1:	89 e1                	mov    %esp,%ecx
+ 7d3:	ba dc 07 00 00       	mov    $0x7dc,%edx
+ 7d8:	0f 34                	sysenter
+ 7da:	cd 40                	int    $0x40
+ 7dc:	c3                   	ret
+
+000007dd <dup>:
+SYSCALL(dup)
+ 7dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7e2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7e9:	74 09                	je     7f4 <dup+0x17>
+ 7eb:	89 e1                	mov    %esp,%ecx
+ 7ed:	ba f6 07 00 00       	mov    $0x7f6,%edx
+ 7f2:	0f 34                	sysenter
+ 7f4:	cd 40                	int    $0x40
+ 7f6:	c3                   	ret
+
+000007f7 <getpid>:
+SYSCALL(getpid)
+ 7f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7fc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 803:	74 09                	je     80e <getpid+0x17>
+ 805:	89 e1                	mov    %esp,%ecx
+ 807:	ba 10 08 00 00       	mov    $0x810,%edx
+ 80c:	0f 34                	sysenter
+ 80e:	cd 40                	int    $0x40
+ 810:	c3                   	ret
+
+00000811 <sbrk>:
+SYSCALL(sbrk)
+ 811:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 816:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 81d:	74 09                	je     828 <sbrk+0x17>
+ 81f:	89 e1                	mov    %esp,%ecx
+ 821:	ba 2a 08 00 00       	mov    $0x82a,%edx
+ 826:	0f 34                	sysenter
+ 828:	cd 40                	int    $0x40
+ 82a:	c3                   	ret
+
+0000082b <sleep>:
+SYSCALL(sleep)
+ 82b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 830:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 837:	74 09                	je     842 <sleep+0x17>
+ 839:	89 e1                	mov    %esp,%ecx
+ 83b:	ba 44 08 00 00       	mov    $0x844,%edx
+ 840:	0f 34                	sysenter
+ 842:	cd 40                	int    $0x40
+ 844:	c3                   	ret
+
+00000845 <uptime>:
+SYSCALL(uptime)
+ 845:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 84a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 851:	74 09                	je     85c <uptime+0x17>
+ 853:	89 e1                	mov    %esp,%ecx
+ 855:	ba 5e 08 00 00       	mov    $0x85e,%edx
+ 85a:	0f 34                	sysenter
+ 85c:	cd 40                	int    $0x40
+ 85e:	c3                   	ret
+
+0000085f <mmap>:
+SYSCALL(mmap)
+ 85f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 864:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 86b:	74 09                	je     876 <mmap+0x17>
+ 86d:	89 e1                	mov    %esp,%ecx
+ 86f:	ba 78 08 00 00       	mov    $0x878,%edx
+ 874:	0f 34                	sysenter
+ 876:	cd 40                	int    $0x40
+ 878:	c3                   	ret
+
+00000879 <munmap>:
+SYSCALL(munmap)
+ 879:	b8 17 00 00 00       	mov    $0x17,%eax
+ 87e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 885:	74 09                	je     890 <munmap+0x17>
+ 887:	89 e1                	mov    %esp,%ecx
+ 889:	ba 92 08 00 00       	mov    $0x892,%edx
+ 88e:	0f 34                	sysenter
+ 890:	cd 40                	int    $0x40
+ 892:	c3                   	ret
+
+00000893 <clone>:
+SYSCALL(clone)
+ 893:	b8 18 00 00 00       	mov    $0x18,%eax
+ 898:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 89f:	74 09                	je     8aa <clone+0x17>
+ 8a1:	89 e1                	mov    %esp,%ecx
+ 8a3:	ba ac 08 00 00       	mov    $0x8ac,%edx
+ 8a8:	0f 34                	sysenter
+ 8aa:	cd 40                	int    $0x40
+ 8ac:	c3                   	ret
+
+000008ad <join>:
+SYSCALL(join)
+ 8ad:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8b2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8b9:	74 09                	je     8c4 <join+0x17>
+ 8bb:	89 e1                	mov    %esp,%ecx
+ 8bd:	ba c6 08 00 00       	mov    $0x8c6,%edx
+ 8c2:	0f 34                	sysenter
+ 8c4:	cd 40                	int    $0x40
+ 8c6:	c3                   	ret
+
+000008c7 <futex>:
+SYSCALL(futex)
+ 8c7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8cc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8d3:	74 09                	je     8de <futex+0x17>
+ 8d5:	89 e1                	mov    %esp,%ecx
+ 8d7:	ba e0 08 00 00       	mov    $0x8e0,%edx
+ 8dc:	0f 34                	sysenter
+ 8de:	cd 40                	int    $0x40
+ 8e0:	c3                   	ret
+
+000008e1 <memstat>:
+SYSCALL(memstat)
+ 8e1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8e6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8ed:	74 09                	je     8f8 <memstat+0x17>
+ 8ef:	89 e1                	mov    %esp,%ecx
+ 8f1:	ba fa 08 00 00       	mov    $0x8fa,%edx
+ 8f6:	0f 34                	sysenter
+ 8f8:	cd 40                	int    $0x40
+ 8fa:	c3                   	ret
+
+000008fb <nice>:
+SYSCALL(nice)
+ 8fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 900:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 907:	74 09                	je     912 <nice+0x17>
+ 909:	89 e1                	mov    %esp,%ecx
+ 90b:	ba 14 09 00 00       	mov    $0x914,%edx
+ 910:	0f 34                	sysenter
+ 912:	cd 40                	int    $0x40
+ 914:	c3                   	ret
+
+00000915 <setpriority>:
+SYSCALL(setpriority)
+ 915:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 91a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 921:	74 09                	je     92c <setpriority+0x17>
+ 923:	89 e1                	mov    %esp,%ecx
+ 925:	ba 2e 09 00 00       	mov    $0x92e,%edx
+ 92a:	0f 34                	sysenter
+ 92c:	cd 40                	int    $0x40
+ 92e:	c3                   	ret
+
+0000092f <getpinfo>:
+SYSCALL(getpinfo)
+ 92f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 934:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 93b:	74 09                	je     946 <getpinfo+0x17>
+ 93d:	89 e1                	mov    %esp,%ecx
+ 93f:	ba 48 09 00 00       	mov    $0x948,%edx
+ 944:	0f 34                	sysenter
+ 946:	cd 40                	int    $0x40
+ 948:	c3                   	ret
+
+00000949 <settickets>:
+SYSCALL(settickets)
+ 949:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 94e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 955:	74 09                	je     960 <settickets+0x17>
+ 957:	89 e1                	mov    %esp,%ecx
+ 959:	ba 62 09 00 00       	mov    $0x962,%edx
+ 95e:	0f 34                	sysenter
+ 960:	cd 40                	int    $0x40
+ 962:	c3                   	ret
+
+00000963 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 963:	b8 20 00 00 00       	mov    $0x20,%eax
+ 968:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 96f:	74 09                	je     97a <clock_gettime+0x17>
+ 971:	89 e1                	mov    %esp,%ecx
+ 973:	ba 7c 09 00 00       	mov    $0x97c,%edx
+ 978:	0f 34                	sysenter
+ 97a:	cd 40                	int    $0x40
+ 97c:	c3                   	ret
+
+0000097d <batch>:
+SYSCALL(batch)
+ 97d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 982:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 989:	74 09                	je     994 <batch+0x17>
+ 98b:	89 e1                	mov    %esp,%ecx
+ 98d:	ba 96 09 00 00       	mov    $0x996,%edx
+ 992:	0f 34                	sysenter
+ 994:	cd 40                	int    $0x40
+ 996:	c3                   	ret
+
+00000997 <aiosetup>:
+SYSCALL(aiosetup)
+ 997:	b8 22 00 00 00       	mov    $0x22,%eax
+ 99c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9a3:	74 09                	je     9ae <aiosetup+0x17>
+ 9a5:	89 e1                	mov    %esp,%ecx
+ 9a7:	ba b0 09 00 00       	mov    $0x9b0,%edx
+ 9ac:	0f 34                	sysenter
+ 9ae:	cd 40                	int    $0x40
+ 9b0:	c3                   	ret
+
+000009b1 <aioenter>:
+SYSCALL(aioenter)
+ 9b1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9b6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9bd:	74 09                	je     9c8 <aioenter+0x17>
+ 9bf:	89 e1                	mov    %esp,%ecx
+ 9c1:	ba ca 09 00 00       	mov    $0x9ca,%edx
+ 9c6:	0f 34                	sysenter
+ 9c8:	cd 40                	int    $0x40
+ 9ca:	c3                   	ret
+
+000009cb <systrace>:
+SYSCALL(systrace)
+ 9cb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9d0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9d7:	74 09                	je     9e2 <systrace+0x17>
+ 9d9:	89 e1                	mov    %esp,%ecx
+ 9db:	ba e4 09 00 00       	mov    $0x9e4,%edx
+ 9e0:	0f 34                	sysenter
+ 9e2:	cd 40                	int    $0x40
+ 9e4:	c3                   	ret
+
+000009e5 <sysstat>:
+SYSCALL(sysstat)
+ 9e5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9ea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9f1:	74 09                	je     9fc <sysstat+0x17>
+ 9f3:	89 e1                	mov    %esp,%ecx
+ 9f5:	ba fe 09 00 00       	mov    $0x9fe,%edx
+ 9fa:	0f 34                	sysenter
+ 9fc:	cd 40                	int    $0x40
+ 9fe:	c3                   	ret
+
+000009ff <traceread>:
+SYSCALL(traceread)
+ 9ff:	b8 26 00 00 00       	mov    $0x26,%eax
+ a04:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a0b:	74 09                	je     a16 <traceread+0x17>
+ a0d:	89 e1                	mov    %esp,%ecx
+ a0f:	ba 18 0a 00 00       	mov    $0xa18,%edx
+ a14:	0f 34                	sysenter
+ a16:	cd 40                	int    $0x40
+ a18:	c3                   	ret
+ a19:	66 90                	xchg   %ax,%ax
+ a1b:	66 90                	xchg   %ax,%ax
+ a1d:	66 90                	xchg   %ax,%ax
+ a1f:	90                   	nop
+
+00000a20 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a28:	89 d1                	mov    %edx,%ecx
+{
+ a2a:	83 ec 3c             	sub    $0x3c,%esp
+ a2d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a30:	85 d2                	test   %edx,%edx
+ a32:	0f 89 80 00 00 00    	jns    ab8 <printint+0x98>
+ a38:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a3c:	74 7a                	je     ab8 <printint+0x98>
+    x = -xx;
+ a3e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a40:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a45:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a48:	31 f6                	xor    %esi,%esi
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a50:	89 c8                	mov    %ecx,%eax
+ a52:	31 d2                	xor    %edx,%edx
+ a54:	89 f7                	mov    %esi,%edi
+ a56:	f7 f3                	div    %ebx
+ a58:	8d 76 01             	lea    0x1(%esi),%esi
+ a5b:	0f b6 92 38 0f 00 00 	movzbl 0xf38(%edx),%edx
+ a62:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a66:	89 ca                	mov    %ecx,%edx
+ a68:	89 c1                	mov    %eax,%ecx
+ a6a:	39 da                	cmp    %ebx,%edx
+ a6c:	73 e2                	jae    a50 <printint+0x30>
+  if(neg)
+ a6e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a71:	85 c0                	test   %eax,%eax
+ a73:	74 07                	je     a7c <printint+0x5c>
+    buf[i++] = '-';
+ a75:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a7a:	89 f7                	mov    %esi,%edi
+ a7c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a7f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a82:	01 df                	add    %ebx,%edi
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a88:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a91:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a94:	6a 01                	push   $0x1
+ a96:	50                   	push   %eax
+ a97:	56                   	push   %esi
+ a98:	e8 22 fc ff ff       	call   6bf <write>
+  while(--i >= 0)
+ a9d:	89 f8                	mov    %edi,%eax
+ a9f:	83 c4 10             	add    $0x10,%esp
+ aa2:	83 ef 01             	sub    $0x1,%edi
+ aa5:	39 d8                	cmp    %ebx,%eax
+ aa7:	75 df                	jne    a88 <printint+0x68>
+}
+ aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aac:	5b                   	pop    %ebx
+ aad:	5e                   	pop    %esi
+ aae:	5f                   	pop    %edi
+ aaf:	5d                   	pop    %ebp
+ ab0:	c3                   	ret
+ ab1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ab8:	31 c0                	xor    %eax,%eax
+ aba:	eb 89                	jmp    a45 <printint+0x25>
+ abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ac0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ac9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ acc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ acf:	0f b6 1e             	movzbl (%esi),%ebx
+ ad2:	83 c6 01             	add    $0x1,%esi
+ ad5:	84 db                	test   %bl,%bl
+ ad7:	74 67                	je     b40 <printf+0x80>
+ ad9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ adc:	31 d2                	xor    %edx,%edx
+ ade:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ ae1:	eb 34                	jmp    b17 <printf+0x57>
+ ae3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ae7:	90                   	nop
+ ae8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ aeb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ af0:	83 f8 25             	cmp    $0x25,%eax
+ af3:	74 18                	je     b0d <printf+0x4d>
+  write(fd, &c, 1);
+ af5:	83 ec 04             	sub    $0x4,%esp
+ af8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ afb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ afe:	6a 01                	push   $0x1
+ b00:	50                   	push   %eax
+ b01:	57                   	push   %edi
+ b02:	e8 b8 fb ff ff       	call   6bf <write>
+ b07:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b0d:	0f b6 1e             	movzbl (%esi),%ebx
+ b10:	83 c6 01             	add    $0x1,%esi
+ b13:	84 db                	test   %bl,%bl
+ b15:	74 29                	je     b40 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b17:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b1a:	85 d2                	test   %edx,%edx
+ b1c:	74 ca                	je     ae8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b1e:	83 fa 25             	cmp    $0x25,%edx
+ b21:	75 ea                	jne    b0d <printf+0x4d>
+      if(c == 'd'){
+ b23:	83 f8 25             	cmp    $0x25,%eax
+ b26:	0f 84 24 01 00 00    	je     c50 <printf+0x190>
+ b2c:	83 e8 63             	sub    $0x63,%eax
+ b2f:	83 f8 15             	cmp    $0x15,%eax
+ b32:	77 1c                	ja     b50 <printf+0x90>
+ b34:	ff 24 85 e0 0e 00 00 	jmp    *0xee0(,%eax,4)
+ b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b43:	5b                   	pop    %ebx
+ b44:	5e                   	pop    %esi
+ b45:	5f                   	pop    %edi
+ b46:	5d                   	pop    %ebp
+ b47:	c3                   	ret
+ b48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+  write(fd, &c, 1);
+ b50:	83 ec 04             	sub    $0x4,%esp
+ b53:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b56:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b5a:	6a 01                	push   $0x1
+ b5c:	52                   	push   %edx
+ b5d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b60:	57                   	push   %edi
+ b61:	e8 59 fb ff ff       	call   6bf <write>
+ b66:	83 c4 0c             	add    $0xc,%esp
+ b69:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b6c:	6a 01                	push   $0x1
+ b6e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b71:	52                   	push   %edx
+ b72:	57                   	push   %edi
+ b73:	e8 47 fb ff ff       	call   6bf <write>
+        putc(fd, c);
+ b78:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b7b:	31 d2                	xor    %edx,%edx
+ b7d:	eb 8e                	jmp    b0d <printf+0x4d>
+ b7f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b8b:	8b 13                	mov    (%ebx),%edx
+ b8d:	6a 00                	push   $0x0
+ b8f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b91:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b94:	e8 87 fe ff ff       	call   a20 <printint>
+        ap++;
+ b99:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b9f:	31 d2                	xor    %edx,%edx
+ ba1:	e9 67 ff ff ff       	jmp    b0d <printf+0x4d>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bb0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bb3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bb5:	83 c0 04             	add    $0x4,%eax
+ bb8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bbb:	85 db                	test   %ebx,%ebx
+ bbd:	0f 84 9d 00 00 00    	je     c60 <printf+0x1a0>
+        while(*s != 0){
+ bc3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bc6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bc8:	84 c0                	test   %al,%al
+ bca:	0f 84 3d ff ff ff    	je     b0d <printf+0x4d>
+ bd0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bd3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ bd6:	89 de                	mov    %ebx,%esi
+ bd8:	89 d3                	mov    %edx,%ebx
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ be0:	83 ec 04             	sub    $0x4,%esp
+ be3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ be6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ be9:	6a 01                	push   $0x1
+ beb:	53                   	push   %ebx
+ bec:	57                   	push   %edi
+ bed:	e8 cd fa ff ff       	call   6bf <write>
+        while(*s != 0){
+ bf2:	0f b6 06             	movzbl (%esi),%eax
+ bf5:	83 c4 10             	add    $0x10,%esp
+ bf8:	84 c0                	test   %al,%al
+ bfa:	75 e4                	jne    be0 <printf+0x120>
+      state = 0;
+ bfc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ bff:	31 d2                	xor    %edx,%edx
+ c01:	e9 07 ff ff ff       	jmp    b0d <printf+0x4d>
+ c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c13:	83 ec 0c             	sub    $0xc,%esp
+ c16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c1b:	8b 13                	mov    (%ebx),%edx
+ c1d:	6a 01                	push   $0x1
+ c1f:	e9 6b ff ff ff       	jmp    b8f <printf+0xcf>
+ c24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c2b:	83 ec 04             	sub    $0x4,%esp
+ c2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c39:	6a 01                	push   $0x1
+ c3b:	52                   	push   %edx
+ c3c:	57                   	push   %edi
+ c3d:	e8 7d fa ff ff       	call   6bf <write>
+        ap++;
+ c42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c48:	31 d2                	xor    %edx,%edx
+ c4a:	e9 be fe ff ff       	jmp    b0d <printf+0x4d>
+ c4f:	90                   	nop
+  write(fd, &c, 1);
+ c50:	83 ec 04             	sub    $0x4,%esp
+ c53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c59:	6a 01                	push   $0x1
+ c5b:	e9 11 ff ff ff       	jmp    b71 <printf+0xb1>
+ c60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c65:	bb d8 0e 00 00       	mov    $0xed8,%ebx
+ c6a:	e9 61 ff ff ff       	jmp    bd0 <printf+0x110>
+ c6f:	90                   	nop
+
+00000c70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c71:	a1 00 16 00 00       	mov    0x1600,%eax
+{
+ c76:	89 e5                	mov    %esp,%ebp
+ c78:	57                   	push   %edi
+ c79:	56                   	push   %esi
+ c7a:	53                   	push   %ebx
+ c7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c8c:	39 ca                	cmp    %ecx,%edx
+ c8e:	73 30                	jae    cc0 <free+0x50>
+ c90:	39 c1                	cmp    %eax,%ecx
+ c92:	72 04                	jb     c98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c94:	39 c2                	cmp    %eax,%edx
+ c96:	72 f0                	jb     c88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c9e:	39 f8                	cmp    %edi,%eax
+ ca0:	74 2e                	je     cd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ca2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ca5:	8b 42 04             	mov    0x4(%edx),%eax
+ ca8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cab:	39 f1                	cmp    %esi,%ecx
+ cad:	74 38                	je     ce7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ caf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cb1:	5b                   	pop    %ebx
+  freep = p;
+ cb2:	89 15 00 16 00 00    	mov    %edx,0x1600
+}
+ cb8:	5e                   	pop    %esi
+ cb9:	5f                   	pop    %edi
+ cba:	5d                   	pop    %ebp
+ cbb:	c3                   	ret
+ cbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cc0:	39 c1                	cmp    %eax,%ecx
+ cc2:	72 d0                	jb     c94 <free+0x24>
+ cc4:	eb c2                	jmp    c88 <free+0x18>
+ cc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ccd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cd0:	03 70 04             	add    0x4(%eax),%esi
+ cd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cd6:	8b 02                	mov    (%edx),%eax
+ cd8:	8b 00                	mov    (%eax),%eax
+ cda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cdd:	8b 42 04             	mov    0x4(%edx),%eax
+ ce0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ce3:	39 f1                	cmp    %esi,%ecx
+ ce5:	75 c8                	jne    caf <free+0x3f>
+    p->s.size += bp->s.size;
+ ce7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cea:	89 15 00 16 00 00    	mov    %edx,0x1600
+    p->s.size += bp->s.size;
+ cf0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cf3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cf6:	89 0a                	mov    %ecx,(%edx)
+}
+ cf8:	5b                   	pop    %ebx
+ cf9:	5e                   	pop    %esi
+ cfa:	5f                   	pop    %edi
+ cfb:	5d                   	pop    %ebp
+ cfc:	c3                   	ret
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d00:	55                   	push   %ebp
+ d01:	89 e5                	mov    %esp,%ebp
+ d03:	57                   	push   %edi
+ d04:	56                   	push   %esi
+ d05:	53                   	push   %ebx
+ d06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d0c:	8b 15 00 16 00 00    	mov    0x1600,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d12:	8d 78 07             	lea    0x7(%eax),%edi
+ d15:	c1 ef 03             	shr    $0x3,%edi
+ d18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d1b:	85 d2                	test   %edx,%edx
+ d1d:	0f 84 8d 00 00 00    	je     db0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d25:	8b 48 04             	mov    0x4(%eax),%ecx
+ d28:	39 f9                	cmp    %edi,%ecx
+ d2a:	73 64                	jae    d90 <malloc+0x90>
+  if(nu < 4096)
+ d2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d31:	39 df                	cmp    %ebx,%edi
+ d33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d3d:	eb 0a                	jmp    d49 <malloc+0x49>
+ d3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d42:	8b 48 04             	mov    0x4(%eax),%ecx
+ d45:	39 f9                	cmp    %edi,%ecx
+ d47:	73 47                	jae    d90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d49:	89 c2                	mov    %eax,%edx
+ d4b:	39 05 00 16 00 00    	cmp    %eax,0x1600
+ d51:	75 ed                	jne    d40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d53:	83 ec 0c             	sub    $0xc,%esp
+ d56:	56                   	push   %esi
+ d57:	e8 b5 fa ff ff       	call   811 <sbrk>
+  if(p == (char*)-1)
+ d5c:	83 c4 10             	add    $0x10,%esp
+ d5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d62:	74 1c                	je     d80 <malloc+0x80>
+  hp->s.size = nu;
+ d64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d67:	83 ec 0c             	sub    $0xc,%esp
+ d6a:	83 c0 08             	add    $0x8,%eax
+ d6d:	50                   	push   %eax
+ d6e:	e8 fd fe ff ff       	call   c70 <free>
+  return freep;
+ d73:	8b 15 00 16 00 00    	mov    0x1600,%edx
+      if((p = morecore(nunits)) == 0)
+ d79:	83 c4 10             	add    $0x10,%esp
+ d7c:	85 d2                	test   %edx,%edx
+ d7e:	75 c0                	jne    d40 <malloc+0x40>
+        return 0;
+  }
+}
+ d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d83:	31 c0                	xor    %eax,%eax
+}
+ d85:	5b                   	pop    %ebx
+ d86:	5e                   	pop    %esi
+ d87:	5f                   	pop    %edi
+ d88:	5d                   	pop    %ebp
+ d89:	c3                   	ret
+ d8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d90:	39 cf                	cmp    %ecx,%edi
+ d92:	74 4c                	je     de0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d94:	29 f9                	sub    %edi,%ecx
+ d96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d9f:	89 15 00 16 00 00    	mov    %edx,0x1600
+}
+ da5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ da8:	83 c0 08             	add    $0x8,%eax
+}
+ dab:	5b                   	pop    %ebx
+ dac:	5e                   	pop    %esi
+ dad:	5f                   	pop    %edi
+ dae:	5d                   	pop    %ebp
+ daf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ db0:	c7 05 00 16 00 00 04 	movl   $0x1604,0x1600
+ db7:	16 00 00 
+    base.s.size = 0;
+ dba:	b8 04 16 00 00       	mov    $0x1604,%eax
+    base.s.ptr = freep = prevp = &base;
+ dbf:	c7 05 04 16 00 00 04 	movl   $0x1604,0x1604
+ dc6:	16 00 00 
+    base.s.size = 0;
+ dc9:	c7 05 08 16 00 00 00 	movl   $0x0,0x1608
+ dd0:	00 00 00 
+    if(p->s.size >= nunits){
+ dd3:	e9 54 ff ff ff       	jmp    d2c <malloc+0x2c>
+ dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ddf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ de0:	8b 08                	mov    (%eax),%ecx
+ de2:	89 0a                	mov    %ecx,(%edx)
+ de4:	eb b9                	jmp    d9f <malloc+0x9f>
+ de6:	66 90                	xchg   %ax,%ax
+ de8:	66 90                	xchg   %ax,%ax
+ dea:	66 90                	xchg   %ax,%ax
+ dec:	66 90                	xchg   %ax,%ax
+ dee:	66 90                	xchg   %ax,%ax
+
+00000df0 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	53                   	push   %ebx
+ df4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ df7:	68 00 20 00 00       	push   $0x2000
+ dfc:	e8 ff fe ff ff       	call   d00 <malloc>
+ e01:	83 c4 10             	add    $0x10,%esp
+ e04:	85 c0                	test   %eax,%eax
+ e06:	74 47                	je     e4f <thread_create+0x5f>
+ e08:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e0a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ e10:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e13:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ e18:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ e1b:	ff 75 0c             	push   0xc(%ebp)
+ e1e:	50                   	push   %eax
+ e1f:	ff 75 08             	push   0x8(%ebp)
+ e22:	e8 6c fa ff ff       	call   893 <clone>
+ e27:	83 c4 10             	add    $0x10,%esp
+ e2a:	85 c0                	test   %eax,%eax
+ e2c:	78 0a                	js     e38 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e2e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e31:	c9                   	leave
+ e32:	c3                   	ret
+ e33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e37:	90                   	nop
+    free(mem);
+ e38:	83 ec 0c             	sub    $0xc,%esp
+ e3b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e3e:	53                   	push   %ebx
+ e3f:	e8 2c fe ff ff       	call   c70 <free>
+ e44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e4a:	83 c4 10             	add    $0x10,%esp
+}
+ e4d:	c9                   	leave
+ e4e:	c3                   	ret
+    return -1;
+ e4f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e54:	eb d8                	jmp    e2e <thread_create+0x3e>
+ e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e60 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ e67:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ e6a:	50                   	push   %eax
+ e6b:	e8 3d fa ff ff       	call   8ad <join>
+ e70:	83 c4 10             	add    $0x10,%esp
+ e73:	85 c0                	test   %eax,%eax
+ e75:	78 21                	js     e98 <thread_join+0x38>
+ e77:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ e79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e7c:	83 ec 0c             	sub    $0xc,%esp
+ e7f:	ff 70 fc             	push   -0x4(%eax)
+ e82:	e8 e9 fd ff ff       	call   c70 <free>
+  return pid;
+ e87:	83 c4 10             	add    $0x10,%esp
+}
+ e8a:	89 d8                	mov    %ebx,%eax
+ e8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e8f:	c9                   	leave
+ e90:	c3                   	ret
+ e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ e98:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ e9d:	eb eb                	jmp    e8a <thread_join+0x2a>
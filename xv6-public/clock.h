@@ -0,0 +1,8 @@
+// Clocks for the clock_gettime() system call.
+
+#define CLOCK_MONOTONIC 1   // time since boot, from the TSC
+
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;
+};
@@ -0,0 +1,67 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "mmap.h"
+
+#define NTHREADS 4
+
+int slots[NTHREADS];
+char *shared;
+
+void worker(void *arg) {
+    int id = (int)arg;
+
+    /* Threads share globals, the heap and mmap regions */
+    slots[id] = id + 1;
+    shared[id] = 'a' + id;
+    exit();
+}
+
+int main() {
+    int len = 4096;
+    int prot = PROT_READ | PROT_WRITE;
+    int flags = MAP_ANON | MAP_SHARED;
+
+    shared = mmap(0, len, prot, flags, -1, 0);
+    if (shared == (void *)-1) {
+        printf(1, "mmap FAILED\n");
+        goto failed;
+    }
+
+    for (int i = 0; i < NTHREADS; i++) {
+        if (thread_create(worker, (void *)i) < 0) {
+            printf(1, "thread_create FAILED\n");
+            goto failed;
+        }
+    }
+    for (int i = 0; i < NTHREADS; i++) {
+        if (thread_join() < 0) {
+            printf(1, "thread_join FAILED\n");
+            goto failed;
+        }
+    }
+    if (thread_join() != -1) {
+        printf(1, "thread_join joined too many\n");
+        goto failed;
+    }
+
+    for (int i = 0; i < NTHREADS; i++) {
+        if (slots[i] != i + 1 || shared[i] != 'a' + i) {
+            printf(1, "thread %d write not visible\n", i);
+            goto failed;
+        }
+    }
+
+    if (munmap(shared, len) < 0) {
+        printf(1, "munmap FAILED\n");
+        goto failed;
+    }
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
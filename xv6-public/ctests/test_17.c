@@ -0,0 +1,98 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "mmap.h"
+#include "futex.h"
+
+#define NTHREADS 4
+#define NITERS 500
+
+struct mutex lock;
+struct cond ready;
+int counter;
+int started;
+
+void worker(void *arg) {
+    for (int i = 0; i < NITERS; i++) {
+        mutex_lock(&lock);
+        int c = counter;
+        if (i % 50 == 0)
+            sleep(0);   /* encourage contention inside the lock */
+        counter = c + 1;
+        mutex_unlock(&lock);
+    }
+
+    mutex_lock(&lock);
+    started++;
+    cond_signal(&ready);
+    mutex_unlock(&lock);
+    exit();
+}
+
+int main() {
+    int len = 4096;
+    int prot = PROT_READ | PROT_WRITE;
+    int flags = MAP_ANON | MAP_SHARED;
+
+    /* Mutex and condvar between threads */
+    mutex_init(&lock);
+    cond_init(&ready);
+    for (int i = 0; i < NTHREADS; i++) {
+        if (thread_create(worker, 0) < 0) {
+            printf(1, "thread_create FAILED\n");
+            goto failed;
+        }
+    }
+    mutex_lock(&lock);
+    while (started < NTHREADS)
+        cond_wait(&ready, &lock);
+    mutex_unlock(&lock);
+    for (int i = 0; i < NTHREADS; i++)
+        thread_join();
+    if (counter != NTHREADS * NITERS) {
+        printf(1, "counter %d, expected %d\n", counter, NTHREADS * NITERS);
+        goto failed;
+    }
+
+    /* Waiting on a word that does not hold val returns at once */
+    if (futex((uint *)&counter, FUTEX_WAIT, counter + 1) != -1) {
+        printf(1, "futex wait on stale value FAILED\n");
+        goto failed;
+    }
+
+    /* Futex in a MAP_SHARED region between processes */
+    volatile uint *word = mmap(0, len, prot, flags, -1, 0);
+    if (word == (void *)-1) {
+        printf(1, "mmap FAILED\n");
+        goto failed;
+    }
+    *word = 0;
+
+    int pid = fork();
+    if (pid < 0) {
+        printf(1, "fork FAILED\n");
+        goto failed;
+    }
+    if (pid == 0) {
+        sleep(5);
+        *word = 1;
+        futex(word, FUTEX_WAKE, 1);
+        exit();
+    }
+    while (*word == 0)
+        futex(word, FUTEX_WAIT, 0);
+    wait();
+
+    if (munmap((void *)word, len) < 0) {
+        printf(1, "munmap FAILED\n");
+        goto failed;
+    }
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
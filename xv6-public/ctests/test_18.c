@@ -0,0 +1,84 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "param.h"
+#include "pstat.h"
+
+struct pstat st;
+
+int slot(int pid) {
+    for (int i = 0; i < NPROC; i++)
+        if (st.inuse[i] && st.pid[i] == pid)
+            return i;
+    return -1;
+}
+
+int main() {
+    int pid, i, s, total;
+    volatile int x = 0;
+
+    /* nice() clamps to the available levels */
+    if (nice(-5) != 0 || nice(NMLFQ + 3) != NMLFQ - 1 || nice(-(NMLFQ - 1)) != 0) {
+        printf(1, "nice did not clamp\n");
+        goto failed;
+    }
+    if (setpriority(-1, 0) != -1 || setpriority(getpid(), NMLFQ) != -1) {
+        printf(1, "setpriority accepted bad arguments\n");
+        goto failed;
+    }
+
+    pid = fork();
+    if (pid < 0) {
+        printf(1, "fork FAILED\n");
+        goto failed;
+    }
+    if (pid == 0) {
+        for (;;)
+            x++;
+    }
+
+    /* a CPU-bound child sinks below the top level */
+    for (i = 0; i < 200; i++) {
+        sleep(1);
+        if (getpinfo(&st) < 0) {
+            printf(1, "getpinfo FAILED\n");
+            goto failed;
+        }
+        s = slot(pid);
+        if (s >= 0 && st.level[s] > 0)
+            break;
+    }
+    if (s < 0 || st.level[s] == 0) {
+        printf(1, "spinning child stayed at level 0\n");
+        goto failed;
+    }
+    total = 0;
+    for (i = 0; i < NMLFQ; i++)
+        total += st.ticks[s][i];
+    if (st.ticks[s][0] == 0 || total < 2) {
+        printf(1, "child ticks not accounted\n");
+        goto failed;
+    }
+
+    /* setpriority sets both base and current level */
+    if (setpriority(pid, 2) < 0 || getpinfo(&st) < 0) {
+        printf(1, "setpriority FAILED\n");
+        goto failed;
+    }
+    s = slot(pid);
+    if (st.nice[s] != 2 || st.level[s] < 2) {
+        printf(1, "setpriority not visible\n");
+        goto failed;
+    }
+
+    kill(pid);
+    wait();
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
@@ -0,0 +1,47 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "param.h"
+#include "clock.h"
+
+/* microseconds from a to b */
+int usdiff(struct timespec *a, struct timespec *b) {
+    return (b->tv_sec - a->tv_sec) * 1000000 +
+           ((int)b->tv_nsec - (int)a->tv_nsec) / 1000;
+}
+
+int main() {
+    struct timespec t0, t1, t2;
+    int us;
+
+    if (clock_gettime(CLOCK_MONOTONIC + 1, &t0) != -1) {
+        printf(1, "clock_gettime accepted a bad clock\n");
+        goto failed;
+    }
+    if (clock_gettime(CLOCK_MONOTONIC, &t0) < 0 ||
+        clock_gettime(CLOCK_MONOTONIC, &t1) < 0) {
+        printf(1, "clock_gettime FAILED\n");
+        goto failed;
+    }
+    if (t0.tv_nsec >= 1000000000 || usdiff(&t0, &t1) < 0) {
+        printf(1, "clock went backwards\n");
+        goto failed;
+    }
+
+    /* sleeping HZ/10 ticks should take about 100ms */
+    sleep(HZ / 10);
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    us = usdiff(&t1, &t2);
+    if (us < 50000 || us > 2000000) {
+        printf(1, "sleep of %d ticks took %d us\n", HZ / 10, us);
+        goto failed;
+    }
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
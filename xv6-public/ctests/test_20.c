@@ -0,0 +1,68 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "clock.h"
+#include "vdso.h"
+
+int threadpid;
+
+void worker(void *arg) {
+    threadpid = vgetpid() == getpid() ? 1 : -1;
+    exit();
+}
+
+int main() {
+    struct timespec a, b;
+    int pid, i, t;
+
+    if (vgetpid() != getpid()) {
+        printf(1, "vgetpid %d != getpid %d\n", vgetpid(), getpid());
+        goto failed;
+    }
+
+    pid = fork();
+    if (pid == 0) {
+        if (vgetpid() != getpid())
+            printf(1, "child vgetpid wrong\n");
+        exit();
+    }
+    wait();
+
+    /* threads share the page; vgetpid must still be per thread */
+    if (thread_create(worker, 0) < 0 || thread_join() < 0 || threadpid != 1) {
+        printf(1, "thread vgetpid wrong\n");
+        goto failed;
+    }
+
+    /* the vdso pages are the kernel's; munmap must leave them be */
+    if (munmap((void *)VDSO, 4096) != -1 || munmap((void *)VDSOPROC, 4096) != -1 ||
+        munmap((void *)(VDSO - 4096), 3 * 4096) != -1) {
+        printf(1, "munmap of the vdso did not fail\n");
+        goto failed;
+    }
+
+    t = uptime();
+    sleep(3);
+    if (vuptime() < t + 3 || vuptime() > uptime()) {
+        printf(1, "vuptime %d not in step with uptime %d\n", vuptime(), uptime());
+        goto failed;
+    }
+
+    for (i = 0; i < 1000; i++) {
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        vclock_gettime(CLOCK_MONOTONIC, &b);
+        if (b.tv_sec < a.tv_sec ||
+            (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)) {
+            printf(1, "vclock_gettime behind clock_gettime\n");
+            goto failed;
+        }
+    }
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
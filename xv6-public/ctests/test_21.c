@@ -0,0 +1,71 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "syscall.h"
+#include "batch.h"
+
+struct batchcall calls[8];
+char buf[16];
+
+int main() {
+    int fd, n;
+
+    /* open, write and close in one kernel entry */
+    memset(calls, 0, sizeof(calls));
+    calls[0].num = SYS_open;
+    calls[0].args[0] = (int)"batchfile";
+    calls[0].args[1] = O_CREATE | O_RDWR;
+    if (batch(calls, 1, 0) != 1 || (fd = calls[0].ret) < 0) {
+        printf(1, "batch open FAILED\n");
+        goto failed;
+    }
+    calls[0].num = SYS_write;
+    calls[0].args[0] = fd;
+    calls[0].args[1] = (int)"hello";
+    calls[0].args[2] = 5;
+    calls[1].num = SYS_write;
+    calls[1].args[0] = fd;
+    calls[1].args[1] = (int)" batch";
+    calls[1].args[2] = 6;
+    calls[2].num = SYS_close;
+    calls[2].args[0] = fd;
+    calls[3].num = SYS_getpid;
+    if (batch(calls, 4, 0) != 4 || calls[0].ret != 5 || calls[1].ret != 6 ||
+        calls[2].ret != 0 || calls[3].ret != getpid()) {
+        printf(1, "batch results wrong\n");
+        goto failed;
+    }
+
+    fd = open("batchfile", O_RDONLY);
+    n = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    if (n != 11 || strcmp(buf, "hello batch") != 0) {
+        printf(1, "batch writes not in file\n");
+        goto failed;
+    }
+
+    /* stop at the first error if asked; refuse fork */
+    calls[0].num = SYS_getpid;
+    calls[1].num = SYS_fork;
+    calls[2].num = SYS_getpid;
+    calls[2].ret = 12345;
+    if (batch(calls, 3, BATCH_STOPERR) != 2 || calls[1].ret != -1 ||
+        calls[2].ret != 12345) {
+        printf(1, "BATCH_STOPERR FAILED\n");
+        goto failed;
+    }
+    if (batch(calls, 3, 0) != 3 || calls[2].ret != getpid()) {
+        printf(1, "batch did not run past an error\n");
+        goto failed;
+    }
+    unlink("batchfile");
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
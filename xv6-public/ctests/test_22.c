@@ -0,0 +1,135 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "fcntl.h"
+#include "aio.h"
+
+#define NBLK 8
+#define BSZ  512
+
+struct aioring *ring;
+char wbuf[NBLK][BSZ];
+char rbuf[NBLK][BSZ];
+int seen[NBLK + 1];
+volatile int threadok;
+
+/* A thread shares the address space, and so the rings. */
+void thread(void *arg) {
+    threadok = (int)aiosetup() == -1 && aioenter(0, 0) == 0;
+    exit();
+}
+
+void submit(int op, int fd, uint off, char *buf, uint n, uint data) {
+    struct aiosqe *e = &ring->sq[ring->sqtail % AIO_NENT];
+
+    e->op = op;
+    e->fd = fd;
+    e->off = off;
+    e->buf = buf;
+    e->n = n;
+    e->data = data;
+    __sync_synchronize();
+    ring->sqtail++;
+}
+
+/* Reap one completion; returns its data and sets *res. */
+uint reap(int *res) {
+    struct aiocqe *c;
+    uint data;
+
+    while (ring->cqhead == ring->cqtail)
+        aioenter(0, 1);
+    __sync_synchronize();
+    c = &ring->cq[ring->cqhead % AIO_NENT];
+    data = c->data;
+    *res = c->res;
+    ring->cqhead++;
+    return data;
+}
+
+int main() {
+    int fd, i, j, res;
+    uint data;
+
+    ring = aiosetup();
+    if ((int)ring == -1 || (uint)ring != AIORING) {
+        printf(1, "aiosetup FAILED\n");
+        goto failed;
+    }
+    if ((int)aiosetup() != -1) {
+        printf(1, "second aiosetup did not fail\n");
+        goto failed;
+    }
+    if (thread_create(thread, 0) < 0 || thread_join() < 0 || !threadok) {
+        printf(1, "thread cannot use the rings\n");
+        goto failed;
+    }
+    /* the kernel keeps using the ring page; it cannot be unmapped */
+    if (munmap(ring, 4096) != -1) {
+        printf(1, "munmap of the rings did not fail\n");
+        goto failed;
+    }
+    if ((fd = open("aiofile", O_CREATE | O_RDWR)) < 0)
+        goto failed;
+
+    /* writes may complete in any order, so none may start past
+       the end of the file: give it its size first */
+    for (i = 0; i < NBLK; i++)
+        if (write(fd, rbuf[i], BSZ) != BSZ)
+            goto failed;
+
+    /* NBLK writes then an fsync, which must complete last */
+    for (i = 0; i < NBLK; i++) {
+        memset(wbuf[i], 'a' + i, BSZ);
+        submit(AIO_WRITE, fd, i * BSZ, wbuf[i], BSZ, i);
+    }
+    submit(AIO_FSYNC, fd, 0, 0, 0, NBLK);
+    if (aioenter(NBLK + 1, NBLK + 1) != NBLK + 1) {
+        printf(1, "aioenter did not take every write\n");
+        goto failed;
+    }
+    for (i = 0; i <= NBLK; i++) {
+        data = reap(&res);
+        if (data > NBLK || seen[data]++ ||
+            (data < NBLK && res != BSZ) || (data == NBLK && (res != 0 || i != NBLK))) {
+            printf(1, "bad write completion %d res %d\n", data, res);
+            goto failed;
+        }
+    }
+
+    /* read them back, all outstanding at once, plus a bad fd */
+    for (i = 0; i < NBLK; i++)
+        submit(AIO_READ, fd, i * BSZ, rbuf[i], BSZ, i);
+    submit(AIO_READ, 99, 0, rbuf[0], BSZ, NBLK);
+    if (aioenter(NBLK + 1, 0) != NBLK + 1)
+        goto failed;
+    memset(seen, 0, sizeof(seen));
+    for (i = 0; i <= NBLK; i++) {
+        data = reap(&res);
+        if (data > NBLK || seen[data]++ ||
+            (data < NBLK && res != BSZ) || (data == NBLK && res != -1)) {
+            printf(1, "bad read completion %d res %d\n", data, res);
+            goto failed;
+        }
+    }
+    for (i = 0; i < NBLK; i++)
+        for (j = 0; j < BSZ; j++)
+            if (rbuf[i][j] != 'a' + i) {
+                printf(1, "block %d read back wrong\n", i);
+                goto failed;
+            }
+
+    /* the file offset is untouched */
+    if (read(fd, rbuf[0], BSZ) != 0)
+        goto failed;
+    close(fd);
+    unlink("aiofile");
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
@@ -0,0 +1,74 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "syscall.h"
+#include "systrace.h"
+
+struct sysstat st;
+struct traceent ent[8];
+
+int main() {
+    int i, b, sum, pid, fd[2], n, sawgetpid, sawexit;
+    char c;
+
+    /* counts and histograms for this process */
+    systrace(ST_STATS, 1);
+    for (i = 0; i < 10; i++)
+        getpid();
+    if (sysstat(getpid(), &st) < 0 || st.count[SYS_getpid] < 10) {
+        printf(1, "getpid not counted\n");
+        goto failed;
+    }
+    sum = 0;
+    for (b = 0; b < NSYSHIST; b++)
+        sum += st.hist[SYS_getpid][b];
+    if (sum != st.count[SYS_getpid]) {
+        printf(1, "histogram does not add up\n");
+        goto failed;
+    }
+    if (sysstat(0, &st) < 0 || st.count[SYS_getpid] < 10) {
+        printf(1, "system-wide counts FAILED\n");
+        goto failed;
+    }
+    systrace(ST_STATS, 0);
+
+    /* trace a child: its getpid() and its exit */
+    pipe(fd);
+    if ((pid = fork()) == 0) {
+        read(fd[0], &c, 1);
+        getpid();
+        exit();
+    }
+    systrace(ST_TRACE, pid);
+    write(fd[1], "x", 1);
+    sawgetpid = sawexit = 0;
+    while (!sawexit && (n = traceread(ent, 8)) > 0) {
+        for (i = 0; i < n; i++) {
+            if (ent[i].pid != pid) {
+                printf(1, "traced the wrong process\n");
+                goto failed;
+            }
+            if (ent[i].num == SYS_getpid && ent[i].ret == pid)
+                sawgetpid = 1;
+            if (ent[i].num == SYS_exit)
+                sawexit = 1;
+        }
+    }
+    systrace(ST_TRACE, -1);
+    wait();
+    if (!sawgetpid || !sawexit) {
+        printf(1, "trace missed calls\n");
+        goto failed;
+    }
+    /* with tracing off, traceread() does not block */
+    if (traceread(ent, 8) != 0)
+        goto failed;
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
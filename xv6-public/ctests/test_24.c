@@ -0,0 +1,73 @@
+#include "types.h"
+#include "user.h"
+#include "stat.h"
+#include "mmap.h"
+
+#define LEN 4096
+
+char *shared;
+
+void worker(void *arg) {
+    shared[2] = 'T';
+    exit();
+}
+
+int main() {
+    int prot = PROT_READ | PROT_WRITE;
+    int flags = MAP_ANON | MAP_SHARED;
+    int pid, i;
+    char *junk;
+
+    shared = mmap(0, LEN, prot, flags, -1, 0);
+    if (shared == (void *)-1) {
+        printf(1, "mmap FAILED\n");
+        goto failed;
+    }
+    memset(shared, 'P', LEN);
+
+    /* The child's thread exits, unjoined, before the child does,
+       so the child's address space dies only when init reaps the
+       thread.  The inherited mapping must not be freed with it. */
+    if ((pid = fork()) == 0) {
+        shared[1] = 'C';
+        if (thread_create(worker, 0) < 0)
+            exit();
+        while (shared[2] != 'T')
+            sleep(1);
+        sleep(5);
+        exit();
+    }
+    if (pid < 0 || wait() != pid) {
+        printf(1, "fork FAILED\n");
+        goto failed;
+    }
+    /* Give init time to reap the thread, then reuse any pages
+       that were freed. */
+    sleep(20);
+    if ((junk = sbrk(64 * 4096)) == (char *)-1)
+        goto failed;
+    memset(junk, 'J', 64 * 4096);
+
+    if (shared[0] != 'P' || shared[1] != 'C' || shared[2] != 'T') {
+        printf(1, "shared mapping lost its data\n");
+        goto failed;
+    }
+    for (i = 3; i < LEN; i++) {
+        if (shared[i] != 'P') {
+            printf(1, "shared mapping lost its data\n");
+            goto failed;
+        }
+    }
+    if (munmap(shared, LEN) < 0) {
+        printf(1, "munmap FAILED\n");
+        goto failed;
+    }
+
+// success:
+    printf(1, "MMAP\t SUCCESS\n");
+    exit();
+
+failed:
+    printf(1, "MMAP\t FAILED\n");
+    exit();
+}
@@ -0,0 +1,2126 @@
+
+_ctxbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define N  10000
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 10 27 00 00       	mov    $0x2710,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 38             	sub    $0x38,%esp
+  int i, n, pid, start, elapsed;
+  int ping[2], pong[2];
+  char c;
+
+  n = N;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 10                	jle    31 <main+0x31>
+    n = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 f4 02 00 00       	call   320 <atoi>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	89 c6                	mov    %eax,%esi
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+  31:	83 ec 0c             	sub    $0xc,%esp
+  34:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  37:	50                   	push   %eax
+  38:	e8 8e 06 00 00       	call   6cb <pipe>
+  3d:	83 c4 10             	add    $0x10,%esp
+  40:	85 c0                	test   %eax,%eax
+  42:	78 13                	js     57 <main+0x57>
+  44:	83 ec 0c             	sub    $0xc,%esp
+  47:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 7b 06 00 00       	call   6cb <pipe>
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	85 c0                	test   %eax,%eax
+  55:	79 14                	jns    6b <main+0x6b>
+    printf(2, "ctxbench: pipe failed\n");
+  57:	83 ec 08             	sub    $0x8,%esp
+  5a:	68 e0 0e 00 00       	push   $0xee0
+  5f:	6a 02                	push   $0x2
+  61:	e8 9a 0a 00 00       	call   b00 <printf>
+    exit();
+  66:	e8 2c 06 00 00       	call   697 <exit>
+  }
+
+  pid = fork();
+  6b:	e8 0d 06 00 00       	call   67d <fork>
+  70:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+  72:	85 c0                	test   %eax,%eax
+  74:	78 45                	js     bb <main+0xbb>
+    printf(2, "ctxbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  76:	75 56                	jne    ce <main+0xce>
+    for(i = 0; i < n; i++){
+  78:	85 f6                	test   %esi,%esi
+  7a:	7e 3a                	jle    b6 <main+0xb6>
+  7c:	8d 7d d7             	lea    -0x29(%ebp),%edi
+  7f:	eb 1f                	jmp    a0 <main+0xa0>
+  81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+  88:	83 ec 04             	sub    $0x4,%esp
+    for(i = 0; i < n; i++){
+  8b:	83 c3 01             	add    $0x1,%ebx
+      write(pong[1], &c, 1);
+  8e:	6a 01                	push   $0x1
+  90:	57                   	push   %edi
+  91:	ff 75 e4             	push   -0x1c(%ebp)
+  94:	e8 66 06 00 00       	call   6ff <write>
+    for(i = 0; i < n; i++){
+  99:	83 c4 10             	add    $0x10,%esp
+  9c:	39 de                	cmp    %ebx,%esi
+  9e:	74 16                	je     b6 <main+0xb6>
+      if(read(ping[0], &c, 1) != 1)
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	6a 01                	push   $0x1
+  a5:	57                   	push   %edi
+  a6:	ff 75 d8             	push   -0x28(%ebp)
+  a9:	e8 37 06 00 00       	call   6e5 <read>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	83 f8 01             	cmp    $0x1,%eax
+  b4:	74 d2                	je     88 <main+0x88>
+  elapsed = uptime() - start;
+  wait();
+
+  printf(1, "ctxbench: %d round trips (%d switches) in %d ticks\n",
+         i, 2*i, elapsed);
+  exit();
+  b6:	e8 dc 05 00 00       	call   697 <exit>
+    printf(2, "ctxbench: fork failed\n");
+  bb:	51                   	push   %ecx
+  bc:	51                   	push   %ecx
+  bd:	68 f7 0e 00 00       	push   $0xef7
+  c2:	6a 02                	push   $0x2
+  c4:	e8 37 0a 00 00       	call   b00 <printf>
+    exit();
+  c9:	e8 c9 05 00 00       	call   697 <exit>
+  c = 'x';
+  ce:	c6 45 d7 78          	movb   $0x78,-0x29(%ebp)
+  for(i = 0; i < n; i++){
+  d2:	31 ff                	xor    %edi,%edi
+    write(ping[1], &c, 1);
+  d4:	8d 5d d7             	lea    -0x29(%ebp),%ebx
+  start = uptime();
+  d7:	e8 a9 07 00 00       	call   885 <uptime>
+  dc:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < n; i++){
+  df:	eb 25                	jmp    106 <main+0x106>
+    write(ping[1], &c, 1);
+  e1:	52                   	push   %edx
+  e2:	6a 01                	push   $0x1
+  e4:	53                   	push   %ebx
+  e5:	ff 75 dc             	push   -0x24(%ebp)
+  e8:	e8 12 06 00 00       	call   6ff <write>
+    if(read(pong[0], &c, 1) != 1){
+  ed:	83 c4 0c             	add    $0xc,%esp
+  f0:	6a 01                	push   $0x1
+  f2:	53                   	push   %ebx
+  f3:	ff 75 e0             	push   -0x20(%ebp)
+  f6:	e8 ea 05 00 00       	call   6e5 <read>
+  fb:	83 c4 10             	add    $0x10,%esp
+  fe:	83 e8 01             	sub    $0x1,%eax
+ 101:	75 32                	jne    135 <main+0x135>
+  for(i = 0; i < n; i++){
+ 103:	83 c7 01             	add    $0x1,%edi
+ 106:	39 f7                	cmp    %esi,%edi
+ 108:	7c d7                	jl     e1 <main+0xe1>
+  elapsed = uptime() - start;
+ 10a:	e8 76 07 00 00       	call   885 <uptime>
+ 10f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 112:	29 d0                	sub    %edx,%eax
+ 114:	89 c3                	mov    %eax,%ebx
+  wait();
+ 116:	e8 96 05 00 00       	call   6b1 <wait>
+  printf(1, "ctxbench: %d round trips (%d switches) in %d ticks\n",
+ 11b:	83 ec 0c             	sub    $0xc,%esp
+ 11e:	8d 04 3f             	lea    (%edi,%edi,1),%eax
+ 121:	53                   	push   %ebx
+ 122:	50                   	push   %eax
+ 123:	57                   	push   %edi
+ 124:	68 28 0f 00 00       	push   $0xf28
+ 129:	6a 01                	push   $0x1
+ 12b:	e8 d0 09 00 00       	call   b00 <printf>
+  exit();
+ 130:	83 c4 20             	add    $0x20,%esp
+ 133:	eb 81                	jmp    b6 <main+0xb6>
+      printf(2, "ctxbench: read failed\n");
+ 135:	50                   	push   %eax
+ 136:	50                   	push   %eax
+ 137:	68 0e 0f 00 00       	push   $0xf0e
+ 13c:	6a 02                	push   $0x2
+ 13e:	e8 bd 09 00 00       	call   b00 <printf>
+      break;
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	eb c2                	jmp    10a <main+0x10a>
+ 148:	66 90                	xchg   %ax,%ax
+ 14a:	66 90                	xchg   %ax,%ax
+ 14c:	66 90                	xchg   %ax,%ax
+ 14e:	66 90                	xchg   %ax,%ax
+
+00000150 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 150:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 151:	31 c0                	xor    %eax,%eax
+{
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	53                   	push   %ebx
+ 156:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 159:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 15c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 160:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 164:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 167:	83 c0 01             	add    $0x1,%eax
+ 16a:	84 d2                	test   %dl,%dl
+ 16c:	75 f2                	jne    160 <strcpy+0x10>
+    ;
+  return os;
+}
+ 16e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 171:	89 c8                	mov    %ecx,%eax
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+ 175:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	53                   	push   %ebx
+ 184:	8b 55 08             	mov    0x8(%ebp),%edx
+ 187:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 18a:	0f b6 02             	movzbl (%edx),%eax
+ 18d:	84 c0                	test   %al,%al
+ 18f:	75 17                	jne    1a8 <strcmp+0x28>
+ 191:	eb 3a                	jmp    1cd <strcmp+0x4d>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 19c:	83 c2 01             	add    $0x1,%edx
+ 19f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1a2:	84 c0                	test   %al,%al
+ 1a4:	74 1a                	je     1c0 <strcmp+0x40>
+    p++, q++;
+ 1a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1ab:	38 c3                	cmp    %al,%bl
+ 1ad:	74 e9                	je     198 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1af:	29 d8                	sub    %ebx,%eax
+}
+ 1b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b4:	c9                   	leave
+ 1b5:	c3                   	ret
+ 1b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1c4:	31 c0                	xor    %eax,%eax
+ 1c6:	29 d8                	sub    %ebx,%eax
+}
+ 1c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1d0:	31 c0                	xor    %eax,%eax
+ 1d2:	eb db                	jmp    1af <strcmp+0x2f>
+ 1d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1df:	90                   	nop
+
+000001e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1e9:	74 15                	je     200 <strlen+0x20>
+ 1eb:	31 c0                	xor    %eax,%eax
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 1f0:	83 c0 01             	add    $0x1,%eax
+ 1f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1f7:	89 c1                	mov    %eax,%ecx
+ 1f9:	75 f5                	jne    1f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1fb:	89 c8                	mov    %ecx,%eax
+ 1fd:	5d                   	pop    %ebp
+ 1fe:	c3                   	ret
+ 1ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 200:	31 c9                	xor    %ecx,%ecx
+}
+ 202:	5d                   	pop    %ebp
+ 203:	89 c8                	mov    %ecx,%eax
+ 205:	c3                   	ret
+ 206:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000210 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 217:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 21a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21d:	89 d7                	mov    %edx,%edi
+ 21f:	fc                   	cld
+ 220:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 222:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 225:	89 d0                	mov    %edx,%eax
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	8b 45 08             	mov    0x8(%ebp),%eax
+ 236:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 23a:	0f b6 10             	movzbl (%eax),%edx
+ 23d:	84 d2                	test   %dl,%dl
+ 23f:	75 12                	jne    253 <strchr+0x23>
+ 241:	eb 1d                	jmp    260 <strchr+0x30>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 24c:	83 c0 01             	add    $0x1,%eax
+ 24f:	84 d2                	test   %dl,%dl
+ 251:	74 0d                	je     260 <strchr+0x30>
+    if(*s == c)
+ 253:	38 d1                	cmp    %dl,%cl
+ 255:	75 f1                	jne    248 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 257:	5d                   	pop    %ebp
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 260:	31 c0                	xor    %eax,%eax
+}
+ 262:	5d                   	pop    %ebp
+ 263:	c3                   	ret
+ 264:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 275:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 278:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 279:	31 db                	xor    %ebx,%ebx
+{
+ 27b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 27e:	eb 27                	jmp    2a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 280:	83 ec 04             	sub    $0x4,%esp
+ 283:	6a 01                	push   $0x1
+ 285:	56                   	push   %esi
+ 286:	6a 00                	push   $0x0
+ 288:	e8 58 04 00 00       	call   6e5 <read>
+    if(cc < 1)
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	85 c0                	test   %eax,%eax
+ 292:	7e 1d                	jle    2b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 294:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 29f:	3c 0a                	cmp    $0xa,%al
+ 2a1:	74 10                	je     2b3 <gets+0x43>
+ 2a3:	3c 0d                	cmp    $0xd,%al
+ 2a5:	74 0c                	je     2b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2a7:	89 df                	mov    %ebx,%edi
+ 2a9:	83 c3 01             	add    $0x1,%ebx
+ 2ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2af:	7c cf                	jl     280 <gets+0x10>
+ 2b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2bd:	5b                   	pop    %ebx
+ 2be:	5e                   	pop    %esi
+ 2bf:	5f                   	pop    %edi
+ 2c0:	5d                   	pop    %ebp
+ 2c1:	c3                   	ret
+ 2c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	56                   	push   %esi
+ 2d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	6a 00                	push   $0x0
+ 2da:	ff 75 08             	push   0x8(%ebp)
+ 2dd:	e8 85 04 00 00       	call   767 <open>
+  if(fd < 0)
+ 2e2:	83 c4 10             	add    $0x10,%esp
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	78 27                	js     310 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2e9:	83 ec 08             	sub    $0x8,%esp
+ 2ec:	ff 75 0c             	push   0xc(%ebp)
+ 2ef:	89 c3                	mov    %eax,%ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	e8 be 04 00 00       	call   7b5 <fstat>
+  close(fd);
+ 2f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2fc:	e8 18 04 00 00       	call   719 <close>
+  return r;
+ 301:	83 c4 10             	add    $0x10,%esp
+}
+ 304:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 307:	89 f0                	mov    %esi,%eax
+ 309:	5b                   	pop    %ebx
+ 30a:	5e                   	pop    %esi
+ 30b:	5d                   	pop    %ebp
+ 30c:	c3                   	ret
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 310:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 315:	eb ed                	jmp    304 <stat+0x34>
+ 317:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 327:	0f be 02             	movsbl (%edx),%eax
+ 32a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 32d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 335:	77 1e                	ja     355 <atoi+0x35>
+ 337:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 340:	83 c2 01             	add    $0x1,%edx
+ 343:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 346:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 34a:	0f be 02             	movsbl (%edx),%eax
+ 34d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 350:	80 fb 09             	cmp    $0x9,%bl
+ 353:	76 eb                	jbe    340 <atoi+0x20>
+  return n;
+}
+ 355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 358:	89 c8                	mov    %ecx,%eax
+ 35a:	c9                   	leave
+ 35b:	c3                   	ret
+ 35c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	57                   	push   %edi
+ 364:	56                   	push   %esi
+ 365:	8b 45 10             	mov    0x10(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 36e:	85 c0                	test   %eax,%eax
+ 370:	7e 13                	jle    385 <memmove+0x25>
+ 372:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 374:	89 d7                	mov    %edx,%edi
+ 376:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 380:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 381:	39 f8                	cmp    %edi,%eax
+ 383:	75 fb                	jne    380 <memmove+0x20>
+  return vdst;
+}
+ 385:	5e                   	pop    %esi
+ 386:	89 d0                	mov    %edx,%eax
+ 388:	5f                   	pop    %edi
+ 389:	5d                   	pop    %ebp
+ 38a:	c3                   	ret
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 39c:	5d                   	pop    %ebp
+ 39d:	c3                   	ret
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3a0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3a1:	31 c0                	xor    %eax,%eax
+ 3a3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3a8:	89 e5                	mov    %esp,%ebp
+ 3aa:	56                   	push   %esi
+ 3ab:	53                   	push   %ebx
+ 3ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3b3:	85 c0                	test   %eax,%eax
+ 3b5:	74 32                	je     3e9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 3b7:	83 f8 02             	cmp    $0x2,%eax
+ 3ba:	74 0c                	je     3c8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 3c4:	85 c0                	test   %eax,%eax
+ 3c6:	74 21                	je     3e9 <mutex_lock+0x49>
+ 3c8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 02                	push   $0x2
+ 3d5:	6a 00                	push   $0x0
+ 3d7:	53                   	push   %ebx
+ 3d8:	e8 2a 05 00 00       	call   907 <futex>
+ 3dd:	89 f0                	mov    %esi,%eax
+ 3df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	75 e7                	jne    3d0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 3e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3ec:	5b                   	pop    %ebx
+ 3ed:	5e                   	pop    %esi
+ 3ee:	5d                   	pop    %ebp
+ 3ef:	c3                   	ret
+
+000003f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	31 c0                	xor    %eax,%eax
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3fb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3fe:	83 f8 02             	cmp    $0x2,%eax
+ 401:	74 05                	je     408 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 403:	c9                   	leave
+ 404:	c3                   	ret
+ 405:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 408:	83 ec 04             	sub    $0x4,%esp
+ 40b:	6a 01                	push   $0x1
+ 40d:	6a 01                	push   $0x1
+ 40f:	52                   	push   %edx
+ 410:	e8 f2 04 00 00       	call   907 <futex>
+ 415:	83 c4 10             	add    $0x10,%esp
+}
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 42c:	5d                   	pop    %ebp
+ 42d:	c3                   	ret
+ 42e:	66 90                	xchg   %ax,%ax
+
+00000430 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 430:	55                   	push   %ebp
+ 431:	31 c0                	xor    %eax,%eax
+ 433:	89 e5                	mov    %esp,%ebp
+ 435:	57                   	push   %edi
+ 436:	56                   	push   %esi
+ 437:	53                   	push   %ebx
+ 438:	83 ec 0c             	sub    $0xc,%esp
+ 43b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 43e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 441:	8b 3e                	mov    (%esi),%edi
+ 443:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 446:	83 f8 02             	cmp    $0x2,%eax
+ 449:	74 5d                	je     4a8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 44b:	83 ec 04             	sub    $0x4,%esp
+ 44e:	57                   	push   %edi
+ 44f:	6a 00                	push   $0x0
+ 451:	56                   	push   %esi
+ 452:	e8 b0 04 00 00       	call   907 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 457:	31 c0                	xor    %eax,%eax
+ 459:	ba 01 00 00 00       	mov    $0x1,%edx
+ 45e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	74 30                	je     499 <cond_wait+0x69>
+  if(c != 2)
+ 469:	83 f8 02             	cmp    $0x2,%eax
+ 46c:	74 0c                	je     47a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 46e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 473:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 476:	85 c0                	test   %eax,%eax
+ 478:	74 1f                	je     499 <cond_wait+0x69>
+ 47a:	be 02 00 00 00       	mov    $0x2,%esi
+ 47f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 02                	push   $0x2
+ 485:	6a 00                	push   $0x0
+ 487:	53                   	push   %ebx
+ 488:	e8 7a 04 00 00       	call   907 <futex>
+ 48d:	89 f0                	mov    %esi,%eax
+ 48f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	75 e7                	jne    480 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4a8:	83 ec 04             	sub    $0x4,%esp
+ 4ab:	6a 01                	push   $0x1
+ 4ad:	6a 01                	push   $0x1
+ 4af:	53                   	push   %ebx
+ 4b0:	e8 52 04 00 00       	call   907 <futex>
+ 4b5:	83 c4 10             	add    $0x10,%esp
+ 4b8:	eb 91                	jmp    44b <cond_wait+0x1b>
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004c0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	53                   	push   %ebx
+ 4c4:	83 ec 04             	sub    $0x4,%esp
+ 4c7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4d0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4d2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 4d5:	89 c8                	mov    %ecx,%eax
+ 4d7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4db:	39 c1                	cmp    %eax,%ecx
+ 4dd:	75 f1                	jne    4d0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4df:	83 ec 04             	sub    $0x4,%esp
+ 4e2:	6a 01                	push   $0x1
+ 4e4:	6a 01                	push   $0x1
+ 4e6:	52                   	push   %edx
+ 4e7:	e8 1b 04 00 00       	call   907 <futex>
+}
+ 4ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ef:	83 c4 10             	add    $0x10,%esp
+ 4f2:	c9                   	leave
+ 4f3:	c3                   	ret
+ 4f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ff:	90                   	nop
+
+00000500 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	53                   	push   %ebx
+ 504:	83 ec 04             	sub    $0x4,%esp
+ 507:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 510:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 512:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 515:	89 c8                	mov    %ecx,%eax
+ 517:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 51b:	39 c1                	cmp    %eax,%ecx
+ 51d:	75 f1                	jne    510 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 51f:	83 ec 04             	sub    $0x4,%esp
+ 522:	6a 40                	push   $0x40
+ 524:	6a 01                	push   $0x1
+ 526:	52                   	push   %edx
+ 527:	e8 db 03 00 00       	call   907 <futex>
+}
+ 52c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 52f:	83 c4 10             	add    $0x10,%esp
+ 532:	c9                   	leave
+ 533:	c3                   	ret
+ 534:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 540:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 545:	c3                   	ret
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000550 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 550:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 555:	85 c0                	test   %eax,%eax
+ 557:	74 07                	je     560 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 559:	c3                   	ret
+ 55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 560:	e9 d2 02 00 00       	jmp    837 <getpid>
+ 565:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	53                   	push   %ebx
+ 576:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 579:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 57b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 581:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 587:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 58c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 592:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 595:	89 d0                	mov    %edx,%eax
+ 597:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 59a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5a0:	29 d9                	sub    %ebx,%ecx
+ 5a2:	89 c6                	mov    %eax,%esi
+ 5a4:	89 d7                	mov    %edx,%edi
+ 5a6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5a9:	d3 e6                	shl    %cl,%esi
+ 5ab:	31 c0                	xor    %eax,%eax
+ 5ad:	f6 c1 20             	test   $0x20,%cl
+ 5b0:	0f 45 fe             	cmovne %esi,%edi
+ 5b3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5b9:	89 d9                	mov    %ebx,%ecx
+ 5bb:	31 db                	xor    %ebx,%ebx
+ 5bd:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5c3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5c6:	d3 ea                	shr    %cl,%edx
+ 5c8:	f6 c1 20             	test   $0x20,%cl
+ 5cb:	0f 45 c2             	cmovne %edx,%eax
+ 5ce:	0f 45 d3             	cmovne %ebx,%edx
+ 5d1:	01 f0                	add    %esi,%eax
+ 5d3:	11 fa                	adc    %edi,%edx
+}
+ 5d5:	83 c4 0c             	add    $0xc,%esp
+ 5d8:	5b                   	pop    %ebx
+ 5d9:	5e                   	pop    %esi
+ 5da:	5f                   	pop    %edi
+ 5db:	5d                   	pop    %ebp
+ 5dc:	c3                   	ret
+ 5dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005e0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 5e9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 5f0:	74 0e                	je     600 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 5f2:	83 c4 1c             	add    $0x1c,%esp
+ 5f5:	5b                   	pop    %ebx
+ 5f6:	5e                   	pop    %esi
+ 5f7:	5f                   	pop    %edi
+ 5f8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 5f9:	e9 a5 03 00 00       	jmp    9a3 <clock_gettime>
+ 5fe:	66 90                	xchg   %ax,%ax
+ 600:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 602:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 608:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 60e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 613:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 616:	89 d0                	mov    %edx,%eax
+ 618:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 61b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 621:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 627:	89 c6                	mov    %eax,%esi
+ 629:	89 d7                	mov    %edx,%edi
+ 62b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 62e:	d3 e6                	shl    %cl,%esi
+ 630:	31 c0                	xor    %eax,%eax
+ 632:	f6 c1 20             	test   $0x20,%cl
+ 635:	0f 45 fe             	cmovne %esi,%edi
+ 638:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 63b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 63e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 645:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 64b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 64e:	d3 ea                	shr    %cl,%edx
+ 650:	f6 c1 20             	test   $0x20,%cl
+ 653:	74 04                	je     659 <vclock_gettime+0x79>
+ 655:	89 d0                	mov    %edx,%eax
+ 657:	31 d2                	xor    %edx,%edx
+ 659:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 65b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 660:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 662:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 664:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 666:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 668:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 66e:	29 c1                	sub    %eax,%ecx
+}
+ 670:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 672:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 675:	83 c4 1c             	add    $0x1c,%esp
+ 678:	5b                   	pop    %ebx
+ 679:	5e                   	pop    %esi
+ 67a:	5f                   	pop    %edi
+ 67b:	5d                   	pop    %ebp
+ 67c:	c3                   	ret
+
+0000067d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 67d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 682:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 689:	74 09                	je     694 <fork+0x17>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <exit>:
+SYSCALL(exit)
+ 697:	b8 02 00 00 00       	mov    $0x2,%eax
+ 69c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a3:	74 09                	je     6ae <exit+0x17>
+ 6a5:	89 e1                	mov    %esp,%ecx
+ 6a7:	ba b0 06 00 00       	mov    $0x6b0,%edx
+ 6ac:	0f 34                	sysenter
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <wait>:
+SYSCALL(wait)
+ 6b1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6b6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6bd:	74 09                	je     6c8 <wait+0x17>
+ 6bf:	89 e1                	mov    %esp,%ecx
+ 6c1:	ba ca 06 00 00       	mov    $0x6ca,%edx
+ 6c6:	0f 34                	sysenter
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <pipe>:
+SYSCALL(pipe)
+ 6cb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6d7:	74 09                	je     6e2 <pipe+0x17>
+ 6d9:	89 e1                	mov    %esp,%ecx
+ 6db:	ba e4 06 00 00       	mov    $0x6e4,%edx
+ 6e0:	0f 34                	sysenter
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <read>:
+SYSCALL(read)
+ 6e5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6ea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f1:	74 09                	je     6fc <read+0x17>
+ 6f3:	89 e1                	mov    %esp,%ecx
+ 6f5:	ba fe 06 00 00       	mov    $0x6fe,%edx
+ 6fa:	0f 34                	sysenter
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <write>:
+SYSCALL(write)
+ 6ff:	b8 10 00 00 00       	mov    $0x10,%eax
+ 704:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 70b:	74 09                	je     716 <write+0x17>
+ 70d:	89 e1                	mov    %esp,%ecx
+ 70f:	ba 18 07 00 00       	mov    $0x718,%edx
+ 714:	0f 34                	sysenter
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <close>:
+SYSCALL(close)
+ 719:	b8 15 00 00 00       	mov    $0x15,%eax
+ 71e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 725:	74 09                	je     730 <close+0x17>
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 32 07 00 00       	mov    $0x732,%edx
+ 72e:	0f 34                	sysenter
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <kill>:
+SYSCALL(kill)
+ 733:	b8 06 00 00 00       	mov    $0x6,%eax
+ 738:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 73f:	74 09                	je     74a <kill+0x17>
+ 741:	89 e1                	mov    %esp,%ecx
+ 743:	ba 4c 07 00 00       	mov    $0x74c,%edx
+ 748:	0f 34                	sysenter
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <exec>:
+SYSCALL(exec)
+ 74d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 752:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 759:	74 09                	je     764 <exec+0x17>
+ 75b:	89 e1                	mov    %esp,%ecx
+ 75d:	ba 66 07 00 00       	mov    $0x766,%edx
+ 762:	0f 34                	sysenter
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <open>:
+SYSCALL(open)
+ 767:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 76c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 773:	74 09                	je     77e <open+0x17>
+ 775:	89 e1                	mov    %esp,%ecx
+ 777:	ba 80 07 00 00       	mov    $0x780,%edx
+ 77c:	0f 34                	sysenter
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <mknod>:
+SYSCALL(mknod)
+ 781:	b8 11 00 00 00       	mov    $0x11,%eax
+ 786:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 78d:	74 09                	je     798 <mknod+0x17>
+ 78f:	89 e1                	mov    %esp,%ecx
+ 791:	ba 9a 07 00 00       	mov    $0x79a,%edx
+ 796:	0f 34                	sysenter
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <unlink>:
+SYSCALL(unlink)
+ 79b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a7:	74 09                	je     7b2 <unlink+0x17>
+ 7a9:	89 e1                	mov    %esp,%ecx
+ 7ab:	ba b4 07 00 00       	mov    $0x7b4,%edx
+ 7b0:	0f 34                	sysenter
+ 7b2:	cd 40                	int    $0x40
+ 7b4:	c3                   	ret
+
+000007b5 <fstat>:
+SYSCALL(fstat)
+ 7b5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c1:	74 09                	je     7cc <fstat+0x17>
+ 7c3:	89 e1                	mov    %esp,%ecx
+ 7c5:	ba ce 07 00 00       	mov    $0x7ce,%edx
+ 7ca:	0f 34                	sysenter
+ 7cc:	cd 40                	int    $0x40
+ 7ce:	c3                   	ret
+
+000007cf <link>:
+SYSCALL(link)
+ 7cf:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7db:	74 09                	je     7e6 <link+0x17>
+ 7dd:	89 e1                	mov    %esp,%ecx
+ 7df:	ba e8 07 00 00       	mov    $0x7e8,%edx
+ 7e4:	0f 34                	sysenter
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <mkdir>:
+SYSCALL(mkdir)
+ 7e9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f5:	74 09                	je     800 <mkdir+0x17>
+ 7f7:	89 e1                	mov    %esp,%ecx
+ 7f9:	ba 02 08 00 00       	mov    $0x802,%edx
+ 7fe:	0f 34                	sysenter
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <chdir>:
+SYSCALL(chdir)
+ 803:	b8 09 00 00 00       	mov    $0x9,%eax
+ 808:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 80f:	74 09                	je     81a <chdir+0x17>
+ 811:	89 e1                	mov    %esp,%ecx
+ 813:	ba 1c 08 00 00       	mov    $0x81c,%edx
+ 818:	0f 34                	sysenter
+ 81a:	cd 40                	int    $0x40
+ 81c:	c3                   	ret
+
+0000081d <dup>:
+SYSCALL(dup)
+ 81d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 822:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 829:	74 09                	je     834 <dup+0x17>
+ 82b:	89 e1                	mov    %esp,%ecx
+ 82d:	ba 36 08 00 00       	mov    $0x836,%edx
+ 832:	0f 34                	sysenter
+ 834:	cd 40                	int    $0x40
+ 836:	c3                   	ret
+
+00000837 <getpid>:
+SYSCALL(getpid)
+ 837:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 83c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 843:	74 09                	je     84e <getpid+0x17>
+ 845:	89 e1                	mov    %esp,%ecx
+ 847:	ba 50 08 00 00       	mov    $0x850,%edx
+ 84c:	0f 34                	sysenter
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <sbrk>:
+SYSCALL(sbrk)
+ 851:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 856:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 85d:	74 09                	je     868 <sbrk+0x17>
+ 85f:	89 e1                	mov    %esp,%ecx
+ 861:	ba 6a 08 00 00       	mov    $0x86a,%edx
+ 866:	0f 34                	sysenter
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <sleep>:
+SYSCALL(sleep)
+ 86b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 870:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 877:	74 09                	je     882 <sleep+0x17>
+ 879:	89 e1                	mov    %esp,%ecx
+ 87b:	ba 84 08 00 00       	mov    $0x884,%edx
+ 880:	0f 34                	sysenter
+ 882:	cd 40                	int    $0x40
+ 884:	c3                   	ret
+
+00000885 <uptime>:
+SYSCALL(uptime)
+ 885:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 88a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 891:	74 09                	je     89c <uptime+0x17>
+ 893:	89 e1                	mov    %esp,%ecx
+ 895:	ba 9e 08 00 00       	mov    $0x89e,%edx
+ 89a:	0f 34                	sysenter
+ 89c:	cd 40                	int    $0x40
+ 89e:	c3                   	ret
+
+0000089f <mmap>:
+SYSCALL(mmap)
+ 89f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8ab:	74 09                	je     8b6 <mmap+0x17>
+ 8ad:	89 e1                	mov    %esp,%ecx
+ 8af:	ba b8 08 00 00       	mov    $0x8b8,%edx
+ 8b4:	0f 34                	sysenter
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <munmap>:
+SYSCALL(munmap)
+ 8b9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c5:	74 09                	je     8d0 <munmap+0x17>
+ 8c7:	89 e1                	mov    %esp,%ecx
+ 8c9:	ba d2 08 00 00       	mov    $0x8d2,%edx
+ 8ce:	0f 34                	sysenter
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <clone>:
+SYSCALL(clone)
+ 8d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8df:	74 09                	je     8ea <clone+0x17>
+ 8e1:	89 e1                	mov    %esp,%ecx
+ 8e3:	ba ec 08 00 00       	mov    $0x8ec,%edx
+ 8e8:	0f 34                	sysenter
+ 8ea:	cd 40                	int    $0x40
+ 8ec:	c3                   	ret
+
+000008ed <join>:
+SYSCALL(join)
+ 8ed:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f9:	74 09                	je     904 <join+0x17>
+ 8fb:	89 e1                	mov    %esp,%ecx
+ 8fd:	ba 06 09 00 00       	mov    $0x906,%edx
+ 902:	0f 34                	sysenter
+ 904:	cd 40                	int    $0x40
+ 906:	c3                   	ret
+
+00000907 <futex>:
+SYSCALL(futex)
+ 907:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 90c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 913:	74 09                	je     91e <futex+0x17>
+ 915:	89 e1                	mov    %esp,%ecx
+ 917:	ba 20 09 00 00       	mov    $0x920,%edx
+ 91c:	0f 34                	sysenter
+ 91e:	cd 40                	int    $0x40
+ 920:	c3                   	ret
+
+00000921 <memstat>:
+SYSCALL(memstat)
+ 921:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 926:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 92d:	74 09                	je     938 <memstat+0x17>
+ 92f:	89 e1                	mov    %esp,%ecx
+ 931:	ba 3a 09 00 00       	mov    $0x93a,%edx
+ 936:	0f 34                	sysenter
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <nice>:
+SYSCALL(nice)
+ 93b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 940:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 947:	74 09                	je     952 <nice+0x17>
+ 949:	89 e1                	mov    %esp,%ecx
+ 94b:	ba 54 09 00 00       	mov    $0x954,%edx
+ 950:	0f 34                	sysenter
+ 952:	cd 40                	int    $0x40
+ 954:	c3                   	ret
+
+00000955 <setpriority>:
+SYSCALL(setpriority)
+ 955:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 95a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 961:	74 09                	je     96c <setpriority+0x17>
+ 963:	89 e1                	mov    %esp,%ecx
+ 965:	ba 6e 09 00 00       	mov    $0x96e,%edx
+ 96a:	0f 34                	sysenter
+ 96c:	cd 40                	int    $0x40
+ 96e:	c3                   	ret
+
+0000096f <getpinfo>:
+SYSCALL(getpinfo)
+ 96f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 974:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 97b:	74 09                	je     986 <getpinfo+0x17>
+ 97d:	89 e1                	mov    %esp,%ecx
+ 97f:	ba 88 09 00 00       	mov    $0x988,%edx
+ 984:	0f 34                	sysenter
+ 986:	cd 40                	int    $0x40
+ 988:	c3                   	ret
+
+00000989 <settickets>:
+SYSCALL(settickets)
+ 989:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 98e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 995:	74 09                	je     9a0 <settickets+0x17>
+ 997:	89 e1                	mov    %esp,%ecx
+ 999:	ba a2 09 00 00       	mov    $0x9a2,%edx
+ 99e:	0f 34                	sysenter
+ 9a0:	cd 40                	int    $0x40
+ 9a2:	c3                   	ret
+
+000009a3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 9a3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9a8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9af:	74 09                	je     9ba <clock_gettime+0x17>
+ 9b1:	89 e1                	mov    %esp,%ecx
+ 9b3:	ba bc 09 00 00       	mov    $0x9bc,%edx
+ 9b8:	0f 34                	sysenter
+ 9ba:	cd 40                	int    $0x40
+ 9bc:	c3                   	ret
+
+000009bd <batch>:
+SYSCALL(batch)
+ 9bd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9c2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9c9:	74 09                	je     9d4 <batch+0x17>
+ 9cb:	89 e1                	mov    %esp,%ecx
+ 9cd:	ba d6 09 00 00       	mov    $0x9d6,%edx
+ 9d2:	0f 34                	sysenter
+ 9d4:	cd 40                	int    $0x40
+ 9d6:	c3                   	ret
+
+000009d7 <aiosetup>:
+SYSCALL(aiosetup)
+ 9d7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9dc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9e3:	74 09                	je     9ee <aiosetup+0x17>
+ 9e5:	89 e1                	mov    %esp,%ecx
+ 9e7:	ba f0 09 00 00       	mov    $0x9f0,%edx
+ 9ec:	0f 34                	sysenter
+ 9ee:	cd 40                	int    $0x40
+ 9f0:	c3                   	ret
+
+000009f1 <aioenter>:
+SYSCALL(aioenter)
+ 9f1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9f6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9fd:	74 09                	je     a08 <aioenter+0x17>
+ 9ff:	89 e1                	mov    %esp,%ecx
+ a01:	ba 0a 0a 00 00       	mov    $0xa0a,%edx
+ a06:	0f 34                	sysenter
+ a08:	cd 40                	int    $0x40
+ a0a:	c3                   	ret
+
+00000a0b <systrace>:
+SYSCALL(systrace)
+ a0b:	b8 24 00 00 00       	mov    $0x24,%eax
+ a10:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a17:	74 09                	je     a22 <systrace+0x17>
+ a19:	89 e1                	mov    %esp,%ecx
+ a1b:	ba 24 0a 00 00       	mov    $0xa24,%edx
+ a20:	0f 34                	sysenter
+ a22:	cd 40                	int    $0x40
+ a24:	c3                   	ret
+
+00000a25 <sysstat>:
+SYSCALL(sysstat)
+ a25:	b8 25 00 00 00       	mov    $0x25,%eax
+ a2a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a31:	74 09                	je     a3c <sysstat+0x17>
+ a33:	89 e1                	mov    %esp,%ecx
+ a35:	ba 3e 0a 00 00       	mov    $0xa3e,%edx
+ a3a:	0f 34                	sysenter
+ a3c:	cd 40                	int    $0x40
+ a3e:	c3                   	ret
+
+00000a3f <traceread>:
+SYSCALL(traceread)
+ a3f:	b8 26 00 00 00       	mov    $0x26,%eax
+ a44:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a4b:	74 09                	je     a56 <traceread+0x17>
+ a4d:	89 e1                	mov    %esp,%ecx
+ a4f:	ba 58 0a 00 00       	mov    $0xa58,%edx
+ a54:	0f 34                	sysenter
+ a56:	cd 40                	int    $0x40
+ a58:	c3                   	ret
+ a59:	66 90                	xchg   %ax,%ax
+ a5b:	66 90                	xchg   %ax,%ax
+ a5d:	66 90                	xchg   %ax,%ax
+ a5f:	90                   	nop
+
+00000a60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a68:	89 d1                	mov    %edx,%ecx
+{
+ a6a:	83 ec 3c             	sub    $0x3c,%esp
+ a6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a70:	85 d2                	test   %edx,%edx
+ a72:	0f 89 80 00 00 00    	jns    af8 <printint+0x98>
+ a78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a7c:	74 7a                	je     af8 <printint+0x98>
+    x = -xx;
+ a7e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a88:	31 f6                	xor    %esi,%esi
+ a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a90:	89 c8                	mov    %ecx,%eax
+ a92:	31 d2                	xor    %edx,%edx
+ a94:	89 f7                	mov    %esi,%edi
+ a96:	f7 f3                	div    %ebx
+ a98:	8d 76 01             	lea    0x1(%esi),%esi
+ a9b:	0f b6 92 bc 0f 00 00 	movzbl 0xfbc(%edx),%edx
+ aa2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ aa6:	89 ca                	mov    %ecx,%edx
+ aa8:	89 c1                	mov    %eax,%ecx
+ aaa:	39 da                	cmp    %ebx,%edx
+ aac:	73 e2                	jae    a90 <printint+0x30>
+  if(neg)
+ aae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ab1:	85 c0                	test   %eax,%eax
+ ab3:	74 07                	je     abc <printint+0x5c>
+    buf[i++] = '-';
+ ab5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aba:	89 f7                	mov    %esi,%edi
+ abc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ abf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ac2:	01 df                	add    %ebx,%edi
+ ac4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ac8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ acb:	83 ec 04             	sub    $0x4,%esp
+ ace:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ad1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ad4:	6a 01                	push   $0x1
+ ad6:	50                   	push   %eax
+ ad7:	56                   	push   %esi
+ ad8:	e8 22 fc ff ff       	call   6ff <write>
+  while(--i >= 0)
+ add:	89 f8                	mov    %edi,%eax
+ adf:	83 c4 10             	add    $0x10,%esp
+ ae2:	83 ef 01             	sub    $0x1,%edi
+ ae5:	39 d8                	cmp    %ebx,%eax
+ ae7:	75 df                	jne    ac8 <printint+0x68>
+}
+ ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aec:	5b                   	pop    %ebx
+ aed:	5e                   	pop    %esi
+ aee:	5f                   	pop    %edi
+ aef:	5d                   	pop    %ebp
+ af0:	c3                   	ret
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ af8:	31 c0                	xor    %eax,%eax
+ afa:	eb 89                	jmp    a85 <printint+0x25>
+ afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b00:	55                   	push   %ebp
+ b01:	89 e5                	mov    %esp,%ebp
+ b03:	57                   	push   %edi
+ b04:	56                   	push   %esi
+ b05:	53                   	push   %ebx
+ b06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b0f:	0f b6 1e             	movzbl (%esi),%ebx
+ b12:	83 c6 01             	add    $0x1,%esi
+ b15:	84 db                	test   %bl,%bl
+ b17:	74 67                	je     b80 <printf+0x80>
+ b19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b1c:	31 d2                	xor    %edx,%edx
+ b1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b21:	eb 34                	jmp    b57 <printf+0x57>
+ b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b27:	90                   	nop
+ b28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b30:	83 f8 25             	cmp    $0x25,%eax
+ b33:	74 18                	je     b4d <printf+0x4d>
+  write(fd, &c, 1);
+ b35:	83 ec 04             	sub    $0x4,%esp
+ b38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b3e:	6a 01                	push   $0x1
+ b40:	50                   	push   %eax
+ b41:	57                   	push   %edi
+ b42:	e8 b8 fb ff ff       	call   6ff <write>
+ b47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b4d:	0f b6 1e             	movzbl (%esi),%ebx
+ b50:	83 c6 01             	add    $0x1,%esi
+ b53:	84 db                	test   %bl,%bl
+ b55:	74 29                	je     b80 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b5a:	85 d2                	test   %edx,%edx
+ b5c:	74 ca                	je     b28 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b5e:	83 fa 25             	cmp    $0x25,%edx
+ b61:	75 ea                	jne    b4d <printf+0x4d>
+      if(c == 'd'){
+ b63:	83 f8 25             	cmp    $0x25,%eax
+ b66:	0f 84 24 01 00 00    	je     c90 <printf+0x190>
+ b6c:	83 e8 63             	sub    $0x63,%eax
+ b6f:	83 f8 15             	cmp    $0x15,%eax
+ b72:	77 1c                	ja     b90 <printf+0x90>
+ b74:	ff 24 85 64 0f 00 00 	jmp    *0xf64(,%eax,4)
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b83:	5b                   	pop    %ebx
+ b84:	5e                   	pop    %esi
+ b85:	5f                   	pop    %edi
+ b86:	5d                   	pop    %ebp
+ b87:	c3                   	ret
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+  write(fd, &c, 1);
+ b90:	83 ec 04             	sub    $0x4,%esp
+ b93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b9a:	6a 01                	push   $0x1
+ b9c:	52                   	push   %edx
+ b9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ba0:	57                   	push   %edi
+ ba1:	e8 59 fb ff ff       	call   6ff <write>
+ ba6:	83 c4 0c             	add    $0xc,%esp
+ ba9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bac:	6a 01                	push   $0x1
+ bae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ bb1:	52                   	push   %edx
+ bb2:	57                   	push   %edi
+ bb3:	e8 47 fb ff ff       	call   6ff <write>
+        putc(fd, c);
+ bb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bbb:	31 d2                	xor    %edx,%edx
+ bbd:	eb 8e                	jmp    b4d <printf+0x4d>
+ bbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bc3:	83 ec 0c             	sub    $0xc,%esp
+ bc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bcb:	8b 13                	mov    (%ebx),%edx
+ bcd:	6a 00                	push   $0x0
+ bcf:	89 f8                	mov    %edi,%eax
+        ap++;
+ bd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ bd4:	e8 87 fe ff ff       	call   a60 <printint>
+        ap++;
+ bd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bdc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bdf:	31 d2                	xor    %edx,%edx
+ be1:	e9 67 ff ff ff       	jmp    b4d <printf+0x4d>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bf5:	83 c0 04             	add    $0x4,%eax
+ bf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bfb:	85 db                	test   %ebx,%ebx
+ bfd:	0f 84 9d 00 00 00    	je     ca0 <printf+0x1a0>
+        while(*s != 0){
+ c03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c08:	84 c0                	test   %al,%al
+ c0a:	0f 84 3d ff ff ff    	je     b4d <printf+0x4d>
+ c10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c16:	89 de                	mov    %ebx,%esi
+ c18:	89 d3                	mov    %edx,%ebx
+ c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c20:	83 ec 04             	sub    $0x4,%esp
+ c23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c29:	6a 01                	push   $0x1
+ c2b:	53                   	push   %ebx
+ c2c:	57                   	push   %edi
+ c2d:	e8 cd fa ff ff       	call   6ff <write>
+        while(*s != 0){
+ c32:	0f b6 06             	movzbl (%esi),%eax
+ c35:	83 c4 10             	add    $0x10,%esp
+ c38:	84 c0                	test   %al,%al
+ c3a:	75 e4                	jne    c20 <printf+0x120>
+      state = 0;
+ c3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c3f:	31 d2                	xor    %edx,%edx
+ c41:	e9 07 ff ff ff       	jmp    b4d <printf+0x4d>
+ c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c53:	83 ec 0c             	sub    $0xc,%esp
+ c56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c5b:	8b 13                	mov    (%ebx),%edx
+ c5d:	6a 01                	push   $0x1
+ c5f:	e9 6b ff ff ff       	jmp    bcf <printf+0xcf>
+ c64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c6b:	83 ec 04             	sub    $0x4,%esp
+ c6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c79:	6a 01                	push   $0x1
+ c7b:	52                   	push   %edx
+ c7c:	57                   	push   %edi
+ c7d:	e8 7d fa ff ff       	call   6ff <write>
+        ap++;
+ c82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c88:	31 d2                	xor    %edx,%edx
+ c8a:	e9 be fe ff ff       	jmp    b4d <printf+0x4d>
+ c8f:	90                   	nop
+  write(fd, &c, 1);
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c99:	6a 01                	push   $0x1
+ c9b:	e9 11 ff ff ff       	jmp    bb1 <printf+0xb1>
+ ca0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ca5:	bb 5c 0f 00 00       	mov    $0xf5c,%ebx
+ caa:	e9 61 ff ff ff       	jmp    c10 <printf+0x110>
+ caf:	90                   	nop
+
+00000cb0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cb0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cb1:	a1 58 14 00 00       	mov    0x1458,%eax
+{
+ cb6:	89 e5                	mov    %esp,%ebp
+ cb8:	57                   	push   %edi
+ cb9:	56                   	push   %esi
+ cba:	53                   	push   %ebx
+ cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ccc:	39 ca                	cmp    %ecx,%edx
+ cce:	73 30                	jae    d00 <free+0x50>
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 04                	jb     cd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd4:	39 c2                	cmp    %eax,%edx
+ cd6:	72 f0                	jb     cc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ cd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cdb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cde:	39 f8                	cmp    %edi,%eax
+ ce0:	74 2e                	je     d10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ce5:	8b 42 04             	mov    0x4(%edx),%eax
+ ce8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ ceb:	39 f1                	cmp    %esi,%ecx
+ ced:	74 38                	je     d27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cef:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cf1:	5b                   	pop    %ebx
+  freep = p;
+ cf2:	89 15 58 14 00 00    	mov    %edx,0x1458
+}
+ cf8:	5e                   	pop    %esi
+ cf9:	5f                   	pop    %edi
+ cfa:	5d                   	pop    %ebp
+ cfb:	c3                   	ret
+ cfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 d0                	jb     cd4 <free+0x24>
+ d04:	eb c2                	jmp    cc8 <free+0x18>
+ d06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d10:	03 70 04             	add    0x4(%eax),%esi
+ d13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d16:	8b 02                	mov    (%edx),%eax
+ d18:	8b 00                	mov    (%eax),%eax
+ d1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d1d:	8b 42 04             	mov    0x4(%edx),%eax
+ d20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d23:	39 f1                	cmp    %esi,%ecx
+ d25:	75 c8                	jne    cef <free+0x3f>
+    p->s.size += bp->s.size;
+ d27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d2a:	89 15 58 14 00 00    	mov    %edx,0x1458
+    p->s.size += bp->s.size;
+ d30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d36:	89 0a                	mov    %ecx,(%edx)
+}
+ d38:	5b                   	pop    %ebx
+ d39:	5e                   	pop    %esi
+ d3a:	5f                   	pop    %edi
+ d3b:	5d                   	pop    %ebp
+ d3c:	c3                   	ret
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+ d46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d4c:	8b 15 58 14 00 00    	mov    0x1458,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d52:	8d 78 07             	lea    0x7(%eax),%edi
+ d55:	c1 ef 03             	shr    $0x3,%edi
+ d58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d5b:	85 d2                	test   %edx,%edx
+ d5d:	0f 84 8d 00 00 00    	je     df0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d65:	8b 48 04             	mov    0x4(%eax),%ecx
+ d68:	39 f9                	cmp    %edi,%ecx
+ d6a:	73 64                	jae    dd0 <malloc+0x90>
+  if(nu < 4096)
+ d6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d71:	39 df                	cmp    %ebx,%edi
+ d73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d7d:	eb 0a                	jmp    d89 <malloc+0x49>
+ d7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d82:	8b 48 04             	mov    0x4(%eax),%ecx
+ d85:	39 f9                	cmp    %edi,%ecx
+ d87:	73 47                	jae    dd0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d89:	89 c2                	mov    %eax,%edx
+ d8b:	39 05 58 14 00 00    	cmp    %eax,0x1458
+ d91:	75 ed                	jne    d80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d93:	83 ec 0c             	sub    $0xc,%esp
+ d96:	56                   	push   %esi
+ d97:	e8 b5 fa ff ff       	call   851 <sbrk>
+  if(p == (char*)-1)
+ d9c:	83 c4 10             	add    $0x10,%esp
+ d9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ da2:	74 1c                	je     dc0 <malloc+0x80>
+  hp->s.size = nu;
+ da4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ da7:	83 ec 0c             	sub    $0xc,%esp
+ daa:	83 c0 08             	add    $0x8,%eax
+ dad:	50                   	push   %eax
+ dae:	e8 fd fe ff ff       	call   cb0 <free>
+  return freep;
+ db3:	8b 15 58 14 00 00    	mov    0x1458,%edx
+      if((p = morecore(nunits)) == 0)
+ db9:	83 c4 10             	add    $0x10,%esp
+ dbc:	85 d2                	test   %edx,%edx
+ dbe:	75 c0                	jne    d80 <malloc+0x40>
+        return 0;
+  }
+}
+ dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dc3:	31 c0                	xor    %eax,%eax
+}
+ dc5:	5b                   	pop    %ebx
+ dc6:	5e                   	pop    %esi
+ dc7:	5f                   	pop    %edi
+ dc8:	5d                   	pop    %ebp
+ dc9:	c3                   	ret
+ dca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ dd0:	39 cf                	cmp    %ecx,%edi
+ dd2:	74 4c                	je     e20 <malloc+0xe0>
+        p->s.size -= nunits;
+ dd4:	29 f9                	sub    %edi,%ecx
+ dd6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ dd9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ddc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ddf:	89 15 58 14 00 00    	mov    %edx,0x1458
+}
+ de5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ de8:	83 c0 08             	add    $0x8,%eax
+}
+ deb:	5b                   	pop    %ebx
+ dec:	5e                   	pop    %esi
+ ded:	5f                   	pop    %edi
+ dee:	5d                   	pop    %ebp
+ def:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ df0:	c7 05 58 14 00 00 5c 	movl   $0x145c,0x1458
+ df7:	14 00 00 
+    base.s.size = 0;
+ dfa:	b8 5c 14 00 00       	mov    $0x145c,%eax
+    base.s.ptr = freep = prevp = &base;
+ dff:	c7 05 5c 14 00 00 5c 	movl   $0x145c,0x145c
+ e06:	14 00 00 
+    base.s.size = 0;
+ e09:	c7 05 60 14 00 00 00 	movl   $0x0,0x1460
+ e10:	00 00 00 
+    if(p->s.size >= nunits){
+ e13:	e9 54 ff ff ff       	jmp    d6c <malloc+0x2c>
+ e18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e20:	8b 08                	mov    (%eax),%ecx
+ e22:	89 0a                	mov    %ecx,(%edx)
+ e24:	eb b9                	jmp    ddf <malloc+0x9f>
+ e26:	66 90                	xchg   %ax,%ax
+ e28:	66 90                	xchg   %ax,%ax
+ e2a:	66 90                	xchg   %ax,%ax
+ e2c:	66 90                	xchg   %ax,%ax
+ e2e:	66 90                	xchg   %ax,%ax
+
+00000e30 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e30:	55                   	push   %ebp
+ e31:	89 e5                	mov    %esp,%ebp
+ e33:	53                   	push   %ebx
+ e34:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ e37:	68 00 20 00 00       	push   $0x2000
+ e3c:	e8 ff fe ff ff       	call   d40 <malloc>
+ e41:	83 c4 10             	add    $0x10,%esp
+ e44:	85 c0                	test   %eax,%eax
+ e46:	74 47                	je     e8f <thread_create+0x5f>
+ e48:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e4a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ e50:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e53:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ e58:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ e5b:	ff 75 0c             	push   0xc(%ebp)
+ e5e:	50                   	push   %eax
+ e5f:	ff 75 08             	push   0x8(%ebp)
+ e62:	e8 6c fa ff ff       	call   8d3 <clone>
+ e67:	83 c4 10             	add    $0x10,%esp
+ e6a:	85 c0                	test   %eax,%eax
+ e6c:	78 0a                	js     e78 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e71:	c9                   	leave
+ e72:	c3                   	ret
+ e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e77:	90                   	nop
+    free(mem);
+ e78:	83 ec 0c             	sub    $0xc,%esp
+ e7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e7e:	53                   	push   %ebx
+ e7f:	e8 2c fe ff ff       	call   cb0 <free>
+ e84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e8a:	83 c4 10             	add    $0x10,%esp
+}
+ e8d:	c9                   	leave
+ e8e:	c3                   	ret
+    return -1;
+ e8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e94:	eb d8                	jmp    e6e <thread_create+0x3e>
+ e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ea0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ ea0:	55                   	push   %ebp
+ ea1:	89 e5                	mov    %esp,%ebp
+ ea3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ ea4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ea7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ eaa:	50                   	push   %eax
+ eab:	e8 3d fa ff ff       	call   8ed <join>
+ eb0:	83 c4 10             	add    $0x10,%esp
+ eb3:	85 c0                	test   %eax,%eax
+ eb5:	78 21                	js     ed8 <thread_join+0x38>
+ eb7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ebc:	83 ec 0c             	sub    $0xc,%esp
+ ebf:	ff 70 fc             	push   -0x4(%eax)
+ ec2:	e8 e9 fd ff ff       	call   cb0 <free>
+  return pid;
+ ec7:	83 c4 10             	add    $0x10,%esp
+}
+ eca:	89 d8                	mov    %ebx,%eax
+ ecc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ecf:	c9                   	leave
+ ed0:	c3                   	ret
+ ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ ed8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ edd:	eb eb                	jmp    eca <thread_join+0x2a>
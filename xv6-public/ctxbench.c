@@ -0,0 +1,59 @@
+// Context-switch microbenchmark.
+// Two processes bounce a byte back and forth over a pair of pipes,
+// so every round trip costs two context switches (and two page
+// table switches).  Compare a normal kernel with one built with
+// make NOPGE=1, which leaves global kernel mappings off, to see how
+// much of a switch is spent re-walking kernel page tables.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define N  10000
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, pid, start, elapsed;
+  int ping[2], pong[2];
+  char c;
+
+  n = N;
+  if(argc > 1)
+    n = atoi(argv[1]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "ctxbench: pipe failed\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "ctxbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < n; i++){
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+    }
+    exit();
+  }
+
+  c = 'x';
+  start = uptime();
+  for(i = 0; i < n; i++){
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "ctxbench: read failed\n");
+      break;
+    }
+  }
+  elapsed = uptime() - start;
+  wait();
+
+  printf(1, "ctxbench: %d round trips (%d switches) in %d ticks\n",
+         i, 2*i, elapsed);
+  exit();
+}
@@ -7,9 +7,22 @@ struct proc;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
+struct kmem_cache;
+struct memstat;
+struct pstat;
+struct vmspace;
+struct sysstat;
+struct traceent;
 struct stat;
 struct superblock;
 
+// aio.c
+void            aioinit(void);
+void            aiodrain(struct vmspace*);
+void            aiofree(struct vmspace*);
+int             aiosetup(void);
+int             aioenter(int, int);
+
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
@@ -24,6 +37,8 @@ void            panic(char*) __attribute__((noreturn));
 
 // exec.c
 int             exec(char*, char**);
+void            excacheinit(void);
+void            excacheinval(uint, uint);
 
 // file.c
 struct file*    filealloc(void);
@@ -31,8 +46,15 @@ void            fileclose(struct file*);
 struct file*    filedup(struct file*);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filereadat(struct file*, char*, int, uint);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewriteat(struct file*, char*, int, uint);
+
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -40,6 +62,7 @@ int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            icacheinit(void);
 void            iinit(int dev);
 void            ilock(struct inode*);
 void            iput(struct inode*);
@@ -65,7 +88,12 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kalloc_order(int);
 void            kfree(char*);
+void            kfree_order(char*, int);
+void            kmemdump(void);
+void            kmemhist(int*);
+void            kmemstat(struct memstat*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
 
@@ -78,7 +106,12 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicsendipi(int, int);
 void            lapicstartap(uchar, uint);
+uint64          nsecs(void);
+void            nssplit(uint64, uint*, uint*);
+void            tscparams(uint*, uint*, uint64*);
+extern uint     tscmhz;
 void            microdelay(int);
 
 // log.c
@@ -91,12 +124,18 @@ void            end_op();
 extern int      ismp;
 void            mpinit(void);
 
+// physmem.c
+extern uint     phystop;
+void            physmeminit(void);
+int             physmemrange(int, uint*, uint*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
 int             pipealloc(struct file**, struct file**);
+void            pipeinit(void);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
@@ -106,19 +145,31 @@ int             pipewrite(struct pipe*, char*, int);
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             clone(void(*)(void*), void*, void*);
+int             join(void**);
+int             getpinfo(struct pstat*);
 int             growproc(int);
 int             kill(int);
+int             kthread(char*, void(*)(void));
+int             procsysstat(int, struct sysstat*);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
+int             nice(int);
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             schedtick(void);
+int             setpriority(int, int);
+int             settickets(int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
+int             vmcopy(struct vmspace*, uint, char*, uint, int);
+int             vmspaceexec(pde_t*);
 int             wait(void);
 void            wakeup(void*);
+void            wakeproc(struct proc*, void*);
 void            yield(void);
 
 // swtch.S
@@ -133,6 +184,12 @@ void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
 
+// slab.c
+void            slabinit(void);
+struct kmem_cache* kmem_cache_create(char*, uint, void(*)(void*));
+void*           kmem_cache_alloc(struct kmem_cache*);
+void            kmem_cache_free(struct kmem_cache*, void*);
+
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
@@ -156,8 +213,18 @@ int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
 
+// systrace.c
+extern int      systracing;
+void            systraceinit(void);
+int             systracecall(int, int(*)(void));
+void            systraceexit(struct proc*);
+int             systrace(int, int);
+int             sysstat(int, struct sysstat*);
+int             traceread(struct traceent*, int);
+
 // timer.c
-void            timerinit(void);
+int             sleepticks(uint);
+void            timerexpire(void);
 
 // trap.c
 void            idtinit(void);
@@ -170,13 +237,23 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// vdso.c
+void            vdsoinit(void);
+int             vdsomap(pde_t*, int);
+void            vdsosetpid(pde_t*, int);
+void            vdsotick(void);
+void            vdsounmap(pde_t*);
+
 // vm.c
+extern int      sysenter;
 void            seginit(void);
 void            kvmalloc(void);
+void            pgeinit(void);
 pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+int             shrinkuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
@@ -185,6 +262,8 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+void            tlbinval(pde_t*, uint, uint);
+void            tlbshootpoll(void);
 
 int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, struct file* fp, struct proc *curproc);
 int do_munmap(int addrInt, int length);
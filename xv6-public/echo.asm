@@ -0,0 +1,2000 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 00 0e 00 00       	push   $0xe00
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 02 0e 00 00       	push   $0xe02
+  3e:	6a 01                	push   $0x1
+  40:	e8 db 09 00 00       	call   a20 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 07 0e 00 00       	push   $0xe07
+  55:	50                   	push   %eax
+  56:	68 02 0e 00 00       	push   $0xe02
+  5b:	6a 01                	push   $0x1
+  5d:	e8 be 09 00 00       	call   a20 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 4d 05 00 00       	call   5b7 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 58 04 00 00       	call   605 <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 85 04 00 00       	call   687 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 be 04 00 00       	call   6d5 <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 18 04 00 00       	call   639 <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2bc:	5d                   	pop    %ebp
+ 2bd:	c3                   	ret
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 2c0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 2c1:	31 c0                	xor    %eax,%eax
+ 2c3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2c8:	89 e5                	mov    %esp,%ebp
+ 2ca:	56                   	push   %esi
+ 2cb:	53                   	push   %ebx
+ 2cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2cf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 2d3:	85 c0                	test   %eax,%eax
+ 2d5:	74 32                	je     309 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 2d7:	83 f8 02             	cmp    $0x2,%eax
+ 2da:	74 0c                	je     2e8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 2dc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 2e4:	85 c0                	test   %eax,%eax
+ 2e6:	74 21                	je     309 <mutex_lock+0x49>
+ 2e8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 02                	push   $0x2
+ 2f5:	6a 00                	push   $0x0
+ 2f7:	53                   	push   %ebx
+ 2f8:	e8 2a 05 00 00       	call   827 <futex>
+ 2fd:	89 f0                	mov    %esi,%eax
+ 2ff:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 302:	83 c4 10             	add    $0x10,%esp
+ 305:	85 c0                	test   %eax,%eax
+ 307:	75 e7                	jne    2f0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 309:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 30c:	5b                   	pop    %ebx
+ 30d:	5e                   	pop    %esi
+ 30e:	5d                   	pop    %ebp
+ 30f:	c3                   	ret
+
+00000310 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	31 c0                	xor    %eax,%eax
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 31e:	83 f8 02             	cmp    $0x2,%eax
+ 321:	74 05                	je     328 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 323:	c9                   	leave
+ 324:	c3                   	ret
+ 325:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	6a 01                	push   $0x1
+ 32d:	6a 01                	push   $0x1
+ 32f:	52                   	push   %edx
+ 330:	e8 f2 04 00 00       	call   827 <futex>
+ 335:	83 c4 10             	add    $0x10,%esp
+}
+ 338:	c9                   	leave
+ 339:	c3                   	ret
+ 33a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000340 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 34c:	5d                   	pop    %ebp
+ 34d:	c3                   	ret
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 350:	55                   	push   %ebp
+ 351:	31 c0                	xor    %eax,%eax
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	57                   	push   %edi
+ 356:	56                   	push   %esi
+ 357:	53                   	push   %ebx
+ 358:	83 ec 0c             	sub    $0xc,%esp
+ 35b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 35e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 361:	8b 3e                	mov    (%esi),%edi
+ 363:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 366:	83 f8 02             	cmp    $0x2,%eax
+ 369:	74 5d                	je     3c8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 36b:	83 ec 04             	sub    $0x4,%esp
+ 36e:	57                   	push   %edi
+ 36f:	6a 00                	push   $0x0
+ 371:	56                   	push   %esi
+ 372:	e8 b0 04 00 00       	call   827 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 377:	31 c0                	xor    %eax,%eax
+ 379:	ba 01 00 00 00       	mov    $0x1,%edx
+ 37e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	74 30                	je     3b9 <cond_wait+0x69>
+  if(c != 2)
+ 389:	83 f8 02             	cmp    $0x2,%eax
+ 38c:	74 0c                	je     39a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 38e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 393:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 396:	85 c0                	test   %eax,%eax
+ 398:	74 1f                	je     3b9 <cond_wait+0x69>
+ 39a:	be 02 00 00 00       	mov    $0x2,%esi
+ 39f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 02                	push   $0x2
+ 3a5:	6a 00                	push   $0x0
+ 3a7:	53                   	push   %ebx
+ 3a8:	e8 7a 04 00 00       	call   827 <futex>
+ 3ad:	89 f0                	mov    %esi,%eax
+ 3af:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	75 e7                	jne    3a0 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 3b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5f                   	pop    %edi
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	6a 01                	push   $0x1
+ 3cd:	6a 01                	push   $0x1
+ 3cf:	53                   	push   %ebx
+ 3d0:	e8 52 04 00 00       	call   827 <futex>
+ 3d5:	83 c4 10             	add    $0x10,%esp
+ 3d8:	eb 91                	jmp    36b <cond_wait+0x1b>
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003e0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	83 ec 04             	sub    $0x4,%esp
+ 3e7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 3f0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 3f2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3f5:	89 c8                	mov    %ecx,%eax
+ 3f7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 3fb:	39 c1                	cmp    %eax,%ecx
+ 3fd:	75 f1                	jne    3f0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 3ff:	83 ec 04             	sub    $0x4,%esp
+ 402:	6a 01                	push   $0x1
+ 404:	6a 01                	push   $0x1
+ 406:	52                   	push   %edx
+ 407:	e8 1b 04 00 00       	call   827 <futex>
+}
+ 40c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 40f:	83 c4 10             	add    $0x10,%esp
+ 412:	c9                   	leave
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	83 ec 04             	sub    $0x4,%esp
+ 427:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 430:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 432:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 435:	89 c8                	mov    %ecx,%eax
+ 437:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 43b:	39 c1                	cmp    %eax,%ecx
+ 43d:	75 f1                	jne    430 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 43f:	83 ec 04             	sub    $0x4,%esp
+ 442:	6a 40                	push   $0x40
+ 444:	6a 01                	push   $0x1
+ 446:	52                   	push   %edx
+ 447:	e8 db 03 00 00       	call   827 <futex>
+}
+ 44c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	c9                   	leave
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 460:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 465:	c3                   	ret
+ 466:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000470 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 470:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 475:	85 c0                	test   %eax,%eax
+ 477:	74 07                	je     480 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 479:	c3                   	ret
+ 47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 480:	e9 d2 02 00 00       	jmp    757 <getpid>
+ 485:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	53                   	push   %ebx
+ 496:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 499:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 49b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 4a1:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4a7:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4ac:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4b2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4b5:	89 d0                	mov    %edx,%eax
+ 4b7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 4ba:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4c0:	29 d9                	sub    %ebx,%ecx
+ 4c2:	89 c6                	mov    %eax,%esi
+ 4c4:	89 d7                	mov    %edx,%edi
+ 4c6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 4c9:	d3 e6                	shl    %cl,%esi
+ 4cb:	31 c0                	xor    %eax,%eax
+ 4cd:	f6 c1 20             	test   $0x20,%cl
+ 4d0:	0f 45 fe             	cmovne %esi,%edi
+ 4d3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4d6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4d9:	89 d9                	mov    %ebx,%ecx
+ 4db:	31 db                	xor    %ebx,%ebx
+ 4dd:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4e3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 4e6:	d3 ea                	shr    %cl,%edx
+ 4e8:	f6 c1 20             	test   $0x20,%cl
+ 4eb:	0f 45 c2             	cmovne %edx,%eax
+ 4ee:	0f 45 d3             	cmovne %ebx,%edx
+ 4f1:	01 f0                	add    %esi,%eax
+ 4f3:	11 fa                	adc    %edi,%edx
+}
+ 4f5:	83 c4 0c             	add    $0xc,%esp
+ 4f8:	5b                   	pop    %ebx
+ 4f9:	5e                   	pop    %esi
+ 4fa:	5f                   	pop    %edi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000500 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	57                   	push   %edi
+ 504:	56                   	push   %esi
+ 505:	53                   	push   %ebx
+ 506:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 509:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 50d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 510:	74 0e                	je     520 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 512:	83 c4 1c             	add    $0x1c,%esp
+ 515:	5b                   	pop    %ebx
+ 516:	5e                   	pop    %esi
+ 517:	5f                   	pop    %edi
+ 518:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 519:	e9 a5 03 00 00       	jmp    8c3 <clock_gettime>
+ 51e:	66 90                	xchg   %ax,%ax
+ 520:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 522:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 528:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 52e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 533:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 536:	89 d0                	mov    %edx,%eax
+ 538:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 53b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 541:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 547:	89 c6                	mov    %eax,%esi
+ 549:	89 d7                	mov    %edx,%edi
+ 54b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 54e:	d3 e6                	shl    %cl,%esi
+ 550:	31 c0                	xor    %eax,%eax
+ 552:	f6 c1 20             	test   $0x20,%cl
+ 555:	0f 45 fe             	cmovne %esi,%edi
+ 558:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 55b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 55e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 565:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 56b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 56e:	d3 ea                	shr    %cl,%edx
+ 570:	f6 c1 20             	test   $0x20,%cl
+ 573:	74 04                	je     579 <vclock_gettime+0x79>
+ 575:	89 d0                	mov    %edx,%eax
+ 577:	31 d2                	xor    %edx,%edx
+ 579:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 57b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 580:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 582:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 584:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 586:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 588:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 58e:	29 c1                	sub    %eax,%ecx
+}
+ 590:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 592:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 595:	83 c4 1c             	add    $0x1c,%esp
+ 598:	5b                   	pop    %ebx
+ 599:	5e                   	pop    %esi
+ 59a:	5f                   	pop    %edi
+ 59b:	5d                   	pop    %ebp
+ 59c:	c3                   	ret
+
+0000059d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 59d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5a9:	74 09                	je     5b4 <fork+0x17>
+ 5ab:	89 e1                	mov    %esp,%ecx
+ 5ad:	ba b6 05 00 00       	mov    $0x5b6,%edx
+ 5b2:	0f 34                	sysenter
+ 5b4:	cd 40                	int    $0x40
+ 5b6:	c3                   	ret
+
+000005b7 <exit>:
+SYSCALL(exit)
+ 5b7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5c3:	74 09                	je     5ce <exit+0x17>
+ 5c5:	89 e1                	mov    %esp,%ecx
+ 5c7:	ba d0 05 00 00       	mov    $0x5d0,%edx
+ 5cc:	0f 34                	sysenter
+ 5ce:	cd 40                	int    $0x40
+ 5d0:	c3                   	ret
+
+000005d1 <wait>:
+SYSCALL(wait)
+ 5d1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5dd:	74 09                	je     5e8 <wait+0x17>
+ 5df:	89 e1                	mov    %esp,%ecx
+ 5e1:	ba ea 05 00 00       	mov    $0x5ea,%edx
+ 5e6:	0f 34                	sysenter
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <pipe>:
+SYSCALL(pipe)
+ 5eb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5f7:	74 09                	je     602 <pipe+0x17>
+ 5f9:	89 e1                	mov    %esp,%ecx
+ 5fb:	ba 04 06 00 00       	mov    $0x604,%edx
+ 600:	0f 34                	sysenter
+ 602:	cd 40                	int    $0x40
+ 604:	c3                   	ret
+
+00000605 <read>:
+SYSCALL(read)
+ 605:	b8 05 00 00 00       	mov    $0x5,%eax
+ 60a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 611:	74 09                	je     61c <read+0x17>
+ 613:	89 e1                	mov    %esp,%ecx
+ 615:	ba 1e 06 00 00       	mov    $0x61e,%edx
+ 61a:	0f 34                	sysenter
+ 61c:	cd 40                	int    $0x40
+ 61e:	c3                   	ret
+
+0000061f <write>:
+SYSCALL(write)
+ 61f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 624:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 62b:	74 09                	je     636 <write+0x17>
+ 62d:	89 e1                	mov    %esp,%ecx
+ 62f:	ba 38 06 00 00       	mov    $0x638,%edx
+ 634:	0f 34                	sysenter
+ 636:	cd 40                	int    $0x40
+ 638:	c3                   	ret
+
+00000639 <close>:
+SYSCALL(close)
+ 639:	b8 15 00 00 00       	mov    $0x15,%eax
+ 63e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 645:	74 09                	je     650 <close+0x17>
+ 647:	89 e1                	mov    %esp,%ecx
+ 649:	ba 52 06 00 00       	mov    $0x652,%edx
+ 64e:	0f 34                	sysenter
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <kill>:
+SYSCALL(kill)
+ 653:	b8 06 00 00 00       	mov    $0x6,%eax
+ 658:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 65f:	74 09                	je     66a <kill+0x17>
+ 661:	89 e1                	mov    %esp,%ecx
+ 663:	ba 6c 06 00 00       	mov    $0x66c,%edx
+ 668:	0f 34                	sysenter
+ 66a:	cd 40                	int    $0x40
+ 66c:	c3                   	ret
+
+0000066d <exec>:
+SYSCALL(exec)
+ 66d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 672:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 679:	74 09                	je     684 <exec+0x17>
+ 67b:	89 e1                	mov    %esp,%ecx
+ 67d:	ba 86 06 00 00       	mov    $0x686,%edx
+ 682:	0f 34                	sysenter
+ 684:	cd 40                	int    $0x40
+ 686:	c3                   	ret
+
+00000687 <open>:
+SYSCALL(open)
+ 687:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 68c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 693:	74 09                	je     69e <open+0x17>
+ 695:	89 e1                	mov    %esp,%ecx
+ 697:	ba a0 06 00 00       	mov    $0x6a0,%edx
+ 69c:	0f 34                	sysenter
+ 69e:	cd 40                	int    $0x40
+ 6a0:	c3                   	ret
+
+000006a1 <mknod>:
+SYSCALL(mknod)
+ 6a1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6a6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6ad:	74 09                	je     6b8 <mknod+0x17>
+ 6af:	89 e1                	mov    %esp,%ecx
+ 6b1:	ba ba 06 00 00       	mov    $0x6ba,%edx
+ 6b6:	0f 34                	sysenter
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+
+000006bb <unlink>:
+SYSCALL(unlink)
+ 6bb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6c0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6c7:	74 09                	je     6d2 <unlink+0x17>
+ 6c9:	89 e1                	mov    %esp,%ecx
+ 6cb:	ba d4 06 00 00       	mov    $0x6d4,%edx
+ 6d0:	0f 34                	sysenter
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	c3                   	ret
+
+000006d5 <fstat>:
+SYSCALL(fstat)
+ 6d5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6da:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6e1:	74 09                	je     6ec <fstat+0x17>
+ 6e3:	89 e1                	mov    %esp,%ecx
+ 6e5:	ba ee 06 00 00       	mov    $0x6ee,%edx
+ 6ea:	0f 34                	sysenter
+ 6ec:	cd 40                	int    $0x40
+ 6ee:	c3                   	ret
+
+000006ef <link>:
+SYSCALL(link)
+ 6ef:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6f4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6fb:	74 09                	je     706 <link+0x17>
+ 6fd:	89 e1                	mov    %esp,%ecx
+ 6ff:	ba 08 07 00 00       	mov    $0x708,%edx
+ 704:	0f 34                	sysenter
+ 706:	cd 40                	int    $0x40
+ 708:	c3                   	ret
+
+00000709 <mkdir>:
+SYSCALL(mkdir)
+ 709:	b8 14 00 00 00       	mov    $0x14,%eax
+ 70e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 715:	74 09                	je     720 <mkdir+0x17>
+ 717:	89 e1                	mov    %esp,%ecx
+ 719:	ba 22 07 00 00       	mov    $0x722,%edx
+ 71e:	0f 34                	sysenter
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <chdir>:
+SYSCALL(chdir)
+ 723:	b8 09 00 00 00       	mov    $0x9,%eax
+ 728:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 72f:	74 09                	je     73a <chdir+0x17>
+ 731:	89 e1                	mov    %esp,%ecx
+ 733:	ba 3c 07 00 00       	mov    $0x73c,%edx
+ 738:	0f 34                	sysenter
+ 73a:	cd 40                	int    $0x40
+ 73c:	c3                   	ret
+
+0000073d <dup>:
+SYSCALL(dup)
+ 73d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 742:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 749:	74 09                	je     754 <dup+0x17>
+ 74b:	89 e1                	mov    %esp,%ecx
+ 74d:	ba 56 07 00 00       	mov    $0x756,%edx
+ 752:	0f 34                	sysenter
+ 754:	cd 40                	int    $0x40
+ 756:	c3                   	ret
+
+00000757 <getpid>:
+SYSCALL(getpid)
+ 757:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 75c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 763:	74 09                	je     76e <getpid+0x17>
+ 765:	89 e1                	mov    %esp,%ecx
+ 767:	ba 70 07 00 00       	mov    $0x770,%edx
+ 76c:	0f 34                	sysenter
+ 76e:	cd 40                	int    $0x40
+ 770:	c3                   	ret
+
+00000771 <sbrk>:
+SYSCALL(sbrk)
+ 771:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 776:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 77d:	74 09                	je     788 <sbrk+0x17>
+ 77f:	89 e1                	mov    %esp,%ecx
+ 781:	ba 8a 07 00 00       	mov    $0x78a,%edx
+ 786:	0f 34                	sysenter
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <sleep>:
+SYSCALL(sleep)
+ 78b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 790:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 797:	74 09                	je     7a2 <sleep+0x17>
+ 799:	89 e1                	mov    %esp,%ecx
+ 79b:	ba a4 07 00 00       	mov    $0x7a4,%edx
+ 7a0:	0f 34                	sysenter
+ 7a2:	cd 40                	int    $0x40
+ 7a4:	c3                   	ret
+
+000007a5 <uptime>:
+SYSCALL(uptime)
+ 7a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7aa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7b1:	74 09                	je     7bc <uptime+0x17>
+ 7b3:	89 e1                	mov    %esp,%ecx
+ 7b5:	ba be 07 00 00       	mov    $0x7be,%edx
+ 7ba:	0f 34                	sysenter
+ 7bc:	cd 40                	int    $0x40
+ 7be:	c3                   	ret
+
+000007bf <mmap>:
+SYSCALL(mmap)
+ 7bf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7c4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7cb:	74 09                	je     7d6 <mmap+0x17>
+ 7cd:	89 e1                	mov    %esp,%ecx
+ 7cf:	ba d8 07 00 00       	mov    $0x7d8,%edx
+ 7d4:	0f 34                	sysenter
+ 7d6:	cd 40                	int    $0x40
+ 7d8:	c3                   	ret
+
+000007d9 <munmap>:
+SYSCALL(munmap)
+ 7d9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7de:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7e5:	74 09                	je     7f0 <munmap+0x17>
+ 7e7:	89 e1                	mov    %esp,%ecx
+ 7e9:	ba f2 07 00 00       	mov    $0x7f2,%edx
+ 7ee:	0f 34                	sysenter
+ 7f0:	cd 40                	int    $0x40
+ 7f2:	c3                   	ret
+
+000007f3 <clone>:
+SYSCALL(clone)
+ 7f3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7f8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ff:	74 09                	je     80a <clone+0x17>
+ 801:	89 e1                	mov    %esp,%ecx
+ 803:	ba 0c 08 00 00       	mov    $0x80c,%edx
+ 808:	0f 34                	sysenter
+ 80a:	cd 40                	int    $0x40
+ 80c:	c3                   	ret
+
+0000080d <join>:
+SYSCALL(join)
+ 80d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 812:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 819:	74 09                	je     824 <join+0x17>
+ 81b:	89 e1                	mov    %esp,%ecx
+ 81d:	ba 26 08 00 00       	mov    $0x826,%edx
+ 822:	0f 34                	sysenter
+ 824:	cd 40                	int    $0x40
+ 826:	c3                   	ret
+
+00000827 <futex>:
+SYSCALL(futex)
+ 827:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 82c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 833:	74 09                	je     83e <futex+0x17>
+ 835:	89 e1                	mov    %esp,%ecx
+ 837:	ba 40 08 00 00       	mov    $0x840,%edx
+ 83c:	0f 34                	sysenter
+ 83e:	cd 40                	int    $0x40
+ 840:	c3                   	ret
+
+00000841 <memstat>:
+SYSCALL(memstat)
+ 841:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 846:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 84d:	74 09                	je     858 <memstat+0x17>
+ 84f:	89 e1                	mov    %esp,%ecx
+ 851:	ba 5a 08 00 00       	mov    $0x85a,%edx
+ 856:	0f 34                	sysenter
+ 858:	cd 40                	int    $0x40
+ 85a:	c3                   	ret
+
+0000085b <nice>:
+SYSCALL(nice)
+ 85b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 860:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 867:	74 09                	je     872 <nice+0x17>
+ 869:	89 e1                	mov    %esp,%ecx
+ 86b:	ba 74 08 00 00       	mov    $0x874,%edx
+ 870:	0f 34                	sysenter
+ 872:	cd 40                	int    $0x40
+ 874:	c3                   	ret
+
+00000875 <setpriority>:
+SYSCALL(setpriority)
+ 875:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 87a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 881:	74 09                	je     88c <setpriority+0x17>
+ 883:	89 e1                	mov    %esp,%ecx
+ 885:	ba 8e 08 00 00       	mov    $0x88e,%edx
+ 88a:	0f 34                	sysenter
+ 88c:	cd 40                	int    $0x40
+ 88e:	c3                   	ret
+
+0000088f <getpinfo>:
+SYSCALL(getpinfo)
+ 88f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 894:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 89b:	74 09                	je     8a6 <getpinfo+0x17>
+ 89d:	89 e1                	mov    %esp,%ecx
+ 89f:	ba a8 08 00 00       	mov    $0x8a8,%edx
+ 8a4:	0f 34                	sysenter
+ 8a6:	cd 40                	int    $0x40
+ 8a8:	c3                   	ret
+
+000008a9 <settickets>:
+SYSCALL(settickets)
+ 8a9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8ae:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8b5:	74 09                	je     8c0 <settickets+0x17>
+ 8b7:	89 e1                	mov    %esp,%ecx
+ 8b9:	ba c2 08 00 00       	mov    $0x8c2,%edx
+ 8be:	0f 34                	sysenter
+ 8c0:	cd 40                	int    $0x40
+ 8c2:	c3                   	ret
+
+000008c3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 8c3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8c8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8cf:	74 09                	je     8da <clock_gettime+0x17>
+ 8d1:	89 e1                	mov    %esp,%ecx
+ 8d3:	ba dc 08 00 00       	mov    $0x8dc,%edx
+ 8d8:	0f 34                	sysenter
+ 8da:	cd 40                	int    $0x40
+ 8dc:	c3                   	ret
+
+000008dd <batch>:
+SYSCALL(batch)
+ 8dd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8e2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8e9:	74 09                	je     8f4 <batch+0x17>
+ 8eb:	89 e1                	mov    %esp,%ecx
+ 8ed:	ba f6 08 00 00       	mov    $0x8f6,%edx
+ 8f2:	0f 34                	sysenter
+ 8f4:	cd 40                	int    $0x40
+ 8f6:	c3                   	ret
+
+000008f7 <aiosetup>:
+SYSCALL(aiosetup)
+ 8f7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8fc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 903:	74 09                	je     90e <aiosetup+0x17>
+ 905:	89 e1                	mov    %esp,%ecx
+ 907:	ba 10 09 00 00       	mov    $0x910,%edx
+ 90c:	0f 34                	sysenter
+ 90e:	cd 40                	int    $0x40
+ 910:	c3                   	ret
+
+00000911 <aioenter>:
+SYSCALL(aioenter)
+ 911:	b8 23 00 00 00       	mov    $0x23,%eax
+ 916:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 91d:	74 09                	je     928 <aioenter+0x17>
+ 91f:	89 e1                	mov    %esp,%ecx
+ 921:	ba 2a 09 00 00       	mov    $0x92a,%edx
+ 926:	0f 34                	sysenter
+ 928:	cd 40                	int    $0x40
+ 92a:	c3                   	ret
+
+0000092b <systrace>:
+SYSCALL(systrace)
+ 92b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 930:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 937:	74 09                	je     942 <systrace+0x17>
+ 939:	89 e1                	mov    %esp,%ecx
+ 93b:	ba 44 09 00 00       	mov    $0x944,%edx
+ 940:	0f 34                	sysenter
+ 942:	cd 40                	int    $0x40
+ 944:	c3                   	ret
+
+00000945 <sysstat>:
+SYSCALL(sysstat)
+ 945:	b8 25 00 00 00       	mov    $0x25,%eax
+ 94a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 951:	74 09                	je     95c <sysstat+0x17>
+ 953:	89 e1                	mov    %esp,%ecx
+ 955:	ba 5e 09 00 00       	mov    $0x95e,%edx
+ 95a:	0f 34                	sysenter
+ 95c:	cd 40                	int    $0x40
+ 95e:	c3                   	ret
+
+0000095f <traceread>:
+SYSCALL(traceread)
+ 95f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 964:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 96b:	74 09                	je     976 <traceread+0x17>
+ 96d:	89 e1                	mov    %esp,%ecx
+ 96f:	ba 78 09 00 00       	mov    $0x978,%edx
+ 974:	0f 34                	sysenter
+ 976:	cd 40                	int    $0x40
+ 978:	c3                   	ret
+ 979:	66 90                	xchg   %ax,%ax
+ 97b:	66 90                	xchg   %ax,%ax
+ 97d:	66 90                	xchg   %ax,%ax
+ 97f:	90                   	nop
+
+00000980 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+ 986:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 988:	89 d1                	mov    %edx,%ecx
+{
+ 98a:	83 ec 3c             	sub    $0x3c,%esp
+ 98d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 990:	85 d2                	test   %edx,%edx
+ 992:	0f 89 80 00 00 00    	jns    a18 <printint+0x98>
+ 998:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 99c:	74 7a                	je     a18 <printint+0x98>
+    x = -xx;
+ 99e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9a8:	31 f6                	xor    %esi,%esi
+ 9aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9b0:	89 c8                	mov    %ecx,%eax
+ 9b2:	31 d2                	xor    %edx,%edx
+ 9b4:	89 f7                	mov    %esi,%edi
+ 9b6:	f7 f3                	div    %ebx
+ 9b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9bb:	0f b6 92 68 0e 00 00 	movzbl 0xe68(%edx),%edx
+ 9c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9c6:	89 ca                	mov    %ecx,%edx
+ 9c8:	89 c1                	mov    %eax,%ecx
+ 9ca:	39 da                	cmp    %ebx,%edx
+ 9cc:	73 e2                	jae    9b0 <printint+0x30>
+  if(neg)
+ 9ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9d1:	85 c0                	test   %eax,%eax
+ 9d3:	74 07                	je     9dc <printint+0x5c>
+    buf[i++] = '-';
+ 9d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9da:	89 f7                	mov    %esi,%edi
+ 9dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9e2:	01 df                	add    %ebx,%edi
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9f4:	6a 01                	push   $0x1
+ 9f6:	50                   	push   %eax
+ 9f7:	56                   	push   %esi
+ 9f8:	e8 22 fc ff ff       	call   61f <write>
+  while(--i >= 0)
+ 9fd:	89 f8                	mov    %edi,%eax
+ 9ff:	83 c4 10             	add    $0x10,%esp
+ a02:	83 ef 01             	sub    $0x1,%edi
+ a05:	39 d8                	cmp    %ebx,%eax
+ a07:	75 df                	jne    9e8 <printint+0x68>
+}
+ a09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a0c:	5b                   	pop    %ebx
+ a0d:	5e                   	pop    %esi
+ a0e:	5f                   	pop    %edi
+ a0f:	5d                   	pop    %ebp
+ a10:	c3                   	ret
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a18:	31 c0                	xor    %eax,%eax
+ a1a:	eb 89                	jmp    9a5 <printint+0x25>
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	57                   	push   %edi
+ a24:	56                   	push   %esi
+ a25:	53                   	push   %ebx
+ a26:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a29:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a2f:	0f b6 1e             	movzbl (%esi),%ebx
+ a32:	83 c6 01             	add    $0x1,%esi
+ a35:	84 db                	test   %bl,%bl
+ a37:	74 67                	je     aa0 <printf+0x80>
+ a39:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a3c:	31 d2                	xor    %edx,%edx
+ a3e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a41:	eb 34                	jmp    a77 <printf+0x57>
+ a43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a47:	90                   	nop
+ a48:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a4b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a50:	83 f8 25             	cmp    $0x25,%eax
+ a53:	74 18                	je     a6d <printf+0x4d>
+  write(fd, &c, 1);
+ a55:	83 ec 04             	sub    $0x4,%esp
+ a58:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a5b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a5e:	6a 01                	push   $0x1
+ a60:	50                   	push   %eax
+ a61:	57                   	push   %edi
+ a62:	e8 b8 fb ff ff       	call   61f <write>
+ a67:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a6a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a6d:	0f b6 1e             	movzbl (%esi),%ebx
+ a70:	83 c6 01             	add    $0x1,%esi
+ a73:	84 db                	test   %bl,%bl
+ a75:	74 29                	je     aa0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a77:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a7a:	85 d2                	test   %edx,%edx
+ a7c:	74 ca                	je     a48 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a7e:	83 fa 25             	cmp    $0x25,%edx
+ a81:	75 ea                	jne    a6d <printf+0x4d>
+      if(c == 'd'){
+ a83:	83 f8 25             	cmp    $0x25,%eax
+ a86:	0f 84 24 01 00 00    	je     bb0 <printf+0x190>
+ a8c:	83 e8 63             	sub    $0x63,%eax
+ a8f:	83 f8 15             	cmp    $0x15,%eax
+ a92:	77 1c                	ja     ab0 <printf+0x90>
+ a94:	ff 24 85 10 0e 00 00 	jmp    *0xe10(,%eax,4)
+ a9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aa3:	5b                   	pop    %ebx
+ aa4:	5e                   	pop    %esi
+ aa5:	5f                   	pop    %edi
+ aa6:	5d                   	pop    %ebp
+ aa7:	c3                   	ret
+ aa8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aba:	6a 01                	push   $0x1
+ abc:	52                   	push   %edx
+ abd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ac0:	57                   	push   %edi
+ ac1:	e8 59 fb ff ff       	call   61f <write>
+ ac6:	83 c4 0c             	add    $0xc,%esp
+ ac9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ acc:	6a 01                	push   $0x1
+ ace:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ad1:	52                   	push   %edx
+ ad2:	57                   	push   %edi
+ ad3:	e8 47 fb ff ff       	call   61f <write>
+        putc(fd, c);
+ ad8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ adb:	31 d2                	xor    %edx,%edx
+ add:	eb 8e                	jmp    a6d <printf+0x4d>
+ adf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ae0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aeb:	8b 13                	mov    (%ebx),%edx
+ aed:	6a 00                	push   $0x0
+ aef:	89 f8                	mov    %edi,%eax
+        ap++;
+ af1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ af4:	e8 87 fe ff ff       	call   980 <printint>
+        ap++;
+ af9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ afc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aff:	31 d2                	xor    %edx,%edx
+ b01:	e9 67 ff ff ff       	jmp    a6d <printf+0x4d>
+ b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b15:	83 c0 04             	add    $0x4,%eax
+ b18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b1b:	85 db                	test   %ebx,%ebx
+ b1d:	0f 84 9d 00 00 00    	je     bc0 <printf+0x1a0>
+        while(*s != 0){
+ b23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b28:	84 c0                	test   %al,%al
+ b2a:	0f 84 3d ff ff ff    	je     a6d <printf+0x4d>
+ b30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b36:	89 de                	mov    %ebx,%esi
+ b38:	89 d3                	mov    %edx,%ebx
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b40:	83 ec 04             	sub    $0x4,%esp
+ b43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b49:	6a 01                	push   $0x1
+ b4b:	53                   	push   %ebx
+ b4c:	57                   	push   %edi
+ b4d:	e8 cd fa ff ff       	call   61f <write>
+        while(*s != 0){
+ b52:	0f b6 06             	movzbl (%esi),%eax
+ b55:	83 c4 10             	add    $0x10,%esp
+ b58:	84 c0                	test   %al,%al
+ b5a:	75 e4                	jne    b40 <printf+0x120>
+      state = 0;
+ b5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b5f:	31 d2                	xor    %edx,%edx
+ b61:	e9 07 ff ff ff       	jmp    a6d <printf+0x4d>
+ b66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b73:	83 ec 0c             	sub    $0xc,%esp
+ b76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b7b:	8b 13                	mov    (%ebx),%edx
+ b7d:	6a 01                	push   $0x1
+ b7f:	e9 6b ff ff ff       	jmp    aef <printf+0xcf>
+ b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b8b:	83 ec 04             	sub    $0x4,%esp
+ b8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b99:	6a 01                	push   $0x1
+ b9b:	52                   	push   %edx
+ b9c:	57                   	push   %edi
+ b9d:	e8 7d fa ff ff       	call   61f <write>
+        ap++;
+ ba2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ba5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ba8:	31 d2                	xor    %edx,%edx
+ baa:	e9 be fe ff ff       	jmp    a6d <printf+0x4d>
+ baf:	90                   	nop
+  write(fd, &c, 1);
+ bb0:	83 ec 04             	sub    $0x4,%esp
+ bb3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bb6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bb9:	6a 01                	push   $0x1
+ bbb:	e9 11 ff ff ff       	jmp    ad1 <printf+0xb1>
+ bc0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bc5:	bb 09 0e 00 00       	mov    $0xe09,%ebx
+ bca:	e9 61 ff ff ff       	jmp    b30 <printf+0x110>
+ bcf:	90                   	nop
+
+00000bd0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bd0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd1:	a1 00 13 00 00       	mov    0x1300,%eax
+{
+ bd6:	89 e5                	mov    %esp,%ebp
+ bd8:	57                   	push   %edi
+ bd9:	56                   	push   %esi
+ bda:	53                   	push   %ebx
+ bdb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bde:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ be8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bec:	39 ca                	cmp    %ecx,%edx
+ bee:	73 30                	jae    c20 <free+0x50>
+ bf0:	39 c1                	cmp    %eax,%ecx
+ bf2:	72 04                	jb     bf8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf4:	39 c2                	cmp    %eax,%edx
+ bf6:	72 f0                	jb     be8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bf8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bfb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bfe:	39 f8                	cmp    %edi,%eax
+ c00:	74 2e                	je     c30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c05:	8b 42 04             	mov    0x4(%edx),%eax
+ c08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c0b:	39 f1                	cmp    %esi,%ecx
+ c0d:	74 38                	je     c47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c11:	5b                   	pop    %ebx
+  freep = p;
+ c12:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ c18:	5e                   	pop    %esi
+ c19:	5f                   	pop    %edi
+ c1a:	5d                   	pop    %ebp
+ c1b:	c3                   	ret
+ c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 d0                	jb     bf4 <free+0x24>
+ c24:	eb c2                	jmp    be8 <free+0x18>
+ c26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c30:	03 70 04             	add    0x4(%eax),%esi
+ c33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c36:	8b 02                	mov    (%edx),%eax
+ c38:	8b 00                	mov    (%eax),%eax
+ c3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c3d:	8b 42 04             	mov    0x4(%edx),%eax
+ c40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c43:	39 f1                	cmp    %esi,%ecx
+ c45:	75 c8                	jne    c0f <free+0x3f>
+    p->s.size += bp->s.size;
+ c47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c4a:	89 15 00 13 00 00    	mov    %edx,0x1300
+    p->s.size += bp->s.size;
+ c50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c56:	89 0a                	mov    %ecx,(%edx)
+}
+ c58:	5b                   	pop    %ebx
+ c59:	5e                   	pop    %esi
+ c5a:	5f                   	pop    %edi
+ c5b:	5d                   	pop    %ebp
+ c5c:	c3                   	ret
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c60:	55                   	push   %ebp
+ c61:	89 e5                	mov    %esp,%ebp
+ c63:	57                   	push   %edi
+ c64:	56                   	push   %esi
+ c65:	53                   	push   %ebx
+ c66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c6c:	8b 15 00 13 00 00    	mov    0x1300,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c72:	8d 78 07             	lea    0x7(%eax),%edi
+ c75:	c1 ef 03             	shr    $0x3,%edi
+ c78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c7b:	85 d2                	test   %edx,%edx
+ c7d:	0f 84 8d 00 00 00    	je     d10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c85:	8b 48 04             	mov    0x4(%eax),%ecx
+ c88:	39 f9                	cmp    %edi,%ecx
+ c8a:	73 64                	jae    cf0 <malloc+0x90>
+  if(nu < 4096)
+ c8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c91:	39 df                	cmp    %ebx,%edi
+ c93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c9d:	eb 0a                	jmp    ca9 <malloc+0x49>
+ c9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ca0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ca2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ca5:	39 f9                	cmp    %edi,%ecx
+ ca7:	73 47                	jae    cf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ca9:	89 c2                	mov    %eax,%edx
+ cab:	39 05 00 13 00 00    	cmp    %eax,0x1300
+ cb1:	75 ed                	jne    ca0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cb3:	83 ec 0c             	sub    $0xc,%esp
+ cb6:	56                   	push   %esi
+ cb7:	e8 b5 fa ff ff       	call   771 <sbrk>
+  if(p == (char*)-1)
+ cbc:	83 c4 10             	add    $0x10,%esp
+ cbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cc2:	74 1c                	je     ce0 <malloc+0x80>
+  hp->s.size = nu;
+ cc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cc7:	83 ec 0c             	sub    $0xc,%esp
+ cca:	83 c0 08             	add    $0x8,%eax
+ ccd:	50                   	push   %eax
+ cce:	e8 fd fe ff ff       	call   bd0 <free>
+  return freep;
+ cd3:	8b 15 00 13 00 00    	mov    0x1300,%edx
+      if((p = morecore(nunits)) == 0)
+ cd9:	83 c4 10             	add    $0x10,%esp
+ cdc:	85 d2                	test   %edx,%edx
+ cde:	75 c0                	jne    ca0 <malloc+0x40>
+        return 0;
+  }
+}
+ ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ce3:	31 c0                	xor    %eax,%eax
+}
+ ce5:	5b                   	pop    %ebx
+ ce6:	5e                   	pop    %esi
+ ce7:	5f                   	pop    %edi
+ ce8:	5d                   	pop    %ebp
+ ce9:	c3                   	ret
+ cea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cf0:	39 cf                	cmp    %ecx,%edi
+ cf2:	74 4c                	je     d40 <malloc+0xe0>
+        p->s.size -= nunits;
+ cf4:	29 f9                	sub    %edi,%ecx
+ cf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cff:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d08:	83 c0 08             	add    $0x8,%eax
+}
+ d0b:	5b                   	pop    %ebx
+ d0c:	5e                   	pop    %esi
+ d0d:	5f                   	pop    %edi
+ d0e:	5d                   	pop    %ebp
+ d0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d10:	c7 05 00 13 00 00 04 	movl   $0x1304,0x1300
+ d17:	13 00 00 
+    base.s.size = 0;
+ d1a:	b8 04 13 00 00       	mov    $0x1304,%eax
+    base.s.ptr = freep = prevp = &base;
+ d1f:	c7 05 04 13 00 00 04 	movl   $0x1304,0x1304
+ d26:	13 00 00 
+    base.s.size = 0;
+ d29:	c7 05 08 13 00 00 00 	movl   $0x0,0x1308
+ d30:	00 00 00 
+    if(p->s.size >= nunits){
+ d33:	e9 54 ff ff ff       	jmp    c8c <malloc+0x2c>
+ d38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d40:	8b 08                	mov    (%eax),%ecx
+ d42:	89 0a                	mov    %ecx,(%edx)
+ d44:	eb b9                	jmp    cff <malloc+0x9f>
+ d46:	66 90                	xchg   %ax,%ax
+ d48:	66 90                	xchg   %ax,%ax
+ d4a:	66 90                	xchg   %ax,%ax
+ d4c:	66 90                	xchg   %ax,%ax
+ d4e:	66 90                	xchg   %ax,%ax
+
+00000d50 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	53                   	push   %ebx
+ d54:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ d57:	68 00 20 00 00       	push   $0x2000
+ d5c:	e8 ff fe ff ff       	call   c60 <malloc>
+ d61:	83 c4 10             	add    $0x10,%esp
+ d64:	85 c0                	test   %eax,%eax
+ d66:	74 47                	je     daf <thread_create+0x5f>
+ d68:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d6a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ d70:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d73:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ d78:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ d7b:	ff 75 0c             	push   0xc(%ebp)
+ d7e:	50                   	push   %eax
+ d7f:	ff 75 08             	push   0x8(%ebp)
+ d82:	e8 6c fa ff ff       	call   7f3 <clone>
+ d87:	83 c4 10             	add    $0x10,%esp
+ d8a:	85 c0                	test   %eax,%eax
+ d8c:	78 0a                	js     d98 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ d8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d91:	c9                   	leave
+ d92:	c3                   	ret
+ d93:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d97:	90                   	nop
+    free(mem);
+ d98:	83 ec 0c             	sub    $0xc,%esp
+ d9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d9e:	53                   	push   %ebx
+ d9f:	e8 2c fe ff ff       	call   bd0 <free>
+ da4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ daa:	83 c4 10             	add    $0x10,%esp
+}
+ dad:	c9                   	leave
+ dae:	c3                   	ret
+    return -1;
+ daf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ db4:	eb d8                	jmp    d8e <thread_create+0x3e>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dc0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ dc4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ dc7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ dca:	50                   	push   %eax
+ dcb:	e8 3d fa ff ff       	call   80d <join>
+ dd0:	83 c4 10             	add    $0x10,%esp
+ dd3:	85 c0                	test   %eax,%eax
+ dd5:	78 21                	js     df8 <thread_join+0x38>
+ dd7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ dd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ddc:	83 ec 0c             	sub    $0xc,%esp
+ ddf:	ff 70 fc             	push   -0x4(%eax)
+ de2:	e8 e9 fd ff ff       	call   bd0 <free>
+  return pid;
+ de7:	83 c4 10             	add    $0x10,%esp
+}
+ dea:	89 d8                	mov    %ebx,%eax
+ dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ def:	c9                   	leave
+ df0:	c3                   	ret
+ df1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ df8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ dfd:	eb eb                	jmp    dea <thread_join+0x2a>
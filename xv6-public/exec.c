@@ -6,17 +6,211 @@
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "vm.h"
+#include "spinlock.h"
+#include "fs.h"
+#include "sleeplock.h"
+#include "file.h"
+
+// Exec image cache.
+//
+// Keeps the loaded pages of recently exec'd binaries so that running
+// the same program again (sh running cat or ls in a loop, the test
+// harness) copies the image from memory instead of re-parsing the
+// ELF header and re-reading every segment through readi().
+//
+// Entries are keyed by device and inode number.  xv6 inodes carry no
+// generation number, so instead every path that can change what an
+// inode number refers to (writei, itrunc, ialloc, unlink) calls
+// excacheinval() to drop the entry.  Callers of excacheload() hold
+// the inode lock, which writers also hold, so an entry cannot be
+// invalidated while it is being copied; eviction skips entries
+// with ref > 0.
+
+#define NEXECSEG 4   // max loadable segments in a cached image
+
+struct excache {
+  uint dev;
+  uint inum;
+  int ref;                      // execs copying from this entry
+  int stale;                    // invalidated while ref > 0
+  uint lastuse;                 // for LRU eviction
+  uint entry;                   // ELF entry point
+  int nseg;
+  struct {
+    uint vaddr;
+    uint memsz;
+  } seg[NEXECSEG];              // loadable segments, in file order
+  char *pages[EXECCACHEPGS];    // copy of each user page below sz
+};
+
+struct {
+  struct spinlock lock;
+  uint clock;
+  struct excache ent[NEXECCACHE];
+} excache;
+
+void
+excacheinit(void)
+{
+  initlock(&excache.lock, "excache");
+}
+
+// Free the pages of entry e and mark it unused.
+// Caller must hold excache.lock.
+static void
+excachefree(struct excache *e)
+{
+  int i;
+
+  for(i = 0; i < EXECCACHEPGS; i++){
+    if(e->pages[i]){
+      kfree(e->pages[i]);
+      e->pages[i] = 0;
+    }
+  }
+  e->dev = 0;
+  e->inum = 0;
+  e->stale = 0;
+  e->nseg = 0;
+}
+
+// Drop any cached image of inode inum on dev.
+void
+excacheinval(uint dev, uint inum)
+{
+  struct excache *e;
+
+  acquire(&excache.lock);
+  for(e = excache.ent; e < &excache.ent[NEXECCACHE]; e++){
+    if(e->inum == inum && e->dev == dev){
+      if(e->ref > 0)
+        e->stale = 1;
+      else
+        excachefree(e);
+    }
+  }
+  release(&excache.lock);
+}
+
+// Build the user part of pgdir from the cached image of ip.
+// Returns the image size, 0 if ip is not cached, or -1 if
+// memory could not be allocated.  Caller must hold ip->lock.
+static int
+excacheload(struct inode *ip, pde_t *pgdir, uint *entry)
+{
+  struct excache *e;
+  pte_t *pte;
+  uint sz;
+  int i;
+
+  acquire(&excache.lock);
+  for(e = excache.ent; e < &excache.ent[NEXECCACHE]; e++)
+    if(e->inum == ip->inum && e->dev == ip->dev && !e->stale)
+      break;
+  if(e == &excache.ent[NEXECCACHE]){
+    release(&excache.lock);
+    return 0;
+  }
+  e->ref++;
+  release(&excache.lock);
+
+  sz = 0;
+  for(i = 0; i < e->nseg; i++){
+    if((sz = allocuvm(pgdir, sz, e->seg[i].vaddr + e->seg[i].memsz)) == 0)
+      break;
+  }
+  if(sz != 0){
+    for(i = 0; i < EXECCACHEPGS; i++){
+      if(e->pages[i] == 0)
+        continue;
+      if((pte = walkpgdir(pgdir, (char*)(i*PGSIZE), 0)) == 0 ||
+         (*pte & PTE_P) == 0)
+        panic("excacheload");
+      memmove(P2V(PTE_ADDR(*pte)), e->pages[i], PGSIZE);
+    }
+    *entry = e->entry;
+  }
+
+  acquire(&excache.lock);
+  e->lastuse = ++excache.clock;
+  if(--e->ref == 0 && e->stale)
+    excachefree(e);
+  release(&excache.lock);
+  return sz == 0 ? -1 : sz;
+}
+
+// Remember the freshly loaded image in pgdir for later execs of ip.
+// Images that are too large, or that need more memory than is
+// free right now, are simply not cached.  Caller must hold ip->lock.
+static void
+excachefill(struct inode *ip, pde_t *pgdir, struct elfhdr *elf,
+            struct proghdr *segs, int nseg, uint sz)
+{
+  struct excache *e, *victim;
+  char *pages[EXECCACHEPGS];
+  pte_t *pte;
+  int i, npg;
+
+  npg = PGROUNDUP(sz) / PGSIZE;
+  if(nseg == 0 || nseg > NEXECSEG || npg > EXECCACHEPGS)
+    return;
+  memset(pages, 0, sizeof(pages));
+  for(i = 0; i < npg; i++){
+    pte = walkpgdir(pgdir, (char*)(i*PGSIZE), 0);
+    if(pte == 0 || (*pte & PTE_P) == 0)
+      continue;
+    if((pages[i] = kalloc()) == 0)
+      goto bad;
+    memmove(pages[i], P2V(PTE_ADDR(*pte)), PGSIZE);
+  }
+
+  acquire(&excache.lock);
+  victim = 0;
+  for(e = excache.ent; e < &excache.ent[NEXECCACHE]; e++){
+    if(e->ref > 0)
+      continue;
+    if(e->inum == 0){
+      victim = e;
+      break;
+    }
+    if(victim == 0 || e->lastuse < victim->lastuse)
+      victim = e;
+  }
+  if(victim == 0){
+    release(&excache.lock);
+    goto bad;
+  }
+  excachefree(victim);
+  victim->dev = ip->dev;
+  victim->inum = ip->inum;
+  victim->lastuse = ++excache.clock;
+  victim->entry = elf->entry;
+  victim->nseg = nseg;
+  for(i = 0; i < nseg; i++){
+    victim->seg[i].vaddr = segs[i].vaddr;
+    victim->seg[i].memsz = segs[i].memsz;
+  }
+  memmove(victim->pages, pages, sizeof(pages));
+  release(&excache.lock);
+  return;
+
+bad:
+  for(i = 0; i < npg; i++)
+    if(pages[i])
+      kfree(pages[i]);
+}
 
 int
 exec(char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, nseg, csz;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
-  struct proghdr ph;
-  pde_t *pgdir, *oldpgdir;
+  struct proghdr ph, segs[NEXECSEG];
+  pde_t *pgdir;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -29,17 +223,26 @@ exec(char *path, char **argv)
   ilock(ip);
   pgdir = 0;
 
+  if((pgdir = setupkvm()) == 0)
+    goto bad;
+
+  // Copy the image from the exec cache if we have it.
+  if((csz = excacheload(ip, pgdir, &elf.entry)) < 0)
+    goto bad;
+  if(csz > 0){
+    sz = csz;
+    goto loaded;
+  }
+
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
     goto bad;
   if(elf.magic != ELF_MAGIC)
     goto bad;
 
-  if((pgdir = setupkvm()) == 0)
-    goto bad;
-
   // Load program into memory.
   sz = 0;
+  nseg = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -55,7 +258,13 @@ exec(char *path, char **argv)
       goto bad;
     if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
       goto bad;
+    if(nseg < NEXECSEG)
+      segs[nseg] = ph;
+    nseg++;
   }
+  excachefill(ip, pgdir, &elf, segs, nseg, sz);
+
+loaded:
   iunlockput(ip);
   end_op();
   ip = 0;
@@ -93,14 +302,15 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
+  if(vdsomap(pgdir, curproc->pid) < 0)
+    goto bad;
+
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
+  if(vmspaceexec(pgdir) < 0)
+    goto bad;
   curproc->sz = sz;
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
   return 0;
 
  bad:
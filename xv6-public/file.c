@@ -12,32 +12,38 @@
 
 struct devsw devsw[NDEV];
 struct {
-  struct spinlock lock;
-  struct file file[NFILE];
+  struct spinlock lock;    // protects ref of every file, and nfile
+  struct kmem_cache *cache;
+  int nfile;               // files allocated, at most NFILE
 } ftable;
 
 void
 fileinit(void)
 {
   initlock(&ftable.lock, "ftable");
+  ftable.cache = kmem_cache_create("file", sizeof(struct file), 0);
 }
 
 // Allocate a file structure.
+// Returns 0 if NFILE files are open or memory is exhausted.
 struct file*
 filealloc(void)
 {
   struct file *f;
 
+  if((f = kmem_cache_alloc(ftable.cache)) == 0)
+    return 0;
   acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
+  if(ftable.nfile == NFILE){
+    release(&ftable.lock);
+    kmem_cache_free(ftable.cache, f);
+    return 0;
   }
+  ftable.nfile++;
   release(&ftable.lock);
-  return 0;
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
@@ -68,7 +74,9 @@ fileclose(struct file *f)
   ff = *f;
   f->ref = 0;
   f->type = FD_NONE;
+  ftable.nfile--;
   release(&ftable.lock);
+  kmem_cache_free(ftable.cache, f);
 
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -155,3 +163,44 @@ filewrite(struct file *f, char *addr, int n)
   panic("filewrite");
 }
 
+// Read n bytes at offset off of inode file f into addr, without
+// using or moving f->off.  For asynchronous I/O (see aio.c).
+int
+filereadat(struct file *f, char *addr, int n, uint off)
+{
+  int r;
+
+  if(f->readable == 0 || f->type != FD_INODE)
+    return -1;
+  ilock(f->ip);
+  r = readi(f->ip, addr, off, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Write n bytes from addr at offset off of inode file f, a few
+// blocks per transaction as in filewrite(), without using or
+// moving f->off.
+int
+filewriteat(struct file *f, char *addr, int n, uint off)
+{
+  int r, i, n1;
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+
+  if(f->writable == 0 || f->type != FD_INODE)
+    return -1;
+  r = 0;
+  for(i = 0; i < n; i += r){
+    n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+    begin_op();
+    ilock(f->ip);
+    r = writei(f->ip, addr + i, off + i, n1);
+    iunlock(f->ip);
+    end_op();
+    if(r != n1)
+      break;
+  }
+  return i == n ? n : -1;
+}
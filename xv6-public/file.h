@@ -14,6 +14,8 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *prev; // icache LRU list; protected by icache.lock
+  struct inode *next;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
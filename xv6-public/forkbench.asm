@@ -0,0 +1,2128 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+#define N  200
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 39                	mov    (%ecx),%edi
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int i, j, n, nworkers, pid, start, elapsed;
+
+  nworkers = 4;
+  n = N;
+  if(argc > 1)
+  19:	83 ff 01             	cmp    $0x1,%edi
+  1c:	0f 8f a0 00 00 00    	jg     c2 <main+0xc2>
+    nworkers = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+
+  // Give each fork something to copy.
+  if(sbrk(16*4096) == (char*)-1){
+  22:	83 ec 0c             	sub    $0xc,%esp
+  25:	68 00 00 01 00       	push   $0x10000
+  2a:	e8 32 08 00 00       	call   861 <sbrk>
+  2f:	83 c4 10             	add    $0x10,%esp
+  32:	83 c0 01             	add    $0x1,%eax
+  35:	74 78                	je     af <main+0xaf>
+    printf(2, "forkbench: sbrk failed\n");
+    exit();
+  }
+
+  start = uptime();
+  37:	e8 59 08 00 00       	call   895 <uptime>
+  n = N;
+  3c:	c7 45 e4 c8 00 00 00 	movl   $0xc8,-0x1c(%ebp)
+  nworkers = 4;
+  43:	bb 04 00 00 00       	mov    $0x4,%ebx
+  start = uptime();
+  48:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  n = N;
+  4b:	31 f6                	xor    %esi,%esi
+  4d:	eb 0e                	jmp    5d <main+0x5d>
+  4f:	90                   	nop
+    pid = fork();
+    if(pid < 0){
+      printf(2, "forkbench: fork failed\n");
+      break;
+    }
+    if(pid == 0){
+  50:	0f 84 c3 00 00 00    	je     119 <main+0x119>
+  for(i = 0; i < nworkers; i++){
+  56:	83 c6 01             	add    $0x1,%esi
+  59:	39 de                	cmp    %ebx,%esi
+  5b:	74 23                	je     80 <main+0x80>
+    pid = fork();
+  5d:	e8 2b 06 00 00       	call   68d <fork>
+  62:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+  64:	85 c0                	test   %eax,%eax
+  66:	79 e8                	jns    50 <main+0x50>
+      printf(2, "forkbench: fork failed\n");
+  68:	52                   	push   %edx
+  69:	52                   	push   %edx
+  6a:	68 08 0f 00 00       	push   $0xf08
+  6f:	6a 02                	push   $0x2
+  71:	e8 9a 0a 00 00       	call   b10 <printf>
+      break;
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        wait();
+      }
+      exit();
+    }
+  }
+  while(wait() >= 0)
+  80:	e8 3c 06 00 00       	call   6c1 <wait>
+  85:	85 c0                	test   %eax,%eax
+  87:	79 f7                	jns    80 <main+0x80>
+    ;
+  elapsed = uptime() - start;
+  89:	e8 07 08 00 00       	call   895 <uptime>
+  8e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+
+  printf(1, "forkbench: %d workers x %d forks in %d ticks\n",
+  91:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+  94:	29 d0                	sub    %edx,%eax
+  printf(1, "forkbench: %d workers x %d forks in %d ticks\n",
+  96:	50                   	push   %eax
+  97:	ff 75 e4             	push   -0x1c(%ebp)
+  9a:	53                   	push   %ebx
+  9b:	68 20 0f 00 00       	push   $0xf20
+  a0:	6a 01                	push   $0x1
+  a2:	e8 69 0a 00 00       	call   b10 <printf>
+         nworkers, n, elapsed);
+  exit();
+  a7:	83 c4 20             	add    $0x20,%esp
+  aa:	e8 f8 05 00 00       	call   6a7 <exit>
+    printf(2, "forkbench: sbrk failed\n");
+  af:	51                   	push   %ecx
+  b0:	51                   	push   %ecx
+  b1:	68 f0 0e 00 00       	push   $0xef0
+  b6:	6a 02                	push   $0x2
+  b8:	e8 53 0a 00 00       	call   b10 <printf>
+    exit();
+  bd:	e8 e5 05 00 00       	call   6a7 <exit>
+    nworkers = atoi(argv[1]);
+  c2:	83 ec 0c             	sub    $0xc,%esp
+  c5:	ff 76 04             	push   0x4(%esi)
+  c8:	e8 63 02 00 00       	call   330 <atoi>
+  n = N;
+  cd:	c7 45 e4 c8 00 00 00 	movl   $0xc8,-0x1c(%ebp)
+  if(argc > 2)
+  d4:	83 c4 10             	add    $0x10,%esp
+    nworkers = atoi(argv[1]);
+  d7:	89 c3                	mov    %eax,%ebx
+  if(argc > 2)
+  d9:	83 ff 02             	cmp    $0x2,%edi
+  dc:	74 11                	je     ef <main+0xef>
+    n = atoi(argv[2]);
+  de:	83 ec 0c             	sub    $0xc,%esp
+  e1:	ff 76 08             	push   0x8(%esi)
+  e4:	e8 47 02 00 00       	call   330 <atoi>
+  e9:	83 c4 10             	add    $0x10,%esp
+  ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sbrk(16*4096) == (char*)-1){
+  ef:	83 ec 0c             	sub    $0xc,%esp
+  f2:	68 00 00 01 00       	push   $0x10000
+  f7:	e8 65 07 00 00       	call   861 <sbrk>
+  fc:	83 c4 10             	add    $0x10,%esp
+  ff:	83 c0 01             	add    $0x1,%eax
+ 102:	74 ab                	je     af <main+0xaf>
+  start = uptime();
+ 104:	e8 8c 07 00 00       	call   895 <uptime>
+ 109:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < nworkers; i++){
+ 10c:	85 db                	test   %ebx,%ebx
+ 10e:	0f 8f 37 ff ff ff    	jg     4b <main+0x4b>
+ 114:	e9 67 ff ff ff       	jmp    80 <main+0x80>
+      for(j = 0; j < n; j++){
+ 119:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 11d:	7f 1e                	jg     13d <main+0x13d>
+ 11f:	eb 89                	jmp    aa <main+0xaa>
+ 121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+        if(pid == 0)
+ 128:	74 80                	je     aa <main+0xaa>
+        wait();
+ 12a:	e8 92 05 00 00       	call   6c1 <wait>
+      for(j = 0; j < n; j++){
+ 12f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 132:	83 c7 01             	add    $0x1,%edi
+ 135:	39 c7                	cmp    %eax,%edi
+ 137:	0f 84 6d ff ff ff    	je     aa <main+0xaa>
+        pid = fork();
+ 13d:	e8 4b 05 00 00       	call   68d <fork>
+        if(pid < 0){
+ 142:	85 c0                	test   %eax,%eax
+ 144:	79 e2                	jns    128 <main+0x128>
+          printf(2, "forkbench: fork failed\n");
+ 146:	50                   	push   %eax
+ 147:	50                   	push   %eax
+ 148:	68 08 0f 00 00       	push   $0xf08
+ 14d:	6a 02                	push   $0x2
+ 14f:	e8 bc 09 00 00       	call   b10 <printf>
+          break;
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	e9 4e ff ff ff       	jmp    aa <main+0xaa>
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 160:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 161:	31 c0                	xor    %eax,%eax
+{
+ 163:	89 e5                	mov    %esp,%ebp
+ 165:	53                   	push   %ebx
+ 166:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 169:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 16c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 170:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 174:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 177:	83 c0 01             	add    $0x1,%eax
+ 17a:	84 d2                	test   %dl,%dl
+ 17c:	75 f2                	jne    170 <strcpy+0x10>
+    ;
+  return os;
+}
+ 17e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 181:	89 c8                	mov    %ecx,%eax
+ 183:	c9                   	leave
+ 184:	c3                   	ret
+ 185:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	53                   	push   %ebx
+ 194:	8b 55 08             	mov    0x8(%ebp),%edx
+ 197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 19a:	0f b6 02             	movzbl (%edx),%eax
+ 19d:	84 c0                	test   %al,%al
+ 19f:	75 17                	jne    1b8 <strcmp+0x28>
+ 1a1:	eb 3a                	jmp    1dd <strcmp+0x4d>
+ 1a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1a7:	90                   	nop
+ 1a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1ac:	83 c2 01             	add    $0x1,%edx
+ 1af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1b2:	84 c0                	test   %al,%al
+ 1b4:	74 1a                	je     1d0 <strcmp+0x40>
+    p++, q++;
+ 1b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1bb:	38 c3                	cmp    %al,%bl
+ 1bd:	74 e9                	je     1a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1bf:	29 d8                	sub    %ebx,%eax
+}
+ 1c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1c4:	c9                   	leave
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1d4:	31 c0                	xor    %eax,%eax
+ 1d6:	29 d8                	sub    %ebx,%eax
+}
+ 1d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 1e0:	31 c0                	xor    %eax,%eax
+ 1e2:	eb db                	jmp    1bf <strcmp+0x2f>
+ 1e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1f9:	74 15                	je     210 <strlen+0x20>
+ 1fb:	31 c0                	xor    %eax,%eax
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 200:	83 c0 01             	add    $0x1,%eax
+ 203:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 207:	89 c1                	mov    %eax,%ecx
+ 209:	75 f5                	jne    200 <strlen+0x10>
+    ;
+  return n;
+}
+ 20b:	89 c8                	mov    %ecx,%eax
+ 20d:	5d                   	pop    %ebp
+ 20e:	c3                   	ret
+ 20f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 210:	31 c9                	xor    %ecx,%ecx
+}
+ 212:	5d                   	pop    %ebp
+ 213:	89 c8                	mov    %ecx,%eax
+ 215:	c3                   	ret
+ 216:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	57                   	push   %edi
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 227:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	89 d7                	mov    %edx,%edi
+ 22f:	fc                   	cld
+ 230:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 232:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 235:	89 d0                	mov    %edx,%eax
+ 237:	c9                   	leave
+ 238:	c3                   	ret
+ 239:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 24a:	0f b6 10             	movzbl (%eax),%edx
+ 24d:	84 d2                	test   %dl,%dl
+ 24f:	75 12                	jne    263 <strchr+0x23>
+ 251:	eb 1d                	jmp    270 <strchr+0x30>
+ 253:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 257:	90                   	nop
+ 258:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 25c:	83 c0 01             	add    $0x1,%eax
+ 25f:	84 d2                	test   %dl,%dl
+ 261:	74 0d                	je     270 <strchr+0x30>
+    if(*s == c)
+ 263:	38 d1                	cmp    %dl,%cl
+ 265:	75 f1                	jne    258 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 267:	5d                   	pop    %ebp
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 270:	31 c0                	xor    %eax,%eax
+}
+ 272:	5d                   	pop    %ebp
+ 273:	c3                   	ret
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 285:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 288:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 289:	31 db                	xor    %ebx,%ebx
+{
+ 28b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 28e:	eb 27                	jmp    2b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	6a 01                	push   $0x1
+ 295:	56                   	push   %esi
+ 296:	6a 00                	push   $0x0
+ 298:	e8 58 04 00 00       	call   6f5 <read>
+    if(cc < 1)
+ 29d:	83 c4 10             	add    $0x10,%esp
+ 2a0:	85 c0                	test   %eax,%eax
+ 2a2:	7e 1d                	jle    2c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2af:	3c 0a                	cmp    $0xa,%al
+ 2b1:	74 10                	je     2c3 <gets+0x43>
+ 2b3:	3c 0d                	cmp    $0xd,%al
+ 2b5:	74 0c                	je     2c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2b7:	89 df                	mov    %ebx,%edi
+ 2b9:	83 c3 01             	add    $0x1,%ebx
+ 2bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2bf:	7c cf                	jl     290 <gets+0x10>
+ 2c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2cd:	5b                   	pop    %ebx
+ 2ce:	5e                   	pop    %esi
+ 2cf:	5f                   	pop    %edi
+ 2d0:	5d                   	pop    %ebp
+ 2d1:	c3                   	ret
+ 2d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	56                   	push   %esi
+ 2e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2e5:	83 ec 08             	sub    $0x8,%esp
+ 2e8:	6a 00                	push   $0x0
+ 2ea:	ff 75 08             	push   0x8(%ebp)
+ 2ed:	e8 85 04 00 00       	call   777 <open>
+  if(fd < 0)
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	78 27                	js     320 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2f9:	83 ec 08             	sub    $0x8,%esp
+ 2fc:	ff 75 0c             	push   0xc(%ebp)
+ 2ff:	89 c3                	mov    %eax,%ebx
+ 301:	50                   	push   %eax
+ 302:	e8 be 04 00 00       	call   7c5 <fstat>
+  close(fd);
+ 307:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 30a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 30c:	e8 18 04 00 00       	call   729 <close>
+  return r;
+ 311:	83 c4 10             	add    $0x10,%esp
+}
+ 314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 317:	89 f0                	mov    %esi,%eax
+ 319:	5b                   	pop    %ebx
+ 31a:	5e                   	pop    %esi
+ 31b:	5d                   	pop    %ebp
+ 31c:	c3                   	ret
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 320:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 325:	eb ed                	jmp    314 <stat+0x34>
+ 327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32e:	66 90                	xchg   %ax,%ax
+
+00000330 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	53                   	push   %ebx
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 337:	0f be 02             	movsbl (%edx),%eax
+ 33a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 33d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 345:	77 1e                	ja     365 <atoi+0x35>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 350:	83 c2 01             	add    $0x1,%edx
+ 353:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 356:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 35a:	0f be 02             	movsbl (%edx),%eax
+ 35d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 360:	80 fb 09             	cmp    $0x9,%bl
+ 363:	76 eb                	jbe    350 <atoi+0x20>
+  return n;
+}
+ 365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 368:	89 c8                	mov    %ecx,%eax
+ 36a:	c9                   	leave
+ 36b:	c3                   	ret
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+ 375:	8b 45 10             	mov    0x10(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 37e:	85 c0                	test   %eax,%eax
+ 380:	7e 13                	jle    395 <memmove+0x25>
+ 382:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 384:	89 d7                	mov    %edx,%edi
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 390:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 391:	39 f8                	cmp    %edi,%eax
+ 393:	75 fb                	jne    390 <memmove+0x20>
+  return vdst;
+}
+ 395:	5e                   	pop    %esi
+ 396:	89 d0                	mov    %edx,%eax
+ 398:	5f                   	pop    %edi
+ 399:	5d                   	pop    %ebp
+ 39a:	c3                   	ret
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ac:	5d                   	pop    %ebp
+ 3ad:	c3                   	ret
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3b0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3b1:	31 c0                	xor    %eax,%eax
+ 3b3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3b8:	89 e5                	mov    %esp,%ebp
+ 3ba:	56                   	push   %esi
+ 3bb:	53                   	push   %ebx
+ 3bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3c3:	85 c0                	test   %eax,%eax
+ 3c5:	74 32                	je     3f9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 3c7:	83 f8 02             	cmp    $0x2,%eax
+ 3ca:	74 0c                	je     3d8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 3d4:	85 c0                	test   %eax,%eax
+ 3d6:	74 21                	je     3f9 <mutex_lock+0x49>
+ 3d8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 02                	push   $0x2
+ 3e5:	6a 00                	push   $0x0
+ 3e7:	53                   	push   %ebx
+ 3e8:	e8 2a 05 00 00       	call   917 <futex>
+ 3ed:	89 f0                	mov    %esi,%eax
+ 3ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	75 e7                	jne    3e0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 3f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3fc:	5b                   	pop    %ebx
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5d                   	pop    %ebp
+ 3ff:	c3                   	ret
+
+00000400 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 400:	55                   	push   %ebp
+ 401:	31 c0                	xor    %eax,%eax
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 40e:	83 f8 02             	cmp    $0x2,%eax
+ 411:	74 05                	je     418 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 418:	83 ec 04             	sub    $0x4,%esp
+ 41b:	6a 01                	push   $0x1
+ 41d:	6a 01                	push   $0x1
+ 41f:	52                   	push   %edx
+ 420:	e8 f2 04 00 00       	call   917 <futex>
+ 425:	83 c4 10             	add    $0x10,%esp
+}
+ 428:	c9                   	leave
+ 429:	c3                   	ret
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 440:	55                   	push   %ebp
+ 441:	31 c0                	xor    %eax,%eax
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	57                   	push   %edi
+ 446:	56                   	push   %esi
+ 447:	53                   	push   %ebx
+ 448:	83 ec 0c             	sub    $0xc,%esp
+ 44b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 44e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 451:	8b 3e                	mov    (%esi),%edi
+ 453:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 456:	83 f8 02             	cmp    $0x2,%eax
+ 459:	74 5d                	je     4b8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	57                   	push   %edi
+ 45f:	6a 00                	push   $0x0
+ 461:	56                   	push   %esi
+ 462:	e8 b0 04 00 00       	call   917 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 467:	31 c0                	xor    %eax,%eax
+ 469:	ba 01 00 00 00       	mov    $0x1,%edx
+ 46e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	74 30                	je     4a9 <cond_wait+0x69>
+  if(c != 2)
+ 479:	83 f8 02             	cmp    $0x2,%eax
+ 47c:	74 0c                	je     48a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 47e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 483:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 486:	85 c0                	test   %eax,%eax
+ 488:	74 1f                	je     4a9 <cond_wait+0x69>
+ 48a:	be 02 00 00 00       	mov    $0x2,%esi
+ 48f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 490:	83 ec 04             	sub    $0x4,%esp
+ 493:	6a 02                	push   $0x2
+ 495:	6a 00                	push   $0x0
+ 497:	53                   	push   %ebx
+ 498:	e8 7a 04 00 00       	call   917 <futex>
+ 49d:	89 f0                	mov    %esi,%eax
+ 49f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 4a2:	83 c4 10             	add    $0x10,%esp
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	75 e7                	jne    490 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 4a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ac:	5b                   	pop    %ebx
+ 4ad:	5e                   	pop    %esi
+ 4ae:	5f                   	pop    %edi
+ 4af:	5d                   	pop    %ebp
+ 4b0:	c3                   	ret
+ 4b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4b8:	83 ec 04             	sub    $0x4,%esp
+ 4bb:	6a 01                	push   $0x1
+ 4bd:	6a 01                	push   $0x1
+ 4bf:	53                   	push   %ebx
+ 4c0:	e8 52 04 00 00       	call   917 <futex>
+ 4c5:	83 c4 10             	add    $0x10,%esp
+ 4c8:	eb 91                	jmp    45b <cond_wait+0x1b>
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	83 ec 04             	sub    $0x4,%esp
+ 4d7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4e0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4e2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 4e5:	89 c8                	mov    %ecx,%eax
+ 4e7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4eb:	39 c1                	cmp    %eax,%ecx
+ 4ed:	75 f1                	jne    4e0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4ef:	83 ec 04             	sub    $0x4,%esp
+ 4f2:	6a 01                	push   $0x1
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	52                   	push   %edx
+ 4f7:	e8 1b 04 00 00       	call   917 <futex>
+}
+ 4fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ff:	83 c4 10             	add    $0x10,%esp
+ 502:	c9                   	leave
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	83 ec 04             	sub    $0x4,%esp
+ 517:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 520:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 522:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 525:	89 c8                	mov    %ecx,%eax
+ 527:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 52b:	39 c1                	cmp    %eax,%ecx
+ 52d:	75 f1                	jne    520 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 52f:	83 ec 04             	sub    $0x4,%esp
+ 532:	6a 40                	push   $0x40
+ 534:	6a 01                	push   $0x1
+ 536:	52                   	push   %edx
+ 537:	e8 db 03 00 00       	call   917 <futex>
+}
+ 53c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 53f:	83 c4 10             	add    $0x10,%esp
+ 542:	c9                   	leave
+ 543:	c3                   	ret
+ 544:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 54f:	90                   	nop
+
+00000550 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 550:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 555:	c3                   	ret
+ 556:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000560 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 560:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 565:	85 c0                	test   %eax,%eax
+ 567:	74 07                	je     570 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 569:	c3                   	ret
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 570:	e9 d2 02 00 00       	jmp    847 <getpid>
+ 575:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 589:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 58b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 591:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 597:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 59c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5a2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 5a5:	89 d0                	mov    %edx,%eax
+ 5a7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 5aa:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5b0:	29 d9                	sub    %ebx,%ecx
+ 5b2:	89 c6                	mov    %eax,%esi
+ 5b4:	89 d7                	mov    %edx,%edi
+ 5b6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5b9:	d3 e6                	shl    %cl,%esi
+ 5bb:	31 c0                	xor    %eax,%eax
+ 5bd:	f6 c1 20             	test   $0x20,%cl
+ 5c0:	0f 45 fe             	cmovne %esi,%edi
+ 5c3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5c9:	89 d9                	mov    %ebx,%ecx
+ 5cb:	31 db                	xor    %ebx,%ebx
+ 5cd:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5d3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5d6:	d3 ea                	shr    %cl,%edx
+ 5d8:	f6 c1 20             	test   $0x20,%cl
+ 5db:	0f 45 c2             	cmovne %edx,%eax
+ 5de:	0f 45 d3             	cmovne %ebx,%edx
+ 5e1:	01 f0                	add    %esi,%eax
+ 5e3:	11 fa                	adc    %edi,%edx
+}
+ 5e5:	83 c4 0c             	add    $0xc,%esp
+ 5e8:	5b                   	pop    %ebx
+ 5e9:	5e                   	pop    %esi
+ 5ea:	5f                   	pop    %edi
+ 5eb:	5d                   	pop    %ebp
+ 5ec:	c3                   	ret
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005f0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 5f9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 600:	74 0e                	je     610 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 602:	83 c4 1c             	add    $0x1c,%esp
+ 605:	5b                   	pop    %ebx
+ 606:	5e                   	pop    %esi
+ 607:	5f                   	pop    %edi
+ 608:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 609:	e9 a5 03 00 00       	jmp    9b3 <clock_gettime>
+ 60e:	66 90                	xchg   %ax,%ax
+ 610:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 612:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 618:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 61e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 623:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 626:	89 d0                	mov    %edx,%eax
+ 628:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 62b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 631:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 637:	89 c6                	mov    %eax,%esi
+ 639:	89 d7                	mov    %edx,%edi
+ 63b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 63e:	d3 e6                	shl    %cl,%esi
+ 640:	31 c0                	xor    %eax,%eax
+ 642:	f6 c1 20             	test   $0x20,%cl
+ 645:	0f 45 fe             	cmovne %esi,%edi
+ 648:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 64b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 64e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 655:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 65b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 65e:	d3 ea                	shr    %cl,%edx
+ 660:	f6 c1 20             	test   $0x20,%cl
+ 663:	74 04                	je     669 <vclock_gettime+0x79>
+ 665:	89 d0                	mov    %edx,%eax
+ 667:	31 d2                	xor    %edx,%edx
+ 669:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 66b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 670:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 672:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 674:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 676:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 678:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 67e:	29 c1                	sub    %eax,%ecx
+}
+ 680:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 682:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 685:	83 c4 1c             	add    $0x1c,%esp
+ 688:	5b                   	pop    %ebx
+ 689:	5e                   	pop    %esi
+ 68a:	5f                   	pop    %edi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+
+0000068d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 68d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 692:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 699:	74 09                	je     6a4 <fork+0x17>
+ 69b:	89 e1                	mov    %esp,%ecx
+ 69d:	ba a6 06 00 00       	mov    $0x6a6,%edx
+ 6a2:	0f 34                	sysenter
+ 6a4:	cd 40                	int    $0x40
+ 6a6:	c3                   	ret
+
+000006a7 <exit>:
+SYSCALL(exit)
+ 6a7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6ac:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6b3:	74 09                	je     6be <exit+0x17>
+ 6b5:	89 e1                	mov    %esp,%ecx
+ 6b7:	ba c0 06 00 00       	mov    $0x6c0,%edx
+ 6bc:	0f 34                	sysenter
+ 6be:	cd 40                	int    $0x40
+ 6c0:	c3                   	ret
+
+000006c1 <wait>:
+SYSCALL(wait)
+ 6c1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6c6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6cd:	74 09                	je     6d8 <wait+0x17>
+ 6cf:	89 e1                	mov    %esp,%ecx
+ 6d1:	ba da 06 00 00       	mov    $0x6da,%edx
+ 6d6:	0f 34                	sysenter
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <pipe>:
+SYSCALL(pipe)
+ 6db:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6e0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6e7:	74 09                	je     6f2 <pipe+0x17>
+ 6e9:	89 e1                	mov    %esp,%ecx
+ 6eb:	ba f4 06 00 00       	mov    $0x6f4,%edx
+ 6f0:	0f 34                	sysenter
+ 6f2:	cd 40                	int    $0x40
+ 6f4:	c3                   	ret
+
+000006f5 <read>:
+SYSCALL(read)
+ 6f5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6fa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 701:	74 09                	je     70c <read+0x17>
+ 703:	89 e1                	mov    %esp,%ecx
+ 705:	ba 0e 07 00 00       	mov    $0x70e,%edx
+ 70a:	0f 34                	sysenter
+ 70c:	cd 40                	int    $0x40
+ 70e:	c3                   	ret
+
+0000070f <write>:
+SYSCALL(write)
+ 70f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 714:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 71b:	74 09                	je     726 <write+0x17>
+ 71d:	89 e1                	mov    %esp,%ecx
+ 71f:	ba 28 07 00 00       	mov    $0x728,%edx
+ 724:	0f 34                	sysenter
+ 726:	cd 40                	int    $0x40
+ 728:	c3                   	ret
+
+00000729 <close>:
+SYSCALL(close)
+ 729:	b8 15 00 00 00       	mov    $0x15,%eax
+ 72e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 735:	74 09                	je     740 <close+0x17>
+ 737:	89 e1                	mov    %esp,%ecx
+ 739:	ba 42 07 00 00       	mov    $0x742,%edx
+ 73e:	0f 34                	sysenter
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <kill>:
+SYSCALL(kill)
+ 743:	b8 06 00 00 00       	mov    $0x6,%eax
+ 748:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 74f:	74 09                	je     75a <kill+0x17>
+ 751:	89 e1                	mov    %esp,%ecx
+ 753:	ba 5c 07 00 00       	mov    $0x75c,%edx
+ 758:	0f 34                	sysenter
+ 75a:	cd 40                	int    $0x40
+ 75c:	c3                   	ret
+
+0000075d <exec>:
+SYSCALL(exec)
+ 75d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 762:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 769:	74 09                	je     774 <exec+0x17>
+ 76b:	89 e1                	mov    %esp,%ecx
+ 76d:	ba 76 07 00 00       	mov    $0x776,%edx
+ 772:	0f 34                	sysenter
+ 774:	cd 40                	int    $0x40
+ 776:	c3                   	ret
+
+00000777 <open>:
+SYSCALL(open)
+ 777:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 77c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 783:	74 09                	je     78e <open+0x17>
+ 785:	89 e1                	mov    %esp,%ecx
+ 787:	ba 90 07 00 00       	mov    $0x790,%edx
+ 78c:	0f 34                	sysenter
+ 78e:	cd 40                	int    $0x40
+ 790:	c3                   	ret
+
+00000791 <mknod>:
+SYSCALL(mknod)
+ 791:	b8 11 00 00 00       	mov    $0x11,%eax
+ 796:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 79d:	74 09                	je     7a8 <mknod+0x17>
+ 79f:	89 e1                	mov    %esp,%ecx
+ 7a1:	ba aa 07 00 00       	mov    $0x7aa,%edx
+ 7a6:	0f 34                	sysenter
+ 7a8:	cd 40                	int    $0x40
+ 7aa:	c3                   	ret
+
+000007ab <unlink>:
+SYSCALL(unlink)
+ 7ab:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7b0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7b7:	74 09                	je     7c2 <unlink+0x17>
+ 7b9:	89 e1                	mov    %esp,%ecx
+ 7bb:	ba c4 07 00 00       	mov    $0x7c4,%edx
+ 7c0:	0f 34                	sysenter
+ 7c2:	cd 40                	int    $0x40
+ 7c4:	c3                   	ret
+
+000007c5 <fstat>:
+SYSCALL(fstat)
+ 7c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ca:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d1:	74 09                	je     7dc <fstat+0x17>
+ 7d3:	89 e1                	mov    %esp,%ecx
+ 7d5:	ba de 07 00 00       	mov    $0x7de,%edx
+ 7da:	0f 34                	sysenter
+ 7dc:	cd 40                	int    $0x40
+ 7de:	c3                   	ret
+
+000007df <link>:
+SYSCALL(link)
+ 7df:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7eb:	74 09                	je     7f6 <link+0x17>
+ 7ed:	89 e1                	mov    %esp,%ecx
+ 7ef:	ba f8 07 00 00       	mov    $0x7f8,%edx
+ 7f4:	0f 34                	sysenter
+ 7f6:	cd 40                	int    $0x40
+ 7f8:	c3                   	ret
+
+000007f9 <mkdir>:
+SYSCALL(mkdir)
+ 7f9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7fe:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 805:	74 09                	je     810 <mkdir+0x17>
+ 807:	89 e1                	mov    %esp,%ecx
+ 809:	ba 12 08 00 00       	mov    $0x812,%edx
+ 80e:	0f 34                	sysenter
+ 810:	cd 40                	int    $0x40
+ 812:	c3                   	ret
+
+00000813 <chdir>:
+SYSCALL(chdir)
+ 813:	b8 09 00 00 00       	mov    $0x9,%eax
+ 818:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 81f:	74 09                	je     82a <chdir+0x17>
+ 821:	89 e1                	mov    %esp,%ecx
+ 823:	ba 2c 08 00 00       	mov    $0x82c,%edx
+ 828:	0f 34                	sysenter
+ 82a:	cd 40                	int    $0x40
+ 82c:	c3                   	ret
+
+0000082d <dup>:
+SYSCALL(dup)
+ 82d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 832:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 839:	74 09                	je     844 <dup+0x17>
+ 83b:	89 e1                	mov    %esp,%ecx
+ 83d:	ba 46 08 00 00       	mov    $0x846,%edx
+ 842:	0f 34                	sysenter
+ 844:	cd 40                	int    $0x40
+ 846:	c3                   	ret
+
+00000847 <getpid>:
+SYSCALL(getpid)
+ 847:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 84c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 853:	74 09                	je     85e <getpid+0x17>
+ 855:	89 e1                	mov    %esp,%ecx
+ 857:	ba 60 08 00 00       	mov    $0x860,%edx
+ 85c:	0f 34                	sysenter
+ 85e:	cd 40                	int    $0x40
+ 860:	c3                   	ret
+
+00000861 <sbrk>:
+SYSCALL(sbrk)
+ 861:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 866:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 86d:	74 09                	je     878 <sbrk+0x17>
+ 86f:	89 e1                	mov    %esp,%ecx
+ 871:	ba 7a 08 00 00       	mov    $0x87a,%edx
+ 876:	0f 34                	sysenter
+ 878:	cd 40                	int    $0x40
+ 87a:	c3                   	ret
+
+0000087b <sleep>:
+SYSCALL(sleep)
+ 87b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 880:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 887:	74 09                	je     892 <sleep+0x17>
+ 889:	89 e1                	mov    %esp,%ecx
+ 88b:	ba 94 08 00 00       	mov    $0x894,%edx
+ 890:	0f 34                	sysenter
+ 892:	cd 40                	int    $0x40
+ 894:	c3                   	ret
+
+00000895 <uptime>:
+SYSCALL(uptime)
+ 895:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 89a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a1:	74 09                	je     8ac <uptime+0x17>
+ 8a3:	89 e1                	mov    %esp,%ecx
+ 8a5:	ba ae 08 00 00       	mov    $0x8ae,%edx
+ 8aa:	0f 34                	sysenter
+ 8ac:	cd 40                	int    $0x40
+ 8ae:	c3                   	ret
+
+000008af <mmap>:
+SYSCALL(mmap)
+ 8af:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8bb:	74 09                	je     8c6 <mmap+0x17>
+ 8bd:	89 e1                	mov    %esp,%ecx
+ 8bf:	ba c8 08 00 00       	mov    $0x8c8,%edx
+ 8c4:	0f 34                	sysenter
+ 8c6:	cd 40                	int    $0x40
+ 8c8:	c3                   	ret
+
+000008c9 <munmap>:
+SYSCALL(munmap)
+ 8c9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8ce:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8d5:	74 09                	je     8e0 <munmap+0x17>
+ 8d7:	89 e1                	mov    %esp,%ecx
+ 8d9:	ba e2 08 00 00       	mov    $0x8e2,%edx
+ 8de:	0f 34                	sysenter
+ 8e0:	cd 40                	int    $0x40
+ 8e2:	c3                   	ret
+
+000008e3 <clone>:
+SYSCALL(clone)
+ 8e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8e8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8ef:	74 09                	je     8fa <clone+0x17>
+ 8f1:	89 e1                	mov    %esp,%ecx
+ 8f3:	ba fc 08 00 00       	mov    $0x8fc,%edx
+ 8f8:	0f 34                	sysenter
+ 8fa:	cd 40                	int    $0x40
+ 8fc:	c3                   	ret
+
+000008fd <join>:
+SYSCALL(join)
+ 8fd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 902:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 909:	74 09                	je     914 <join+0x17>
+ 90b:	89 e1                	mov    %esp,%ecx
+ 90d:	ba 16 09 00 00       	mov    $0x916,%edx
+ 912:	0f 34                	sysenter
+ 914:	cd 40                	int    $0x40
+ 916:	c3                   	ret
+
+00000917 <futex>:
+SYSCALL(futex)
+ 917:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 91c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 923:	74 09                	je     92e <futex+0x17>
+ 925:	89 e1                	mov    %esp,%ecx
+ 927:	ba 30 09 00 00       	mov    $0x930,%edx
+ 92c:	0f 34                	sysenter
+ 92e:	cd 40                	int    $0x40
+ 930:	c3                   	ret
+
+00000931 <memstat>:
+SYSCALL(memstat)
+ 931:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 936:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 93d:	74 09                	je     948 <memstat+0x17>
+ 93f:	89 e1                	mov    %esp,%ecx
+ 941:	ba 4a 09 00 00       	mov    $0x94a,%edx
+ 946:	0f 34                	sysenter
+ 948:	cd 40                	int    $0x40
+ 94a:	c3                   	ret
+
+0000094b <nice>:
+SYSCALL(nice)
+ 94b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 950:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 957:	74 09                	je     962 <nice+0x17>
+ 959:	89 e1                	mov    %esp,%ecx
+ 95b:	ba 64 09 00 00       	mov    $0x964,%edx
+ 960:	0f 34                	sysenter
+ 962:	cd 40                	int    $0x40
+ 964:	c3                   	ret
+
+00000965 <setpriority>:
+SYSCALL(setpriority)
+ 965:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 96a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 971:	74 09                	je     97c <setpriority+0x17>
+ 973:	89 e1                	mov    %esp,%ecx
+ 975:	ba 7e 09 00 00       	mov    $0x97e,%edx
+ 97a:	0f 34                	sysenter
+ 97c:	cd 40                	int    $0x40
+ 97e:	c3                   	ret
+
+0000097f <getpinfo>:
+SYSCALL(getpinfo)
+ 97f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 984:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 98b:	74 09                	je     996 <getpinfo+0x17>
+ 98d:	89 e1                	mov    %esp,%ecx
+ 98f:	ba 98 09 00 00       	mov    $0x998,%edx
+ 994:	0f 34                	sysenter
+ 996:	cd 40                	int    $0x40
+ 998:	c3                   	ret
+
+00000999 <settickets>:
+SYSCALL(settickets)
+ 999:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 99e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9a5:	74 09                	je     9b0 <settickets+0x17>
+ 9a7:	89 e1                	mov    %esp,%ecx
+ 9a9:	ba b2 09 00 00       	mov    $0x9b2,%edx
+ 9ae:	0f 34                	sysenter
+ 9b0:	cd 40                	int    $0x40
+ 9b2:	c3                   	ret
+
+000009b3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 9b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9b8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9bf:	74 09                	je     9ca <clock_gettime+0x17>
+ 9c1:	89 e1                	mov    %esp,%ecx
+ 9c3:	ba cc 09 00 00       	mov    $0x9cc,%edx
+ 9c8:	0f 34                	sysenter
+ 9ca:	cd 40                	int    $0x40
+ 9cc:	c3                   	ret
+
+000009cd <batch>:
+SYSCALL(batch)
+ 9cd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9d9:	74 09                	je     9e4 <batch+0x17>
+ 9db:	89 e1                	mov    %esp,%ecx
+ 9dd:	ba e6 09 00 00       	mov    $0x9e6,%edx
+ 9e2:	0f 34                	sysenter
+ 9e4:	cd 40                	int    $0x40
+ 9e6:	c3                   	ret
+
+000009e7 <aiosetup>:
+SYSCALL(aiosetup)
+ 9e7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9f3:	74 09                	je     9fe <aiosetup+0x17>
+ 9f5:	89 e1                	mov    %esp,%ecx
+ 9f7:	ba 00 0a 00 00       	mov    $0xa00,%edx
+ 9fc:	0f 34                	sysenter
+ 9fe:	cd 40                	int    $0x40
+ a00:	c3                   	ret
+
+00000a01 <aioenter>:
+SYSCALL(aioenter)
+ a01:	b8 23 00 00 00       	mov    $0x23,%eax
+ a06:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a0d:	74 09                	je     a18 <aioenter+0x17>
+ a0f:	89 e1                	mov    %esp,%ecx
+ a11:	ba 1a 0a 00 00       	mov    $0xa1a,%edx
+ a16:	0f 34                	sysenter
+ a18:	cd 40                	int    $0x40
+ a1a:	c3                   	ret
+
+00000a1b <systrace>:
+SYSCALL(systrace)
+ a1b:	b8 24 00 00 00       	mov    $0x24,%eax
+ a20:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a27:	74 09                	je     a32 <systrace+0x17>
+ a29:	89 e1                	mov    %esp,%ecx
+ a2b:	ba 34 0a 00 00       	mov    $0xa34,%edx
+ a30:	0f 34                	sysenter
+ a32:	cd 40                	int    $0x40
+ a34:	c3                   	ret
+
+00000a35 <sysstat>:
+SYSCALL(sysstat)
+ a35:	b8 25 00 00 00       	mov    $0x25,%eax
+ a3a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a41:	74 09                	je     a4c <sysstat+0x17>
+ a43:	89 e1                	mov    %esp,%ecx
+ a45:	ba 4e 0a 00 00       	mov    $0xa4e,%edx
+ a4a:	0f 34                	sysenter
+ a4c:	cd 40                	int    $0x40
+ a4e:	c3                   	ret
+
+00000a4f <traceread>:
+SYSCALL(traceread)
+ a4f:	b8 26 00 00 00       	mov    $0x26,%eax
+ a54:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a5b:	74 09                	je     a66 <traceread+0x17>
+ a5d:	89 e1                	mov    %esp,%ecx
+ a5f:	ba 68 0a 00 00       	mov    $0xa68,%edx
+ a64:	0f 34                	sysenter
+ a66:	cd 40                	int    $0x40
+ a68:	c3                   	ret
+ a69:	66 90                	xchg   %ax,%ax
+ a6b:	66 90                	xchg   %ax,%ax
+ a6d:	66 90                	xchg   %ax,%ax
+ a6f:	90                   	nop
+
+00000a70 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a70:	55                   	push   %ebp
+ a71:	89 e5                	mov    %esp,%ebp
+ a73:	57                   	push   %edi
+ a74:	56                   	push   %esi
+ a75:	53                   	push   %ebx
+ a76:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a78:	89 d1                	mov    %edx,%ecx
+{
+ a7a:	83 ec 3c             	sub    $0x3c,%esp
+ a7d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a80:	85 d2                	test   %edx,%edx
+ a82:	0f 89 80 00 00 00    	jns    b08 <printint+0x98>
+ a88:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a8c:	74 7a                	je     b08 <printint+0x98>
+    x = -xx;
+ a8e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a90:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a95:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a98:	31 f6                	xor    %esi,%esi
+ a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ aa0:	89 c8                	mov    %ecx,%eax
+ aa2:	31 d2                	xor    %edx,%edx
+ aa4:	89 f7                	mov    %esi,%edi
+ aa6:	f7 f3                	div    %ebx
+ aa8:	8d 76 01             	lea    0x1(%esi),%esi
+ aab:	0f b6 92 b0 0f 00 00 	movzbl 0xfb0(%edx),%edx
+ ab2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ab6:	89 ca                	mov    %ecx,%edx
+ ab8:	89 c1                	mov    %eax,%ecx
+ aba:	39 da                	cmp    %ebx,%edx
+ abc:	73 e2                	jae    aa0 <printint+0x30>
+  if(neg)
+ abe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ac1:	85 c0                	test   %eax,%eax
+ ac3:	74 07                	je     acc <printint+0x5c>
+    buf[i++] = '-';
+ ac5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aca:	89 f7                	mov    %esi,%edi
+ acc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ acf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ ad2:	01 df                	add    %ebx,%edi
+ ad4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ ad8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ adb:	83 ec 04             	sub    $0x4,%esp
+ ade:	88 45 d7             	mov    %al,-0x29(%ebp)
+ ae1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ ae4:	6a 01                	push   $0x1
+ ae6:	50                   	push   %eax
+ ae7:	56                   	push   %esi
+ ae8:	e8 22 fc ff ff       	call   70f <write>
+  while(--i >= 0)
+ aed:	89 f8                	mov    %edi,%eax
+ aef:	83 c4 10             	add    $0x10,%esp
+ af2:	83 ef 01             	sub    $0x1,%edi
+ af5:	39 d8                	cmp    %ebx,%eax
+ af7:	75 df                	jne    ad8 <printint+0x68>
+}
+ af9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ afc:	5b                   	pop    %ebx
+ afd:	5e                   	pop    %esi
+ afe:	5f                   	pop    %edi
+ aff:	5d                   	pop    %ebp
+ b00:	c3                   	ret
+ b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b08:	31 c0                	xor    %eax,%eax
+ b0a:	eb 89                	jmp    a95 <printint+0x25>
+ b0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b19:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b1f:	0f b6 1e             	movzbl (%esi),%ebx
+ b22:	83 c6 01             	add    $0x1,%esi
+ b25:	84 db                	test   %bl,%bl
+ b27:	74 67                	je     b90 <printf+0x80>
+ b29:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b2c:	31 d2                	xor    %edx,%edx
+ b2e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b31:	eb 34                	jmp    b67 <printf+0x57>
+ b33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b37:	90                   	nop
+ b38:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b3b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b40:	83 f8 25             	cmp    $0x25,%eax
+ b43:	74 18                	je     b5d <printf+0x4d>
+  write(fd, &c, 1);
+ b45:	83 ec 04             	sub    $0x4,%esp
+ b48:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b4b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b4e:	6a 01                	push   $0x1
+ b50:	50                   	push   %eax
+ b51:	57                   	push   %edi
+ b52:	e8 b8 fb ff ff       	call   70f <write>
+ b57:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b5a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b5d:	0f b6 1e             	movzbl (%esi),%ebx
+ b60:	83 c6 01             	add    $0x1,%esi
+ b63:	84 db                	test   %bl,%bl
+ b65:	74 29                	je     b90 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b67:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b6a:	85 d2                	test   %edx,%edx
+ b6c:	74 ca                	je     b38 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b6e:	83 fa 25             	cmp    $0x25,%edx
+ b71:	75 ea                	jne    b5d <printf+0x4d>
+      if(c == 'd'){
+ b73:	83 f8 25             	cmp    $0x25,%eax
+ b76:	0f 84 24 01 00 00    	je     ca0 <printf+0x190>
+ b7c:	83 e8 63             	sub    $0x63,%eax
+ b7f:	83 f8 15             	cmp    $0x15,%eax
+ b82:	77 1c                	ja     ba0 <printf+0x90>
+ b84:	ff 24 85 58 0f 00 00 	jmp    *0xf58(,%eax,4)
+ b8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b93:	5b                   	pop    %ebx
+ b94:	5e                   	pop    %esi
+ b95:	5f                   	pop    %edi
+ b96:	5d                   	pop    %ebp
+ b97:	c3                   	ret
+ b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+  write(fd, &c, 1);
+ ba0:	83 ec 04             	sub    $0x4,%esp
+ ba3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ba6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ baa:	6a 01                	push   $0x1
+ bac:	52                   	push   %edx
+ bad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ bb0:	57                   	push   %edi
+ bb1:	e8 59 fb ff ff       	call   70f <write>
+ bb6:	83 c4 0c             	add    $0xc,%esp
+ bb9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bbc:	6a 01                	push   $0x1
+ bbe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ bc1:	52                   	push   %edx
+ bc2:	57                   	push   %edi
+ bc3:	e8 47 fb ff ff       	call   70f <write>
+        putc(fd, c);
+ bc8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bcb:	31 d2                	xor    %edx,%edx
+ bcd:	eb 8e                	jmp    b5d <printf+0x4d>
+ bcf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bd0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bd3:	83 ec 0c             	sub    $0xc,%esp
+ bd6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bdb:	8b 13                	mov    (%ebx),%edx
+ bdd:	6a 00                	push   $0x0
+ bdf:	89 f8                	mov    %edi,%eax
+        ap++;
+ be1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ be4:	e8 87 fe ff ff       	call   a70 <printint>
+        ap++;
+ be9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bef:	31 d2                	xor    %edx,%edx
+ bf1:	e9 67 ff ff ff       	jmp    b5d <printf+0x4d>
+ bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ c00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ c03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c05:	83 c0 04             	add    $0x4,%eax
+ c08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ c0b:	85 db                	test   %ebx,%ebx
+ c0d:	0f 84 9d 00 00 00    	je     cb0 <printf+0x1a0>
+        while(*s != 0){
+ c13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c18:	84 c0                	test   %al,%al
+ c1a:	0f 84 3d ff ff ff    	je     b5d <printf+0x4d>
+ c20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c26:	89 de                	mov    %ebx,%esi
+ c28:	89 d3                	mov    %edx,%ebx
+ c2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c30:	83 ec 04             	sub    $0x4,%esp
+ c33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c39:	6a 01                	push   $0x1
+ c3b:	53                   	push   %ebx
+ c3c:	57                   	push   %edi
+ c3d:	e8 cd fa ff ff       	call   70f <write>
+        while(*s != 0){
+ c42:	0f b6 06             	movzbl (%esi),%eax
+ c45:	83 c4 10             	add    $0x10,%esp
+ c48:	84 c0                	test   %al,%al
+ c4a:	75 e4                	jne    c30 <printf+0x120>
+      state = 0;
+ c4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c4f:	31 d2                	xor    %edx,%edx
+ c51:	e9 07 ff ff ff       	jmp    b5d <printf+0x4d>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c63:	83 ec 0c             	sub    $0xc,%esp
+ c66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c6b:	8b 13                	mov    (%ebx),%edx
+ c6d:	6a 01                	push   $0x1
+ c6f:	e9 6b ff ff ff       	jmp    bdf <printf+0xcf>
+ c74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c7b:	83 ec 04             	sub    $0x4,%esp
+ c7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c89:	6a 01                	push   $0x1
+ c8b:	52                   	push   %edx
+ c8c:	57                   	push   %edi
+ c8d:	e8 7d fa ff ff       	call   70f <write>
+        ap++;
+ c92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c98:	31 d2                	xor    %edx,%edx
+ c9a:	e9 be fe ff ff       	jmp    b5d <printf+0x4d>
+ c9f:	90                   	nop
+  write(fd, &c, 1);
+ ca0:	83 ec 04             	sub    $0x4,%esp
+ ca3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ca6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ca9:	6a 01                	push   $0x1
+ cab:	e9 11 ff ff ff       	jmp    bc1 <printf+0xb1>
+ cb0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ cb5:	bb 4e 0f 00 00       	mov    $0xf4e,%ebx
+ cba:	e9 61 ff ff ff       	jmp    c20 <printf+0x110>
+ cbf:	90                   	nop
+
+00000cc0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cc0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cc1:	a1 48 14 00 00       	mov    0x1448,%eax
+{
+ cc6:	89 e5                	mov    %esp,%ebp
+ cc8:	57                   	push   %edi
+ cc9:	56                   	push   %esi
+ cca:	53                   	push   %ebx
+ ccb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cd8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cda:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cdc:	39 ca                	cmp    %ecx,%edx
+ cde:	73 30                	jae    d10 <free+0x50>
+ ce0:	39 c1                	cmp    %eax,%ecx
+ ce2:	72 04                	jb     ce8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ce4:	39 c2                	cmp    %eax,%edx
+ ce6:	72 f0                	jb     cd8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ce8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ ceb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cee:	39 f8                	cmp    %edi,%eax
+ cf0:	74 2e                	je     d20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cf2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cf5:	8b 42 04             	mov    0x4(%edx),%eax
+ cf8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cfb:	39 f1                	cmp    %esi,%ecx
+ cfd:	74 38                	je     d37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d01:	5b                   	pop    %ebx
+  freep = p;
+ d02:	89 15 48 14 00 00    	mov    %edx,0x1448
+}
+ d08:	5e                   	pop    %esi
+ d09:	5f                   	pop    %edi
+ d0a:	5d                   	pop    %ebp
+ d0b:	c3                   	ret
+ d0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d10:	39 c1                	cmp    %eax,%ecx
+ d12:	72 d0                	jb     ce4 <free+0x24>
+ d14:	eb c2                	jmp    cd8 <free+0x18>
+ d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d20:	03 70 04             	add    0x4(%eax),%esi
+ d23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d26:	8b 02                	mov    (%edx),%eax
+ d28:	8b 00                	mov    (%eax),%eax
+ d2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d2d:	8b 42 04             	mov    0x4(%edx),%eax
+ d30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d33:	39 f1                	cmp    %esi,%ecx
+ d35:	75 c8                	jne    cff <free+0x3f>
+    p->s.size += bp->s.size;
+ d37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d3a:	89 15 48 14 00 00    	mov    %edx,0x1448
+    p->s.size += bp->s.size;
+ d40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d46:	89 0a                	mov    %ecx,(%edx)
+}
+ d48:	5b                   	pop    %ebx
+ d49:	5e                   	pop    %esi
+ d4a:	5f                   	pop    %edi
+ d4b:	5d                   	pop    %ebp
+ d4c:	c3                   	ret
+ d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d50:	55                   	push   %ebp
+ d51:	89 e5                	mov    %esp,%ebp
+ d53:	57                   	push   %edi
+ d54:	56                   	push   %esi
+ d55:	53                   	push   %ebx
+ d56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d5c:	8b 15 48 14 00 00    	mov    0x1448,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d62:	8d 78 07             	lea    0x7(%eax),%edi
+ d65:	c1 ef 03             	shr    $0x3,%edi
+ d68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d6b:	85 d2                	test   %edx,%edx
+ d6d:	0f 84 8d 00 00 00    	je     e00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d75:	8b 48 04             	mov    0x4(%eax),%ecx
+ d78:	39 f9                	cmp    %edi,%ecx
+ d7a:	73 64                	jae    de0 <malloc+0x90>
+  if(nu < 4096)
+ d7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d81:	39 df                	cmp    %ebx,%edi
+ d83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d8d:	eb 0a                	jmp    d99 <malloc+0x49>
+ d8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d92:	8b 48 04             	mov    0x4(%eax),%ecx
+ d95:	39 f9                	cmp    %edi,%ecx
+ d97:	73 47                	jae    de0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d99:	89 c2                	mov    %eax,%edx
+ d9b:	39 05 48 14 00 00    	cmp    %eax,0x1448
+ da1:	75 ed                	jne    d90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ da3:	83 ec 0c             	sub    $0xc,%esp
+ da6:	56                   	push   %esi
+ da7:	e8 b5 fa ff ff       	call   861 <sbrk>
+  if(p == (char*)-1)
+ dac:	83 c4 10             	add    $0x10,%esp
+ daf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ db2:	74 1c                	je     dd0 <malloc+0x80>
+  hp->s.size = nu;
+ db4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ db7:	83 ec 0c             	sub    $0xc,%esp
+ dba:	83 c0 08             	add    $0x8,%eax
+ dbd:	50                   	push   %eax
+ dbe:	e8 fd fe ff ff       	call   cc0 <free>
+  return freep;
+ dc3:	8b 15 48 14 00 00    	mov    0x1448,%edx
+      if((p = morecore(nunits)) == 0)
+ dc9:	83 c4 10             	add    $0x10,%esp
+ dcc:	85 d2                	test   %edx,%edx
+ dce:	75 c0                	jne    d90 <malloc+0x40>
+        return 0;
+  }
+}
+ dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ dd3:	31 c0                	xor    %eax,%eax
+}
+ dd5:	5b                   	pop    %ebx
+ dd6:	5e                   	pop    %esi
+ dd7:	5f                   	pop    %edi
+ dd8:	5d                   	pop    %ebp
+ dd9:	c3                   	ret
+ dda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ de0:	39 cf                	cmp    %ecx,%edi
+ de2:	74 4c                	je     e30 <malloc+0xe0>
+        p->s.size -= nunits;
+ de4:	29 f9                	sub    %edi,%ecx
+ de6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ de9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ def:	89 15 48 14 00 00    	mov    %edx,0x1448
+}
+ df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ df8:	83 c0 08             	add    $0x8,%eax
+}
+ dfb:	5b                   	pop    %ebx
+ dfc:	5e                   	pop    %esi
+ dfd:	5f                   	pop    %edi
+ dfe:	5d                   	pop    %ebp
+ dff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e00:	c7 05 48 14 00 00 4c 	movl   $0x144c,0x1448
+ e07:	14 00 00 
+    base.s.size = 0;
+ e0a:	b8 4c 14 00 00       	mov    $0x144c,%eax
+    base.s.ptr = freep = prevp = &base;
+ e0f:	c7 05 4c 14 00 00 4c 	movl   $0x144c,0x144c
+ e16:	14 00 00 
+    base.s.size = 0;
+ e19:	c7 05 50 14 00 00 00 	movl   $0x0,0x1450
+ e20:	00 00 00 
+    if(p->s.size >= nunits){
+ e23:	e9 54 ff ff ff       	jmp    d7c <malloc+0x2c>
+ e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e30:	8b 08                	mov    (%eax),%ecx
+ e32:	89 0a                	mov    %ecx,(%edx)
+ e34:	eb b9                	jmp    def <malloc+0x9f>
+ e36:	66 90                	xchg   %ax,%ax
+ e38:	66 90                	xchg   %ax,%ax
+ e3a:	66 90                	xchg   %ax,%ax
+ e3c:	66 90                	xchg   %ax,%ax
+ e3e:	66 90                	xchg   %ax,%ax
+
+00000e40 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	53                   	push   %ebx
+ e44:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ e47:	68 00 20 00 00       	push   $0x2000
+ e4c:	e8 ff fe ff ff       	call   d50 <malloc>
+ e51:	83 c4 10             	add    $0x10,%esp
+ e54:	85 c0                	test   %eax,%eax
+ e56:	74 47                	je     e9f <thread_create+0x5f>
+ e58:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e5a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ e60:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e63:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ e68:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ e6b:	ff 75 0c             	push   0xc(%ebp)
+ e6e:	50                   	push   %eax
+ e6f:	ff 75 08             	push   0x8(%ebp)
+ e72:	e8 6c fa ff ff       	call   8e3 <clone>
+ e77:	83 c4 10             	add    $0x10,%esp
+ e7a:	85 c0                	test   %eax,%eax
+ e7c:	78 0a                	js     e88 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e81:	c9                   	leave
+ e82:	c3                   	ret
+ e83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e87:	90                   	nop
+    free(mem);
+ e88:	83 ec 0c             	sub    $0xc,%esp
+ e8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e8e:	53                   	push   %ebx
+ e8f:	e8 2c fe ff ff       	call   cc0 <free>
+ e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e9a:	83 c4 10             	add    $0x10,%esp
+}
+ e9d:	c9                   	leave
+ e9e:	c3                   	ret
+    return -1;
+ e9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ea4:	eb d8                	jmp    e7e <thread_create+0x3e>
+ ea6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000eb0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ eb0:	55                   	push   %ebp
+ eb1:	89 e5                	mov    %esp,%ebp
+ eb3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ eb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ eb7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ eba:	50                   	push   %eax
+ ebb:	e8 3d fa ff ff       	call   8fd <join>
+ ec0:	83 c4 10             	add    $0x10,%esp
+ ec3:	85 c0                	test   %eax,%eax
+ ec5:	78 21                	js     ee8 <thread_join+0x38>
+ ec7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ ec9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ecc:	83 ec 0c             	sub    $0xc,%esp
+ ecf:	ff 70 fc             	push   -0x4(%eax)
+ ed2:	e8 e9 fd ff ff       	call   cc0 <free>
+  return pid;
+ ed7:	83 c4 10             	add    $0x10,%esp
+}
+ eda:	89 d8                	mov    %ebx,%eax
+ edc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ edf:	c9                   	leave
+ ee0:	c3                   	ret
+ ee1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ ee8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ eed:	eb eb                	jmp    eda <thread_join+0x2a>
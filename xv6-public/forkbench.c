@@ -0,0 +1,60 @@
+// Parallel fork microbenchmark.
+// Starts P workers that each fork and reap N children; every fork
+// copies the worker's address space, so the run is dominated by
+// page allocation and freeing.  Compare the time for P = 1 with
+// P = the number of CPUs to see how well kalloc() scales, and type
+// ^P afterwards for allocator lock contention counts.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define N  200
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, nworkers, pid, start, elapsed;
+
+  nworkers = 4;
+  n = N;
+  if(argc > 1)
+    nworkers = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+
+  // Give each fork something to copy.
+  if(sbrk(16*4096) == (char*)-1){
+    printf(2, "forkbench: sbrk failed\n");
+    exit();
+  }
+
+  start = uptime();
+  for(i = 0; i < nworkers; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "forkbench: fork failed\n");
+      break;
+    }
+    if(pid == 0){
+      for(j = 0; j < n; j++){
+        pid = fork();
+        if(pid < 0){
+          printf(2, "forkbench: fork failed\n");
+          break;
+        }
+        if(pid == 0)
+          exit();
+        wait();
+      }
+      exit();
+    }
+  }
+  while(wait() >= 0)
+    ;
+  elapsed = uptime() - start;
+
+  printf(1, "forkbench: %d workers x %d forks in %d ticks\n",
+         nworkers, n, elapsed);
+  exit();
+}
@@ -0,0 +1,1412 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "fork test OK\n");
+}
+
+int
+main(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+   6:	e8 35 00 00 00       	call   40 <forktest>
+  exit();
+   b:	e8 57 06 00 00       	call   667 <exit>
+
+00000010 <printf>:
+{
+  10:	55                   	push   %ebp
+  11:	89 e5                	mov    %esp,%ebp
+  13:	53                   	push   %ebx
+  14:	83 ec 10             	sub    $0x10,%esp
+  17:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  1a:	53                   	push   %ebx
+  1b:	e8 90 01 00 00       	call   1b0 <strlen>
+  20:	83 c4 0c             	add    $0xc,%esp
+  23:	50                   	push   %eax
+  24:	53                   	push   %ebx
+  25:	ff 75 08             	push   0x8(%ebp)
+  28:	e8 a2 06 00 00       	call   6cf <write>
+}
+  2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	c9                   	leave
+  34:	c3                   	ret
+  35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000040 <forktest>:
+{
+  40:	55                   	push   %ebp
+  41:	89 e5                	mov    %esp,%ebp
+  43:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+  44:	31 db                	xor    %ebx,%ebx
+{
+  46:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+  49:	68 2c 0a 00 00       	push   $0xa2c
+  4e:	e8 5d 01 00 00       	call   1b0 <strlen>
+  53:	83 c4 0c             	add    $0xc,%esp
+  56:	50                   	push   %eax
+  57:	68 2c 0a 00 00       	push   $0xa2c
+  5c:	6a 01                	push   $0x1
+  5e:	e8 6c 06 00 00       	call   6cf <write>
+  63:	83 c4 10             	add    $0x10,%esp
+  66:	eb 19                	jmp    81 <forktest+0x41>
+  68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6f:	90                   	nop
+    if(pid == 0)
+  70:	74 5b                	je     cd <forktest+0x8d>
+  for(n=0; n<N; n++){
+  72:	83 c3 01             	add    $0x1,%ebx
+  75:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  7b:	0f 84 86 00 00 00    	je     107 <forktest+0xc7>
+    pid = fork();
+  81:	e8 c7 05 00 00       	call   64d <fork>
+    if(pid < 0)
+  86:	85 c0                	test   %eax,%eax
+  88:	79 e6                	jns    70 <forktest+0x30>
+  for(; n > 0; n--){
+  8a:	85 db                	test   %ebx,%ebx
+  8c:	74 10                	je     9e <forktest+0x5e>
+  8e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+  90:	e8 ec 05 00 00       	call   681 <wait>
+  95:	85 c0                	test   %eax,%eax
+  97:	78 39                	js     d2 <forktest+0x92>
+  for(; n > 0; n--){
+  99:	83 eb 01             	sub    $0x1,%ebx
+  9c:	75 f2                	jne    90 <forktest+0x50>
+  if(wait() != -1){
+  9e:	e8 de 05 00 00       	call   681 <wait>
+  a3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  a6:	75 4c                	jne    f4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+  a8:	83 ec 0c             	sub    $0xc,%esp
+  ab:	68 5e 0a 00 00       	push   $0xa5e
+  b0:	e8 fb 00 00 00       	call   1b0 <strlen>
+  b5:	83 c4 0c             	add    $0xc,%esp
+  b8:	50                   	push   %eax
+  b9:	68 5e 0a 00 00       	push   $0xa5e
+  be:	6a 01                	push   $0x1
+  c0:	e8 0a 06 00 00       	call   6cf <write>
+}
+  c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c8:	83 c4 10             	add    $0x10,%esp
+  cb:	c9                   	leave
+  cc:	c3                   	ret
+      exit();
+  cd:	e8 95 05 00 00       	call   667 <exit>
+  write(fd, s, strlen(s));
+  d2:	83 ec 0c             	sub    $0xc,%esp
+  d5:	68 37 0a 00 00       	push   $0xa37
+  da:	e8 d1 00 00 00       	call   1b0 <strlen>
+  df:	83 c4 0c             	add    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	68 37 0a 00 00       	push   $0xa37
+  e8:	6a 01                	push   $0x1
+  ea:	e8 e0 05 00 00       	call   6cf <write>
+      exit();
+  ef:	e8 73 05 00 00       	call   667 <exit>
+    printf(1, "wait got too many\n");
+  f4:	50                   	push   %eax
+  f5:	50                   	push   %eax
+  f6:	68 4b 0a 00 00       	push   $0xa4b
+  fb:	6a 01                	push   $0x1
+  fd:	e8 0e ff ff ff       	call   10 <printf>
+    exit();
+ 102:	e8 60 05 00 00       	call   667 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 107:	52                   	push   %edx
+ 108:	68 e8 03 00 00       	push   $0x3e8
+ 10d:	68 6c 0a 00 00       	push   $0xa6c
+ 112:	6a 01                	push   $0x1
+ 114:	e8 f7 fe ff ff       	call   10 <printf>
+    exit();
+ 119:	e8 49 05 00 00       	call   667 <exit>
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 58 04 00 00       	call   6b5 <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 85 04 00 00       	call   737 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 be 04 00 00       	call   785 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 18 04 00 00       	call   6e9 <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 36c:	5d                   	pop    %ebp
+ 36d:	c3                   	ret
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 370:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 371:	31 c0                	xor    %eax,%eax
+ 373:	ba 01 00 00 00       	mov    $0x1,%edx
+ 378:	89 e5                	mov    %esp,%ebp
+ 37a:	56                   	push   %esi
+ 37b:	53                   	push   %ebx
+ 37c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 37f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 383:	85 c0                	test   %eax,%eax
+ 385:	74 32                	je     3b9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 387:	83 f8 02             	cmp    $0x2,%eax
+ 38a:	74 0c                	je     398 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 38c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 391:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 394:	85 c0                	test   %eax,%eax
+ 396:	74 21                	je     3b9 <mutex_lock+0x49>
+ 398:	be 02 00 00 00       	mov    $0x2,%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 02                	push   $0x2
+ 3a5:	6a 00                	push   $0x0
+ 3a7:	53                   	push   %ebx
+ 3a8:	e8 2a 05 00 00       	call   8d7 <futex>
+ 3ad:	89 f0                	mov    %esi,%eax
+ 3af:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	75 e7                	jne    3a0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 3b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	31 c0                	xor    %eax,%eax
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	83 ec 08             	sub    $0x8,%esp
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3ce:	83 f8 02             	cmp    $0x2,%eax
+ 3d1:	74 05                	je     3d8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3d8:	83 ec 04             	sub    $0x4,%esp
+ 3db:	6a 01                	push   $0x1
+ 3dd:	6a 01                	push   $0x1
+ 3df:	52                   	push   %edx
+ 3e0:	e8 f2 04 00 00       	call   8d7 <futex>
+ 3e5:	83 c4 10             	add    $0x10,%esp
+}
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3fc:	5d                   	pop    %ebp
+ 3fd:	c3                   	ret
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 400:	55                   	push   %ebp
+ 401:	31 c0                	xor    %eax,%eax
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	57                   	push   %edi
+ 406:	56                   	push   %esi
+ 407:	53                   	push   %ebx
+ 408:	83 ec 0c             	sub    $0xc,%esp
+ 40b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 40e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 411:	8b 3e                	mov    (%esi),%edi
+ 413:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 416:	83 f8 02             	cmp    $0x2,%eax
+ 419:	74 5d                	je     478 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 41b:	83 ec 04             	sub    $0x4,%esp
+ 41e:	57                   	push   %edi
+ 41f:	6a 00                	push   $0x0
+ 421:	56                   	push   %esi
+ 422:	e8 b0 04 00 00       	call   8d7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 427:	31 c0                	xor    %eax,%eax
+ 429:	ba 01 00 00 00       	mov    $0x1,%edx
+ 42e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	85 c0                	test   %eax,%eax
+ 437:	74 30                	je     469 <cond_wait+0x69>
+  if(c != 2)
+ 439:	83 f8 02             	cmp    $0x2,%eax
+ 43c:	74 0c                	je     44a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 43e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 443:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 446:	85 c0                	test   %eax,%eax
+ 448:	74 1f                	je     469 <cond_wait+0x69>
+ 44a:	be 02 00 00 00       	mov    $0x2,%esi
+ 44f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 450:	83 ec 04             	sub    $0x4,%esp
+ 453:	6a 02                	push   $0x2
+ 455:	6a 00                	push   $0x0
+ 457:	53                   	push   %ebx
+ 458:	e8 7a 04 00 00       	call   8d7 <futex>
+ 45d:	89 f0                	mov    %esi,%eax
+ 45f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	75 e7                	jne    450 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46c:	5b                   	pop    %ebx
+ 46d:	5e                   	pop    %esi
+ 46e:	5f                   	pop    %edi
+ 46f:	5d                   	pop    %ebp
+ 470:	c3                   	ret
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 478:	83 ec 04             	sub    $0x4,%esp
+ 47b:	6a 01                	push   $0x1
+ 47d:	6a 01                	push   $0x1
+ 47f:	53                   	push   %ebx
+ 480:	e8 52 04 00 00       	call   8d7 <futex>
+ 485:	83 c4 10             	add    $0x10,%esp
+ 488:	eb 91                	jmp    41b <cond_wait+0x1b>
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000490 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	83 ec 04             	sub    $0x4,%esp
+ 497:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4a0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4a2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 4a5:	89 c8                	mov    %ecx,%eax
+ 4a7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4ab:	39 c1                	cmp    %eax,%ecx
+ 4ad:	75 f1                	jne    4a0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4af:	83 ec 04             	sub    $0x4,%esp
+ 4b2:	6a 01                	push   $0x1
+ 4b4:	6a 01                	push   $0x1
+ 4b6:	52                   	push   %edx
+ 4b7:	e8 1b 04 00 00       	call   8d7 <futex>
+}
+ 4bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	c9                   	leave
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	83 ec 04             	sub    $0x4,%esp
+ 4d7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4e0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4e2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 4e5:	89 c8                	mov    %ecx,%eax
+ 4e7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4eb:	39 c1                	cmp    %eax,%ecx
+ 4ed:	75 f1                	jne    4e0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 4ef:	83 ec 04             	sub    $0x4,%esp
+ 4f2:	6a 40                	push   $0x40
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	52                   	push   %edx
+ 4f7:	e8 db 03 00 00       	call   8d7 <futex>
+}
+ 4fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ff:	83 c4 10             	add    $0x10,%esp
+ 502:	c9                   	leave
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 510:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 520:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 525:	85 c0                	test   %eax,%eax
+ 527:	74 07                	je     530 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 529:	c3                   	ret
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 530:	e9 d2 02 00 00       	jmp    807 <getpid>
+ 535:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 549:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 54b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 551:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 557:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 55c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 562:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 56a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 570:	29 d9                	sub    %ebx,%ecx
+ 572:	89 c6                	mov    %eax,%esi
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	0f a5 c7             	shld   %cl,%eax,%edi
+ 579:	d3 e6                	shl    %cl,%esi
+ 57b:	31 c0                	xor    %eax,%eax
+ 57d:	f6 c1 20             	test   $0x20,%cl
+ 580:	0f 45 fe             	cmovne %esi,%edi
+ 583:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 586:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 589:	89 d9                	mov    %ebx,%ecx
+ 58b:	31 db                	xor    %ebx,%ebx
+ 58d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 593:	0f ad d0             	shrd   %cl,%edx,%eax
+ 596:	d3 ea                	shr    %cl,%edx
+ 598:	f6 c1 20             	test   $0x20,%cl
+ 59b:	0f 45 c2             	cmovne %edx,%eax
+ 59e:	0f 45 d3             	cmovne %ebx,%edx
+ 5a1:	01 f0                	add    %esi,%eax
+ 5a3:	11 fa                	adc    %edi,%edx
+}
+ 5a5:	83 c4 0c             	add    $0xc,%esp
+ 5a8:	5b                   	pop    %ebx
+ 5a9:	5e                   	pop    %esi
+ 5aa:	5f                   	pop    %edi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 5b9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 5c0:	74 0e                	je     5d0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 5c2:	83 c4 1c             	add    $0x1c,%esp
+ 5c5:	5b                   	pop    %ebx
+ 5c6:	5e                   	pop    %esi
+ 5c7:	5f                   	pop    %edi
+ 5c8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 5c9:	e9 a5 03 00 00       	jmp    973 <clock_gettime>
+ 5ce:	66 90                	xchg   %ax,%ax
+ 5d0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 5d2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 5d8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5de:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 5e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5e6:	89 d0                	mov    %edx,%eax
+ 5e8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5eb:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5f1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 5f7:	89 c6                	mov    %eax,%esi
+ 5f9:	89 d7                	mov    %edx,%edi
+ 5fb:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5fe:	d3 e6                	shl    %cl,%esi
+ 600:	31 c0                	xor    %eax,%eax
+ 602:	f6 c1 20             	test   $0x20,%cl
+ 605:	0f 45 fe             	cmovne %esi,%edi
+ 608:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 60b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 60e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 615:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 61b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 61e:	d3 ea                	shr    %cl,%edx
+ 620:	f6 c1 20             	test   $0x20,%cl
+ 623:	74 04                	je     629 <vclock_gettime+0x79>
+ 625:	89 d0                	mov    %edx,%eax
+ 627:	31 d2                	xor    %edx,%edx
+ 629:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 62b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 630:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 632:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 634:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 636:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 638:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 63e:	29 c1                	sub    %eax,%ecx
+}
+ 640:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 642:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 645:	83 c4 1c             	add    $0x1c,%esp
+ 648:	5b                   	pop    %ebx
+ 649:	5e                   	pop    %esi
+ 64a:	5f                   	pop    %edi
+ 64b:	5d                   	pop    %ebp
+ 64c:	c3                   	ret
+
+0000064d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 64d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 652:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 659:	74 09                	je     664 <fork+0x17>
+ 65b:	89 e1                	mov    %esp,%ecx
+ 65d:	ba 66 06 00 00       	mov    $0x666,%edx
+ 662:	0f 34                	sysenter
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <exit>:
+SYSCALL(exit)
+ 667:	b8 02 00 00 00       	mov    $0x2,%eax
+ 66c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 673:	74 09                	je     67e <exit+0x17>
+ 675:	89 e1                	mov    %esp,%ecx
+ 677:	ba 80 06 00 00       	mov    $0x680,%edx
+ 67c:	0f 34                	sysenter
+ 67e:	cd 40                	int    $0x40
+ 680:	c3                   	ret
+
+00000681 <wait>:
+SYSCALL(wait)
+ 681:	b8 03 00 00 00       	mov    $0x3,%eax
+ 686:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 68d:	74 09                	je     698 <wait+0x17>
+ 68f:	89 e1                	mov    %esp,%ecx
+ 691:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 696:	0f 34                	sysenter
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <pipe>:
+SYSCALL(pipe)
+ 69b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a7:	74 09                	je     6b2 <pipe+0x17>
+ 6a9:	89 e1                	mov    %esp,%ecx
+ 6ab:	ba b4 06 00 00       	mov    $0x6b4,%edx
+ 6b0:	0f 34                	sysenter
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <read>:
+SYSCALL(read)
+ 6b5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6c1:	74 09                	je     6cc <read+0x17>
+ 6c3:	89 e1                	mov    %esp,%ecx
+ 6c5:	ba ce 06 00 00       	mov    $0x6ce,%edx
+ 6ca:	0f 34                	sysenter
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <write>:
+SYSCALL(write)
+ 6cf:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6db:	74 09                	je     6e6 <write+0x17>
+ 6dd:	89 e1                	mov    %esp,%ecx
+ 6df:	ba e8 06 00 00       	mov    $0x6e8,%edx
+ 6e4:	0f 34                	sysenter
+ 6e6:	cd 40                	int    $0x40
+ 6e8:	c3                   	ret
+
+000006e9 <close>:
+SYSCALL(close)
+ 6e9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f5:	74 09                	je     700 <close+0x17>
+ 6f7:	89 e1                	mov    %esp,%ecx
+ 6f9:	ba 02 07 00 00       	mov    $0x702,%edx
+ 6fe:	0f 34                	sysenter
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <kill>:
+SYSCALL(kill)
+ 703:	b8 06 00 00 00       	mov    $0x6,%eax
+ 708:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 70f:	74 09                	je     71a <kill+0x17>
+ 711:	89 e1                	mov    %esp,%ecx
+ 713:	ba 1c 07 00 00       	mov    $0x71c,%edx
+ 718:	0f 34                	sysenter
+ 71a:	cd 40                	int    $0x40
+ 71c:	c3                   	ret
+
+0000071d <exec>:
+SYSCALL(exec)
+ 71d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 722:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 729:	74 09                	je     734 <exec+0x17>
+ 72b:	89 e1                	mov    %esp,%ecx
+ 72d:	ba 36 07 00 00       	mov    $0x736,%edx
+ 732:	0f 34                	sysenter
+ 734:	cd 40                	int    $0x40
+ 736:	c3                   	ret
+
+00000737 <open>:
+SYSCALL(open)
+ 737:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 73c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 743:	74 09                	je     74e <open+0x17>
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 50 07 00 00       	mov    $0x750,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	cd 40                	int    $0x40
+ 750:	c3                   	ret
+
+00000751 <mknod>:
+SYSCALL(mknod)
+ 751:	b8 11 00 00 00       	mov    $0x11,%eax
+ 756:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 75d:	74 09                	je     768 <mknod+0x17>
+ 75f:	89 e1                	mov    %esp,%ecx
+ 761:	ba 6a 07 00 00       	mov    $0x76a,%edx
+ 766:	0f 34                	sysenter
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <unlink>:
+SYSCALL(unlink)
+ 76b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 770:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 777:	74 09                	je     782 <unlink+0x17>
+ 779:	89 e1                	mov    %esp,%ecx
+ 77b:	ba 84 07 00 00       	mov    $0x784,%edx
+ 780:	0f 34                	sysenter
+ 782:	cd 40                	int    $0x40
+ 784:	c3                   	ret
+
+00000785 <fstat>:
+SYSCALL(fstat)
+ 785:	b8 08 00 00 00       	mov    $0x8,%eax
+ 78a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 791:	74 09                	je     79c <fstat+0x17>
+ 793:	89 e1                	mov    %esp,%ecx
+ 795:	ba 9e 07 00 00       	mov    $0x79e,%edx
+ 79a:	0f 34                	sysenter
+ 79c:	cd 40                	int    $0x40
+ 79e:	c3                   	ret
+
+0000079f <link>:
+SYSCALL(link)
+ 79f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ab:	74 09                	je     7b6 <link+0x17>
+ 7ad:	89 e1                	mov    %esp,%ecx
+ 7af:	ba b8 07 00 00       	mov    $0x7b8,%edx
+ 7b4:	0f 34                	sysenter
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <mkdir>:
+SYSCALL(mkdir)
+ 7b9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c5:	74 09                	je     7d0 <mkdir+0x17>
+ 7c7:	89 e1                	mov    %esp,%ecx
+ 7c9:	ba d2 07 00 00       	mov    $0x7d2,%edx
+ 7ce:	0f 34                	sysenter
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <chdir>:
+SYSCALL(chdir)
+ 7d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7df:	74 09                	je     7ea <chdir+0x17>
+ 7e1:	89 e1                	mov    %esp,%ecx
+ 7e3:	ba ec 07 00 00       	mov    $0x7ec,%edx
+ 7e8:	0f 34                	sysenter
+ 7ea:	cd 40                	int    $0x40
+ 7ec:	c3                   	ret
+
+000007ed <dup>:
+SYSCALL(dup)
+ 7ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f9:	74 09                	je     804 <dup+0x17>
+ 7fb:	89 e1                	mov    %esp,%ecx
+ 7fd:	ba 06 08 00 00       	mov    $0x806,%edx
+ 802:	0f 34                	sysenter
+ 804:	cd 40                	int    $0x40
+ 806:	c3                   	ret
+
+00000807 <getpid>:
+SYSCALL(getpid)
+ 807:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 813:	74 09                	je     81e <getpid+0x17>
+ 815:	89 e1                	mov    %esp,%ecx
+ 817:	ba 20 08 00 00       	mov    $0x820,%edx
+ 81c:	0f 34                	sysenter
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <sbrk>:
+SYSCALL(sbrk)
+ 821:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 826:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 82d:	74 09                	je     838 <sbrk+0x17>
+ 82f:	89 e1                	mov    %esp,%ecx
+ 831:	ba 3a 08 00 00       	mov    $0x83a,%edx
+ 836:	0f 34                	sysenter
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <sleep>:
+SYSCALL(sleep)
+ 83b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 840:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 847:	74 09                	je     852 <sleep+0x17>
+ 849:	89 e1                	mov    %esp,%ecx
+ 84b:	ba 54 08 00 00       	mov    $0x854,%edx
+ 850:	0f 34                	sysenter
+ 852:	cd 40                	int    $0x40
+ 854:	c3                   	ret
+
+00000855 <uptime>:
+SYSCALL(uptime)
+ 855:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 85a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 861:	74 09                	je     86c <uptime+0x17>
+ 863:	89 e1                	mov    %esp,%ecx
+ 865:	ba 6e 08 00 00       	mov    $0x86e,%edx
+ 86a:	0f 34                	sysenter
+ 86c:	cd 40                	int    $0x40
+ 86e:	c3                   	ret
+
+0000086f <mmap>:
+SYSCALL(mmap)
+ 86f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 874:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 87b:	74 09                	je     886 <mmap+0x17>
+ 87d:	89 e1                	mov    %esp,%ecx
+ 87f:	ba 88 08 00 00       	mov    $0x888,%edx
+ 884:	0f 34                	sysenter
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <munmap>:
+SYSCALL(munmap)
+ 889:	b8 17 00 00 00       	mov    $0x17,%eax
+ 88e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 895:	74 09                	je     8a0 <munmap+0x17>
+ 897:	89 e1                	mov    %esp,%ecx
+ 899:	ba a2 08 00 00       	mov    $0x8a2,%edx
+ 89e:	0f 34                	sysenter
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <clone>:
+SYSCALL(clone)
+ 8a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8a8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8af:	74 09                	je     8ba <clone+0x17>
+ 8b1:	89 e1                	mov    %esp,%ecx
+ 8b3:	ba bc 08 00 00       	mov    $0x8bc,%edx
+ 8b8:	0f 34                	sysenter
+ 8ba:	cd 40                	int    $0x40
+ 8bc:	c3                   	ret
+
+000008bd <join>:
+SYSCALL(join)
+ 8bd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8c2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c9:	74 09                	je     8d4 <join+0x17>
+ 8cb:	89 e1                	mov    %esp,%ecx
+ 8cd:	ba d6 08 00 00       	mov    $0x8d6,%edx
+ 8d2:	0f 34                	sysenter
+ 8d4:	cd 40                	int    $0x40
+ 8d6:	c3                   	ret
+
+000008d7 <futex>:
+SYSCALL(futex)
+ 8d7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8dc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8e3:	74 09                	je     8ee <futex+0x17>
+ 8e5:	89 e1                	mov    %esp,%ecx
+ 8e7:	ba f0 08 00 00       	mov    $0x8f0,%edx
+ 8ec:	0f 34                	sysenter
+ 8ee:	cd 40                	int    $0x40
+ 8f0:	c3                   	ret
+
+000008f1 <memstat>:
+SYSCALL(memstat)
+ 8f1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8f6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8fd:	74 09                	je     908 <memstat+0x17>
+ 8ff:	89 e1                	mov    %esp,%ecx
+ 901:	ba 0a 09 00 00       	mov    $0x90a,%edx
+ 906:	0f 34                	sysenter
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+0000090b <nice>:
+SYSCALL(nice)
+ 90b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 910:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 917:	74 09                	je     922 <nice+0x17>
+ 919:	89 e1                	mov    %esp,%ecx
+ 91b:	ba 24 09 00 00       	mov    $0x924,%edx
+ 920:	0f 34                	sysenter
+ 922:	cd 40                	int    $0x40
+ 924:	c3                   	ret
+
+00000925 <setpriority>:
+SYSCALL(setpriority)
+ 925:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 92a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 931:	74 09                	je     93c <setpriority+0x17>
+ 933:	89 e1                	mov    %esp,%ecx
+ 935:	ba 3e 09 00 00       	mov    $0x93e,%edx
+ 93a:	0f 34                	sysenter
+ 93c:	cd 40                	int    $0x40
+ 93e:	c3                   	ret
+
+0000093f <getpinfo>:
+SYSCALL(getpinfo)
+ 93f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 944:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 94b:	74 09                	je     956 <getpinfo+0x17>
+ 94d:	89 e1                	mov    %esp,%ecx
+ 94f:	ba 58 09 00 00       	mov    $0x958,%edx
+ 954:	0f 34                	sysenter
+ 956:	cd 40                	int    $0x40
+ 958:	c3                   	ret
+
+00000959 <settickets>:
+SYSCALL(settickets)
+ 959:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 95e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 965:	74 09                	je     970 <settickets+0x17>
+ 967:	89 e1                	mov    %esp,%ecx
+ 969:	ba 72 09 00 00       	mov    $0x972,%edx
+ 96e:	0f 34                	sysenter
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 973:	b8 20 00 00 00       	mov    $0x20,%eax
+ 978:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 97f:	74 09                	je     98a <clock_gettime+0x17>
+ 981:	89 e1                	mov    %esp,%ecx
+ 983:	ba 8c 09 00 00       	mov    $0x98c,%edx
+ 988:	0f 34                	sysenter
+ 98a:	cd 40                	int    $0x40
+ 98c:	c3                   	ret
+
+0000098d <batch>:
+SYSCALL(batch)
+ 98d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 992:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 999:	74 09                	je     9a4 <batch+0x17>
+ 99b:	89 e1                	mov    %esp,%ecx
+ 99d:	ba a6 09 00 00       	mov    $0x9a6,%edx
+ 9a2:	0f 34                	sysenter
+ 9a4:	cd 40                	int    $0x40
+ 9a6:	c3                   	ret
+
+000009a7 <aiosetup>:
+SYSCALL(aiosetup)
+ 9a7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9ac:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9b3:	74 09                	je     9be <aiosetup+0x17>
+ 9b5:	89 e1                	mov    %esp,%ecx
+ 9b7:	ba c0 09 00 00       	mov    $0x9c0,%edx
+ 9bc:	0f 34                	sysenter
+ 9be:	cd 40                	int    $0x40
+ 9c0:	c3                   	ret
+
+000009c1 <aioenter>:
+SYSCALL(aioenter)
+ 9c1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9c6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9cd:	74 09                	je     9d8 <aioenter+0x17>
+ 9cf:	89 e1                	mov    %esp,%ecx
+ 9d1:	ba da 09 00 00       	mov    $0x9da,%edx
+ 9d6:	0f 34                	sysenter
+ 9d8:	cd 40                	int    $0x40
+ 9da:	c3                   	ret
+
+000009db <systrace>:
+SYSCALL(systrace)
+ 9db:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9e0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9e7:	74 09                	je     9f2 <systrace+0x17>
+ 9e9:	89 e1                	mov    %esp,%ecx
+ 9eb:	ba f4 09 00 00       	mov    $0x9f4,%edx
+ 9f0:	0f 34                	sysenter
+ 9f2:	cd 40                	int    $0x40
+ 9f4:	c3                   	ret
+
+000009f5 <sysstat>:
+SYSCALL(sysstat)
+ 9f5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9fa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a01:	74 09                	je     a0c <sysstat+0x17>
+ a03:	89 e1                	mov    %esp,%ecx
+ a05:	ba 0e 0a 00 00       	mov    $0xa0e,%edx
+ a0a:	0f 34                	sysenter
+ a0c:	cd 40                	int    $0x40
+ a0e:	c3                   	ret
+
+00000a0f <traceread>:
+SYSCALL(traceread)
+ a0f:	b8 26 00 00 00       	mov    $0x26,%eax
+ a14:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a1b:	74 09                	je     a26 <traceread+0x17>
+ a1d:	89 e1                	mov    %esp,%ecx
+ a1f:	ba 28 0a 00 00       	mov    $0xa28,%edx
+ a24:	0f 34                	sysenter
+ a26:	cd 40                	int    $0x40
+ a28:	c3                   	ret
@@ -119,12 +119,13 @@ bfree(int dev, uint b)
 //   is non-zero. ialloc() allocates, and iput() frees if
 //   the reference and link counts have fallen to zero.
 //
-// * Referencing in cache: an entry in the inode cache
-//   is free if ip->ref is zero. Otherwise ip->ref tracks
-//   the number of in-memory pointers to the entry (open
-//   files and current directories). iget() finds or
-//   creates a cache entry and increments its ref; iput()
-//   decrements ref.
+// * Referencing in cache: ip->ref tracks the number of
+//   in-memory pointers to a cache entry (open files and
+//   current directories). iget() finds or creates a cache
+//   entry and increments its ref; iput() decrements ref.
+//   An entry whose ref has fallen to zero stays cached, so
+//   that looking it up again need not read the disk, until
+//   iget() reuses it or iput() returns it to the slab cache.
 //
 // * Valid: the information (type, size, &c) in an inode
 //   cache entry is only correct when ip->valid is 1.
@@ -154,8 +155,8 @@ bfree(int dev, uint b)
 // have locked the inodes involved; this lets callers create
 // multi-step atomic operations.
 //
-// The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
+// The icache.lock spin-lock protects the list of icache
+// entries. Since ip->ref indicates whether an entry is in use,
 // and ip->dev and ip->inum indicate which i-node an entry
 // holds, one must hold icache.lock while using any of those fields.
 //
@@ -163,21 +164,44 @@ bfree(int dev, uint b)
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+// Entries come from a slab cache, without a fixed limit: every
+// referenced inode is held by an open file (at most NFILE), a
+// process's cwd (at most NPROC) or a system call in progress.
+// Unreferenced entries are kept while there are at most NINODE
+// entries in all; past that an entry is freed when its last
+// reference goes, so the cache holds no unreferenced entries
+// while it is over NINODE.
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  // Linked list of all entries, through prev/next.
+  // head.next is most recently released.
+  struct inode head;
+  int n;                    // entries on the list
+  struct kmem_cache *cache;
 } icache;
 
+// Inodes come from icache.cache with their sleep-lock
+// initialized and released.
+static void
+inodector(void *v)
+{
+  struct inode *ip = v;
+
+  initsleeplock(&ip->lock, "inode");
+}
+
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-  
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  icache.head.prev = &icache.head;
+  icache.head.next = &icache.head;
+  icache.cache = kmem_cache_create("inode", sizeof(struct inode), inodector);
+}
 
+void
+iinit(int dev)
+{
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
@@ -202,6 +226,7 @@ ialloc(uint dev, short type)
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
+      excacheinval(dev, inum);
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
       log_write(bp);   // mark it allocated on the disk
@@ -246,21 +271,34 @@ iget(uint dev, uint inum)
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+  for(ip = icache.head.next; ip != &icache.head; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
+  // Not cached; recycle the least recently used unreferenced
+  // entry if the cache is full, or else allocate a new one.
+  empty = 0;
+  if(icache.n >= NINODE){
+    for(ip = icache.head.prev; ip != &icache.head; ip = ip->prev){
+      if(ip->ref == 0){
+        empty = ip;
+        break;
+      }
+    }
+  }
+  if(empty == 0){
+    if((empty = kmem_cache_alloc(icache.cache)) == 0)
+      panic("iget: no inodes");
+    empty->next = icache.head.next;
+    empty->prev = &icache.head;
+    icache.head.next->prev = empty;
+    icache.head.next = empty;
+    icache.n++;
+  }
   ip = empty;
   ip->dev = dev;
   ip->inum = inum;
@@ -322,8 +360,8 @@ iunlock(struct inode *ip)
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry is
+// freed.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 // All calls to iput() must be inside a transaction in
@@ -347,7 +385,24 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref > 0){
+    release(&icache.lock);
+    return;
+  }
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+  if(icache.n > NINODE){
+    // Over the limit, so ip is the only unreferenced entry.
+    icache.n--;
+    release(&icache.lock);
+    kmem_cache_free(icache.cache, ip);
+    return;
+  }
+  // Keep ip cached, as the most recently released.
+  ip->next = icache.head.next;
+  ip->prev = &icache.head;
+  icache.head.next->prev = ip;
+  icache.head.next = ip;
   release(&icache.lock);
 }
 
@@ -411,6 +466,7 @@ itrunc(struct inode *ip)
   struct buf *bp;
   uint *a;
 
+  excacheinval(ip->dev, ip->inum);
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
       bfree(ip->dev, ip->addrs[i]);
@@ -495,6 +551,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
   if(off + n > MAXFILE*BSIZE)
     return -1;
 
+  excacheinval(ip->dev, ip->inum);
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
     bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
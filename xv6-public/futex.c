@@ -0,0 +1,150 @@
+// Fast user-space mutexes.
+//
+// A futex is an aligned user word.  FUTEX_WAIT sleeps only if the
+// word still holds the expected value; FUTEX_WAKE wakes waiters.
+// Waiters are keyed by the physical address of the word, so
+// processes that share a page through MAP_SHARED (or threads that
+// share an address space) meet on the same key even if they map it
+// at different virtual addresses.
+//
+// Waiters live on the waiting process's kernel stack and are kept
+// in a small hash table, so a wake touches only the waiters in one
+// bucket rather than every process in the system.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define NFUTEXHASH 64
+
+struct futexwaiter {
+  uint key;                  // physical address of the futex word
+  struct proc *proc;
+  int woken;
+  struct futexwaiter *next;
+};
+
+struct futexbucket {
+  struct spinlock lock;
+  struct futexwaiter *head;
+};
+
+static struct futexbucket futextab[NFUTEXHASH];
+
+void
+futexinit(void)
+{
+  int i;
+
+  for(i = 0; i < NFUTEXHASH; i++)
+    initlock(&futextab[i].lock, "futex");
+}
+
+// Translate user address uva in the current process to the
+// kernel address of the word it names, or 0 if the word is not
+// aligned or not mapped.
+static uint*
+futexword(uint uva)
+{
+  char *ka;
+
+  if(uva % sizeof(uint) != 0 || uva >= KERNBASE)
+    return 0;
+  if((ka = uva2ka(myproc()->pgdir, (char*)PGROUNDDOWN(uva))) == 0)
+    return 0;
+  return (uint*)(ka + (uva - PGROUNDDOWN(uva)));
+}
+
+static struct futexbucket*
+futexbucket(uint key)
+{
+  return &futextab[(key >> 2) % NFUTEXHASH];
+}
+
+// Remove w from bucket b.  Caller holds b->lock.
+static void
+futexunlink(struct futexbucket *b, struct futexwaiter *w)
+{
+  struct futexwaiter **pp;
+
+  for(pp = &b->head; *pp; pp = &(*pp)->next){
+    if(*pp == w){
+      *pp = w->next;
+      return;
+    }
+  }
+}
+
+// Sleep until woken by futexwake() if the word at uva holds val.
+// Returns 0 when woken, -1 if the word did not hold val, could
+// not be accessed, or the process was killed.
+int
+futexwait(uint uva, uint val)
+{
+  struct futexbucket *b;
+  struct futexwaiter w;
+  struct futexwaiter **pp;
+  uint *word;
+
+  if((word = futexword(uva)) == 0)
+    return -1;
+  w.key = V2P(word);
+  w.proc = myproc();
+  w.woken = 0;
+  b = futexbucket(w.key);
+
+  acquire(&b->lock);
+  // Checking the word under the bucket lock closes the window
+  // against a waker that changes it and calls futexwake().
+  if(*word != val){
+    release(&b->lock);
+    return -1;
+  }
+  // Queue at the tail so waiters are woken in FIFO order.
+  for(pp = &b->head; *pp; pp = &(*pp)->next)
+    ;
+  w.next = 0;
+  *pp = &w;
+  while(!w.woken && !myproc()->killed)
+    sleep(&w, &b->lock);
+  if(!w.woken)
+    futexunlink(b, &w);
+  release(&b->lock);
+  return w.woken ? 0 : -1;
+}
+
+// Wake up to n processes waiting on the word at uva.
+// Returns the number woken, or -1 if uva is bad.
+int
+futexwake(uint uva, int n)
+{
+  struct futexbucket *b;
+  struct futexwaiter **pp, *w;
+  uint *word, key;
+  int woken;
+
+  if((word = futexword(uva)) == 0)
+    return -1;
+  key = V2P(word);
+  b = futexbucket(key);
+  woken = 0;
+
+  acquire(&b->lock);
+  for(pp = &b->head; *pp && woken < n; ){
+    w = *pp;
+    if(w->key != key){
+      pp = &w->next;
+      continue;
+    }
+    *pp = w->next;
+    w->woken = 1;
+    wakeproc(w->proc, w);
+    woken++;
+  }
+  release(&b->lock);
+  return woken;
+}
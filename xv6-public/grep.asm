@@ -0,0 +1,2434 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+      21:	8b 43 04             	mov    0x4(%ebx),%eax
+      24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+      27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+      2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+      30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+      33:	75 2d                	jne    62 <main+0x62>
+      35:	eb 6c                	jmp    a3 <main+0xa3>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+      40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+      43:	83 c6 01             	add    $0x1,%esi
+      46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+      49:	50                   	push   %eax
+      4a:	ff 75 e0             	push   -0x20(%ebp)
+      4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+      52:	89 3c 24             	mov    %edi,(%esp)
+      55:	e8 0f 09 00 00       	call   969 <close>
+  for(i = 2; i < argc; i++){
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+      62:	83 ec 08             	sub    $0x8,%esp
+      65:	6a 00                	push   $0x0
+      67:	ff 33                	push   (%ebx)
+      69:	e8 49 09 00 00       	call   9b7 <open>
+      6e:	83 c4 10             	add    $0x10,%esp
+      71:	89 c7                	mov    %eax,%edi
+      73:	85 c0                	test   %eax,%eax
+      75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      77:	50                   	push   %eax
+      78:	ff 33                	push   (%ebx)
+      7a:	68 50 11 00 00       	push   $0x1150
+      7f:	6a 01                	push   $0x1
+      81:	e8 ca 0c 00 00       	call   d50 <printf>
+      exit();
+      86:	e8 5c 08 00 00       	call   8e7 <exit>
+  }
+  exit();
+      8b:	e8 57 08 00 00       	call   8e7 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+      90:	51                   	push   %ecx
+      91:	51                   	push   %ecx
+      92:	68 30 11 00 00       	push   $0x1130
+      97:	6a 02                	push   $0x2
+      99:	e8 b2 0c 00 00       	call   d50 <printf>
+    exit();
+      9e:	e8 44 08 00 00       	call   8e7 <exit>
+    grep(pattern, 0);
+      a3:	52                   	push   %edx
+      a4:	52                   	push   %edx
+      a5:	6a 00                	push   $0x0
+      a7:	50                   	push   %eax
+      a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+      ad:	e8 35 08 00 00       	call   8e7 <exit>
+      b2:	66 90                	xchg   %ax,%ax
+      b4:	66 90                	xchg   %ax,%ax
+      b6:	66 90                	xchg   %ax,%ax
+      b8:	66 90                	xchg   %ax,%ax
+      ba:	66 90                	xchg   %ax,%ax
+      bc:	66 90                	xchg   %ax,%ax
+      be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+      c0:	55                   	push   %ebp
+      c1:	89 e5                	mov    %esp,%ebp
+      c3:	57                   	push   %edi
+      c4:	56                   	push   %esi
+      c5:	53                   	push   %ebx
+      c6:	83 ec 0c             	sub    $0xc,%esp
+      c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+      cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+      cf:	0f b6 0f             	movzbl (%edi),%ecx
+      d2:	84 c9                	test   %cl,%cl
+      d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+      da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+      de:	3c 2a                	cmp    $0x2a,%al
+      e0:	74 2d                	je     10f <matchhere+0x4f>
+      e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+      e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+      eb:	80 f9 24             	cmp    $0x24,%cl
+      ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+      f0:	89 f2                	mov    %esi,%edx
+      f2:	84 d2                	test   %dl,%dl
+      f4:	74 6e                	je     164 <matchhere+0xa4>
+      f6:	80 f9 2e             	cmp    $0x2e,%cl
+      f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+      fb:	83 c3 01             	add    $0x1,%ebx
+      fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     101:	84 c0                	test   %al,%al
+     103:	74 6b                	je     170 <matchhere+0xb0>
+     105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+     107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+     10b:	3c 2a                	cmp    $0x2a,%al
+     10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+     10f:	8d 77 02             	lea    0x2(%edi),%esi
+     112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+     115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+     118:	83 ec 08             	sub    $0x8,%esp
+     11b:	53                   	push   %ebx
+     11c:	56                   	push   %esi
+     11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+     122:	83 c4 10             	add    $0x10,%esp
+     125:	85 c0                	test   %eax,%eax
+     127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     129:	0f be 13             	movsbl (%ebx),%edx
+     12c:	84 d2                	test   %dl,%dl
+     12e:	74 45                	je     175 <matchhere+0xb5>
+     130:	83 c3 01             	add    $0x1,%ebx
+     133:	39 fa                	cmp    %edi,%edx
+     135:	74 e1                	je     118 <matchhere+0x58>
+     137:	83 ff 2e             	cmp    $0x2e,%edi
+     13a:	74 dc                	je     118 <matchhere+0x58>
+     13c:	eb 37                	jmp    175 <matchhere+0xb5>
+     13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+     140:	84 c0                	test   %al,%al
+     142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     144:	89 f2                	mov    %esi,%edx
+     146:	84 d2                	test   %dl,%dl
+     148:	74 1a                	je     164 <matchhere+0xa4>
+     14a:	80 fa 24             	cmp    $0x24,%dl
+     14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+     14f:	83 c3 01             	add    $0x1,%ebx
+     152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+     155:	89 c1                	mov    %eax,%ecx
+     157:	eb ae                	jmp    107 <matchhere+0x47>
+     159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+     160:	38 ca                	cmp    %cl,%dl
+     162:	74 97                	je     fb <matchhere+0x3b>
+}
+     164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+     167:	31 c0                	xor    %eax,%eax
+}
+     169:	5b                   	pop    %ebx
+     16a:	5e                   	pop    %esi
+     16b:	5f                   	pop    %edi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+    return 1;
+     170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     178:	5b                   	pop    %ebx
+     179:	5e                   	pop    %esi
+     17a:	5f                   	pop    %edi
+     17b:	5d                   	pop    %ebp
+     17c:	c3                   	ret
+    return *text == '\0';
+     17d:	89 f0                	mov    %esi,%eax
+     17f:	84 c0                	test   %al,%al
+     181:	0f 94 c0             	sete   %al
+     184:	0f b6 c0             	movzbl %al,%eax
+     187:	eb ec                	jmp    175 <matchhere+0xb5>
+     189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+     19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+     19e:	75 11                	jne    1b1 <match+0x21>
+     1a0:	eb 2e                	jmp    1d0 <match+0x40>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+     1a8:	83 c6 01             	add    $0x1,%esi
+     1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+     1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+     1b1:	83 ec 08             	sub    $0x8,%esp
+     1b4:	56                   	push   %esi
+     1b5:	53                   	push   %ebx
+     1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+     1bb:	83 c4 10             	add    $0x10,%esp
+     1be:	85 c0                	test   %eax,%eax
+     1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+     1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1ca:	5b                   	pop    %ebx
+     1cb:	5e                   	pop    %esi
+     1cc:	5d                   	pop    %ebp
+     1cd:	c3                   	ret
+     1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+     1d0:	83 c3 01             	add    $0x1,%ebx
+     1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     1d9:	5b                   	pop    %ebx
+     1da:	5e                   	pop    %esi
+     1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+     1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+     1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+     1f0:	55                   	push   %ebp
+     1f1:	89 e5                	mov    %esp,%ebp
+     1f3:	57                   	push   %edi
+  m = 0;
+     1f4:	31 ff                	xor    %edi,%edi
+{
+     1f6:	56                   	push   %esi
+     1f7:	53                   	push   %ebx
+     1f8:	83 ec 1c             	sub    $0x1c,%esp
+     1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+     201:	8d 43 01             	lea    0x1(%ebx),%eax
+     204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+     210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+     218:	83 ec 04             	sub    $0x4,%esp
+     21b:	29 c8                	sub    %ecx,%eax
+     21d:	50                   	push   %eax
+     21e:	8d 81 40 17 00 00    	lea    0x1740(%ecx),%eax
+     224:	50                   	push   %eax
+     225:	ff 75 0c             	push   0xc(%ebp)
+     228:	e8 08 07 00 00       	call   935 <read>
+     22d:	83 c4 10             	add    $0x10,%esp
+     230:	85 c0                	test   %eax,%eax
+     232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+     238:	01 45 e0             	add    %eax,-0x20(%ebp)
+     23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+     23e:	bf 40 17 00 00       	mov    $0x1740,%edi
+     243:	89 de                	mov    %ebx,%esi
+     245:	c6 81 40 17 00 00 00 	movb   $0x0,0x1740(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+     24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     250:	83 ec 08             	sub    $0x8,%esp
+     253:	6a 0a                	push   $0xa
+     255:	57                   	push   %edi
+     256:	e8 25 02 00 00       	call   480 <strchr>
+     25b:	83 c4 10             	add    $0x10,%esp
+     25e:	89 c2                	mov    %eax,%edx
+     260:	85 c0                	test   %eax,%eax
+     262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+     268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+     26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+     26e:	74 58                	je     2c8 <grep+0xd8>
+     270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     273:	89 d3                	mov    %edx,%ebx
+     275:	eb 12                	jmp    289 <grep+0x99>
+     277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+     280:	83 c7 01             	add    $0x1,%edi
+     283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+     287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+     289:	83 ec 08             	sub    $0x8,%esp
+     28c:	57                   	push   %edi
+     28d:	56                   	push   %esi
+     28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+     293:	83 c4 10             	add    $0x10,%esp
+     296:	85 c0                	test   %eax,%eax
+     298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+     29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     29d:	89 da                	mov    %ebx,%edx
+     29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+     2a2:	89 d8                	mov    %ebx,%eax
+     2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+     2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+     2aa:	29 f8                	sub    %edi,%eax
+     2ac:	50                   	push   %eax
+     2ad:	57                   	push   %edi
+     2ae:	89 df                	mov    %ebx,%edi
+     2b0:	6a 01                	push   $0x1
+     2b2:	e8 98 06 00 00       	call   94f <write>
+     2b7:	83 c4 10             	add    $0x10,%esp
+     2ba:	eb 94                	jmp    250 <grep+0x60>
+     2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+     2c3:	eb 8b                	jmp    250 <grep+0x60>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     2ce:	57                   	push   %edi
+     2cf:	ff 75 dc             	push   -0x24(%ebp)
+     2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+     2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+     2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+     2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+     2e4:	89 df                	mov    %ebx,%edi
+     2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+     2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ef:	90                   	nop
+    if(p == buf)
+     2f0:	89 f3                	mov    %esi,%ebx
+     2f2:	81 ff 40 17 00 00    	cmp    $0x1740,%edi
+     2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+     2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     2fd:	85 c0                	test   %eax,%eax
+     2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+     305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+     307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+     30a:	2d 40 17 00 00       	sub    $0x1740,%eax
+     30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+     312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+     315:	51                   	push   %ecx
+     316:	57                   	push   %edi
+     317:	68 40 17 00 00       	push   $0x1740
+     31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+     321:	83 c4 10             	add    $0x10,%esp
+     324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+     329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+     335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     338:	5b                   	pop    %ebx
+     339:	5e                   	pop    %esi
+     33a:	5f                   	pop    %edi
+     33b:	5d                   	pop    %ebp
+     33c:	c3                   	ret
+     33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	57                   	push   %edi
+     344:	56                   	push   %esi
+     345:	53                   	push   %ebx
+     346:	83 ec 0c             	sub    $0xc,%esp
+     349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+     34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+     352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	57                   	push   %edi
+     35c:	56                   	push   %esi
+     35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+     362:	83 c4 10             	add    $0x10,%esp
+     365:	85 c0                	test   %eax,%eax
+     367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+     369:	0f be 17             	movsbl (%edi),%edx
+     36c:	84 d2                	test   %dl,%dl
+     36e:	74 0c                	je     37c <matchstar+0x3c>
+     370:	83 c7 01             	add    $0x1,%edi
+     373:	39 da                	cmp    %ebx,%edx
+     375:	74 e1                	je     358 <matchstar+0x18>
+     377:	83 fb 2e             	cmp    $0x2e,%ebx
+     37a:	74 dc                	je     358 <matchstar+0x18>
+}
+     37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     37f:	5b                   	pop    %ebx
+     380:	5e                   	pop    %esi
+     381:	5f                   	pop    %edi
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+     384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+     38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+     390:	5b                   	pop    %ebx
+     391:	5e                   	pop    %esi
+     392:	5f                   	pop    %edi
+     393:	5d                   	pop    %ebp
+     394:	c3                   	ret
+     395:	66 90                	xchg   %ax,%ax
+     397:	66 90                	xchg   %ax,%ax
+     399:	66 90                	xchg   %ax,%ax
+     39b:	66 90                	xchg   %ax,%ax
+     39d:	66 90                	xchg   %ax,%ax
+     39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3a1:	31 c0                	xor    %eax,%eax
+{
+     3a3:	89 e5                	mov    %esp,%ebp
+     3a5:	53                   	push   %ebx
+     3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     3b7:	83 c0 01             	add    $0x1,%eax
+     3ba:	84 d2                	test   %dl,%dl
+     3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+     3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c1:	89 c8                	mov    %ecx,%eax
+     3c3:	c9                   	leave
+     3c4:	c3                   	ret
+     3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	53                   	push   %ebx
+     3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+     3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     3da:	0f b6 02             	movzbl (%edx),%eax
+     3dd:	84 c0                	test   %al,%al
+     3df:	75 17                	jne    3f8 <strcmp+0x28>
+     3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+     3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3e7:	90                   	nop
+     3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     3ec:	83 c2 01             	add    $0x1,%edx
+     3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     3f2:	84 c0                	test   %al,%al
+     3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+     3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     3f8:	0f b6 19             	movzbl (%ecx),%ebx
+     3fb:	38 c3                	cmp    %al,%bl
+     3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     3ff:	29 d8                	sub    %ebx,%eax
+}
+     401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     404:	c9                   	leave
+     405:	c3                   	ret
+     406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     414:	31 c0                	xor    %eax,%eax
+     416:	29 d8                	sub    %ebx,%eax
+}
+     418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     41b:	c9                   	leave
+     41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     41d:	0f b6 19             	movzbl (%ecx),%ebx
+     420:	31 c0                	xor    %eax,%eax
+     422:	eb db                	jmp    3ff <strcmp+0x2f>
+     424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     436:	80 3a 00             	cmpb   $0x0,(%edx)
+     439:	74 15                	je     450 <strlen+0x20>
+     43b:	31 c0                	xor    %eax,%eax
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+     440:	83 c0 01             	add    $0x1,%eax
+     443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     447:	89 c1                	mov    %eax,%ecx
+     449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+     44b:	89 c8                	mov    %ecx,%eax
+     44d:	5d                   	pop    %ebp
+     44e:	c3                   	ret
+     44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     450:	31 c9                	xor    %ecx,%ecx
+}
+     452:	5d                   	pop    %ebp
+     453:	89 c8                	mov    %ecx,%eax
+     455:	c3                   	ret
+     456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     46d:	89 d7                	mov    %edx,%edi
+     46f:	fc                   	cld
+     470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     475:	89 d0                	mov    %edx,%eax
+     477:	c9                   	leave
+     478:	c3                   	ret
+     479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	8b 45 08             	mov    0x8(%ebp),%eax
+     486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     48a:	0f b6 10             	movzbl (%eax),%edx
+     48d:	84 d2                	test   %dl,%dl
+     48f:	75 12                	jne    4a3 <strchr+0x23>
+     491:	eb 1d                	jmp    4b0 <strchr+0x30>
+     493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     497:	90                   	nop
+     498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     49c:	83 c0 01             	add    $0x1,%eax
+     49f:	84 d2                	test   %dl,%dl
+     4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+     4a3:	38 d1                	cmp    %dl,%cl
+     4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     4a7:	5d                   	pop    %ebp
+     4a8:	c3                   	ret
+     4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     4b0:	31 c0                	xor    %eax,%eax
+}
+     4b2:	5d                   	pop    %ebp
+     4b3:	c3                   	ret
+     4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     4c9:	31 db                	xor    %ebx,%ebx
+{
+     4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	6a 01                	push   $0x1
+     4d5:	56                   	push   %esi
+     4d6:	6a 00                	push   $0x0
+     4d8:	e8 58 04 00 00       	call   935 <read>
+    if(cc < 1)
+     4dd:	83 c4 10             	add    $0x10,%esp
+     4e0:	85 c0                	test   %eax,%eax
+     4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+     4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     4ef:	3c 0a                	cmp    $0xa,%al
+     4f1:	74 10                	je     503 <gets+0x43>
+     4f3:	3c 0d                	cmp    $0xd,%al
+     4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     4f7:	89 df                	mov    %ebx,%edi
+     4f9:	83 c3 01             	add    $0x1,%ebx
+     4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4ff:	7c cf                	jl     4d0 <gets+0x10>
+     501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     503:	8b 45 08             	mov    0x8(%ebp),%eax
+     506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     50d:	5b                   	pop    %ebx
+     50e:	5e                   	pop    %esi
+     50f:	5f                   	pop    %edi
+     510:	5d                   	pop    %ebp
+     511:	c3                   	ret
+     512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     520:	55                   	push   %ebp
+     521:	89 e5                	mov    %esp,%ebp
+     523:	56                   	push   %esi
+     524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     525:	83 ec 08             	sub    $0x8,%esp
+     528:	6a 00                	push   $0x0
+     52a:	ff 75 08             	push   0x8(%ebp)
+     52d:	e8 85 04 00 00       	call   9b7 <open>
+  if(fd < 0)
+     532:	83 c4 10             	add    $0x10,%esp
+     535:	85 c0                	test   %eax,%eax
+     537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     539:	83 ec 08             	sub    $0x8,%esp
+     53c:	ff 75 0c             	push   0xc(%ebp)
+     53f:	89 c3                	mov    %eax,%ebx
+     541:	50                   	push   %eax
+     542:	e8 be 04 00 00       	call   a05 <fstat>
+  close(fd);
+     547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     54c:	e8 18 04 00 00       	call   969 <close>
+  return r;
+     551:	83 c4 10             	add    $0x10,%esp
+}
+     554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     557:	89 f0                	mov    %esi,%eax
+     559:	5b                   	pop    %ebx
+     55a:	5e                   	pop    %esi
+     55b:	5d                   	pop    %ebp
+     55c:	c3                   	ret
+     55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     565:	eb ed                	jmp    554 <stat+0x34>
+     567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	53                   	push   %ebx
+     574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     577:	0f be 02             	movsbl (%edx),%eax
+     57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     585:	77 1e                	ja     5a5 <atoi+0x35>
+     587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     590:	83 c2 01             	add    $0x1,%edx
+     593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     59a:	0f be 02             	movsbl (%edx),%eax
+     59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     5a0:	80 fb 09             	cmp    $0x9,%bl
+     5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+     5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5a8:	89 c8                	mov    %ecx,%eax
+     5aa:	c9                   	leave
+     5ab:	c3                   	ret
+     5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     5b0:	55                   	push   %ebp
+     5b1:	89 e5                	mov    %esp,%ebp
+     5b3:	57                   	push   %edi
+     5b4:	56                   	push   %esi
+     5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+     5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     5be:	85 c0                	test   %eax,%eax
+     5c0:	7e 13                	jle    5d5 <memmove+0x25>
+     5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     5c4:	89 d7                	mov    %edx,%edi
+     5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     5d1:	39 f8                	cmp    %edi,%eax
+     5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+     5d5:	5e                   	pop    %esi
+     5d6:	89 d0                	mov    %edx,%eax
+     5d8:	5f                   	pop    %edi
+     5d9:	5d                   	pop    %ebp
+     5da:	c3                   	ret
+     5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5df:	90                   	nop
+
+000005e0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     5ec:	5d                   	pop    %ebp
+     5ed:	c3                   	ret
+     5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     5f0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     5f1:	31 c0                	xor    %eax,%eax
+     5f3:	ba 01 00 00 00       	mov    $0x1,%edx
+     5f8:	89 e5                	mov    %esp,%ebp
+     5fa:	56                   	push   %esi
+     5fb:	53                   	push   %ebx
+     5fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     5ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     603:	85 c0                	test   %eax,%eax
+     605:	74 32                	je     639 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+     607:	83 f8 02             	cmp    $0x2,%eax
+     60a:	74 0c                	je     618 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     60c:	b8 02 00 00 00       	mov    $0x2,%eax
+     611:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     614:	85 c0                	test   %eax,%eax
+     616:	74 21                	je     639 <mutex_lock+0x49>
+     618:	be 02 00 00 00       	mov    $0x2,%esi
+     61d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     620:	83 ec 04             	sub    $0x4,%esp
+     623:	6a 02                	push   $0x2
+     625:	6a 00                	push   $0x0
+     627:	53                   	push   %ebx
+     628:	e8 2a 05 00 00       	call   b57 <futex>
+     62d:	89 f0                	mov    %esi,%eax
+     62f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     632:	83 c4 10             	add    $0x10,%esp
+     635:	85 c0                	test   %eax,%eax
+     637:	75 e7                	jne    620 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     639:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     63c:	5b                   	pop    %ebx
+     63d:	5e                   	pop    %esi
+     63e:	5d                   	pop    %ebp
+     63f:	c3                   	ret
+
+00000640 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     640:	55                   	push   %ebp
+     641:	31 c0                	xor    %eax,%eax
+     643:	89 e5                	mov    %esp,%ebp
+     645:	83 ec 08             	sub    $0x8,%esp
+     648:	8b 55 08             	mov    0x8(%ebp),%edx
+     64b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     64e:	83 f8 02             	cmp    $0x2,%eax
+     651:	74 05                	je     658 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     653:	c9                   	leave
+     654:	c3                   	ret
+     655:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     658:	83 ec 04             	sub    $0x4,%esp
+     65b:	6a 01                	push   $0x1
+     65d:	6a 01                	push   $0x1
+     65f:	52                   	push   %edx
+     660:	e8 f2 04 00 00       	call   b57 <futex>
+     665:	83 c4 10             	add    $0x10,%esp
+}
+     668:	c9                   	leave
+     669:	c3                   	ret
+     66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000670 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     670:	55                   	push   %ebp
+     671:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     673:	8b 45 08             	mov    0x8(%ebp),%eax
+     676:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     67c:	5d                   	pop    %ebp
+     67d:	c3                   	ret
+     67e:	66 90                	xchg   %ax,%ax
+
+00000680 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     680:	55                   	push   %ebp
+     681:	31 c0                	xor    %eax,%eax
+     683:	89 e5                	mov    %esp,%ebp
+     685:	57                   	push   %edi
+     686:	56                   	push   %esi
+     687:	53                   	push   %ebx
+     688:	83 ec 0c             	sub    $0xc,%esp
+     68b:	8b 75 08             	mov    0x8(%ebp),%esi
+     68e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     691:	8b 3e                	mov    (%esi),%edi
+     693:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     696:	83 f8 02             	cmp    $0x2,%eax
+     699:	74 5d                	je     6f8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     69b:	83 ec 04             	sub    $0x4,%esp
+     69e:	57                   	push   %edi
+     69f:	6a 00                	push   $0x0
+     6a1:	56                   	push   %esi
+     6a2:	e8 b0 04 00 00       	call   b57 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+     6a7:	31 c0                	xor    %eax,%eax
+     6a9:	ba 01 00 00 00       	mov    $0x1,%edx
+     6ae:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     6b2:	83 c4 10             	add    $0x10,%esp
+     6b5:	85 c0                	test   %eax,%eax
+     6b7:	74 30                	je     6e9 <cond_wait+0x69>
+  if(c != 2)
+     6b9:	83 f8 02             	cmp    $0x2,%eax
+     6bc:	74 0c                	je     6ca <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+     6be:	b8 02 00 00 00       	mov    $0x2,%eax
+     6c3:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     6c6:	85 c0                	test   %eax,%eax
+     6c8:	74 1f                	je     6e9 <cond_wait+0x69>
+     6ca:	be 02 00 00 00       	mov    $0x2,%esi
+     6cf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+     6d0:	83 ec 04             	sub    $0x4,%esp
+     6d3:	6a 02                	push   $0x2
+     6d5:	6a 00                	push   $0x0
+     6d7:	53                   	push   %ebx
+     6d8:	e8 7a 04 00 00       	call   b57 <futex>
+     6dd:	89 f0                	mov    %esi,%eax
+     6df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     6e2:	83 c4 10             	add    $0x10,%esp
+     6e5:	85 c0                	test   %eax,%eax
+     6e7:	75 e7                	jne    6d0 <cond_wait+0x50>
+  mutex_lock(m);
+}
+     6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6ec:	5b                   	pop    %ebx
+     6ed:	5e                   	pop    %esi
+     6ee:	5f                   	pop    %edi
+     6ef:	5d                   	pop    %ebp
+     6f0:	c3                   	ret
+     6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     6f8:	83 ec 04             	sub    $0x4,%esp
+     6fb:	6a 01                	push   $0x1
+     6fd:	6a 01                	push   $0x1
+     6ff:	53                   	push   %ebx
+     700:	e8 52 04 00 00       	call   b57 <futex>
+     705:	83 c4 10             	add    $0x10,%esp
+     708:	eb 91                	jmp    69b <cond_wait+0x1b>
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	53                   	push   %ebx
+     714:	83 ec 04             	sub    $0x4,%esp
+     717:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     71a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     720:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     722:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+     725:	89 c8                	mov    %ecx,%eax
+     727:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     72b:	39 c1                	cmp    %eax,%ecx
+     72d:	75 f1                	jne    720 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+     72f:	83 ec 04             	sub    $0x4,%esp
+     732:	6a 01                	push   $0x1
+     734:	6a 01                	push   $0x1
+     736:	52                   	push   %edx
+     737:	e8 1b 04 00 00       	call   b57 <futex>
+}
+     73c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     73f:	83 c4 10             	add    $0x10,%esp
+     742:	c9                   	leave
+     743:	c3                   	ret
+     744:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+
+00000750 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	53                   	push   %ebx
+     754:	83 ec 04             	sub    $0x4,%esp
+     757:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     760:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     762:	8d 59 01             	lea    0x1(%ecx),%ebx
+     765:	89 c8                	mov    %ecx,%eax
+     767:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     76b:	39 c1                	cmp    %eax,%ecx
+     76d:	75 f1                	jne    760 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     76f:	83 ec 04             	sub    $0x4,%esp
+     772:	6a 40                	push   $0x40
+     774:	6a 01                	push   $0x1
+     776:	52                   	push   %edx
+     777:	e8 db 03 00 00       	call   b57 <futex>
+}
+     77c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     77f:	83 c4 10             	add    $0x10,%esp
+     782:	c9                   	leave
+     783:	c3                   	ret
+     784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     790:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+     795:	c3                   	ret
+     796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007a0 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+     7a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     7a5:	85 c0                	test   %eax,%eax
+     7a7:	74 07                	je     7b0 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+     7a9:	c3                   	ret
+     7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+     7b0:	e9 d2 02 00 00       	jmp    a87 <getpid>
+     7b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+     7c0:	55                   	push   %ebp
+     7c1:	89 e5                	mov    %esp,%ebp
+     7c3:	57                   	push   %edi
+     7c4:	56                   	push   %esi
+     7c5:	53                   	push   %ebx
+     7c6:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+     7c9:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+     7cb:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     7d1:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     7d7:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     7dc:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     7e2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     7e5:	89 d0                	mov    %edx,%eax
+     7e7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     7ea:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     7f0:	29 d9                	sub    %ebx,%ecx
+     7f2:	89 c6                	mov    %eax,%esi
+     7f4:	89 d7                	mov    %edx,%edi
+     7f6:	0f a5 c7             	shld   %cl,%eax,%edi
+     7f9:	d3 e6                	shl    %cl,%esi
+     7fb:	31 c0                	xor    %eax,%eax
+     7fd:	f6 c1 20             	test   $0x20,%cl
+     800:	0f 45 fe             	cmovne %esi,%edi
+     803:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     806:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     809:	89 d9                	mov    %ebx,%ecx
+     80b:	31 db                	xor    %ebx,%ebx
+     80d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     813:	0f ad d0             	shrd   %cl,%edx,%eax
+     816:	d3 ea                	shr    %cl,%edx
+     818:	f6 c1 20             	test   $0x20,%cl
+     81b:	0f 45 c2             	cmovne %edx,%eax
+     81e:	0f 45 d3             	cmovne %ebx,%edx
+     821:	01 f0                	add    %esi,%eax
+     823:	11 fa                	adc    %edi,%edx
+}
+     825:	83 c4 0c             	add    $0xc,%esp
+     828:	5b                   	pop    %ebx
+     829:	5e                   	pop    %esi
+     82a:	5f                   	pop    %edi
+     82b:	5d                   	pop    %ebp
+     82c:	c3                   	ret
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     830:	55                   	push   %ebp
+     831:	89 e5                	mov    %esp,%ebp
+     833:	57                   	push   %edi
+     834:	56                   	push   %esi
+     835:	53                   	push   %ebx
+     836:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+     839:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+     83d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+     840:	74 0e                	je     850 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+     842:	83 c4 1c             	add    $0x1c,%esp
+     845:	5b                   	pop    %ebx
+     846:	5e                   	pop    %esi
+     847:	5f                   	pop    %edi
+     848:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+     849:	e9 a5 03 00 00       	jmp    bf3 <clock_gettime>
+     84e:	66 90                	xchg   %ax,%ax
+     850:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+     852:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     858:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     85e:	b9 20 00 00 00       	mov    $0x20,%ecx
+     863:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     866:	89 d0                	mov    %edx,%eax
+     868:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     86b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     871:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+     877:	89 c6                	mov    %eax,%esi
+     879:	89 d7                	mov    %edx,%edi
+     87b:	0f a5 c7             	shld   %cl,%eax,%edi
+     87e:	d3 e6                	shl    %cl,%esi
+     880:	31 c0                	xor    %eax,%eax
+     882:	f6 c1 20             	test   $0x20,%cl
+     885:	0f 45 fe             	cmovne %esi,%edi
+     888:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     88b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     88e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+     895:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     89b:	0f ad d0             	shrd   %cl,%edx,%eax
+     89e:	d3 ea                	shr    %cl,%edx
+     8a0:	f6 c1 20             	test   $0x20,%cl
+     8a3:	74 04                	je     8a9 <vclock_gettime+0x79>
+     8a5:	89 d0                	mov    %edx,%eax
+     8a7:	31 d2                	xor    %edx,%edx
+     8a9:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     8ab:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+     8b0:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+     8b2:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     8b4:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+     8b6:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     8b8:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+     8be:	29 c1                	sub    %eax,%ecx
+}
+     8c0:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     8c2:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+     8c5:	83 c4 1c             	add    $0x1c,%esp
+     8c8:	5b                   	pop    %ebx
+     8c9:	5e                   	pop    %esi
+     8ca:	5f                   	pop    %edi
+     8cb:	5d                   	pop    %ebp
+     8cc:	c3                   	ret
+
+000008cd <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+     8cd:	b8 01 00 00 00       	mov    $0x1,%eax
+     8d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8d9:	74 09                	je     8e4 <fork+0x17>
+     8db:	89 e1                	mov    %esp,%ecx
+     8dd:	ba e6 08 00 00       	mov    $0x8e6,%edx
+     8e2:	0f 34                	sysenter
+     8e4:	cd 40                	int    $0x40
+     8e6:	c3                   	ret
+
+000008e7 <exit>:
+SYSCALL(exit)
+     8e7:	b8 02 00 00 00       	mov    $0x2,%eax
+     8ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8f3:	74 09                	je     8fe <exit+0x17>
+     8f5:	89 e1                	mov    %esp,%ecx
+     8f7:	ba 00 09 00 00       	mov    $0x900,%edx
+     8fc:	0f 34                	sysenter
+     8fe:	cd 40                	int    $0x40
+     900:	c3                   	ret
+
+00000901 <wait>:
+SYSCALL(wait)
+     901:	b8 03 00 00 00       	mov    $0x3,%eax
+     906:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     90d:	74 09                	je     918 <wait+0x17>
+     90f:	89 e1                	mov    %esp,%ecx
+     911:	ba 1a 09 00 00       	mov    $0x91a,%edx
+     916:	0f 34                	sysenter
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+
+0000091b <pipe>:
+SYSCALL(pipe)
+     91b:	b8 04 00 00 00       	mov    $0x4,%eax
+     920:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     927:	74 09                	je     932 <pipe+0x17>
+     929:	89 e1                	mov    %esp,%ecx
+     92b:	ba 34 09 00 00       	mov    $0x934,%edx
+     930:	0f 34                	sysenter
+     932:	cd 40                	int    $0x40
+     934:	c3                   	ret
+
+00000935 <read>:
+SYSCALL(read)
+     935:	b8 05 00 00 00       	mov    $0x5,%eax
+     93a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     941:	74 09                	je     94c <read+0x17>
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4e 09 00 00       	mov    $0x94e,%edx
+     94a:	0f 34                	sysenter
+     94c:	cd 40                	int    $0x40
+     94e:	c3                   	ret
+
+0000094f <write>:
+SYSCALL(write)
+     94f:	b8 10 00 00 00       	mov    $0x10,%eax
+     954:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     95b:	74 09                	je     966 <write+0x17>
+     95d:	89 e1                	mov    %esp,%ecx
+     95f:	ba 68 09 00 00       	mov    $0x968,%edx
+     964:	0f 34                	sysenter
+     966:	cd 40                	int    $0x40
+     968:	c3                   	ret
+
+00000969 <close>:
+SYSCALL(close)
+     969:	b8 15 00 00 00       	mov    $0x15,%eax
+     96e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     975:	74 09                	je     980 <close+0x17>
+     977:	89 e1                	mov    %esp,%ecx
+     979:	ba 82 09 00 00       	mov    $0x982,%edx
+     97e:	0f 34                	sysenter
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <kill>:
+SYSCALL(kill)
+     983:	b8 06 00 00 00       	mov    $0x6,%eax
+     988:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     98f:	74 09                	je     99a <kill+0x17>
+     991:	89 e1                	mov    %esp,%ecx
+     993:	ba 9c 09 00 00       	mov    $0x99c,%edx
+     998:	0f 34                	sysenter
+     99a:	cd 40                	int    $0x40
+     99c:	c3                   	ret
+
+0000099d <exec>:
+SYSCALL(exec)
+     99d:	b8 07 00 00 00       	mov    $0x7,%eax
+     9a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9a9:	74 09                	je     9b4 <exec+0x17>
+     9ab:	89 e1                	mov    %esp,%ecx
+     9ad:	ba b6 09 00 00       	mov    $0x9b6,%edx
+     9b2:	0f 34                	sysenter
+     9b4:	cd 40                	int    $0x40
+     9b6:	c3                   	ret
+
+000009b7 <open>:
+SYSCALL(open)
+     9b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9c3:	74 09                	je     9ce <open+0x17>
+     9c5:	89 e1                	mov    %esp,%ecx
+     9c7:	ba d0 09 00 00       	mov    $0x9d0,%edx
+     9cc:	0f 34                	sysenter
+     9ce:	cd 40                	int    $0x40
+     9d0:	c3                   	ret
+
+000009d1 <mknod>:
+SYSCALL(mknod)
+     9d1:	b8 11 00 00 00       	mov    $0x11,%eax
+     9d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9dd:	74 09                	je     9e8 <mknod+0x17>
+     9df:	89 e1                	mov    %esp,%ecx
+     9e1:	ba ea 09 00 00       	mov    $0x9ea,%edx
+     9e6:	0f 34                	sysenter
+     9e8:	cd 40                	int    $0x40
+     9ea:	c3                   	ret
+
+000009eb <unlink>:
+SYSCALL(unlink)
+     9eb:	b8 12 00 00 00       	mov    $0x12,%eax
+     9f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9f7:	74 09                	je     a02 <unlink+0x17>
+     9f9:	89 e1                	mov    %esp,%ecx
+     9fb:	ba 04 0a 00 00       	mov    $0xa04,%edx
+     a00:	0f 34                	sysenter
+     a02:	cd 40                	int    $0x40
+     a04:	c3                   	ret
+
+00000a05 <fstat>:
+SYSCALL(fstat)
+     a05:	b8 08 00 00 00       	mov    $0x8,%eax
+     a0a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a11:	74 09                	je     a1c <fstat+0x17>
+     a13:	89 e1                	mov    %esp,%ecx
+     a15:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+     a1a:	0f 34                	sysenter
+     a1c:	cd 40                	int    $0x40
+     a1e:	c3                   	ret
+
+00000a1f <link>:
+SYSCALL(link)
+     a1f:	b8 13 00 00 00       	mov    $0x13,%eax
+     a24:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a2b:	74 09                	je     a36 <link+0x17>
+     a2d:	89 e1                	mov    %esp,%ecx
+     a2f:	ba 38 0a 00 00       	mov    $0xa38,%edx
+     a34:	0f 34                	sysenter
+     a36:	cd 40                	int    $0x40
+     a38:	c3                   	ret
+
+00000a39 <mkdir>:
+SYSCALL(mkdir)
+     a39:	b8 14 00 00 00       	mov    $0x14,%eax
+     a3e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a45:	74 09                	je     a50 <mkdir+0x17>
+     a47:	89 e1                	mov    %esp,%ecx
+     a49:	ba 52 0a 00 00       	mov    $0xa52,%edx
+     a4e:	0f 34                	sysenter
+     a50:	cd 40                	int    $0x40
+     a52:	c3                   	ret
+
+00000a53 <chdir>:
+SYSCALL(chdir)
+     a53:	b8 09 00 00 00       	mov    $0x9,%eax
+     a58:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a5f:	74 09                	je     a6a <chdir+0x17>
+     a61:	89 e1                	mov    %esp,%ecx
+     a63:	ba 6c 0a 00 00       	mov    $0xa6c,%edx
+     a68:	0f 34                	sysenter
+     a6a:	cd 40                	int    $0x40
+     a6c:	c3                   	ret
+
+00000a6d <dup>:
+SYSCALL(dup)
+     a6d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a72:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a79:	74 09                	je     a84 <dup+0x17>
+     a7b:	89 e1                	mov    %esp,%ecx
+     a7d:	ba 86 0a 00 00       	mov    $0xa86,%edx
+     a82:	0f 34                	sysenter
+     a84:	cd 40                	int    $0x40
+     a86:	c3                   	ret
+
+00000a87 <getpid>:
+SYSCALL(getpid)
+     a87:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a8c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a93:	74 09                	je     a9e <getpid+0x17>
+     a95:	89 e1                	mov    %esp,%ecx
+     a97:	ba a0 0a 00 00       	mov    $0xaa0,%edx
+     a9c:	0f 34                	sysenter
+     a9e:	cd 40                	int    $0x40
+     aa0:	c3                   	ret
+
+00000aa1 <sbrk>:
+SYSCALL(sbrk)
+     aa1:	b8 0c 00 00 00       	mov    $0xc,%eax
+     aa6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     aad:	74 09                	je     ab8 <sbrk+0x17>
+     aaf:	89 e1                	mov    %esp,%ecx
+     ab1:	ba ba 0a 00 00       	mov    $0xaba,%edx
+     ab6:	0f 34                	sysenter
+     ab8:	cd 40                	int    $0x40
+     aba:	c3                   	ret
+
+00000abb <sleep>:
+SYSCALL(sleep)
+     abb:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ac0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ac7:	74 09                	je     ad2 <sleep+0x17>
+     ac9:	89 e1                	mov    %esp,%ecx
+     acb:	ba d4 0a 00 00       	mov    $0xad4,%edx
+     ad0:	0f 34                	sysenter
+     ad2:	cd 40                	int    $0x40
+     ad4:	c3                   	ret
+
+00000ad5 <uptime>:
+SYSCALL(uptime)
+     ad5:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ada:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ae1:	74 09                	je     aec <uptime+0x17>
+     ae3:	89 e1                	mov    %esp,%ecx
+     ae5:	ba ee 0a 00 00       	mov    $0xaee,%edx
+     aea:	0f 34                	sysenter
+     aec:	cd 40                	int    $0x40
+     aee:	c3                   	ret
+
+00000aef <mmap>:
+SYSCALL(mmap)
+     aef:	b8 16 00 00 00       	mov    $0x16,%eax
+     af4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     afb:	74 09                	je     b06 <mmap+0x17>
+     afd:	89 e1                	mov    %esp,%ecx
+     aff:	ba 08 0b 00 00       	mov    $0xb08,%edx
+     b04:	0f 34                	sysenter
+     b06:	cd 40                	int    $0x40
+     b08:	c3                   	ret
+
+00000b09 <munmap>:
+SYSCALL(munmap)
+     b09:	b8 17 00 00 00       	mov    $0x17,%eax
+     b0e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b15:	74 09                	je     b20 <munmap+0x17>
+     b17:	89 e1                	mov    %esp,%ecx
+     b19:	ba 22 0b 00 00       	mov    $0xb22,%edx
+     b1e:	0f 34                	sysenter
+     b20:	cd 40                	int    $0x40
+     b22:	c3                   	ret
+
+00000b23 <clone>:
+SYSCALL(clone)
+     b23:	b8 18 00 00 00       	mov    $0x18,%eax
+     b28:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b2f:	74 09                	je     b3a <clone+0x17>
+     b31:	89 e1                	mov    %esp,%ecx
+     b33:	ba 3c 0b 00 00       	mov    $0xb3c,%edx
+     b38:	0f 34                	sysenter
+     b3a:	cd 40                	int    $0x40
+     b3c:	c3                   	ret
+
+00000b3d <join>:
+SYSCALL(join)
+     b3d:	b8 19 00 00 00       	mov    $0x19,%eax
+     b42:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b49:	74 09                	je     b54 <join+0x17>
+     b4b:	89 e1                	mov    %esp,%ecx
+     b4d:	ba 56 0b 00 00       	mov    $0xb56,%edx
+     b52:	0f 34                	sysenter
+     b54:	cd 40                	int    $0x40
+     b56:	c3                   	ret
+
+00000b57 <futex>:
+SYSCALL(futex)
+     b57:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b5c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b63:	74 09                	je     b6e <futex+0x17>
+     b65:	89 e1                	mov    %esp,%ecx
+     b67:	ba 70 0b 00 00       	mov    $0xb70,%edx
+     b6c:	0f 34                	sysenter
+     b6e:	cd 40                	int    $0x40
+     b70:	c3                   	ret
+
+00000b71 <memstat>:
+SYSCALL(memstat)
+     b71:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b76:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b7d:	74 09                	je     b88 <memstat+0x17>
+     b7f:	89 e1                	mov    %esp,%ecx
+     b81:	ba 8a 0b 00 00       	mov    $0xb8a,%edx
+     b86:	0f 34                	sysenter
+     b88:	cd 40                	int    $0x40
+     b8a:	c3                   	ret
+
+00000b8b <nice>:
+SYSCALL(nice)
+     b8b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b90:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b97:	74 09                	je     ba2 <nice+0x17>
+     b99:	89 e1                	mov    %esp,%ecx
+     b9b:	ba a4 0b 00 00       	mov    $0xba4,%edx
+     ba0:	0f 34                	sysenter
+     ba2:	cd 40                	int    $0x40
+     ba4:	c3                   	ret
+
+00000ba5 <setpriority>:
+SYSCALL(setpriority)
+     ba5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     baa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bb1:	74 09                	je     bbc <setpriority+0x17>
+     bb3:	89 e1                	mov    %esp,%ecx
+     bb5:	ba be 0b 00 00       	mov    $0xbbe,%edx
+     bba:	0f 34                	sysenter
+     bbc:	cd 40                	int    $0x40
+     bbe:	c3                   	ret
+
+00000bbf <getpinfo>:
+SYSCALL(getpinfo)
+     bbf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     bc4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bcb:	74 09                	je     bd6 <getpinfo+0x17>
+     bcd:	89 e1                	mov    %esp,%ecx
+     bcf:	ba d8 0b 00 00       	mov    $0xbd8,%edx
+     bd4:	0f 34                	sysenter
+     bd6:	cd 40                	int    $0x40
+     bd8:	c3                   	ret
+
+00000bd9 <settickets>:
+SYSCALL(settickets)
+     bd9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     bde:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     be5:	74 09                	je     bf0 <settickets+0x17>
+     be7:	89 e1                	mov    %esp,%ecx
+     be9:	ba f2 0b 00 00       	mov    $0xbf2,%edx
+     bee:	0f 34                	sysenter
+     bf0:	cd 40                	int    $0x40
+     bf2:	c3                   	ret
+
+00000bf3 <clock_gettime>:
+SYSCALL(clock_gettime)
+     bf3:	b8 20 00 00 00       	mov    $0x20,%eax
+     bf8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bff:	74 09                	je     c0a <clock_gettime+0x17>
+     c01:	89 e1                	mov    %esp,%ecx
+     c03:	ba 0c 0c 00 00       	mov    $0xc0c,%edx
+     c08:	0f 34                	sysenter
+     c0a:	cd 40                	int    $0x40
+     c0c:	c3                   	ret
+
+00000c0d <batch>:
+SYSCALL(batch)
+     c0d:	b8 21 00 00 00       	mov    $0x21,%eax
+     c12:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c19:	74 09                	je     c24 <batch+0x17>
+     c1b:	89 e1                	mov    %esp,%ecx
+     c1d:	ba 26 0c 00 00       	mov    $0xc26,%edx
+     c22:	0f 34                	sysenter
+     c24:	cd 40                	int    $0x40
+     c26:	c3                   	ret
+
+00000c27 <aiosetup>:
+SYSCALL(aiosetup)
+     c27:	b8 22 00 00 00       	mov    $0x22,%eax
+     c2c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c33:	74 09                	je     c3e <aiosetup+0x17>
+     c35:	89 e1                	mov    %esp,%ecx
+     c37:	ba 40 0c 00 00       	mov    $0xc40,%edx
+     c3c:	0f 34                	sysenter
+     c3e:	cd 40                	int    $0x40
+     c40:	c3                   	ret
+
+00000c41 <aioenter>:
+SYSCALL(aioenter)
+     c41:	b8 23 00 00 00       	mov    $0x23,%eax
+     c46:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c4d:	74 09                	je     c58 <aioenter+0x17>
+     c4f:	89 e1                	mov    %esp,%ecx
+     c51:	ba 5a 0c 00 00       	mov    $0xc5a,%edx
+     c56:	0f 34                	sysenter
+     c58:	cd 40                	int    $0x40
+     c5a:	c3                   	ret
+
+00000c5b <systrace>:
+SYSCALL(systrace)
+     c5b:	b8 24 00 00 00       	mov    $0x24,%eax
+     c60:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c67:	74 09                	je     c72 <systrace+0x17>
+     c69:	89 e1                	mov    %esp,%ecx
+     c6b:	ba 74 0c 00 00       	mov    $0xc74,%edx
+     c70:	0f 34                	sysenter
+     c72:	cd 40                	int    $0x40
+     c74:	c3                   	ret
+
+00000c75 <sysstat>:
+SYSCALL(sysstat)
+     c75:	b8 25 00 00 00       	mov    $0x25,%eax
+     c7a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c81:	74 09                	je     c8c <sysstat+0x17>
+     c83:	89 e1                	mov    %esp,%ecx
+     c85:	ba 8e 0c 00 00       	mov    $0xc8e,%edx
+     c8a:	0f 34                	sysenter
+     c8c:	cd 40                	int    $0x40
+     c8e:	c3                   	ret
+
+00000c8f <traceread>:
+SYSCALL(traceread)
+     c8f:	b8 26 00 00 00       	mov    $0x26,%eax
+     c94:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c9b:	74 09                	je     ca6 <traceread+0x17>
+     c9d:	89 e1                	mov    %esp,%ecx
+     c9f:	ba a8 0c 00 00       	mov    $0xca8,%edx
+     ca4:	0f 34                	sysenter
+     ca6:	cd 40                	int    $0x40
+     ca8:	c3                   	ret
+     ca9:	66 90                	xchg   %ax,%ax
+     cab:	66 90                	xchg   %ax,%ax
+     cad:	66 90                	xchg   %ax,%ax
+     caf:	90                   	nop
+
+00000cb0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     cb8:	89 d1                	mov    %edx,%ecx
+{
+     cba:	83 ec 3c             	sub    $0x3c,%esp
+     cbd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     cc0:	85 d2                	test   %edx,%edx
+     cc2:	0f 89 80 00 00 00    	jns    d48 <printint+0x98>
+     cc8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     ccc:	74 7a                	je     d48 <printint+0x98>
+    x = -xx;
+     cce:	f7 d9                	neg    %ecx
+    neg = 1;
+     cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     cd5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     cd8:	31 f6                	xor    %esi,%esi
+     cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     ce0:	89 c8                	mov    %ecx,%eax
+     ce2:	31 d2                	xor    %edx,%edx
+     ce4:	89 f7                	mov    %esi,%edi
+     ce6:	f7 f3                	div    %ebx
+     ce8:	8d 76 01             	lea    0x1(%esi),%esi
+     ceb:	0f b6 92 c8 11 00 00 	movzbl 0x11c8(%edx),%edx
+     cf2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     cf6:	89 ca                	mov    %ecx,%edx
+     cf8:	89 c1                	mov    %eax,%ecx
+     cfa:	39 da                	cmp    %ebx,%edx
+     cfc:	73 e2                	jae    ce0 <printint+0x30>
+  if(neg)
+     cfe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     d01:	85 c0                	test   %eax,%eax
+     d03:	74 07                	je     d0c <printint+0x5c>
+    buf[i++] = '-';
+     d05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     d0a:	89 f7                	mov    %esi,%edi
+     d0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     d0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     d12:	01 df                	add    %ebx,%edi
+     d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     d18:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     d1b:	83 ec 04             	sub    $0x4,%esp
+     d1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     d21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     d24:	6a 01                	push   $0x1
+     d26:	50                   	push   %eax
+     d27:	56                   	push   %esi
+     d28:	e8 22 fc ff ff       	call   94f <write>
+  while(--i >= 0)
+     d2d:	89 f8                	mov    %edi,%eax
+     d2f:	83 c4 10             	add    $0x10,%esp
+     d32:	83 ef 01             	sub    $0x1,%edi
+     d35:	39 d8                	cmp    %ebx,%eax
+     d37:	75 df                	jne    d18 <printint+0x68>
+}
+     d39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3c:	5b                   	pop    %ebx
+     d3d:	5e                   	pop    %esi
+     d3e:	5f                   	pop    %edi
+     d3f:	5d                   	pop    %ebp
+     d40:	c3                   	ret
+     d41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     d48:	31 c0                	xor    %eax,%eax
+     d4a:	eb 89                	jmp    cd5 <printint+0x25>
+     d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	57                   	push   %edi
+     d54:	56                   	push   %esi
+     d55:	53                   	push   %ebx
+     d56:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     d59:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     d5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     d5f:	0f b6 1e             	movzbl (%esi),%ebx
+     d62:	83 c6 01             	add    $0x1,%esi
+     d65:	84 db                	test   %bl,%bl
+     d67:	74 67                	je     dd0 <printf+0x80>
+     d69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d6c:	31 d2                	xor    %edx,%edx
+     d6e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     d71:	eb 34                	jmp    da7 <printf+0x57>
+     d73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d77:	90                   	nop
+     d78:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     d7b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     d80:	83 f8 25             	cmp    $0x25,%eax
+     d83:	74 18                	je     d9d <printf+0x4d>
+  write(fd, &c, 1);
+     d85:	83 ec 04             	sub    $0x4,%esp
+     d88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d8e:	6a 01                	push   $0x1
+     d90:	50                   	push   %eax
+     d91:	57                   	push   %edi
+     d92:	e8 b8 fb ff ff       	call   94f <write>
+     d97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     d9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d9d:	0f b6 1e             	movzbl (%esi),%ebx
+     da0:	83 c6 01             	add    $0x1,%esi
+     da3:	84 db                	test   %bl,%bl
+     da5:	74 29                	je     dd0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     da7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     daa:	85 d2                	test   %edx,%edx
+     dac:	74 ca                	je     d78 <printf+0x28>
+      }
+    } else if(state == '%'){
+     dae:	83 fa 25             	cmp    $0x25,%edx
+     db1:	75 ea                	jne    d9d <printf+0x4d>
+      if(c == 'd'){
+     db3:	83 f8 25             	cmp    $0x25,%eax
+     db6:	0f 84 24 01 00 00    	je     ee0 <printf+0x190>
+     dbc:	83 e8 63             	sub    $0x63,%eax
+     dbf:	83 f8 15             	cmp    $0x15,%eax
+     dc2:	77 1c                	ja     de0 <printf+0x90>
+     dc4:	ff 24 85 70 11 00 00 	jmp    *0x1170(,%eax,4)
+     dcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     dcf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dd3:	5b                   	pop    %ebx
+     dd4:	5e                   	pop    %esi
+     dd5:	5f                   	pop    %edi
+     dd6:	5d                   	pop    %ebp
+     dd7:	c3                   	ret
+     dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddf:	90                   	nop
+  write(fd, &c, 1);
+     de0:	83 ec 04             	sub    $0x4,%esp
+     de3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     de6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     dea:	6a 01                	push   $0x1
+     dec:	52                   	push   %edx
+     ded:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     df0:	57                   	push   %edi
+     df1:	e8 59 fb ff ff       	call   94f <write>
+     df6:	83 c4 0c             	add    $0xc,%esp
+     df9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     dfc:	6a 01                	push   $0x1
+     dfe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     e01:	52                   	push   %edx
+     e02:	57                   	push   %edi
+     e03:	e8 47 fb ff ff       	call   94f <write>
+        putc(fd, c);
+     e08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e0b:	31 d2                	xor    %edx,%edx
+     e0d:	eb 8e                	jmp    d9d <printf+0x4d>
+     e0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     e10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     e13:	83 ec 0c             	sub    $0xc,%esp
+     e16:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e1b:	8b 13                	mov    (%ebx),%edx
+     e1d:	6a 00                	push   $0x0
+     e1f:	89 f8                	mov    %edi,%eax
+        ap++;
+     e21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     e24:	e8 87 fe ff ff       	call   cb0 <printint>
+        ap++;
+     e29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e2f:	31 d2                	xor    %edx,%edx
+     e31:	e9 67 ff ff ff       	jmp    d9d <printf+0x4d>
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     e40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     e43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     e45:	83 c0 04             	add    $0x4,%eax
+     e48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     e4b:	85 db                	test   %ebx,%ebx
+     e4d:	0f 84 9d 00 00 00    	je     ef0 <printf+0x1a0>
+        while(*s != 0){
+     e53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     e56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     e58:	84 c0                	test   %al,%al
+     e5a:	0f 84 3d ff ff ff    	je     d9d <printf+0x4d>
+     e60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     e66:	89 de                	mov    %ebx,%esi
+     e68:	89 d3                	mov    %edx,%ebx
+     e6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     e70:	83 ec 04             	sub    $0x4,%esp
+     e73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     e76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     e79:	6a 01                	push   $0x1
+     e7b:	53                   	push   %ebx
+     e7c:	57                   	push   %edi
+     e7d:	e8 cd fa ff ff       	call   94f <write>
+        while(*s != 0){
+     e82:	0f b6 06             	movzbl (%esi),%eax
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	84 c0                	test   %al,%al
+     e8a:	75 e4                	jne    e70 <printf+0x120>
+      state = 0;
+     e8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e8f:	31 d2                	xor    %edx,%edx
+     e91:	e9 07 ff ff ff       	jmp    d9d <printf+0x4d>
+     e96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     ea0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     ea3:	83 ec 0c             	sub    $0xc,%esp
+     ea6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     eab:	8b 13                	mov    (%ebx),%edx
+     ead:	6a 01                	push   $0x1
+     eaf:	e9 6b ff ff ff       	jmp    e1f <printf+0xcf>
+     eb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     eb8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     ebb:	83 ec 04             	sub    $0x4,%esp
+     ebe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     ec1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     ec3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     ec6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ec9:	6a 01                	push   $0x1
+     ecb:	52                   	push   %edx
+     ecc:	57                   	push   %edi
+     ecd:	e8 7d fa ff ff       	call   94f <write>
+        ap++;
+     ed2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     ed5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ed8:	31 d2                	xor    %edx,%edx
+     eda:	e9 be fe ff ff       	jmp    d9d <printf+0x4d>
+     edf:	90                   	nop
+  write(fd, &c, 1);
+     ee0:	83 ec 04             	sub    $0x4,%esp
+     ee3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     ee6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ee9:	6a 01                	push   $0x1
+     eeb:	e9 11 ff ff ff       	jmp    e01 <printf+0xb1>
+     ef0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     ef5:	bb 66 11 00 00       	mov    $0x1166,%ebx
+     efa:	e9 61 ff ff ff       	jmp    e60 <printf+0x110>
+     eff:	90                   	nop
+
+00000f00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     f00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f01:	a1 40 1b 00 00       	mov    0x1b40,%eax
+{
+     f06:	89 e5                	mov    %esp,%ebp
+     f08:	57                   	push   %edi
+     f09:	56                   	push   %esi
+     f0a:	53                   	push   %ebx
+     f0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     f0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     f1c:	39 ca                	cmp    %ecx,%edx
+     f1e:	73 30                	jae    f50 <free+0x50>
+     f20:	39 c1                	cmp    %eax,%ecx
+     f22:	72 04                	jb     f28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f24:	39 c2                	cmp    %eax,%edx
+     f26:	72 f0                	jb     f18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     f28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     f2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     f2e:	39 f8                	cmp    %edi,%eax
+     f30:	74 2e                	je     f60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     f35:	8b 42 04             	mov    0x4(%edx),%eax
+     f38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f3b:	39 f1                	cmp    %esi,%ecx
+     f3d:	74 38                	je     f77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     f3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     f41:	5b                   	pop    %ebx
+  freep = p;
+     f42:	89 15 40 1b 00 00    	mov    %edx,0x1b40
+}
+     f48:	5e                   	pop    %esi
+     f49:	5f                   	pop    %edi
+     f4a:	5d                   	pop    %ebp
+     f4b:	c3                   	ret
+     f4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     f50:	39 c1                	cmp    %eax,%ecx
+     f52:	72 d0                	jb     f24 <free+0x24>
+     f54:	eb c2                	jmp    f18 <free+0x18>
+     f56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f60:	03 70 04             	add    0x4(%eax),%esi
+     f63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f66:	8b 02                	mov    (%edx),%eax
+     f68:	8b 00                	mov    (%eax),%eax
+     f6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f6d:	8b 42 04             	mov    0x4(%edx),%eax
+     f70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f73:	39 f1                	cmp    %esi,%ecx
+     f75:	75 c8                	jne    f3f <free+0x3f>
+    p->s.size += bp->s.size;
+     f77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f7a:	89 15 40 1b 00 00    	mov    %edx,0x1b40
+    p->s.size += bp->s.size;
+     f80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f86:	89 0a                	mov    %ecx,(%edx)
+}
+     f88:	5b                   	pop    %ebx
+     f89:	5e                   	pop    %esi
+     f8a:	5f                   	pop    %edi
+     f8b:	5d                   	pop    %ebp
+     f8c:	c3                   	ret
+     f8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f90:	55                   	push   %ebp
+     f91:	89 e5                	mov    %esp,%ebp
+     f93:	57                   	push   %edi
+     f94:	56                   	push   %esi
+     f95:	53                   	push   %ebx
+     f96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f9c:	8b 15 40 1b 00 00    	mov    0x1b40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fa2:	8d 78 07             	lea    0x7(%eax),%edi
+     fa5:	c1 ef 03             	shr    $0x3,%edi
+     fa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     fab:	85 d2                	test   %edx,%edx
+     fad:	0f 84 8d 00 00 00    	je     1040 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fb5:	8b 48 04             	mov    0x4(%eax),%ecx
+     fb8:	39 f9                	cmp    %edi,%ecx
+     fba:	73 64                	jae    1020 <malloc+0x90>
+  if(nu < 4096)
+     fbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     fc1:	39 df                	cmp    %ebx,%edi
+     fc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     fc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     fcd:	eb 0a                	jmp    fd9 <malloc+0x49>
+     fcf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     fd2:	8b 48 04             	mov    0x4(%eax),%ecx
+     fd5:	39 f9                	cmp    %edi,%ecx
+     fd7:	73 47                	jae    1020 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     fd9:	89 c2                	mov    %eax,%edx
+     fdb:	39 05 40 1b 00 00    	cmp    %eax,0x1b40
+     fe1:	75 ed                	jne    fd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     fe3:	83 ec 0c             	sub    $0xc,%esp
+     fe6:	56                   	push   %esi
+     fe7:	e8 b5 fa ff ff       	call   aa1 <sbrk>
+  if(p == (char*)-1)
+     fec:	83 c4 10             	add    $0x10,%esp
+     fef:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ff2:	74 1c                	je     1010 <malloc+0x80>
+  hp->s.size = nu;
+     ff4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     ff7:	83 ec 0c             	sub    $0xc,%esp
+     ffa:	83 c0 08             	add    $0x8,%eax
+     ffd:	50                   	push   %eax
+     ffe:	e8 fd fe ff ff       	call   f00 <free>
+  return freep;
+    1003:	8b 15 40 1b 00 00    	mov    0x1b40,%edx
+      if((p = morecore(nunits)) == 0)
+    1009:	83 c4 10             	add    $0x10,%esp
+    100c:	85 d2                	test   %edx,%edx
+    100e:	75 c0                	jne    fd0 <malloc+0x40>
+        return 0;
+  }
+}
+    1010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1013:	31 c0                	xor    %eax,%eax
+}
+    1015:	5b                   	pop    %ebx
+    1016:	5e                   	pop    %esi
+    1017:	5f                   	pop    %edi
+    1018:	5d                   	pop    %ebp
+    1019:	c3                   	ret
+    101a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1020:	39 cf                	cmp    %ecx,%edi
+    1022:	74 4c                	je     1070 <malloc+0xe0>
+        p->s.size -= nunits;
+    1024:	29 f9                	sub    %edi,%ecx
+    1026:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1029:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    102c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    102f:	89 15 40 1b 00 00    	mov    %edx,0x1b40
+}
+    1035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1038:	83 c0 08             	add    $0x8,%eax
+}
+    103b:	5b                   	pop    %ebx
+    103c:	5e                   	pop    %esi
+    103d:	5f                   	pop    %edi
+    103e:	5d                   	pop    %ebp
+    103f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1040:	c7 05 40 1b 00 00 44 	movl   $0x1b44,0x1b40
+    1047:	1b 00 00 
+    base.s.size = 0;
+    104a:	b8 44 1b 00 00       	mov    $0x1b44,%eax
+    base.s.ptr = freep = prevp = &base;
+    104f:	c7 05 44 1b 00 00 44 	movl   $0x1b44,0x1b44
+    1056:	1b 00 00 
+    base.s.size = 0;
+    1059:	c7 05 48 1b 00 00 00 	movl   $0x0,0x1b48
+    1060:	00 00 00 
+    if(p->s.size >= nunits){
+    1063:	e9 54 ff ff ff       	jmp    fbc <malloc+0x2c>
+    1068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    106f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1070:	8b 08                	mov    (%eax),%ecx
+    1072:	89 0a                	mov    %ecx,(%edx)
+    1074:	eb b9                	jmp    102f <malloc+0x9f>
+    1076:	66 90                	xchg   %ax,%ax
+    1078:	66 90                	xchg   %ax,%ax
+    107a:	66 90                	xchg   %ax,%ax
+    107c:	66 90                	xchg   %ax,%ax
+    107e:	66 90                	xchg   %ax,%ax
+
+00001080 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1080:	55                   	push   %ebp
+    1081:	89 e5                	mov    %esp,%ebp
+    1083:	53                   	push   %ebx
+    1084:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1087:	68 00 20 00 00       	push   $0x2000
+    108c:	e8 ff fe ff ff       	call   f90 <malloc>
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	85 c0                	test   %eax,%eax
+    1096:	74 47                	je     10df <thread_create+0x5f>
+    1098:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    109a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+    10a0:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    10a3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+    10a8:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+    10ab:	ff 75 0c             	push   0xc(%ebp)
+    10ae:	50                   	push   %eax
+    10af:	ff 75 08             	push   0x8(%ebp)
+    10b2:	e8 6c fa ff ff       	call   b23 <clone>
+    10b7:	83 c4 10             	add    $0x10,%esp
+    10ba:	85 c0                	test   %eax,%eax
+    10bc:	78 0a                	js     10c8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    10be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10c1:	c9                   	leave
+    10c2:	c3                   	ret
+    10c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10c7:	90                   	nop
+    free(mem);
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ce:	53                   	push   %ebx
+    10cf:	e8 2c fe ff ff       	call   f00 <free>
+    10d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    10d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    10da:	83 c4 10             	add    $0x10,%esp
+}
+    10dd:	c9                   	leave
+    10de:	c3                   	ret
+    return -1;
+    10df:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e4:	eb d8                	jmp    10be <thread_create+0x3e>
+    10e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    10ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010f0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    10f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    10f7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    10fa:	50                   	push   %eax
+    10fb:	e8 3d fa ff ff       	call   b3d <join>
+    1100:	83 c4 10             	add    $0x10,%esp
+    1103:	85 c0                	test   %eax,%eax
+    1105:	78 21                	js     1128 <thread_join+0x38>
+    1107:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+    1109:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    110c:	83 ec 0c             	sub    $0xc,%esp
+    110f:	ff 70 fc             	push   -0x4(%eax)
+    1112:	e8 e9 fd ff ff       	call   f00 <free>
+  return pid;
+    1117:	83 c4 10             	add    $0x10,%esp
+}
+    111a:	89 d8                	mov    %ebx,%eax
+    111c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    111f:	c9                   	leave
+    1120:	c3                   	ret
+    1121:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+    1128:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    112d:	eb eb                	jmp    111a <thread_join+0x2a>
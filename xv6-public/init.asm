@@ -0,0 +1,2062 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 80 0e 00 00       	push   $0xe80
+  19:	e8 e9 06 00 00       	call   707 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 8a 07 00 00       	call   7bd <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 7e 07 00 00       	call   7bd <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 88 0e 00 00       	push   $0xe88
+  50:	6a 01                	push   $0x1
+  52:	e8 49 0a 00 00       	call   aa0 <printf>
+    pid = fork();
+  57:	e8 c1 05 00 00       	call   61d <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 dc 05 00 00       	call   651 <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 c7 0e 00 00       	push   $0xec7
+  85:	6a 01                	push   $0x1
+  87:	e8 14 0a 00 00       	call   aa0 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 9b 0e 00 00       	push   $0xe9b
+  98:	6a 01                	push   $0x1
+  9a:	e8 01 0a 00 00       	call   aa0 <printf>
+      exit();
+  9f:	e8 93 05 00 00       	call   637 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 c0 13 00 00       	push   $0x13c0
+  ab:	68 ae 0e 00 00       	push   $0xeae
+  b0:	e8 38 06 00 00       	call   6ed <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 b1 0e 00 00       	push   $0xeb1
+  bc:	6a 01                	push   $0x1
+  be:	e8 dd 09 00 00       	call   aa0 <printf>
+      exit();
+  c3:	e8 6f 05 00 00       	call   637 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 80 0e 00 00       	push   $0xe80
+  d2:	e8 4a 06 00 00       	call   721 <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 80 0e 00 00       	push   $0xe80
+  e0:	e8 22 06 00 00       	call   707 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 58 04 00 00       	call   685 <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 85 04 00 00       	call   707 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 be 04 00 00       	call   755 <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 18 04 00 00       	call   6b9 <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 33c:	5d                   	pop    %ebp
+ 33d:	c3                   	ret
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 340:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 341:	31 c0                	xor    %eax,%eax
+ 343:	ba 01 00 00 00       	mov    $0x1,%edx
+ 348:	89 e5                	mov    %esp,%ebp
+ 34a:	56                   	push   %esi
+ 34b:	53                   	push   %ebx
+ 34c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 353:	85 c0                	test   %eax,%eax
+ 355:	74 32                	je     389 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 357:	83 f8 02             	cmp    $0x2,%eax
+ 35a:	74 0c                	je     368 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 35c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 361:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 364:	85 c0                	test   %eax,%eax
+ 366:	74 21                	je     389 <mutex_lock+0x49>
+ 368:	be 02 00 00 00       	mov    $0x2,%esi
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 370:	83 ec 04             	sub    $0x4,%esp
+ 373:	6a 02                	push   $0x2
+ 375:	6a 00                	push   $0x0
+ 377:	53                   	push   %ebx
+ 378:	e8 2a 05 00 00       	call   8a7 <futex>
+ 37d:	89 f0                	mov    %esi,%eax
+ 37f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	75 e7                	jne    370 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 389:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 38c:	5b                   	pop    %ebx
+ 38d:	5e                   	pop    %esi
+ 38e:	5d                   	pop    %ebp
+ 38f:	c3                   	ret
+
+00000390 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	31 c0                	xor    %eax,%eax
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	83 ec 08             	sub    $0x8,%esp
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 39e:	83 f8 02             	cmp    $0x2,%eax
+ 3a1:	74 05                	je     3a8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 3a3:	c9                   	leave
+ 3a4:	c3                   	ret
+ 3a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3a8:	83 ec 04             	sub    $0x4,%esp
+ 3ab:	6a 01                	push   $0x1
+ 3ad:	6a 01                	push   $0x1
+ 3af:	52                   	push   %edx
+ 3b0:	e8 f2 04 00 00       	call   8a7 <futex>
+ 3b5:	83 c4 10             	add    $0x10,%esp
+}
+ 3b8:	c9                   	leave
+ 3b9:	c3                   	ret
+ 3ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003c0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	31 c0                	xor    %eax,%eax
+ 3d3:	89 e5                	mov    %esp,%ebp
+ 3d5:	57                   	push   %edi
+ 3d6:	56                   	push   %esi
+ 3d7:	53                   	push   %ebx
+ 3d8:	83 ec 0c             	sub    $0xc,%esp
+ 3db:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 3e1:	8b 3e                	mov    (%esi),%edi
+ 3e3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 3e6:	83 f8 02             	cmp    $0x2,%eax
+ 3e9:	74 5d                	je     448 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 3eb:	83 ec 04             	sub    $0x4,%esp
+ 3ee:	57                   	push   %edi
+ 3ef:	6a 00                	push   $0x0
+ 3f1:	56                   	push   %esi
+ 3f2:	e8 b0 04 00 00       	call   8a7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3f7:	31 c0                	xor    %eax,%eax
+ 3f9:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3fe:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	74 30                	je     439 <cond_wait+0x69>
+  if(c != 2)
+ 409:	83 f8 02             	cmp    $0x2,%eax
+ 40c:	74 0c                	je     41a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 40e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 413:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 416:	85 c0                	test   %eax,%eax
+ 418:	74 1f                	je     439 <cond_wait+0x69>
+ 41a:	be 02 00 00 00       	mov    $0x2,%esi
+ 41f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 420:	83 ec 04             	sub    $0x4,%esp
+ 423:	6a 02                	push   $0x2
+ 425:	6a 00                	push   $0x0
+ 427:	53                   	push   %ebx
+ 428:	e8 7a 04 00 00       	call   8a7 <futex>
+ 42d:	89 f0                	mov    %esi,%eax
+ 42f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	85 c0                	test   %eax,%eax
+ 437:	75 e7                	jne    420 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43c:	5b                   	pop    %ebx
+ 43d:	5e                   	pop    %esi
+ 43e:	5f                   	pop    %edi
+ 43f:	5d                   	pop    %ebp
+ 440:	c3                   	ret
+ 441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 448:	83 ec 04             	sub    $0x4,%esp
+ 44b:	6a 01                	push   $0x1
+ 44d:	6a 01                	push   $0x1
+ 44f:	53                   	push   %ebx
+ 450:	e8 52 04 00 00       	call   8a7 <futex>
+ 455:	83 c4 10             	add    $0x10,%esp
+ 458:	eb 91                	jmp    3eb <cond_wait+0x1b>
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000460 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	53                   	push   %ebx
+ 464:	83 ec 04             	sub    $0x4,%esp
+ 467:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 470:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 472:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 475:	89 c8                	mov    %ecx,%eax
+ 477:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 47b:	39 c1                	cmp    %eax,%ecx
+ 47d:	75 f1                	jne    470 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 47f:	83 ec 04             	sub    $0x4,%esp
+ 482:	6a 01                	push   $0x1
+ 484:	6a 01                	push   $0x1
+ 486:	52                   	push   %edx
+ 487:	e8 1b 04 00 00       	call   8a7 <futex>
+}
+ 48c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 48f:	83 c4 10             	add    $0x10,%esp
+ 492:	c9                   	leave
+ 493:	c3                   	ret
+ 494:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 49f:	90                   	nop
+
+000004a0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	83 ec 04             	sub    $0x4,%esp
+ 4a7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4b0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4b2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 4b5:	89 c8                	mov    %ecx,%eax
+ 4b7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4bb:	39 c1                	cmp    %eax,%ecx
+ 4bd:	75 f1                	jne    4b0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 4bf:	83 ec 04             	sub    $0x4,%esp
+ 4c2:	6a 40                	push   $0x40
+ 4c4:	6a 01                	push   $0x1
+ 4c6:	52                   	push   %edx
+ 4c7:	e8 db 03 00 00       	call   8a7 <futex>
+}
+ 4cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4cf:	83 c4 10             	add    $0x10,%esp
+ 4d2:	c9                   	leave
+ 4d3:	c3                   	ret
+ 4d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 4e0:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 4f0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	74 07                	je     500 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 4f9:	c3                   	ret
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 500:	e9 d2 02 00 00       	jmp    7d7 <getpid>
+ 505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 519:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 51b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 521:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 527:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 52c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 532:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 53a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 540:	29 d9                	sub    %ebx,%ecx
+ 542:	89 c6                	mov    %eax,%esi
+ 544:	89 d7                	mov    %edx,%edi
+ 546:	0f a5 c7             	shld   %cl,%eax,%edi
+ 549:	d3 e6                	shl    %cl,%esi
+ 54b:	31 c0                	xor    %eax,%eax
+ 54d:	f6 c1 20             	test   $0x20,%cl
+ 550:	0f 45 fe             	cmovne %esi,%edi
+ 553:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 556:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 559:	89 d9                	mov    %ebx,%ecx
+ 55b:	31 db                	xor    %ebx,%ebx
+ 55d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 563:	0f ad d0             	shrd   %cl,%edx,%eax
+ 566:	d3 ea                	shr    %cl,%edx
+ 568:	f6 c1 20             	test   $0x20,%cl
+ 56b:	0f 45 c2             	cmovne %edx,%eax
+ 56e:	0f 45 d3             	cmovne %ebx,%edx
+ 571:	01 f0                	add    %esi,%eax
+ 573:	11 fa                	adc    %edi,%edx
+}
+ 575:	83 c4 0c             	add    $0xc,%esp
+ 578:	5b                   	pop    %ebx
+ 579:	5e                   	pop    %esi
+ 57a:	5f                   	pop    %edi
+ 57b:	5d                   	pop    %ebp
+ 57c:	c3                   	ret
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 589:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 58d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 590:	74 0e                	je     5a0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 592:	83 c4 1c             	add    $0x1c,%esp
+ 595:	5b                   	pop    %ebx
+ 596:	5e                   	pop    %esi
+ 597:	5f                   	pop    %edi
+ 598:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 599:	e9 a5 03 00 00       	jmp    943 <clock_gettime>
+ 59e:	66 90                	xchg   %ax,%ax
+ 5a0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 5a2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 5a8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5ae:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 5b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5b6:	89 d0                	mov    %edx,%eax
+ 5b8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5bb:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5c1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 5c7:	89 c6                	mov    %eax,%esi
+ 5c9:	89 d7                	mov    %edx,%edi
+ 5cb:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5ce:	d3 e6                	shl    %cl,%esi
+ 5d0:	31 c0                	xor    %eax,%eax
+ 5d2:	f6 c1 20             	test   $0x20,%cl
+ 5d5:	0f 45 fe             	cmovne %esi,%edi
+ 5d8:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5de:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 5e5:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5eb:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5ee:	d3 ea                	shr    %cl,%edx
+ 5f0:	f6 c1 20             	test   $0x20,%cl
+ 5f3:	74 04                	je     5f9 <vclock_gettime+0x79>
+ 5f5:	89 d0                	mov    %edx,%eax
+ 5f7:	31 d2                	xor    %edx,%edx
+ 5f9:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 5fb:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 600:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 602:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 604:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 606:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 608:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 60e:	29 c1                	sub    %eax,%ecx
+}
+ 610:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 612:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 615:	83 c4 1c             	add    $0x1c,%esp
+ 618:	5b                   	pop    %ebx
+ 619:	5e                   	pop    %esi
+ 61a:	5f                   	pop    %edi
+ 61b:	5d                   	pop    %ebp
+ 61c:	c3                   	ret
+
+0000061d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 61d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 622:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 629:	74 09                	je     634 <fork+0x17>
+ 62b:	89 e1                	mov    %esp,%ecx
+ 62d:	ba 36 06 00 00       	mov    $0x636,%edx
+ 632:	0f 34                	sysenter
+ 634:	cd 40                	int    $0x40
+ 636:	c3                   	ret
+
+00000637 <exit>:
+SYSCALL(exit)
+ 637:	b8 02 00 00 00       	mov    $0x2,%eax
+ 63c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 643:	74 09                	je     64e <exit+0x17>
+ 645:	89 e1                	mov    %esp,%ecx
+ 647:	ba 50 06 00 00       	mov    $0x650,%edx
+ 64c:	0f 34                	sysenter
+ 64e:	cd 40                	int    $0x40
+ 650:	c3                   	ret
+
+00000651 <wait>:
+SYSCALL(wait)
+ 651:	b8 03 00 00 00       	mov    $0x3,%eax
+ 656:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 65d:	74 09                	je     668 <wait+0x17>
+ 65f:	89 e1                	mov    %esp,%ecx
+ 661:	ba 6a 06 00 00       	mov    $0x66a,%edx
+ 666:	0f 34                	sysenter
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <pipe>:
+SYSCALL(pipe)
+ 66b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 670:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 677:	74 09                	je     682 <pipe+0x17>
+ 679:	89 e1                	mov    %esp,%ecx
+ 67b:	ba 84 06 00 00       	mov    $0x684,%edx
+ 680:	0f 34                	sysenter
+ 682:	cd 40                	int    $0x40
+ 684:	c3                   	ret
+
+00000685 <read>:
+SYSCALL(read)
+ 685:	b8 05 00 00 00       	mov    $0x5,%eax
+ 68a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 691:	74 09                	je     69c <read+0x17>
+ 693:	89 e1                	mov    %esp,%ecx
+ 695:	ba 9e 06 00 00       	mov    $0x69e,%edx
+ 69a:	0f 34                	sysenter
+ 69c:	cd 40                	int    $0x40
+ 69e:	c3                   	ret
+
+0000069f <write>:
+SYSCALL(write)
+ 69f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6ab:	74 09                	je     6b6 <write+0x17>
+ 6ad:	89 e1                	mov    %esp,%ecx
+ 6af:	ba b8 06 00 00       	mov    $0x6b8,%edx
+ 6b4:	0f 34                	sysenter
+ 6b6:	cd 40                	int    $0x40
+ 6b8:	c3                   	ret
+
+000006b9 <close>:
+SYSCALL(close)
+ 6b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6c5:	74 09                	je     6d0 <close+0x17>
+ 6c7:	89 e1                	mov    %esp,%ecx
+ 6c9:	ba d2 06 00 00       	mov    $0x6d2,%edx
+ 6ce:	0f 34                	sysenter
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <kill>:
+SYSCALL(kill)
+ 6d3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6df:	74 09                	je     6ea <kill+0x17>
+ 6e1:	89 e1                	mov    %esp,%ecx
+ 6e3:	ba ec 06 00 00       	mov    $0x6ec,%edx
+ 6e8:	0f 34                	sysenter
+ 6ea:	cd 40                	int    $0x40
+ 6ec:	c3                   	ret
+
+000006ed <exec>:
+SYSCALL(exec)
+ 6ed:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f9:	74 09                	je     704 <exec+0x17>
+ 6fb:	89 e1                	mov    %esp,%ecx
+ 6fd:	ba 06 07 00 00       	mov    $0x706,%edx
+ 702:	0f 34                	sysenter
+ 704:	cd 40                	int    $0x40
+ 706:	c3                   	ret
+
+00000707 <open>:
+SYSCALL(open)
+ 707:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 70c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 713:	74 09                	je     71e <open+0x17>
+ 715:	89 e1                	mov    %esp,%ecx
+ 717:	ba 20 07 00 00       	mov    $0x720,%edx
+ 71c:	0f 34                	sysenter
+ 71e:	cd 40                	int    $0x40
+ 720:	c3                   	ret
+
+00000721 <mknod>:
+SYSCALL(mknod)
+ 721:	b8 11 00 00 00       	mov    $0x11,%eax
+ 726:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 72d:	74 09                	je     738 <mknod+0x17>
+ 72f:	89 e1                	mov    %esp,%ecx
+ 731:	ba 3a 07 00 00       	mov    $0x73a,%edx
+ 736:	0f 34                	sysenter
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <unlink>:
+SYSCALL(unlink)
+ 73b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 740:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 747:	74 09                	je     752 <unlink+0x17>
+ 749:	89 e1                	mov    %esp,%ecx
+ 74b:	ba 54 07 00 00       	mov    $0x754,%edx
+ 750:	0f 34                	sysenter
+ 752:	cd 40                	int    $0x40
+ 754:	c3                   	ret
+
+00000755 <fstat>:
+SYSCALL(fstat)
+ 755:	b8 08 00 00 00       	mov    $0x8,%eax
+ 75a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 761:	74 09                	je     76c <fstat+0x17>
+ 763:	89 e1                	mov    %esp,%ecx
+ 765:	ba 6e 07 00 00       	mov    $0x76e,%edx
+ 76a:	0f 34                	sysenter
+ 76c:	cd 40                	int    $0x40
+ 76e:	c3                   	ret
+
+0000076f <link>:
+SYSCALL(link)
+ 76f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 774:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 77b:	74 09                	je     786 <link+0x17>
+ 77d:	89 e1                	mov    %esp,%ecx
+ 77f:	ba 88 07 00 00       	mov    $0x788,%edx
+ 784:	0f 34                	sysenter
+ 786:	cd 40                	int    $0x40
+ 788:	c3                   	ret
+
+00000789 <mkdir>:
+SYSCALL(mkdir)
+ 789:	b8 14 00 00 00       	mov    $0x14,%eax
+ 78e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 795:	74 09                	je     7a0 <mkdir+0x17>
+ 797:	89 e1                	mov    %esp,%ecx
+ 799:	ba a2 07 00 00       	mov    $0x7a2,%edx
+ 79e:	0f 34                	sysenter
+ 7a0:	cd 40                	int    $0x40
+ 7a2:	c3                   	ret
+
+000007a3 <chdir>:
+SYSCALL(chdir)
+ 7a3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7a8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7af:	74 09                	je     7ba <chdir+0x17>
+ 7b1:	89 e1                	mov    %esp,%ecx
+ 7b3:	ba bc 07 00 00       	mov    $0x7bc,%edx
+ 7b8:	0f 34                	sysenter
+ 7ba:	cd 40                	int    $0x40
+ 7bc:	c3                   	ret
+
+000007bd <dup>:
+SYSCALL(dup)
+ 7bd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7c2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c9:	74 09                	je     7d4 <dup+0x17>
+ 7cb:	89 e1                	mov    %esp,%ecx
+ 7cd:	ba d6 07 00 00       	mov    $0x7d6,%edx
+ 7d2:	0f 34                	sysenter
+ 7d4:	cd 40                	int    $0x40
+ 7d6:	c3                   	ret
+
+000007d7 <getpid>:
+SYSCALL(getpid)
+ 7d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7dc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7e3:	74 09                	je     7ee <getpid+0x17>
+ 7e5:	89 e1                	mov    %esp,%ecx
+ 7e7:	ba f0 07 00 00       	mov    $0x7f0,%edx
+ 7ec:	0f 34                	sysenter
+ 7ee:	cd 40                	int    $0x40
+ 7f0:	c3                   	ret
+
+000007f1 <sbrk>:
+SYSCALL(sbrk)
+ 7f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7f6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7fd:	74 09                	je     808 <sbrk+0x17>
+ 7ff:	89 e1                	mov    %esp,%ecx
+ 801:	ba 0a 08 00 00       	mov    $0x80a,%edx
+ 806:	0f 34                	sysenter
+ 808:	cd 40                	int    $0x40
+ 80a:	c3                   	ret
+
+0000080b <sleep>:
+SYSCALL(sleep)
+ 80b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 810:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 817:	74 09                	je     822 <sleep+0x17>
+ 819:	89 e1                	mov    %esp,%ecx
+ 81b:	ba 24 08 00 00       	mov    $0x824,%edx
+ 820:	0f 34                	sysenter
+ 822:	cd 40                	int    $0x40
+ 824:	c3                   	ret
+
+00000825 <uptime>:
+SYSCALL(uptime)
+ 825:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 82a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 831:	74 09                	je     83c <uptime+0x17>
+ 833:	89 e1                	mov    %esp,%ecx
+ 835:	ba 3e 08 00 00       	mov    $0x83e,%edx
+ 83a:	0f 34                	sysenter
+ 83c:	cd 40                	int    $0x40
+ 83e:	c3                   	ret
+
+0000083f <mmap>:
+SYSCALL(mmap)
+ 83f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 844:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 84b:	74 09                	je     856 <mmap+0x17>
+ 84d:	89 e1                	mov    %esp,%ecx
+ 84f:	ba 58 08 00 00       	mov    $0x858,%edx
+ 854:	0f 34                	sysenter
+ 856:	cd 40                	int    $0x40
+ 858:	c3                   	ret
+
+00000859 <munmap>:
+SYSCALL(munmap)
+ 859:	b8 17 00 00 00       	mov    $0x17,%eax
+ 85e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 865:	74 09                	je     870 <munmap+0x17>
+ 867:	89 e1                	mov    %esp,%ecx
+ 869:	ba 72 08 00 00       	mov    $0x872,%edx
+ 86e:	0f 34                	sysenter
+ 870:	cd 40                	int    $0x40
+ 872:	c3                   	ret
+
+00000873 <clone>:
+SYSCALL(clone)
+ 873:	b8 18 00 00 00       	mov    $0x18,%eax
+ 878:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 87f:	74 09                	je     88a <clone+0x17>
+ 881:	89 e1                	mov    %esp,%ecx
+ 883:	ba 8c 08 00 00       	mov    $0x88c,%edx
+ 888:	0f 34                	sysenter
+ 88a:	cd 40                	int    $0x40
+ 88c:	c3                   	ret
+
+0000088d <join>:
+SYSCALL(join)
+ 88d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 892:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 899:	74 09                	je     8a4 <join+0x17>
+ 89b:	89 e1                	mov    %esp,%ecx
+ 89d:	ba a6 08 00 00       	mov    $0x8a6,%edx
+ 8a2:	0f 34                	sysenter
+ 8a4:	cd 40                	int    $0x40
+ 8a6:	c3                   	ret
+
+000008a7 <futex>:
+SYSCALL(futex)
+ 8a7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8ac:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8b3:	74 09                	je     8be <futex+0x17>
+ 8b5:	89 e1                	mov    %esp,%ecx
+ 8b7:	ba c0 08 00 00       	mov    $0x8c0,%edx
+ 8bc:	0f 34                	sysenter
+ 8be:	cd 40                	int    $0x40
+ 8c0:	c3                   	ret
+
+000008c1 <memstat>:
+SYSCALL(memstat)
+ 8c1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8c6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8cd:	74 09                	je     8d8 <memstat+0x17>
+ 8cf:	89 e1                	mov    %esp,%ecx
+ 8d1:	ba da 08 00 00       	mov    $0x8da,%edx
+ 8d6:	0f 34                	sysenter
+ 8d8:	cd 40                	int    $0x40
+ 8da:	c3                   	ret
+
+000008db <nice>:
+SYSCALL(nice)
+ 8db:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8e0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8e7:	74 09                	je     8f2 <nice+0x17>
+ 8e9:	89 e1                	mov    %esp,%ecx
+ 8eb:	ba f4 08 00 00       	mov    $0x8f4,%edx
+ 8f0:	0f 34                	sysenter
+ 8f2:	cd 40                	int    $0x40
+ 8f4:	c3                   	ret
+
+000008f5 <setpriority>:
+SYSCALL(setpriority)
+ 8f5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8fa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 901:	74 09                	je     90c <setpriority+0x17>
+ 903:	89 e1                	mov    %esp,%ecx
+ 905:	ba 0e 09 00 00       	mov    $0x90e,%edx
+ 90a:	0f 34                	sysenter
+ 90c:	cd 40                	int    $0x40
+ 90e:	c3                   	ret
+
+0000090f <getpinfo>:
+SYSCALL(getpinfo)
+ 90f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 914:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 91b:	74 09                	je     926 <getpinfo+0x17>
+ 91d:	89 e1                	mov    %esp,%ecx
+ 91f:	ba 28 09 00 00       	mov    $0x928,%edx
+ 924:	0f 34                	sysenter
+ 926:	cd 40                	int    $0x40
+ 928:	c3                   	ret
+
+00000929 <settickets>:
+SYSCALL(settickets)
+ 929:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 92e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 935:	74 09                	je     940 <settickets+0x17>
+ 937:	89 e1                	mov    %esp,%ecx
+ 939:	ba 42 09 00 00       	mov    $0x942,%edx
+ 93e:	0f 34                	sysenter
+ 940:	cd 40                	int    $0x40
+ 942:	c3                   	ret
+
+00000943 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 943:	b8 20 00 00 00       	mov    $0x20,%eax
+ 948:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 94f:	74 09                	je     95a <clock_gettime+0x17>
+ 951:	89 e1                	mov    %esp,%ecx
+ 953:	ba 5c 09 00 00       	mov    $0x95c,%edx
+ 958:	0f 34                	sysenter
+ 95a:	cd 40                	int    $0x40
+ 95c:	c3                   	ret
+
+0000095d <batch>:
+SYSCALL(batch)
+ 95d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 962:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 969:	74 09                	je     974 <batch+0x17>
+ 96b:	89 e1                	mov    %esp,%ecx
+ 96d:	ba 76 09 00 00       	mov    $0x976,%edx
+ 972:	0f 34                	sysenter
+ 974:	cd 40                	int    $0x40
+ 976:	c3                   	ret
+
+00000977 <aiosetup>:
+SYSCALL(aiosetup)
+ 977:	b8 22 00 00 00       	mov    $0x22,%eax
+ 97c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 983:	74 09                	je     98e <aiosetup+0x17>
+ 985:	89 e1                	mov    %esp,%ecx
+ 987:	ba 90 09 00 00       	mov    $0x990,%edx
+ 98c:	0f 34                	sysenter
+ 98e:	cd 40                	int    $0x40
+ 990:	c3                   	ret
+
+00000991 <aioenter>:
+SYSCALL(aioenter)
+ 991:	b8 23 00 00 00       	mov    $0x23,%eax
+ 996:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 99d:	74 09                	je     9a8 <aioenter+0x17>
+ 99f:	89 e1                	mov    %esp,%ecx
+ 9a1:	ba aa 09 00 00       	mov    $0x9aa,%edx
+ 9a6:	0f 34                	sysenter
+ 9a8:	cd 40                	int    $0x40
+ 9aa:	c3                   	ret
+
+000009ab <systrace>:
+SYSCALL(systrace)
+ 9ab:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9b0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9b7:	74 09                	je     9c2 <systrace+0x17>
+ 9b9:	89 e1                	mov    %esp,%ecx
+ 9bb:	ba c4 09 00 00       	mov    $0x9c4,%edx
+ 9c0:	0f 34                	sysenter
+ 9c2:	cd 40                	int    $0x40
+ 9c4:	c3                   	ret
+
+000009c5 <sysstat>:
+SYSCALL(sysstat)
+ 9c5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9ca:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9d1:	74 09                	je     9dc <sysstat+0x17>
+ 9d3:	89 e1                	mov    %esp,%ecx
+ 9d5:	ba de 09 00 00       	mov    $0x9de,%edx
+ 9da:	0f 34                	sysenter
+ 9dc:	cd 40                	int    $0x40
+ 9de:	c3                   	ret
+
+000009df <traceread>:
+SYSCALL(traceread)
+ 9df:	b8 26 00 00 00       	mov    $0x26,%eax
+ 9e4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9eb:	74 09                	je     9f6 <traceread+0x17>
+ 9ed:	89 e1                	mov    %esp,%ecx
+ 9ef:	ba f8 09 00 00       	mov    $0x9f8,%edx
+ 9f4:	0f 34                	sysenter
+ 9f6:	cd 40                	int    $0x40
+ 9f8:	c3                   	ret
+ 9f9:	66 90                	xchg   %ax,%ax
+ 9fb:	66 90                	xchg   %ax,%ax
+ 9fd:	66 90                	xchg   %ax,%ax
+ 9ff:	90                   	nop
+
+00000a00 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a08:	89 d1                	mov    %edx,%ecx
+{
+ a0a:	83 ec 3c             	sub    $0x3c,%esp
+ a0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a10:	85 d2                	test   %edx,%edx
+ a12:	0f 89 80 00 00 00    	jns    a98 <printint+0x98>
+ a18:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a1c:	74 7a                	je     a98 <printint+0x98>
+    x = -xx;
+ a1e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a20:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a25:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a28:	31 f6                	xor    %esi,%esi
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a30:	89 c8                	mov    %ecx,%eax
+ a32:	31 d2                	xor    %edx,%edx
+ a34:	89 f7                	mov    %esi,%edi
+ a36:	f7 f3                	div    %ebx
+ a38:	8d 76 01             	lea    0x1(%esi),%esi
+ a3b:	0f b6 92 30 0f 00 00 	movzbl 0xf30(%edx),%edx
+ a42:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a46:	89 ca                	mov    %ecx,%edx
+ a48:	89 c1                	mov    %eax,%ecx
+ a4a:	39 da                	cmp    %ebx,%edx
+ a4c:	73 e2                	jae    a30 <printint+0x30>
+  if(neg)
+ a4e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a51:	85 c0                	test   %eax,%eax
+ a53:	74 07                	je     a5c <printint+0x5c>
+    buf[i++] = '-';
+ a55:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a5a:	89 f7                	mov    %esi,%edi
+ a5c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a5f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a62:	01 df                	add    %ebx,%edi
+ a64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a68:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a6b:	83 ec 04             	sub    $0x4,%esp
+ a6e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a71:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a74:	6a 01                	push   $0x1
+ a76:	50                   	push   %eax
+ a77:	56                   	push   %esi
+ a78:	e8 22 fc ff ff       	call   69f <write>
+  while(--i >= 0)
+ a7d:	89 f8                	mov    %edi,%eax
+ a7f:	83 c4 10             	add    $0x10,%esp
+ a82:	83 ef 01             	sub    $0x1,%edi
+ a85:	39 d8                	cmp    %ebx,%eax
+ a87:	75 df                	jne    a68 <printint+0x68>
+}
+ a89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a8c:	5b                   	pop    %ebx
+ a8d:	5e                   	pop    %esi
+ a8e:	5f                   	pop    %edi
+ a8f:	5d                   	pop    %ebp
+ a90:	c3                   	ret
+ a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a98:	31 c0                	xor    %eax,%eax
+ a9a:	eb 89                	jmp    a25 <printint+0x25>
+ a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000aa0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ aa0:	55                   	push   %ebp
+ aa1:	89 e5                	mov    %esp,%ebp
+ aa3:	57                   	push   %edi
+ aa4:	56                   	push   %esi
+ aa5:	53                   	push   %ebx
+ aa6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ aa9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ aac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ aaf:	0f b6 1e             	movzbl (%esi),%ebx
+ ab2:	83 c6 01             	add    $0x1,%esi
+ ab5:	84 db                	test   %bl,%bl
+ ab7:	74 67                	je     b20 <printf+0x80>
+ ab9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ abc:	31 d2                	xor    %edx,%edx
+ abe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ ac1:	eb 34                	jmp    af7 <printf+0x57>
+ ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ac7:	90                   	nop
+ ac8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ acb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ ad0:	83 f8 25             	cmp    $0x25,%eax
+ ad3:	74 18                	je     aed <printf+0x4d>
+  write(fd, &c, 1);
+ ad5:	83 ec 04             	sub    $0x4,%esp
+ ad8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ adb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ade:	6a 01                	push   $0x1
+ ae0:	50                   	push   %eax
+ ae1:	57                   	push   %edi
+ ae2:	e8 b8 fb ff ff       	call   69f <write>
+ ae7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ aea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ aed:	0f b6 1e             	movzbl (%esi),%ebx
+ af0:	83 c6 01             	add    $0x1,%esi
+ af3:	84 db                	test   %bl,%bl
+ af5:	74 29                	je     b20 <printf+0x80>
+    c = fmt[i] & 0xff;
+ af7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ afa:	85 d2                	test   %edx,%edx
+ afc:	74 ca                	je     ac8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ afe:	83 fa 25             	cmp    $0x25,%edx
+ b01:	75 ea                	jne    aed <printf+0x4d>
+      if(c == 'd'){
+ b03:	83 f8 25             	cmp    $0x25,%eax
+ b06:	0f 84 24 01 00 00    	je     c30 <printf+0x190>
+ b0c:	83 e8 63             	sub    $0x63,%eax
+ b0f:	83 f8 15             	cmp    $0x15,%eax
+ b12:	77 1c                	ja     b30 <printf+0x90>
+ b14:	ff 24 85 d8 0e 00 00 	jmp    *0xed8(,%eax,4)
+ b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b23:	5b                   	pop    %ebx
+ b24:	5e                   	pop    %esi
+ b25:	5f                   	pop    %edi
+ b26:	5d                   	pop    %ebp
+ b27:	c3                   	ret
+ b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2f:	90                   	nop
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b3a:	6a 01                	push   $0x1
+ b3c:	52                   	push   %edx
+ b3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b40:	57                   	push   %edi
+ b41:	e8 59 fb ff ff       	call   69f <write>
+ b46:	83 c4 0c             	add    $0xc,%esp
+ b49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b4c:	6a 01                	push   $0x1
+ b4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b51:	52                   	push   %edx
+ b52:	57                   	push   %edi
+ b53:	e8 47 fb ff ff       	call   69f <write>
+        putc(fd, c);
+ b58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b5b:	31 d2                	xor    %edx,%edx
+ b5d:	eb 8e                	jmp    aed <printf+0x4d>
+ b5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b6b:	8b 13                	mov    (%ebx),%edx
+ b6d:	6a 00                	push   $0x0
+ b6f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b74:	e8 87 fe ff ff       	call   a00 <printint>
+        ap++;
+ b79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b7f:	31 d2                	xor    %edx,%edx
+ b81:	e9 67 ff ff ff       	jmp    aed <printf+0x4d>
+ b86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b95:	83 c0 04             	add    $0x4,%eax
+ b98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b9b:	85 db                	test   %ebx,%ebx
+ b9d:	0f 84 9d 00 00 00    	je     c40 <printf+0x1a0>
+        while(*s != 0){
+ ba3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ba6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ba8:	84 c0                	test   %al,%al
+ baa:	0f 84 3d ff ff ff    	je     aed <printf+0x4d>
+ bb0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bb3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ bb6:	89 de                	mov    %ebx,%esi
+ bb8:	89 d3                	mov    %edx,%ebx
+ bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ bc6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ bc9:	6a 01                	push   $0x1
+ bcb:	53                   	push   %ebx
+ bcc:	57                   	push   %edi
+ bcd:	e8 cd fa ff ff       	call   69f <write>
+        while(*s != 0){
+ bd2:	0f b6 06             	movzbl (%esi),%eax
+ bd5:	83 c4 10             	add    $0x10,%esp
+ bd8:	84 c0                	test   %al,%al
+ bda:	75 e4                	jne    bc0 <printf+0x120>
+      state = 0;
+ bdc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ bdf:	31 d2                	xor    %edx,%edx
+ be1:	e9 07 ff ff ff       	jmp    aed <printf+0x4d>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ bf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bfb:	8b 13                	mov    (%ebx),%edx
+ bfd:	6a 01                	push   $0x1
+ bff:	e9 6b ff ff ff       	jmp    b6f <printf+0xcf>
+ c04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c0b:	83 ec 04             	sub    $0x4,%esp
+ c0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c19:	6a 01                	push   $0x1
+ c1b:	52                   	push   %edx
+ c1c:	57                   	push   %edi
+ c1d:	e8 7d fa ff ff       	call   69f <write>
+        ap++;
+ c22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c28:	31 d2                	xor    %edx,%edx
+ c2a:	e9 be fe ff ff       	jmp    aed <printf+0x4d>
+ c2f:	90                   	nop
+  write(fd, &c, 1);
+ c30:	83 ec 04             	sub    $0x4,%esp
+ c33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c39:	6a 01                	push   $0x1
+ c3b:	e9 11 ff ff ff       	jmp    b51 <printf+0xb1>
+ c40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c45:	bb d0 0e 00 00       	mov    $0xed0,%ebx
+ c4a:	e9 61 ff ff ff       	jmp    bb0 <printf+0x110>
+ c4f:	90                   	nop
+
+00000c50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c51:	a1 c8 13 00 00       	mov    0x13c8,%eax
+{
+ c56:	89 e5                	mov    %esp,%ebp
+ c58:	57                   	push   %edi
+ c59:	56                   	push   %esi
+ c5a:	53                   	push   %ebx
+ c5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c6c:	39 ca                	cmp    %ecx,%edx
+ c6e:	73 30                	jae    ca0 <free+0x50>
+ c70:	39 c1                	cmp    %eax,%ecx
+ c72:	72 04                	jb     c78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c74:	39 c2                	cmp    %eax,%edx
+ c76:	72 f0                	jb     c68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c7e:	39 f8                	cmp    %edi,%eax
+ c80:	74 2e                	je     cb0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c85:	8b 42 04             	mov    0x4(%edx),%eax
+ c88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c8b:	39 f1                	cmp    %esi,%ecx
+ c8d:	74 38                	je     cc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c91:	5b                   	pop    %ebx
+  freep = p;
+ c92:	89 15 c8 13 00 00    	mov    %edx,0x13c8
+}
+ c98:	5e                   	pop    %esi
+ c99:	5f                   	pop    %edi
+ c9a:	5d                   	pop    %ebp
+ c9b:	c3                   	ret
+ c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 d0                	jb     c74 <free+0x24>
+ ca4:	eb c2                	jmp    c68 <free+0x18>
+ ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ cb0:	03 70 04             	add    0x4(%eax),%esi
+ cb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb6:	8b 02                	mov    (%edx),%eax
+ cb8:	8b 00                	mov    (%eax),%eax
+ cba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ cbd:	8b 42 04             	mov    0x4(%edx),%eax
+ cc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cc3:	39 f1                	cmp    %esi,%ecx
+ cc5:	75 c8                	jne    c8f <free+0x3f>
+    p->s.size += bp->s.size;
+ cc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cca:	89 15 c8 13 00 00    	mov    %edx,0x13c8
+    p->s.size += bp->s.size;
+ cd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ cd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ cd6:	89 0a                	mov    %ecx,(%edx)
+}
+ cd8:	5b                   	pop    %ebx
+ cd9:	5e                   	pop    %esi
+ cda:	5f                   	pop    %edi
+ cdb:	5d                   	pop    %ebp
+ cdc:	c3                   	ret
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ce0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	57                   	push   %edi
+ ce4:	56                   	push   %esi
+ ce5:	53                   	push   %ebx
+ ce6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ cec:	8b 15 c8 13 00 00    	mov    0x13c8,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cf2:	8d 78 07             	lea    0x7(%eax),%edi
+ cf5:	c1 ef 03             	shr    $0x3,%edi
+ cf8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cfb:	85 d2                	test   %edx,%edx
+ cfd:	0f 84 8d 00 00 00    	je     d90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d05:	8b 48 04             	mov    0x4(%eax),%ecx
+ d08:	39 f9                	cmp    %edi,%ecx
+ d0a:	73 64                	jae    d70 <malloc+0x90>
+  if(nu < 4096)
+ d0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d11:	39 df                	cmp    %ebx,%edi
+ d13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d1d:	eb 0a                	jmp    d29 <malloc+0x49>
+ d1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d22:	8b 48 04             	mov    0x4(%eax),%ecx
+ d25:	39 f9                	cmp    %edi,%ecx
+ d27:	73 47                	jae    d70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d29:	89 c2                	mov    %eax,%edx
+ d2b:	39 05 c8 13 00 00    	cmp    %eax,0x13c8
+ d31:	75 ed                	jne    d20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d33:	83 ec 0c             	sub    $0xc,%esp
+ d36:	56                   	push   %esi
+ d37:	e8 b5 fa ff ff       	call   7f1 <sbrk>
+  if(p == (char*)-1)
+ d3c:	83 c4 10             	add    $0x10,%esp
+ d3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d42:	74 1c                	je     d60 <malloc+0x80>
+  hp->s.size = nu;
+ d44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d47:	83 ec 0c             	sub    $0xc,%esp
+ d4a:	83 c0 08             	add    $0x8,%eax
+ d4d:	50                   	push   %eax
+ d4e:	e8 fd fe ff ff       	call   c50 <free>
+  return freep;
+ d53:	8b 15 c8 13 00 00    	mov    0x13c8,%edx
+      if((p = morecore(nunits)) == 0)
+ d59:	83 c4 10             	add    $0x10,%esp
+ d5c:	85 d2                	test   %edx,%edx
+ d5e:	75 c0                	jne    d20 <malloc+0x40>
+        return 0;
+  }
+}
+ d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d63:	31 c0                	xor    %eax,%eax
+}
+ d65:	5b                   	pop    %ebx
+ d66:	5e                   	pop    %esi
+ d67:	5f                   	pop    %edi
+ d68:	5d                   	pop    %ebp
+ d69:	c3                   	ret
+ d6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d70:	39 cf                	cmp    %ecx,%edi
+ d72:	74 4c                	je     dc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ d74:	29 f9                	sub    %edi,%ecx
+ d76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d7f:	89 15 c8 13 00 00    	mov    %edx,0x13c8
+}
+ d85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d88:	83 c0 08             	add    $0x8,%eax
+}
+ d8b:	5b                   	pop    %ebx
+ d8c:	5e                   	pop    %esi
+ d8d:	5f                   	pop    %edi
+ d8e:	5d                   	pop    %ebp
+ d8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d90:	c7 05 c8 13 00 00 cc 	movl   $0x13cc,0x13c8
+ d97:	13 00 00 
+    base.s.size = 0;
+ d9a:	b8 cc 13 00 00       	mov    $0x13cc,%eax
+    base.s.ptr = freep = prevp = &base;
+ d9f:	c7 05 cc 13 00 00 cc 	movl   $0x13cc,0x13cc
+ da6:	13 00 00 
+    base.s.size = 0;
+ da9:	c7 05 d0 13 00 00 00 	movl   $0x0,0x13d0
+ db0:	00 00 00 
+    if(p->s.size >= nunits){
+ db3:	e9 54 ff ff ff       	jmp    d0c <malloc+0x2c>
+ db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ dc0:	8b 08                	mov    (%eax),%ecx
+ dc2:	89 0a                	mov    %ecx,(%edx)
+ dc4:	eb b9                	jmp    d7f <malloc+0x9f>
+ dc6:	66 90                	xchg   %ax,%ax
+ dc8:	66 90                	xchg   %ax,%ax
+ dca:	66 90                	xchg   %ax,%ax
+ dcc:	66 90                	xchg   %ax,%ax
+ dce:	66 90                	xchg   %ax,%ax
+
+00000dd0 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	53                   	push   %ebx
+ dd4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ dd7:	68 00 20 00 00       	push   $0x2000
+ ddc:	e8 ff fe ff ff       	call   ce0 <malloc>
+ de1:	83 c4 10             	add    $0x10,%esp
+ de4:	85 c0                	test   %eax,%eax
+ de6:	74 47                	je     e2f <thread_create+0x5f>
+ de8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ dea:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ df0:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ df3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ df8:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ dfb:	ff 75 0c             	push   0xc(%ebp)
+ dfe:	50                   	push   %eax
+ dff:	ff 75 08             	push   0x8(%ebp)
+ e02:	e8 6c fa ff ff       	call   873 <clone>
+ e07:	83 c4 10             	add    $0x10,%esp
+ e0a:	85 c0                	test   %eax,%eax
+ e0c:	78 0a                	js     e18 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e11:	c9                   	leave
+ e12:	c3                   	ret
+ e13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e17:	90                   	nop
+    free(mem);
+ e18:	83 ec 0c             	sub    $0xc,%esp
+ e1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e1e:	53                   	push   %ebx
+ e1f:	e8 2c fe ff ff       	call   c50 <free>
+ e24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e2a:	83 c4 10             	add    $0x10,%esp
+}
+ e2d:	c9                   	leave
+ e2e:	c3                   	ret
+    return -1;
+ e2f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e34:	eb d8                	jmp    e0e <thread_create+0x3e>
+ e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ e44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ e47:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ e4a:	50                   	push   %eax
+ e4b:	e8 3d fa ff ff       	call   88d <join>
+ e50:	83 c4 10             	add    $0x10,%esp
+ e53:	85 c0                	test   %eax,%eax
+ e55:	78 21                	js     e78 <thread_join+0x38>
+ e57:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ e59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e5c:	83 ec 0c             	sub    $0xc,%esp
+ e5f:	ff 70 fc             	push   -0x4(%eax)
+ e62:	e8 e9 fd ff ff       	call   c50 <free>
+  return pid;
+ e67:	83 c4 10             	add    $0x10,%esp
+}
+ e6a:	89 d8                	mov    %ebx,%eax
+ e6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e6f:	c9                   	leave
+ e70:	c3                   	ret
+ e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ e78:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ e7d:	eb eb                	jmp    e6a <thread_join+0x2a>
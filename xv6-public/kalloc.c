@@ -1,6 +1,18 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, or naturally
+// aligned blocks of 2^order contiguous pages.
+//
+// Free memory is kept by a buddy allocator: one free list per
+// order, where a block of order k is 2^k pages aligned to its own
+// size.  Freeing a block merges it with its buddy (the other half
+// of the enclosing order k+1 block) whenever the buddy is free too.
+// Single pages are also cached per CPU (see struct kmag) so that
+// kalloc() and kfree() rarely touch the buddy lists.
+//
+// Building with -DKPOISON (make KPOISON=1) fills freed pages with
+// junk and checks on allocation that the junk is intact, to catch
+// writes through dangling pointers.  Other builds skip the fill.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +20,8 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "x86.h"
+#include "memstat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,82 +29,591 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;  // buddy lists only
 };
 
-struct {
+// Each CPU keeps a magazine of free pages so that most kalloc()
+// and kfree() calls touch only that CPU's lock.  Magazines refill
+// from and drain to the buddy lists KBATCH pages at a time.
+#define KMAGSIZE 64   // most pages a magazine holds
+#define KBATCH   32   // pages moved to or from the buddy lists at once
+
+// The statistics live here too, so that counting an allocation
+// writes only this CPU's cache lines.  Each CPU updates its own
+// counts with interrupts off; kmemstat() adds them up.
+struct kmag {
   struct spinlock lock;
-  int use_lock;
   struct run *freelist;
+  int n;
+  int inuse;                          // pages allocated less pages freed
+  uint nalloc;                        // allocation calls
+  uint nfreed;                        // free calls
+  uint allocs[MEMSTAT_NSITE];         // per call site in kmem.sitepc[]
+  uint frees[MEMSTAT_NSITE];
+};
+
+struct {
+  struct spinlock lock;               // protects free[], nfree[], order[]
+  int use_lock;
+  struct run *free[KMAXORDER+1];      // free blocks of each order
+  int nfree[KMAXORDER+1];             // length of each free list
+  uchar *order;                       // order+1 of the free block starting
+                                      // at each page, 0 if none
+  struct kmag cpu[NCPU];
+
+  uint npages;                        // pages given to the allocator
+  uint peak;                          // most pages seen in use; see kmempeak
+  uint sitepc[MEMSTAT_NSITE];         // call sites, open-addressed by pc
 } kmem;
 
+#define KPOISONBYTE 1
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Neither touches the free pages themselves (see freerange).
+// Until kinit2() finishes only one CPU is running, so the
+// magazines are not used and pages go straight to the buddy lists.
+// kinit1() takes the per-page order array, sized for phystop,
+// from the start of its range.
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kmem.cpu[i].lock, "kmag");
   kmem.use_lock = 0;
-  freerange(vstart, vend);
+  kmem.order = vstart;
+  memset(kmem.order, 0, phystop/PGSIZE);
+  freerange(kmem.order + phystop/PGSIZE, vend);
 }
 
+// Free the usable parts of [vstart, vend), as found by
+// physmeminit(), skipping holes such as BIOS-reserved memory.
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  uint start, end;
+  int i;
+
+  for(i = 0; physmemrange(i, &start, &end) == 0; i++){
+    if(start < V2P(vstart))
+      start = V2P(vstart);
+    if(end > V2P(vend))
+      end = V2P(vend);
+    if(start < end)
+      freerange(P2V(start), P2V(end));
+  }
   kmem.use_lock = 1;
 }
 
+static void buddyfree(char*, int);
+
+// Give [vstart, vend) to the buddy lists as the largest aligned
+// blocks that fit, so initialization costs a few operations per
+// 4MB rather than a kfree() (and a junk fill) of every page.
+// Blocks are split into pages only as they are allocated.
 void
 freerange(void *vstart, void *vend)
 {
   char *p;
+  int order;
+
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  while(p + PGSIZE <= (char*)vend){
+    for(order = KMAXORDER; order > 0; order--)
+      if(V2P(p) % (PGSIZE << order) == 0 &&
+         p + (PGSIZE << order) <= (char*)vend)
+        break;
+#ifdef KPOISON
+    memset(p, KPOISONBYTE, PGSIZE << order);
+#endif
+    buddyfree(p, order);
+    kmem.npages += 1 << order;
+    p += PGSIZE << order;
+  }
 }
-//PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
-// call to kalloc().  (The exception is when
-// initializing the allocator; see kinit above.)
-void
-kfree(char *v)
+
+// The statistics slot for call site pc, or -1 if the table is full.
+// Once a site has its slot the table is only read.
+static int
+kmemsite(uint pc)
+{
+  uint i, s, old;
+
+  for(i = 0; i < MEMSTAT_NSITE; i++){
+    s = (pc/4 + i) % MEMSTAT_NSITE;
+    if(kmem.sitepc[s] == pc)
+      return s;
+    if(kmem.sitepc[s] == 0){
+      old = cmpxchg(&kmem.sitepc[s], 0, pc);
+      if(old == 0 || old == pc)
+        return s;
+    }
+  }
+  return -1;
+}
+
+// Count an allocation (alloc = 1) or free (alloc = 0) of npages
+// pages made from call site pc, in this CPU's magazine.  Before
+// kinit2() only the boot CPU allocates, and cpuid() may not work
+// yet, so the counts go to the first magazine.
+static void
+kmemcount(uint pc, int alloc, int npages)
+{
+  struct kmag *m;
+  int s;
+
+  s = kmemsite(pc);
+  m = &kmem.cpu[0];
+  if(kmem.use_lock){
+    pushcli();
+    m = &kmem.cpu[cpuid()];
+  }
+  if(alloc){
+    m->inuse += npages;
+    m->nalloc++;
+    if(s >= 0)
+      m->allocs[s]++;
+  } else {
+    m->inuse -= npages;
+    m->nfreed++;
+    if(s >= 0)
+      m->frees[s]++;
+  }
+  if(kmem.use_lock)
+    popcli();
+}
+
+// Pages in use now, summed over the CPUs without stopping them.
+static uint
+kmeminuse(void)
+{
+  struct kmag *m;
+  int n;
+
+  n = 0;
+  for(m = kmem.cpu; m < &kmem.cpu[NCPU]; m++)
+    n += m->inuse;
+  return n;
+}
+
+// Fold the pages in use now into kmem.peak.  The sum is sampled
+// when a magazine refills from the buddy lists and by kmemstat(),
+// rather than on every allocation, so a short-lived peak of less
+// than a few batches per CPU may be missed.
+// Caller holds kmem.lock.
+static void
+kmempeak(void)
+{
+  uint n;
+
+  if((n = kmeminuse()) > kmem.peak)
+    kmem.peak = n;
+}
+
+#ifdef KPOISON
+// Check that the npages pages at v still hold the junk that
+// kfree() left in them.  The first bytes of each page may hold
+// free-list links.
+static void
+kpoisoncheck(char *v, int npages)
+{
+  char *p, *q;
+
+  for(p = v; p < v + npages*PGSIZE; p += PGSIZE)
+    for(q = p + sizeof(struct run); q < p + PGSIZE; q++)
+      if(*q != KPOISONBYTE){
+        cprintf("kalloc: page %p modified at %p after free\n", p, q);
+        panic("kalloc: use after free");
+      }
+}
+#endif
+
+static void
+buddypush(struct run *r, int order)
+{
+  r->prev = 0;
+  r->next = kmem.free[order];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[order] = r;
+  kmem.nfree[order]++;
+  kmem.order[V2P(r) / PGSIZE] = order + 1;
+}
+
+static void
+buddyremove(struct run *r, int order)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[order] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.nfree[order]--;
+  kmem.order[V2P(r) / PGSIZE] = 0;
+}
+
+// Return the block of 2^order pages at v to the buddy lists,
+// merging it with its buddy as far up as possible.
+// Caller holds kmem.lock (or is still single-threaded).
+static void
+buddyfree(char *v, int order)
+{
+  uint pa, bpa;
+
+  pa = V2P(v);
+  for(; order < KMAXORDER; order++){
+    bpa = pa ^ (PGSIZE << order);
+    if(bpa >= phystop || kmem.order[bpa / PGSIZE] != order + 1)
+      break;
+    buddyremove((struct run*)P2V(bpa), order);
+    if(bpa < pa)
+      pa = bpa;
+  }
+  buddypush((struct run*)P2V(pa), order);
+}
+
+// Take a block of 2^order pages from the buddy lists, splitting
+// a larger block if need be.  Returns 0 if none is free.
+// Caller holds kmem.lock.
+static char*
+buddyalloc(int order)
+{
+  struct run *r;
+  int k;
+
+  for(k = order; k <= KMAXORDER && kmem.free[k] == 0; k++)
+    ;
+  if(k > KMAXORDER)
+    return 0;
+  r = kmem.free[k];
+  buddyremove(r, k);
+  // Give back the upper half at each level until the block
+  // is the requested size.
+  while(k > order){
+    k--;
+    buddypush((struct run*)((char*)r + (PGSIZE << k)), k);
+  }
+  return (char*)r;
+}
+
+// This CPU's magazine.  The caller may migrate to another CPU
+// afterwards; that is harmless since every magazine has a lock.
+static struct kmag*
+mymag(void)
+{
+  struct kmag *m;
+
+  pushcli();
+  m = &kmem.cpu[cpuid()];
+  popcli();
+  return m;
+}
+
+// Free the n single pages on list to the buddy lists.
+static void
+kmemputlist(struct run *list, int n)
 {
   struct run *r;
 
-  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+  acquire(&kmem.lock);
+  while(n-- > 0){
+    r = list;
+    list = list->next;
+    buddyfree((char*)r, 0);
+  }
+  release(&kmem.lock);
+}
+
+// Take up to n single pages from the buddy lists.
+// Returns the chain and stores its length in *got.
+static struct run*
+kmemgetlist(int n, int *got)
+{
+  struct run *list, *r;
+  int i;
+
+  list = 0;
+  acquire(&kmem.lock);
+  kmempeak();
+  for(i = 0; i < n; i++){
+    if((r = (struct run*)buddyalloc(0)) == 0)
+      break;
+    r->next = list;
+    list = r;
+  }
+  release(&kmem.lock);
+  *got = i;
+  return list;
+}
+
+// Push the n pages of list onto magazine m.
+// Caller holds m->lock.
+static void
+kmemputmag(struct kmag *m, struct run *list, int n)
+{
+  struct run *tail;
+
+  m->n += n;
+  for(tail = list; --n > 0; tail = tail->next)
+    ;
+  tail->next = m->freelist;
+  m->freelist = list;
+}
+
+// The buddy lists are empty: take half of the pages
+// cached by some other CPU.
+static struct run*
+kmemsteal(struct kmag *self, int *got)
+{
+  struct kmag *m;
+  struct run *list, *r;
+  int i, n;
+
+  for(m = kmem.cpu; m < &kmem.cpu[NCPU]; m++){
+    if(m == self)
+      continue;
+    acquire(&m->lock);
+    if(m->n == 0){
+      release(&m->lock);
+      continue;
+    }
+    n = (m->n + 1) / 2;
+    list = r = m->freelist;
+    for(i = 1; i < n; i++)
+      r = r->next;
+    m->freelist = r->next;
+    m->n -= n;
+    r->next = 0;
+    release(&m->lock);
+    *got = n;
+    return list;
+  }
+  *got = 0;
+  return 0;
+}
+
+//PAGEBREAK: 21
+// Put page v in this CPU's magazine.
+static void
+kfreepage(char *v)
+{
+  struct run *r, *list;
+  struct kmag *m;
+  int i;
+
+  if(!kmem.use_lock){
+    buddyfree(v, 0);
+    return;
+  }
+
+  r = (struct run*)v;
+  m = mymag();
+  acquire(&m->lock);
+  r->next = m->freelist;
+  m->freelist = r;
+  if(++m->n <= KMAGSIZE){
+    release(&m->lock);
+    return;
+  }
+  // Magazine overflowed: hand a batch back to the buddy lists.
+  list = m->freelist;
+  for(i = 0; i < KBATCH; i++)
+    m->freelist = m->freelist->next;
+  m->n -= KBATCH;
+  release(&m->lock);
+  kmemputlist(list, KBATCH);
+}
+
+// Take a page from this CPU's magazine.
+static char*
+kallocpage(void)
+{
+  struct run *r, *list;
+  struct kmag *m;
+  int n;
+
+  if(!kmem.use_lock)
+    return buddyalloc(0);
+
+  m = mymag();
+  acquire(&m->lock);
+  if((r = m->freelist) != 0){
+    m->freelist = r->next;
+    m->n--;
+    release(&m->lock);
+    return (char*)r;
+  }
+  release(&m->lock);
+
+  // Magazine empty: refill from the buddy lists, or failing
+  // that from another CPU, and keep the rest of the batch.
+  if((list = kmemgetlist(KBATCH, &n)) == 0)
+    list = kmemsteal(m, &n);
+  if(list == 0)
+    return 0;
+  r = list;
+  if(--n > 0){
+    acquire(&m->lock);
+    kmemputmag(m, r->next, n);
+    release(&m->lock);
+  }
+  return (char*)r;
+}
+
+// Allocate 2^order physically contiguous pages, aligned to
+// their size, on behalf of call site pc.
+static char*
+kallocblock(int order, uint pc)
+{
+  char *v;
+
+  if(order == 0)
+    v = kallocpage();
+  else {
+    if(kmem.use_lock)
+      acquire(&kmem.lock);
+    v = buddyalloc(order);
+    if(kmem.use_lock)
+      release(&kmem.lock);
+  }
+  if(v == 0)
+    return 0;
+#ifdef KPOISON
+  kpoisoncheck(v, 1 << order);
+#endif
+  kmemcount(pc, 1, 1 << order);
+  return v;
+}
+
+static void
+kfreeblock(char *v, int order, uint pc)
+{
+  if(order < 0 || order > KMAXORDER || (uint)v % (PGSIZE << order) ||
+     v < end || V2P(v) + (PGSIZE << order) > phystop)
     panic("kfree");
 
+#ifdef KPOISON
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  memset(v, KPOISONBYTE, PGSIZE << order);
+#endif
+  kmemcount(pc, 0, 1 << order);
 
+  if(order == 0){
+    kfreepage(v);
+    return;
+  }
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
+  buddyfree(v, order);
   if(kmem.use_lock)
     release(&kmem.lock);
 }
 
+// Free the page of physical memory pointed at by v,
+// which normally should have been returned by a
+// call to kalloc().
+void
+kfree(char *v)
+{
+  kfreeblock(v, 0, (uint)__builtin_return_address(0));
+}
+
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
 char*
 kalloc(void)
 {
-  struct run *r;
+  return kallocblock(0, (uint)__builtin_return_address(0));
+}
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
-  return (char*)r;
+// Allocate 2^order physically contiguous pages, aligned to
+// their size.  Returns 0 if no block that large is free.
+char*
+kalloc_order(int order)
+{
+  if(order < 0 || order > KMAXORDER)
+    return 0;
+  return kallocblock(order, (uint)__builtin_return_address(0));
+}
+
+// Free a block returned by kalloc_order(order).
+void
+kfree_order(char *v, int order)
+{
+  kfreeblock(v, order, (uint)__builtin_return_address(0));
+}
+
+// Fill in *st with the allocator statistics.
+void
+kmemstat(struct memstat *st)
+{
+  struct kmag *m;
+  int i;
+
+  acquire(&kmem.lock);
+  kmempeak();
+  st->peak = kmem.peak;
+  release(&kmem.lock);
+  st->npages = kmem.npages;
+  st->nfree = kmem.npages - kmeminuse();
+  st->nalloc = st->nfreed = 0;
+  for(i = 0; i < MEMSTAT_NSITE; i++){
+    st->site[i].pc = kmem.sitepc[i];
+    st->site[i].allocs = st->site[i].frees = 0;
+  }
+  for(m = kmem.cpu; m < &kmem.cpu[NCPU]; m++){
+    st->nalloc += m->nalloc;
+    st->nfreed += m->nfreed;
+    for(i = 0; i < MEMSTAT_NSITE; i++){
+      st->site[i].allocs += m->allocs[i];
+      st->site[i].frees += m->frees[i];
+    }
+  }
+  kmemhist(st->hist);
+}
+
+// Copy the number of free blocks of each order into
+// hist[0..KMAXORDER].  Pages cached in the per-CPU
+// magazines are counted as order 0 blocks.
+void
+kmemhist(int *hist)
+{
+  struct kmag *m;
+  int i;
+
+  acquire(&kmem.lock);
+  for(i = 0; i <= KMAXORDER; i++)
+    hist[i] = kmem.nfree[i];
+  release(&kmem.lock);
+  for(m = kmem.cpu; m < &kmem.cpu[NCPU]; m++)
+    hist[0] += m->n;
 }
 
+// Print allocator statistics on the console (see ^P).
+void
+kmemdump(void)
+{
+  struct kmag *m;
+  int hist[KMAXORDER+1];
+  uint spins;
+  int i;
+
+  spins = 0;
+  for(m = kmem.cpu; m < &kmem.cpu[NCPU]; m++)
+    spins += m->lock.contended;
+  cprintf("kmem: global lock contended %d times, per-cpu locks %d times\n",
+          kmem.lock.contended, spins);
+  kmemhist(hist);
+  cprintf("kmem: free blocks by order:");
+  for(i = 0; i <= KMAXORDER; i++)
+    cprintf(" %d", hist[i]);
+  cprintf("\n");
+}
@@ -31,6 +31,7 @@
 #define ICRHI   (0x0310/4)   // Interrupt Command [63:32]
 #define TIMER   (0x0320/4)   // Local Vector Table 0 (TIMER)
   #define X1         0x0000000B   // divide counts by 1
+  #define ONESHOT    0x00000000   // One-shot
   #define PERIODIC   0x00020000   // Periodic
 #define PCINT   (0x0340/4)   // Performance Counter LVT
 #define LINT0   (0x0350/4)   // Local Vector Table 1 (LINT0)
@@ -51,6 +52,86 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Timer calibration.  The LAPIC timer counts at the bus
+// frequency and the TSC at the core frequency, neither of which
+// is known, so both are measured against PIT channel 2, which
+// counts at a fixed PIT_HZ, over CALMS milliseconds at boot.
+#define PIT_HZ   1193182
+#define PIT_CH2  0x42
+#define PIT_CMD  0x43
+#define PIT_GATE 0x61         // bit 0: channel 2 gate; bit 5: its output
+#define CALMS    50           // at most 54ms (65535 PIT counts)
+#define NSSHIFT  24
+
+static uint lapicticr;        // LAPIC timer counts per tick
+uint tscmhz;                  // TSC cycles per microsecond
+static uint nsmult;           // ns = cycles * nsmult >> NSSHIFT
+static uint64 tsc0;           // TSC at calibration, time 0
+
+// Measure the LAPIC timer and the TSC against the PIT.
+static void
+calibrate(void)
+{
+  uint cnt, lcount, cycles;
+  uint64 t;
+
+  // Run the LAPIC timer down from its maximum, without interrupting.
+  lapicw(TDCR, X1);
+  lapicw(TIMER, ONESHOT | MASKED | (T_IRQ0 + IRQ_TIMER));
+
+  // Channel 2, mode 0 (interrupt on terminal count), speaker off.
+  cnt = PIT_HZ / (1000 / CALMS);
+  outb(PIT_GATE, inb(PIT_GATE) & ~0x03);
+  outb(PIT_CMD, 0xB0);
+  outb(PIT_CH2, cnt & 0xFF);
+  outb(PIT_CH2, cnt >> 8);
+
+  // Raising the gate starts the count; the output goes high at 0.
+  lapicw(TICR, 0xFFFFFFFF);
+  t = rdtsc();
+  outb(PIT_GATE, (inb(PIT_GATE) & ~0x02) | 0x01);
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  cycles = rdtsc() - t;
+  lcount = 0xFFFFFFFF - lapic[TCCR];
+  outb(PIT_GATE, inb(PIT_GATE) & ~0x01);
+
+  lapicticr = lcount / HZ * (1000 / CALMS);
+  tscmhz = cycles / (CALMS * 1000);
+  nsmult = divl((uint64)CALMS * 1000000 << NSSHIFT, cycles);
+  tsc0 = t;
+}
+
+// Nanoseconds since the timer was calibrated at boot.
+// Assumes the CPUs' TSCs run in step, as they do on QEMU and
+// on processors with an invariant TSC.
+uint64
+nsecs(void)
+{
+  uint64 d;
+
+  d = rdtsc() - tsc0;
+  return ((uint64)(uint)d * nsmult >> NSSHIFT) +
+         ((uint64)(uint)(d >> 32) * nsmult << (32 - NSSHIFT));
+}
+
+// The conversion nsecs() uses, for user space (see vdso.c).
+void
+tscparams(uint *mult, uint *shift, uint64 *t0)
+{
+  *mult = nsmult;
+  *shift = NSSHIFT;
+  *t0 = tsc0;
+}
+
+// Split ns into seconds and nanoseconds.
+void
+nssplit(uint64 ns, uint *sec, uint *nsec)
+{
+  *sec = divl(ns, 1000000000);
+  *nsec = ns - (uint64)*sec * 1000000000;
+}
+
 void
 lapicinit(void)
 {
@@ -61,12 +142,14 @@ lapicinit(void)
   lapicw(SVR, ENABLE | (T_IRQ0 + IRQ_SPURIOUS));
 
   // The timer repeatedly counts down at bus frequency
-  // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // from lapic[TICR] and then issues an interrupt, HZ times
+  // a second.  The first CPU up measures the bus frequency;
+  // the rest share its result.
+  if(lapicticr == 0)
+    calibrate();
   lapicw(TDCR, X1);
   lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  lapicw(TICR, lapicticr);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -113,11 +196,28 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
+// Send interrupt vector to the CPU with the given APIC ID.
+void
+lapicsendipi(int apicid, int vector)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Spin for a given number of microseconds.
-// On real hardware would want to tune this dynamically.
+// Before calibration, does not wait at all.
 void
 microdelay(int us)
 {
+  uint64 end;
+
+  end = rdtsc() + (uint64)tscmhz * us;
+  while(rdtsc() < end)
+    ;
 }
 
 #define CMOS_PORT    0x70
@@ -0,0 +1,2000 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  if(argc != 3){
+   f:	83 39 03             	cmpl   $0x3,(%ecx)
+{
+  12:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+  15:	74 13                	je     2a <main+0x2a>
+    printf(2, "Usage: ln old new\n");
+  17:	52                   	push   %edx
+  18:	52                   	push   %edx
+  19:	68 f0 0d 00 00       	push   $0xdf0
+  1e:	6a 02                	push   $0x2
+  20:	e8 eb 09 00 00       	call   a10 <printf>
+    exit();
+  25:	e8 7d 05 00 00       	call   5a7 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2a:	50                   	push   %eax
+  2b:	50                   	push   %eax
+  2c:	ff 73 08             	push   0x8(%ebx)
+  2f:	ff 73 04             	push   0x4(%ebx)
+  32:	e8 a8 06 00 00       	call   6df <link>
+  37:	83 c4 10             	add    $0x10,%esp
+  3a:	85 c0                	test   %eax,%eax
+  3c:	78 05                	js     43 <main+0x43>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+  3e:	e8 64 05 00 00       	call   5a7 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  43:	ff 73 08             	push   0x8(%ebx)
+  46:	ff 73 04             	push   0x4(%ebx)
+  49:	68 03 0e 00 00       	push   $0xe03
+  4e:	6a 02                	push   $0x2
+  50:	e8 bb 09 00 00       	call   a10 <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	eb e4                	jmp    3e <main+0x3e>
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 58 04 00 00       	call   5f5 <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 85 04 00 00       	call   677 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 be 04 00 00       	call   6c5 <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 18 04 00 00       	call   629 <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2ac:	5d                   	pop    %ebp
+ 2ad:	c3                   	ret
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 2b0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 2b1:	31 c0                	xor    %eax,%eax
+ 2b3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2b8:	89 e5                	mov    %esp,%ebp
+ 2ba:	56                   	push   %esi
+ 2bb:	53                   	push   %ebx
+ 2bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2bf:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 2c3:	85 c0                	test   %eax,%eax
+ 2c5:	74 32                	je     2f9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 2c7:	83 f8 02             	cmp    $0x2,%eax
+ 2ca:	74 0c                	je     2d8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 2cc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2d1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 2d4:	85 c0                	test   %eax,%eax
+ 2d6:	74 21                	je     2f9 <mutex_lock+0x49>
+ 2d8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 2e0:	83 ec 04             	sub    $0x4,%esp
+ 2e3:	6a 02                	push   $0x2
+ 2e5:	6a 00                	push   $0x0
+ 2e7:	53                   	push   %ebx
+ 2e8:	e8 2a 05 00 00       	call   817 <futex>
+ 2ed:	89 f0                	mov    %esi,%eax
+ 2ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 2f2:	83 c4 10             	add    $0x10,%esp
+ 2f5:	85 c0                	test   %eax,%eax
+ 2f7:	75 e7                	jne    2e0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 2f9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2fc:	5b                   	pop    %ebx
+ 2fd:	5e                   	pop    %esi
+ 2fe:	5d                   	pop    %ebp
+ 2ff:	c3                   	ret
+
+00000300 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 300:	55                   	push   %ebp
+ 301:	31 c0                	xor    %eax,%eax
+ 303:	89 e5                	mov    %esp,%ebp
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 30e:	83 f8 02             	cmp    $0x2,%eax
+ 311:	74 05                	je     318 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+ 315:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 318:	83 ec 04             	sub    $0x4,%esp
+ 31b:	6a 01                	push   $0x1
+ 31d:	6a 01                	push   $0x1
+ 31f:	52                   	push   %edx
+ 320:	e8 f2 04 00 00       	call   817 <futex>
+ 325:	83 c4 10             	add    $0x10,%esp
+}
+ 328:	c9                   	leave
+ 329:	c3                   	ret
+ 32a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000330 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 33c:	5d                   	pop    %ebp
+ 33d:	c3                   	ret
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 340:	55                   	push   %ebp
+ 341:	31 c0                	xor    %eax,%eax
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	57                   	push   %edi
+ 346:	56                   	push   %esi
+ 347:	53                   	push   %ebx
+ 348:	83 ec 0c             	sub    $0xc,%esp
+ 34b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 34e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 351:	8b 3e                	mov    (%esi),%edi
+ 353:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 356:	83 f8 02             	cmp    $0x2,%eax
+ 359:	74 5d                	je     3b8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 35b:	83 ec 04             	sub    $0x4,%esp
+ 35e:	57                   	push   %edi
+ 35f:	6a 00                	push   $0x0
+ 361:	56                   	push   %esi
+ 362:	e8 b0 04 00 00       	call   817 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 367:	31 c0                	xor    %eax,%eax
+ 369:	ba 01 00 00 00       	mov    $0x1,%edx
+ 36e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	74 30                	je     3a9 <cond_wait+0x69>
+  if(c != 2)
+ 379:	83 f8 02             	cmp    $0x2,%eax
+ 37c:	74 0c                	je     38a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 37e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 383:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 386:	85 c0                	test   %eax,%eax
+ 388:	74 1f                	je     3a9 <cond_wait+0x69>
+ 38a:	be 02 00 00 00       	mov    $0x2,%esi
+ 38f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 390:	83 ec 04             	sub    $0x4,%esp
+ 393:	6a 02                	push   $0x2
+ 395:	6a 00                	push   $0x0
+ 397:	53                   	push   %ebx
+ 398:	e8 7a 04 00 00       	call   817 <futex>
+ 39d:	89 f0                	mov    %esi,%eax
+ 39f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3a2:	83 c4 10             	add    $0x10,%esp
+ 3a5:	85 c0                	test   %eax,%eax
+ 3a7:	75 e7                	jne    390 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 3a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ac:	5b                   	pop    %ebx
+ 3ad:	5e                   	pop    %esi
+ 3ae:	5f                   	pop    %edi
+ 3af:	5d                   	pop    %ebp
+ 3b0:	c3                   	ret
+ 3b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3b8:	83 ec 04             	sub    $0x4,%esp
+ 3bb:	6a 01                	push   $0x1
+ 3bd:	6a 01                	push   $0x1
+ 3bf:	53                   	push   %ebx
+ 3c0:	e8 52 04 00 00       	call   817 <futex>
+ 3c5:	83 c4 10             	add    $0x10,%esp
+ 3c8:	eb 91                	jmp    35b <cond_wait+0x1b>
+ 3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003d0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	83 ec 04             	sub    $0x4,%esp
+ 3d7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 3e0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 3e2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3e5:	89 c8                	mov    %ecx,%eax
+ 3e7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 3eb:	39 c1                	cmp    %eax,%ecx
+ 3ed:	75 f1                	jne    3e0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 3ef:	83 ec 04             	sub    $0x4,%esp
+ 3f2:	6a 01                	push   $0x1
+ 3f4:	6a 01                	push   $0x1
+ 3f6:	52                   	push   %edx
+ 3f7:	e8 1b 04 00 00       	call   817 <futex>
+}
+ 3fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3ff:	83 c4 10             	add    $0x10,%esp
+ 402:	c9                   	leave
+ 403:	c3                   	ret
+ 404:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 40f:	90                   	nop
+
+00000410 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	83 ec 04             	sub    $0x4,%esp
+ 417:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 420:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 422:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 425:	89 c8                	mov    %ecx,%eax
+ 427:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 42b:	39 c1                	cmp    %eax,%ecx
+ 42d:	75 f1                	jne    420 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 42f:	83 ec 04             	sub    $0x4,%esp
+ 432:	6a 40                	push   $0x40
+ 434:	6a 01                	push   $0x1
+ 436:	52                   	push   %edx
+ 437:	e8 db 03 00 00       	call   817 <futex>
+}
+ 43c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	c9                   	leave
+ 443:	c3                   	ret
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 450:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 460:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 465:	85 c0                	test   %eax,%eax
+ 467:	74 07                	je     470 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 469:	c3                   	ret
+ 46a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 470:	e9 d2 02 00 00       	jmp    747 <getpid>
+ 475:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	53                   	push   %ebx
+ 486:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 489:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 48b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 491:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 497:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 49c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4a2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4a5:	89 d0                	mov    %edx,%eax
+ 4a7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 4aa:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4b0:	29 d9                	sub    %ebx,%ecx
+ 4b2:	89 c6                	mov    %eax,%esi
+ 4b4:	89 d7                	mov    %edx,%edi
+ 4b6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 4b9:	d3 e6                	shl    %cl,%esi
+ 4bb:	31 c0                	xor    %eax,%eax
+ 4bd:	f6 c1 20             	test   $0x20,%cl
+ 4c0:	0f 45 fe             	cmovne %esi,%edi
+ 4c3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4c6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4c9:	89 d9                	mov    %ebx,%ecx
+ 4cb:	31 db                	xor    %ebx,%ebx
+ 4cd:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4d3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 4d6:	d3 ea                	shr    %cl,%edx
+ 4d8:	f6 c1 20             	test   $0x20,%cl
+ 4db:	0f 45 c2             	cmovne %edx,%eax
+ 4de:	0f 45 d3             	cmovne %ebx,%edx
+ 4e1:	01 f0                	add    %esi,%eax
+ 4e3:	11 fa                	adc    %edi,%edx
+}
+ 4e5:	83 c4 0c             	add    $0xc,%esp
+ 4e8:	5b                   	pop    %ebx
+ 4e9:	5e                   	pop    %esi
+ 4ea:	5f                   	pop    %edi
+ 4eb:	5d                   	pop    %ebp
+ 4ec:	c3                   	ret
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004f0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 4f9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 4fd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 500:	74 0e                	je     510 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 502:	83 c4 1c             	add    $0x1c,%esp
+ 505:	5b                   	pop    %ebx
+ 506:	5e                   	pop    %esi
+ 507:	5f                   	pop    %edi
+ 508:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 509:	e9 a5 03 00 00       	jmp    8b3 <clock_gettime>
+ 50e:	66 90                	xchg   %ax,%ax
+ 510:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 512:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 518:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 51e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 523:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 526:	89 d0                	mov    %edx,%eax
+ 528:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 52b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 531:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 537:	89 c6                	mov    %eax,%esi
+ 539:	89 d7                	mov    %edx,%edi
+ 53b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 53e:	d3 e6                	shl    %cl,%esi
+ 540:	31 c0                	xor    %eax,%eax
+ 542:	f6 c1 20             	test   $0x20,%cl
+ 545:	0f 45 fe             	cmovne %esi,%edi
+ 548:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 54b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 54e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 555:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 55b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 55e:	d3 ea                	shr    %cl,%edx
+ 560:	f6 c1 20             	test   $0x20,%cl
+ 563:	74 04                	je     569 <vclock_gettime+0x79>
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	31 d2                	xor    %edx,%edx
+ 569:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 56b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 570:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 572:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 574:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 576:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 578:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 57e:	29 c1                	sub    %eax,%ecx
+}
+ 580:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 582:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 585:	83 c4 1c             	add    $0x1c,%esp
+ 588:	5b                   	pop    %ebx
+ 589:	5e                   	pop    %esi
+ 58a:	5f                   	pop    %edi
+ 58b:	5d                   	pop    %ebp
+ 58c:	c3                   	ret
+
+0000058d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 58d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 592:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 599:	74 09                	je     5a4 <fork+0x17>
+ 59b:	89 e1                	mov    %esp,%ecx
+ 59d:	ba a6 05 00 00       	mov    $0x5a6,%edx
+ 5a2:	0f 34                	sysenter
+ 5a4:	cd 40                	int    $0x40
+ 5a6:	c3                   	ret
+
+000005a7 <exit>:
+SYSCALL(exit)
+ 5a7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5ac:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5b3:	74 09                	je     5be <exit+0x17>
+ 5b5:	89 e1                	mov    %esp,%ecx
+ 5b7:	ba c0 05 00 00       	mov    $0x5c0,%edx
+ 5bc:	0f 34                	sysenter
+ 5be:	cd 40                	int    $0x40
+ 5c0:	c3                   	ret
+
+000005c1 <wait>:
+SYSCALL(wait)
+ 5c1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5c6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5cd:	74 09                	je     5d8 <wait+0x17>
+ 5cf:	89 e1                	mov    %esp,%ecx
+ 5d1:	ba da 05 00 00       	mov    $0x5da,%edx
+ 5d6:	0f 34                	sysenter
+ 5d8:	cd 40                	int    $0x40
+ 5da:	c3                   	ret
+
+000005db <pipe>:
+SYSCALL(pipe)
+ 5db:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5e0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5e7:	74 09                	je     5f2 <pipe+0x17>
+ 5e9:	89 e1                	mov    %esp,%ecx
+ 5eb:	ba f4 05 00 00       	mov    $0x5f4,%edx
+ 5f0:	0f 34                	sysenter
+ 5f2:	cd 40                	int    $0x40
+ 5f4:	c3                   	ret
+
+000005f5 <read>:
+SYSCALL(read)
+ 5f5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5fa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 601:	74 09                	je     60c <read+0x17>
+ 603:	89 e1                	mov    %esp,%ecx
+ 605:	ba 0e 06 00 00       	mov    $0x60e,%edx
+ 60a:	0f 34                	sysenter
+ 60c:	cd 40                	int    $0x40
+ 60e:	c3                   	ret
+
+0000060f <write>:
+SYSCALL(write)
+ 60f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 614:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 61b:	74 09                	je     626 <write+0x17>
+ 61d:	89 e1                	mov    %esp,%ecx
+ 61f:	ba 28 06 00 00       	mov    $0x628,%edx
+ 624:	0f 34                	sysenter
+ 626:	cd 40                	int    $0x40
+ 628:	c3                   	ret
+
+00000629 <close>:
+SYSCALL(close)
+ 629:	b8 15 00 00 00       	mov    $0x15,%eax
+ 62e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 635:	74 09                	je     640 <close+0x17>
+ 637:	89 e1                	mov    %esp,%ecx
+ 639:	ba 42 06 00 00       	mov    $0x642,%edx
+ 63e:	0f 34                	sysenter
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <kill>:
+SYSCALL(kill)
+ 643:	b8 06 00 00 00       	mov    $0x6,%eax
+ 648:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 64f:	74 09                	je     65a <kill+0x17>
+ 651:	89 e1                	mov    %esp,%ecx
+ 653:	ba 5c 06 00 00       	mov    $0x65c,%edx
+ 658:	0f 34                	sysenter
+ 65a:	cd 40                	int    $0x40
+ 65c:	c3                   	ret
+
+0000065d <exec>:
+SYSCALL(exec)
+ 65d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 662:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 669:	74 09                	je     674 <exec+0x17>
+ 66b:	89 e1                	mov    %esp,%ecx
+ 66d:	ba 76 06 00 00       	mov    $0x676,%edx
+ 672:	0f 34                	sysenter
+ 674:	cd 40                	int    $0x40
+ 676:	c3                   	ret
+
+00000677 <open>:
+SYSCALL(open)
+ 677:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 67c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 683:	74 09                	je     68e <open+0x17>
+ 685:	89 e1                	mov    %esp,%ecx
+ 687:	ba 90 06 00 00       	mov    $0x690,%edx
+ 68c:	0f 34                	sysenter
+ 68e:	cd 40                	int    $0x40
+ 690:	c3                   	ret
+
+00000691 <mknod>:
+SYSCALL(mknod)
+ 691:	b8 11 00 00 00       	mov    $0x11,%eax
+ 696:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 69d:	74 09                	je     6a8 <mknod+0x17>
+ 69f:	89 e1                	mov    %esp,%ecx
+ 6a1:	ba aa 06 00 00       	mov    $0x6aa,%edx
+ 6a6:	0f 34                	sysenter
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <unlink>:
+SYSCALL(unlink)
+ 6ab:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6b7:	74 09                	je     6c2 <unlink+0x17>
+ 6b9:	89 e1                	mov    %esp,%ecx
+ 6bb:	ba c4 06 00 00       	mov    $0x6c4,%edx
+ 6c0:	0f 34                	sysenter
+ 6c2:	cd 40                	int    $0x40
+ 6c4:	c3                   	ret
+
+000006c5 <fstat>:
+SYSCALL(fstat)
+ 6c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6ca:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6d1:	74 09                	je     6dc <fstat+0x17>
+ 6d3:	89 e1                	mov    %esp,%ecx
+ 6d5:	ba de 06 00 00       	mov    $0x6de,%edx
+ 6da:	0f 34                	sysenter
+ 6dc:	cd 40                	int    $0x40
+ 6de:	c3                   	ret
+
+000006df <link>:
+SYSCALL(link)
+ 6df:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6e4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6eb:	74 09                	je     6f6 <link+0x17>
+ 6ed:	89 e1                	mov    %esp,%ecx
+ 6ef:	ba f8 06 00 00       	mov    $0x6f8,%edx
+ 6f4:	0f 34                	sysenter
+ 6f6:	cd 40                	int    $0x40
+ 6f8:	c3                   	ret
+
+000006f9 <mkdir>:
+SYSCALL(mkdir)
+ 6f9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6fe:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 705:	74 09                	je     710 <mkdir+0x17>
+ 707:	89 e1                	mov    %esp,%ecx
+ 709:	ba 12 07 00 00       	mov    $0x712,%edx
+ 70e:	0f 34                	sysenter
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <chdir>:
+SYSCALL(chdir)
+ 713:	b8 09 00 00 00       	mov    $0x9,%eax
+ 718:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 71f:	74 09                	je     72a <chdir+0x17>
+ 721:	89 e1                	mov    %esp,%ecx
+ 723:	ba 2c 07 00 00       	mov    $0x72c,%edx
+ 728:	0f 34                	sysenter
+ 72a:	cd 40                	int    $0x40
+ 72c:	c3                   	ret
+
+0000072d <dup>:
+SYSCALL(dup)
+ 72d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 732:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 739:	74 09                	je     744 <dup+0x17>
+ 73b:	89 e1                	mov    %esp,%ecx
+ 73d:	ba 46 07 00 00       	mov    $0x746,%edx
+ 742:	0f 34                	sysenter
+ 744:	cd 40                	int    $0x40
+ 746:	c3                   	ret
+
+00000747 <getpid>:
+SYSCALL(getpid)
+ 747:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 74c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 753:	74 09                	je     75e <getpid+0x17>
+ 755:	89 e1                	mov    %esp,%ecx
+ 757:	ba 60 07 00 00       	mov    $0x760,%edx
+ 75c:	0f 34                	sysenter
+ 75e:	cd 40                	int    $0x40
+ 760:	c3                   	ret
+
+00000761 <sbrk>:
+SYSCALL(sbrk)
+ 761:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 766:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 76d:	74 09                	je     778 <sbrk+0x17>
+ 76f:	89 e1                	mov    %esp,%ecx
+ 771:	ba 7a 07 00 00       	mov    $0x77a,%edx
+ 776:	0f 34                	sysenter
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <sleep>:
+SYSCALL(sleep)
+ 77b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 780:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 787:	74 09                	je     792 <sleep+0x17>
+ 789:	89 e1                	mov    %esp,%ecx
+ 78b:	ba 94 07 00 00       	mov    $0x794,%edx
+ 790:	0f 34                	sysenter
+ 792:	cd 40                	int    $0x40
+ 794:	c3                   	ret
+
+00000795 <uptime>:
+SYSCALL(uptime)
+ 795:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 79a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a1:	74 09                	je     7ac <uptime+0x17>
+ 7a3:	89 e1                	mov    %esp,%ecx
+ 7a5:	ba ae 07 00 00       	mov    $0x7ae,%edx
+ 7aa:	0f 34                	sysenter
+ 7ac:	cd 40                	int    $0x40
+ 7ae:	c3                   	ret
+
+000007af <mmap>:
+SYSCALL(mmap)
+ 7af:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7b4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7bb:	74 09                	je     7c6 <mmap+0x17>
+ 7bd:	89 e1                	mov    %esp,%ecx
+ 7bf:	ba c8 07 00 00       	mov    $0x7c8,%edx
+ 7c4:	0f 34                	sysenter
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
+
+000007c9 <munmap>:
+SYSCALL(munmap)
+ 7c9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7ce:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d5:	74 09                	je     7e0 <munmap+0x17>
+ 7d7:	89 e1                	mov    %esp,%ecx
+ 7d9:	ba e2 07 00 00       	mov    $0x7e2,%edx
+ 7de:	0f 34                	sysenter
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <clone>:
+SYSCALL(clone)
+ 7e3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7e8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ef:	74 09                	je     7fa <clone+0x17>
+ 7f1:	89 e1                	mov    %esp,%ecx
+ 7f3:	ba fc 07 00 00       	mov    $0x7fc,%edx
+ 7f8:	0f 34                	sysenter
+ 7fa:	cd 40                	int    $0x40
+ 7fc:	c3                   	ret
+
+000007fd <join>:
+SYSCALL(join)
+ 7fd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 802:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 809:	74 09                	je     814 <join+0x17>
+ 80b:	89 e1                	mov    %esp,%ecx
+ 80d:	ba 16 08 00 00       	mov    $0x816,%edx
+ 812:	0f 34                	sysenter
+ 814:	cd 40                	int    $0x40
+ 816:	c3                   	ret
+
+00000817 <futex>:
+SYSCALL(futex)
+ 817:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 81c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 823:	74 09                	je     82e <futex+0x17>
+ 825:	89 e1                	mov    %esp,%ecx
+ 827:	ba 30 08 00 00       	mov    $0x830,%edx
+ 82c:	0f 34                	sysenter
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <memstat>:
+SYSCALL(memstat)
+ 831:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 836:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 83d:	74 09                	je     848 <memstat+0x17>
+ 83f:	89 e1                	mov    %esp,%ecx
+ 841:	ba 4a 08 00 00       	mov    $0x84a,%edx
+ 846:	0f 34                	sysenter
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <nice>:
+SYSCALL(nice)
+ 84b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 850:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 857:	74 09                	je     862 <nice+0x17>
+ 859:	89 e1                	mov    %esp,%ecx
+ 85b:	ba 64 08 00 00       	mov    $0x864,%edx
+ 860:	0f 34                	sysenter
+ 862:	cd 40                	int    $0x40
+ 864:	c3                   	ret
+
+00000865 <setpriority>:
+SYSCALL(setpriority)
+ 865:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 86a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 871:	74 09                	je     87c <setpriority+0x17>
+ 873:	89 e1                	mov    %esp,%ecx
+ 875:	ba 7e 08 00 00       	mov    $0x87e,%edx
+ 87a:	0f 34                	sysenter
+ 87c:	cd 40                	int    $0x40
+ 87e:	c3                   	ret
+
+0000087f <getpinfo>:
+SYSCALL(getpinfo)
+ 87f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 884:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 88b:	74 09                	je     896 <getpinfo+0x17>
+ 88d:	89 e1                	mov    %esp,%ecx
+ 88f:	ba 98 08 00 00       	mov    $0x898,%edx
+ 894:	0f 34                	sysenter
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+00000899 <settickets>:
+SYSCALL(settickets)
+ 899:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 89e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a5:	74 09                	je     8b0 <settickets+0x17>
+ 8a7:	89 e1                	mov    %esp,%ecx
+ 8a9:	ba b2 08 00 00       	mov    $0x8b2,%edx
+ 8ae:	0f 34                	sysenter
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 8b3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8b8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8bf:	74 09                	je     8ca <clock_gettime+0x17>
+ 8c1:	89 e1                	mov    %esp,%ecx
+ 8c3:	ba cc 08 00 00       	mov    $0x8cc,%edx
+ 8c8:	0f 34                	sysenter
+ 8ca:	cd 40                	int    $0x40
+ 8cc:	c3                   	ret
+
+000008cd <batch>:
+SYSCALL(batch)
+ 8cd:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8d9:	74 09                	je     8e4 <batch+0x17>
+ 8db:	89 e1                	mov    %esp,%ecx
+ 8dd:	ba e6 08 00 00       	mov    $0x8e6,%edx
+ 8e2:	0f 34                	sysenter
+ 8e4:	cd 40                	int    $0x40
+ 8e6:	c3                   	ret
+
+000008e7 <aiosetup>:
+SYSCALL(aiosetup)
+ 8e7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f3:	74 09                	je     8fe <aiosetup+0x17>
+ 8f5:	89 e1                	mov    %esp,%ecx
+ 8f7:	ba 00 09 00 00       	mov    $0x900,%edx
+ 8fc:	0f 34                	sysenter
+ 8fe:	cd 40                	int    $0x40
+ 900:	c3                   	ret
+
+00000901 <aioenter>:
+SYSCALL(aioenter)
+ 901:	b8 23 00 00 00       	mov    $0x23,%eax
+ 906:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 90d:	74 09                	je     918 <aioenter+0x17>
+ 90f:	89 e1                	mov    %esp,%ecx
+ 911:	ba 1a 09 00 00       	mov    $0x91a,%edx
+ 916:	0f 34                	sysenter
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <systrace>:
+SYSCALL(systrace)
+ 91b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 920:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 927:	74 09                	je     932 <systrace+0x17>
+ 929:	89 e1                	mov    %esp,%ecx
+ 92b:	ba 34 09 00 00       	mov    $0x934,%edx
+ 930:	0f 34                	sysenter
+ 932:	cd 40                	int    $0x40
+ 934:	c3                   	ret
+
+00000935 <sysstat>:
+SYSCALL(sysstat)
+ 935:	b8 25 00 00 00       	mov    $0x25,%eax
+ 93a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 941:	74 09                	je     94c <sysstat+0x17>
+ 943:	89 e1                	mov    %esp,%ecx
+ 945:	ba 4e 09 00 00       	mov    $0x94e,%edx
+ 94a:	0f 34                	sysenter
+ 94c:	cd 40                	int    $0x40
+ 94e:	c3                   	ret
+
+0000094f <traceread>:
+SYSCALL(traceread)
+ 94f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 954:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 95b:	74 09                	je     966 <traceread+0x17>
+ 95d:	89 e1                	mov    %esp,%ecx
+ 95f:	ba 68 09 00 00       	mov    $0x968,%edx
+ 964:	0f 34                	sysenter
+ 966:	cd 40                	int    $0x40
+ 968:	c3                   	ret
+ 969:	66 90                	xchg   %ax,%ax
+ 96b:	66 90                	xchg   %ax,%ax
+ 96d:	66 90                	xchg   %ax,%ax
+ 96f:	90                   	nop
+
+00000970 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	57                   	push   %edi
+ 974:	56                   	push   %esi
+ 975:	53                   	push   %ebx
+ 976:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 978:	89 d1                	mov    %edx,%ecx
+{
+ 97a:	83 ec 3c             	sub    $0x3c,%esp
+ 97d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 980:	85 d2                	test   %edx,%edx
+ 982:	0f 89 80 00 00 00    	jns    a08 <printint+0x98>
+ 988:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 98c:	74 7a                	je     a08 <printint+0x98>
+    x = -xx;
+ 98e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 990:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 995:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 998:	31 f6                	xor    %esi,%esi
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9a0:	89 c8                	mov    %ecx,%eax
+ 9a2:	31 d2                	xor    %edx,%edx
+ 9a4:	89 f7                	mov    %esi,%edi
+ 9a6:	f7 f3                	div    %ebx
+ 9a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9ab:	0f b6 92 78 0e 00 00 	movzbl 0xe78(%edx),%edx
+ 9b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9b6:	89 ca                	mov    %ecx,%edx
+ 9b8:	89 c1                	mov    %eax,%ecx
+ 9ba:	39 da                	cmp    %ebx,%edx
+ 9bc:	73 e2                	jae    9a0 <printint+0x30>
+  if(neg)
+ 9be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9c1:	85 c0                	test   %eax,%eax
+ 9c3:	74 07                	je     9cc <printint+0x5c>
+    buf[i++] = '-';
+ 9c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9ca:	89 f7                	mov    %esi,%edi
+ 9cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9d2:	01 df                	add    %ebx,%edi
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9db:	83 ec 04             	sub    $0x4,%esp
+ 9de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9e4:	6a 01                	push   $0x1
+ 9e6:	50                   	push   %eax
+ 9e7:	56                   	push   %esi
+ 9e8:	e8 22 fc ff ff       	call   60f <write>
+  while(--i >= 0)
+ 9ed:	89 f8                	mov    %edi,%eax
+ 9ef:	83 c4 10             	add    $0x10,%esp
+ 9f2:	83 ef 01             	sub    $0x1,%edi
+ 9f5:	39 d8                	cmp    %ebx,%eax
+ 9f7:	75 df                	jne    9d8 <printint+0x68>
+}
+ 9f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9fc:	5b                   	pop    %ebx
+ 9fd:	5e                   	pop    %esi
+ 9fe:	5f                   	pop    %edi
+ 9ff:	5d                   	pop    %ebp
+ a00:	c3                   	ret
+ a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a08:	31 c0                	xor    %eax,%eax
+ a0a:	eb 89                	jmp    995 <printint+0x25>
+ a0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a10 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a10:	55                   	push   %ebp
+ a11:	89 e5                	mov    %esp,%ebp
+ a13:	57                   	push   %edi
+ a14:	56                   	push   %esi
+ a15:	53                   	push   %ebx
+ a16:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a19:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a1f:	0f b6 1e             	movzbl (%esi),%ebx
+ a22:	83 c6 01             	add    $0x1,%esi
+ a25:	84 db                	test   %bl,%bl
+ a27:	74 67                	je     a90 <printf+0x80>
+ a29:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a2c:	31 d2                	xor    %edx,%edx
+ a2e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a31:	eb 34                	jmp    a67 <printf+0x57>
+ a33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a37:	90                   	nop
+ a38:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a3b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a40:	83 f8 25             	cmp    $0x25,%eax
+ a43:	74 18                	je     a5d <printf+0x4d>
+  write(fd, &c, 1);
+ a45:	83 ec 04             	sub    $0x4,%esp
+ a48:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a4b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a4e:	6a 01                	push   $0x1
+ a50:	50                   	push   %eax
+ a51:	57                   	push   %edi
+ a52:	e8 b8 fb ff ff       	call   60f <write>
+ a57:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a5a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a5d:	0f b6 1e             	movzbl (%esi),%ebx
+ a60:	83 c6 01             	add    $0x1,%esi
+ a63:	84 db                	test   %bl,%bl
+ a65:	74 29                	je     a90 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a67:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a6a:	85 d2                	test   %edx,%edx
+ a6c:	74 ca                	je     a38 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a6e:	83 fa 25             	cmp    $0x25,%edx
+ a71:	75 ea                	jne    a5d <printf+0x4d>
+      if(c == 'd'){
+ a73:	83 f8 25             	cmp    $0x25,%eax
+ a76:	0f 84 24 01 00 00    	je     ba0 <printf+0x190>
+ a7c:	83 e8 63             	sub    $0x63,%eax
+ a7f:	83 f8 15             	cmp    $0x15,%eax
+ a82:	77 1c                	ja     aa0 <printf+0x90>
+ a84:	ff 24 85 20 0e 00 00 	jmp    *0xe20(,%eax,4)
+ a8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a8f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a93:	5b                   	pop    %ebx
+ a94:	5e                   	pop    %esi
+ a95:	5f                   	pop    %edi
+ a96:	5d                   	pop    %ebp
+ a97:	c3                   	ret
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+  write(fd, &c, 1);
+ aa0:	83 ec 04             	sub    $0x4,%esp
+ aa3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ aa6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aaa:	6a 01                	push   $0x1
+ aac:	52                   	push   %edx
+ aad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ab0:	57                   	push   %edi
+ ab1:	e8 59 fb ff ff       	call   60f <write>
+ ab6:	83 c4 0c             	add    $0xc,%esp
+ ab9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ abc:	6a 01                	push   $0x1
+ abe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ac1:	52                   	push   %edx
+ ac2:	57                   	push   %edi
+ ac3:	e8 47 fb ff ff       	call   60f <write>
+        putc(fd, c);
+ ac8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ acb:	31 d2                	xor    %edx,%edx
+ acd:	eb 8e                	jmp    a5d <printf+0x4d>
+ acf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ad0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ adb:	8b 13                	mov    (%ebx),%edx
+ add:	6a 00                	push   $0x0
+ adf:	89 f8                	mov    %edi,%eax
+        ap++;
+ ae1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ae4:	e8 87 fe ff ff       	call   970 <printint>
+        ap++;
+ ae9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aef:	31 d2                	xor    %edx,%edx
+ af1:	e9 67 ff ff ff       	jmp    a5d <printf+0x4d>
+ af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ afd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b00:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b03:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b05:	83 c0 04             	add    $0x4,%eax
+ b08:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b0b:	85 db                	test   %ebx,%ebx
+ b0d:	0f 84 9d 00 00 00    	je     bb0 <printf+0x1a0>
+        while(*s != 0){
+ b13:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b16:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b18:	84 c0                	test   %al,%al
+ b1a:	0f 84 3d ff ff ff    	je     a5d <printf+0x4d>
+ b20:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b23:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b26:	89 de                	mov    %ebx,%esi
+ b28:	89 d3                	mov    %edx,%ebx
+ b2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b36:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b39:	6a 01                	push   $0x1
+ b3b:	53                   	push   %ebx
+ b3c:	57                   	push   %edi
+ b3d:	e8 cd fa ff ff       	call   60f <write>
+        while(*s != 0){
+ b42:	0f b6 06             	movzbl (%esi),%eax
+ b45:	83 c4 10             	add    $0x10,%esp
+ b48:	84 c0                	test   %al,%al
+ b4a:	75 e4                	jne    b30 <printf+0x120>
+      state = 0;
+ b4c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b4f:	31 d2                	xor    %edx,%edx
+ b51:	e9 07 ff ff ff       	jmp    a5d <printf+0x4d>
+ b56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b6b:	8b 13                	mov    (%ebx),%edx
+ b6d:	6a 01                	push   $0x1
+ b6f:	e9 6b ff ff ff       	jmp    adf <printf+0xcf>
+ b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b78:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b7b:	83 ec 04             	sub    $0x4,%esp
+ b7e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b81:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b83:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b86:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b89:	6a 01                	push   $0x1
+ b8b:	52                   	push   %edx
+ b8c:	57                   	push   %edi
+ b8d:	e8 7d fa ff ff       	call   60f <write>
+        ap++;
+ b92:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b95:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b98:	31 d2                	xor    %edx,%edx
+ b9a:	e9 be fe ff ff       	jmp    a5d <printf+0x4d>
+ b9f:	90                   	nop
+  write(fd, &c, 1);
+ ba0:	83 ec 04             	sub    $0x4,%esp
+ ba3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ba6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ba9:	6a 01                	push   $0x1
+ bab:	e9 11 ff ff ff       	jmp    ac1 <printf+0xb1>
+ bb0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bb5:	bb 17 0e 00 00       	mov    $0xe17,%ebx
+ bba:	e9 61 ff ff ff       	jmp    b20 <printf+0x110>
+ bbf:	90                   	nop
+
+00000bc0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ bc0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bc1:	a1 08 13 00 00       	mov    0x1308,%eax
+{
+ bc6:	89 e5                	mov    %esp,%ebp
+ bc8:	57                   	push   %edi
+ bc9:	56                   	push   %esi
+ bca:	53                   	push   %ebx
+ bcb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bd8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bda:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bdc:	39 ca                	cmp    %ecx,%edx
+ bde:	73 30                	jae    c10 <free+0x50>
+ be0:	39 c1                	cmp    %eax,%ecx
+ be2:	72 04                	jb     be8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ be4:	39 c2                	cmp    %eax,%edx
+ be6:	72 f0                	jb     bd8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ be8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ beb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bee:	39 f8                	cmp    %edi,%eax
+ bf0:	74 2e                	je     c20 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bf2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bf5:	8b 42 04             	mov    0x4(%edx),%eax
+ bf8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bfb:	39 f1                	cmp    %esi,%ecx
+ bfd:	74 38                	je     c37 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c01:	5b                   	pop    %ebx
+  freep = p;
+ c02:	89 15 08 13 00 00    	mov    %edx,0x1308
+}
+ c08:	5e                   	pop    %esi
+ c09:	5f                   	pop    %edi
+ c0a:	5d                   	pop    %ebp
+ c0b:	c3                   	ret
+ c0c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c10:	39 c1                	cmp    %eax,%ecx
+ c12:	72 d0                	jb     be4 <free+0x24>
+ c14:	eb c2                	jmp    bd8 <free+0x18>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c20:	03 70 04             	add    0x4(%eax),%esi
+ c23:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c26:	8b 02                	mov    (%edx),%eax
+ c28:	8b 00                	mov    (%eax),%eax
+ c2a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c2d:	8b 42 04             	mov    0x4(%edx),%eax
+ c30:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c33:	39 f1                	cmp    %esi,%ecx
+ c35:	75 c8                	jne    bff <free+0x3f>
+    p->s.size += bp->s.size;
+ c37:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c3a:	89 15 08 13 00 00    	mov    %edx,0x1308
+    p->s.size += bp->s.size;
+ c40:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c43:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c46:	89 0a                	mov    %ecx,(%edx)
+}
+ c48:	5b                   	pop    %ebx
+ c49:	5e                   	pop    %esi
+ c4a:	5f                   	pop    %edi
+ c4b:	5d                   	pop    %ebp
+ c4c:	c3                   	ret
+ c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c50 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	57                   	push   %edi
+ c54:	56                   	push   %esi
+ c55:	53                   	push   %ebx
+ c56:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c59:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c5c:	8b 15 08 13 00 00    	mov    0x1308,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c62:	8d 78 07             	lea    0x7(%eax),%edi
+ c65:	c1 ef 03             	shr    $0x3,%edi
+ c68:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c6b:	85 d2                	test   %edx,%edx
+ c6d:	0f 84 8d 00 00 00    	je     d00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c73:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c75:	8b 48 04             	mov    0x4(%eax),%ecx
+ c78:	39 f9                	cmp    %edi,%ecx
+ c7a:	73 64                	jae    ce0 <malloc+0x90>
+  if(nu < 4096)
+ c7c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c81:	39 df                	cmp    %ebx,%edi
+ c83:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c86:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c8d:	eb 0a                	jmp    c99 <malloc+0x49>
+ c8f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c90:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c92:	8b 48 04             	mov    0x4(%eax),%ecx
+ c95:	39 f9                	cmp    %edi,%ecx
+ c97:	73 47                	jae    ce0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c99:	89 c2                	mov    %eax,%edx
+ c9b:	39 05 08 13 00 00    	cmp    %eax,0x1308
+ ca1:	75 ed                	jne    c90 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ca3:	83 ec 0c             	sub    $0xc,%esp
+ ca6:	56                   	push   %esi
+ ca7:	e8 b5 fa ff ff       	call   761 <sbrk>
+  if(p == (char*)-1)
+ cac:	83 c4 10             	add    $0x10,%esp
+ caf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cb2:	74 1c                	je     cd0 <malloc+0x80>
+  hp->s.size = nu;
+ cb4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cb7:	83 ec 0c             	sub    $0xc,%esp
+ cba:	83 c0 08             	add    $0x8,%eax
+ cbd:	50                   	push   %eax
+ cbe:	e8 fd fe ff ff       	call   bc0 <free>
+  return freep;
+ cc3:	8b 15 08 13 00 00    	mov    0x1308,%edx
+      if((p = morecore(nunits)) == 0)
+ cc9:	83 c4 10             	add    $0x10,%esp
+ ccc:	85 d2                	test   %edx,%edx
+ cce:	75 c0                	jne    c90 <malloc+0x40>
+        return 0;
+  }
+}
+ cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cd3:	31 c0                	xor    %eax,%eax
+}
+ cd5:	5b                   	pop    %ebx
+ cd6:	5e                   	pop    %esi
+ cd7:	5f                   	pop    %edi
+ cd8:	5d                   	pop    %ebp
+ cd9:	c3                   	ret
+ cda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ce0:	39 cf                	cmp    %ecx,%edi
+ ce2:	74 4c                	je     d30 <malloc+0xe0>
+        p->s.size -= nunits;
+ ce4:	29 f9                	sub    %edi,%ecx
+ ce6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ce9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cef:	89 15 08 13 00 00    	mov    %edx,0x1308
+}
+ cf5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cf8:	83 c0 08             	add    $0x8,%eax
+}
+ cfb:	5b                   	pop    %ebx
+ cfc:	5e                   	pop    %esi
+ cfd:	5f                   	pop    %edi
+ cfe:	5d                   	pop    %ebp
+ cff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d00:	c7 05 08 13 00 00 0c 	movl   $0x130c,0x1308
+ d07:	13 00 00 
+    base.s.size = 0;
+ d0a:	b8 0c 13 00 00       	mov    $0x130c,%eax
+    base.s.ptr = freep = prevp = &base;
+ d0f:	c7 05 0c 13 00 00 0c 	movl   $0x130c,0x130c
+ d16:	13 00 00 
+    base.s.size = 0;
+ d19:	c7 05 10 13 00 00 00 	movl   $0x0,0x1310
+ d20:	00 00 00 
+    if(p->s.size >= nunits){
+ d23:	e9 54 ff ff ff       	jmp    c7c <malloc+0x2c>
+ d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d30:	8b 08                	mov    (%eax),%ecx
+ d32:	89 0a                	mov    %ecx,(%edx)
+ d34:	eb b9                	jmp    cef <malloc+0x9f>
+ d36:	66 90                	xchg   %ax,%ax
+ d38:	66 90                	xchg   %ax,%ax
+ d3a:	66 90                	xchg   %ax,%ax
+ d3c:	66 90                	xchg   %ax,%ax
+ d3e:	66 90                	xchg   %ax,%ax
+
+00000d40 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	53                   	push   %ebx
+ d44:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ d47:	68 00 20 00 00       	push   $0x2000
+ d4c:	e8 ff fe ff ff       	call   c50 <malloc>
+ d51:	83 c4 10             	add    $0x10,%esp
+ d54:	85 c0                	test   %eax,%eax
+ d56:	74 47                	je     d9f <thread_create+0x5f>
+ d58:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d5a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ d60:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d63:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ d68:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ d6b:	ff 75 0c             	push   0xc(%ebp)
+ d6e:	50                   	push   %eax
+ d6f:	ff 75 08             	push   0x8(%ebp)
+ d72:	e8 6c fa ff ff       	call   7e3 <clone>
+ d77:	83 c4 10             	add    $0x10,%esp
+ d7a:	85 c0                	test   %eax,%eax
+ d7c:	78 0a                	js     d88 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ d7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d81:	c9                   	leave
+ d82:	c3                   	ret
+ d83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d87:	90                   	nop
+    free(mem);
+ d88:	83 ec 0c             	sub    $0xc,%esp
+ d8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d8e:	53                   	push   %ebx
+ d8f:	e8 2c fe ff ff       	call   bc0 <free>
+ d94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ d9a:	83 c4 10             	add    $0x10,%esp
+}
+ d9d:	c9                   	leave
+ d9e:	c3                   	ret
+    return -1;
+ d9f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ da4:	eb d8                	jmp    d7e <thread_create+0x3e>
+ da6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000db0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ db0:	55                   	push   %ebp
+ db1:	89 e5                	mov    %esp,%ebp
+ db3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ db4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ db7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ dba:	50                   	push   %eax
+ dbb:	e8 3d fa ff ff       	call   7fd <join>
+ dc0:	83 c4 10             	add    $0x10,%esp
+ dc3:	85 c0                	test   %eax,%eax
+ dc5:	78 21                	js     de8 <thread_join+0x38>
+ dc7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ dc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dcc:	83 ec 0c             	sub    $0xc,%esp
+ dcf:	ff 70 fc             	push   -0x4(%eax)
+ dd2:	e8 e9 fd ff ff       	call   bc0 <free>
+  return pid;
+ dd7:	83 c4 10             	add    $0x10,%esp
+}
+ dda:	89 d8                	mov    %ebx,%eax
+ ddc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ddf:	c9                   	leave
+ de0:	c3                   	ret
+ de1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ de8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ ded:	eb eb                	jmp    dda <thread_join+0x2a>
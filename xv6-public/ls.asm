@@ -0,0 +1,2285 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+      15:	51                   	push   %ecx
+      16:	83 ec 08             	sub    $0x8,%esp
+      19:	8b 31                	mov    (%ecx),%esi
+      1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      1e:	83 fe 01             	cmp    $0x1,%esi
+      21:	7e 1f                	jle    42 <main+0x42>
+      23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+      28:	83 ec 0c             	sub    $0xc,%esp
+      2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+      2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+      31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+      36:	83 c4 10             	add    $0x10,%esp
+      39:	39 de                	cmp    %ebx,%esi
+      3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+      3d:	e8 45 08 00 00       	call   887 <exit>
+    ls(".");
+      42:	83 ec 0c             	sub    $0xc,%esp
+      45:	68 18 11 00 00       	push   $0x1118
+      4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+      4f:	e8 33 08 00 00       	call   887 <exit>
+      54:	66 90                	xchg   %ax,%ax
+      56:	66 90                	xchg   %ax,%ax
+      58:	66 90                	xchg   %ax,%ax
+      5a:	66 90                	xchg   %ax,%ax
+      5c:	66 90                	xchg   %ax,%ax
+      5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+      60:	55                   	push   %ebp
+      61:	89 e5                	mov    %esp,%ebp
+      63:	56                   	push   %esi
+      64:	53                   	push   %ebx
+      65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+      68:	83 ec 0c             	sub    $0xc,%esp
+      6b:	56                   	push   %esi
+      6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+      71:	83 c4 10             	add    $0x10,%esp
+      74:	01 f0                	add    %esi,%eax
+      76:	89 c3                	mov    %eax,%ebx
+      78:	73 0f                	jae    89 <fmtname+0x29>
+      7a:	eb 12                	jmp    8e <fmtname+0x2e>
+      7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+      83:	39 f0                	cmp    %esi,%eax
+      85:	72 0a                	jb     91 <fmtname+0x31>
+      87:	89 c3                	mov    %eax,%ebx
+      89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+      8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+      8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+      91:	83 ec 0c             	sub    $0xc,%esp
+      94:	53                   	push   %ebx
+      95:	e8 36 03 00 00       	call   3d0 <strlen>
+      9a:	83 c4 10             	add    $0x10,%esp
+      9d:	83 f8 0d             	cmp    $0xd,%eax
+      a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+      a2:	83 ec 0c             	sub    $0xc,%esp
+      a5:	53                   	push   %ebx
+      a6:	e8 25 03 00 00       	call   3d0 <strlen>
+      ab:	83 c4 0c             	add    $0xc,%esp
+      ae:	50                   	push   %eax
+      af:	53                   	push   %ebx
+      b0:	68 90 16 00 00       	push   $0x1690
+      b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ba:	89 1c 24             	mov    %ebx,(%esp)
+      bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+      c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+      c5:	bb 90 16 00 00       	mov    $0x1690,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      ca:	89 c6                	mov    %eax,%esi
+      cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+      d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+      d6:	83 c4 0c             	add    $0xc,%esp
+      d9:	29 f2                	sub    %esi,%edx
+      db:	05 90 16 00 00       	add    $0x1690,%eax
+      e0:	52                   	push   %edx
+      e1:	6a 20                	push   $0x20
+      e3:	50                   	push   %eax
+      e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+      e9:	83 c4 10             	add    $0x10,%esp
+}
+      ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      ef:	89 d8                	mov    %ebx,%eax
+      f1:	5b                   	pop    %ebx
+      f2:	5e                   	pop    %esi
+      f3:	5d                   	pop    %ebp
+      f4:	c3                   	ret
+      f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+     10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+     10f:	6a 00                	push   $0x0
+     111:	57                   	push   %edi
+     112:	e8 40 08 00 00       	call   957 <open>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+     122:	83 ec 08             	sub    $0x8,%esp
+     125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+     12b:	89 c3                	mov    %eax,%ebx
+     12d:	56                   	push   %esi
+     12e:	50                   	push   %eax
+     12f:	e8 71 08 00 00       	call   9a5 <fstat>
+     134:	83 c4 10             	add    $0x10,%esp
+     137:	85 c0                	test   %eax,%eax
+     139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+     13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+     146:	66 83 f8 01          	cmp    $0x1,%ax
+     14a:	74 64                	je     1b0 <ls+0xb0>
+     14c:	66 83 f8 02          	cmp    $0x2,%ax
+     150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	53                   	push   %ebx
+     156:	e8 ae 07 00 00       	call   909 <close>
+     15b:	83 c4 10             	add    $0x10,%esp
+}
+     15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     161:	5b                   	pop    %ebx
+     162:	5e                   	pop    %esi
+     163:	5f                   	pop    %edi
+     164:	5d                   	pop    %ebp
+     165:	c3                   	ret
+     166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+     170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+     176:	83 ec 0c             	sub    $0xc,%esp
+     179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+     17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+     185:	57                   	push   %edi
+     186:	e8 d5 fe ff ff       	call   60 <fmtname>
+     18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+     191:	59                   	pop    %ecx
+     192:	5f                   	pop    %edi
+     193:	52                   	push   %edx
+     194:	56                   	push   %esi
+     195:	6a 02                	push   $0x2
+     197:	50                   	push   %eax
+     198:	68 f8 10 00 00       	push   $0x10f8
+     19d:	6a 01                	push   $0x1
+     19f:	e8 4c 0b 00 00       	call   cf0 <printf>
+    break;
+     1a4:	83 c4 20             	add    $0x20,%esp
+     1a7:	eb a9                	jmp    152 <ls+0x52>
+     1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+     1b0:	83 ec 0c             	sub    $0xc,%esp
+     1b3:	57                   	push   %edi
+     1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+     1b9:	83 c4 10             	add    $0x10,%esp
+     1bc:	83 c0 10             	add    $0x10,%eax
+     1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+     1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+     1ca:	83 ec 08             	sub    $0x8,%esp
+     1cd:	57                   	push   %edi
+     1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+     1d4:	57                   	push   %edi
+     1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+     1da:	89 3c 24             	mov    %edi,(%esp)
+     1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+     1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+     1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+     1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+     1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+     1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+     1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     200:	83 ec 04             	sub    $0x4,%esp
+     203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     209:	6a 10                	push   $0x10
+     20b:	50                   	push   %eax
+     20c:	53                   	push   %ebx
+     20d:	e8 c3 06 00 00       	call   8d5 <read>
+     212:	83 c4 10             	add    $0x10,%esp
+     215:	83 f8 10             	cmp    $0x10,%eax
+     218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+     21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+     225:	00 
+     226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+     228:	83 ec 04             	sub    $0x4,%esp
+     22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+     231:	6a 0e                	push   $0xe
+     233:	50                   	push   %eax
+     234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+     23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+     23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+     245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+     249:	58                   	pop    %eax
+     24a:	5a                   	pop    %edx
+     24b:	56                   	push   %esi
+     24c:	57                   	push   %edi
+     24d:	e8 6e 02 00 00       	call   4c0 <stat>
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	85 c0                	test   %eax,%eax
+     257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+     25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+     263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+     269:	83 ec 0c             	sub    $0xc,%esp
+     26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+     273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+     279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+     27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+     285:	57                   	push   %edi
+     286:	e8 d5 fd ff ff       	call   60 <fmtname>
+     28b:	5a                   	pop    %edx
+     28c:	59                   	pop    %ecx
+     28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+     293:	51                   	push   %ecx
+     294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+     29a:	52                   	push   %edx
+     29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     2a1:	50                   	push   %eax
+     2a2:	68 f8 10 00 00       	push   $0x10f8
+     2a7:	6a 01                	push   $0x1
+     2a9:	e8 42 0a 00 00       	call   cf0 <printf>
+     2ae:	83 c4 20             	add    $0x20,%esp
+     2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+     2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+     2c0:	83 ec 04             	sub    $0x4,%esp
+     2c3:	57                   	push   %edi
+     2c4:	68 d0 10 00 00       	push   $0x10d0
+     2c9:	6a 02                	push   $0x2
+     2cb:	e8 20 0a 00 00       	call   cf0 <printf>
+    return;
+     2d0:	83 c4 10             	add    $0x10,%esp
+}
+     2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2d6:	5b                   	pop    %ebx
+     2d7:	5e                   	pop    %esi
+     2d8:	5f                   	pop    %edi
+     2d9:	5d                   	pop    %ebp
+     2da:	c3                   	ret
+     2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	68 05 11 00 00       	push   $0x1105
+     2e8:	6a 01                	push   $0x1
+     2ea:	e8 01 0a 00 00       	call   cf0 <printf>
+      break;
+     2ef:	83 c4 10             	add    $0x10,%esp
+     2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+     2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+     300:	83 ec 04             	sub    $0x4,%esp
+     303:	57                   	push   %edi
+     304:	68 e4 10 00 00       	push   $0x10e4
+     309:	6a 02                	push   $0x2
+     30b:	e8 e0 09 00 00       	call   cf0 <printf>
+    close(fd);
+     310:	89 1c 24             	mov    %ebx,(%esp)
+     313:	e8 f1 05 00 00       	call   909 <close>
+    return;
+     318:	83 c4 10             	add    $0x10,%esp
+}
+     31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5f                   	pop    %edi
+     321:	5d                   	pop    %ebp
+     322:	c3                   	ret
+     323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+     328:	83 ec 04             	sub    $0x4,%esp
+     32b:	57                   	push   %edi
+     32c:	68 e4 10 00 00       	push   $0x10e4
+     331:	6a 01                	push   $0x1
+     333:	e8 b8 09 00 00       	call   cf0 <printf>
+        continue;
+     338:	83 c4 10             	add    $0x10,%esp
+     33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     341:	31 c0                	xor    %eax,%eax
+{
+     343:	89 e5                	mov    %esp,%ebp
+     345:	53                   	push   %ebx
+     346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     357:	83 c0 01             	add    $0x1,%eax
+     35a:	84 d2                	test   %dl,%dl
+     35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+     35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     361:	89 c8                	mov    %ecx,%eax
+     363:	c9                   	leave
+     364:	c3                   	ret
+     365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	8b 55 08             	mov    0x8(%ebp),%edx
+     377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     37a:	0f b6 02             	movzbl (%edx),%eax
+     37d:	84 c0                	test   %al,%al
+     37f:	75 17                	jne    398 <strcmp+0x28>
+     381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+     383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     387:	90                   	nop
+     388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     38c:	83 c2 01             	add    $0x1,%edx
+     38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     392:	84 c0                	test   %al,%al
+     394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+     396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     398:	0f b6 19             	movzbl (%ecx),%ebx
+     39b:	38 c3                	cmp    %al,%bl
+     39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     39f:	29 d8                	sub    %ebx,%eax
+}
+     3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a4:	c9                   	leave
+     3a5:	c3                   	ret
+     3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     3b4:	31 c0                	xor    %eax,%eax
+     3b6:	29 d8                	sub    %ebx,%eax
+}
+     3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3bb:	c9                   	leave
+     3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     3bd:	0f b6 19             	movzbl (%ecx),%ebx
+     3c0:	31 c0                	xor    %eax,%eax
+     3c2:	eb db                	jmp    39f <strcmp+0x2f>
+     3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     3d0:	55                   	push   %ebp
+     3d1:	89 e5                	mov    %esp,%ebp
+     3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+     3d9:	74 15                	je     3f0 <strlen+0x20>
+     3db:	31 c0                	xor    %eax,%eax
+     3dd:	8d 76 00             	lea    0x0(%esi),%esi
+     3e0:	83 c0 01             	add    $0x1,%eax
+     3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     3e7:	89 c1                	mov    %eax,%ecx
+     3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+     3eb:	89 c8                	mov    %ecx,%eax
+     3ed:	5d                   	pop    %ebp
+     3ee:	c3                   	ret
+     3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     3f0:	31 c9                	xor    %ecx,%ecx
+}
+     3f2:	5d                   	pop    %ebp
+     3f3:	89 c8                	mov    %ecx,%eax
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	57                   	push   %edi
+     404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     40d:	89 d7                	mov    %edx,%edi
+     40f:	fc                   	cld
+     410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     415:	89 d0                	mov    %edx,%eax
+     417:	c9                   	leave
+     418:	c3                   	ret
+     419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	8b 45 08             	mov    0x8(%ebp),%eax
+     426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     42a:	0f b6 10             	movzbl (%eax),%edx
+     42d:	84 d2                	test   %dl,%dl
+     42f:	75 12                	jne    443 <strchr+0x23>
+     431:	eb 1d                	jmp    450 <strchr+0x30>
+     433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     437:	90                   	nop
+     438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     43c:	83 c0 01             	add    $0x1,%eax
+     43f:	84 d2                	test   %dl,%dl
+     441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+     443:	38 d1                	cmp    %dl,%cl
+     445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     447:	5d                   	pop    %ebp
+     448:	c3                   	ret
+     449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     450:	31 c0                	xor    %eax,%eax
+}
+     452:	5d                   	pop    %ebp
+     453:	c3                   	ret
+     454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     469:	31 db                	xor    %ebx,%ebx
+{
+     46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+     470:	83 ec 04             	sub    $0x4,%esp
+     473:	6a 01                	push   $0x1
+     475:	56                   	push   %esi
+     476:	6a 00                	push   $0x0
+     478:	e8 58 04 00 00       	call   8d5 <read>
+    if(cc < 1)
+     47d:	83 c4 10             	add    $0x10,%esp
+     480:	85 c0                	test   %eax,%eax
+     482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     488:	8b 55 08             	mov    0x8(%ebp),%edx
+     48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     48f:	3c 0a                	cmp    $0xa,%al
+     491:	74 10                	je     4a3 <gets+0x43>
+     493:	3c 0d                	cmp    $0xd,%al
+     495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     497:	89 df                	mov    %ebx,%edi
+     499:	83 c3 01             	add    $0x1,%ebx
+     49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     49f:	7c cf                	jl     470 <gets+0x10>
+     4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+     4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ad:	5b                   	pop    %ebx
+     4ae:	5e                   	pop    %esi
+     4af:	5f                   	pop    %edi
+     4b0:	5d                   	pop    %ebp
+     4b1:	c3                   	ret
+     4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	56                   	push   %esi
+     4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     4c5:	83 ec 08             	sub    $0x8,%esp
+     4c8:	6a 00                	push   $0x0
+     4ca:	ff 75 08             	push   0x8(%ebp)
+     4cd:	e8 85 04 00 00       	call   957 <open>
+  if(fd < 0)
+     4d2:	83 c4 10             	add    $0x10,%esp
+     4d5:	85 c0                	test   %eax,%eax
+     4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     4d9:	83 ec 08             	sub    $0x8,%esp
+     4dc:	ff 75 0c             	push   0xc(%ebp)
+     4df:	89 c3                	mov    %eax,%ebx
+     4e1:	50                   	push   %eax
+     4e2:	e8 be 04 00 00       	call   9a5 <fstat>
+  close(fd);
+     4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+     4ec:	e8 18 04 00 00       	call   909 <close>
+  return r;
+     4f1:	83 c4 10             	add    $0x10,%esp
+}
+     4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4f7:	89 f0                	mov    %esi,%eax
+     4f9:	5b                   	pop    %ebx
+     4fa:	5e                   	pop    %esi
+     4fb:	5d                   	pop    %ebp
+     4fc:	c3                   	ret
+     4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     505:	eb ed                	jmp    4f4 <stat+0x34>
+     507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     517:	0f be 02             	movsbl (%edx),%eax
+     51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     525:	77 1e                	ja     545 <atoi+0x35>
+     527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     530:	83 c2 01             	add    $0x1,%edx
+     533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     53a:	0f be 02             	movsbl (%edx),%eax
+     53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     540:	80 fb 09             	cmp    $0x9,%bl
+     543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+     545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     548:	89 c8                	mov    %ecx,%eax
+     54a:	c9                   	leave
+     54b:	c3                   	ret
+     54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     550:	55                   	push   %ebp
+     551:	89 e5                	mov    %esp,%ebp
+     553:	57                   	push   %edi
+     554:	56                   	push   %esi
+     555:	8b 45 10             	mov    0x10(%ebp),%eax
+     558:	8b 55 08             	mov    0x8(%ebp),%edx
+     55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     55e:	85 c0                	test   %eax,%eax
+     560:	7e 13                	jle    575 <memmove+0x25>
+     562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     564:	89 d7                	mov    %edx,%edi
+     566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     571:	39 f8                	cmp    %edi,%eax
+     573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+     575:	5e                   	pop    %esi
+     576:	89 d0                	mov    %edx,%eax
+     578:	5f                   	pop    %edi
+     579:	5d                   	pop    %ebp
+     57a:	c3                   	ret
+     57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     57f:	90                   	nop
+
+00000580 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+     580:	55                   	push   %ebp
+     581:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     583:	8b 45 08             	mov    0x8(%ebp),%eax
+     586:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     58c:	5d                   	pop    %ebp
+     58d:	c3                   	ret
+     58e:	66 90                	xchg   %ax,%ax
+
+00000590 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     590:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     591:	31 c0                	xor    %eax,%eax
+     593:	ba 01 00 00 00       	mov    $0x1,%edx
+     598:	89 e5                	mov    %esp,%ebp
+     59a:	56                   	push   %esi
+     59b:	53                   	push   %ebx
+     59c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     59f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     5a3:	85 c0                	test   %eax,%eax
+     5a5:	74 32                	je     5d9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+     5a7:	83 f8 02             	cmp    $0x2,%eax
+     5aa:	74 0c                	je     5b8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     5ac:	b8 02 00 00 00       	mov    $0x2,%eax
+     5b1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     5b4:	85 c0                	test   %eax,%eax
+     5b6:	74 21                	je     5d9 <mutex_lock+0x49>
+     5b8:	be 02 00 00 00       	mov    $0x2,%esi
+     5bd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     5c0:	83 ec 04             	sub    $0x4,%esp
+     5c3:	6a 02                	push   $0x2
+     5c5:	6a 00                	push   $0x0
+     5c7:	53                   	push   %ebx
+     5c8:	e8 2a 05 00 00       	call   af7 <futex>
+     5cd:	89 f0                	mov    %esi,%eax
+     5cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     5d2:	83 c4 10             	add    $0x10,%esp
+     5d5:	85 c0                	test   %eax,%eax
+     5d7:	75 e7                	jne    5c0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     5d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5dc:	5b                   	pop    %ebx
+     5dd:	5e                   	pop    %esi
+     5de:	5d                   	pop    %ebp
+     5df:	c3                   	ret
+
+000005e0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	31 c0                	xor    %eax,%eax
+     5e3:	89 e5                	mov    %esp,%ebp
+     5e5:	83 ec 08             	sub    $0x8,%esp
+     5e8:	8b 55 08             	mov    0x8(%ebp),%edx
+     5eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     5ee:	83 f8 02             	cmp    $0x2,%eax
+     5f1:	74 05                	je     5f8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     5f3:	c9                   	leave
+     5f4:	c3                   	ret
+     5f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     5f8:	83 ec 04             	sub    $0x4,%esp
+     5fb:	6a 01                	push   $0x1
+     5fd:	6a 01                	push   $0x1
+     5ff:	52                   	push   %edx
+     600:	e8 f2 04 00 00       	call   af7 <futex>
+     605:	83 c4 10             	add    $0x10,%esp
+}
+     608:	c9                   	leave
+     609:	c3                   	ret
+     60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000610 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     613:	8b 45 08             	mov    0x8(%ebp),%eax
+     616:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     61c:	5d                   	pop    %ebp
+     61d:	c3                   	ret
+     61e:	66 90                	xchg   %ax,%ax
+
+00000620 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     620:	55                   	push   %ebp
+     621:	31 c0                	xor    %eax,%eax
+     623:	89 e5                	mov    %esp,%ebp
+     625:	57                   	push   %edi
+     626:	56                   	push   %esi
+     627:	53                   	push   %ebx
+     628:	83 ec 0c             	sub    $0xc,%esp
+     62b:	8b 75 08             	mov    0x8(%ebp),%esi
+     62e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     631:	8b 3e                	mov    (%esi),%edi
+     633:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     636:	83 f8 02             	cmp    $0x2,%eax
+     639:	74 5d                	je     698 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     63b:	83 ec 04             	sub    $0x4,%esp
+     63e:	57                   	push   %edi
+     63f:	6a 00                	push   $0x0
+     641:	56                   	push   %esi
+     642:	e8 b0 04 00 00       	call   af7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+     647:	31 c0                	xor    %eax,%eax
+     649:	ba 01 00 00 00       	mov    $0x1,%edx
+     64e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     652:	83 c4 10             	add    $0x10,%esp
+     655:	85 c0                	test   %eax,%eax
+     657:	74 30                	je     689 <cond_wait+0x69>
+  if(c != 2)
+     659:	83 f8 02             	cmp    $0x2,%eax
+     65c:	74 0c                	je     66a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+     65e:	b8 02 00 00 00       	mov    $0x2,%eax
+     663:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     666:	85 c0                	test   %eax,%eax
+     668:	74 1f                	je     689 <cond_wait+0x69>
+     66a:	be 02 00 00 00       	mov    $0x2,%esi
+     66f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+     670:	83 ec 04             	sub    $0x4,%esp
+     673:	6a 02                	push   $0x2
+     675:	6a 00                	push   $0x0
+     677:	53                   	push   %ebx
+     678:	e8 7a 04 00 00       	call   af7 <futex>
+     67d:	89 f0                	mov    %esi,%eax
+     67f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     682:	83 c4 10             	add    $0x10,%esp
+     685:	85 c0                	test   %eax,%eax
+     687:	75 e7                	jne    670 <cond_wait+0x50>
+  mutex_lock(m);
+}
+     689:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     68c:	5b                   	pop    %ebx
+     68d:	5e                   	pop    %esi
+     68e:	5f                   	pop    %edi
+     68f:	5d                   	pop    %ebp
+     690:	c3                   	ret
+     691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     698:	83 ec 04             	sub    $0x4,%esp
+     69b:	6a 01                	push   $0x1
+     69d:	6a 01                	push   $0x1
+     69f:	53                   	push   %ebx
+     6a0:	e8 52 04 00 00       	call   af7 <futex>
+     6a5:	83 c4 10             	add    $0x10,%esp
+     6a8:	eb 91                	jmp    63b <cond_wait+0x1b>
+     6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006b0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	53                   	push   %ebx
+     6b4:	83 ec 04             	sub    $0x4,%esp
+     6b7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     6c0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     6c2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+     6c5:	89 c8                	mov    %ecx,%eax
+     6c7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     6cb:	39 c1                	cmp    %eax,%ecx
+     6cd:	75 f1                	jne    6c0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+     6cf:	83 ec 04             	sub    $0x4,%esp
+     6d2:	6a 01                	push   $0x1
+     6d4:	6a 01                	push   $0x1
+     6d6:	52                   	push   %edx
+     6d7:	e8 1b 04 00 00       	call   af7 <futex>
+}
+     6dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6df:	83 c4 10             	add    $0x10,%esp
+     6e2:	c9                   	leave
+     6e3:	c3                   	ret
+     6e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ef:	90                   	nop
+
+000006f0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	53                   	push   %ebx
+     6f4:	83 ec 04             	sub    $0x4,%esp
+     6f7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     6fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     700:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     702:	8d 59 01             	lea    0x1(%ecx),%ebx
+     705:	89 c8                	mov    %ecx,%eax
+     707:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     70b:	39 c1                	cmp    %eax,%ecx
+     70d:	75 f1                	jne    700 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     70f:	83 ec 04             	sub    $0x4,%esp
+     712:	6a 40                	push   $0x40
+     714:	6a 01                	push   $0x1
+     716:	52                   	push   %edx
+     717:	e8 db 03 00 00       	call   af7 <futex>
+}
+     71c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     71f:	83 c4 10             	add    $0x10,%esp
+     722:	c9                   	leave
+     723:	c3                   	ret
+     724:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     72f:	90                   	nop
+
+00000730 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     730:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+     735:	c3                   	ret
+     736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     73d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000740 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+     740:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     745:	85 c0                	test   %eax,%eax
+     747:	74 07                	je     750 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+     749:	c3                   	ret
+     74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+     750:	e9 d2 02 00 00       	jmp    a27 <getpid>
+     755:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+     760:	55                   	push   %ebp
+     761:	89 e5                	mov    %esp,%ebp
+     763:	57                   	push   %edi
+     764:	56                   	push   %esi
+     765:	53                   	push   %ebx
+     766:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+     769:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+     76b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     771:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     777:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     77c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     782:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     785:	89 d0                	mov    %edx,%eax
+     787:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     78a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     790:	29 d9                	sub    %ebx,%ecx
+     792:	89 c6                	mov    %eax,%esi
+     794:	89 d7                	mov    %edx,%edi
+     796:	0f a5 c7             	shld   %cl,%eax,%edi
+     799:	d3 e6                	shl    %cl,%esi
+     79b:	31 c0                	xor    %eax,%eax
+     79d:	f6 c1 20             	test   $0x20,%cl
+     7a0:	0f 45 fe             	cmovne %esi,%edi
+     7a3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     7a6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     7a9:	89 d9                	mov    %ebx,%ecx
+     7ab:	31 db                	xor    %ebx,%ebx
+     7ad:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     7b3:	0f ad d0             	shrd   %cl,%edx,%eax
+     7b6:	d3 ea                	shr    %cl,%edx
+     7b8:	f6 c1 20             	test   $0x20,%cl
+     7bb:	0f 45 c2             	cmovne %edx,%eax
+     7be:	0f 45 d3             	cmovne %ebx,%edx
+     7c1:	01 f0                	add    %esi,%eax
+     7c3:	11 fa                	adc    %edi,%edx
+}
+     7c5:	83 c4 0c             	add    $0xc,%esp
+     7c8:	5b                   	pop    %ebx
+     7c9:	5e                   	pop    %esi
+     7ca:	5f                   	pop    %edi
+     7cb:	5d                   	pop    %ebp
+     7cc:	c3                   	ret
+     7cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007d0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	57                   	push   %edi
+     7d4:	56                   	push   %esi
+     7d5:	53                   	push   %ebx
+     7d6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+     7d9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+     7dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+     7e0:	74 0e                	je     7f0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+     7e2:	83 c4 1c             	add    $0x1c,%esp
+     7e5:	5b                   	pop    %ebx
+     7e6:	5e                   	pop    %esi
+     7e7:	5f                   	pop    %edi
+     7e8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+     7e9:	e9 a5 03 00 00       	jmp    b93 <clock_gettime>
+     7ee:	66 90                	xchg   %ax,%ax
+     7f0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+     7f2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     7f8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     7fe:	b9 20 00 00 00       	mov    $0x20,%ecx
+     803:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     806:	89 d0                	mov    %edx,%eax
+     808:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     80b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     811:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+     817:	89 c6                	mov    %eax,%esi
+     819:	89 d7                	mov    %edx,%edi
+     81b:	0f a5 c7             	shld   %cl,%eax,%edi
+     81e:	d3 e6                	shl    %cl,%esi
+     820:	31 c0                	xor    %eax,%eax
+     822:	f6 c1 20             	test   $0x20,%cl
+     825:	0f 45 fe             	cmovne %esi,%edi
+     828:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     82b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     82e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+     835:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     83b:	0f ad d0             	shrd   %cl,%edx,%eax
+     83e:	d3 ea                	shr    %cl,%edx
+     840:	f6 c1 20             	test   $0x20,%cl
+     843:	74 04                	je     849 <vclock_gettime+0x79>
+     845:	89 d0                	mov    %edx,%eax
+     847:	31 d2                	xor    %edx,%edx
+     849:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     84b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+     850:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+     852:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     854:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+     856:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     858:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+     85e:	29 c1                	sub    %eax,%ecx
+}
+     860:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     862:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+     865:	83 c4 1c             	add    $0x1c,%esp
+     868:	5b                   	pop    %ebx
+     869:	5e                   	pop    %esi
+     86a:	5f                   	pop    %edi
+     86b:	5d                   	pop    %ebp
+     86c:	c3                   	ret
+
+0000086d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+     86d:	b8 01 00 00 00       	mov    $0x1,%eax
+     872:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     879:	74 09                	je     884 <fork+0x17>
+     87b:	89 e1                	mov    %esp,%ecx
+     87d:	ba 86 08 00 00       	mov    $0x886,%edx
+     882:	0f 34                	sysenter
+     884:	cd 40                	int    $0x40
+     886:	c3                   	ret
+
+00000887 <exit>:
+SYSCALL(exit)
+     887:	b8 02 00 00 00       	mov    $0x2,%eax
+     88c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     893:	74 09                	je     89e <exit+0x17>
+     895:	89 e1                	mov    %esp,%ecx
+     897:	ba a0 08 00 00       	mov    $0x8a0,%edx
+     89c:	0f 34                	sysenter
+     89e:	cd 40                	int    $0x40
+     8a0:	c3                   	ret
+
+000008a1 <wait>:
+SYSCALL(wait)
+     8a1:	b8 03 00 00 00       	mov    $0x3,%eax
+     8a6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8ad:	74 09                	je     8b8 <wait+0x17>
+     8af:	89 e1                	mov    %esp,%ecx
+     8b1:	ba ba 08 00 00       	mov    $0x8ba,%edx
+     8b6:	0f 34                	sysenter
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <pipe>:
+SYSCALL(pipe)
+     8bb:	b8 04 00 00 00       	mov    $0x4,%eax
+     8c0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8c7:	74 09                	je     8d2 <pipe+0x17>
+     8c9:	89 e1                	mov    %esp,%ecx
+     8cb:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d0:	0f 34                	sysenter
+     8d2:	cd 40                	int    $0x40
+     8d4:	c3                   	ret
+
+000008d5 <read>:
+SYSCALL(read)
+     8d5:	b8 05 00 00 00       	mov    $0x5,%eax
+     8da:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8e1:	74 09                	je     8ec <read+0x17>
+     8e3:	89 e1                	mov    %esp,%ecx
+     8e5:	ba ee 08 00 00       	mov    $0x8ee,%edx
+     8ea:	0f 34                	sysenter
+     8ec:	cd 40                	int    $0x40
+     8ee:	c3                   	ret
+
+000008ef <write>:
+SYSCALL(write)
+     8ef:	b8 10 00 00 00       	mov    $0x10,%eax
+     8f4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     8fb:	74 09                	je     906 <write+0x17>
+     8fd:	89 e1                	mov    %esp,%ecx
+     8ff:	ba 08 09 00 00       	mov    $0x908,%edx
+     904:	0f 34                	sysenter
+     906:	cd 40                	int    $0x40
+     908:	c3                   	ret
+
+00000909 <close>:
+SYSCALL(close)
+     909:	b8 15 00 00 00       	mov    $0x15,%eax
+     90e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     915:	74 09                	je     920 <close+0x17>
+     917:	89 e1                	mov    %esp,%ecx
+     919:	ba 22 09 00 00       	mov    $0x922,%edx
+     91e:	0f 34                	sysenter
+     920:	cd 40                	int    $0x40
+     922:	c3                   	ret
+
+00000923 <kill>:
+SYSCALL(kill)
+     923:	b8 06 00 00 00       	mov    $0x6,%eax
+     928:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     92f:	74 09                	je     93a <kill+0x17>
+     931:	89 e1                	mov    %esp,%ecx
+     933:	ba 3c 09 00 00       	mov    $0x93c,%edx
+     938:	0f 34                	sysenter
+     93a:	cd 40                	int    $0x40
+     93c:	c3                   	ret
+
+0000093d <exec>:
+SYSCALL(exec)
+     93d:	b8 07 00 00 00       	mov    $0x7,%eax
+     942:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     949:	74 09                	je     954 <exec+0x17>
+     94b:	89 e1                	mov    %esp,%ecx
+     94d:	ba 56 09 00 00       	mov    $0x956,%edx
+     952:	0f 34                	sysenter
+     954:	cd 40                	int    $0x40
+     956:	c3                   	ret
+
+00000957 <open>:
+SYSCALL(open)
+     957:	b8 0f 00 00 00       	mov    $0xf,%eax
+     95c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     963:	74 09                	je     96e <open+0x17>
+     965:	89 e1                	mov    %esp,%ecx
+     967:	ba 70 09 00 00       	mov    $0x970,%edx
+     96c:	0f 34                	sysenter
+     96e:	cd 40                	int    $0x40
+     970:	c3                   	ret
+
+00000971 <mknod>:
+SYSCALL(mknod)
+     971:	b8 11 00 00 00       	mov    $0x11,%eax
+     976:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     97d:	74 09                	je     988 <mknod+0x17>
+     97f:	89 e1                	mov    %esp,%ecx
+     981:	ba 8a 09 00 00       	mov    $0x98a,%edx
+     986:	0f 34                	sysenter
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+
+0000098b <unlink>:
+SYSCALL(unlink)
+     98b:	b8 12 00 00 00       	mov    $0x12,%eax
+     990:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     997:	74 09                	je     9a2 <unlink+0x17>
+     999:	89 e1                	mov    %esp,%ecx
+     99b:	ba a4 09 00 00       	mov    $0x9a4,%edx
+     9a0:	0f 34                	sysenter
+     9a2:	cd 40                	int    $0x40
+     9a4:	c3                   	ret
+
+000009a5 <fstat>:
+SYSCALL(fstat)
+     9a5:	b8 08 00 00 00       	mov    $0x8,%eax
+     9aa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9b1:	74 09                	je     9bc <fstat+0x17>
+     9b3:	89 e1                	mov    %esp,%ecx
+     9b5:	ba be 09 00 00       	mov    $0x9be,%edx
+     9ba:	0f 34                	sysenter
+     9bc:	cd 40                	int    $0x40
+     9be:	c3                   	ret
+
+000009bf <link>:
+SYSCALL(link)
+     9bf:	b8 13 00 00 00       	mov    $0x13,%eax
+     9c4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9cb:	74 09                	je     9d6 <link+0x17>
+     9cd:	89 e1                	mov    %esp,%ecx
+     9cf:	ba d8 09 00 00       	mov    $0x9d8,%edx
+     9d4:	0f 34                	sysenter
+     9d6:	cd 40                	int    $0x40
+     9d8:	c3                   	ret
+
+000009d9 <mkdir>:
+SYSCALL(mkdir)
+     9d9:	b8 14 00 00 00       	mov    $0x14,%eax
+     9de:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9e5:	74 09                	je     9f0 <mkdir+0x17>
+     9e7:	89 e1                	mov    %esp,%ecx
+     9e9:	ba f2 09 00 00       	mov    $0x9f2,%edx
+     9ee:	0f 34                	sysenter
+     9f0:	cd 40                	int    $0x40
+     9f2:	c3                   	ret
+
+000009f3 <chdir>:
+SYSCALL(chdir)
+     9f3:	b8 09 00 00 00       	mov    $0x9,%eax
+     9f8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     9ff:	74 09                	je     a0a <chdir+0x17>
+     a01:	89 e1                	mov    %esp,%ecx
+     a03:	ba 0c 0a 00 00       	mov    $0xa0c,%edx
+     a08:	0f 34                	sysenter
+     a0a:	cd 40                	int    $0x40
+     a0c:	c3                   	ret
+
+00000a0d <dup>:
+SYSCALL(dup)
+     a0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a12:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a19:	74 09                	je     a24 <dup+0x17>
+     a1b:	89 e1                	mov    %esp,%ecx
+     a1d:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a22:	0f 34                	sysenter
+     a24:	cd 40                	int    $0x40
+     a26:	c3                   	ret
+
+00000a27 <getpid>:
+SYSCALL(getpid)
+     a27:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a2c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a33:	74 09                	je     a3e <getpid+0x17>
+     a35:	89 e1                	mov    %esp,%ecx
+     a37:	ba 40 0a 00 00       	mov    $0xa40,%edx
+     a3c:	0f 34                	sysenter
+     a3e:	cd 40                	int    $0x40
+     a40:	c3                   	ret
+
+00000a41 <sbrk>:
+SYSCALL(sbrk)
+     a41:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a46:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a4d:	74 09                	je     a58 <sbrk+0x17>
+     a4f:	89 e1                	mov    %esp,%ecx
+     a51:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a56:	0f 34                	sysenter
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <sleep>:
+SYSCALL(sleep)
+     a5b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a60:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a67:	74 09                	je     a72 <sleep+0x17>
+     a69:	89 e1                	mov    %esp,%ecx
+     a6b:	ba 74 0a 00 00       	mov    $0xa74,%edx
+     a70:	0f 34                	sysenter
+     a72:	cd 40                	int    $0x40
+     a74:	c3                   	ret
+
+00000a75 <uptime>:
+SYSCALL(uptime)
+     a75:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a7a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a81:	74 09                	je     a8c <uptime+0x17>
+     a83:	89 e1                	mov    %esp,%ecx
+     a85:	ba 8e 0a 00 00       	mov    $0xa8e,%edx
+     a8a:	0f 34                	sysenter
+     a8c:	cd 40                	int    $0x40
+     a8e:	c3                   	ret
+
+00000a8f <mmap>:
+SYSCALL(mmap)
+     a8f:	b8 16 00 00 00       	mov    $0x16,%eax
+     a94:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a9b:	74 09                	je     aa6 <mmap+0x17>
+     a9d:	89 e1                	mov    %esp,%ecx
+     a9f:	ba a8 0a 00 00       	mov    $0xaa8,%edx
+     aa4:	0f 34                	sysenter
+     aa6:	cd 40                	int    $0x40
+     aa8:	c3                   	ret
+
+00000aa9 <munmap>:
+SYSCALL(munmap)
+     aa9:	b8 17 00 00 00       	mov    $0x17,%eax
+     aae:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ab5:	74 09                	je     ac0 <munmap+0x17>
+     ab7:	89 e1                	mov    %esp,%ecx
+     ab9:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     abe:	0f 34                	sysenter
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <clone>:
+SYSCALL(clone)
+     ac3:	b8 18 00 00 00       	mov    $0x18,%eax
+     ac8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     acf:	74 09                	je     ada <clone+0x17>
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba dc 0a 00 00       	mov    $0xadc,%edx
+     ad8:	0f 34                	sysenter
+     ada:	cd 40                	int    $0x40
+     adc:	c3                   	ret
+
+00000add <join>:
+SYSCALL(join)
+     add:	b8 19 00 00 00       	mov    $0x19,%eax
+     ae2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ae9:	74 09                	je     af4 <join+0x17>
+     aeb:	89 e1                	mov    %esp,%ecx
+     aed:	ba f6 0a 00 00       	mov    $0xaf6,%edx
+     af2:	0f 34                	sysenter
+     af4:	cd 40                	int    $0x40
+     af6:	c3                   	ret
+
+00000af7 <futex>:
+SYSCALL(futex)
+     af7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     afc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b03:	74 09                	je     b0e <futex+0x17>
+     b05:	89 e1                	mov    %esp,%ecx
+     b07:	ba 10 0b 00 00       	mov    $0xb10,%edx
+     b0c:	0f 34                	sysenter
+     b0e:	cd 40                	int    $0x40
+     b10:	c3                   	ret
+
+00000b11 <memstat>:
+SYSCALL(memstat)
+     b11:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b16:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b1d:	74 09                	je     b28 <memstat+0x17>
+     b1f:	89 e1                	mov    %esp,%ecx
+     b21:	ba 2a 0b 00 00       	mov    $0xb2a,%edx
+     b26:	0f 34                	sysenter
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <nice>:
+SYSCALL(nice)
+     b2b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b30:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b37:	74 09                	je     b42 <nice+0x17>
+     b39:	89 e1                	mov    %esp,%ecx
+     b3b:	ba 44 0b 00 00       	mov    $0xb44,%edx
+     b40:	0f 34                	sysenter
+     b42:	cd 40                	int    $0x40
+     b44:	c3                   	ret
+
+00000b45 <setpriority>:
+SYSCALL(setpriority)
+     b45:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b4a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b51:	74 09                	je     b5c <setpriority+0x17>
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5e 0b 00 00       	mov    $0xb5e,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	cd 40                	int    $0x40
+     b5e:	c3                   	ret
+
+00000b5f <getpinfo>:
+SYSCALL(getpinfo)
+     b5f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b64:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b6b:	74 09                	je     b76 <getpinfo+0x17>
+     b6d:	89 e1                	mov    %esp,%ecx
+     b6f:	ba 78 0b 00 00       	mov    $0xb78,%edx
+     b74:	0f 34                	sysenter
+     b76:	cd 40                	int    $0x40
+     b78:	c3                   	ret
+
+00000b79 <settickets>:
+SYSCALL(settickets)
+     b79:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b7e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b85:	74 09                	je     b90 <settickets+0x17>
+     b87:	89 e1                	mov    %esp,%ecx
+     b89:	ba 92 0b 00 00       	mov    $0xb92,%edx
+     b8e:	0f 34                	sysenter
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <clock_gettime>:
+SYSCALL(clock_gettime)
+     b93:	b8 20 00 00 00       	mov    $0x20,%eax
+     b98:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b9f:	74 09                	je     baa <clock_gettime+0x17>
+     ba1:	89 e1                	mov    %esp,%ecx
+     ba3:	ba ac 0b 00 00       	mov    $0xbac,%edx
+     ba8:	0f 34                	sysenter
+     baa:	cd 40                	int    $0x40
+     bac:	c3                   	ret
+
+00000bad <batch>:
+SYSCALL(batch)
+     bad:	b8 21 00 00 00       	mov    $0x21,%eax
+     bb2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bb9:	74 09                	je     bc4 <batch+0x17>
+     bbb:	89 e1                	mov    %esp,%ecx
+     bbd:	ba c6 0b 00 00       	mov    $0xbc6,%edx
+     bc2:	0f 34                	sysenter
+     bc4:	cd 40                	int    $0x40
+     bc6:	c3                   	ret
+
+00000bc7 <aiosetup>:
+SYSCALL(aiosetup)
+     bc7:	b8 22 00 00 00       	mov    $0x22,%eax
+     bcc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bd3:	74 09                	je     bde <aiosetup+0x17>
+     bd5:	89 e1                	mov    %esp,%ecx
+     bd7:	ba e0 0b 00 00       	mov    $0xbe0,%edx
+     bdc:	0f 34                	sysenter
+     bde:	cd 40                	int    $0x40
+     be0:	c3                   	ret
+
+00000be1 <aioenter>:
+SYSCALL(aioenter)
+     be1:	b8 23 00 00 00       	mov    $0x23,%eax
+     be6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bed:	74 09                	je     bf8 <aioenter+0x17>
+     bef:	89 e1                	mov    %esp,%ecx
+     bf1:	ba fa 0b 00 00       	mov    $0xbfa,%edx
+     bf6:	0f 34                	sysenter
+     bf8:	cd 40                	int    $0x40
+     bfa:	c3                   	ret
+
+00000bfb <systrace>:
+SYSCALL(systrace)
+     bfb:	b8 24 00 00 00       	mov    $0x24,%eax
+     c00:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c07:	74 09                	je     c12 <systrace+0x17>
+     c09:	89 e1                	mov    %esp,%ecx
+     c0b:	ba 14 0c 00 00       	mov    $0xc14,%edx
+     c10:	0f 34                	sysenter
+     c12:	cd 40                	int    $0x40
+     c14:	c3                   	ret
+
+00000c15 <sysstat>:
+SYSCALL(sysstat)
+     c15:	b8 25 00 00 00       	mov    $0x25,%eax
+     c1a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c21:	74 09                	je     c2c <sysstat+0x17>
+     c23:	89 e1                	mov    %esp,%ecx
+     c25:	ba 2e 0c 00 00       	mov    $0xc2e,%edx
+     c2a:	0f 34                	sysenter
+     c2c:	cd 40                	int    $0x40
+     c2e:	c3                   	ret
+
+00000c2f <traceread>:
+SYSCALL(traceread)
+     c2f:	b8 26 00 00 00       	mov    $0x26,%eax
+     c34:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c3b:	74 09                	je     c46 <traceread+0x17>
+     c3d:	89 e1                	mov    %esp,%ecx
+     c3f:	ba 48 0c 00 00       	mov    $0xc48,%edx
+     c44:	0f 34                	sysenter
+     c46:	cd 40                	int    $0x40
+     c48:	c3                   	ret
+     c49:	66 90                	xchg   %ax,%ax
+     c4b:	66 90                	xchg   %ax,%ax
+     c4d:	66 90                	xchg   %ax,%ax
+     c4f:	90                   	nop
+
+00000c50 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c50:	55                   	push   %ebp
+     c51:	89 e5                	mov    %esp,%ebp
+     c53:	57                   	push   %edi
+     c54:	56                   	push   %esi
+     c55:	53                   	push   %ebx
+     c56:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     c58:	89 d1                	mov    %edx,%ecx
+{
+     c5a:	83 ec 3c             	sub    $0x3c,%esp
+     c5d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     c60:	85 d2                	test   %edx,%edx
+     c62:	0f 89 80 00 00 00    	jns    ce8 <printint+0x98>
+     c68:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     c6c:	74 7a                	je     ce8 <printint+0x98>
+    x = -xx;
+     c6e:	f7 d9                	neg    %ecx
+    neg = 1;
+     c70:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c75:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     c78:	31 f6                	xor    %esi,%esi
+     c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     c80:	89 c8                	mov    %ecx,%eax
+     c82:	31 d2                	xor    %edx,%edx
+     c84:	89 f7                	mov    %esi,%edi
+     c86:	f7 f3                	div    %ebx
+     c88:	8d 76 01             	lea    0x1(%esi),%esi
+     c8b:	0f b6 92 7c 11 00 00 	movzbl 0x117c(%edx),%edx
+     c92:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     c96:	89 ca                	mov    %ecx,%edx
+     c98:	89 c1                	mov    %eax,%ecx
+     c9a:	39 da                	cmp    %ebx,%edx
+     c9c:	73 e2                	jae    c80 <printint+0x30>
+  if(neg)
+     c9e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ca1:	85 c0                	test   %eax,%eax
+     ca3:	74 07                	je     cac <printint+0x5c>
+    buf[i++] = '-';
+     ca5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     caa:	89 f7                	mov    %esi,%edi
+     cac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     caf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     cb2:	01 df                	add    %ebx,%edi
+     cb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     cb8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     cbb:	83 ec 04             	sub    $0x4,%esp
+     cbe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     cc1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     cc4:	6a 01                	push   $0x1
+     cc6:	50                   	push   %eax
+     cc7:	56                   	push   %esi
+     cc8:	e8 22 fc ff ff       	call   8ef <write>
+  while(--i >= 0)
+     ccd:	89 f8                	mov    %edi,%eax
+     ccf:	83 c4 10             	add    $0x10,%esp
+     cd2:	83 ef 01             	sub    $0x1,%edi
+     cd5:	39 d8                	cmp    %ebx,%eax
+     cd7:	75 df                	jne    cb8 <printint+0x68>
+}
+     cd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     cdc:	5b                   	pop    %ebx
+     cdd:	5e                   	pop    %esi
+     cde:	5f                   	pop    %edi
+     cdf:	5d                   	pop    %ebp
+     ce0:	c3                   	ret
+     ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     ce8:	31 c0                	xor    %eax,%eax
+     cea:	eb 89                	jmp    c75 <printint+0x25>
+     cec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000cf0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+     cf5:	53                   	push   %ebx
+     cf6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     cf9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     cfc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     cff:	0f b6 1e             	movzbl (%esi),%ebx
+     d02:	83 c6 01             	add    $0x1,%esi
+     d05:	84 db                	test   %bl,%bl
+     d07:	74 67                	je     d70 <printf+0x80>
+     d09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     d0c:	31 d2                	xor    %edx,%edx
+     d0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     d11:	eb 34                	jmp    d47 <printf+0x57>
+     d13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d17:	90                   	nop
+     d18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     d1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     d20:	83 f8 25             	cmp    $0x25,%eax
+     d23:	74 18                	je     d3d <printf+0x4d>
+  write(fd, &c, 1);
+     d25:	83 ec 04             	sub    $0x4,%esp
+     d28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d2e:	6a 01                	push   $0x1
+     d30:	50                   	push   %eax
+     d31:	57                   	push   %edi
+     d32:	e8 b8 fb ff ff       	call   8ef <write>
+     d37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     d3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     d3d:	0f b6 1e             	movzbl (%esi),%ebx
+     d40:	83 c6 01             	add    $0x1,%esi
+     d43:	84 db                	test   %bl,%bl
+     d45:	74 29                	je     d70 <printf+0x80>
+    c = fmt[i] & 0xff;
+     d47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     d4a:	85 d2                	test   %edx,%edx
+     d4c:	74 ca                	je     d18 <printf+0x28>
+      }
+    } else if(state == '%'){
+     d4e:	83 fa 25             	cmp    $0x25,%edx
+     d51:	75 ea                	jne    d3d <printf+0x4d>
+      if(c == 'd'){
+     d53:	83 f8 25             	cmp    $0x25,%eax
+     d56:	0f 84 24 01 00 00    	je     e80 <printf+0x190>
+     d5c:	83 e8 63             	sub    $0x63,%eax
+     d5f:	83 f8 15             	cmp    $0x15,%eax
+     d62:	77 1c                	ja     d80 <printf+0x90>
+     d64:	ff 24 85 24 11 00 00 	jmp    *0x1124(,%eax,4)
+     d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d73:	5b                   	pop    %ebx
+     d74:	5e                   	pop    %esi
+     d75:	5f                   	pop    %edi
+     d76:	5d                   	pop    %ebp
+     d77:	c3                   	ret
+     d78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d7f:	90                   	nop
+  write(fd, &c, 1);
+     d80:	83 ec 04             	sub    $0x4,%esp
+     d83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     d86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     d8a:	6a 01                	push   $0x1
+     d8c:	52                   	push   %edx
+     d8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     d90:	57                   	push   %edi
+     d91:	e8 59 fb ff ff       	call   8ef <write>
+     d96:	83 c4 0c             	add    $0xc,%esp
+     d99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     d9c:	6a 01                	push   $0x1
+     d9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     da1:	52                   	push   %edx
+     da2:	57                   	push   %edi
+     da3:	e8 47 fb ff ff       	call   8ef <write>
+        putc(fd, c);
+     da8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dab:	31 d2                	xor    %edx,%edx
+     dad:	eb 8e                	jmp    d3d <printf+0x4d>
+     daf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     db0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     db3:	83 ec 0c             	sub    $0xc,%esp
+     db6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     dbb:	8b 13                	mov    (%ebx),%edx
+     dbd:	6a 00                	push   $0x0
+     dbf:	89 f8                	mov    %edi,%eax
+        ap++;
+     dc1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     dc4:	e8 87 fe ff ff       	call   c50 <printint>
+        ap++;
+     dc9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     dcc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dcf:	31 d2                	xor    %edx,%edx
+     dd1:	e9 67 ff ff ff       	jmp    d3d <printf+0x4d>
+     dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ddd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     de0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     de3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     de5:	83 c0 04             	add    $0x4,%eax
+     de8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     deb:	85 db                	test   %ebx,%ebx
+     ded:	0f 84 9d 00 00 00    	je     e90 <printf+0x1a0>
+        while(*s != 0){
+     df3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     df6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     df8:	84 c0                	test   %al,%al
+     dfa:	0f 84 3d ff ff ff    	je     d3d <printf+0x4d>
+     e00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     e06:	89 de                	mov    %ebx,%esi
+     e08:	89 d3                	mov    %edx,%ebx
+     e0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     e10:	83 ec 04             	sub    $0x4,%esp
+     e13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     e16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     e19:	6a 01                	push   $0x1
+     e1b:	53                   	push   %ebx
+     e1c:	57                   	push   %edi
+     e1d:	e8 cd fa ff ff       	call   8ef <write>
+        while(*s != 0){
+     e22:	0f b6 06             	movzbl (%esi),%eax
+     e25:	83 c4 10             	add    $0x10,%esp
+     e28:	84 c0                	test   %al,%al
+     e2a:	75 e4                	jne    e10 <printf+0x120>
+      state = 0;
+     e2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e2f:	31 d2                	xor    %edx,%edx
+     e31:	e9 07 ff ff ff       	jmp    d3d <printf+0x4d>
+     e36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     e40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     e43:	83 ec 0c             	sub    $0xc,%esp
+     e46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e4b:	8b 13                	mov    (%ebx),%edx
+     e4d:	6a 01                	push   $0x1
+     e4f:	e9 6b ff ff ff       	jmp    dbf <printf+0xcf>
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     e58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     e5b:	83 ec 04             	sub    $0x4,%esp
+     e5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     e61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     e63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     e66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     e69:	6a 01                	push   $0x1
+     e6b:	52                   	push   %edx
+     e6c:	57                   	push   %edi
+     e6d:	e8 7d fa ff ff       	call   8ef <write>
+        ap++;
+     e72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     e75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e78:	31 d2                	xor    %edx,%edx
+     e7a:	e9 be fe ff ff       	jmp    d3d <printf+0x4d>
+     e7f:	90                   	nop
+  write(fd, &c, 1);
+     e80:	83 ec 04             	sub    $0x4,%esp
+     e83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     e86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     e89:	6a 01                	push   $0x1
+     e8b:	e9 11 ff ff ff       	jmp    da1 <printf+0xb1>
+     e90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     e95:	bb 1a 11 00 00       	mov    $0x111a,%ebx
+     e9a:	e9 61 ff ff ff       	jmp    e00 <printf+0x110>
+     e9f:	90                   	nop
+
+00000ea0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     ea0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ea1:	a1 a0 16 00 00       	mov    0x16a0,%eax
+{
+     ea6:	89 e5                	mov    %esp,%ebp
+     ea8:	57                   	push   %edi
+     ea9:	56                   	push   %esi
+     eaa:	53                   	push   %ebx
+     eab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     eae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     eb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     eba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ebc:	39 ca                	cmp    %ecx,%edx
+     ebe:	73 30                	jae    ef0 <free+0x50>
+     ec0:	39 c1                	cmp    %eax,%ecx
+     ec2:	72 04                	jb     ec8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ec4:	39 c2                	cmp    %eax,%edx
+     ec6:	72 f0                	jb     eb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ec8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     ecb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     ece:	39 f8                	cmp    %edi,%eax
+     ed0:	74 2e                	je     f00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ed2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ed5:	8b 42 04             	mov    0x4(%edx),%eax
+     ed8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     edb:	39 f1                	cmp    %esi,%ecx
+     edd:	74 38                	je     f17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     edf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     ee1:	5b                   	pop    %ebx
+  freep = p;
+     ee2:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+}
+     ee8:	5e                   	pop    %esi
+     ee9:	5f                   	pop    %edi
+     eea:	5d                   	pop    %ebp
+     eeb:	c3                   	ret
+     eec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     ef0:	39 c1                	cmp    %eax,%ecx
+     ef2:	72 d0                	jb     ec4 <free+0x24>
+     ef4:	eb c2                	jmp    eb8 <free+0x18>
+     ef6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     efd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     f00:	03 70 04             	add    0x4(%eax),%esi
+     f03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     f06:	8b 02                	mov    (%edx),%eax
+     f08:	8b 00                	mov    (%eax),%eax
+     f0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     f0d:	8b 42 04             	mov    0x4(%edx),%eax
+     f10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     f13:	39 f1                	cmp    %esi,%ecx
+     f15:	75 c8                	jne    edf <free+0x3f>
+    p->s.size += bp->s.size;
+     f17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     f1a:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+    p->s.size += bp->s.size;
+     f20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     f23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     f26:	89 0a                	mov    %ecx,(%edx)
+}
+     f28:	5b                   	pop    %ebx
+     f29:	5e                   	pop    %esi
+     f2a:	5f                   	pop    %edi
+     f2b:	5d                   	pop    %ebp
+     f2c:	c3                   	ret
+     f2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     f30:	55                   	push   %ebp
+     f31:	89 e5                	mov    %esp,%ebp
+     f33:	57                   	push   %edi
+     f34:	56                   	push   %esi
+     f35:	53                   	push   %ebx
+     f36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     f3c:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     f42:	8d 78 07             	lea    0x7(%eax),%edi
+     f45:	c1 ef 03             	shr    $0x3,%edi
+     f48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     f4b:	85 d2                	test   %edx,%edx
+     f4d:	0f 84 8d 00 00 00    	je     fe0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f55:	8b 48 04             	mov    0x4(%eax),%ecx
+     f58:	39 f9                	cmp    %edi,%ecx
+     f5a:	73 64                	jae    fc0 <malloc+0x90>
+  if(nu < 4096)
+     f5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     f61:	39 df                	cmp    %ebx,%edi
+     f63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     f66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     f6d:	eb 0a                	jmp    f79 <malloc+0x49>
+     f6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     f72:	8b 48 04             	mov    0x4(%eax),%ecx
+     f75:	39 f9                	cmp    %edi,%ecx
+     f77:	73 47                	jae    fc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     f79:	89 c2                	mov    %eax,%edx
+     f7b:	39 05 a0 16 00 00    	cmp    %eax,0x16a0
+     f81:	75 ed                	jne    f70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     f83:	83 ec 0c             	sub    $0xc,%esp
+     f86:	56                   	push   %esi
+     f87:	e8 b5 fa ff ff       	call   a41 <sbrk>
+  if(p == (char*)-1)
+     f8c:	83 c4 10             	add    $0x10,%esp
+     f8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f92:	74 1c                	je     fb0 <malloc+0x80>
+  hp->s.size = nu;
+     f94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     f97:	83 ec 0c             	sub    $0xc,%esp
+     f9a:	83 c0 08             	add    $0x8,%eax
+     f9d:	50                   	push   %eax
+     f9e:	e8 fd fe ff ff       	call   ea0 <free>
+  return freep;
+     fa3:	8b 15 a0 16 00 00    	mov    0x16a0,%edx
+      if((p = morecore(nunits)) == 0)
+     fa9:	83 c4 10             	add    $0x10,%esp
+     fac:	85 d2                	test   %edx,%edx
+     fae:	75 c0                	jne    f70 <malloc+0x40>
+        return 0;
+  }
+}
+     fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     fb3:	31 c0                	xor    %eax,%eax
+}
+     fb5:	5b                   	pop    %ebx
+     fb6:	5e                   	pop    %esi
+     fb7:	5f                   	pop    %edi
+     fb8:	5d                   	pop    %ebp
+     fb9:	c3                   	ret
+     fba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     fc0:	39 cf                	cmp    %ecx,%edi
+     fc2:	74 4c                	je     1010 <malloc+0xe0>
+        p->s.size -= nunits;
+     fc4:	29 f9                	sub    %edi,%ecx
+     fc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     fc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     fcc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     fcf:	89 15 a0 16 00 00    	mov    %edx,0x16a0
+}
+     fd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     fd8:	83 c0 08             	add    $0x8,%eax
+}
+     fdb:	5b                   	pop    %ebx
+     fdc:	5e                   	pop    %esi
+     fdd:	5f                   	pop    %edi
+     fde:	5d                   	pop    %ebp
+     fdf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     fe0:	c7 05 a0 16 00 00 a4 	movl   $0x16a4,0x16a0
+     fe7:	16 00 00 
+    base.s.size = 0;
+     fea:	b8 a4 16 00 00       	mov    $0x16a4,%eax
+    base.s.ptr = freep = prevp = &base;
+     fef:	c7 05 a4 16 00 00 a4 	movl   $0x16a4,0x16a4
+     ff6:	16 00 00 
+    base.s.size = 0;
+     ff9:	c7 05 a8 16 00 00 00 	movl   $0x0,0x16a8
+    1000:	00 00 00 
+    if(p->s.size >= nunits){
+    1003:	e9 54 ff ff ff       	jmp    f5c <malloc+0x2c>
+    1008:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1010:	8b 08                	mov    (%eax),%ecx
+    1012:	89 0a                	mov    %ecx,(%edx)
+    1014:	eb b9                	jmp    fcf <malloc+0x9f>
+    1016:	66 90                	xchg   %ax,%ax
+    1018:	66 90                	xchg   %ax,%ax
+    101a:	66 90                	xchg   %ax,%ax
+    101c:	66 90                	xchg   %ax,%ax
+    101e:	66 90                	xchg   %ax,%ax
+
+00001020 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1020:	55                   	push   %ebp
+    1021:	89 e5                	mov    %esp,%ebp
+    1023:	53                   	push   %ebx
+    1024:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+    1027:	68 00 20 00 00       	push   $0x2000
+    102c:	e8 ff fe ff ff       	call   f30 <malloc>
+    1031:	83 c4 10             	add    $0x10,%esp
+    1034:	85 c0                	test   %eax,%eax
+    1036:	74 47                	je     107f <thread_create+0x5f>
+    1038:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    103a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+    1040:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    1043:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+    1048:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+    104b:	ff 75 0c             	push   0xc(%ebp)
+    104e:	50                   	push   %eax
+    104f:	ff 75 08             	push   0x8(%ebp)
+    1052:	e8 6c fa ff ff       	call   ac3 <clone>
+    1057:	83 c4 10             	add    $0x10,%esp
+    105a:	85 c0                	test   %eax,%eax
+    105c:	78 0a                	js     1068 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    105e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1061:	c9                   	leave
+    1062:	c3                   	ret
+    1063:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1067:	90                   	nop
+    free(mem);
+    1068:	83 ec 0c             	sub    $0xc,%esp
+    106b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    106e:	53                   	push   %ebx
+    106f:	e8 2c fe ff ff       	call   ea0 <free>
+    1074:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1077:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    107a:	83 c4 10             	add    $0x10,%esp
+}
+    107d:	c9                   	leave
+    107e:	c3                   	ret
+    return -1;
+    107f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1084:	eb d8                	jmp    105e <thread_create+0x3e>
+    1086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    108d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001090 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+    1090:	55                   	push   %ebp
+    1091:	89 e5                	mov    %esp,%ebp
+    1093:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1094:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1097:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    109a:	50                   	push   %eax
+    109b:	e8 3d fa ff ff       	call   add <join>
+    10a0:	83 c4 10             	add    $0x10,%esp
+    10a3:	85 c0                	test   %eax,%eax
+    10a5:	78 21                	js     10c8 <thread_join+0x38>
+    10a7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+    10a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ac:	83 ec 0c             	sub    $0xc,%esp
+    10af:	ff 70 fc             	push   -0x4(%eax)
+    10b2:	e8 e9 fd ff ff       	call   ea0 <free>
+  return pid;
+    10b7:	83 c4 10             	add    $0x10,%esp
+}
+    10ba:	89 d8                	mov    %ebx,%eax
+    10bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10bf:	c9                   	leave
+    10c0:	c3                   	ret
+    10c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+    10c8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    10cd:	eb eb                	jmp    10ba <thread_join+0x2a>
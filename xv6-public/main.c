@@ -11,14 +11,52 @@ static void mpmain(void)  __attribute__((noreturn));
 extern pde_t *kpgdir;
 extern char end[]; // first address after kernel loaded from ELF file
 
+// Boot-phase timestamps, printed once the console is up.
+#define NBOOTPHASE 8
+
+static struct {
+  char *name;
+  uint64 tsc;     // rdtsc() at the end of the phase
+} bootphase[NBOOTPHASE];
+static int nbootphase;
+
+static void
+bootmark(char *name)
+{
+  if(nbootphase < NBOOTPHASE){
+    bootphase[nbootphase].name = name;
+    bootphase[nbootphase].tsc = rdtsc();
+    nbootphase++;
+  }
+}
+
+// Print the microseconds spent in each boot phase, using the
+// TSC rate that lapicinit() measured.
+static void
+bootreport(void)
+{
+  int i;
+
+  cprintf("boot:");
+  for(i = 1; i < nbootphase; i++)
+    cprintf(" %s %d", bootphase[i].name,
+            tscmhz ? (uint)(bootphase[i].tsc - bootphase[i-1].tsc) / tscmhz : 0);
+  cprintf(" (us; tsc %d MHz, %d Hz tick)\n", tscmhz, HZ);
+}
+
 // Bootstrap processor starts running C code here.
 // Allocate a real stack and switch to it, first
 // doing some setup required for memory allocator to work.
 int
 main(void)
 {
+  bootmark("start");
+  physmeminit();   // detect physical memory
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  bootmark("kinit1");
   kvmalloc();      // kernel page table
+  pgeinit();       // global kernel mappings
+  bootmark("kvmalloc");
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
   seginit();       // segment descriptors
@@ -26,14 +64,28 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // console hardware
   uartinit();      // serial port
+  bootmark("devices");
+  slabinit();      // kernel object caches
   pinit();         // process table
   tvinit();        // trap vectors
   binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  icacheinit();    // inode cache
+  excacheinit();   // exec image cache
+  futexinit();     // futex wait table
+  vdsoinit();      // user-readable clock page
+  aioinit();       // asynchronous I/O
+  systraceinit();  // system call tracing
   ideinit();       // disk 
+  bootmark("tables");
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  bootmark("startothers");
+  kinit2(P2V(4*1024*1024), P2V(phystop)); // must come after startothers()
+  bootmark("kinit2");
   userinit();      // first user process
+  bootmark("userinit");
+  bootreport();
   mpmain();        // finish this processor's setup
 }
 
@@ -42,6 +94,7 @@ static void
 mpenter(void)
 {
   switchkvm();
+  pgeinit();
   seginit();
   lapicinit();
   mpmain();
@@ -0,0 +1,38 @@
+// Print kernel memory statistics.
+// Call sites are return addresses in the kernel;
+// look them up in kernel.asm.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "memstat.h"
+
+struct memstat st;
+
+int
+main(int argc, char *argv[])
+{
+  int i;
+
+  if(memstat(&st) < 0){
+    printf(2, "memstat: memstat failed\n");
+    exit();
+  }
+
+  printf(1, "pages: %d total, %d free, %d in use, %d peak\n",
+         st.npages, st.nfree, st.npages - st.nfree, st.peak);
+  printf(1, "calls: %d allocs, %d frees\n", st.nalloc, st.nfreed);
+  printf(1, "free blocks by order:");
+  for(i = 0; i < MEMSTAT_NORDER; i++)
+    printf(1, " %d", st.hist[i]);
+  printf(1, "\n");
+  printf(1, "call site   allocs   frees\n");
+  for(i = 0; i < MEMSTAT_NSITE; i++){
+    if(st.site[i].pc == 0)
+      continue;
+    printf(1, "%x  %d  %d\n", st.site[i].pc, st.site[i].allocs,
+           st.site[i].frees);
+  }
+  exit();
+}
@@ -0,0 +1,21 @@
+// Kernel memory statistics, returned by the memstat() system call.
+// Needs param.h.
+
+#define MEMSTAT_NSITE  32              // call sites tracked
+#define MEMSTAT_NORDER (KMAXORDER+1)   // orders of free blocks
+
+struct memstatsite {
+  uint pc;        // return address of the kalloc()/kfree() call; 0 if unused
+  uint allocs;    // allocations made from pc
+  uint frees;     // frees made from pc
+};
+
+struct memstat {
+  uint npages;    // pages managed by the allocator
+  uint nfree;     // pages free now
+  uint peak;      // most pages seen in use at once (sampled)
+  uint nalloc;    // allocations so far
+  uint nfreed;    // frees so far
+  int hist[MEMSTAT_NORDER];                // free blocks of each order
+  struct memstatsite site[MEMSTAT_NSITE];  // per call site counts
+};
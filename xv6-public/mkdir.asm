@@ -0,0 +1,2020 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: mkdir files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(mkdir(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 d5 06 00 00       	call   719 <mkdir>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 27 0e 00 00       	push   $0xe27
+  53:	6a 02                	push   $0x2
+  55:	e8 d6 09 00 00       	call   a30 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 65 05 00 00       	call   5c7 <exit>
+    printf(2, "Usage: mkdir files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 10 0e 00 00       	push   $0xe10
+  69:	6a 02                	push   $0x2
+  6b:	e8 c0 09 00 00       	call   a30 <printf>
+    exit();
+  70:	e8 52 05 00 00       	call   5c7 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 58 04 00 00       	call   615 <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 85 04 00 00       	call   697 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 be 04 00 00       	call   6e5 <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 18 04 00 00       	call   649 <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2cc:	5d                   	pop    %ebp
+ 2cd:	c3                   	ret
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 2d0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 2d1:	31 c0                	xor    %eax,%eax
+ 2d3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2d8:	89 e5                	mov    %esp,%ebp
+ 2da:	56                   	push   %esi
+ 2db:	53                   	push   %ebx
+ 2dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 2e3:	85 c0                	test   %eax,%eax
+ 2e5:	74 32                	je     319 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 2e7:	83 f8 02             	cmp    $0x2,%eax
+ 2ea:	74 0c                	je     2f8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 2ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 2f4:	85 c0                	test   %eax,%eax
+ 2f6:	74 21                	je     319 <mutex_lock+0x49>
+ 2f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 02                	push   $0x2
+ 305:	6a 00                	push   $0x0
+ 307:	53                   	push   %ebx
+ 308:	e8 2a 05 00 00       	call   837 <futex>
+ 30d:	89 f0                	mov    %esi,%eax
+ 30f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	75 e7                	jne    300 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 319:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 31c:	5b                   	pop    %ebx
+ 31d:	5e                   	pop    %esi
+ 31e:	5d                   	pop    %ebp
+ 31f:	c3                   	ret
+
+00000320 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 320:	55                   	push   %ebp
+ 321:	31 c0                	xor    %eax,%eax
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 32e:	83 f8 02             	cmp    $0x2,%eax
+ 331:	74 05                	je     338 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+ 335:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 338:	83 ec 04             	sub    $0x4,%esp
+ 33b:	6a 01                	push   $0x1
+ 33d:	6a 01                	push   $0x1
+ 33f:	52                   	push   %edx
+ 340:	e8 f2 04 00 00       	call   837 <futex>
+ 345:	83 c4 10             	add    $0x10,%esp
+}
+ 348:	c9                   	leave
+ 349:	c3                   	ret
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000350 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 35c:	5d                   	pop    %ebp
+ 35d:	c3                   	ret
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 360:	55                   	push   %ebp
+ 361:	31 c0                	xor    %eax,%eax
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	57                   	push   %edi
+ 366:	56                   	push   %esi
+ 367:	53                   	push   %ebx
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 36e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 371:	8b 3e                	mov    (%esi),%edi
+ 373:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 376:	83 f8 02             	cmp    $0x2,%eax
+ 379:	74 5d                	je     3d8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 37b:	83 ec 04             	sub    $0x4,%esp
+ 37e:	57                   	push   %edi
+ 37f:	6a 00                	push   $0x0
+ 381:	56                   	push   %esi
+ 382:	e8 b0 04 00 00       	call   837 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 387:	31 c0                	xor    %eax,%eax
+ 389:	ba 01 00 00 00       	mov    $0x1,%edx
+ 38e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	85 c0                	test   %eax,%eax
+ 397:	74 30                	je     3c9 <cond_wait+0x69>
+  if(c != 2)
+ 399:	83 f8 02             	cmp    $0x2,%eax
+ 39c:	74 0c                	je     3aa <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 39e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a3:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3a6:	85 c0                	test   %eax,%eax
+ 3a8:	74 1f                	je     3c9 <cond_wait+0x69>
+ 3aa:	be 02 00 00 00       	mov    $0x2,%esi
+ 3af:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 02                	push   $0x2
+ 3b5:	6a 00                	push   $0x0
+ 3b7:	53                   	push   %ebx
+ 3b8:	e8 7a 04 00 00       	call   837 <futex>
+ 3bd:	89 f0                	mov    %esi,%eax
+ 3bf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	75 e7                	jne    3b0 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 3c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3cc:	5b                   	pop    %ebx
+ 3cd:	5e                   	pop    %esi
+ 3ce:	5f                   	pop    %edi
+ 3cf:	5d                   	pop    %ebp
+ 3d0:	c3                   	ret
+ 3d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3d8:	83 ec 04             	sub    $0x4,%esp
+ 3db:	6a 01                	push   $0x1
+ 3dd:	6a 01                	push   $0x1
+ 3df:	53                   	push   %ebx
+ 3e0:	e8 52 04 00 00       	call   837 <futex>
+ 3e5:	83 c4 10             	add    $0x10,%esp
+ 3e8:	eb 91                	jmp    37b <cond_wait+0x1b>
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	83 ec 04             	sub    $0x4,%esp
+ 3f7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 3fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 400:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 402:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 405:	89 c8                	mov    %ecx,%eax
+ 407:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 40b:	39 c1                	cmp    %eax,%ecx
+ 40d:	75 f1                	jne    400 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 40f:	83 ec 04             	sub    $0x4,%esp
+ 412:	6a 01                	push   $0x1
+ 414:	6a 01                	push   $0x1
+ 416:	52                   	push   %edx
+ 417:	e8 1b 04 00 00       	call   837 <futex>
+}
+ 41c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41f:	83 c4 10             	add    $0x10,%esp
+ 422:	c9                   	leave
+ 423:	c3                   	ret
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	53                   	push   %ebx
+ 434:	83 ec 04             	sub    $0x4,%esp
+ 437:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 440:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 442:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 445:	89 c8                	mov    %ecx,%eax
+ 447:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 44b:	39 c1                	cmp    %eax,%ecx
+ 44d:	75 f1                	jne    440 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 44f:	83 ec 04             	sub    $0x4,%esp
+ 452:	6a 40                	push   $0x40
+ 454:	6a 01                	push   $0x1
+ 456:	52                   	push   %edx
+ 457:	e8 db 03 00 00       	call   837 <futex>
+}
+ 45c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 45f:	83 c4 10             	add    $0x10,%esp
+ 462:	c9                   	leave
+ 463:	c3                   	ret
+ 464:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 470:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 475:	c3                   	ret
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000480 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 480:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 485:	85 c0                	test   %eax,%eax
+ 487:	74 07                	je     490 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 489:	c3                   	ret
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 490:	e9 d2 02 00 00       	jmp    767 <getpid>
+ 495:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 4a9:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 4ab:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 4b1:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4b7:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4bc:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4c2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 4ca:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4d0:	29 d9                	sub    %ebx,%ecx
+ 4d2:	89 c6                	mov    %eax,%esi
+ 4d4:	89 d7                	mov    %edx,%edi
+ 4d6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 4d9:	d3 e6                	shl    %cl,%esi
+ 4db:	31 c0                	xor    %eax,%eax
+ 4dd:	f6 c1 20             	test   $0x20,%cl
+ 4e0:	0f 45 fe             	cmovne %esi,%edi
+ 4e3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4e6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 4e9:	89 d9                	mov    %ebx,%ecx
+ 4eb:	31 db                	xor    %ebx,%ebx
+ 4ed:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4f3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 4f6:	d3 ea                	shr    %cl,%edx
+ 4f8:	f6 c1 20             	test   $0x20,%cl
+ 4fb:	0f 45 c2             	cmovne %edx,%eax
+ 4fe:	0f 45 d3             	cmovne %ebx,%edx
+ 501:	01 f0                	add    %esi,%eax
+ 503:	11 fa                	adc    %edi,%edx
+}
+ 505:	83 c4 0c             	add    $0xc,%esp
+ 508:	5b                   	pop    %ebx
+ 509:	5e                   	pop    %esi
+ 50a:	5f                   	pop    %edi
+ 50b:	5d                   	pop    %ebp
+ 50c:	c3                   	ret
+ 50d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000510 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+ 515:	53                   	push   %ebx
+ 516:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 519:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 51d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 520:	74 0e                	je     530 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 522:	83 c4 1c             	add    $0x1c,%esp
+ 525:	5b                   	pop    %ebx
+ 526:	5e                   	pop    %esi
+ 527:	5f                   	pop    %edi
+ 528:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 529:	e9 a5 03 00 00       	jmp    8d3 <clock_gettime>
+ 52e:	66 90                	xchg   %ax,%ax
+ 530:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 532:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 538:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 53e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 543:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 546:	89 d0                	mov    %edx,%eax
+ 548:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 54b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 551:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 557:	89 c6                	mov    %eax,%esi
+ 559:	89 d7                	mov    %edx,%edi
+ 55b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 55e:	d3 e6                	shl    %cl,%esi
+ 560:	31 c0                	xor    %eax,%eax
+ 562:	f6 c1 20             	test   $0x20,%cl
+ 565:	0f 45 fe             	cmovne %esi,%edi
+ 568:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 56b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 56e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 575:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 57b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 57e:	d3 ea                	shr    %cl,%edx
+ 580:	f6 c1 20             	test   $0x20,%cl
+ 583:	74 04                	je     589 <vclock_gettime+0x79>
+ 585:	89 d0                	mov    %edx,%eax
+ 587:	31 d2                	xor    %edx,%edx
+ 589:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 58b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 590:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 592:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 594:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 596:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 598:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 59e:	29 c1                	sub    %eax,%ecx
+}
+ 5a0:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 5a2:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 5a5:	83 c4 1c             	add    $0x1c,%esp
+ 5a8:	5b                   	pop    %ebx
+ 5a9:	5e                   	pop    %esi
+ 5aa:	5f                   	pop    %edi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+
+000005ad <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 5ad:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5b2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5b9:	74 09                	je     5c4 <fork+0x17>
+ 5bb:	89 e1                	mov    %esp,%ecx
+ 5bd:	ba c6 05 00 00       	mov    $0x5c6,%edx
+ 5c2:	0f 34                	sysenter
+ 5c4:	cd 40                	int    $0x40
+ 5c6:	c3                   	ret
+
+000005c7 <exit>:
+SYSCALL(exit)
+ 5c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5cc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5d3:	74 09                	je     5de <exit+0x17>
+ 5d5:	89 e1                	mov    %esp,%ecx
+ 5d7:	ba e0 05 00 00       	mov    $0x5e0,%edx
+ 5dc:	0f 34                	sysenter
+ 5de:	cd 40                	int    $0x40
+ 5e0:	c3                   	ret
+
+000005e1 <wait>:
+SYSCALL(wait)
+ 5e1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5e6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5ed:	74 09                	je     5f8 <wait+0x17>
+ 5ef:	89 e1                	mov    %esp,%ecx
+ 5f1:	ba fa 05 00 00       	mov    $0x5fa,%edx
+ 5f6:	0f 34                	sysenter
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <pipe>:
+SYSCALL(pipe)
+ 5fb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 600:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 607:	74 09                	je     612 <pipe+0x17>
+ 609:	89 e1                	mov    %esp,%ecx
+ 60b:	ba 14 06 00 00       	mov    $0x614,%edx
+ 610:	0f 34                	sysenter
+ 612:	cd 40                	int    $0x40
+ 614:	c3                   	ret
+
+00000615 <read>:
+SYSCALL(read)
+ 615:	b8 05 00 00 00       	mov    $0x5,%eax
+ 61a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 621:	74 09                	je     62c <read+0x17>
+ 623:	89 e1                	mov    %esp,%ecx
+ 625:	ba 2e 06 00 00       	mov    $0x62e,%edx
+ 62a:	0f 34                	sysenter
+ 62c:	cd 40                	int    $0x40
+ 62e:	c3                   	ret
+
+0000062f <write>:
+SYSCALL(write)
+ 62f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 634:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 63b:	74 09                	je     646 <write+0x17>
+ 63d:	89 e1                	mov    %esp,%ecx
+ 63f:	ba 48 06 00 00       	mov    $0x648,%edx
+ 644:	0f 34                	sysenter
+ 646:	cd 40                	int    $0x40
+ 648:	c3                   	ret
+
+00000649 <close>:
+SYSCALL(close)
+ 649:	b8 15 00 00 00       	mov    $0x15,%eax
+ 64e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 655:	74 09                	je     660 <close+0x17>
+ 657:	89 e1                	mov    %esp,%ecx
+ 659:	ba 62 06 00 00       	mov    $0x662,%edx
+ 65e:	0f 34                	sysenter
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <kill>:
+SYSCALL(kill)
+ 663:	b8 06 00 00 00       	mov    $0x6,%eax
+ 668:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 66f:	74 09                	je     67a <kill+0x17>
+ 671:	89 e1                	mov    %esp,%ecx
+ 673:	ba 7c 06 00 00       	mov    $0x67c,%edx
+ 678:	0f 34                	sysenter
+ 67a:	cd 40                	int    $0x40
+ 67c:	c3                   	ret
+
+0000067d <exec>:
+SYSCALL(exec)
+ 67d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 682:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 689:	74 09                	je     694 <exec+0x17>
+ 68b:	89 e1                	mov    %esp,%ecx
+ 68d:	ba 96 06 00 00       	mov    $0x696,%edx
+ 692:	0f 34                	sysenter
+ 694:	cd 40                	int    $0x40
+ 696:	c3                   	ret
+
+00000697 <open>:
+SYSCALL(open)
+ 697:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 69c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a3:	74 09                	je     6ae <open+0x17>
+ 6a5:	89 e1                	mov    %esp,%ecx
+ 6a7:	ba b0 06 00 00       	mov    $0x6b0,%edx
+ 6ac:	0f 34                	sysenter
+ 6ae:	cd 40                	int    $0x40
+ 6b0:	c3                   	ret
+
+000006b1 <mknod>:
+SYSCALL(mknod)
+ 6b1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6bd:	74 09                	je     6c8 <mknod+0x17>
+ 6bf:	89 e1                	mov    %esp,%ecx
+ 6c1:	ba ca 06 00 00       	mov    $0x6ca,%edx
+ 6c6:	0f 34                	sysenter
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <unlink>:
+SYSCALL(unlink)
+ 6cb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6d0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6d7:	74 09                	je     6e2 <unlink+0x17>
+ 6d9:	89 e1                	mov    %esp,%ecx
+ 6db:	ba e4 06 00 00       	mov    $0x6e4,%edx
+ 6e0:	0f 34                	sysenter
+ 6e2:	cd 40                	int    $0x40
+ 6e4:	c3                   	ret
+
+000006e5 <fstat>:
+SYSCALL(fstat)
+ 6e5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6ea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f1:	74 09                	je     6fc <fstat+0x17>
+ 6f3:	89 e1                	mov    %esp,%ecx
+ 6f5:	ba fe 06 00 00       	mov    $0x6fe,%edx
+ 6fa:	0f 34                	sysenter
+ 6fc:	cd 40                	int    $0x40
+ 6fe:	c3                   	ret
+
+000006ff <link>:
+SYSCALL(link)
+ 6ff:	b8 13 00 00 00       	mov    $0x13,%eax
+ 704:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 70b:	74 09                	je     716 <link+0x17>
+ 70d:	89 e1                	mov    %esp,%ecx
+ 70f:	ba 18 07 00 00       	mov    $0x718,%edx
+ 714:	0f 34                	sysenter
+ 716:	cd 40                	int    $0x40
+ 718:	c3                   	ret
+
+00000719 <mkdir>:
+SYSCALL(mkdir)
+ 719:	b8 14 00 00 00       	mov    $0x14,%eax
+ 71e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 725:	74 09                	je     730 <mkdir+0x17>
+ 727:	89 e1                	mov    %esp,%ecx
+ 729:	ba 32 07 00 00       	mov    $0x732,%edx
+ 72e:	0f 34                	sysenter
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <chdir>:
+SYSCALL(chdir)
+ 733:	b8 09 00 00 00       	mov    $0x9,%eax
+ 738:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 73f:	74 09                	je     74a <chdir+0x17>
+ 741:	89 e1                	mov    %esp,%ecx
+ 743:	ba 4c 07 00 00       	mov    $0x74c,%edx
+ 748:	0f 34                	sysenter
+ 74a:	cd 40                	int    $0x40
+ 74c:	c3                   	ret
+
+0000074d <dup>:
+SYSCALL(dup)
+ 74d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 752:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 759:	74 09                	je     764 <dup+0x17>
+ 75b:	89 e1                	mov    %esp,%ecx
+ 75d:	ba 66 07 00 00       	mov    $0x766,%edx
+ 762:	0f 34                	sysenter
+ 764:	cd 40                	int    $0x40
+ 766:	c3                   	ret
+
+00000767 <getpid>:
+SYSCALL(getpid)
+ 767:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 76c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 773:	74 09                	je     77e <getpid+0x17>
+ 775:	89 e1                	mov    %esp,%ecx
+ 777:	ba 80 07 00 00       	mov    $0x780,%edx
+ 77c:	0f 34                	sysenter
+ 77e:	cd 40                	int    $0x40
+ 780:	c3                   	ret
+
+00000781 <sbrk>:
+SYSCALL(sbrk)
+ 781:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 786:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 78d:	74 09                	je     798 <sbrk+0x17>
+ 78f:	89 e1                	mov    %esp,%ecx
+ 791:	ba 9a 07 00 00       	mov    $0x79a,%edx
+ 796:	0f 34                	sysenter
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+
+0000079b <sleep>:
+SYSCALL(sleep)
+ 79b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a7:	74 09                	je     7b2 <sleep+0x17>
+ 7a9:	89 e1                	mov    %esp,%ecx
+ 7ab:	ba b4 07 00 00       	mov    $0x7b4,%edx
+ 7b0:	0f 34                	sysenter
+ 7b2:	cd 40                	int    $0x40
+ 7b4:	c3                   	ret
+
+000007b5 <uptime>:
+SYSCALL(uptime)
+ 7b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c1:	74 09                	je     7cc <uptime+0x17>
+ 7c3:	89 e1                	mov    %esp,%ecx
+ 7c5:	ba ce 07 00 00       	mov    $0x7ce,%edx
+ 7ca:	0f 34                	sysenter
+ 7cc:	cd 40                	int    $0x40
+ 7ce:	c3                   	ret
+
+000007cf <mmap>:
+SYSCALL(mmap)
+ 7cf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7db:	74 09                	je     7e6 <mmap+0x17>
+ 7dd:	89 e1                	mov    %esp,%ecx
+ 7df:	ba e8 07 00 00       	mov    $0x7e8,%edx
+ 7e4:	0f 34                	sysenter
+ 7e6:	cd 40                	int    $0x40
+ 7e8:	c3                   	ret
+
+000007e9 <munmap>:
+SYSCALL(munmap)
+ 7e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f5:	74 09                	je     800 <munmap+0x17>
+ 7f7:	89 e1                	mov    %esp,%ecx
+ 7f9:	ba 02 08 00 00       	mov    $0x802,%edx
+ 7fe:	0f 34                	sysenter
+ 800:	cd 40                	int    $0x40
+ 802:	c3                   	ret
+
+00000803 <clone>:
+SYSCALL(clone)
+ 803:	b8 18 00 00 00       	mov    $0x18,%eax
+ 808:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 80f:	74 09                	je     81a <clone+0x17>
+ 811:	89 e1                	mov    %esp,%ecx
+ 813:	ba 1c 08 00 00       	mov    $0x81c,%edx
+ 818:	0f 34                	sysenter
+ 81a:	cd 40                	int    $0x40
+ 81c:	c3                   	ret
+
+0000081d <join>:
+SYSCALL(join)
+ 81d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 822:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 829:	74 09                	je     834 <join+0x17>
+ 82b:	89 e1                	mov    %esp,%ecx
+ 82d:	ba 36 08 00 00       	mov    $0x836,%edx
+ 832:	0f 34                	sysenter
+ 834:	cd 40                	int    $0x40
+ 836:	c3                   	ret
+
+00000837 <futex>:
+SYSCALL(futex)
+ 837:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 83c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 843:	74 09                	je     84e <futex+0x17>
+ 845:	89 e1                	mov    %esp,%ecx
+ 847:	ba 50 08 00 00       	mov    $0x850,%edx
+ 84c:	0f 34                	sysenter
+ 84e:	cd 40                	int    $0x40
+ 850:	c3                   	ret
+
+00000851 <memstat>:
+SYSCALL(memstat)
+ 851:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 856:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 85d:	74 09                	je     868 <memstat+0x17>
+ 85f:	89 e1                	mov    %esp,%ecx
+ 861:	ba 6a 08 00 00       	mov    $0x86a,%edx
+ 866:	0f 34                	sysenter
+ 868:	cd 40                	int    $0x40
+ 86a:	c3                   	ret
+
+0000086b <nice>:
+SYSCALL(nice)
+ 86b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 870:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 877:	74 09                	je     882 <nice+0x17>
+ 879:	89 e1                	mov    %esp,%ecx
+ 87b:	ba 84 08 00 00       	mov    $0x884,%edx
+ 880:	0f 34                	sysenter
+ 882:	cd 40                	int    $0x40
+ 884:	c3                   	ret
+
+00000885 <setpriority>:
+SYSCALL(setpriority)
+ 885:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 88a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 891:	74 09                	je     89c <setpriority+0x17>
+ 893:	89 e1                	mov    %esp,%ecx
+ 895:	ba 9e 08 00 00       	mov    $0x89e,%edx
+ 89a:	0f 34                	sysenter
+ 89c:	cd 40                	int    $0x40
+ 89e:	c3                   	ret
+
+0000089f <getpinfo>:
+SYSCALL(getpinfo)
+ 89f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8ab:	74 09                	je     8b6 <getpinfo+0x17>
+ 8ad:	89 e1                	mov    %esp,%ecx
+ 8af:	ba b8 08 00 00       	mov    $0x8b8,%edx
+ 8b4:	0f 34                	sysenter
+ 8b6:	cd 40                	int    $0x40
+ 8b8:	c3                   	ret
+
+000008b9 <settickets>:
+SYSCALL(settickets)
+ 8b9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c5:	74 09                	je     8d0 <settickets+0x17>
+ 8c7:	89 e1                	mov    %esp,%ecx
+ 8c9:	ba d2 08 00 00       	mov    $0x8d2,%edx
+ 8ce:	0f 34                	sysenter
+ 8d0:	cd 40                	int    $0x40
+ 8d2:	c3                   	ret
+
+000008d3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 8d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8df:	74 09                	je     8ea <clock_gettime+0x17>
+ 8e1:	89 e1                	mov    %esp,%ecx
+ 8e3:	ba ec 08 00 00       	mov    $0x8ec,%edx
+ 8e8:	0f 34                	sysenter
+ 8ea:	cd 40                	int    $0x40
+ 8ec:	c3                   	ret
+
+000008ed <batch>:
+SYSCALL(batch)
+ 8ed:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f9:	74 09                	je     904 <batch+0x17>
+ 8fb:	89 e1                	mov    %esp,%ecx
+ 8fd:	ba 06 09 00 00       	mov    $0x906,%edx
+ 902:	0f 34                	sysenter
+ 904:	cd 40                	int    $0x40
+ 906:	c3                   	ret
+
+00000907 <aiosetup>:
+SYSCALL(aiosetup)
+ 907:	b8 22 00 00 00       	mov    $0x22,%eax
+ 90c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 913:	74 09                	je     91e <aiosetup+0x17>
+ 915:	89 e1                	mov    %esp,%ecx
+ 917:	ba 20 09 00 00       	mov    $0x920,%edx
+ 91c:	0f 34                	sysenter
+ 91e:	cd 40                	int    $0x40
+ 920:	c3                   	ret
+
+00000921 <aioenter>:
+SYSCALL(aioenter)
+ 921:	b8 23 00 00 00       	mov    $0x23,%eax
+ 926:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 92d:	74 09                	je     938 <aioenter+0x17>
+ 92f:	89 e1                	mov    %esp,%ecx
+ 931:	ba 3a 09 00 00       	mov    $0x93a,%edx
+ 936:	0f 34                	sysenter
+ 938:	cd 40                	int    $0x40
+ 93a:	c3                   	ret
+
+0000093b <systrace>:
+SYSCALL(systrace)
+ 93b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 940:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 947:	74 09                	je     952 <systrace+0x17>
+ 949:	89 e1                	mov    %esp,%ecx
+ 94b:	ba 54 09 00 00       	mov    $0x954,%edx
+ 950:	0f 34                	sysenter
+ 952:	cd 40                	int    $0x40
+ 954:	c3                   	ret
+
+00000955 <sysstat>:
+SYSCALL(sysstat)
+ 955:	b8 25 00 00 00       	mov    $0x25,%eax
+ 95a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 961:	74 09                	je     96c <sysstat+0x17>
+ 963:	89 e1                	mov    %esp,%ecx
+ 965:	ba 6e 09 00 00       	mov    $0x96e,%edx
+ 96a:	0f 34                	sysenter
+ 96c:	cd 40                	int    $0x40
+ 96e:	c3                   	ret
+
+0000096f <traceread>:
+SYSCALL(traceread)
+ 96f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 974:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 97b:	74 09                	je     986 <traceread+0x17>
+ 97d:	89 e1                	mov    %esp,%ecx
+ 97f:	ba 88 09 00 00       	mov    $0x988,%edx
+ 984:	0f 34                	sysenter
+ 986:	cd 40                	int    $0x40
+ 988:	c3                   	ret
+ 989:	66 90                	xchg   %ax,%ax
+ 98b:	66 90                	xchg   %ax,%ax
+ 98d:	66 90                	xchg   %ax,%ax
+ 98f:	90                   	nop
+
+00000990 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 998:	89 d1                	mov    %edx,%ecx
+{
+ 99a:	83 ec 3c             	sub    $0x3c,%esp
+ 99d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9a0:	85 d2                	test   %edx,%edx
+ 9a2:	0f 89 80 00 00 00    	jns    a28 <printint+0x98>
+ 9a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9ac:	74 7a                	je     a28 <printint+0x98>
+    x = -xx;
+ 9ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9b8:	31 f6                	xor    %esi,%esi
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9c0:	89 c8                	mov    %ecx,%eax
+ 9c2:	31 d2                	xor    %edx,%edx
+ 9c4:	89 f7                	mov    %esi,%edi
+ 9c6:	f7 f3                	div    %ebx
+ 9c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9cb:	0f b6 92 a4 0e 00 00 	movzbl 0xea4(%edx),%edx
+ 9d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9d6:	89 ca                	mov    %ecx,%edx
+ 9d8:	89 c1                	mov    %eax,%ecx
+ 9da:	39 da                	cmp    %ebx,%edx
+ 9dc:	73 e2                	jae    9c0 <printint+0x30>
+  if(neg)
+ 9de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9e1:	85 c0                	test   %eax,%eax
+ 9e3:	74 07                	je     9ec <printint+0x5c>
+    buf[i++] = '-';
+ 9e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9ea:	89 f7                	mov    %esi,%edi
+ 9ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9f2:	01 df                	add    %ebx,%edi
+ 9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9fb:	83 ec 04             	sub    $0x4,%esp
+ 9fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a04:	6a 01                	push   $0x1
+ a06:	50                   	push   %eax
+ a07:	56                   	push   %esi
+ a08:	e8 22 fc ff ff       	call   62f <write>
+  while(--i >= 0)
+ a0d:	89 f8                	mov    %edi,%eax
+ a0f:	83 c4 10             	add    $0x10,%esp
+ a12:	83 ef 01             	sub    $0x1,%edi
+ a15:	39 d8                	cmp    %ebx,%eax
+ a17:	75 df                	jne    9f8 <printint+0x68>
+}
+ a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a1c:	5b                   	pop    %ebx
+ a1d:	5e                   	pop    %esi
+ a1e:	5f                   	pop    %edi
+ a1f:	5d                   	pop    %ebp
+ a20:	c3                   	ret
+ a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a28:	31 c0                	xor    %eax,%eax
+ a2a:	eb 89                	jmp    9b5 <printint+0x25>
+ a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a3f:	0f b6 1e             	movzbl (%esi),%ebx
+ a42:	83 c6 01             	add    $0x1,%esi
+ a45:	84 db                	test   %bl,%bl
+ a47:	74 67                	je     ab0 <printf+0x80>
+ a49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a4c:	31 d2                	xor    %edx,%edx
+ a4e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a51:	eb 34                	jmp    a87 <printf+0x57>
+ a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a57:	90                   	nop
+ a58:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a5b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a60:	83 f8 25             	cmp    $0x25,%eax
+ a63:	74 18                	je     a7d <printf+0x4d>
+  write(fd, &c, 1);
+ a65:	83 ec 04             	sub    $0x4,%esp
+ a68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a6b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a6e:	6a 01                	push   $0x1
+ a70:	50                   	push   %eax
+ a71:	57                   	push   %edi
+ a72:	e8 b8 fb ff ff       	call   62f <write>
+ a77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a7d:	0f b6 1e             	movzbl (%esi),%ebx
+ a80:	83 c6 01             	add    $0x1,%esi
+ a83:	84 db                	test   %bl,%bl
+ a85:	74 29                	je     ab0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a87:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a8a:	85 d2                	test   %edx,%edx
+ a8c:	74 ca                	je     a58 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a8e:	83 fa 25             	cmp    $0x25,%edx
+ a91:	75 ea                	jne    a7d <printf+0x4d>
+      if(c == 'd'){
+ a93:	83 f8 25             	cmp    $0x25,%eax
+ a96:	0f 84 24 01 00 00    	je     bc0 <printf+0x190>
+ a9c:	83 e8 63             	sub    $0x63,%eax
+ a9f:	83 f8 15             	cmp    $0x15,%eax
+ aa2:	77 1c                	ja     ac0 <printf+0x90>
+ aa4:	ff 24 85 4c 0e 00 00 	jmp    *0xe4c(,%eax,4)
+ aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aaf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ab3:	5b                   	pop    %ebx
+ ab4:	5e                   	pop    %esi
+ ab5:	5f                   	pop    %edi
+ ab6:	5d                   	pop    %ebp
+ ab7:	c3                   	ret
+ ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abf:	90                   	nop
+  write(fd, &c, 1);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ac6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aca:	6a 01                	push   $0x1
+ acc:	52                   	push   %edx
+ acd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ad0:	57                   	push   %edi
+ ad1:	e8 59 fb ff ff       	call   62f <write>
+ ad6:	83 c4 0c             	add    $0xc,%esp
+ ad9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ adc:	6a 01                	push   $0x1
+ ade:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ ae1:	52                   	push   %edx
+ ae2:	57                   	push   %edi
+ ae3:	e8 47 fb ff ff       	call   62f <write>
+        putc(fd, c);
+ ae8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aeb:	31 d2                	xor    %edx,%edx
+ aed:	eb 8e                	jmp    a7d <printf+0x4d>
+ aef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ af0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ af3:	83 ec 0c             	sub    $0xc,%esp
+ af6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ afb:	8b 13                	mov    (%ebx),%edx
+ afd:	6a 00                	push   $0x0
+ aff:	89 f8                	mov    %edi,%eax
+        ap++;
+ b01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b04:	e8 87 fe ff ff       	call   990 <printint>
+        ap++;
+ b09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b0f:	31 d2                	xor    %edx,%edx
+ b11:	e9 67 ff ff ff       	jmp    a7d <printf+0x4d>
+ b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b25:	83 c0 04             	add    $0x4,%eax
+ b28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b2b:	85 db                	test   %ebx,%ebx
+ b2d:	0f 84 9d 00 00 00    	je     bd0 <printf+0x1a0>
+        while(*s != 0){
+ b33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b38:	84 c0                	test   %al,%al
+ b3a:	0f 84 3d ff ff ff    	je     a7d <printf+0x4d>
+ b40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b46:	89 de                	mov    %ebx,%esi
+ b48:	89 d3                	mov    %edx,%ebx
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b50:	83 ec 04             	sub    $0x4,%esp
+ b53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b59:	6a 01                	push   $0x1
+ b5b:	53                   	push   %ebx
+ b5c:	57                   	push   %edi
+ b5d:	e8 cd fa ff ff       	call   62f <write>
+        while(*s != 0){
+ b62:	0f b6 06             	movzbl (%esi),%eax
+ b65:	83 c4 10             	add    $0x10,%esp
+ b68:	84 c0                	test   %al,%al
+ b6a:	75 e4                	jne    b50 <printf+0x120>
+      state = 0;
+ b6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b6f:	31 d2                	xor    %edx,%edx
+ b71:	e9 07 ff ff ff       	jmp    a7d <printf+0x4d>
+ b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b83:	83 ec 0c             	sub    $0xc,%esp
+ b86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b8b:	8b 13                	mov    (%ebx),%edx
+ b8d:	6a 01                	push   $0x1
+ b8f:	e9 6b ff ff ff       	jmp    aff <printf+0xcf>
+ b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b9b:	83 ec 04             	sub    $0x4,%esp
+ b9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ba1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ba3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ba6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ba9:	6a 01                	push   $0x1
+ bab:	52                   	push   %edx
+ bac:	57                   	push   %edi
+ bad:	e8 7d fa ff ff       	call   62f <write>
+        ap++;
+ bb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bb5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bb8:	31 d2                	xor    %edx,%edx
+ bba:	e9 be fe ff ff       	jmp    a7d <printf+0x4d>
+ bbf:	90                   	nop
+  write(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bc6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bc9:	6a 01                	push   $0x1
+ bcb:	e9 11 ff ff ff       	jmp    ae1 <printf+0xb1>
+ bd0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bd5:	bb 43 0e 00 00       	mov    $0xe43,%ebx
+ bda:	e9 61 ff ff ff       	jmp    b40 <printf+0x110>
+ bdf:	90                   	nop
+
+00000be0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ be0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ be1:	a1 40 13 00 00       	mov    0x1340,%eax
+{
+ be6:	89 e5                	mov    %esp,%ebp
+ be8:	57                   	push   %edi
+ be9:	56                   	push   %esi
+ bea:	53                   	push   %ebx
+ beb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bfc:	39 ca                	cmp    %ecx,%edx
+ bfe:	73 30                	jae    c30 <free+0x50>
+ c00:	39 c1                	cmp    %eax,%ecx
+ c02:	72 04                	jb     c08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c04:	39 c2                	cmp    %eax,%edx
+ c06:	72 f0                	jb     bf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c0e:	39 f8                	cmp    %edi,%eax
+ c10:	74 2e                	je     c40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c15:	8b 42 04             	mov    0x4(%edx),%eax
+ c18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c1b:	39 f1                	cmp    %esi,%ecx
+ c1d:	74 38                	je     c57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c21:	5b                   	pop    %ebx
+  freep = p;
+ c22:	89 15 40 13 00 00    	mov    %edx,0x1340
+}
+ c28:	5e                   	pop    %esi
+ c29:	5f                   	pop    %edi
+ c2a:	5d                   	pop    %ebp
+ c2b:	c3                   	ret
+ c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c30:	39 c1                	cmp    %eax,%ecx
+ c32:	72 d0                	jb     c04 <free+0x24>
+ c34:	eb c2                	jmp    bf8 <free+0x18>
+ c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c40:	03 70 04             	add    0x4(%eax),%esi
+ c43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c46:	8b 02                	mov    (%edx),%eax
+ c48:	8b 00                	mov    (%eax),%eax
+ c4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c4d:	8b 42 04             	mov    0x4(%edx),%eax
+ c50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c53:	39 f1                	cmp    %esi,%ecx
+ c55:	75 c8                	jne    c1f <free+0x3f>
+    p->s.size += bp->s.size;
+ c57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c5a:	89 15 40 13 00 00    	mov    %edx,0x1340
+    p->s.size += bp->s.size;
+ c60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c66:	89 0a                	mov    %ecx,(%edx)
+}
+ c68:	5b                   	pop    %ebx
+ c69:	5e                   	pop    %esi
+ c6a:	5f                   	pop    %edi
+ c6b:	5d                   	pop    %ebp
+ c6c:	c3                   	ret
+ c6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	57                   	push   %edi
+ c74:	56                   	push   %esi
+ c75:	53                   	push   %ebx
+ c76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c7c:	8b 15 40 13 00 00    	mov    0x1340,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c82:	8d 78 07             	lea    0x7(%eax),%edi
+ c85:	c1 ef 03             	shr    $0x3,%edi
+ c88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c8b:	85 d2                	test   %edx,%edx
+ c8d:	0f 84 8d 00 00 00    	je     d20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c95:	8b 48 04             	mov    0x4(%eax),%ecx
+ c98:	39 f9                	cmp    %edi,%ecx
+ c9a:	73 64                	jae    d00 <malloc+0x90>
+  if(nu < 4096)
+ c9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ca1:	39 df                	cmp    %ebx,%edi
+ ca3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ca6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ cad:	eb 0a                	jmp    cb9 <malloc+0x49>
+ caf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb5:	39 f9                	cmp    %edi,%ecx
+ cb7:	73 47                	jae    d00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cb9:	89 c2                	mov    %eax,%edx
+ cbb:	39 05 40 13 00 00    	cmp    %eax,0x1340
+ cc1:	75 ed                	jne    cb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ cc3:	83 ec 0c             	sub    $0xc,%esp
+ cc6:	56                   	push   %esi
+ cc7:	e8 b5 fa ff ff       	call   781 <sbrk>
+  if(p == (char*)-1)
+ ccc:	83 c4 10             	add    $0x10,%esp
+ ccf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cd2:	74 1c                	je     cf0 <malloc+0x80>
+  hp->s.size = nu;
+ cd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cd7:	83 ec 0c             	sub    $0xc,%esp
+ cda:	83 c0 08             	add    $0x8,%eax
+ cdd:	50                   	push   %eax
+ cde:	e8 fd fe ff ff       	call   be0 <free>
+  return freep;
+ ce3:	8b 15 40 13 00 00    	mov    0x1340,%edx
+      if((p = morecore(nunits)) == 0)
+ ce9:	83 c4 10             	add    $0x10,%esp
+ cec:	85 d2                	test   %edx,%edx
+ cee:	75 c0                	jne    cb0 <malloc+0x40>
+        return 0;
+  }
+}
+ cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cf3:	31 c0                	xor    %eax,%eax
+}
+ cf5:	5b                   	pop    %ebx
+ cf6:	5e                   	pop    %esi
+ cf7:	5f                   	pop    %edi
+ cf8:	5d                   	pop    %ebp
+ cf9:	c3                   	ret
+ cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d00:	39 cf                	cmp    %ecx,%edi
+ d02:	74 4c                	je     d50 <malloc+0xe0>
+        p->s.size -= nunits;
+ d04:	29 f9                	sub    %edi,%ecx
+ d06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d0f:	89 15 40 13 00 00    	mov    %edx,0x1340
+}
+ d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d18:	83 c0 08             	add    $0x8,%eax
+}
+ d1b:	5b                   	pop    %ebx
+ d1c:	5e                   	pop    %esi
+ d1d:	5f                   	pop    %edi
+ d1e:	5d                   	pop    %ebp
+ d1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d20:	c7 05 40 13 00 00 44 	movl   $0x1344,0x1340
+ d27:	13 00 00 
+    base.s.size = 0;
+ d2a:	b8 44 13 00 00       	mov    $0x1344,%eax
+    base.s.ptr = freep = prevp = &base;
+ d2f:	c7 05 44 13 00 00 44 	movl   $0x1344,0x1344
+ d36:	13 00 00 
+    base.s.size = 0;
+ d39:	c7 05 48 13 00 00 00 	movl   $0x0,0x1348
+ d40:	00 00 00 
+    if(p->s.size >= nunits){
+ d43:	e9 54 ff ff ff       	jmp    c9c <malloc+0x2c>
+ d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d50:	8b 08                	mov    (%eax),%ecx
+ d52:	89 0a                	mov    %ecx,(%edx)
+ d54:	eb b9                	jmp    d0f <malloc+0x9f>
+ d56:	66 90                	xchg   %ax,%ax
+ d58:	66 90                	xchg   %ax,%ax
+ d5a:	66 90                	xchg   %ax,%ax
+ d5c:	66 90                	xchg   %ax,%ax
+ d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d60:	55                   	push   %ebp
+ d61:	89 e5                	mov    %esp,%ebp
+ d63:	53                   	push   %ebx
+ d64:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ d67:	68 00 20 00 00       	push   $0x2000
+ d6c:	e8 ff fe ff ff       	call   c70 <malloc>
+ d71:	83 c4 10             	add    $0x10,%esp
+ d74:	85 c0                	test   %eax,%eax
+ d76:	74 47                	je     dbf <thread_create+0x5f>
+ d78:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d7a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ d80:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d83:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ d88:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ d8b:	ff 75 0c             	push   0xc(%ebp)
+ d8e:	50                   	push   %eax
+ d8f:	ff 75 08             	push   0x8(%ebp)
+ d92:	e8 6c fa ff ff       	call   803 <clone>
+ d97:	83 c4 10             	add    $0x10,%esp
+ d9a:	85 c0                	test   %eax,%eax
+ d9c:	78 0a                	js     da8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ d9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ da1:	c9                   	leave
+ da2:	c3                   	ret
+ da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ da7:	90                   	nop
+    free(mem);
+ da8:	83 ec 0c             	sub    $0xc,%esp
+ dab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dae:	53                   	push   %ebx
+ daf:	e8 2c fe ff ff       	call   be0 <free>
+ db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ db7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ dba:	83 c4 10             	add    $0x10,%esp
+}
+ dbd:	c9                   	leave
+ dbe:	c3                   	ret
+    return -1;
+ dbf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ dc4:	eb d8                	jmp    d9e <thread_create+0x3e>
+ dc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000dd0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ dd0:	55                   	push   %ebp
+ dd1:	89 e5                	mov    %esp,%ebp
+ dd3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ dd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ dd7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ dda:	50                   	push   %eax
+ ddb:	e8 3d fa ff ff       	call   81d <join>
+ de0:	83 c4 10             	add    $0x10,%esp
+ de3:	85 c0                	test   %eax,%eax
+ de5:	78 21                	js     e08 <thread_join+0x38>
+ de7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ de9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dec:	83 ec 0c             	sub    $0xc,%esp
+ def:	ff 70 fc             	push   -0x4(%eax)
+ df2:	e8 e9 fd ff ff       	call   be0 <free>
+  return pid;
+ df7:	83 c4 10             	add    $0x10,%esp
+}
+ dfa:	89 d8                	mov    %ebx,%eax
+ dfc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ dff:	c9                   	leave
+ e00:	c3                   	ret
+ e01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ e08:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ e0d:	eb eb                	jmp    dfa <thread_join+0x2a>
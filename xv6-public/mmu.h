@@ -10,6 +10,16 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
+
+// CPUID.1:EDX feature flags
+#define CPUID_SEP       0x00000800      // sysenter/sysexit supported
+#define CPUID_PGE       0x00002000      // Global pages supported
+
+// Model-specific registers
+#define MSR_SYSENTER_CS  0x174          // kernel %cs for sysenter
+#define MSR_SYSENTER_ESP 0x175          // kernel %esp for sysenter
+#define MSR_SYSENTER_EIP 0x176          // kernel entry point
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -95,6 +105,7 @@ struct segdesc {
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: not flushed by lcr3
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
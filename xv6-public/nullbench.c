@@ -0,0 +1,50 @@
+// Null system call microbenchmark.
+// Times N getpid() calls through the usys.S stub, which uses
+// sysenter when the CPU has it, and N more through int $T_SYSCALL,
+// the old path, and prints the cost of each in nanoseconds.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "x86.h"
+#include "syscall.h"
+#include "traps.h"
+#include "vdso.h"
+
+#define N  100000
+
+static int
+intgetpid(void)
+{
+  int ret;
+
+  asm volatile("int %1" : "=a" (ret) : "i" (T_SYSCALL), "a" (SYS_getpid)
+               : "memory");
+  return ret;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+  uint64 t0, t1, t2;
+
+  n = N;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n <= 0)
+    n = 1;
+
+  t0 = vnsecs();
+  for(i = 0; i < n; i++)
+    getpid();
+  t1 = vnsecs();
+  for(i = 0; i < n; i++)
+    intgetpid();
+  t2 = vnsecs();
+
+  printf(1, "nullbench: %d calls, stub (%s) %d ns, int %d ns\n", n,
+         ((struct vdso*)VDSO)->sysenter ? "sysenter" : "int",
+         divl(t1 - t0, n), divl(t2 - t1, n));
+  exit();
+}
@@ -123,7 +123,87 @@ class test15(Xv6Test):
    point_value = 1
    failure_pattern = 'Segmentation Fault'
 
+class test16(Xv6Test):
+   name = "test_16"
+   description = "Threads from clone() share globals and mmap memory; join() reaps them"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=2"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test17(Xv6Test):
+   name = "test_17"
+   description = "futex-based mutex and condvar across threads; futex in MAP_SHARED memory across fork"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=2"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test18(Xv6Test):
+   name = "test_18"
+   description = "MLFQ: CPU-bound child is demoted; nice(), setpriority() and getpinfo()"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=1"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test19(Xv6Test):
+   name = "test_19"
+   description = "clock_gettime(CLOCK_MONOTONIC) advances with real time across sleep()"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=1"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test20(Xv6Test):
+   name = "test_20"
+   description = "vdso page: vgetpid() in processes and threads, vuptime() and vclock_gettime(); munmap refused"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=2"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test21(Xv6Test):
+   name = "test_21"
+   description = "batch() runs open/write/close in one call; BATCH_STOPERR; fork refused"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=1"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test22(Xv6Test):
+   name = "test_22"
+   description = "aio rings: writes then fsync, many reads outstanding, bad fd, shared with threads, not unmappable"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=2"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test23(Xv6Test):
+   name = "test_23"
+   description = "syscall counts and latency histograms; tracing a child into the ring"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=2"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
+
+class test24(Xv6Test):
+   name = "test_24"
+   description = "inherited MAP_SHARED mapping survives a child whose thread exits before it"
+   tester = "ctests/" + name + ".c"
+   make_qemu_args = "CPUS=1"
+   point_value = 1
+   failure_pattern = 'Segmentation Fault'
+
 
 import toolspath
 from testing.runtests import main
-main(Xv6Build, all_tests=[test1, test2, test3, test4, test5, test6, test7, test8, test9, test10, test11, test12, test13, test14, test15])
+main(Xv6Build, all_tests=[test1, test2, test3, test4, test5, test6, test7, test8, test9, test10, test11, test12, test13, test14, test15, test16, test17, test18, test19, test20, test21, test22, test23, test24])
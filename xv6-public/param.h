@@ -2,13 +2,20 @@
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NFILE      1024  // open files per system (a cap on slab memory)
+#define NINODE       50  // in-memory inodes kept once unreferenced
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
 #define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
 #define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define FSSIZE       2000  // size of file system in blocks
 #define MAX_MMAPS    32  // max number of mmaps
+#define NEXECCACHE    8  // number of cached exec images
+#define EXECCACHEPGS 32  // max pages in one cached exec image
+#define KMAXORDER    10  // largest kalloc_order() block is 2^10 pages (4MB)
+#define NMLFQ         4  // scheduler priority levels
+#ifndef HZ
+#define HZ          100  // timer interrupts per second
+#endif
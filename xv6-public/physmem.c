@@ -0,0 +1,163 @@
+// Physical memory detection.
+//
+// If the kernel was started by a multiboot loader (GRUB, or
+// qemu -kernel), entry.S saves the loader's magic number and info
+// pointer, and the loader's memory map lists the usable ranges.
+// Otherwise (the xv6 boot block, which has no room to ask the BIOS
+// for its E820 map) the memory size comes from the CMOS, where the
+// BIOS records it at power-on.
+//
+// Memory above PHYSLIMIT cannot be mapped at KERNBASE and is
+// ignored.  phystop, the end of the kernel's direct map, is
+// rounded up to a 4MB boundary so the map can use large pages;
+// only the usable ranges are ever given to the allocator.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+
+#define MB_MAGIC     0x2BADB002  // multiboot loader's magic in %eax
+#define MB_INFO_MEM  (1<<0)      // mem_lower, mem_upper valid
+#define MB_INFO_MMAP (1<<6)      // mmap_length, mmap_addr valid
+#define MB_MMAP_RAM  1           // usable memory
+
+// Multiboot information structure (as much of it as we use).
+struct mbinfo {
+  uint flags;
+  uint mem_lower;     // KB below 1MB
+  uint mem_upper;     // KB above 1MB
+  uint boot_device;
+  uint cmdline;
+  uint mods_count;
+  uint mods_addr;
+  uint syms[4];
+  uint mmap_length;
+  uint mmap_addr;
+};
+
+// Multiboot memory map entry; size excludes the size field itself.
+struct mbmmap {
+  uint size;
+  uint addr_lo, addr_hi;
+  uint len_lo, len_hi;
+  uint type;
+};
+
+#define NMEMRANGE 16
+
+uint mbmagic;          // set by entry.S
+uint mbinfopa;         // set by entry.S
+uint phystop;          // end of the kernel's direct map of physical memory
+
+static struct {
+  uint start;
+  uint end;
+} memrange[NMEMRANGE];
+static int nmemrange;
+
+static void
+addrange(uint start, uint end)
+{
+  if(end > PHYSLIMIT)
+    end = PHYSLIMIT;
+  start = PGROUNDUP(start);
+  end = PGROUNDDOWN(end);
+  if(start >= end || nmemrange == NMEMRANGE)
+    return;
+  memrange[nmemrange].start = start;
+  memrange[nmemrange].end = end;
+  nmemrange++;
+  if(end > phystop)
+    phystop = end;
+}
+
+// Only addresses below 4MB are mapped this early (see entrypgdir).
+static int
+mbreadable(uint pa, uint n)
+{
+  return pa + n >= pa && pa + n <= 4*1024*1024;
+}
+
+static int
+mbdetect(void)
+{
+  struct mbinfo *mb;
+  struct mbmmap *e;
+  uint p, end;
+
+  if(mbmagic != MB_MAGIC || !mbreadable(mbinfopa, sizeof(*mb)))
+    return -1;
+  mb = P2V(mbinfopa);
+  if((mb->flags & MB_INFO_MMAP) && mbreadable(mb->mmap_addr, mb->mmap_length)){
+    end = mb->mmap_addr + mb->mmap_length;
+    for(p = mb->mmap_addr; p < end; p += e->size + sizeof(e->size)){
+      e = P2V(p);
+      if(e->type != MB_MMAP_RAM || e->addr_hi != 0)
+        continue;
+      if(e->len_hi != 0 || e->addr_lo + e->len_lo < e->addr_lo)
+        addrange(e->addr_lo, PHYSLIMIT);
+      else
+        addrange(e->addr_lo, e->addr_lo + e->len_lo);
+    }
+    if(nmemrange > 0)
+      return 0;
+  }
+  if(mb->flags & MB_INFO_MEM){
+    addrange(0, mb->mem_lower * 1024);
+    addrange(EXTMEM, EXTMEM + mb->mem_upper * 1024);
+    return 0;
+  }
+  return -1;
+}
+
+static uint
+cmosread(uint reg)
+{
+  outb(0x70, reg);
+  return inb(0x71);
+}
+
+// CMOS 0x30/0x31: KB of extended memory above 1MB (at most 63MB).
+// CMOS 0x34/0x35: 64KB blocks above 16MB (QEMU and most BIOSes).
+static void
+cmosdetect(void)
+{
+  uint ext, ext16;
+
+  ext = cmosread(0x30) | cmosread(0x31) << 8;
+  ext16 = cmosread(0x34) | cmosread(0x35) << 8;
+  addrange(0, 640*1024);
+  if(ext16)
+    addrange(EXTMEM, 16*1024*1024 + ext16 * 64*1024);
+  else
+    addrange(EXTMEM, EXTMEM + ext * 1024);
+}
+
+// Find usable physical memory and set phystop.
+// Must run before kinit1(), while entrypgdir is in use.
+void
+physmeminit(void)
+{
+  if(mbdetect() < 0)
+    cmosdetect();
+  if(phystop < 4*1024*1024)
+    panic("physmeminit: too little memory");
+  phystop = (phystop + (1<<PDXSHIFT) - 1) & ~((1<<PDXSHIFT) - 1);
+  if(phystop > PHYSLIMIT)
+    phystop = PHYSLIMIT;
+}
+
+// Return in *start and *end the i'th usable range of
+// physical memory.  Returns -1 if there is no such range.
+int
+physmemrange(int i, uint *start, uint *end)
+{
+  if(i < 0 || i >= nmemrange)
+    return -1;
+  *start = memrange[i].start;
+  *end = memrange[i].end;
+  return 0;
+}
@@ -0,0 +1,2251 @@
+
+_pingpong:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define N  10000
+#define S  32
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+  struct timespec start, end;
+  int ping[2], pong[2], idle[2];
+  char c;
+
+  n = N;
+  s = S;
+   e:	bf 20 00 00 00       	mov    $0x20,%edi
+{
+  13:	56                   	push   %esi
+  n = N;
+  14:	be 10 27 00 00       	mov    $0x2710,%esi
+{
+  19:	53                   	push   %ebx
+  1a:	51                   	push   %ecx
+  1b:	83 ec 48             	sub    $0x48,%esp
+  1e:	8b 19                	mov    (%ecx),%ebx
+  20:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 1)
+  23:	83 fb 01             	cmp    $0x1,%ebx
+  26:	0f 8f de 00 00 00    	jg     10a <main+0x10a>
+    n = atoi(argv[1]);
+  if(argc > 2)
+    s = atoi(argv[2]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0 || pipe(idle) < 0){
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  32:	50                   	push   %eax
+  33:	e8 93 07 00 00       	call   7cb <pipe>
+  38:	83 c4 10             	add    $0x10,%esp
+  3b:	85 c0                	test   %eax,%eax
+  3d:	78 13                	js     52 <main+0x52>
+  3f:	83 ec 0c             	sub    $0xc,%esp
+  42:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  45:	50                   	push   %eax
+  46:	e8 80 07 00 00       	call   7cb <pipe>
+  4b:	83 c4 10             	add    $0x10,%esp
+  4e:	85 c0                	test   %eax,%eax
+  50:	79 14                	jns    66 <main+0x66>
+    printf(2, "pingpong: pipe failed\n");
+  52:	83 ec 08             	sub    $0x8,%esp
+  55:	68 e0 0f 00 00       	push   $0xfe0
+  5a:	6a 02                	push   $0x2
+  5c:	e8 9f 0b 00 00       	call   c00 <printf>
+    exit();
+  61:	e8 31 07 00 00       	call   797 <exit>
+  if(pipe(ping) < 0 || pipe(pong) < 0 || pipe(idle) < 0){
+  66:	83 ec 0c             	sub    $0xc,%esp
+  69:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  6c:	50                   	push   %eax
+  6d:	e8 59 07 00 00       	call   7cb <pipe>
+  72:	83 c4 10             	add    $0x10,%esp
+  75:	85 c0                	test   %eax,%eax
+  77:	78 d9                	js     52 <main+0x52>
+  }
+
+  // Sleepers: block in read until idle's write end is closed.
+  for(i = 0; i < s; i++){
+  79:	31 db                	xor    %ebx,%ebx
+  7b:	85 ff                	test   %edi,%edi
+  7d:	7f 1a                	jg     99 <main+0x99>
+  7f:	e9 db 00 00 00       	jmp    15f <main+0x15f>
+  84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid < 0){
+      printf(2, "pingpong: fork failed after %d sleepers\n", i);
+      s = i;
+      break;
+    }
+    if(pid == 0){
+  88:	0f 84 b0 00 00 00    	je     13e <main+0x13e>
+  for(i = 0; i < s; i++){
+  8e:	83 c3 01             	add    $0x1,%ebx
+  91:	39 df                	cmp    %ebx,%edi
+  93:	0f 84 c6 00 00 00    	je     15f <main+0x15f>
+    pid = fork();
+  99:	e8 df 06 00 00       	call   77d <fork>
+    if(pid < 0){
+  9e:	85 c0                	test   %eax,%eax
+  a0:	79 e6                	jns    88 <main+0x88>
+      printf(2, "pingpong: fork failed after %d sleepers\n", i);
+  a2:	57                   	push   %edi
+  a3:	53                   	push   %ebx
+  a4:	68 28 10 00 00       	push   $0x1028
+  a9:	6a 02                	push   $0x2
+  ab:	e8 50 0b 00 00       	call   c00 <printf>
+      break;
+  b0:	83 c4 10             	add    $0x10,%esp
+      close(idle[1]);
+      read(idle[0], &c, 1);
+      exit();
+    }
+  }
+  close(idle[0]);
+  b3:	83 ec 0c             	sub    $0xc,%esp
+  b6:	ff 75 e0             	push   -0x20(%ebp)
+  b9:	e8 5b 07 00 00       	call   819 <close>
+
+  pid = fork();
+  be:	e8 ba 06 00 00       	call   77d <fork>
+  if(pid < 0){
+  c3:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+  c6:	89 c7                	mov    %eax,%edi
+  if(pid < 0){
+  c8:	85 c0                	test   %eax,%eax
+  ca:	0f 88 96 00 00 00    	js     166 <main+0x166>
+    printf(2, "pingpong: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+  d0:	0f 85 a3 00 00 00    	jne    179 <main+0x179>
+    for(i = 0; i < n; i++){
+      if(read(ping[0], &c, 1) != 1)
+  d6:	8d 5d bf             	lea    -0x41(%ebp),%ebx
+  d9:	eb 26                	jmp    101 <main+0x101>
+  db:	52                   	push   %edx
+  dc:	6a 01                	push   $0x1
+  de:	53                   	push   %ebx
+  df:	ff 75 d0             	push   -0x30(%ebp)
+  e2:	e8 fe 06 00 00       	call   7e5 <read>
+  e7:	83 c4 10             	add    $0x10,%esp
+  ea:	83 e8 01             	sub    $0x1,%eax
+  ed:	75 16                	jne    105 <main+0x105>
+        break;
+      write(pong[1], &c, 1);
+  ef:	50                   	push   %eax
+    for(i = 0; i < n; i++){
+  f0:	83 c7 01             	add    $0x1,%edi
+      write(pong[1], &c, 1);
+  f3:	6a 01                	push   $0x1
+  f5:	53                   	push   %ebx
+  f6:	ff 75 dc             	push   -0x24(%ebp)
+  f9:	e8 01 07 00 00       	call   7ff <write>
+    for(i = 0; i < n; i++){
+  fe:	83 c4 10             	add    $0x10,%esp
+ 101:	39 fe                	cmp    %edi,%esi
+ 103:	7f d6                	jg     db <main+0xdb>
+  while(wait() >= 0)
+    ;
+
+  printf(1, "pingpong: %d round trips with %d sleepers in %d us, "
+         "%d ns each\n", i, s, us, i ? us / i * 1000 + us % i * 1000 / i : 0);
+  exit();
+ 105:	e8 8d 06 00 00       	call   797 <exit>
+    n = atoi(argv[1]);
+ 10a:	83 ec 0c             	sub    $0xc,%esp
+ 10d:	ff 72 04             	push   0x4(%edx)
+ 110:	89 55 b4             	mov    %edx,-0x4c(%ebp)
+ 113:	e8 08 03 00 00       	call   420 <atoi>
+  if(argc > 2)
+ 118:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+ 11b:	89 c6                	mov    %eax,%esi
+  if(argc > 2)
+ 11d:	83 fb 02             	cmp    $0x2,%ebx
+ 120:	0f 84 06 ff ff ff    	je     2c <main+0x2c>
+    s = atoi(argv[2]);
+ 126:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+ 129:	83 ec 0c             	sub    $0xc,%esp
+ 12c:	ff 72 08             	push   0x8(%edx)
+ 12f:	e8 ec 02 00 00       	call   420 <atoi>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	89 c7                	mov    %eax,%edi
+ 139:	e9 ee fe ff ff       	jmp    2c <main+0x2c>
+      close(idle[1]);
+ 13e:	83 ec 0c             	sub    $0xc,%esp
+ 141:	ff 75 e4             	push   -0x1c(%ebp)
+ 144:	e8 d0 06 00 00       	call   819 <close>
+      read(idle[0], &c, 1);
+ 149:	83 c4 0c             	add    $0xc,%esp
+ 14c:	8d 45 bf             	lea    -0x41(%ebp),%eax
+ 14f:	6a 01                	push   $0x1
+ 151:	50                   	push   %eax
+ 152:	ff 75 e0             	push   -0x20(%ebp)
+ 155:	e8 8b 06 00 00       	call   7e5 <read>
+      exit();
+ 15a:	e8 38 06 00 00       	call   797 <exit>
+  for(i = 0; i < s; i++){
+ 15f:	89 fb                	mov    %edi,%ebx
+ 161:	e9 4d ff ff ff       	jmp    b3 <main+0xb3>
+    printf(2, "pingpong: fork failed\n");
+ 166:	51                   	push   %ecx
+ 167:	51                   	push   %ecx
+ 168:	68 f7 0f 00 00       	push   $0xff7
+ 16d:	6a 02                	push   $0x2
+ 16f:	e8 8c 0a 00 00       	call   c00 <printf>
+    exit();
+ 174:	e8 1e 06 00 00       	call   797 <exit>
+  c = 'x';
+ 179:	c6 45 bf 78          	movb   $0x78,-0x41(%ebp)
+  for(i = 0; i < n; i++){
+ 17d:	31 ff                	xor    %edi,%edi
+  clock_gettime(CLOCK_MONOTONIC, &start);
+ 17f:	50                   	push   %eax
+ 180:	50                   	push   %eax
+ 181:	8d 45 c0             	lea    -0x40(%ebp),%eax
+ 184:	50                   	push   %eax
+ 185:	6a 01                	push   $0x1
+ 187:	e8 17 09 00 00       	call   aa3 <clock_gettime>
+  for(i = 0; i < n; i++){
+ 18c:	83 c4 10             	add    $0x10,%esp
+ 18f:	eb 2b                	jmp    1bc <main+0x1bc>
+    write(ping[1], &c, 1);
+ 191:	50                   	push   %eax
+ 192:	8d 45 bf             	lea    -0x41(%ebp),%eax
+ 195:	6a 01                	push   $0x1
+ 197:	50                   	push   %eax
+ 198:	ff 75 d4             	push   -0x2c(%ebp)
+ 19b:	e8 5f 06 00 00       	call   7ff <write>
+    if(read(pong[0], &c, 1) != 1){
+ 1a0:	83 c4 0c             	add    $0xc,%esp
+ 1a3:	8d 45 bf             	lea    -0x41(%ebp),%eax
+ 1a6:	6a 01                	push   $0x1
+ 1a8:	50                   	push   %eax
+ 1a9:	ff 75 d8             	push   -0x28(%ebp)
+ 1ac:	e8 34 06 00 00       	call   7e5 <read>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+ 1b4:	83 e8 01             	sub    $0x1,%eax
+ 1b7:	75 7d                	jne    236 <main+0x236>
+  for(i = 0; i < n; i++){
+ 1b9:	83 c7 01             	add    $0x1,%edi
+ 1bc:	39 fe                	cmp    %edi,%esi
+ 1be:	7f d1                	jg     191 <main+0x191>
+  clock_gettime(CLOCK_MONOTONIC, &end);
+ 1c0:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 1c3:	51                   	push   %ecx
+ 1c4:	51                   	push   %ecx
+ 1c5:	50                   	push   %eax
+ 1c6:	6a 01                	push   $0x1
+ 1c8:	e8 d6 08 00 00       	call   aa3 <clock_gettime>
+       ((int)end.tv_nsec - (int)start.tv_nsec) / 1000;
+ 1cd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 1d0:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+ 1d3:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+ 1d8:	99                   	cltd
+  us = (end.tv_sec - start.tv_sec) * 1000000 +
+ 1d9:	8b 75 c8             	mov    -0x38(%ebp),%esi
+ 1dc:	2b 75 c0             	sub    -0x40(%ebp),%esi
+       ((int)end.tv_nsec - (int)start.tv_nsec) / 1000;
+ 1df:	f7 f9                	idiv   %ecx
+  us = (end.tv_sec - start.tv_sec) * 1000000 +
+ 1e1:	69 f6 40 42 0f 00    	imul   $0xf4240,%esi,%esi
+ 1e7:	01 c6                	add    %eax,%esi
+  close(idle[1]);
+ 1e9:	58                   	pop    %eax
+ 1ea:	ff 75 e4             	push   -0x1c(%ebp)
+ 1ed:	e8 27 06 00 00       	call   819 <close>
+  while(wait() >= 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	e8 b7 05 00 00       	call   7b1 <wait>
+ 1fa:	85 c0                	test   %eax,%eax
+ 1fc:	79 f7                	jns    1f5 <main+0x1f5>
+  printf(1, "pingpong: %d round trips with %d sleepers in %d us, "
+ 1fe:	31 c0                	xor    %eax,%eax
+ 200:	85 ff                	test   %edi,%edi
+ 202:	74 18                	je     21c <main+0x21c>
+ 204:	89 f0                	mov    %esi,%eax
+ 206:	99                   	cltd
+ 207:	f7 ff                	idiv   %edi
+ 209:	89 c1                	mov    %eax,%ecx
+         "%d ns each\n", i, s, us, i ? us / i * 1000 + us % i * 1000 / i : 0);
+ 20b:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+ 211:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+ 217:	99                   	cltd
+ 218:	f7 ff                	idiv   %edi
+  printf(1, "pingpong: %d round trips with %d sleepers in %d us, "
+ 21a:	01 c8                	add    %ecx,%eax
+ 21c:	52                   	push   %edx
+ 21d:	52                   	push   %edx
+ 21e:	50                   	push   %eax
+ 21f:	56                   	push   %esi
+ 220:	53                   	push   %ebx
+ 221:	57                   	push   %edi
+ 222:	68 54 10 00 00       	push   $0x1054
+ 227:	6a 01                	push   $0x1
+ 229:	e8 d2 09 00 00       	call   c00 <printf>
+  exit();
+ 22e:	83 c4 20             	add    $0x20,%esp
+ 231:	e9 cf fe ff ff       	jmp    105 <main+0x105>
+      printf(2, "pingpong: read failed\n");
+ 236:	50                   	push   %eax
+ 237:	50                   	push   %eax
+ 238:	68 0e 10 00 00       	push   $0x100e
+ 23d:	6a 02                	push   $0x2
+ 23f:	e8 bc 09 00 00       	call   c00 <printf>
+      break;
+ 244:	83 c4 10             	add    $0x10,%esp
+ 247:	e9 74 ff ff ff       	jmp    1c0 <main+0x1c0>
+ 24c:	66 90                	xchg   %ax,%ax
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 58 04 00 00       	call   7e5 <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 85 04 00 00       	call   867 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 be 04 00 00       	call   8b5 <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 18 04 00 00       	call   819 <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 49c:	5d                   	pop    %ebp
+ 49d:	c3                   	ret
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 4a0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 4a1:	31 c0                	xor    %eax,%eax
+ 4a3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 4a8:	89 e5                	mov    %esp,%ebp
+ 4aa:	56                   	push   %esi
+ 4ab:	53                   	push   %ebx
+ 4ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4af:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 4b3:	85 c0                	test   %eax,%eax
+ 4b5:	74 32                	je     4e9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 4b7:	83 f8 02             	cmp    $0x2,%eax
+ 4ba:	74 0c                	je     4c8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 4bc:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 4c4:	85 c0                	test   %eax,%eax
+ 4c6:	74 21                	je     4e9 <mutex_lock+0x49>
+ 4c8:	be 02 00 00 00       	mov    $0x2,%esi
+ 4cd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 02                	push   $0x2
+ 4d5:	6a 00                	push   $0x0
+ 4d7:	53                   	push   %ebx
+ 4d8:	e8 2a 05 00 00       	call   a07 <futex>
+ 4dd:	89 f0                	mov    %esi,%eax
+ 4df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 4e2:	83 c4 10             	add    $0x10,%esp
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	75 e7                	jne    4d0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 4e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4ec:	5b                   	pop    %ebx
+ 4ed:	5e                   	pop    %esi
+ 4ee:	5d                   	pop    %ebp
+ 4ef:	c3                   	ret
+
+000004f0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	31 c0                	xor    %eax,%eax
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	83 ec 08             	sub    $0x8,%esp
+ 4f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4fb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 4fe:	83 f8 02             	cmp    $0x2,%eax
+ 501:	74 05                	je     508 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 503:	c9                   	leave
+ 504:	c3                   	ret
+ 505:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 508:	83 ec 04             	sub    $0x4,%esp
+ 50b:	6a 01                	push   $0x1
+ 50d:	6a 01                	push   $0x1
+ 50f:	52                   	push   %edx
+ 510:	e8 f2 04 00 00       	call   a07 <futex>
+ 515:	83 c4 10             	add    $0x10,%esp
+}
+ 518:	c9                   	leave
+ 519:	c3                   	ret
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000520 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 523:	8b 45 08             	mov    0x8(%ebp),%eax
+ 526:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 52c:	5d                   	pop    %ebp
+ 52d:	c3                   	ret
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 530:	55                   	push   %ebp
+ 531:	31 c0                	xor    %eax,%eax
+ 533:	89 e5                	mov    %esp,%ebp
+ 535:	57                   	push   %edi
+ 536:	56                   	push   %esi
+ 537:	53                   	push   %ebx
+ 538:	83 ec 0c             	sub    $0xc,%esp
+ 53b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 53e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 541:	8b 3e                	mov    (%esi),%edi
+ 543:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 546:	83 f8 02             	cmp    $0x2,%eax
+ 549:	74 5d                	je     5a8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	57                   	push   %edi
+ 54f:	6a 00                	push   $0x0
+ 551:	56                   	push   %esi
+ 552:	e8 b0 04 00 00       	call   a07 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 557:	31 c0                	xor    %eax,%eax
+ 559:	ba 01 00 00 00       	mov    $0x1,%edx
+ 55e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 562:	83 c4 10             	add    $0x10,%esp
+ 565:	85 c0                	test   %eax,%eax
+ 567:	74 30                	je     599 <cond_wait+0x69>
+  if(c != 2)
+ 569:	83 f8 02             	cmp    $0x2,%eax
+ 56c:	74 0c                	je     57a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 56e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 573:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 576:	85 c0                	test   %eax,%eax
+ 578:	74 1f                	je     599 <cond_wait+0x69>
+ 57a:	be 02 00 00 00       	mov    $0x2,%esi
+ 57f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 580:	83 ec 04             	sub    $0x4,%esp
+ 583:	6a 02                	push   $0x2
+ 585:	6a 00                	push   $0x0
+ 587:	53                   	push   %ebx
+ 588:	e8 7a 04 00 00       	call   a07 <futex>
+ 58d:	89 f0                	mov    %esi,%eax
+ 58f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 592:	83 c4 10             	add    $0x10,%esp
+ 595:	85 c0                	test   %eax,%eax
+ 597:	75 e7                	jne    580 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 59c:	5b                   	pop    %ebx
+ 59d:	5e                   	pop    %esi
+ 59e:	5f                   	pop    %edi
+ 59f:	5d                   	pop    %ebp
+ 5a0:	c3                   	ret
+ 5a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 5a8:	83 ec 04             	sub    $0x4,%esp
+ 5ab:	6a 01                	push   $0x1
+ 5ad:	6a 01                	push   $0x1
+ 5af:	53                   	push   %ebx
+ 5b0:	e8 52 04 00 00       	call   a07 <futex>
+ 5b5:	83 c4 10             	add    $0x10,%esp
+ 5b8:	eb 91                	jmp    54b <cond_wait+0x1b>
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005c0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	83 ec 04             	sub    $0x4,%esp
+ 5c7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 5d0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 5d2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 5d5:	89 c8                	mov    %ecx,%eax
+ 5d7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 5db:	39 c1                	cmp    %eax,%ecx
+ 5dd:	75 f1                	jne    5d0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 5df:	83 ec 04             	sub    $0x4,%esp
+ 5e2:	6a 01                	push   $0x1
+ 5e4:	6a 01                	push   $0x1
+ 5e6:	52                   	push   %edx
+ 5e7:	e8 1b 04 00 00       	call   a07 <futex>
+}
+ 5ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5ef:	83 c4 10             	add    $0x10,%esp
+ 5f2:	c9                   	leave
+ 5f3:	c3                   	ret
+ 5f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+
+00000600 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	53                   	push   %ebx
+ 604:	83 ec 04             	sub    $0x4,%esp
+ 607:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 610:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 612:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 615:	89 c8                	mov    %ecx,%eax
+ 617:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 61b:	39 c1                	cmp    %eax,%ecx
+ 61d:	75 f1                	jne    610 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 61f:	83 ec 04             	sub    $0x4,%esp
+ 622:	6a 40                	push   $0x40
+ 624:	6a 01                	push   $0x1
+ 626:	52                   	push   %edx
+ 627:	e8 db 03 00 00       	call   a07 <futex>
+}
+ 62c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	c9                   	leave
+ 633:	c3                   	ret
+ 634:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+
+00000640 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 640:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 645:	c3                   	ret
+ 646:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000650 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 650:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 655:	85 c0                	test   %eax,%eax
+ 657:	74 07                	je     660 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 659:	c3                   	ret
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 660:	e9 d2 02 00 00       	jmp    937 <getpid>
+ 665:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 679:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 67b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 681:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 687:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 68c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 692:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 695:	89 d0                	mov    %edx,%eax
+ 697:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 69a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 6a0:	29 d9                	sub    %ebx,%ecx
+ 6a2:	89 c6                	mov    %eax,%esi
+ 6a4:	89 d7                	mov    %edx,%edi
+ 6a6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 6a9:	d3 e6                	shl    %cl,%esi
+ 6ab:	31 c0                	xor    %eax,%eax
+ 6ad:	f6 c1 20             	test   $0x20,%cl
+ 6b0:	0f 45 fe             	cmovne %esi,%edi
+ 6b3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 6b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 6b9:	89 d9                	mov    %ebx,%ecx
+ 6bb:	31 db                	xor    %ebx,%ebx
+ 6bd:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 6c3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 6c6:	d3 ea                	shr    %cl,%edx
+ 6c8:	f6 c1 20             	test   $0x20,%cl
+ 6cb:	0f 45 c2             	cmovne %edx,%eax
+ 6ce:	0f 45 d3             	cmovne %ebx,%edx
+ 6d1:	01 f0                	add    %esi,%eax
+ 6d3:	11 fa                	adc    %edi,%edx
+}
+ 6d5:	83 c4 0c             	add    $0xc,%esp
+ 6d8:	5b                   	pop    %ebx
+ 6d9:	5e                   	pop    %esi
+ 6da:	5f                   	pop    %edi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 6e9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 6ed:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 6f0:	74 0e                	je     700 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 6f2:	83 c4 1c             	add    $0x1c,%esp
+ 6f5:	5b                   	pop    %ebx
+ 6f6:	5e                   	pop    %esi
+ 6f7:	5f                   	pop    %edi
+ 6f8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 6f9:	e9 a5 03 00 00       	jmp    aa3 <clock_gettime>
+ 6fe:	66 90                	xchg   %ax,%ax
+ 700:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 702:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 708:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 70e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 713:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 716:	89 d0                	mov    %edx,%eax
+ 718:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 71b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 721:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 727:	89 c6                	mov    %eax,%esi
+ 729:	89 d7                	mov    %edx,%edi
+ 72b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 72e:	d3 e6                	shl    %cl,%esi
+ 730:	31 c0                	xor    %eax,%eax
+ 732:	f6 c1 20             	test   $0x20,%cl
+ 735:	0f 45 fe             	cmovne %esi,%edi
+ 738:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 73b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 73e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 745:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 74b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 74e:	d3 ea                	shr    %cl,%edx
+ 750:	f6 c1 20             	test   $0x20,%cl
+ 753:	74 04                	je     759 <vclock_gettime+0x79>
+ 755:	89 d0                	mov    %edx,%eax
+ 757:	31 d2                	xor    %edx,%edx
+ 759:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 75b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 760:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 762:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 764:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 766:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 768:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 76e:	29 c1                	sub    %eax,%ecx
+}
+ 770:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 772:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 775:	83 c4 1c             	add    $0x1c,%esp
+ 778:	5b                   	pop    %ebx
+ 779:	5e                   	pop    %esi
+ 77a:	5f                   	pop    %edi
+ 77b:	5d                   	pop    %ebp
+ 77c:	c3                   	ret
+
+0000077d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 77d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 782:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 789:	74 09                	je     794 <fork+0x17>
+ 78b:	89 e1                	mov    %esp,%ecx
+ 78d:	ba 96 07 00 00       	mov    $0x796,%edx
+ 792:	0f 34                	sysenter
+ 794:	cd 40                	int    $0x40
+ 796:	c3                   	ret
+
+00000797 <exit>:
+SYSCALL(exit)
+ 797:	b8 02 00 00 00       	mov    $0x2,%eax
+ 79c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a3:	74 09                	je     7ae <exit+0x17>
+ 7a5:	89 e1                	mov    %esp,%ecx
+ 7a7:	ba b0 07 00 00       	mov    $0x7b0,%edx
+ 7ac:	0f 34                	sysenter
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <wait>:
+SYSCALL(wait)
+ 7b1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7b6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7bd:	74 09                	je     7c8 <wait+0x17>
+ 7bf:	89 e1                	mov    %esp,%ecx
+ 7c1:	ba ca 07 00 00       	mov    $0x7ca,%edx
+ 7c6:	0f 34                	sysenter
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <pipe>:
+SYSCALL(pipe)
+ 7cb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7d0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d7:	74 09                	je     7e2 <pipe+0x17>
+ 7d9:	89 e1                	mov    %esp,%ecx
+ 7db:	ba e4 07 00 00       	mov    $0x7e4,%edx
+ 7e0:	0f 34                	sysenter
+ 7e2:	cd 40                	int    $0x40
+ 7e4:	c3                   	ret
+
+000007e5 <read>:
+SYSCALL(read)
+ 7e5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7ea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f1:	74 09                	je     7fc <read+0x17>
+ 7f3:	89 e1                	mov    %esp,%ecx
+ 7f5:	ba fe 07 00 00       	mov    $0x7fe,%edx
+ 7fa:	0f 34                	sysenter
+ 7fc:	cd 40                	int    $0x40
+ 7fe:	c3                   	ret
+
+000007ff <write>:
+SYSCALL(write)
+ 7ff:	b8 10 00 00 00       	mov    $0x10,%eax
+ 804:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 80b:	74 09                	je     816 <write+0x17>
+ 80d:	89 e1                	mov    %esp,%ecx
+ 80f:	ba 18 08 00 00       	mov    $0x818,%edx
+ 814:	0f 34                	sysenter
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <close>:
+SYSCALL(close)
+ 819:	b8 15 00 00 00       	mov    $0x15,%eax
+ 81e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 825:	74 09                	je     830 <close+0x17>
+ 827:	89 e1                	mov    %esp,%ecx
+ 829:	ba 32 08 00 00       	mov    $0x832,%edx
+ 82e:	0f 34                	sysenter
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <kill>:
+SYSCALL(kill)
+ 833:	b8 06 00 00 00       	mov    $0x6,%eax
+ 838:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 83f:	74 09                	je     84a <kill+0x17>
+ 841:	89 e1                	mov    %esp,%ecx
+ 843:	ba 4c 08 00 00       	mov    $0x84c,%edx
+ 848:	0f 34                	sysenter
+ 84a:	cd 40                	int    $0x40
+ 84c:	c3                   	ret
+
+0000084d <exec>:
+SYSCALL(exec)
+ 84d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 852:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 859:	74 09                	je     864 <exec+0x17>
+ 85b:	89 e1                	mov    %esp,%ecx
+ 85d:	ba 66 08 00 00       	mov    $0x866,%edx
+ 862:	0f 34                	sysenter
+ 864:	cd 40                	int    $0x40
+ 866:	c3                   	ret
+
+00000867 <open>:
+SYSCALL(open)
+ 867:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 86c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 873:	74 09                	je     87e <open+0x17>
+ 875:	89 e1                	mov    %esp,%ecx
+ 877:	ba 80 08 00 00       	mov    $0x880,%edx
+ 87c:	0f 34                	sysenter
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <mknod>:
+SYSCALL(mknod)
+ 881:	b8 11 00 00 00       	mov    $0x11,%eax
+ 886:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 88d:	74 09                	je     898 <mknod+0x17>
+ 88f:	89 e1                	mov    %esp,%ecx
+ 891:	ba 9a 08 00 00       	mov    $0x89a,%edx
+ 896:	0f 34                	sysenter
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <unlink>:
+SYSCALL(unlink)
+ 89b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 8a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a7:	74 09                	je     8b2 <unlink+0x17>
+ 8a9:	89 e1                	mov    %esp,%ecx
+ 8ab:	ba b4 08 00 00       	mov    $0x8b4,%edx
+ 8b0:	0f 34                	sysenter
+ 8b2:	cd 40                	int    $0x40
+ 8b4:	c3                   	ret
+
+000008b5 <fstat>:
+SYSCALL(fstat)
+ 8b5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c1:	74 09                	je     8cc <fstat+0x17>
+ 8c3:	89 e1                	mov    %esp,%ecx
+ 8c5:	ba ce 08 00 00       	mov    $0x8ce,%edx
+ 8ca:	0f 34                	sysenter
+ 8cc:	cd 40                	int    $0x40
+ 8ce:	c3                   	ret
+
+000008cf <link>:
+SYSCALL(link)
+ 8cf:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8db:	74 09                	je     8e6 <link+0x17>
+ 8dd:	89 e1                	mov    %esp,%ecx
+ 8df:	ba e8 08 00 00       	mov    $0x8e8,%edx
+ 8e4:	0f 34                	sysenter
+ 8e6:	cd 40                	int    $0x40
+ 8e8:	c3                   	ret
+
+000008e9 <mkdir>:
+SYSCALL(mkdir)
+ 8e9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f5:	74 09                	je     900 <mkdir+0x17>
+ 8f7:	89 e1                	mov    %esp,%ecx
+ 8f9:	ba 02 09 00 00       	mov    $0x902,%edx
+ 8fe:	0f 34                	sysenter
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <chdir>:
+SYSCALL(chdir)
+ 903:	b8 09 00 00 00       	mov    $0x9,%eax
+ 908:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 90f:	74 09                	je     91a <chdir+0x17>
+ 911:	89 e1                	mov    %esp,%ecx
+ 913:	ba 1c 09 00 00       	mov    $0x91c,%edx
+ 918:	0f 34                	sysenter
+ 91a:	cd 40                	int    $0x40
+ 91c:	c3                   	ret
+
+0000091d <dup>:
+SYSCALL(dup)
+ 91d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 922:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 929:	74 09                	je     934 <dup+0x17>
+ 92b:	89 e1                	mov    %esp,%ecx
+ 92d:	ba 36 09 00 00       	mov    $0x936,%edx
+ 932:	0f 34                	sysenter
+ 934:	cd 40                	int    $0x40
+ 936:	c3                   	ret
+
+00000937 <getpid>:
+SYSCALL(getpid)
+ 937:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 93c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 943:	74 09                	je     94e <getpid+0x17>
+ 945:	89 e1                	mov    %esp,%ecx
+ 947:	ba 50 09 00 00       	mov    $0x950,%edx
+ 94c:	0f 34                	sysenter
+ 94e:	cd 40                	int    $0x40
+ 950:	c3                   	ret
+
+00000951 <sbrk>:
+SYSCALL(sbrk)
+ 951:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 956:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 95d:	74 09                	je     968 <sbrk+0x17>
+ 95f:	89 e1                	mov    %esp,%ecx
+ 961:	ba 6a 09 00 00       	mov    $0x96a,%edx
+ 966:	0f 34                	sysenter
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <sleep>:
+SYSCALL(sleep)
+ 96b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 970:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 977:	74 09                	je     982 <sleep+0x17>
+ 979:	89 e1                	mov    %esp,%ecx
+ 97b:	ba 84 09 00 00       	mov    $0x984,%edx
+ 980:	0f 34                	sysenter
+ 982:	cd 40                	int    $0x40
+ 984:	c3                   	ret
+
+00000985 <uptime>:
+SYSCALL(uptime)
+ 985:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 98a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 991:	74 09                	je     99c <uptime+0x17>
+ 993:	89 e1                	mov    %esp,%ecx
+ 995:	ba 9e 09 00 00       	mov    $0x99e,%edx
+ 99a:	0f 34                	sysenter
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+0000099f <mmap>:
+SYSCALL(mmap)
+ 99f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 9a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9ab:	74 09                	je     9b6 <mmap+0x17>
+ 9ad:	89 e1                	mov    %esp,%ecx
+ 9af:	ba b8 09 00 00       	mov    $0x9b8,%edx
+ 9b4:	0f 34                	sysenter
+ 9b6:	cd 40                	int    $0x40
+ 9b8:	c3                   	ret
+
+000009b9 <munmap>:
+SYSCALL(munmap)
+ 9b9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 9be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9c5:	74 09                	je     9d0 <munmap+0x17>
+ 9c7:	89 e1                	mov    %esp,%ecx
+ 9c9:	ba d2 09 00 00       	mov    $0x9d2,%edx
+ 9ce:	0f 34                	sysenter
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <clone>:
+SYSCALL(clone)
+ 9d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 9d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9df:	74 09                	je     9ea <clone+0x17>
+ 9e1:	89 e1                	mov    %esp,%ecx
+ 9e3:	ba ec 09 00 00       	mov    $0x9ec,%edx
+ 9e8:	0f 34                	sysenter
+ 9ea:	cd 40                	int    $0x40
+ 9ec:	c3                   	ret
+
+000009ed <join>:
+SYSCALL(join)
+ 9ed:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9f9:	74 09                	je     a04 <join+0x17>
+ 9fb:	89 e1                	mov    %esp,%ecx
+ 9fd:	ba 06 0a 00 00       	mov    $0xa06,%edx
+ a02:	0f 34                	sysenter
+ a04:	cd 40                	int    $0x40
+ a06:	c3                   	ret
+
+00000a07 <futex>:
+SYSCALL(futex)
+ a07:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a0c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a13:	74 09                	je     a1e <futex+0x17>
+ a15:	89 e1                	mov    %esp,%ecx
+ a17:	ba 20 0a 00 00       	mov    $0xa20,%edx
+ a1c:	0f 34                	sysenter
+ a1e:	cd 40                	int    $0x40
+ a20:	c3                   	ret
+
+00000a21 <memstat>:
+SYSCALL(memstat)
+ a21:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a26:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a2d:	74 09                	je     a38 <memstat+0x17>
+ a2f:	89 e1                	mov    %esp,%ecx
+ a31:	ba 3a 0a 00 00       	mov    $0xa3a,%edx
+ a36:	0f 34                	sysenter
+ a38:	cd 40                	int    $0x40
+ a3a:	c3                   	ret
+
+00000a3b <nice>:
+SYSCALL(nice)
+ a3b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a40:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a47:	74 09                	je     a52 <nice+0x17>
+ a49:	89 e1                	mov    %esp,%ecx
+ a4b:	ba 54 0a 00 00       	mov    $0xa54,%edx
+ a50:	0f 34                	sysenter
+ a52:	cd 40                	int    $0x40
+ a54:	c3                   	ret
+
+00000a55 <setpriority>:
+SYSCALL(setpriority)
+ a55:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a5a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a61:	74 09                	je     a6c <setpriority+0x17>
+ a63:	89 e1                	mov    %esp,%ecx
+ a65:	ba 6e 0a 00 00       	mov    $0xa6e,%edx
+ a6a:	0f 34                	sysenter
+ a6c:	cd 40                	int    $0x40
+ a6e:	c3                   	ret
+
+00000a6f <getpinfo>:
+SYSCALL(getpinfo)
+ a6f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a74:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a7b:	74 09                	je     a86 <getpinfo+0x17>
+ a7d:	89 e1                	mov    %esp,%ecx
+ a7f:	ba 88 0a 00 00       	mov    $0xa88,%edx
+ a84:	0f 34                	sysenter
+ a86:	cd 40                	int    $0x40
+ a88:	c3                   	ret
+
+00000a89 <settickets>:
+SYSCALL(settickets)
+ a89:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a8e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a95:	74 09                	je     aa0 <settickets+0x17>
+ a97:	89 e1                	mov    %esp,%ecx
+ a99:	ba a2 0a 00 00       	mov    $0xaa2,%edx
+ a9e:	0f 34                	sysenter
+ aa0:	cd 40                	int    $0x40
+ aa2:	c3                   	ret
+
+00000aa3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ aa3:	b8 20 00 00 00       	mov    $0x20,%eax
+ aa8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ aaf:	74 09                	je     aba <clock_gettime+0x17>
+ ab1:	89 e1                	mov    %esp,%ecx
+ ab3:	ba bc 0a 00 00       	mov    $0xabc,%edx
+ ab8:	0f 34                	sysenter
+ aba:	cd 40                	int    $0x40
+ abc:	c3                   	ret
+
+00000abd <batch>:
+SYSCALL(batch)
+ abd:	b8 21 00 00 00       	mov    $0x21,%eax
+ ac2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ ac9:	74 09                	je     ad4 <batch+0x17>
+ acb:	89 e1                	mov    %esp,%ecx
+ acd:	ba d6 0a 00 00       	mov    $0xad6,%edx
+ ad2:	0f 34                	sysenter
+ ad4:	cd 40                	int    $0x40
+ ad6:	c3                   	ret
+
+00000ad7 <aiosetup>:
+SYSCALL(aiosetup)
+ ad7:	b8 22 00 00 00       	mov    $0x22,%eax
+ adc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ ae3:	74 09                	je     aee <aiosetup+0x17>
+ ae5:	89 e1                	mov    %esp,%ecx
+ ae7:	ba f0 0a 00 00       	mov    $0xaf0,%edx
+ aec:	0f 34                	sysenter
+ aee:	cd 40                	int    $0x40
+ af0:	c3                   	ret
+
+00000af1 <aioenter>:
+SYSCALL(aioenter)
+ af1:	b8 23 00 00 00       	mov    $0x23,%eax
+ af6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ afd:	74 09                	je     b08 <aioenter+0x17>
+ aff:	89 e1                	mov    %esp,%ecx
+ b01:	ba 0a 0b 00 00       	mov    $0xb0a,%edx
+ b06:	0f 34                	sysenter
+ b08:	cd 40                	int    $0x40
+ b0a:	c3                   	ret
+
+00000b0b <systrace>:
+SYSCALL(systrace)
+ b0b:	b8 24 00 00 00       	mov    $0x24,%eax
+ b10:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ b17:	74 09                	je     b22 <systrace+0x17>
+ b19:	89 e1                	mov    %esp,%ecx
+ b1b:	ba 24 0b 00 00       	mov    $0xb24,%edx
+ b20:	0f 34                	sysenter
+ b22:	cd 40                	int    $0x40
+ b24:	c3                   	ret
+
+00000b25 <sysstat>:
+SYSCALL(sysstat)
+ b25:	b8 25 00 00 00       	mov    $0x25,%eax
+ b2a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ b31:	74 09                	je     b3c <sysstat+0x17>
+ b33:	89 e1                	mov    %esp,%ecx
+ b35:	ba 3e 0b 00 00       	mov    $0xb3e,%edx
+ b3a:	0f 34                	sysenter
+ b3c:	cd 40                	int    $0x40
+ b3e:	c3                   	ret
+
+00000b3f <traceread>:
+SYSCALL(traceread)
+ b3f:	b8 26 00 00 00       	mov    $0x26,%eax
+ b44:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ b4b:	74 09                	je     b56 <traceread+0x17>
+ b4d:	89 e1                	mov    %esp,%ecx
+ b4f:	ba 58 0b 00 00       	mov    $0xb58,%edx
+ b54:	0f 34                	sysenter
+ b56:	cd 40                	int    $0x40
+ b58:	c3                   	ret
+ b59:	66 90                	xchg   %ax,%ax
+ b5b:	66 90                	xchg   %ax,%ax
+ b5d:	66 90                	xchg   %ax,%ax
+ b5f:	90                   	nop
+
+00000b60 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ b68:	89 d1                	mov    %edx,%ecx
+{
+ b6a:	83 ec 3c             	sub    $0x3c,%esp
+ b6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ b70:	85 d2                	test   %edx,%edx
+ b72:	0f 89 80 00 00 00    	jns    bf8 <printint+0x98>
+ b78:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ b7c:	74 7a                	je     bf8 <printint+0x98>
+    x = -xx;
+ b7e:	f7 d9                	neg    %ecx
+    neg = 1;
+ b80:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ b85:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b88:	31 f6                	xor    %esi,%esi
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ b90:	89 c8                	mov    %ecx,%eax
+ b92:	31 d2                	xor    %edx,%edx
+ b94:	89 f7                	mov    %esi,%edi
+ b96:	f7 f3                	div    %ebx
+ b98:	8d 76 01             	lea    0x1(%esi),%esi
+ b9b:	0f b6 92 f4 10 00 00 	movzbl 0x10f4(%edx),%edx
+ ba2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ba6:	89 ca                	mov    %ecx,%edx
+ ba8:	89 c1                	mov    %eax,%ecx
+ baa:	39 da                	cmp    %ebx,%edx
+ bac:	73 e2                	jae    b90 <printint+0x30>
+  if(neg)
+ bae:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ bb1:	85 c0                	test   %eax,%eax
+ bb3:	74 07                	je     bbc <printint+0x5c>
+    buf[i++] = '-';
+ bb5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ bba:	89 f7                	mov    %esi,%edi
+ bbc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ bbf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ bc2:	01 df                	add    %ebx,%edi
+ bc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ bc8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ bcb:	83 ec 04             	sub    $0x4,%esp
+ bce:	88 45 d7             	mov    %al,-0x29(%ebp)
+ bd1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ bd4:	6a 01                	push   $0x1
+ bd6:	50                   	push   %eax
+ bd7:	56                   	push   %esi
+ bd8:	e8 22 fc ff ff       	call   7ff <write>
+  while(--i >= 0)
+ bdd:	89 f8                	mov    %edi,%eax
+ bdf:	83 c4 10             	add    $0x10,%esp
+ be2:	83 ef 01             	sub    $0x1,%edi
+ be5:	39 d8                	cmp    %ebx,%eax
+ be7:	75 df                	jne    bc8 <printint+0x68>
+}
+ be9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bec:	5b                   	pop    %ebx
+ bed:	5e                   	pop    %esi
+ bee:	5f                   	pop    %edi
+ bef:	5d                   	pop    %ebp
+ bf0:	c3                   	ret
+ bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ bf8:	31 c0                	xor    %eax,%eax
+ bfa:	eb 89                	jmp    b85 <printint+0x25>
+ bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	57                   	push   %edi
+ c04:	56                   	push   %esi
+ c05:	53                   	push   %ebx
+ c06:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ c09:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ c0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ c0f:	0f b6 1e             	movzbl (%esi),%ebx
+ c12:	83 c6 01             	add    $0x1,%esi
+ c15:	84 db                	test   %bl,%bl
+ c17:	74 67                	je     c80 <printf+0x80>
+ c19:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ c1c:	31 d2                	xor    %edx,%edx
+ c1e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ c21:	eb 34                	jmp    c57 <printf+0x57>
+ c23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c27:	90                   	nop
+ c28:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ c2b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ c30:	83 f8 25             	cmp    $0x25,%eax
+ c33:	74 18                	je     c4d <printf+0x4d>
+  write(fd, &c, 1);
+ c35:	83 ec 04             	sub    $0x4,%esp
+ c38:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ c3b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c3e:	6a 01                	push   $0x1
+ c40:	50                   	push   %eax
+ c41:	57                   	push   %edi
+ c42:	e8 b8 fb ff ff       	call   7ff <write>
+ c47:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ c4a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ c4d:	0f b6 1e             	movzbl (%esi),%ebx
+ c50:	83 c6 01             	add    $0x1,%esi
+ c53:	84 db                	test   %bl,%bl
+ c55:	74 29                	je     c80 <printf+0x80>
+    c = fmt[i] & 0xff;
+ c57:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ c5a:	85 d2                	test   %edx,%edx
+ c5c:	74 ca                	je     c28 <printf+0x28>
+      }
+    } else if(state == '%'){
+ c5e:	83 fa 25             	cmp    $0x25,%edx
+ c61:	75 ea                	jne    c4d <printf+0x4d>
+      if(c == 'd'){
+ c63:	83 f8 25             	cmp    $0x25,%eax
+ c66:	0f 84 24 01 00 00    	je     d90 <printf+0x190>
+ c6c:	83 e8 63             	sub    $0x63,%eax
+ c6f:	83 f8 15             	cmp    $0x15,%eax
+ c72:	77 1c                	ja     c90 <printf+0x90>
+ c74:	ff 24 85 9c 10 00 00 	jmp    *0x109c(,%eax,4)
+ c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ c80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c83:	5b                   	pop    %ebx
+ c84:	5e                   	pop    %esi
+ c85:	5f                   	pop    %edi
+ c86:	5d                   	pop    %ebp
+ c87:	c3                   	ret
+ c88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c8f:	90                   	nop
+  write(fd, &c, 1);
+ c90:	83 ec 04             	sub    $0x4,%esp
+ c93:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c96:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ c9a:	6a 01                	push   $0x1
+ c9c:	52                   	push   %edx
+ c9d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ ca0:	57                   	push   %edi
+ ca1:	e8 59 fb ff ff       	call   7ff <write>
+ ca6:	83 c4 0c             	add    $0xc,%esp
+ ca9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ cac:	6a 01                	push   $0x1
+ cae:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ cb1:	52                   	push   %edx
+ cb2:	57                   	push   %edi
+ cb3:	e8 47 fb ff ff       	call   7ff <write>
+        putc(fd, c);
+ cb8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cbb:	31 d2                	xor    %edx,%edx
+ cbd:	eb 8e                	jmp    c4d <printf+0x4d>
+ cbf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ cc0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ cc3:	83 ec 0c             	sub    $0xc,%esp
+ cc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ ccb:	8b 13                	mov    (%ebx),%edx
+ ccd:	6a 00                	push   $0x0
+ ccf:	89 f8                	mov    %edi,%eax
+        ap++;
+ cd1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ cd4:	e8 87 fe ff ff       	call   b60 <printint>
+        ap++;
+ cd9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ cdc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cdf:	31 d2                	xor    %edx,%edx
+ ce1:	e9 67 ff ff ff       	jmp    c4d <printf+0x4d>
+ ce6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ced:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ cf0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ cf3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ cf5:	83 c0 04             	add    $0x4,%eax
+ cf8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ cfb:	85 db                	test   %ebx,%ebx
+ cfd:	0f 84 9d 00 00 00    	je     da0 <printf+0x1a0>
+        while(*s != 0){
+ d03:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ d06:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ d08:	84 c0                	test   %al,%al
+ d0a:	0f 84 3d ff ff ff    	je     c4d <printf+0x4d>
+ d10:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d13:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ d16:	89 de                	mov    %ebx,%esi
+ d18:	89 d3                	mov    %edx,%ebx
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ d20:	83 ec 04             	sub    $0x4,%esp
+ d23:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ d26:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ d29:	6a 01                	push   $0x1
+ d2b:	53                   	push   %ebx
+ d2c:	57                   	push   %edi
+ d2d:	e8 cd fa ff ff       	call   7ff <write>
+        while(*s != 0){
+ d32:	0f b6 06             	movzbl (%esi),%eax
+ d35:	83 c4 10             	add    $0x10,%esp
+ d38:	84 c0                	test   %al,%al
+ d3a:	75 e4                	jne    d20 <printf+0x120>
+      state = 0;
+ d3c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ d3f:	31 d2                	xor    %edx,%edx
+ d41:	e9 07 ff ff ff       	jmp    c4d <printf+0x4d>
+ d46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d4d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ d50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d53:	83 ec 0c             	sub    $0xc,%esp
+ d56:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ d5b:	8b 13                	mov    (%ebx),%edx
+ d5d:	6a 01                	push   $0x1
+ d5f:	e9 6b ff ff ff       	jmp    ccf <printf+0xcf>
+ d64:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ d68:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ d6b:	83 ec 04             	sub    $0x4,%esp
+ d6e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ d71:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ d73:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ d76:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ d79:	6a 01                	push   $0x1
+ d7b:	52                   	push   %edx
+ d7c:	57                   	push   %edi
+ d7d:	e8 7d fa ff ff       	call   7ff <write>
+        ap++;
+ d82:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d85:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d88:	31 d2                	xor    %edx,%edx
+ d8a:	e9 be fe ff ff       	jmp    c4d <printf+0x4d>
+ d8f:	90                   	nop
+  write(fd, &c, 1);
+ d90:	83 ec 04             	sub    $0x4,%esp
+ d93:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d96:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d99:	6a 01                	push   $0x1
+ d9b:	e9 11 ff ff ff       	jmp    cb1 <printf+0xb1>
+ da0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ da5:	bb 94 10 00 00       	mov    $0x1094,%ebx
+ daa:	e9 61 ff ff ff       	jmp    d10 <printf+0x110>
+ daf:	90                   	nop
+
+00000db0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ db0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ db1:	a1 90 15 00 00       	mov    0x1590,%eax
+{
+ db6:	89 e5                	mov    %esp,%ebp
+ db8:	57                   	push   %edi
+ db9:	56                   	push   %esi
+ dba:	53                   	push   %ebx
+ dbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ dbe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dc8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dca:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ dcc:	39 ca                	cmp    %ecx,%edx
+ dce:	73 30                	jae    e00 <free+0x50>
+ dd0:	39 c1                	cmp    %eax,%ecx
+ dd2:	72 04                	jb     dd8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ dd4:	39 c2                	cmp    %eax,%edx
+ dd6:	72 f0                	jb     dc8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ dd8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ ddb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ dde:	39 f8                	cmp    %edi,%eax
+ de0:	74 2e                	je     e10 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ de2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ de5:	8b 42 04             	mov    0x4(%edx),%eax
+ de8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ deb:	39 f1                	cmp    %esi,%ecx
+ ded:	74 38                	je     e27 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ def:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ df1:	5b                   	pop    %ebx
+  freep = p;
+ df2:	89 15 90 15 00 00    	mov    %edx,0x1590
+}
+ df8:	5e                   	pop    %esi
+ df9:	5f                   	pop    %edi
+ dfa:	5d                   	pop    %ebp
+ dfb:	c3                   	ret
+ dfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ e00:	39 c1                	cmp    %eax,%ecx
+ e02:	72 d0                	jb     dd4 <free+0x24>
+ e04:	eb c2                	jmp    dc8 <free+0x18>
+ e06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e0d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ e10:	03 70 04             	add    0x4(%eax),%esi
+ e13:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ e16:	8b 02                	mov    (%edx),%eax
+ e18:	8b 00                	mov    (%eax),%eax
+ e1a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ e1d:	8b 42 04             	mov    0x4(%edx),%eax
+ e20:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ e23:	39 f1                	cmp    %esi,%ecx
+ e25:	75 c8                	jne    def <free+0x3f>
+    p->s.size += bp->s.size;
+ e27:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ e2a:	89 15 90 15 00 00    	mov    %edx,0x1590
+    p->s.size += bp->s.size;
+ e30:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ e33:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ e36:	89 0a                	mov    %ecx,(%edx)
+}
+ e38:	5b                   	pop    %ebx
+ e39:	5e                   	pop    %esi
+ e3a:	5f                   	pop    %edi
+ e3b:	5d                   	pop    %ebp
+ e3c:	c3                   	ret
+ e3d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e40 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	57                   	push   %edi
+ e44:	56                   	push   %esi
+ e45:	53                   	push   %ebx
+ e46:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ e4c:	8b 15 90 15 00 00    	mov    0x1590,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e52:	8d 78 07             	lea    0x7(%eax),%edi
+ e55:	c1 ef 03             	shr    $0x3,%edi
+ e58:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e5b:	85 d2                	test   %edx,%edx
+ e5d:	0f 84 8d 00 00 00    	je     ef0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e63:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e65:	8b 48 04             	mov    0x4(%eax),%ecx
+ e68:	39 f9                	cmp    %edi,%ecx
+ e6a:	73 64                	jae    ed0 <malloc+0x90>
+  if(nu < 4096)
+ e6c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e71:	39 df                	cmp    %ebx,%edi
+ e73:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e76:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e7d:	eb 0a                	jmp    e89 <malloc+0x49>
+ e7f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e80:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e82:	8b 48 04             	mov    0x4(%eax),%ecx
+ e85:	39 f9                	cmp    %edi,%ecx
+ e87:	73 47                	jae    ed0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e89:	89 c2                	mov    %eax,%edx
+ e8b:	39 05 90 15 00 00    	cmp    %eax,0x1590
+ e91:	75 ed                	jne    e80 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e93:	83 ec 0c             	sub    $0xc,%esp
+ e96:	56                   	push   %esi
+ e97:	e8 b5 fa ff ff       	call   951 <sbrk>
+  if(p == (char*)-1)
+ e9c:	83 c4 10             	add    $0x10,%esp
+ e9f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ea2:	74 1c                	je     ec0 <malloc+0x80>
+  hp->s.size = nu;
+ ea4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ea7:	83 ec 0c             	sub    $0xc,%esp
+ eaa:	83 c0 08             	add    $0x8,%eax
+ ead:	50                   	push   %eax
+ eae:	e8 fd fe ff ff       	call   db0 <free>
+  return freep;
+ eb3:	8b 15 90 15 00 00    	mov    0x1590,%edx
+      if((p = morecore(nunits)) == 0)
+ eb9:	83 c4 10             	add    $0x10,%esp
+ ebc:	85 d2                	test   %edx,%edx
+ ebe:	75 c0                	jne    e80 <malloc+0x40>
+        return 0;
+  }
+}
+ ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ec3:	31 c0                	xor    %eax,%eax
+}
+ ec5:	5b                   	pop    %ebx
+ ec6:	5e                   	pop    %esi
+ ec7:	5f                   	pop    %edi
+ ec8:	5d                   	pop    %ebp
+ ec9:	c3                   	ret
+ eca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ed0:	39 cf                	cmp    %ecx,%edi
+ ed2:	74 4c                	je     f20 <malloc+0xe0>
+        p->s.size -= nunits;
+ ed4:	29 f9                	sub    %edi,%ecx
+ ed6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ed9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ edc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ edf:	89 15 90 15 00 00    	mov    %edx,0x1590
+}
+ ee5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ee8:	83 c0 08             	add    $0x8,%eax
+}
+ eeb:	5b                   	pop    %ebx
+ eec:	5e                   	pop    %esi
+ eed:	5f                   	pop    %edi
+ eee:	5d                   	pop    %ebp
+ eef:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ef0:	c7 05 90 15 00 00 94 	movl   $0x1594,0x1590
+ ef7:	15 00 00 
+    base.s.size = 0;
+ efa:	b8 94 15 00 00       	mov    $0x1594,%eax
+    base.s.ptr = freep = prevp = &base;
+ eff:	c7 05 94 15 00 00 94 	movl   $0x1594,0x1594
+ f06:	15 00 00 
+    base.s.size = 0;
+ f09:	c7 05 98 15 00 00 00 	movl   $0x0,0x1598
+ f10:	00 00 00 
+    if(p->s.size >= nunits){
+ f13:	e9 54 ff ff ff       	jmp    e6c <malloc+0x2c>
+ f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f1f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ f20:	8b 08                	mov    (%eax),%ecx
+ f22:	89 0a                	mov    %ecx,(%edx)
+ f24:	eb b9                	jmp    edf <malloc+0x9f>
+ f26:	66 90                	xchg   %ax,%ax
+ f28:	66 90                	xchg   %ax,%ax
+ f2a:	66 90                	xchg   %ax,%ax
+ f2c:	66 90                	xchg   %ax,%ax
+ f2e:	66 90                	xchg   %ax,%ax
+
+00000f30 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f30:	55                   	push   %ebp
+ f31:	89 e5                	mov    %esp,%ebp
+ f33:	53                   	push   %ebx
+ f34:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ f37:	68 00 20 00 00       	push   $0x2000
+ f3c:	e8 ff fe ff ff       	call   e40 <malloc>
+ f41:	83 c4 10             	add    $0x10,%esp
+ f44:	85 c0                	test   %eax,%eax
+ f46:	74 47                	je     f8f <thread_create+0x5f>
+ f48:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ f4a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ f50:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ f53:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ f58:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ f5b:	ff 75 0c             	push   0xc(%ebp)
+ f5e:	50                   	push   %eax
+ f5f:	ff 75 08             	push   0x8(%ebp)
+ f62:	e8 6c fa ff ff       	call   9d3 <clone>
+ f67:	83 c4 10             	add    $0x10,%esp
+ f6a:	85 c0                	test   %eax,%eax
+ f6c:	78 0a                	js     f78 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f71:	c9                   	leave
+ f72:	c3                   	ret
+ f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ f77:	90                   	nop
+    free(mem);
+ f78:	83 ec 0c             	sub    $0xc,%esp
+ f7b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f7e:	53                   	push   %ebx
+ f7f:	e8 2c fe ff ff       	call   db0 <free>
+ f84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f8a:	83 c4 10             	add    $0x10,%esp
+}
+ f8d:	c9                   	leave
+ f8e:	c3                   	ret
+    return -1;
+ f8f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f94:	eb d8                	jmp    f6e <thread_create+0x3e>
+ f96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fa0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ fa0:	55                   	push   %ebp
+ fa1:	89 e5                	mov    %esp,%ebp
+ fa3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ fa4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ fa7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ faa:	50                   	push   %eax
+ fab:	e8 3d fa ff ff       	call   9ed <join>
+ fb0:	83 c4 10             	add    $0x10,%esp
+ fb3:	85 c0                	test   %eax,%eax
+ fb5:	78 21                	js     fd8 <thread_join+0x38>
+ fb7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ fb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ fbc:	83 ec 0c             	sub    $0xc,%esp
+ fbf:	ff 70 fc             	push   -0x4(%eax)
+ fc2:	e8 e9 fd ff ff       	call   db0 <free>
+  return pid;
+ fc7:	83 c4 10             	add    $0x10,%esp
+}
+ fca:	89 d8                	mov    %ebx,%eax
+ fcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ fcf:	c9                   	leave
+ fd0:	c3                   	ret
+ fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ fd8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ fdd:	eb eb                	jmp    fca <thread_join+0x2a>
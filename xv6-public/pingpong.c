@@ -0,0 +1,86 @@
+// Pipe ping-pong latency microbenchmark.
+// Two processes bounce a byte over a pair of pipes while S other
+// processes sit asleep reading a pipe nobody writes.  Every round
+// trip is two pipe wakeups; with wait queues hashed by channel a
+// wakeup looks only at sleepers that share its hash bucket, so the
+// latency should stay flat as S grows.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "clock.h"
+
+#define N  10000
+#define S  32
+
+int
+main(int argc, char *argv[])
+{
+  int i, n, s, pid, us;
+  struct timespec start, end;
+  int ping[2], pong[2], idle[2];
+  char c;
+
+  n = N;
+  s = S;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    s = atoi(argv[2]);
+
+  if(pipe(ping) < 0 || pipe(pong) < 0 || pipe(idle) < 0){
+    printf(2, "pingpong: pipe failed\n");
+    exit();
+  }
+
+  // Sleepers: block in read until idle's write end is closed.
+  for(i = 0; i < s; i++){
+    pid = fork();
+    if(pid < 0){
+      printf(2, "pingpong: fork failed after %d sleepers\n", i);
+      s = i;
+      break;
+    }
+    if(pid == 0){
+      close(idle[1]);
+      read(idle[0], &c, 1);
+      exit();
+    }
+  }
+  close(idle[0]);
+
+  pid = fork();
+  if(pid < 0){
+    printf(2, "pingpong: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < n; i++){
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+    }
+    exit();
+  }
+
+  c = 'x';
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for(i = 0; i < n; i++){
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "pingpong: read failed\n");
+      break;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  us = (end.tv_sec - start.tv_sec) * 1000000 +
+       ((int)end.tv_nsec - (int)start.tv_nsec) / 1000;
+
+  close(idle[1]);
+  while(wait() >= 0)
+    ;
+
+  printf(1, "pingpong: %d round trips with %d sleepers in %d us, "
+         "%d ns each\n", i, s, us, i ? us / i * 1000 + us % i * 1000 / i : 0);
+  exit();
+}
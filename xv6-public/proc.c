@@ -6,14 +6,110 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "sleeplock.h"
+#include "vmspace.h"
 #include "mmap.h"
 #include "vm.h"
-
+#include "pstat.h"
+#include "traps.h"
+#include "vdso.h"
+#include "aio.h"
+#include "systrace.h"
+
+// ptable.lock covers the process lifecycle: allocating slots,
+// exit, wait and the parent links.  Each proc also has its own
+// lock, plock(p), protecting p->state while the process runs,
+// sleeps and is woken, and held across the switch into and out
+// of the scheduler.  Lock order: ptable.lock, then plock(p),
+// then a run queue lock.
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct spinlock plock[NPROC];
 } ptable;
 
+// Per-CPU run queues of RUNNABLE processes.
+//
+// Scheduling is a multi-level feedback queue: a queue per
+// priority level, 0 highest, each served round robin.  A process
+// that uses up its level's time slice (quantum[], in timer ticks,
+// counted across sleeps) drops a level.  Every BOOST ticks all
+// processes go back to their base level, p->nice, which nice()
+// and setpriority() set.
+//
+// Processes given tickets by settickets() are instead in the
+// stride class, which shares the CPU in proportion to tickets:
+// each tick a process runs advances its pass by STRIDE1/tickets,
+// and the process with the lowest pass, kept at the top of a
+// min-heap, runs next.  The stride class runs after MLFQ level 0
+// and ahead of the lower levels, so interactive processes still
+// respond and the boost keeps the lower levels from starving.
+//
+// An idle CPU steals half the queue of the busiest CPU, and every
+// REBALANCE ticks each CPU pulls work from a busier one, leaving
+// behind processes that ran within the last CACHEHOT ticks.
+// A CPU with nothing to run or steal halts until the next
+// interrupt; queueing work on a halted CPU sends it a T_WAKEUP
+// interrupt.
+#define REBALANCE 10
+#define CACHEHOT  2
+#define BOOST     100
+#define STRIDE1   (1<<20)
+#define MAXTICKETS 1024
+
+static int quantum[NMLFQ] = { 1, 2, 4, 8 };
+
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NMLFQ];
+  struct proc *tail[NMLFQ];
+  struct proc *heap[NPROC];  // stride class, min-heap on pass
+  int nheap;
+  uint pass;        // pass of the stride process run last
+  int n;
+  uint ntick;       // timer ticks seen by this CPU
+  uint steals;      // times this CPU stole work while idle
+  uint migrations;  // processes moved to this CPU's queue
+  int idle;         // CPU is halted in idle()
+  uint nidle;       // timer ticks that found this CPU idle
+} runqs[NCPU];
+
+// Sleeping processes are kept on wait queues hashed by channel,
+// so a wakeup looks only at the processes that might be sleeping
+// on its channel instead of at every process.  A process stays
+// on its queue until a wakeup takes it off, or until it takes
+// itself off after being woken some other way (by kill() or
+// wakeproc()).
+//
+// Lock order: sleep's lk, then the queue lock, then plock.
+#define NSLEEPQ 64
+
+struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+} sleepqs[NSLEEPQ];
+
+static struct spinlock*
+plock(struct proc *p)
+{
+  return &ptable.plock[p - ptable.proc];
+}
+
+
+struct {
+  struct spinlock lock;       // protects ref of every vmspace
+  struct kmem_cache *cache;
+} vmtable;
+
+// Address spaces come from vmtable.cache with their
+// sleep-lock initialized and released.
+static void
+vmspacector(void *v)
+{
+  struct vmspace *vm = v;
+
+  initsleeplock(&vm->lock, "vmspace");
+}
 
 static struct proc *initproc;
 
@@ -26,7 +122,139 @@ static void wakeup1(void *chan);
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NPROC; i++)
+    initlock(&ptable.plock[i], "proc");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runqs[i].lock, "runq");
+  for(i = 0; i < NSLEEPQ; i++)
+    initlock(&sleepqs[i].lock, "sleepq");
+  initlock(&vmtable.lock, "vmtable");
+  vmtable.cache = kmem_cache_create("vmspace", sizeof(struct vmspace),
+                                    vmspacector);
+}
+
+// Allocate an address space for page table pgdir,
+// with no memory mappings.
+static struct vmspace*
+vmspacealloc(pde_t *pgdir)
+{
+  struct vmspace *vm;
+
+  if((vm = kmem_cache_alloc(vmtable.cache)) == 0)
+    return 0;
+  vm->ref = 1;
+  vm->pgdir = pgdir;
+  memset(vm->mmaps, 0, sizeof(vm->mmaps));
+  vm->num_mmaps = 0;
+  vm->aio = 0;
+  return vm;
+}
+
+// Add a reference to address space vm.
+static struct vmspace*
+vmspacedup(struct vmspace *vm)
+{
+  acquire(&vmtable.lock);
+  if(vm->ref < 1)
+    panic("vmspacedup");
+  vm->ref++;
+  release(&vmtable.lock);
+  return vm;
+}
+
+// Clear vm's PTEs for the MAP_SHARED mappings it inherited from a
+// parent, whose pages the parent still owns, so that freevm() does
+// not free them.  Only for an address space no CPU is running on,
+// so no TLB holds the entries.
+static void
+vmspaceunshare(struct vmspace *vm)
+{
+  struct mmap *m;
+  pte_t *pte;
+  uint a;
+
+  for(m = vm->mmaps; m < &vm->mmaps[MAX_MMAPS]; m++){
+    if(!m->isChild || !(m->flags & MAP_SHARED))
+      continue;
+    for(a = (uint)m->va; a < (uint)m->va + PGROUNDUP(m->length); a += PGSIZE)
+      if((pte = walkpgdir(vm->pgdir, (char*)a, 0)) != 0)
+        *pte = 0;
+  }
+}
+
+// Drop a reference to address space vm,
+// freeing its page table if that was the last one.
+// Procs hold their reference until they are reaped,
+// so the last one is dropped only once every user has exited.
+static void
+vmspaceput(struct vmspace *vm)
+{
+  pde_t *pgdir;
+
+  acquire(&vmtable.lock);
+  if(vm->ref < 1)
+    panic("vmspaceput");
+  if(--vm->ref > 0){
+    release(&vmtable.lock);
+    return;
+  }
+  release(&vmtable.lock);
+  aiofree(vm);
+  vmspaceunshare(vm);
+  pgdir = vm->pgdir;
+  vm->pgdir = 0;
+  kmem_cache_free(vmtable.cache, vm);
+  freevm(pgdir);
+}
+
+// Number of procs sharing p's address space.
+static int
+vmspaceusers(struct proc *p)
+{
+  int n;
+
+  acquire(&vmtable.lock);
+  n = p->vm->ref;
+  release(&vmtable.lock);
+  return n;
+}
+
+// Install the freshly exec'd page table pgdir in the current
+// process.  A process that shares its address space with other
+// threads moves to a new address space and leaves them the old
+// one; otherwise the old page table is freed.
+int
+vmspaceexec(pde_t *pgdir)
+{
+  struct proc *curproc = myproc();
+  struct vmspace *vm;
+  pde_t *oldpgdir;
+
+  if(vmspaceusers(curproc) > 1){
+    if((vm = vmspacealloc(pgdir)) == 0)
+      return -1;
+    // The other threads keep the old image and its I/O rings,
+    // but may all have exited: finish our requests into it.
+    aiodrain(curproc->vm);
+    vmspaceput(curproc->vm);
+    curproc->vm = vm;
+    curproc->pgdir = pgdir;
+    switchuvm(curproc);
+    return 0;
+  }
+  // Past the point of no return: the old image's I/O rings go
+  // with it, once nothing is in flight into it.
+  aiodrain(curproc->vm);
+  aiofree(curproc->vm);
+  oldpgdir = curproc->pgdir;
+  curproc->vm->pgdir = pgdir;
+  curproc->pgdir = pgdir;
+  switchuvm(curproc);
+  freevm(oldpgdir);
+  return 0;
 }
 
 // Must be called with interrupts disabled
@@ -35,6 +263,346 @@ cpuid() {
   return mycpu()-cpus;
 }
 
+// Append p to level lev of run queue rq.  Caller holds rq->lock.
+static void
+runqappend(struct runq *rq, int lev, struct proc *p)
+{
+  p->rqnext = 0;
+  if(rq->tail[lev])
+    rq->tail[lev]->rqnext = p;
+  else
+    rq->head[lev] = p;
+  rq->tail[lev] = p;
+  rq->n++;
+}
+
+// Passes wrap around; compare them by their difference.
+static int
+passless(struct proc *a, struct proc *b)
+{
+  return (int)(a->pass - b->pass) < 0;
+}
+
+// Restore the heap order of rq->heap around slot i.
+static void
+heapfix(struct runq *rq, int i)
+{
+  struct proc **h = rq->heap;
+  struct proc *p;
+  int c;
+
+  p = h[i];
+  while(i > 0 && passless(p, h[(i-1)/2])){
+    h[i] = h[(i-1)/2];
+    i = (i-1)/2;
+  }
+  while((c = 2*i+1) < rq->nheap){
+    if(c+1 < rq->nheap && passless(h[c+1], h[c]))
+      c++;
+    if(!passless(h[c], p))
+      break;
+    h[i] = h[c];
+    i = c;
+  }
+  h[i] = p;
+}
+
+// Remove and return the process in slot i of rq->heap.
+static struct proc*
+heapdel(struct runq *rq, int i)
+{
+  struct proc *p;
+
+  p = rq->heap[i];
+  if(i != --rq->nheap){
+    rq->heap[i] = rq->heap[rq->nheap];
+    heapfix(rq, i);
+  }
+  rq->n--;
+  return p;
+}
+
+// Add p to rq, in its class.  Caller holds rq->lock.
+// A stride process that slept, or that has just joined,
+// starts no earlier than the pass of the queue, so it cannot
+// spend credit saved up while it was not runnable.
+static void
+runqadd(struct runq *rq, struct proc *p)
+{
+  if(p->tickets == 0){
+    runqappend(rq, p->level, p);
+    return;
+  }
+  if((int)(p->pass - rq->pass) < 0)
+    p->pass = rq->pass;
+  rq->heap[rq->nheap] = p;
+  heapfix(rq, rq->nheap++);
+  rq->n++;
+}
+
+// Queue p on rq, waking rq's CPU if it is halted.
+static void
+runqput(struct runq *rq, struct proc *p)
+{
+  int wake;
+
+  acquire(&rq->lock);
+  runqadd(rq, p);
+  wake = rq->idle;
+  release(&rq->lock);
+  if(wake && rq != &runqs[cpuid()])
+    lapicsendipi(cpus[rq - runqs].apicid, T_WAKEUP);
+}
+
+// Remove and return the first process of MLFQ level lev, or 0.
+static struct proc*
+runqpop(struct runq *rq, int lev)
+{
+  struct proc *p;
+
+  if((p = rq->head[lev]) != 0){
+    rq->head[lev] = p->rqnext;
+    if(rq->head[lev] == 0)
+      rq->tail[lev] = 0;
+    p->rqnext = 0;
+    rq->n--;
+  }
+  return p;
+}
+
+// Remove and return the next process to run from rq, or 0:
+// MLFQ level 0, then the stride process with the lowest pass,
+// then the lower MLFQ levels.
+static struct proc*
+runqget(struct runq *rq)
+{
+  struct proc *p;
+  int lev;
+
+  acquire(&rq->lock);
+  if((p = runqpop(rq, 0)) == 0){
+    if(rq->nheap > 0){
+      p = heapdel(rq, 0);
+      rq->pass = p->pass;
+    } else {
+      for(lev = 1; lev < NMLFQ; lev++)
+        if((p = runqpop(rq, lev)) != 0)
+          break;
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Whether a process waiting on rq should preempt p.
+// Read without the lock, as a hint.
+static int
+runqpreempt(struct runq *rq, struct proc *p)
+{
+  int lev;
+
+  if(rq->head[0])
+    return p->tickets || p->level > 0;
+  if(p->tickets)
+    return rq->nheap > 0 && passless(rq->heap[0], p);
+  if(rq->nheap > 0)
+    return 1;
+  for(lev = 1; lev < p->level; lev++)
+    if(rq->head[lev])
+      return 1;
+  return 0;
+}
+
+// Move up to n processes from run queue from to run queue to,
+// skipping any that ran within the last hot ticks.  Stride
+// processes keep their place relative to the queue's pass.
+// Returns the number moved.
+static int
+runqmove(struct runq *from, struct runq *to, int n, uint hot)
+{
+  struct proc *p, *prev, *next, *list, *tail;
+  int i, lev, moved;
+
+  list = tail = 0;
+  moved = 0;
+  acquire(&from->lock);
+  for(lev = 0; lev < NMLFQ && moved < n; lev++){
+    prev = 0;
+    for(p = from->head[lev]; p && moved < n; p = next){
+      next = p->rqnext;
+      if(hot && ticks - p->lastrun < hot){
+        prev = p;
+        continue;
+      }
+      if(prev)
+        prev->rqnext = next;
+      else
+        from->head[lev] = next;
+      if(from->tail[lev] == p)
+        from->tail[lev] = prev;
+      from->n--;
+      p->rqnext = 0;
+      if(tail)
+        tail->rqnext = p;
+      else
+        list = p;
+      tail = p;
+      moved++;
+    }
+  }
+  for(i = from->nheap - 1; i >= 0 && moved < n; i--){
+    p = from->heap[i];
+    if(i >= from->nheap || (hot && ticks - p->lastrun < hot))
+      continue;
+    heapdel(from, i);
+    p->pass -= from->pass;
+    p->rqnext = 0;
+    if(tail)
+      tail->rqnext = p;
+    else
+      list = p;
+    tail = p;
+    moved++;
+  }
+  release(&from->lock);
+
+  if(moved == 0)
+    return 0;
+  acquire(&to->lock);
+  for(p = list; p; p = next){
+    next = p->rqnext;
+    if(p->tickets)
+      p->pass += to->pass;
+    runqadd(to, p);
+  }
+  to->migrations += moved;
+  release(&to->lock);
+  return moved;
+}
+
+// The run queue of the CPU other than rq with the most
+// processes waiting, or 0 if all are empty.  The counts are
+// read without locks; this is only a hint.
+static struct runq*
+busiest(struct runq *rq)
+{
+  struct runq *r, *max;
+
+  max = 0;
+  for(r = runqs; r < &runqs[ncpu]; r++)
+    if(r != rq && r->n > 0 && (max == 0 || r->n > max->n))
+      max = r;
+  return max;
+}
+
+// Move every process back to its base level.
+// Called from CPU 0's timer tick every BOOST ticks.
+static void
+boost(void)
+{
+  struct proc *p, *list, *next;
+  struct runq *rq;
+  int lev;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->state == UNUSED)
+      continue;
+    p->level = p->nice;
+    p->slice = 0;
+  }
+  release(&ptable.lock);
+
+  // Requeue waiting processes at their new levels.
+  for(rq = runqs; rq < &runqs[ncpu]; rq++){
+    acquire(&rq->lock);
+    list = 0;
+    for(lev = NMLFQ-1; lev >= 0; lev--){
+      if(rq->tail[lev]){
+        rq->tail[lev]->rqnext = list;
+        list = rq->head[lev];
+      }
+      rq->head[lev] = rq->tail[lev] = 0;
+    }
+    rq->n = rq->nheap;
+    for(p = list; p; p = next){
+      next = p->rqnext;
+      runqappend(rq, p->level, p);
+    }
+    release(&rq->lock);
+  }
+}
+
+// Called on every CPU's timer tick.  Charges the tick to the
+// running process and returns 1 if it should give up the CPU:
+// because it has used its time slice, or because a process of
+// higher priority is waiting.  Also balances the run queues
+// every REBALANCE ticks and boosts priorities every BOOST ticks.
+int
+schedtick(void)
+{
+  struct runq *rq, *from;
+  struct proc *p;
+  int n, resched;
+
+  rq = &runqs[cpuid()];
+  if(cpuid() == 0 && ticks % BOOST == 0)
+    boost();
+  if(myproc() == 0)
+    rq->nidle++;
+
+  if(++rq->ntick % REBALANCE == 0 && (from = busiest(rq)) != 0){
+    n = (from->n - rq->n) / 2;
+    if(n > 0)
+      runqmove(from, rq, n, CACHEHOT);
+  }
+
+  resched = 0;
+  if((p = myproc()) != 0 && p->state == RUNNING){
+    p->ticks[p->level]++;
+    if(p->tickets){
+      p->pass += p->stride;
+    } else if(++p->slice >= quantum[p->level]){
+      p->slice = 0;
+      if(p->level < NMLFQ-1)
+        p->level++;
+      resched = 1;
+    }
+    if(runqpreempt(rq, p))
+      resched = 1;
+  }
+  return resched;
+}
+
+// Halt this CPU until the next interrupt, unless work has
+// arrived on its run queue.  runqput() checks rq->idle under
+// rq->lock after queueing, so either we see the new process
+// here or it sees idle set and sends T_WAKEUP, which ends
+// the hlt even if it arrives before it.
+static void
+idle(struct runq *rq)
+{
+  cli();
+  acquire(&rq->lock);
+  if(rq->n > 0){
+    release(&rq->lock);
+    return;
+  }
+  rq->idle = 1;
+  release(&rq->lock);
+  stihlt();
+  rq->idle = 0;
+}
+
+// Mark p RUNNABLE and queue it on the run queue of the CPU
+// it last ran on.  Caller holds plock(p).
+static void
+setrunnable(struct proc *p)
+{
+  p->state = RUNNABLE;
+  runqput(&runqs[p->cpu], p);
+}
+
 // Must be called with interrupts disabled to avoid the caller being
 // rescheduled between reading lapicid and running through the loop.
 struct cpu*
@@ -91,6 +659,10 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->nice = p->level = p->slice = 0;
+  p->tickets = p->stride = p->pass = 0;
+  p->sysstat = 0;
+  memset(p->ticks, 0, sizeof(p->ticks));
 
   release(&ptable.lock);
 
@@ -115,14 +687,6 @@ found:
   memset(p->context, 0, sizeof *p->context);
   p->context->eip = (uint)forkret;
 
-  // Initialize mmaps array and num_mmaps field
-  for (int i = 0; i < MAX_MMAPS; i++) {
-    p->mmaps[i].va = 0;  // Initialize virtual address to 0
-    p->mmaps[i].flags = 0;  // Initialize flags to 0
-    p->mmaps[i].length = 0;  // Initialize length to 0
-  }
-  p->num_mmaps = 0;  // Initialize the number of memory mappings to 0
-
   return p;
 }
 
@@ -139,7 +703,11 @@ userinit(void)
   initproc = p;
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
+  if((p->vm = vmspacealloc(p->pgdir)) == 0)
+    panic("userinit: no vmspace");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  if(vdsomap(p->pgdir, p->pid) < 0)
+    panic("userinit: out of memory?");
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
@@ -157,11 +725,74 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(plock(p));
 
-  p->state = RUNNABLE;
+  p->cpu = cpuid();
+  setrunnable(p);
 
-  release(&ptable.lock);
+  release(plock(p));
+}
+
+// Start a kernel thread running fn, which must not return.
+// It is a process with no user half: it runs on the kernel
+// page table and is never reaped.  Returns -1 if out of slots.
+int
+kthread(char *name, void (*fn)(void))
+{
+  extern pde_t *kpgdir;
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  p->pgdir = kpgdir;
+  p->vm = 0;
+  p->sz = 0;
+  p->parent = 0;
+  p->cwd = 0;
+  // forkret() returns into fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(plock(p));
+  p->cpu = cpuid();
+  setrunnable(p);
+  release(plock(p));
+  return 0;
+}
+
+// Copy n bytes between kernel address k and user address uva in
+// address space vm: to user space if out, else from it.  For
+// kernel threads working on a process's behalf (see aio.c); holds
+// vm->lock so sbrk cannot free the pages while they are copied.
+// Returns -1 if any page is not mapped for the user.
+int
+vmcopy(struct vmspace *vm, uint uva, char *k, uint n, int out)
+{
+  char *pa;
+  uint va, m;
+  int r;
+
+  r = 0;
+  acquiresleep(&vm->lock);
+  while(n > 0){
+    va = PGROUNDDOWN(uva);
+    if((pa = uva2ka(vm->pgdir, (char*)va)) == 0){
+      r = -1;
+      break;
+    }
+    m = PGSIZE - (uva - va);
+    if(m > n)
+      m = n;
+    if(out)
+      memmove(pa + (uva - va), k, m);
+    else
+      memmove(k, pa + (uva - va), m);
+    n -= m;
+    k += m;
+    uva += m;
+  }
+  releasesleep(&vm->lock);
+  return r;
 }
 
 // Grow current process's memory by n bytes.
@@ -170,18 +801,30 @@ int
 growproc(int n)
 {
   uint sz;
+  struct proc *p;
   struct proc *curproc = myproc();
 
+  acquiresleep(&curproc->vm->lock);
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      releasesleep(&curproc->vm->lock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = shrinkuvm(curproc->pgdir, sz, sz + n)) == 0){
+      releasesleep(&curproc->vm->lock);
       return -1;
+    }
   }
-  curproc->sz = sz;
-  switchuvm(curproc);
+
+  // Threads share the heap, so they all see the new size.
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    if(p->state != UNUSED && p->vm == curproc->vm)
+      p->sz = sz;
+  release(&ptable.lock);
+  releasesleep(&curproc->vm->lock);
   return 0;
 }
 
@@ -201,7 +844,20 @@ fork(void)
   }
 
   // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  acquiresleep(&curproc->vm->lock);
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0 ||
+     vdsomap(np->pgdir, np->pid) < 0){
+    releasesleep(&curproc->vm->lock);
+    if(np->pgdir)
+      freevm(np->pgdir);
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+  if((np->vm = vmspacealloc(np->pgdir)) == 0){
+    releasesleep(&curproc->vm->lock);
+    freevm(np->pgdir);
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
@@ -209,7 +865,7 @@ fork(void)
   }
 
   for(int i=0; i<MAX_MMAPS; i++) {
-    struct mmap *currMap = &curproc->mmaps[i];
+    struct mmap *currMap = &curproc->vm->mmaps[i];
 
     if(currMap->flags & MAP_SHARED) {
       //TODO: prob need to go through all pages in this mapping
@@ -222,7 +878,7 @@ fork(void)
       if(mappages(np->pgdir, currMap->va, PGSIZE, V2P(physAddr), PTE_W|PTE_U) < 0) {
         cprintf("map pages copy fail\n");
       }
-      np->mmaps[i].isChild = 1;
+      np->vm->mmaps[i].isChild = 1;
     } 
     else if (currMap->flags & MAP_PRIVATE) { //if not map shared, its map private.
       //assuming previous mappings are done correctly, add on map_fixed when calling mmap to get right spot in mem
@@ -235,15 +891,17 @@ fork(void)
       memmove(P2V(newPhysAddr), P2V(parentPhysAddr), PGSIZE);
     }
 
-    np->mmaps[i].fd = curproc->mmaps[i].fd;
-    np->mmaps[i].flags = curproc->mmaps[i].flags;
-    np->mmaps[i].fp = curproc->mmaps[i].fp;
-    np->mmaps[i].length = curproc->mmaps[i].length;
-    np->mmaps[i].offset = curproc->mmaps[i].offset;
-    np->mmaps[i].prot = curproc->mmaps[i].prot;
-    np->mmaps[i].va = curproc->mmaps[i].va;
+    np->vm->mmaps[i].fd = curproc->vm->mmaps[i].fd;
+    np->vm->mmaps[i].flags = curproc->vm->mmaps[i].flags;
+    np->vm->mmaps[i].fp = curproc->vm->mmaps[i].fp;
+    np->vm->mmaps[i].length = curproc->vm->mmaps[i].length;
+    np->vm->mmaps[i].offset = curproc->vm->mmaps[i].offset;
+    np->vm->mmaps[i].prot = curproc->vm->mmaps[i].prot;
+    np->vm->mmaps[i].va = curproc->vm->mmaps[i].va;
 
   }
+  np->vm->num_mmaps = curproc->vm->num_mmaps;
+  releasesleep(&curproc->vm->lock);
 
   np->sz = curproc->sz;
   np->parent = curproc;
@@ -261,11 +919,17 @@ fork(void)
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  // The child starts on this CPU's run queue.
+  acquire(plock(np));
 
-  np->state = RUNNABLE;
+  np->cpu = cpuid();
+  np->nice = np->level = curproc->nice;
+  np->tickets = curproc->tickets;
+  np->stride = curproc->stride;
+  np->pass = curproc->pass;
+  setrunnable(np);
 
-  release(&ptable.lock);
+  release(plock(np));
 
   return pid;
 }
@@ -283,6 +947,10 @@ exit(void)
   if(curproc == initproc)
     panic("init exiting");
 
+  // Wait for asynchronous I/O into our memory to finish.
+  aiodrain(curproc->vm);
+  systraceexit(curproc);
+
   // Close all open files.
   for(fd = 0; fd < NOFILE; fd++){
     if(curproc->ofile[fd]){
@@ -291,14 +959,6 @@ exit(void)
     }
   }
 
-  //remove all mappings that have another reference so OS doesn't free
-  for(int i=0; i<MAX_MMAPS; i++) {
-    struct mmap* currMap = &curproc->mmaps[i];
-    if(currMap->isChild && currMap->flags & MAP_SHARED) { //if shared
-      do_munmap((int)currMap->va, currMap->length);
-    }
-  }
-
   begin_op();
   iput(curproc->cwd);
   end_op();
@@ -318,12 +978,38 @@ exit(void)
     }
   }
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return.  Holding
+  // plock(curproc) until the scheduler has switched away
+  // keeps wait() from freeing our stack under us.
+  acquire(plock(curproc));
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
 
+// Free a ZOMBIE proc's kernel stack and its reference to its
+// address space, and mark it UNUSED.
+// ptable.lock and plock(p) must be held.
+static void
+freeproc(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  if(p->sysstat){
+    kfree((char*)p->sysstat);
+    p->sysstat = 0;
+  }
+  vmspaceput(p->vm);
+  p->vm = 0;
+  p->pgdir = 0;
+  p->pid = 0;
+  p->parent = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+}
+
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
@@ -338,20 +1024,15 @@ wait(void)
     // Scan through table looking for exited children.
     havekids = 0;
     for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+      if(p->parent != curproc || p->vm == curproc->vm)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
-        // Found one.
+        // Found one.  Its plock is held until it is off its CPU.
+        acquire(plock(p));
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        freeproc(p);
+        release(plock(p));
         release(&ptable.lock);
         return pid;
       }
@@ -368,6 +1049,110 @@ wait(void)
   }
 }
 
+// Create a thread: a new process that shares the current process's
+// address space, running fn(arg) on the one-page user stack at
+// stack.  The thread's open files are duplicated from the caller's,
+// so both see the same file offsets.
+// Returns the new thread's pid, or -1 on error.
+int
+clone(void (*fn)(void*), void *stack, void *arg)
+{
+  int i, pid;
+  uint sp, ustack[2];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((uint)stack % PGSIZE != 0 || (uint)stack + PGSIZE > curproc->sz)
+    return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+
+  // Fake return PC, then the argument.
+  ustack[0] = 0xffffffff;
+  ustack[1] = (uint)arg;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    np->state = UNUSED;
+    return -1;
+  }
+
+  np->vm = vmspacedup(curproc->vm);
+  np->pgdir = curproc->pgdir;
+  // The address space now has more than one pid.
+  vdsosetpid(np->pgdir, 0);
+  np->sz = curproc->sz;
+  np->parent = curproc;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = (uint)fn;
+  np->tf->esp = sp;
+  np->tf->eax = 0;
+
+  for(i = 0; i < NOFILE; i++)
+    if(curproc->ofile[i])
+      np->ofile[i] = filedup(curproc->ofile[i]);
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  pid = np->pid;
+
+  // The child starts on this CPU's run queue.
+  acquire(plock(np));
+
+  np->cpu = cpuid();
+  np->nice = np->level = curproc->nice;
+  np->tickets = curproc->tickets;
+  np->stride = curproc->stride;
+  np->pass = curproc->pass;
+  setrunnable(np);
+
+  release(plock(np));
+
+  return pid;
+}
+
+// Wait for a thread created by this process to exit.
+// Stores the user stack that was passed to clone() in *stack
+// and returns the thread's pid, or -1 if there are no threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  int havethreads, pid;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    havethreads = 0;
+    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+      if(p->parent != curproc || p->vm != curproc->vm)
+        continue;
+      havethreads = 1;
+      if(p->state == ZOMBIE){
+        acquire(plock(p));
+        pid = p->pid;
+        *stack = p->ustack;
+        p->ustack = 0;
+        freeproc(p);
+        release(plock(p));
+        release(&ptable.lock);
+        return pid;
+      }
+    }
+
+    if(!havethreads || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+
+    sleep(curproc, &ptable.lock);
+  }
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -381,38 +1166,52 @@ scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  struct runq *rq = &runqs[cpuid()];
+  struct runq *from;
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    // Take the next process from this CPU's run queue.
+    // If there is none, steal half of the busiest queue,
+    // or failing that halt until something happens.
+    if((p = runqget(rq)) == 0){
+      if((from = busiest(rq)) != 0 &&
+         runqmove(from, rq, (from->n + 1) / 2, 0) > 0)
+        rq->steals++;
+      else
+        idle(rq);
+      continue;
     }
-    release(&ptable.lock);
 
+    // A process that just yielded on another CPU may still be
+    // on its way into sched(); its plock is held until it is.
+    acquire(plock(p));
+    if(p->state != RUNNABLE)
+      panic("scheduler: not runnable");
+
+    // Switch to chosen process.  It is the process's job
+    // to release plock(p) and then reacquire it
+    // before jumping back to us.
+    c->proc = p;
+    p->cpu = cpuid();
+    p->lastrun = ticks;
+    switchuvm(p);
+    p->state = RUNNING;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(plock(p));
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only plock(p)
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -425,8 +1224,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(plock(p)))
+    panic("sched plock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -442,10 +1241,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(plock(p));  //DOC: yieldlock
+  setrunnable(p);
   sched();
-  release(&ptable.lock);
+  release(plock(p));
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -454,8 +1255,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding plock from scheduler.
+  release(plock(myproc()));
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -469,12 +1270,33 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+static struct sleepq*
+sleepq(void *chan)
+{
+  return &sleepqs[((uint)chan >> 2) % NSLEEPQ];
+}
+
+// Remove p from its wait queue.  Caller holds p->sq->lock.
+static void
+sleepqunlink(struct proc *p)
+{
+  if(p->sqprev)
+    p->sqprev->sqnext = p->sqnext;
+  else
+    p->sq->head = p->sqnext;
+  if(p->sqnext)
+    p->sqnext->sqprev = p->sqprev;
+  p->sqnext = p->sqprev = 0;
+  p->sq = 0;
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct sleepq *sq;
   
   if(p == 0)
     panic("sleep");
@@ -482,52 +1304,83 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
-  // Go to sleep.
+  // Once p is on the queue and we hold plock(p), we can be
+  // guaranteed that we won't miss any wakeup (wakeup finds p
+  // on the queue and locks p to wake it), so it's okay to
+  // release lk.
+  sq = sleepq(chan);
+  acquire(&sq->lock);  //DOC: sleeplock1
   p->chan = chan;
+  p->sq = sq;
+  p->sqprev = 0;
+  p->sqnext = sq->head;
+  if(sq->head)
+    sq->head->sqprev = p;
+  sq->head = p;
+  acquire(plock(p));
+  release(&sq->lock);
+  release(lk);
+
+  // Go to sleep.
   p->state = SLEEPING;
 
   sched();
 
+  release(plock(p));
+
   // Tidy up.
+  acquire(&sq->lock);
+  if(p->sq)
+    sleepqunlink(p);
   p->chan = 0;
+  release(&sq->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
+// Callers may hold ptable.lock but no plock.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  struct sleepq *sq;
+  struct proc *p, *next;
+
+  sq = sleepq(chan);
+  acquire(&sq->lock);
+  for(p = sq->head; p; p = next){
+    next = p->sqnext;
+    if(p->chan != chan)
+      continue;
+    acquire(plock(p));
+    if(p->state == SLEEPING){
+      sleepqunlink(p);
+      setrunnable(p);
+    }
+    release(plock(p));
+  }
+  release(&sq->lock);
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
   wakeup1(chan);
-  release(&ptable.lock);
+}
+
+// Wake process p if it is sleeping on chan.  Unlike wakeup(),
+// this does not scan the process table; callers that keep their
+// own lists of waiters (see futex.c) use it to wake one in O(1).
+void
+wakeproc(struct proc *p, void *chan)
+{
+  acquire(plock(p));
+  if(p->state == SLEEPING && p->chan == chan)
+    setrunnable(p);
+  release(plock(p));
 }
 
 // Kill the process with the given pid.
@@ -541,10 +1394,12 @@ kill(int pid)
   acquire(&ptable.lock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->pid == pid){
+      acquire(plock(p));
       p->killed = 1;
       // Wake process from sleep if necessary.
       if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+        setrunnable(p);
+      release(plock(p));
       release(&ptable.lock);
       return 0;
     }
@@ -570,9 +1425,16 @@ procdump(void)
   };
   int i;
   struct proc *p;
+  struct runq *rq;
   char *state;
   uint pc[10];
 
+  for(rq = runqs; rq < &runqs[ncpu]; rq++)
+    cprintf("cpu%d: %d queued, %d steals, %d migrations, "
+            "idle %d of %d ticks (%d%% busy)\n",
+            (int)(rq - runqs), rq->n, rq->steals, rq->migrations,
+            rq->nidle, rq->ntick,
+            rq->ntick ? 100 - rq->nidle * 100 / rq->ntick : 0);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->state == UNUSED)
       continue;
@@ -580,7 +1442,10 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    if(p->tickets)
+      cprintf("%d %s %s T%d", p->pid, state, p->name, p->tickets);
+    else
+      cprintf("%d %s %s L%d", p->pid, state, p->name, p->level);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -590,6 +1455,113 @@ procdump(void)
   }
 }
 
+// Add incr to the current process's base priority level,
+// clamped to 0..NMLFQ-1.  Returns the new level.
+int
+nice(int incr)
+{
+  struct proc *p = myproc();
+  int n;
+
+  n = p->nice + incr;
+  if(n < 0)
+    n = 0;
+  if(n >= NMLFQ)
+    n = NMLFQ-1;
+  acquire(plock(p));
+  p->nice = p->level = n;
+  p->slice = 0;
+  release(plock(p));
+  return n;
+}
+
+// Set the base priority level of process pid.
+// The process moves to that level at once.
+int
+setpriority(int pid, int n)
+{
+  struct proc *p;
+
+  if(n < 0 || n >= NMLFQ)
+    return -1;
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      acquire(plock(p));
+      p->nice = p->level = n;
+      p->slice = 0;
+      release(plock(p));
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Put the current process in the stride class with n tickets,
+// or back in the MLFQ if n is 0.
+int
+settickets(int n)
+{
+  struct proc *p = myproc();
+
+  if(n < 0 || n > MAXTICKETS)
+    return -1;
+  acquire(plock(p));
+  if(n > 0 && p->tickets == 0)
+    p->pass = runqs[p->cpu].pass;
+  p->tickets = n;
+  p->stride = n ? STRIDE1 / n : 0;
+  release(plock(p));
+  return 0;
+}
+
+// Fill in st with the scheduling state of every process.
+int
+getpinfo(struct pstat *st)
+{
+  struct proc *p;
+  int i;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    i = p - ptable.proc;
+    st->inuse[i] = p->state != UNUSED;
+    st->pid[i] = p->pid;
+    st->state[i] = p->state;
+    st->nice[i] = p->nice;
+    st->level[i] = p->level;
+    st->tickets[i] = p->tickets;
+    st->pass[i] = p->pass;
+    memmove(st->ticks[i], p->ticks, sizeof(st->ticks[i]));
+  }
+  release(&ptable.lock);
+  return 0;
+}
+
+// Copy the system call statistics of process pid to st
+// (see systrace.c).  Returns -1 if there is no such process.
+int
+procsysstat(int pid, struct sysstat *st)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    if(p->pid == pid && p->state != UNUSED){
+      if(p->sysstat)
+        memmove(st, p->sysstat, sizeof(*st));
+      else
+        memset(st, 0, sizeof(*st));
+      release(&ptable.lock);
+      return 0;
+    }
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
 int find_next_mmap(struct mmap mmaps[], int req_pages, int growsup_flag) {
   struct mmap *min = 0;
   struct mmap prev = (struct mmap) { (void*)(MMAPVIRTBASE - 1) };
@@ -633,7 +1605,7 @@ int find_next_mmap(struct mmap mmaps[], int req_pages, int growsup_flag) {
     }
     else //if last element, need to compare to end of memory instead of next element
     {
-      thisSlotEnd = KERNBASE;
+      thisSlotEnd = AIORING;
     }
 
     uint spaceInSlot = thisSlotEnd - thisSlotStart;
@@ -661,7 +1633,7 @@ int find_next_mmap(struct mmap mmaps[], int req_pages, int growsup_flag) {
   return -1;
 }
 
-int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, struct file* fp, struct proc *curproc)
+static int do_mmap1(int addrInt, int length, int prot, int flags, int fd, int offset, struct file* fp, struct proc *curproc)
 {
     void* addr = (void*) addrInt;
 
@@ -674,9 +1646,9 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
 
   //struct proc *curproc = myproc();
   void *start_addr = (void*)MMAPVIRTBASE;
-  void *end_addr = (void*)KERNBASE;
+  void *end_addr = (void*)AIORING;
 
-  if(curproc->num_mmaps >= 32) {
+  if(curproc->vm->num_mmaps >= 32) {
     cprintf("too many maps\n");
     return -1;
   }
@@ -685,7 +1657,7 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
 
   if (flags & MAP_FIXED) {
 
-    if(addrInt < MMAPVIRTBASE || addrInt > KERNBASE) {
+    if(addrInt < MMAPVIRTBASE || addrInt + PGROUNDUP(length) > AIORING) {
       return -1;
     }
 
@@ -702,7 +1674,7 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
       }
     }
   } else {
-    int next_addr = find_next_mmap(curproc->mmaps, num_pages, 0);
+    int next_addr = find_next_mmap(curproc->vm->mmaps, num_pages, 0);
     //cprintf("\t%p\n", next_addr);
     if(next_addr != -1) {
       start_addr = (void*)next_addr;
@@ -721,12 +1693,12 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
 
   if (flags & MAP_GROWSUP) {
     // Handle the MAP_GROWSUP flag
-    int new_addr = find_next_mmap(curproc->mmaps, num_pages+1, 1); // Check for one page growth
+    int new_addr = find_next_mmap(curproc->vm->mmaps, num_pages+1, 1); // Check for one page growth
     if(new_addr != -1) {
       // Extend the mapping by one page
       num_pages++;
       // Update the length of the existing mapping
-        curproc->mmaps->length += PGSIZE;
+        curproc->vm->mmaps->length += PGSIZE;
     } else {
       // Cannot extend the mapping, handle the error
       handle_page_fault();
@@ -775,11 +1747,11 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
 
 
   // Store the mapping information
-  struct mmap *mmap_entry = 0; //= &curproc->mmaps[curproc->num_mmaps++];
+  struct mmap *mmap_entry = 0; //= &curproc->vm->mmaps[curproc->vm->num_mmaps++];
   int i;
   for(i = 0; i < MAX_MMAPS; i++) {
-    if(curproc->mmaps[i].va == 0) {
-      mmap_entry = &curproc->mmaps[i];
+    if(curproc->vm->mmaps[i].va == 0) {
+      mmap_entry = &curproc->vm->mmaps[i];
       break;
     }
   }
@@ -796,7 +1768,7 @@ int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, st
   
   //cprintf("initialized values\n");
 
-  curproc->num_mmaps++;
+  curproc->vm->num_mmaps++;
   return (int)start_addr; // I think this is the correct cast
 }
 
@@ -810,7 +1782,7 @@ struct file {
   uint off;
 };
 
-int do_munmap(int addrInt, int length)
+static int do_munmap1(int addrInt, int length)
 {
   void* addr;
 
@@ -826,20 +1798,26 @@ int do_munmap(int addrInt, int length)
     return -1; //invalid length
   }
 
+  // Only what mmap() mapped may be unmapped: the vdso pages and
+  // the aio rings above AIORING are the kernel's, and freeing them
+  // here would leave the kernel writing to pages it gave away.
+  if((uint)addr < MMAPVIRTBASE || (uint)addr + length > AIORING ||
+     (uint)addr + length < (uint)addr)
+    return -1;
+
   struct proc *currProc = myproc();
 
   struct file* fp = 0;
+  int found = 0;
   for(int i=0; i<MAX_MMAPS; i++) {
-    if(currProc->mmaps[i].va == addr) {
-      fp = currProc->mmaps[i].fp;
+    if(currProc->vm->mmaps[i].va == addr) {
+      fp = currProc->vm->mmaps[i].fp;
+      found = 1;
       break;
     }
   }
-
-  // if(fp == 0) {
-  //   cprintf("ERROR: fp not gotten\n");
-  //   return -1;
-  // }
+  if(!found)
+    return -1;
 
   cprintf("For addr: %p\n", addr);
 
@@ -862,20 +1840,20 @@ int do_munmap(int addrInt, int length)
 
       int mapIndex = 0;
       for(int i=0; i<MAX_MMAPS; i++) {
-        if(currProc->mmaps[i].va == addr) {
+        if(currProc->vm->mmaps[i].va == addr) {
           mapIndex = i;
         }
       }
-      if(!currProc->mmaps[mapIndex].isChild)
-        kfree(pAddr);
 
-      // Clear the page table entry
-      //*pte &= ~PTE_P;
-      
-
-      *pte &= ~PTE_P;
+      // Clear the page table entry and flush it from every TLB
+      // that may hold it before the page can be reused.
+      *pte = 0;
+      tlbinval(currProc->pgdir, (uint)pageAddr, 1);
       cprintf("After clearing PTE_P, pte[%d] = %x\n", i, *pte);
 
+      if(!currProc->vm->mmaps[mapIndex].isChild)
+        kfree(pAddr);
+
     } else {
       cprintf("PTE note present for the page %d\n", i);
     }
@@ -885,11 +1863,11 @@ int do_munmap(int addrInt, int length)
   cprintf("\n");
 
   // Remove the mmap entry from the struct
-  struct mmap *mmap_entry = 0; //= &curproc->mmaps[curproc->num_mmaps++];
+  struct mmap *mmap_entry = 0; //= &curproc->vm->mmaps[curproc->vm->num_mmaps++];
   int i;
   for(i = 0; i < MAX_MMAPS; i++) {
-    if(currProc->mmaps[i].va == addr) {
-      mmap_entry = &currProc->mmaps[i];
+    if(currProc->vm->mmaps[i].va == addr) {
+      mmap_entry = &currProc->vm->mmaps[i];
       memset((void*)mmap_entry, 0, sizeof(struct mmap));
       break;
     }
@@ -901,10 +1879,34 @@ int do_munmap(int addrInt, int length)
   //   curmap = &p->mmaps[i];
   //   cprintf("[%d]th mmap virtual address: %p, and length: %d\n", i, curmap->va, curmap->length);
   // }
-  currProc->num_mmaps--;
+  currProc->vm->num_mmaps--;
   return 0;
 }
 
+// Map memory into curproc's address space.  The address space's
+// lock keeps threads sharing it from racing on the mapping table.
+int do_mmap(int addrInt, int length, int prot, int flags, int fd, int offset, struct file* fp, struct proc *curproc)
+{
+  int r;
+
+  acquiresleep(&curproc->vm->lock);
+  r = do_mmap1(addrInt, length, prot, flags, fd, offset, fp, curproc);
+  releasesleep(&curproc->vm->lock);
+  return r;
+}
+
+// Unmap memory from the current process's address space.
+int do_munmap(int addrInt, int length)
+{
+  struct vmspace *vm = myproc()->vm;
+  int r;
+
+  acquiresleep(&vm->lock);
+  r = do_munmap1(addrInt, length);
+  releasesleep(&vm->lock);
+  return r;
+}
+
 void handle_page_fault() 
 {
   // PAGE_FAULT_HANDLER:
@@ -61,8 +61,22 @@ struct proc {
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
-  struct mmap mmaps[MAX_MMAPS];  // Array to hold memory mappings
-  int num_mmaps;                 // Number of active memory mappings
+  struct vmspace *vm;          // Address space, shared with threads
+  struct sysstat *sysstat;     // System call counts, or 0 (see systrace.c)
+  void *ustack;                // User stack passed to clone()
+  int cpu;                     // CPU whose run queue p joins when runnable
+  uint lastrun;                // ticks when p was last scheduled
+  struct proc *rqnext;         // Next on run queue
+  struct sleepq *sq;           // Wait queue p is on while sleeping
+  struct proc *sqnext;         // Next and previous on that queue
+  struct proc *sqprev;
+  int nice;                    // Base priority level, 0 highest
+  int level;                   // Current priority level
+  int slice;                   // Ticks used of the current time slice
+  uint ticks[NMLFQ];           // Ticks run at each level
+  int tickets;                 // Stride class share; 0 if in the MLFQ
+  uint stride;                 // STRIDE1 / tickets
+  uint pass;                   // Stride class virtual time
 };
 
 // Process memory is laid out contiguously, low addresses first:
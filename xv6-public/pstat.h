@@ -0,0 +1,13 @@
+// Per-process scheduling state, returned by the getpinfo() system call.
+// Indexed by process table slot; needs param.h.
+
+struct pstat {
+  int inuse[NPROC];          // whether this slot is in use
+  int pid[NPROC];            // process ID
+  int state[NPROC];          // enum procstate
+  int nice[NPROC];           // base priority level, 0 highest
+  int level[NPROC];          // current priority level
+  int tickets[NPROC];        // stride class tickets; 0 if in the MLFQ
+  uint pass[NPROC];          // stride class pass
+  uint ticks[NPROC][NMLFQ];  // ticks run at each level
+};
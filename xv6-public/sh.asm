@@ -0,0 +1,3535 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  static char buf[100];
+  int fd;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+      11:	eb 0e                	jmp    21 <main+0x21>
+      13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      17:	90                   	nop
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f 96 00 00 00    	jg     b7 <main+0xb7>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 01 1a 00 00       	push   $0x1a01
+      2b:	e8 b7 11 00 00       	call   11e7 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	eb 2e                	jmp    67 <main+0x67>
+      39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      40:	80 3d 62 22 00 00 20 	cmpb   $0x20,0x2262
+      47:	0f 84 8d 00 00 00    	je     da <main+0xda>
+      4d:	8d 76 00             	lea    0x0(%esi),%esi
+int
+fork1(void)
+{
+  int pid;
+
+  pid = fork();
+      50:	e8 a8 10 00 00       	call   10fd <fork>
+  if(pid == -1)
+      55:	83 f8 ff             	cmp    $0xffffffff,%eax
+      58:	0f 84 c1 00 00 00    	je     11f <main+0x11f>
+    if(fork1() == 0)
+      5e:	85 c0                	test   %eax,%eax
+      60:	74 63                	je     c5 <main+0xc5>
+    wait();
+      62:	e8 ca 10 00 00       	call   1131 <wait>
+  printf(2, "$ ");
+      67:	83 ec 08             	sub    $0x8,%esp
+      6a:	68 60 19 00 00       	push   $0x1960
+      6f:	6a 02                	push   $0x2
+      71:	e8 0a 15 00 00       	call   1580 <printf>
+  memset(buf, 0, nbuf);
+      76:	83 c4 0c             	add    $0xc,%esp
+      79:	6a 64                	push   $0x64
+      7b:	6a 00                	push   $0x0
+      7d:	68 60 22 00 00       	push   $0x2260
+      82:	e8 09 0c 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+      87:	58                   	pop    %eax
+      88:	5a                   	pop    %edx
+      89:	6a 64                	push   $0x64
+      8b:	68 60 22 00 00       	push   $0x2260
+      90:	e8 5b 0c 00 00       	call   cf0 <gets>
+  if(buf[0] == 0) // EOF
+      95:	0f b6 05 60 22 00 00 	movzbl 0x2260,%eax
+      9c:	83 c4 10             	add    $0x10,%esp
+      9f:	84 c0                	test   %al,%al
+      a1:	74 0f                	je     b2 <main+0xb2>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      a3:	3c 63                	cmp    $0x63,%al
+      a5:	75 a9                	jne    50 <main+0x50>
+      a7:	80 3d 61 22 00 00 64 	cmpb   $0x64,0x2261
+      ae:	75 a0                	jne    50 <main+0x50>
+      b0:	eb 8e                	jmp    40 <main+0x40>
+  exit();
+      b2:	e8 60 10 00 00       	call   1117 <exit>
+      close(fd);
+      b7:	83 ec 0c             	sub    $0xc,%esp
+      ba:	50                   	push   %eax
+      bb:	e8 d9 10 00 00       	call   1199 <close>
+      break;
+      c0:	83 c4 10             	add    $0x10,%esp
+      c3:	eb a2                	jmp    67 <main+0x67>
+      runcmd(parsecmd(buf));
+      c5:	83 ec 0c             	sub    $0xc,%esp
+      c8:	68 60 22 00 00       	push   $0x2260
+      cd:	e8 8e 0a 00 00       	call   b60 <parsecmd>
+      d2:	89 04 24             	mov    %eax,(%esp)
+      d5:	e8 d6 00 00 00       	call   1b0 <runcmd>
+      buf[strlen(buf)-1] = 0;  // chop \n
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 60 22 00 00       	push   $0x2260
+      e2:	e8 79 0b 00 00       	call   c60 <strlen>
+      if(chdir(buf+3) < 0)
+      e7:	c7 04 24 63 22 00 00 	movl   $0x2263,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      ee:	c6 80 5f 22 00 00 00 	movb   $0x0,0x225f(%eax)
+      if(chdir(buf+3) < 0)
+      f5:	e8 89 11 00 00       	call   1283 <chdir>
+      fa:	83 c4 10             	add    $0x10,%esp
+      fd:	85 c0                	test   %eax,%eax
+      ff:	0f 89 62 ff ff ff    	jns    67 <main+0x67>
+        printf(2, "cannot cd %s\n", buf+3);
+     105:	51                   	push   %ecx
+     106:	68 63 22 00 00       	push   $0x2263
+     10b:	68 09 1a 00 00       	push   $0x1a09
+     110:	6a 02                	push   $0x2
+     112:	e8 69 14 00 00       	call   1580 <printf>
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	e9 48 ff ff ff       	jmp    67 <main+0x67>
+    panic("fork");
+     11f:	83 ec 0c             	sub    $0xc,%esp
+     122:	68 63 19 00 00       	push   $0x1963
+     127:	e8 44 00 00 00       	call   170 <panic>
+     12c:	66 90                	xchg   %ax,%ax
+     12e:	66 90                	xchg   %ax,%ax
+
+00000130 <getcmd>:
+{
+     130:	55                   	push   %ebp
+     131:	89 e5                	mov    %esp,%ebp
+     133:	56                   	push   %esi
+     134:	53                   	push   %ebx
+     135:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     138:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 60 19 00 00       	push   $0x1960
+     143:	6a 02                	push   $0x2
+     145:	e8 36 14 00 00       	call   1580 <printf>
+  memset(buf, 0, nbuf);
+     14a:	83 c4 0c             	add    $0xc,%esp
+     14d:	56                   	push   %esi
+     14e:	6a 00                	push   $0x0
+     150:	53                   	push   %ebx
+     151:	e8 3a 0b 00 00       	call   c90 <memset>
+  gets(buf, nbuf);
+     156:	58                   	pop    %eax
+     157:	5a                   	pop    %edx
+     158:	56                   	push   %esi
+     159:	53                   	push   %ebx
+     15a:	e8 91 0b 00 00       	call   cf0 <gets>
+  if(buf[0] == 0) // EOF
+     15f:	83 c4 10             	add    $0x10,%esp
+     162:	80 3b 01             	cmpb   $0x1,(%ebx)
+     165:	19 c0                	sbb    %eax,%eax
+}
+     167:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     16a:	5b                   	pop    %ebx
+     16b:	5e                   	pop    %esi
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+     16e:	66 90                	xchg   %ax,%ax
+
+00000170 <panic>:
+{
+     170:	55                   	push   %ebp
+     171:	89 e5                	mov    %esp,%ebp
+     173:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     176:	ff 75 08             	push   0x8(%ebp)
+     179:	68 fd 19 00 00       	push   $0x19fd
+     17e:	6a 02                	push   $0x2
+     180:	e8 fb 13 00 00       	call   1580 <printf>
+  exit();
+     185:	e8 8d 0f 00 00       	call   1117 <exit>
+     18a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000190 <fork1>:
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	83 ec 08             	sub    $0x8,%esp
+  pid = fork();
+     196:	e8 62 0f 00 00       	call   10fd <fork>
+  if(pid == -1)
+     19b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     19e:	74 02                	je     1a2 <fork1+0x12>
+  return pid;
+}
+     1a0:	c9                   	leave
+     1a1:	c3                   	ret
+    panic("fork");
+     1a2:	83 ec 0c             	sub    $0xc,%esp
+     1a5:	68 63 19 00 00       	push   $0x1963
+     1aa:	e8 c1 ff ff ff       	call   170 <panic>
+     1af:	90                   	nop
+
+000001b0 <runcmd>:
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	83 ec 14             	sub    $0x14,%esp
+     1b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1ba:	85 db                	test   %ebx,%ebx
+     1bc:	74 42                	je     200 <runcmd+0x50>
+  switch(cmd->type){
+     1be:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1c1:	0f 87 e3 00 00 00    	ja     2aa <runcmd+0xfa>
+     1c7:	8b 03                	mov    (%ebx),%eax
+     1c9:	ff 24 85 18 1a 00 00 	jmp    *0x1a18(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1d0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1d3:	85 c0                	test   %eax,%eax
+     1d5:	74 29                	je     200 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     1d7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1da:	51                   	push   %ecx
+     1db:	51                   	push   %ecx
+     1dc:	52                   	push   %edx
+     1dd:	50                   	push   %eax
+     1de:	e8 ea 0f 00 00       	call   11cd <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1e3:	83 c4 0c             	add    $0xc,%esp
+     1e6:	ff 73 04             	push   0x4(%ebx)
+     1e9:	68 6f 19 00 00       	push   $0x196f
+     1ee:	6a 02                	push   $0x2
+     1f0:	e8 8b 13 00 00       	call   1580 <printf>
+    break;
+     1f5:	83 c4 10             	add    $0x10,%esp
+     1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ff:	90                   	nop
+    exit();
+     200:	e8 12 0f 00 00       	call   1117 <exit>
+    if(fork1() == 0)
+     205:	e8 86 ff ff ff       	call   190 <fork1>
+     20a:	85 c0                	test   %eax,%eax
+     20c:	75 f2                	jne    200 <runcmd+0x50>
+     20e:	e9 8c 00 00 00       	jmp    29f <runcmd+0xef>
+    if(pipe(p) < 0)
+     213:	83 ec 0c             	sub    $0xc,%esp
+     216:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     219:	50                   	push   %eax
+     21a:	e8 2c 0f 00 00       	call   114b <pipe>
+     21f:	83 c4 10             	add    $0x10,%esp
+     222:	85 c0                	test   %eax,%eax
+     224:	0f 88 a2 00 00 00    	js     2cc <runcmd+0x11c>
+    if(fork1() == 0){
+     22a:	e8 61 ff ff ff       	call   190 <fork1>
+     22f:	85 c0                	test   %eax,%eax
+     231:	0f 84 a2 00 00 00    	je     2d9 <runcmd+0x129>
+    if(fork1() == 0){
+     237:	e8 54 ff ff ff       	call   190 <fork1>
+     23c:	85 c0                	test   %eax,%eax
+     23e:	0f 84 c3 00 00 00    	je     307 <runcmd+0x157>
+    close(p[0]);
+     244:	83 ec 0c             	sub    $0xc,%esp
+     247:	ff 75 f0             	push   -0x10(%ebp)
+     24a:	e8 4a 0f 00 00       	call   1199 <close>
+    close(p[1]);
+     24f:	58                   	pop    %eax
+     250:	ff 75 f4             	push   -0xc(%ebp)
+     253:	e8 41 0f 00 00       	call   1199 <close>
+    wait();
+     258:	e8 d4 0e 00 00       	call   1131 <wait>
+    wait();
+     25d:	e8 cf 0e 00 00       	call   1131 <wait>
+    break;
+     262:	83 c4 10             	add    $0x10,%esp
+     265:	eb 99                	jmp    200 <runcmd+0x50>
+    if(fork1() == 0)
+     267:	e8 24 ff ff ff       	call   190 <fork1>
+     26c:	85 c0                	test   %eax,%eax
+     26e:	74 2f                	je     29f <runcmd+0xef>
+    wait();
+     270:	e8 bc 0e 00 00       	call   1131 <wait>
+    runcmd(lcmd->right);
+     275:	83 ec 0c             	sub    $0xc,%esp
+     278:	ff 73 08             	push   0x8(%ebx)
+     27b:	e8 30 ff ff ff       	call   1b0 <runcmd>
+    close(rcmd->fd);
+     280:	83 ec 0c             	sub    $0xc,%esp
+     283:	ff 73 14             	push   0x14(%ebx)
+     286:	e8 0e 0f 00 00       	call   1199 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     28b:	58                   	pop    %eax
+     28c:	5a                   	pop    %edx
+     28d:	ff 73 10             	push   0x10(%ebx)
+     290:	ff 73 08             	push   0x8(%ebx)
+     293:	e8 4f 0f 00 00       	call   11e7 <open>
+     298:	83 c4 10             	add    $0x10,%esp
+     29b:	85 c0                	test   %eax,%eax
+     29d:	78 18                	js     2b7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     29f:	83 ec 0c             	sub    $0xc,%esp
+     2a2:	ff 73 04             	push   0x4(%ebx)
+     2a5:	e8 06 ff ff ff       	call   1b0 <runcmd>
+    panic("runcmd");
+     2aa:	83 ec 0c             	sub    $0xc,%esp
+     2ad:	68 68 19 00 00       	push   $0x1968
+     2b2:	e8 b9 fe ff ff       	call   170 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2b7:	51                   	push   %ecx
+     2b8:	ff 73 08             	push   0x8(%ebx)
+     2bb:	68 7f 19 00 00       	push   $0x197f
+     2c0:	6a 02                	push   $0x2
+     2c2:	e8 b9 12 00 00       	call   1580 <printf>
+      exit();
+     2c7:	e8 4b 0e 00 00       	call   1117 <exit>
+      panic("pipe");
+     2cc:	83 ec 0c             	sub    $0xc,%esp
+     2cf:	68 8f 19 00 00       	push   $0x198f
+     2d4:	e8 97 fe ff ff       	call   170 <panic>
+      close(1);
+     2d9:	83 ec 0c             	sub    $0xc,%esp
+     2dc:	6a 01                	push   $0x1
+     2de:	e8 b6 0e 00 00       	call   1199 <close>
+      dup(p[1]);
+     2e3:	58                   	pop    %eax
+     2e4:	ff 75 f4             	push   -0xc(%ebp)
+     2e7:	e8 b1 0f 00 00       	call   129d <dup>
+      close(p[0]);
+     2ec:	58                   	pop    %eax
+     2ed:	ff 75 f0             	push   -0x10(%ebp)
+     2f0:	e8 a4 0e 00 00       	call   1199 <close>
+      close(p[1]);
+     2f5:	58                   	pop    %eax
+     2f6:	ff 75 f4             	push   -0xc(%ebp)
+     2f9:	e8 9b 0e 00 00       	call   1199 <close>
+      runcmd(pcmd->left);
+     2fe:	5a                   	pop    %edx
+     2ff:	ff 73 04             	push   0x4(%ebx)
+     302:	e8 a9 fe ff ff       	call   1b0 <runcmd>
+      close(0);
+     307:	83 ec 0c             	sub    $0xc,%esp
+     30a:	6a 00                	push   $0x0
+     30c:	e8 88 0e 00 00       	call   1199 <close>
+      dup(p[0]);
+     311:	5a                   	pop    %edx
+     312:	ff 75 f0             	push   -0x10(%ebp)
+     315:	e8 83 0f 00 00       	call   129d <dup>
+      close(p[0]);
+     31a:	59                   	pop    %ecx
+     31b:	ff 75 f0             	push   -0x10(%ebp)
+     31e:	e8 76 0e 00 00       	call   1199 <close>
+      close(p[1]);
+     323:	58                   	pop    %eax
+     324:	ff 75 f4             	push   -0xc(%ebp)
+     327:	e8 6d 0e 00 00       	call   1199 <close>
+      runcmd(pcmd->right);
+     32c:	58                   	pop    %eax
+     32d:	ff 73 08             	push   0x8(%ebx)
+     330:	e8 7b fe ff ff       	call   1b0 <runcmd>
+     335:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     33c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     340:	55                   	push   %ebp
+     341:	89 e5                	mov    %esp,%ebp
+     343:	53                   	push   %ebx
+     344:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     347:	6a 54                	push   $0x54
+     349:	e8 72 14 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     34e:	83 c4 0c             	add    $0xc,%esp
+     351:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     353:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     355:	6a 00                	push   $0x0
+     357:	50                   	push   %eax
+     358:	e8 33 09 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     35d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     363:	89 d8                	mov    %ebx,%eax
+     365:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     368:	c9                   	leave
+     369:	c3                   	ret
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     370:	55                   	push   %ebp
+     371:	89 e5                	mov    %esp,%ebp
+     373:	53                   	push   %ebx
+     374:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     377:	6a 18                	push   $0x18
+     379:	e8 42 14 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     37e:	83 c4 0c             	add    $0xc,%esp
+     381:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     383:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     385:	6a 00                	push   $0x0
+     387:	50                   	push   %eax
+     388:	e8 03 09 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     38d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     390:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     396:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     399:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     39f:	8b 45 10             	mov    0x10(%ebp),%eax
+     3a2:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     3a5:	8b 45 14             	mov    0x14(%ebp),%eax
+     3a8:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     3ab:	8b 45 18             	mov    0x18(%ebp),%eax
+     3ae:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3b1:	89 d8                	mov    %ebx,%eax
+     3b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3b6:	c9                   	leave
+     3b7:	c3                   	ret
+     3b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3bf:	90                   	nop
+
+000003c0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3c0:	55                   	push   %ebp
+     3c1:	89 e5                	mov    %esp,%ebp
+     3c3:	53                   	push   %ebx
+     3c4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3c7:	6a 0c                	push   $0xc
+     3c9:	e8 f2 13 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3ce:	83 c4 0c             	add    $0xc,%esp
+     3d1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3d3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3d5:	6a 00                	push   $0x0
+     3d7:	50                   	push   %eax
+     3d8:	e8 b3 08 00 00       	call   c90 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3e0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3ec:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3ef:	89 d8                	mov    %ebx,%eax
+     3f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3f4:	c9                   	leave
+     3f5:	c3                   	ret
+     3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     400:	55                   	push   %ebp
+     401:	89 e5                	mov    %esp,%ebp
+     403:	53                   	push   %ebx
+     404:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     407:	6a 0c                	push   $0xc
+     409:	e8 b2 13 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     40e:	83 c4 0c             	add    $0xc,%esp
+     411:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     413:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     415:	6a 00                	push   $0x0
+     417:	50                   	push   %eax
+     418:	e8 73 08 00 00       	call   c90 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     41d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     420:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     426:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     429:	8b 45 0c             	mov    0xc(%ebp),%eax
+     42c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     42f:	89 d8                	mov    %ebx,%eax
+     431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     434:	c9                   	leave
+     435:	c3                   	ret
+     436:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     43d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000440 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	53                   	push   %ebx
+     444:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     447:	6a 08                	push   $0x8
+     449:	e8 72 13 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     44e:	83 c4 0c             	add    $0xc,%esp
+     451:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     453:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     455:	6a 00                	push   $0x0
+     457:	50                   	push   %eax
+     458:	e8 33 08 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     45d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     460:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     466:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     469:	89 d8                	mov    %ebx,%eax
+     46b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     46e:	c9                   	leave
+     46f:	c3                   	ret
+
+00000470 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     470:	55                   	push   %ebp
+     471:	89 e5                	mov    %esp,%ebp
+     473:	57                   	push   %edi
+     474:	56                   	push   %esi
+     475:	53                   	push   %ebx
+     476:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     479:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     47c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     47f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     482:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     484:	39 df                	cmp    %ebx,%edi
+     486:	72 0f                	jb     497 <gettoken+0x27>
+     488:	eb 25                	jmp    4af <gettoken+0x3f>
+     48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     490:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     493:	39 fb                	cmp    %edi,%ebx
+     495:	74 18                	je     4af <gettoken+0x3f>
+     497:	0f be 07             	movsbl (%edi),%eax
+     49a:	83 ec 08             	sub    $0x8,%esp
+     49d:	50                   	push   %eax
+     49e:	68 50 22 00 00       	push   $0x2250
+     4a3:	e8 08 08 00 00       	call   cb0 <strchr>
+     4a8:	83 c4 10             	add    $0x10,%esp
+     4ab:	85 c0                	test   %eax,%eax
+     4ad:	75 e1                	jne    490 <gettoken+0x20>
+  if(q)
+     4af:	85 f6                	test   %esi,%esi
+     4b1:	74 02                	je     4b5 <gettoken+0x45>
+    *q = s;
+     4b3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4b5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4b8:	3c 3c                	cmp    $0x3c,%al
+     4ba:	0f 8f d0 00 00 00    	jg     590 <gettoken+0x120>
+     4c0:	3c 3a                	cmp    $0x3a,%al
+     4c2:	0f 8f bc 00 00 00    	jg     584 <gettoken+0x114>
+     4c8:	84 c0                	test   %al,%al
+     4ca:	75 44                	jne    510 <gettoken+0xa0>
+     4cc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4ce:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4d1:	85 c9                	test   %ecx,%ecx
+     4d3:	74 05                	je     4da <gettoken+0x6a>
+    *eq = s;
+     4d5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4d8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4da:	39 df                	cmp    %ebx,%edi
+     4dc:	72 09                	jb     4e7 <gettoken+0x77>
+     4de:	eb 1f                	jmp    4ff <gettoken+0x8f>
+    s++;
+     4e0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4e3:	39 fb                	cmp    %edi,%ebx
+     4e5:	74 18                	je     4ff <gettoken+0x8f>
+     4e7:	0f be 07             	movsbl (%edi),%eax
+     4ea:	83 ec 08             	sub    $0x8,%esp
+     4ed:	50                   	push   %eax
+     4ee:	68 50 22 00 00       	push   $0x2250
+     4f3:	e8 b8 07 00 00       	call   cb0 <strchr>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	75 e1                	jne    4e0 <gettoken+0x70>
+  *ps = s;
+     4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     502:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     504:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     507:	89 f0                	mov    %esi,%eax
+     509:	5b                   	pop    %ebx
+     50a:	5e                   	pop    %esi
+     50b:	5f                   	pop    %edi
+     50c:	5d                   	pop    %ebp
+     50d:	c3                   	ret
+     50e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     510:	79 66                	jns    578 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     512:	39 df                	cmp    %ebx,%edi
+     514:	72 39                	jb     54f <gettoken+0xdf>
+  if(eq)
+     516:	8b 55 14             	mov    0x14(%ebp),%edx
+     519:	85 d2                	test   %edx,%edx
+     51b:	0f 84 b3 00 00 00    	je     5d4 <gettoken+0x164>
+    *eq = s;
+     521:	8b 45 14             	mov    0x14(%ebp),%eax
+     524:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     526:	e9 a9 00 00 00       	jmp    5d4 <gettoken+0x164>
+     52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     52f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     530:	0f be 07             	movsbl (%edi),%eax
+     533:	83 ec 08             	sub    $0x8,%esp
+     536:	50                   	push   %eax
+     537:	68 48 22 00 00       	push   $0x2248
+     53c:	e8 6f 07 00 00       	call   cb0 <strchr>
+     541:	83 c4 10             	add    $0x10,%esp
+     544:	85 c0                	test   %eax,%eax
+     546:	75 1f                	jne    567 <gettoken+0xf7>
+      s++;
+     548:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     54b:	39 fb                	cmp    %edi,%ebx
+     54d:	74 77                	je     5c6 <gettoken+0x156>
+     54f:	0f be 07             	movsbl (%edi),%eax
+     552:	83 ec 08             	sub    $0x8,%esp
+     555:	50                   	push   %eax
+     556:	68 50 22 00 00       	push   $0x2250
+     55b:	e8 50 07 00 00       	call   cb0 <strchr>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	85 c0                	test   %eax,%eax
+     565:	74 c9                	je     530 <gettoken+0xc0>
+    ret = 'a';
+     567:	be 61 00 00 00       	mov    $0x61,%esi
+     56c:	e9 5d ff ff ff       	jmp    4ce <gettoken+0x5e>
+     571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     578:	3c 26                	cmp    $0x26,%al
+     57a:	74 08                	je     584 <gettoken+0x114>
+     57c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     57f:	80 f9 01             	cmp    $0x1,%cl
+     582:	77 8e                	ja     512 <gettoken+0xa2>
+  ret = *s;
+     584:	0f be f0             	movsbl %al,%esi
+    s++;
+     587:	83 c7 01             	add    $0x1,%edi
+    break;
+     58a:	e9 3f ff ff ff       	jmp    4ce <gettoken+0x5e>
+     58f:	90                   	nop
+  switch(*s){
+     590:	3c 3e                	cmp    $0x3e,%al
+     592:	75 1c                	jne    5b0 <gettoken+0x140>
+    if(*s == '>'){
+     594:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     598:	74 1f                	je     5b9 <gettoken+0x149>
+    s++;
+     59a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     59d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     5a2:	e9 27 ff ff ff       	jmp    4ce <gettoken+0x5e>
+     5a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ae:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5b0:	3c 7c                	cmp    $0x7c,%al
+     5b2:	74 d0                	je     584 <gettoken+0x114>
+     5b4:	e9 59 ff ff ff       	jmp    512 <gettoken+0xa2>
+      s++;
+     5b9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5bc:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5c1:	e9 08 ff ff ff       	jmp    4ce <gettoken+0x5e>
+  if(eq)
+     5c6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c9:	85 c0                	test   %eax,%eax
+     5cb:	74 05                	je     5d2 <gettoken+0x162>
+    *eq = s;
+     5cd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5d0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5d2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5d4:	be 61 00 00 00       	mov    $0x61,%esi
+     5d9:	e9 21 ff ff ff       	jmp    4ff <gettoken+0x8f>
+     5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5e0:	55                   	push   %ebp
+     5e1:	89 e5                	mov    %esp,%ebp
+     5e3:	57                   	push   %edi
+     5e4:	56                   	push   %esi
+     5e5:	53                   	push   %ebx
+     5e6:	83 ec 0c             	sub    $0xc,%esp
+     5e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5ef:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     5f1:	39 f3                	cmp    %esi,%ebx
+     5f3:	72 12                	jb     607 <peek+0x27>
+     5f5:	eb 28                	jmp    61f <peek+0x3f>
+     5f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fe:	66 90                	xchg   %ax,%ax
+    s++;
+     600:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     603:	39 de                	cmp    %ebx,%esi
+     605:	74 18                	je     61f <peek+0x3f>
+     607:	0f be 03             	movsbl (%ebx),%eax
+     60a:	83 ec 08             	sub    $0x8,%esp
+     60d:	50                   	push   %eax
+     60e:	68 50 22 00 00       	push   $0x2250
+     613:	e8 98 06 00 00       	call   cb0 <strchr>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	85 c0                	test   %eax,%eax
+     61d:	75 e1                	jne    600 <peek+0x20>
+  *ps = s;
+     61f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     621:	0f be 03             	movsbl (%ebx),%eax
+     624:	31 d2                	xor    %edx,%edx
+     626:	84 c0                	test   %al,%al
+     628:	75 0e                	jne    638 <peek+0x58>
+}
+     62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     62d:	89 d0                	mov    %edx,%eax
+     62f:	5b                   	pop    %ebx
+     630:	5e                   	pop    %esi
+     631:	5f                   	pop    %edi
+     632:	5d                   	pop    %ebp
+     633:	c3                   	ret
+     634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     638:	83 ec 08             	sub    $0x8,%esp
+     63b:	50                   	push   %eax
+     63c:	ff 75 10             	push   0x10(%ebp)
+     63f:	e8 6c 06 00 00       	call   cb0 <strchr>
+     644:	83 c4 10             	add    $0x10,%esp
+     647:	31 d2                	xor    %edx,%edx
+     649:	85 c0                	test   %eax,%eax
+     64b:	0f 95 c2             	setne  %dl
+}
+     64e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     651:	5b                   	pop    %ebx
+     652:	89 d0                	mov    %edx,%eax
+     654:	5e                   	pop    %esi
+     655:	5f                   	pop    %edi
+     656:	5d                   	pop    %ebp
+     657:	c3                   	ret
+     658:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     65f:	90                   	nop
+
+00000660 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	57                   	push   %edi
+     664:	56                   	push   %esi
+     665:	53                   	push   %ebx
+     666:	83 ec 2c             	sub    $0x2c,%esp
+     669:	8b 75 0c             	mov    0xc(%ebp),%esi
+     66c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     66f:	90                   	nop
+     670:	83 ec 04             	sub    $0x4,%esp
+     673:	68 b1 19 00 00       	push   $0x19b1
+     678:	53                   	push   %ebx
+     679:	56                   	push   %esi
+     67a:	e8 61 ff ff ff       	call   5e0 <peek>
+     67f:	83 c4 10             	add    $0x10,%esp
+     682:	85 c0                	test   %eax,%eax
+     684:	0f 84 f6 00 00 00    	je     780 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     68a:	6a 00                	push   $0x0
+     68c:	6a 00                	push   $0x0
+     68e:	53                   	push   %ebx
+     68f:	56                   	push   %esi
+     690:	e8 db fd ff ff       	call   470 <gettoken>
+     695:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     697:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     69a:	50                   	push   %eax
+     69b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     69e:	50                   	push   %eax
+     69f:	53                   	push   %ebx
+     6a0:	56                   	push   %esi
+     6a1:	e8 ca fd ff ff       	call   470 <gettoken>
+     6a6:	83 c4 20             	add    $0x20,%esp
+     6a9:	83 f8 61             	cmp    $0x61,%eax
+     6ac:	0f 85 d9 00 00 00    	jne    78b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6b2:	83 ff 3c             	cmp    $0x3c,%edi
+     6b5:	74 69                	je     720 <parseredirs+0xc0>
+     6b7:	83 ff 3e             	cmp    $0x3e,%edi
+     6ba:	74 05                	je     6c1 <parseredirs+0x61>
+     6bc:	83 ff 2b             	cmp    $0x2b,%edi
+     6bf:	75 af                	jne    670 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6c7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6ca:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6cd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6d0:	6a 18                	push   $0x18
+     6d2:	e8 e9 10 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6d7:	83 c4 0c             	add    $0xc,%esp
+     6da:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6dc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6de:	6a 00                	push   $0x0
+     6e0:	50                   	push   %eax
+     6e1:	e8 aa 05 00 00       	call   c90 <memset>
+  cmd->type = REDIR;
+     6e6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6ef:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     6f2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     6f5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     6f8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     6fb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     6fe:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     705:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     708:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     70f:	89 7d 08             	mov    %edi,0x8(%ebp)
+     712:	e9 59 ff ff ff       	jmp    670 <parseredirs+0x10>
+     717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     723:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     726:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     729:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     72c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     72f:	6a 18                	push   $0x18
+     731:	e8 8a 10 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     736:	83 c4 0c             	add    $0xc,%esp
+     739:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     73b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     73d:	6a 00                	push   $0x0
+     73f:	50                   	push   %eax
+     740:	e8 4b 05 00 00       	call   c90 <memset>
+  cmd->cmd = subcmd;
+     745:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     748:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     74b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     74e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     751:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     757:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     75a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     75d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     760:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     763:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     76a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     771:	e9 fa fe ff ff       	jmp    670 <parseredirs+0x10>
+     776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     77d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     780:	8b 45 08             	mov    0x8(%ebp),%eax
+     783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     786:	5b                   	pop    %ebx
+     787:	5e                   	pop    %esi
+     788:	5f                   	pop    %edi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+      panic("missing file for redirection");
+     78b:	83 ec 0c             	sub    $0xc,%esp
+     78e:	68 94 19 00 00       	push   $0x1994
+     793:	e8 d8 f9 ff ff       	call   170 <panic>
+     798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     79f:	90                   	nop
+
+000007a0 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7a0:	55                   	push   %ebp
+     7a1:	89 e5                	mov    %esp,%ebp
+     7a3:	57                   	push   %edi
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	83 ec 30             	sub    $0x30,%esp
+     7a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     7ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7af:	68 b4 19 00 00       	push   $0x19b4
+     7b4:	56                   	push   %esi
+     7b5:	53                   	push   %ebx
+     7b6:	e8 25 fe ff ff       	call   5e0 <peek>
+     7bb:	83 c4 10             	add    $0x10,%esp
+     7be:	85 c0                	test   %eax,%eax
+     7c0:	0f 85 aa 00 00 00    	jne    870 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7c6:	83 ec 0c             	sub    $0xc,%esp
+     7c9:	89 c7                	mov    %eax,%edi
+     7cb:	6a 54                	push   $0x54
+     7cd:	e8 ee 0f 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7d2:	83 c4 0c             	add    $0xc,%esp
+     7d5:	6a 54                	push   $0x54
+     7d7:	6a 00                	push   $0x0
+     7d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7dc:	50                   	push   %eax
+     7dd:	e8 ae 04 00 00       	call   c90 <memset>
+  cmd->type = EXEC;
+     7e2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7e5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7e8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7ee:	56                   	push   %esi
+     7ef:	53                   	push   %ebx
+     7f0:	50                   	push   %eax
+     7f1:	e8 6a fe ff ff       	call   660 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     7f6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     7f9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7fc:	eb 15                	jmp    813 <parseexec+0x73>
+     7fe:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     800:	83 ec 04             	sub    $0x4,%esp
+     803:	56                   	push   %esi
+     804:	53                   	push   %ebx
+     805:	ff 75 d4             	push   -0x2c(%ebp)
+     808:	e8 53 fe ff ff       	call   660 <parseredirs>
+     80d:	83 c4 10             	add    $0x10,%esp
+     810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     813:	83 ec 04             	sub    $0x4,%esp
+     816:	68 cb 19 00 00       	push   $0x19cb
+     81b:	56                   	push   %esi
+     81c:	53                   	push   %ebx
+     81d:	e8 be fd ff ff       	call   5e0 <peek>
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	85 c0                	test   %eax,%eax
+     827:	75 5f                	jne    888 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     829:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     82c:	50                   	push   %eax
+     82d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     830:	50                   	push   %eax
+     831:	56                   	push   %esi
+     832:	53                   	push   %ebx
+     833:	e8 38 fc ff ff       	call   470 <gettoken>
+     838:	83 c4 10             	add    $0x10,%esp
+     83b:	85 c0                	test   %eax,%eax
+     83d:	74 49                	je     888 <parseexec+0xe8>
+    if(tok != 'a')
+     83f:	83 f8 61             	cmp    $0x61,%eax
+     842:	75 62                	jne    8a6 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     844:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     847:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     84a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     84e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     851:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     855:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     858:	83 ff 0a             	cmp    $0xa,%edi
+     85b:	75 a3                	jne    800 <parseexec+0x60>
+      panic("too many args");
+     85d:	83 ec 0c             	sub    $0xc,%esp
+     860:	68 bd 19 00 00       	push   $0x19bd
+     865:	e8 06 f9 ff ff       	call   170 <panic>
+     86a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     870:	89 75 0c             	mov    %esi,0xc(%ebp)
+     873:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     876:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     879:	5b                   	pop    %ebx
+     87a:	5e                   	pop    %esi
+     87b:	5f                   	pop    %edi
+     87c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     87d:	e9 ae 01 00 00       	jmp    a30 <parseblock>
+     882:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     888:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     88b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     892:	00 
+  cmd->eargv[argc] = 0;
+     893:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     89a:	00 
+}
+     89b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     89e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8a1:	5b                   	pop    %ebx
+     8a2:	5e                   	pop    %esi
+     8a3:	5f                   	pop    %edi
+     8a4:	5d                   	pop    %ebp
+     8a5:	c3                   	ret
+      panic("syntax");
+     8a6:	83 ec 0c             	sub    $0xc,%esp
+     8a9:	68 b6 19 00 00       	push   $0x19b6
+     8ae:	e8 bd f8 ff ff       	call   170 <panic>
+     8b3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008c0 <parsepipe>:
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	57                   	push   %edi
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+     8c6:	83 ec 14             	sub    $0x14,%esp
+     8c9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8cc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8cf:	57                   	push   %edi
+     8d0:	56                   	push   %esi
+     8d1:	e8 ca fe ff ff       	call   7a0 <parseexec>
+  if(peek(ps, es, "|")){
+     8d6:	83 c4 0c             	add    $0xc,%esp
+     8d9:	68 d0 19 00 00       	push   $0x19d0
+  cmd = parseexec(ps, es);
+     8de:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8e0:	57                   	push   %edi
+     8e1:	56                   	push   %esi
+     8e2:	e8 f9 fc ff ff       	call   5e0 <peek>
+     8e7:	83 c4 10             	add    $0x10,%esp
+     8ea:	85 c0                	test   %eax,%eax
+     8ec:	75 12                	jne    900 <parsepipe+0x40>
+}
+     8ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8f1:	89 d8                	mov    %ebx,%eax
+     8f3:	5b                   	pop    %ebx
+     8f4:	5e                   	pop    %esi
+     8f5:	5f                   	pop    %edi
+     8f6:	5d                   	pop    %ebp
+     8f7:	c3                   	ret
+     8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ff:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     900:	6a 00                	push   $0x0
+     902:	6a 00                	push   $0x0
+     904:	57                   	push   %edi
+     905:	56                   	push   %esi
+     906:	e8 65 fb ff ff       	call   470 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90b:	58                   	pop    %eax
+     90c:	5a                   	pop    %edx
+     90d:	57                   	push   %edi
+     90e:	56                   	push   %esi
+     90f:	e8 ac ff ff ff       	call   8c0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     914:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     91b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     91d:	e8 9e 0e 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     922:	83 c4 0c             	add    $0xc,%esp
+     925:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     927:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     929:	6a 00                	push   $0x0
+     92b:	50                   	push   %eax
+     92c:	e8 5f 03 00 00       	call   c90 <memset>
+  cmd->left = left;
+     931:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     934:	83 c4 10             	add    $0x10,%esp
+     937:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     939:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     93f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     941:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     944:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     947:	5b                   	pop    %ebx
+     948:	5e                   	pop    %esi
+     949:	5f                   	pop    %edi
+     94a:	5d                   	pop    %ebp
+     94b:	c3                   	ret
+     94c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000950 <parseline>:
+{
+     950:	55                   	push   %ebp
+     951:	89 e5                	mov    %esp,%ebp
+     953:	57                   	push   %edi
+     954:	56                   	push   %esi
+     955:	53                   	push   %ebx
+     956:	83 ec 24             	sub    $0x24,%esp
+     959:	8b 75 08             	mov    0x8(%ebp),%esi
+     95c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     95f:	57                   	push   %edi
+     960:	56                   	push   %esi
+     961:	e8 5a ff ff ff       	call   8c0 <parsepipe>
+  while(peek(ps, es, "&")){
+     966:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     969:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     96b:	eb 3b                	jmp    9a8 <parseline+0x58>
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     970:	6a 00                	push   $0x0
+     972:	6a 00                	push   $0x0
+     974:	57                   	push   %edi
+     975:	56                   	push   %esi
+     976:	e8 f5 fa ff ff       	call   470 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     97b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     982:	e8 39 0e 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     987:	83 c4 0c             	add    $0xc,%esp
+     98a:	6a 08                	push   $0x8
+     98c:	6a 00                	push   $0x0
+     98e:	50                   	push   %eax
+     98f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     992:	e8 f9 02 00 00       	call   c90 <memset>
+  cmd->type = BACK;
+     997:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     99a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     99d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     9a3:	89 5a 04             	mov    %ebx,0x4(%edx)
+     9a6:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     9a8:	83 ec 04             	sub    $0x4,%esp
+     9ab:	68 d2 19 00 00       	push   $0x19d2
+     9b0:	57                   	push   %edi
+     9b1:	56                   	push   %esi
+     9b2:	e8 29 fc ff ff       	call   5e0 <peek>
+     9b7:	83 c4 10             	add    $0x10,%esp
+     9ba:	85 c0                	test   %eax,%eax
+     9bc:	75 b2                	jne    970 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9be:	83 ec 04             	sub    $0x4,%esp
+     9c1:	68 ce 19 00 00       	push   $0x19ce
+     9c6:	57                   	push   %edi
+     9c7:	56                   	push   %esi
+     9c8:	e8 13 fc ff ff       	call   5e0 <peek>
+     9cd:	83 c4 10             	add    $0x10,%esp
+     9d0:	85 c0                	test   %eax,%eax
+     9d2:	75 0c                	jne    9e0 <parseline+0x90>
+}
+     9d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9d7:	89 d8                	mov    %ebx,%eax
+     9d9:	5b                   	pop    %ebx
+     9da:	5e                   	pop    %esi
+     9db:	5f                   	pop    %edi
+     9dc:	5d                   	pop    %ebp
+     9dd:	c3                   	ret
+     9de:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9e0:	6a 00                	push   $0x0
+     9e2:	6a 00                	push   $0x0
+     9e4:	57                   	push   %edi
+     9e5:	56                   	push   %esi
+     9e6:	e8 85 fa ff ff       	call   470 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9eb:	58                   	pop    %eax
+     9ec:	5a                   	pop    %edx
+     9ed:	57                   	push   %edi
+     9ee:	56                   	push   %esi
+     9ef:	e8 5c ff ff ff       	call   950 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     9f4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     9fb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     9fd:	e8 be 0d 00 00       	call   17c0 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     a02:	83 c4 0c             	add    $0xc,%esp
+     a05:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     a07:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     a09:	6a 00                	push   $0x0
+     a0b:	50                   	push   %eax
+     a0c:	e8 7f 02 00 00       	call   c90 <memset>
+  cmd->left = left;
+     a11:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a14:	83 c4 10             	add    $0x10,%esp
+     a17:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a19:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a1f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a21:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a27:	5b                   	pop    %ebx
+     a28:	5e                   	pop    %esi
+     a29:	5f                   	pop    %edi
+     a2a:	5d                   	pop    %ebp
+     a2b:	c3                   	ret
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <parseblock>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 10             	sub    $0x10,%esp
+     a39:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a3c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a3f:	68 b4 19 00 00       	push   $0x19b4
+     a44:	56                   	push   %esi
+     a45:	53                   	push   %ebx
+     a46:	e8 95 fb ff ff       	call   5e0 <peek>
+     a4b:	83 c4 10             	add    $0x10,%esp
+     a4e:	85 c0                	test   %eax,%eax
+     a50:	74 4a                	je     a9c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a52:	6a 00                	push   $0x0
+     a54:	6a 00                	push   $0x0
+     a56:	56                   	push   %esi
+     a57:	53                   	push   %ebx
+     a58:	e8 13 fa ff ff       	call   470 <gettoken>
+  cmd = parseline(ps, es);
+     a5d:	58                   	pop    %eax
+     a5e:	5a                   	pop    %edx
+     a5f:	56                   	push   %esi
+     a60:	53                   	push   %ebx
+     a61:	e8 ea fe ff ff       	call   950 <parseline>
+  if(!peek(ps, es, ")"))
+     a66:	83 c4 0c             	add    $0xc,%esp
+     a69:	68 f0 19 00 00       	push   $0x19f0
+  cmd = parseline(ps, es);
+     a6e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a70:	56                   	push   %esi
+     a71:	53                   	push   %ebx
+     a72:	e8 69 fb ff ff       	call   5e0 <peek>
+     a77:	83 c4 10             	add    $0x10,%esp
+     a7a:	85 c0                	test   %eax,%eax
+     a7c:	74 2b                	je     aa9 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a7e:	6a 00                	push   $0x0
+     a80:	6a 00                	push   $0x0
+     a82:	56                   	push   %esi
+     a83:	53                   	push   %ebx
+     a84:	e8 e7 f9 ff ff       	call   470 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a89:	83 c4 0c             	add    $0xc,%esp
+     a8c:	56                   	push   %esi
+     a8d:	53                   	push   %ebx
+     a8e:	57                   	push   %edi
+     a8f:	e8 cc fb ff ff       	call   660 <parseredirs>
+}
+     a94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a97:	5b                   	pop    %ebx
+     a98:	5e                   	pop    %esi
+     a99:	5f                   	pop    %edi
+     a9a:	5d                   	pop    %ebp
+     a9b:	c3                   	ret
+    panic("parseblock");
+     a9c:	83 ec 0c             	sub    $0xc,%esp
+     a9f:	68 d4 19 00 00       	push   $0x19d4
+     aa4:	e8 c7 f6 ff ff       	call   170 <panic>
+    panic("syntax - missing )");
+     aa9:	83 ec 0c             	sub    $0xc,%esp
+     aac:	68 df 19 00 00       	push   $0x19df
+     ab1:	e8 ba f6 ff ff       	call   170 <panic>
+     ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ac0:	55                   	push   %ebp
+     ac1:	89 e5                	mov    %esp,%ebp
+     ac3:	53                   	push   %ebx
+     ac4:	83 ec 04             	sub    $0x4,%esp
+     ac7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aca:	85 db                	test   %ebx,%ebx
+     acc:	0f 84 7e 00 00 00    	je     b50 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ad2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ad5:	77 20                	ja     af7 <nulterminate+0x37>
+     ad7:	8b 03                	mov    (%ebx),%eax
+     ad9:	ff 24 85 30 1a 00 00 	jmp    *0x1a30(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ae0:	83 ec 0c             	sub    $0xc,%esp
+     ae3:	ff 73 04             	push   0x4(%ebx)
+     ae6:	e8 d5 ff ff ff       	call   ac0 <nulterminate>
+    nulterminate(lcmd->right);
+     aeb:	58                   	pop    %eax
+     aec:	ff 73 08             	push   0x8(%ebx)
+     aef:	e8 cc ff ff ff       	call   ac0 <nulterminate>
+    break;
+     af4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     af7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     af9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     afc:	c9                   	leave
+     afd:	c3                   	ret
+     afe:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     b00:	83 ec 0c             	sub    $0xc,%esp
+     b03:	ff 73 04             	push   0x4(%ebx)
+     b06:	e8 b5 ff ff ff       	call   ac0 <nulterminate>
+    break;
+     b0b:	83 c4 10             	add    $0x10,%esp
+     b0e:	eb e7                	jmp    af7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b10:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b13:	8d 43 08             	lea    0x8(%ebx),%eax
+     b16:	85 c9                	test   %ecx,%ecx
+     b18:	74 dd                	je     af7 <nulterminate+0x37>
+     b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b20:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b23:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b26:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b29:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b2c:	85 d2                	test   %edx,%edx
+     b2e:	75 f0                	jne    b20 <nulterminate+0x60>
+     b30:	eb c5                	jmp    af7 <nulterminate+0x37>
+     b32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b38:	83 ec 0c             	sub    $0xc,%esp
+     b3b:	ff 73 04             	push   0x4(%ebx)
+     b3e:	e8 7d ff ff ff       	call   ac0 <nulterminate>
+    *rcmd->efile = 0;
+     b43:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b46:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b49:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b4c:	eb a9                	jmp    af7 <nulterminate+0x37>
+     b4e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b50:	31 c0                	xor    %eax,%eax
+     b52:	eb a5                	jmp    af9 <nulterminate+0x39>
+     b54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+
+00000b60 <parsecmd>:
+{
+     b60:	55                   	push   %ebp
+     b61:	89 e5                	mov    %esp,%ebp
+     b63:	57                   	push   %edi
+     b64:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b65:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b68:	53                   	push   %ebx
+     b69:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b6f:	53                   	push   %ebx
+     b70:	e8 eb 00 00 00       	call   c60 <strlen>
+  cmd = parseline(&s, es);
+     b75:	59                   	pop    %ecx
+     b76:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b77:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b79:	53                   	push   %ebx
+     b7a:	57                   	push   %edi
+     b7b:	e8 d0 fd ff ff       	call   950 <parseline>
+  peek(&s, es, "");
+     b80:	83 c4 0c             	add    $0xc,%esp
+     b83:	68 7e 19 00 00       	push   $0x197e
+  cmd = parseline(&s, es);
+     b88:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b8a:	53                   	push   %ebx
+     b8b:	57                   	push   %edi
+     b8c:	e8 4f fa ff ff       	call   5e0 <peek>
+  if(s != es){
+     b91:	8b 45 08             	mov    0x8(%ebp),%eax
+     b94:	83 c4 10             	add    $0x10,%esp
+     b97:	39 d8                	cmp    %ebx,%eax
+     b99:	75 13                	jne    bae <parsecmd+0x4e>
+  nulterminate(cmd);
+     b9b:	83 ec 0c             	sub    $0xc,%esp
+     b9e:	56                   	push   %esi
+     b9f:	e8 1c ff ff ff       	call   ac0 <nulterminate>
+}
+     ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ba7:	89 f0                	mov    %esi,%eax
+     ba9:	5b                   	pop    %ebx
+     baa:	5e                   	pop    %esi
+     bab:	5f                   	pop    %edi
+     bac:	5d                   	pop    %ebp
+     bad:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bae:	52                   	push   %edx
+     baf:	50                   	push   %eax
+     bb0:	68 f2 19 00 00       	push   $0x19f2
+     bb5:	6a 02                	push   $0x2
+     bb7:	e8 c4 09 00 00       	call   1580 <printf>
+    panic("syntax");
+     bbc:	c7 04 24 b6 19 00 00 	movl   $0x19b6,(%esp)
+     bc3:	e8 a8 f5 ff ff       	call   170 <panic>
+     bc8:	66 90                	xchg   %ax,%ax
+     bca:	66 90                	xchg   %ax,%ax
+     bcc:	66 90                	xchg   %ax,%ax
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     bd0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     bd1:	31 c0                	xor    %eax,%eax
+{
+     bd3:	89 e5                	mov    %esp,%ebp
+     bd5:	53                   	push   %ebx
+     bd6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     bd9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     be0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     be4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     be7:	83 c0 01             	add    $0x1,%eax
+     bea:	84 d2                	test   %dl,%dl
+     bec:	75 f2                	jne    be0 <strcpy+0x10>
+    ;
+  return os;
+}
+     bee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bf1:	89 c8                	mov    %ecx,%eax
+     bf3:	c9                   	leave
+     bf4:	c3                   	ret
+     bf5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c00 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	53                   	push   %ebx
+     c04:	8b 55 08             	mov    0x8(%ebp),%edx
+     c07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c0a:	0f b6 02             	movzbl (%edx),%eax
+     c0d:	84 c0                	test   %al,%al
+     c0f:	75 17                	jne    c28 <strcmp+0x28>
+     c11:	eb 3a                	jmp    c4d <strcmp+0x4d>
+     c13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c17:	90                   	nop
+     c18:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c1c:	83 c2 01             	add    $0x1,%edx
+     c1f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c22:	84 c0                	test   %al,%al
+     c24:	74 1a                	je     c40 <strcmp+0x40>
+    p++, q++;
+     c26:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c28:	0f b6 19             	movzbl (%ecx),%ebx
+     c2b:	38 c3                	cmp    %al,%bl
+     c2d:	74 e9                	je     c18 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c2f:	29 d8                	sub    %ebx,%eax
+}
+     c31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c34:	c9                   	leave
+     c35:	c3                   	ret
+     c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     c40:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     c44:	31 c0                	xor    %eax,%eax
+     c46:	29 d8                	sub    %ebx,%eax
+}
+     c48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c4b:	c9                   	leave
+     c4c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     c4d:	0f b6 19             	movzbl (%ecx),%ebx
+     c50:	31 c0                	xor    %eax,%eax
+     c52:	eb db                	jmp    c2f <strcmp+0x2f>
+     c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c5f:	90                   	nop
+
+00000c60 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     c60:	55                   	push   %ebp
+     c61:	89 e5                	mov    %esp,%ebp
+     c63:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     c66:	80 3a 00             	cmpb   $0x0,(%edx)
+     c69:	74 15                	je     c80 <strlen+0x20>
+     c6b:	31 c0                	xor    %eax,%eax
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+     c70:	83 c0 01             	add    $0x1,%eax
+     c73:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     c77:	89 c1                	mov    %eax,%ecx
+     c79:	75 f5                	jne    c70 <strlen+0x10>
+    ;
+  return n;
+}
+     c7b:	89 c8                	mov    %ecx,%eax
+     c7d:	5d                   	pop    %ebp
+     c7e:	c3                   	ret
+     c7f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     c80:	31 c9                	xor    %ecx,%ecx
+}
+     c82:	5d                   	pop    %ebp
+     c83:	89 c8                	mov    %ecx,%eax
+     c85:	c3                   	ret
+     c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	57                   	push   %edi
+     c94:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     c97:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c9d:	89 d7                	mov    %edx,%edi
+     c9f:	fc                   	cld
+     ca0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     ca2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     ca5:	89 d0                	mov    %edx,%eax
+     ca7:	c9                   	leave
+     ca8:	c3                   	ret
+     ca9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000cb0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	8b 45 08             	mov    0x8(%ebp),%eax
+     cb6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     cba:	0f b6 10             	movzbl (%eax),%edx
+     cbd:	84 d2                	test   %dl,%dl
+     cbf:	75 12                	jne    cd3 <strchr+0x23>
+     cc1:	eb 1d                	jmp    ce0 <strchr+0x30>
+     cc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cc7:	90                   	nop
+     cc8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     ccc:	83 c0 01             	add    $0x1,%eax
+     ccf:	84 d2                	test   %dl,%dl
+     cd1:	74 0d                	je     ce0 <strchr+0x30>
+    if(*s == c)
+     cd3:	38 d1                	cmp    %dl,%cl
+     cd5:	75 f1                	jne    cc8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     cd7:	5d                   	pop    %ebp
+     cd8:	c3                   	ret
+     cd9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     ce0:	31 c0                	xor    %eax,%eax
+}
+     ce2:	5d                   	pop    %ebp
+     ce3:	c3                   	ret
+     ce4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ceb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cef:	90                   	nop
+
+00000cf0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	57                   	push   %edi
+     cf4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     cf5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     cf8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     cf9:	31 db                	xor    %ebx,%ebx
+{
+     cfb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     cfe:	eb 27                	jmp    d27 <gets+0x37>
+    cc = read(0, &c, 1);
+     d00:	83 ec 04             	sub    $0x4,%esp
+     d03:	6a 01                	push   $0x1
+     d05:	56                   	push   %esi
+     d06:	6a 00                	push   $0x0
+     d08:	e8 58 04 00 00       	call   1165 <read>
+    if(cc < 1)
+     d0d:	83 c4 10             	add    $0x10,%esp
+     d10:	85 c0                	test   %eax,%eax
+     d12:	7e 1d                	jle    d31 <gets+0x41>
+      break;
+    buf[i++] = c;
+     d14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d18:	8b 55 08             	mov    0x8(%ebp),%edx
+     d1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d1f:	3c 0a                	cmp    $0xa,%al
+     d21:	74 10                	je     d33 <gets+0x43>
+     d23:	3c 0d                	cmp    $0xd,%al
+     d25:	74 0c                	je     d33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     d27:	89 df                	mov    %ebx,%edi
+     d29:	83 c3 01             	add    $0x1,%ebx
+     d2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d2f:	7c cf                	jl     d00 <gets+0x10>
+     d31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     d33:	8b 45 08             	mov    0x8(%ebp),%eax
+     d36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3d:	5b                   	pop    %ebx
+     d3e:	5e                   	pop    %esi
+     d3f:	5f                   	pop    %edi
+     d40:	5d                   	pop    %ebp
+     d41:	c3                   	ret
+     d42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     d50:	55                   	push   %ebp
+     d51:	89 e5                	mov    %esp,%ebp
+     d53:	56                   	push   %esi
+     d54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     d55:	83 ec 08             	sub    $0x8,%esp
+     d58:	6a 00                	push   $0x0
+     d5a:	ff 75 08             	push   0x8(%ebp)
+     d5d:	e8 85 04 00 00       	call   11e7 <open>
+  if(fd < 0)
+     d62:	83 c4 10             	add    $0x10,%esp
+     d65:	85 c0                	test   %eax,%eax
+     d67:	78 27                	js     d90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     d69:	83 ec 08             	sub    $0x8,%esp
+     d6c:	ff 75 0c             	push   0xc(%ebp)
+     d6f:	89 c3                	mov    %eax,%ebx
+     d71:	50                   	push   %eax
+     d72:	e8 be 04 00 00       	call   1235 <fstat>
+  close(fd);
+     d77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     d7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     d7c:	e8 18 04 00 00       	call   1199 <close>
+  return r;
+     d81:	83 c4 10             	add    $0x10,%esp
+}
+     d84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d87:	89 f0                	mov    %esi,%eax
+     d89:	5b                   	pop    %ebx
+     d8a:	5e                   	pop    %esi
+     d8b:	5d                   	pop    %ebp
+     d8c:	c3                   	ret
+     d8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     d90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d95:	eb ed                	jmp    d84 <stat+0x34>
+     d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	53                   	push   %ebx
+     da4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     da7:	0f be 02             	movsbl (%edx),%eax
+     daa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     dad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     db5:	77 1e                	ja     dd5 <atoi+0x35>
+     db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dbe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     dc0:	83 c2 01             	add    $0x1,%edx
+     dc3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     dc6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     dca:	0f be 02             	movsbl (%edx),%eax
+     dcd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     dd0:	80 fb 09             	cmp    $0x9,%bl
+     dd3:	76 eb                	jbe    dc0 <atoi+0x20>
+  return n;
+}
+     dd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     dd8:	89 c8                	mov    %ecx,%eax
+     dda:	c9                   	leave
+     ddb:	c3                   	ret
+     ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000de0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+     de5:	8b 45 10             	mov    0x10(%ebp),%eax
+     de8:	8b 55 08             	mov    0x8(%ebp),%edx
+     deb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     dee:	85 c0                	test   %eax,%eax
+     df0:	7e 13                	jle    e05 <memmove+0x25>
+     df2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     df4:	89 d7                	mov    %edx,%edi
+     df6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e01:	39 f8                	cmp    %edi,%eax
+     e03:	75 fb                	jne    e00 <memmove+0x20>
+  return vdst;
+}
+     e05:	5e                   	pop    %esi
+     e06:	89 d0                	mov    %edx,%eax
+     e08:	5f                   	pop    %edi
+     e09:	5d                   	pop    %ebp
+     e0a:	c3                   	ret
+     e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+
+00000e10 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     e13:	8b 45 08             	mov    0x8(%ebp),%eax
+     e16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     e1c:	5d                   	pop    %ebp
+     e1d:	c3                   	ret
+     e1e:	66 90                	xchg   %ax,%ax
+
+00000e20 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     e20:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     e21:	31 c0                	xor    %eax,%eax
+     e23:	ba 01 00 00 00       	mov    $0x1,%edx
+     e28:	89 e5                	mov    %esp,%ebp
+     e2a:	56                   	push   %esi
+     e2b:	53                   	push   %ebx
+     e2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     e2f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     e33:	85 c0                	test   %eax,%eax
+     e35:	74 32                	je     e69 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+     e37:	83 f8 02             	cmp    $0x2,%eax
+     e3a:	74 0c                	je     e48 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     e3c:	b8 02 00 00 00       	mov    $0x2,%eax
+     e41:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     e44:	85 c0                	test   %eax,%eax
+     e46:	74 21                	je     e69 <mutex_lock+0x49>
+     e48:	be 02 00 00 00       	mov    $0x2,%esi
+     e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     e50:	83 ec 04             	sub    $0x4,%esp
+     e53:	6a 02                	push   $0x2
+     e55:	6a 00                	push   $0x0
+     e57:	53                   	push   %ebx
+     e58:	e8 2a 05 00 00       	call   1387 <futex>
+     e5d:	89 f0                	mov    %esi,%eax
+     e5f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     e62:	83 c4 10             	add    $0x10,%esp
+     e65:	85 c0                	test   %eax,%eax
+     e67:	75 e7                	jne    e50 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     e69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e6c:	5b                   	pop    %ebx
+     e6d:	5e                   	pop    %esi
+     e6e:	5d                   	pop    %ebp
+     e6f:	c3                   	ret
+
+00000e70 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     e70:	55                   	push   %ebp
+     e71:	31 c0                	xor    %eax,%eax
+     e73:	89 e5                	mov    %esp,%ebp
+     e75:	83 ec 08             	sub    $0x8,%esp
+     e78:	8b 55 08             	mov    0x8(%ebp),%edx
+     e7b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     e7e:	83 f8 02             	cmp    $0x2,%eax
+     e81:	74 05                	je     e88 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     e83:	c9                   	leave
+     e84:	c3                   	ret
+     e85:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     e88:	83 ec 04             	sub    $0x4,%esp
+     e8b:	6a 01                	push   $0x1
+     e8d:	6a 01                	push   $0x1
+     e8f:	52                   	push   %edx
+     e90:	e8 f2 04 00 00       	call   1387 <futex>
+     e95:	83 c4 10             	add    $0x10,%esp
+}
+     e98:	c9                   	leave
+     e99:	c3                   	ret
+     e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ea0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     ea0:	55                   	push   %ebp
+     ea1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     ea3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     eac:	5d                   	pop    %ebp
+     ead:	c3                   	ret
+     eae:	66 90                	xchg   %ax,%ax
+
+00000eb0 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	31 c0                	xor    %eax,%eax
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	57                   	push   %edi
+     eb6:	56                   	push   %esi
+     eb7:	53                   	push   %ebx
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+     ebb:	8b 75 08             	mov    0x8(%ebp),%esi
+     ebe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     ec1:	8b 3e                	mov    (%esi),%edi
+     ec3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     ec6:	83 f8 02             	cmp    $0x2,%eax
+     ec9:	74 5d                	je     f28 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     ecb:	83 ec 04             	sub    $0x4,%esp
+     ece:	57                   	push   %edi
+     ecf:	6a 00                	push   $0x0
+     ed1:	56                   	push   %esi
+     ed2:	e8 b0 04 00 00       	call   1387 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+     ed7:	31 c0                	xor    %eax,%eax
+     ed9:	ba 01 00 00 00       	mov    $0x1,%edx
+     ede:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     ee2:	83 c4 10             	add    $0x10,%esp
+     ee5:	85 c0                	test   %eax,%eax
+     ee7:	74 30                	je     f19 <cond_wait+0x69>
+  if(c != 2)
+     ee9:	83 f8 02             	cmp    $0x2,%eax
+     eec:	74 0c                	je     efa <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+     eee:	b8 02 00 00 00       	mov    $0x2,%eax
+     ef3:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     ef6:	85 c0                	test   %eax,%eax
+     ef8:	74 1f                	je     f19 <cond_wait+0x69>
+     efa:	be 02 00 00 00       	mov    $0x2,%esi
+     eff:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+     f00:	83 ec 04             	sub    $0x4,%esp
+     f03:	6a 02                	push   $0x2
+     f05:	6a 00                	push   $0x0
+     f07:	53                   	push   %ebx
+     f08:	e8 7a 04 00 00       	call   1387 <futex>
+     f0d:	89 f0                	mov    %esi,%eax
+     f0f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     f12:	83 c4 10             	add    $0x10,%esp
+     f15:	85 c0                	test   %eax,%eax
+     f17:	75 e7                	jne    f00 <cond_wait+0x50>
+  mutex_lock(m);
+}
+     f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f1c:	5b                   	pop    %ebx
+     f1d:	5e                   	pop    %esi
+     f1e:	5f                   	pop    %edi
+     f1f:	5d                   	pop    %ebp
+     f20:	c3                   	ret
+     f21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     f28:	83 ec 04             	sub    $0x4,%esp
+     f2b:	6a 01                	push   $0x1
+     f2d:	6a 01                	push   $0x1
+     f2f:	53                   	push   %ebx
+     f30:	e8 52 04 00 00       	call   1387 <futex>
+     f35:	83 c4 10             	add    $0x10,%esp
+     f38:	eb 91                	jmp    ecb <cond_wait+0x1b>
+     f3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f40 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+     f40:	55                   	push   %ebp
+     f41:	89 e5                	mov    %esp,%ebp
+     f43:	53                   	push   %ebx
+     f44:	83 ec 04             	sub    $0x4,%esp
+     f47:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     f50:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     f52:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+     f55:	89 c8                	mov    %ecx,%eax
+     f57:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     f5b:	39 c1                	cmp    %eax,%ecx
+     f5d:	75 f1                	jne    f50 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+     f5f:	83 ec 04             	sub    $0x4,%esp
+     f62:	6a 01                	push   $0x1
+     f64:	6a 01                	push   $0x1
+     f66:	52                   	push   %edx
+     f67:	e8 1b 04 00 00       	call   1387 <futex>
+}
+     f6c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f6f:	83 c4 10             	add    $0x10,%esp
+     f72:	c9                   	leave
+     f73:	c3                   	ret
+     f74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f7f:	90                   	nop
+
+00000f80 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     f80:	55                   	push   %ebp
+     f81:	89 e5                	mov    %esp,%ebp
+     f83:	53                   	push   %ebx
+     f84:	83 ec 04             	sub    $0x4,%esp
+     f87:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     f8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     f90:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     f92:	8d 59 01             	lea    0x1(%ecx),%ebx
+     f95:	89 c8                	mov    %ecx,%eax
+     f97:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     f9b:	39 c1                	cmp    %eax,%ecx
+     f9d:	75 f1                	jne    f90 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     f9f:	83 ec 04             	sub    $0x4,%esp
+     fa2:	6a 40                	push   $0x40
+     fa4:	6a 01                	push   $0x1
+     fa6:	52                   	push   %edx
+     fa7:	e8 db 03 00 00       	call   1387 <futex>
+}
+     fac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     faf:	83 c4 10             	add    $0x10,%esp
+     fb2:	c9                   	leave
+     fb3:	c3                   	ret
+     fb4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fbf:	90                   	nop
+
+00000fc0 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     fc0:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+     fc5:	c3                   	ret
+     fc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fcd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000fd0 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+     fd0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     fd5:	85 c0                	test   %eax,%eax
+     fd7:	74 07                	je     fe0 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+     fd9:	c3                   	ret
+     fda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+     fe0:	e9 d2 02 00 00       	jmp    12b7 <getpid>
+     fe5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ff0 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	57                   	push   %edi
+     ff4:	56                   	push   %esi
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+     ff9:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+     ffb:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+    1001:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+    1007:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+    100c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+    1012:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    1015:	89 d0                	mov    %edx,%eax
+    1017:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    101a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+    1020:	29 d9                	sub    %ebx,%ecx
+    1022:	89 c6                	mov    %eax,%esi
+    1024:	89 d7                	mov    %edx,%edi
+    1026:	0f a5 c7             	shld   %cl,%eax,%edi
+    1029:	d3 e6                	shl    %cl,%esi
+    102b:	31 c0                	xor    %eax,%eax
+    102d:	f6 c1 20             	test   $0x20,%cl
+    1030:	0f 45 fe             	cmovne %esi,%edi
+    1033:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+    1036:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1039:	89 d9                	mov    %ebx,%ecx
+    103b:	31 db                	xor    %ebx,%ebx
+    103d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+    1043:	0f ad d0             	shrd   %cl,%edx,%eax
+    1046:	d3 ea                	shr    %cl,%edx
+    1048:	f6 c1 20             	test   $0x20,%cl
+    104b:	0f 45 c2             	cmovne %edx,%eax
+    104e:	0f 45 d3             	cmovne %ebx,%edx
+    1051:	01 f0                	add    %esi,%eax
+    1053:	11 fa                	adc    %edi,%edx
+}
+    1055:	83 c4 0c             	add    $0xc,%esp
+    1058:	5b                   	pop    %ebx
+    1059:	5e                   	pop    %esi
+    105a:	5f                   	pop    %edi
+    105b:	5d                   	pop    %ebp
+    105c:	c3                   	ret
+    105d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001060 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+    1060:	55                   	push   %ebp
+    1061:	89 e5                	mov    %esp,%ebp
+    1063:	57                   	push   %edi
+    1064:	56                   	push   %esi
+    1065:	53                   	push   %ebx
+    1066:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+    1069:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+    106d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+    1070:	74 0e                	je     1080 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+    1072:	83 c4 1c             	add    $0x1c,%esp
+    1075:	5b                   	pop    %ebx
+    1076:	5e                   	pop    %esi
+    1077:	5f                   	pop    %edi
+    1078:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+    1079:	e9 a5 03 00 00       	jmp    1423 <clock_gettime>
+    107e:	66 90                	xchg   %ax,%ax
+    1080:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+    1082:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+    1088:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+    108e:	b9 20 00 00 00       	mov    $0x20,%ecx
+    1093:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1096:	89 d0                	mov    %edx,%eax
+    1098:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    109b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+    10a1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+    10a7:	89 c6                	mov    %eax,%esi
+    10a9:	89 d7                	mov    %edx,%edi
+    10ab:	0f a5 c7             	shld   %cl,%eax,%edi
+    10ae:	d3 e6                	shl    %cl,%esi
+    10b0:	31 c0                	xor    %eax,%eax
+    10b2:	f6 c1 20             	test   $0x20,%cl
+    10b5:	0f 45 fe             	cmovne %esi,%edi
+    10b8:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+    10bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    10be:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+    10c5:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+    10cb:	0f ad d0             	shrd   %cl,%edx,%eax
+    10ce:	d3 ea                	shr    %cl,%edx
+    10d0:	f6 c1 20             	test   $0x20,%cl
+    10d3:	74 04                	je     10d9 <vclock_gettime+0x79>
+    10d5:	89 d0                	mov    %edx,%eax
+    10d7:	31 d2                	xor    %edx,%edx
+    10d9:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+    10db:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+    10e0:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+    10e2:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+    10e4:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+    10e6:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+    10e8:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+    10ee:	29 c1                	sub    %eax,%ecx
+}
+    10f0:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+    10f2:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+    10f5:	83 c4 1c             	add    $0x1c,%esp
+    10f8:	5b                   	pop    %ebx
+    10f9:	5e                   	pop    %esi
+    10fa:	5f                   	pop    %edi
+    10fb:	5d                   	pop    %ebp
+    10fc:	c3                   	ret
+
+000010fd <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+    10fd:	b8 01 00 00 00       	mov    $0x1,%eax
+    1102:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1109:	74 09                	je     1114 <fork+0x17>
+    110b:	89 e1                	mov    %esp,%ecx
+    110d:	ba 16 11 00 00       	mov    $0x1116,%edx
+    1112:	0f 34                	sysenter
+    1114:	cd 40                	int    $0x40
+    1116:	c3                   	ret
+
+00001117 <exit>:
+SYSCALL(exit)
+    1117:	b8 02 00 00 00       	mov    $0x2,%eax
+    111c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1123:	74 09                	je     112e <exit+0x17>
+    1125:	89 e1                	mov    %esp,%ecx
+    1127:	ba 30 11 00 00       	mov    $0x1130,%edx
+    112c:	0f 34                	sysenter
+    112e:	cd 40                	int    $0x40
+    1130:	c3                   	ret
+
+00001131 <wait>:
+SYSCALL(wait)
+    1131:	b8 03 00 00 00       	mov    $0x3,%eax
+    1136:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    113d:	74 09                	je     1148 <wait+0x17>
+    113f:	89 e1                	mov    %esp,%ecx
+    1141:	ba 4a 11 00 00       	mov    $0x114a,%edx
+    1146:	0f 34                	sysenter
+    1148:	cd 40                	int    $0x40
+    114a:	c3                   	ret
+
+0000114b <pipe>:
+SYSCALL(pipe)
+    114b:	b8 04 00 00 00       	mov    $0x4,%eax
+    1150:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1157:	74 09                	je     1162 <pipe+0x17>
+    1159:	89 e1                	mov    %esp,%ecx
+    115b:	ba 64 11 00 00       	mov    $0x1164,%edx
+    1160:	0f 34                	sysenter
+    1162:	cd 40                	int    $0x40
+    1164:	c3                   	ret
+
+00001165 <read>:
+SYSCALL(read)
+    1165:	b8 05 00 00 00       	mov    $0x5,%eax
+    116a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1171:	74 09                	je     117c <read+0x17>
+    1173:	89 e1                	mov    %esp,%ecx
+    1175:	ba 7e 11 00 00       	mov    $0x117e,%edx
+    117a:	0f 34                	sysenter
+    117c:	cd 40                	int    $0x40
+    117e:	c3                   	ret
+
+0000117f <write>:
+SYSCALL(write)
+    117f:	b8 10 00 00 00       	mov    $0x10,%eax
+    1184:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    118b:	74 09                	je     1196 <write+0x17>
+    118d:	89 e1                	mov    %esp,%ecx
+    118f:	ba 98 11 00 00       	mov    $0x1198,%edx
+    1194:	0f 34                	sysenter
+    1196:	cd 40                	int    $0x40
+    1198:	c3                   	ret
+
+00001199 <close>:
+SYSCALL(close)
+    1199:	b8 15 00 00 00       	mov    $0x15,%eax
+    119e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    11a5:	74 09                	je     11b0 <close+0x17>
+    11a7:	89 e1                	mov    %esp,%ecx
+    11a9:	ba b2 11 00 00       	mov    $0x11b2,%edx
+    11ae:	0f 34                	sysenter
+    11b0:	cd 40                	int    $0x40
+    11b2:	c3                   	ret
+
+000011b3 <kill>:
+SYSCALL(kill)
+    11b3:	b8 06 00 00 00       	mov    $0x6,%eax
+    11b8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    11bf:	74 09                	je     11ca <kill+0x17>
+    11c1:	89 e1                	mov    %esp,%ecx
+    11c3:	ba cc 11 00 00       	mov    $0x11cc,%edx
+    11c8:	0f 34                	sysenter
+    11ca:	cd 40                	int    $0x40
+    11cc:	c3                   	ret
+
+000011cd <exec>:
+SYSCALL(exec)
+    11cd:	b8 07 00 00 00       	mov    $0x7,%eax
+    11d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    11d9:	74 09                	je     11e4 <exec+0x17>
+    11db:	89 e1                	mov    %esp,%ecx
+    11dd:	ba e6 11 00 00       	mov    $0x11e6,%edx
+    11e2:	0f 34                	sysenter
+    11e4:	cd 40                	int    $0x40
+    11e6:	c3                   	ret
+
+000011e7 <open>:
+SYSCALL(open)
+    11e7:	b8 0f 00 00 00       	mov    $0xf,%eax
+    11ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    11f3:	74 09                	je     11fe <open+0x17>
+    11f5:	89 e1                	mov    %esp,%ecx
+    11f7:	ba 00 12 00 00       	mov    $0x1200,%edx
+    11fc:	0f 34                	sysenter
+    11fe:	cd 40                	int    $0x40
+    1200:	c3                   	ret
+
+00001201 <mknod>:
+SYSCALL(mknod)
+    1201:	b8 11 00 00 00       	mov    $0x11,%eax
+    1206:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    120d:	74 09                	je     1218 <mknod+0x17>
+    120f:	89 e1                	mov    %esp,%ecx
+    1211:	ba 1a 12 00 00       	mov    $0x121a,%edx
+    1216:	0f 34                	sysenter
+    1218:	cd 40                	int    $0x40
+    121a:	c3                   	ret
+
+0000121b <unlink>:
+SYSCALL(unlink)
+    121b:	b8 12 00 00 00       	mov    $0x12,%eax
+    1220:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1227:	74 09                	je     1232 <unlink+0x17>
+    1229:	89 e1                	mov    %esp,%ecx
+    122b:	ba 34 12 00 00       	mov    $0x1234,%edx
+    1230:	0f 34                	sysenter
+    1232:	cd 40                	int    $0x40
+    1234:	c3                   	ret
+
+00001235 <fstat>:
+SYSCALL(fstat)
+    1235:	b8 08 00 00 00       	mov    $0x8,%eax
+    123a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1241:	74 09                	je     124c <fstat+0x17>
+    1243:	89 e1                	mov    %esp,%ecx
+    1245:	ba 4e 12 00 00       	mov    $0x124e,%edx
+    124a:	0f 34                	sysenter
+    124c:	cd 40                	int    $0x40
+    124e:	c3                   	ret
+
+0000124f <link>:
+SYSCALL(link)
+    124f:	b8 13 00 00 00       	mov    $0x13,%eax
+    1254:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    125b:	74 09                	je     1266 <link+0x17>
+    125d:	89 e1                	mov    %esp,%ecx
+    125f:	ba 68 12 00 00       	mov    $0x1268,%edx
+    1264:	0f 34                	sysenter
+    1266:	cd 40                	int    $0x40
+    1268:	c3                   	ret
+
+00001269 <mkdir>:
+SYSCALL(mkdir)
+    1269:	b8 14 00 00 00       	mov    $0x14,%eax
+    126e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1275:	74 09                	je     1280 <mkdir+0x17>
+    1277:	89 e1                	mov    %esp,%ecx
+    1279:	ba 82 12 00 00       	mov    $0x1282,%edx
+    127e:	0f 34                	sysenter
+    1280:	cd 40                	int    $0x40
+    1282:	c3                   	ret
+
+00001283 <chdir>:
+SYSCALL(chdir)
+    1283:	b8 09 00 00 00       	mov    $0x9,%eax
+    1288:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    128f:	74 09                	je     129a <chdir+0x17>
+    1291:	89 e1                	mov    %esp,%ecx
+    1293:	ba 9c 12 00 00       	mov    $0x129c,%edx
+    1298:	0f 34                	sysenter
+    129a:	cd 40                	int    $0x40
+    129c:	c3                   	ret
+
+0000129d <dup>:
+SYSCALL(dup)
+    129d:	b8 0a 00 00 00       	mov    $0xa,%eax
+    12a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    12a9:	74 09                	je     12b4 <dup+0x17>
+    12ab:	89 e1                	mov    %esp,%ecx
+    12ad:	ba b6 12 00 00       	mov    $0x12b6,%edx
+    12b2:	0f 34                	sysenter
+    12b4:	cd 40                	int    $0x40
+    12b6:	c3                   	ret
+
+000012b7 <getpid>:
+SYSCALL(getpid)
+    12b7:	b8 0b 00 00 00       	mov    $0xb,%eax
+    12bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    12c3:	74 09                	je     12ce <getpid+0x17>
+    12c5:	89 e1                	mov    %esp,%ecx
+    12c7:	ba d0 12 00 00       	mov    $0x12d0,%edx
+    12cc:	0f 34                	sysenter
+    12ce:	cd 40                	int    $0x40
+    12d0:	c3                   	ret
+
+000012d1 <sbrk>:
+SYSCALL(sbrk)
+    12d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+    12d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    12dd:	74 09                	je     12e8 <sbrk+0x17>
+    12df:	89 e1                	mov    %esp,%ecx
+    12e1:	ba ea 12 00 00       	mov    $0x12ea,%edx
+    12e6:	0f 34                	sysenter
+    12e8:	cd 40                	int    $0x40
+    12ea:	c3                   	ret
+
+000012eb <sleep>:
+SYSCALL(sleep)
+    12eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+    12f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    12f7:	74 09                	je     1302 <sleep+0x17>
+    12f9:	89 e1                	mov    %esp,%ecx
+    12fb:	ba 04 13 00 00       	mov    $0x1304,%edx
+    1300:	0f 34                	sysenter
+    1302:	cd 40                	int    $0x40
+    1304:	c3                   	ret
+
+00001305 <uptime>:
+SYSCALL(uptime)
+    1305:	b8 0e 00 00 00       	mov    $0xe,%eax
+    130a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1311:	74 09                	je     131c <uptime+0x17>
+    1313:	89 e1                	mov    %esp,%ecx
+    1315:	ba 1e 13 00 00       	mov    $0x131e,%edx
+    131a:	0f 34                	sysenter
+    131c:	cd 40                	int    $0x40
+    131e:	c3                   	ret
+
+0000131f <mmap>:
+SYSCALL(mmap)
+    131f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1324:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    132b:	74 09                	je     1336 <mmap+0x17>
+    132d:	89 e1                	mov    %esp,%ecx
+    132f:	ba 38 13 00 00       	mov    $0x1338,%edx
+    1334:	0f 34                	sysenter
+    1336:	cd 40                	int    $0x40
+    1338:	c3                   	ret
+
+00001339 <munmap>:
+SYSCALL(munmap)
+    1339:	b8 17 00 00 00       	mov    $0x17,%eax
+    133e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1345:	74 09                	je     1350 <munmap+0x17>
+    1347:	89 e1                	mov    %esp,%ecx
+    1349:	ba 52 13 00 00       	mov    $0x1352,%edx
+    134e:	0f 34                	sysenter
+    1350:	cd 40                	int    $0x40
+    1352:	c3                   	ret
+
+00001353 <clone>:
+SYSCALL(clone)
+    1353:	b8 18 00 00 00       	mov    $0x18,%eax
+    1358:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    135f:	74 09                	je     136a <clone+0x17>
+    1361:	89 e1                	mov    %esp,%ecx
+    1363:	ba 6c 13 00 00       	mov    $0x136c,%edx
+    1368:	0f 34                	sysenter
+    136a:	cd 40                	int    $0x40
+    136c:	c3                   	ret
+
+0000136d <join>:
+SYSCALL(join)
+    136d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1372:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1379:	74 09                	je     1384 <join+0x17>
+    137b:	89 e1                	mov    %esp,%ecx
+    137d:	ba 86 13 00 00       	mov    $0x1386,%edx
+    1382:	0f 34                	sysenter
+    1384:	cd 40                	int    $0x40
+    1386:	c3                   	ret
+
+00001387 <futex>:
+SYSCALL(futex)
+    1387:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    138c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1393:	74 09                	je     139e <futex+0x17>
+    1395:	89 e1                	mov    %esp,%ecx
+    1397:	ba a0 13 00 00       	mov    $0x13a0,%edx
+    139c:	0f 34                	sysenter
+    139e:	cd 40                	int    $0x40
+    13a0:	c3                   	ret
+
+000013a1 <memstat>:
+SYSCALL(memstat)
+    13a1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    13a6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    13ad:	74 09                	je     13b8 <memstat+0x17>
+    13af:	89 e1                	mov    %esp,%ecx
+    13b1:	ba ba 13 00 00       	mov    $0x13ba,%edx
+    13b6:	0f 34                	sysenter
+    13b8:	cd 40                	int    $0x40
+    13ba:	c3                   	ret
+
+000013bb <nice>:
+SYSCALL(nice)
+    13bb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    13c0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    13c7:	74 09                	je     13d2 <nice+0x17>
+    13c9:	89 e1                	mov    %esp,%ecx
+    13cb:	ba d4 13 00 00       	mov    $0x13d4,%edx
+    13d0:	0f 34                	sysenter
+    13d2:	cd 40                	int    $0x40
+    13d4:	c3                   	ret
+
+000013d5 <setpriority>:
+SYSCALL(setpriority)
+    13d5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13da:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    13e1:	74 09                	je     13ec <setpriority+0x17>
+    13e3:	89 e1                	mov    %esp,%ecx
+    13e5:	ba ee 13 00 00       	mov    $0x13ee,%edx
+    13ea:	0f 34                	sysenter
+    13ec:	cd 40                	int    $0x40
+    13ee:	c3                   	ret
+
+000013ef <getpinfo>:
+SYSCALL(getpinfo)
+    13ef:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13f4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    13fb:	74 09                	je     1406 <getpinfo+0x17>
+    13fd:	89 e1                	mov    %esp,%ecx
+    13ff:	ba 08 14 00 00       	mov    $0x1408,%edx
+    1404:	0f 34                	sysenter
+    1406:	cd 40                	int    $0x40
+    1408:	c3                   	ret
+
+00001409 <settickets>:
+SYSCALL(settickets)
+    1409:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    140e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1415:	74 09                	je     1420 <settickets+0x17>
+    1417:	89 e1                	mov    %esp,%ecx
+    1419:	ba 22 14 00 00       	mov    $0x1422,%edx
+    141e:	0f 34                	sysenter
+    1420:	cd 40                	int    $0x40
+    1422:	c3                   	ret
+
+00001423 <clock_gettime>:
+SYSCALL(clock_gettime)
+    1423:	b8 20 00 00 00       	mov    $0x20,%eax
+    1428:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    142f:	74 09                	je     143a <clock_gettime+0x17>
+    1431:	89 e1                	mov    %esp,%ecx
+    1433:	ba 3c 14 00 00       	mov    $0x143c,%edx
+    1438:	0f 34                	sysenter
+    143a:	cd 40                	int    $0x40
+    143c:	c3                   	ret
+
+0000143d <batch>:
+SYSCALL(batch)
+    143d:	b8 21 00 00 00       	mov    $0x21,%eax
+    1442:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1449:	74 09                	je     1454 <batch+0x17>
+    144b:	89 e1                	mov    %esp,%ecx
+    144d:	ba 56 14 00 00       	mov    $0x1456,%edx
+    1452:	0f 34                	sysenter
+    1454:	cd 40                	int    $0x40
+    1456:	c3                   	ret
+
+00001457 <aiosetup>:
+SYSCALL(aiosetup)
+    1457:	b8 22 00 00 00       	mov    $0x22,%eax
+    145c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1463:	74 09                	je     146e <aiosetup+0x17>
+    1465:	89 e1                	mov    %esp,%ecx
+    1467:	ba 70 14 00 00       	mov    $0x1470,%edx
+    146c:	0f 34                	sysenter
+    146e:	cd 40                	int    $0x40
+    1470:	c3                   	ret
+
+00001471 <aioenter>:
+SYSCALL(aioenter)
+    1471:	b8 23 00 00 00       	mov    $0x23,%eax
+    1476:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    147d:	74 09                	je     1488 <aioenter+0x17>
+    147f:	89 e1                	mov    %esp,%ecx
+    1481:	ba 8a 14 00 00       	mov    $0x148a,%edx
+    1486:	0f 34                	sysenter
+    1488:	cd 40                	int    $0x40
+    148a:	c3                   	ret
+
+0000148b <systrace>:
+SYSCALL(systrace)
+    148b:	b8 24 00 00 00       	mov    $0x24,%eax
+    1490:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    1497:	74 09                	je     14a2 <systrace+0x17>
+    1499:	89 e1                	mov    %esp,%ecx
+    149b:	ba a4 14 00 00       	mov    $0x14a4,%edx
+    14a0:	0f 34                	sysenter
+    14a2:	cd 40                	int    $0x40
+    14a4:	c3                   	ret
+
+000014a5 <sysstat>:
+SYSCALL(sysstat)
+    14a5:	b8 25 00 00 00       	mov    $0x25,%eax
+    14aa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    14b1:	74 09                	je     14bc <sysstat+0x17>
+    14b3:	89 e1                	mov    %esp,%ecx
+    14b5:	ba be 14 00 00       	mov    $0x14be,%edx
+    14ba:	0f 34                	sysenter
+    14bc:	cd 40                	int    $0x40
+    14be:	c3                   	ret
+
+000014bf <traceread>:
+SYSCALL(traceread)
+    14bf:	b8 26 00 00 00       	mov    $0x26,%eax
+    14c4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+    14cb:	74 09                	je     14d6 <traceread+0x17>
+    14cd:	89 e1                	mov    %esp,%ecx
+    14cf:	ba d8 14 00 00       	mov    $0x14d8,%edx
+    14d4:	0f 34                	sysenter
+    14d6:	cd 40                	int    $0x40
+    14d8:	c3                   	ret
+    14d9:	66 90                	xchg   %ax,%ax
+    14db:	66 90                	xchg   %ax,%ax
+    14dd:	66 90                	xchg   %ax,%ax
+    14df:	90                   	nop
+
+000014e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    14e0:	55                   	push   %ebp
+    14e1:	89 e5                	mov    %esp,%ebp
+    14e3:	57                   	push   %edi
+    14e4:	56                   	push   %esi
+    14e5:	53                   	push   %ebx
+    14e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    14e8:	89 d1                	mov    %edx,%ecx
+{
+    14ea:	83 ec 3c             	sub    $0x3c,%esp
+    14ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    14f0:	85 d2                	test   %edx,%edx
+    14f2:	0f 89 80 00 00 00    	jns    1578 <printint+0x98>
+    14f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    14fc:	74 7a                	je     1578 <printint+0x98>
+    x = -xx;
+    14fe:	f7 d9                	neg    %ecx
+    neg = 1;
+    1500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    1508:	31 f6                	xor    %esi,%esi
+    150a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    1510:	89 c8                	mov    %ecx,%eax
+    1512:	31 d2                	xor    %edx,%edx
+    1514:	89 f7                	mov    %esi,%edi
+    1516:	f7 f3                	div    %ebx
+    1518:	8d 76 01             	lea    0x1(%esi),%esi
+    151b:	0f b6 92 a8 1a 00 00 	movzbl 0x1aa8(%edx),%edx
+    1522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    1526:	89 ca                	mov    %ecx,%edx
+    1528:	89 c1                	mov    %eax,%ecx
+    152a:	39 da                	cmp    %ebx,%edx
+    152c:	73 e2                	jae    1510 <printint+0x30>
+  if(neg)
+    152e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    1531:	85 c0                	test   %eax,%eax
+    1533:	74 07                	je     153c <printint+0x5c>
+    buf[i++] = '-';
+    1535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    153a:	89 f7                	mov    %esi,%edi
+    153c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    153f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1542:	01 df                	add    %ebx,%edi
+    1544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    154b:	83 ec 04             	sub    $0x4,%esp
+    154e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1554:	6a 01                	push   $0x1
+    1556:	50                   	push   %eax
+    1557:	56                   	push   %esi
+    1558:	e8 22 fc ff ff       	call   117f <write>
+  while(--i >= 0)
+    155d:	89 f8                	mov    %edi,%eax
+    155f:	83 c4 10             	add    $0x10,%esp
+    1562:	83 ef 01             	sub    $0x1,%edi
+    1565:	39 d8                	cmp    %ebx,%eax
+    1567:	75 df                	jne    1548 <printint+0x68>
+}
+    1569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    156c:	5b                   	pop    %ebx
+    156d:	5e                   	pop    %esi
+    156e:	5f                   	pop    %edi
+    156f:	5d                   	pop    %ebp
+    1570:	c3                   	ret
+    1571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1578:	31 c0                	xor    %eax,%eax
+    157a:	eb 89                	jmp    1505 <printint+0x25>
+    157c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1580:	55                   	push   %ebp
+    1581:	89 e5                	mov    %esp,%ebp
+    1583:	57                   	push   %edi
+    1584:	56                   	push   %esi
+    1585:	53                   	push   %ebx
+    1586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    158c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    158f:	0f b6 1e             	movzbl (%esi),%ebx
+    1592:	83 c6 01             	add    $0x1,%esi
+    1595:	84 db                	test   %bl,%bl
+    1597:	74 67                	je     1600 <printf+0x80>
+    1599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    159c:	31 d2                	xor    %edx,%edx
+    159e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    15a1:	eb 34                	jmp    15d7 <printf+0x57>
+    15a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15a7:	90                   	nop
+    15a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    15ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    15b0:	83 f8 25             	cmp    $0x25,%eax
+    15b3:	74 18                	je     15cd <printf+0x4d>
+  write(fd, &c, 1);
+    15b5:	83 ec 04             	sub    $0x4,%esp
+    15b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    15bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    15be:	6a 01                	push   $0x1
+    15c0:	50                   	push   %eax
+    15c1:	57                   	push   %edi
+    15c2:	e8 b8 fb ff ff       	call   117f <write>
+    15c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    15ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    15cd:	0f b6 1e             	movzbl (%esi),%ebx
+    15d0:	83 c6 01             	add    $0x1,%esi
+    15d3:	84 db                	test   %bl,%bl
+    15d5:	74 29                	je     1600 <printf+0x80>
+    c = fmt[i] & 0xff;
+    15d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    15da:	85 d2                	test   %edx,%edx
+    15dc:	74 ca                	je     15a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    15de:	83 fa 25             	cmp    $0x25,%edx
+    15e1:	75 ea                	jne    15cd <printf+0x4d>
+      if(c == 'd'){
+    15e3:	83 f8 25             	cmp    $0x25,%eax
+    15e6:	0f 84 24 01 00 00    	je     1710 <printf+0x190>
+    15ec:	83 e8 63             	sub    $0x63,%eax
+    15ef:	83 f8 15             	cmp    $0x15,%eax
+    15f2:	77 1c                	ja     1610 <printf+0x90>
+    15f4:	ff 24 85 50 1a 00 00 	jmp    *0x1a50(,%eax,4)
+    15fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    15ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    1600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1603:	5b                   	pop    %ebx
+    1604:	5e                   	pop    %esi
+    1605:	5f                   	pop    %edi
+    1606:	5d                   	pop    %ebp
+    1607:	c3                   	ret
+    1608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    160f:	90                   	nop
+  write(fd, &c, 1);
+    1610:	83 ec 04             	sub    $0x4,%esp
+    1613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    161a:	6a 01                	push   $0x1
+    161c:	52                   	push   %edx
+    161d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1620:	57                   	push   %edi
+    1621:	e8 59 fb ff ff       	call   117f <write>
+    1626:	83 c4 0c             	add    $0xc,%esp
+    1629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    162c:	6a 01                	push   $0x1
+    162e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    1631:	52                   	push   %edx
+    1632:	57                   	push   %edi
+    1633:	e8 47 fb ff ff       	call   117f <write>
+        putc(fd, c);
+    1638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    163b:	31 d2                	xor    %edx,%edx
+    163d:	eb 8e                	jmp    15cd <printf+0x4d>
+    163f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1643:	83 ec 0c             	sub    $0xc,%esp
+    1646:	b9 10 00 00 00       	mov    $0x10,%ecx
+    164b:	8b 13                	mov    (%ebx),%edx
+    164d:	6a 00                	push   $0x0
+    164f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1654:	e8 87 fe ff ff       	call   14e0 <printint>
+        ap++;
+    1659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    165c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    165f:	31 d2                	xor    %edx,%edx
+    1661:	e9 67 ff ff ff       	jmp    15cd <printf+0x4d>
+    1666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    166d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1675:	83 c0 04             	add    $0x4,%eax
+    1678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    167b:	85 db                	test   %ebx,%ebx
+    167d:	0f 84 9d 00 00 00    	je     1720 <printf+0x1a0>
+        while(*s != 0){
+    1683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1688:	84 c0                	test   %al,%al
+    168a:	0f 84 3d ff ff ff    	je     15cd <printf+0x4d>
+    1690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1696:	89 de                	mov    %ebx,%esi
+    1698:	89 d3                	mov    %edx,%ebx
+    169a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    16a0:	83 ec 04             	sub    $0x4,%esp
+    16a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    16a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    16a9:	6a 01                	push   $0x1
+    16ab:	53                   	push   %ebx
+    16ac:	57                   	push   %edi
+    16ad:	e8 cd fa ff ff       	call   117f <write>
+        while(*s != 0){
+    16b2:	0f b6 06             	movzbl (%esi),%eax
+    16b5:	83 c4 10             	add    $0x10,%esp
+    16b8:	84 c0                	test   %al,%al
+    16ba:	75 e4                	jne    16a0 <printf+0x120>
+      state = 0;
+    16bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    16bf:	31 d2                	xor    %edx,%edx
+    16c1:	e9 07 ff ff ff       	jmp    15cd <printf+0x4d>
+    16c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    16d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    16d3:	83 ec 0c             	sub    $0xc,%esp
+    16d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    16db:	8b 13                	mov    (%ebx),%edx
+    16dd:	6a 01                	push   $0x1
+    16df:	e9 6b ff ff ff       	jmp    164f <printf+0xcf>
+    16e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    16e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    16eb:	83 ec 04             	sub    $0x4,%esp
+    16ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    16f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    16f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    16f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    16f9:	6a 01                	push   $0x1
+    16fb:	52                   	push   %edx
+    16fc:	57                   	push   %edi
+    16fd:	e8 7d fa ff ff       	call   117f <write>
+        ap++;
+    1702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1708:	31 d2                	xor    %edx,%edx
+    170a:	e9 be fe ff ff       	jmp    15cd <printf+0x4d>
+    170f:	90                   	nop
+  write(fd, &c, 1);
+    1710:	83 ec 04             	sub    $0x4,%esp
+    1713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1719:	6a 01                	push   $0x1
+    171b:	e9 11 ff ff ff       	jmp    1631 <printf+0xb1>
+    1720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1725:	bb 48 1a 00 00       	mov    $0x1a48,%ebx
+    172a:	e9 61 ff ff ff       	jmp    1690 <printf+0x110>
+    172f:	90                   	nop
+
+00001730 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1730:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1731:	a1 c4 22 00 00       	mov    0x22c4,%eax
+{
+    1736:	89 e5                	mov    %esp,%ebp
+    1738:	57                   	push   %edi
+    1739:	56                   	push   %esi
+    173a:	53                   	push   %ebx
+    173b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    173e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1748:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    174a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    174c:	39 ca                	cmp    %ecx,%edx
+    174e:	73 30                	jae    1780 <free+0x50>
+    1750:	39 c1                	cmp    %eax,%ecx
+    1752:	72 04                	jb     1758 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1754:	39 c2                	cmp    %eax,%edx
+    1756:	72 f0                	jb     1748 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1758:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    175b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    175e:	39 f8                	cmp    %edi,%eax
+    1760:	74 2e                	je     1790 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1762:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1765:	8b 42 04             	mov    0x4(%edx),%eax
+    1768:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    176b:	39 f1                	cmp    %esi,%ecx
+    176d:	74 38                	je     17a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    176f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1771:	5b                   	pop    %ebx
+  freep = p;
+    1772:	89 15 c4 22 00 00    	mov    %edx,0x22c4
+}
+    1778:	5e                   	pop    %esi
+    1779:	5f                   	pop    %edi
+    177a:	5d                   	pop    %ebp
+    177b:	c3                   	ret
+    177c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1780:	39 c1                	cmp    %eax,%ecx
+    1782:	72 d0                	jb     1754 <free+0x24>
+    1784:	eb c2                	jmp    1748 <free+0x18>
+    1786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    178d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1790:	03 70 04             	add    0x4(%eax),%esi
+    1793:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1796:	8b 02                	mov    (%edx),%eax
+    1798:	8b 00                	mov    (%eax),%eax
+    179a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    179d:	8b 42 04             	mov    0x4(%edx),%eax
+    17a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    17a3:	39 f1                	cmp    %esi,%ecx
+    17a5:	75 c8                	jne    176f <free+0x3f>
+    p->s.size += bp->s.size;
+    17a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    17aa:	89 15 c4 22 00 00    	mov    %edx,0x22c4
+    p->s.size += bp->s.size;
+    17b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    17b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    17b6:	89 0a                	mov    %ecx,(%edx)
+}
+    17b8:	5b                   	pop    %ebx
+    17b9:	5e                   	pop    %esi
+    17ba:	5f                   	pop    %edi
+    17bb:	5d                   	pop    %ebp
+    17bc:	c3                   	ret
+    17bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000017c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    17c0:	55                   	push   %ebp
+    17c1:	89 e5                	mov    %esp,%ebp
+    17c3:	57                   	push   %edi
+    17c4:	56                   	push   %esi
+    17c5:	53                   	push   %ebx
+    17c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    17cc:	8b 15 c4 22 00 00    	mov    0x22c4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    17d2:	8d 78 07             	lea    0x7(%eax),%edi
+    17d5:	c1 ef 03             	shr    $0x3,%edi
+    17d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    17db:	85 d2                	test   %edx,%edx
+    17dd:	0f 84 8d 00 00 00    	je     1870 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    17e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    17e5:	8b 48 04             	mov    0x4(%eax),%ecx
+    17e8:	39 f9                	cmp    %edi,%ecx
+    17ea:	73 64                	jae    1850 <malloc+0x90>
+  if(nu < 4096)
+    17ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    17f1:	39 df                	cmp    %ebx,%edi
+    17f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    17f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    17fd:	eb 0a                	jmp    1809 <malloc+0x49>
+    17ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1800:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1802:	8b 48 04             	mov    0x4(%eax),%ecx
+    1805:	39 f9                	cmp    %edi,%ecx
+    1807:	73 47                	jae    1850 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1809:	89 c2                	mov    %eax,%edx
+    180b:	39 05 c4 22 00 00    	cmp    %eax,0x22c4
+    1811:	75 ed                	jne    1800 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1813:	83 ec 0c             	sub    $0xc,%esp
+    1816:	56                   	push   %esi
+    1817:	e8 b5 fa ff ff       	call   12d1 <sbrk>
+  if(p == (char*)-1)
+    181c:	83 c4 10             	add    $0x10,%esp
+    181f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1822:	74 1c                	je     1840 <malloc+0x80>
+  hp->s.size = nu;
+    1824:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1827:	83 ec 0c             	sub    $0xc,%esp
+    182a:	83 c0 08             	add    $0x8,%eax
+    182d:	50                   	push   %eax
+    182e:	e8 fd fe ff ff       	call   1730 <free>
+  return freep;
+    1833:	8b 15 c4 22 00 00    	mov    0x22c4,%edx
+      if((p = morecore(nunits)) == 0)
+    1839:	83 c4 10             	add    $0x10,%esp
+    183c:	85 d2                	test   %edx,%edx
+    183e:	75 c0                	jne    1800 <malloc+0x40>
+        return 0;
+  }
+}
+    1840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1843:	31 c0                	xor    %eax,%eax
+}
+    1845:	5b                   	pop    %ebx
+    1846:	5e                   	pop    %esi
+    1847:	5f                   	pop    %edi
+    1848:	5d                   	pop    %ebp
+    1849:	c3                   	ret
+    184a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1850:	39 cf                	cmp    %ecx,%edi
+    1852:	74 4c                	je     18a0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1854:	29 f9                	sub    %edi,%ecx
+    1856:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1859:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    185c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    185f:	89 15 c4 22 00 00    	mov    %edx,0x22c4
+}
+    1865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1868:	83 c0 08             	add    $0x8,%eax
+}
+    186b:	5b                   	pop    %ebx
+    186c:	5e                   	pop    %esi
+    186d:	5f                   	pop    %edi
+    186e:	5d                   	pop    %ebp
+    186f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1870:	c7 05 c4 22 00 00 c8 	movl   $0x22c8,0x22c4
+    1877:	22 00 00 
+    base.s.size = 0;
+    187a:	b8 c8 22 00 00       	mov    $0x22c8,%eax
+    base.s.ptr = freep = prevp = &base;
+    187f:	c7 05 c8 22 00 00 c8 	movl   $0x22c8,0x22c8
+    1886:	22 00 00 
+    base.s.size = 0;
+    1889:	c7 05 cc 22 00 00 00 	movl   $0x0,0x22cc
+    1890:	00 00 00 
+    if(p->s.size >= nunits){
+    1893:	e9 54 ff ff ff       	jmp    17ec <malloc+0x2c>
+    1898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    189f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    18a0:	8b 08                	mov    (%eax),%ecx
+    18a2:	89 0a                	mov    %ecx,(%edx)
+    18a4:	eb b9                	jmp    185f <malloc+0x9f>
+    18a6:	66 90                	xchg   %ax,%ax
+    18a8:	66 90                	xchg   %ax,%ax
+    18aa:	66 90                	xchg   %ax,%ax
+    18ac:	66 90                	xchg   %ax,%ax
+    18ae:	66 90                	xchg   %ax,%ax
+
+000018b0 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    18b0:	55                   	push   %ebp
+    18b1:	89 e5                	mov    %esp,%ebp
+    18b3:	53                   	push   %ebx
+    18b4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+    18b7:	68 00 20 00 00       	push   $0x2000
+    18bc:	e8 ff fe ff ff       	call   17c0 <malloc>
+    18c1:	83 c4 10             	add    $0x10,%esp
+    18c4:	85 c0                	test   %eax,%eax
+    18c6:	74 47                	je     190f <thread_create+0x5f>
+    18c8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    18ca:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+    18d0:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    18d3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+    18d8:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+    18db:	ff 75 0c             	push   0xc(%ebp)
+    18de:	50                   	push   %eax
+    18df:	ff 75 08             	push   0x8(%ebp)
+    18e2:	e8 6c fa ff ff       	call   1353 <clone>
+    18e7:	83 c4 10             	add    $0x10,%esp
+    18ea:	85 c0                	test   %eax,%eax
+    18ec:	78 0a                	js     18f8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    18ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    18f1:	c9                   	leave
+    18f2:	c3                   	ret
+    18f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    18f7:	90                   	nop
+    free(mem);
+    18f8:	83 ec 0c             	sub    $0xc,%esp
+    18fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    18fe:	53                   	push   %ebx
+    18ff:	e8 2c fe ff ff       	call   1730 <free>
+    1904:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    190a:	83 c4 10             	add    $0x10,%esp
+}
+    190d:	c9                   	leave
+    190e:	c3                   	ret
+    return -1;
+    190f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1914:	eb d8                	jmp    18ee <thread_create+0x3e>
+    1916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    191d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001920 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+    1920:	55                   	push   %ebp
+    1921:	89 e5                	mov    %esp,%ebp
+    1923:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1924:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1927:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    192a:	50                   	push   %eax
+    192b:	e8 3d fa ff ff       	call   136d <join>
+    1930:	83 c4 10             	add    $0x10,%esp
+    1933:	85 c0                	test   %eax,%eax
+    1935:	78 21                	js     1958 <thread_join+0x38>
+    1937:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+    1939:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    193c:	83 ec 0c             	sub    $0xc,%esp
+    193f:	ff 70 fc             	push   -0x4(%eax)
+    1942:	e8 e9 fd ff ff       	call   1730 <free>
+  return pid;
+    1947:	83 c4 10             	add    $0x10,%esp
+}
+    194a:	89 d8                	mov    %ebx,%eax
+    194c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    194f:	c9                   	leave
+    1950:	c3                   	ret
+    1951:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+    1958:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    195d:	eb eb                	jmp    194a <thread_join+0x2a>
@@ -0,0 +1,225 @@
+// Slab allocator for small kernel objects.
+//
+// A kmem_cache hands out objects of one fixed size.  Objects are
+// carved out of slabs, each one page from kalloc() with a struct
+// slab header at the start, so a 600-byte pipe costs 600 bytes
+// rather than a whole page.  The slab holding an object is found
+// by rounding the object's address down to a page boundary.
+//
+// An optional constructor runs once per object, when its slab is
+// created, rather than on every allocation: callers must hand
+// objects back to kmem_cache_free() in their constructed state
+// (e.g. with any locks inside them released).
+//
+// Each CPU keeps a few free objects of every cache, so most
+// allocations and frees touch neither the cache lock nor the
+// slab lists.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+
+#define NSLABCACHE 16  // maximum number of caches
+#define SLABCPU     8  // objects cached per CPU per cache
+#define SLABBATCH   4  // objects moved to or from the slabs at once
+
+struct slab {
+  struct kmem_cache *cache;
+  struct slab *next;   // on cache's partial list
+  struct slab *prev;
+  int inuse;           // objects allocated from this slab
+  char *free;          // first free object
+};
+
+struct slabcpu {
+  int n;
+  void *obj[SLABCPU];
+};
+
+struct kmem_cache {
+  char *name;
+  uint size;             // object size as requested
+  uint stride;           // object size plus free-list link, aligned
+  int perslab;           // objects per slab
+  void (*ctor)(void*);
+  struct spinlock lock;  // protects partial and all slab headers
+  struct slab *partial;  // slabs with free objects
+  int nslab;             // slabs allocated
+  struct slabcpu cpu[NCPU];
+};
+
+struct {
+  struct spinlock lock;
+  struct kmem_cache cache[NSLABCACHE];
+  int n;
+} slabtab;
+
+// The free list runs through a link word stored just past each
+// free object, in the last word of its stride, so that freeing
+// does not disturb constructed state.
+#define SLABLINK(c, obj)  (*(char**)((obj) + (c)->stride - sizeof(char*)))
+#define SLABHDR           ((sizeof(struct slab) + 7) & ~7)
+#define SLABFIRST(s)      ((char*)(s) + SLABHDR)
+
+void
+slabinit(void)
+{
+  initlock(&slabtab.lock, "slabtab");
+}
+
+// Create a cache of objects of the given size.
+// ctor, if not 0, is run on every object when its slab is made.
+struct kmem_cache*
+kmem_cache_create(char *name, uint size, void (*ctor)(void*))
+{
+  struct kmem_cache *c;
+  uint stride;
+
+  stride = (size + sizeof(char*) + 7) & ~7;
+  if(stride > PGSIZE - SLABHDR)
+    panic("kmem_cache_create: size");
+
+  acquire(&slabtab.lock);
+  if(slabtab.n == NSLABCACHE)
+    panic("kmem_cache_create: too many");
+  c = &slabtab.cache[slabtab.n++];
+  release(&slabtab.lock);
+
+  c->name = name;
+  c->size = size;
+  c->stride = stride;
+  c->perslab = (PGSIZE - SLABHDR) / stride;
+  c->ctor = ctor;
+  initlock(&c->lock, name);
+  return c;
+}
+
+static void
+slabunlink(struct kmem_cache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+static void
+slabpush(struct kmem_cache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+// Add a fresh slab to c, constructing its objects.
+// Caller holds c->lock.
+static int
+slabgrow(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *obj;
+  int i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return -1;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  obj = SLABFIRST(s) + (c->perslab - 1) * c->stride;
+  for(i = 0; i < c->perslab; i++, obj -= c->stride){
+    if(c->ctor)
+      c->ctor(obj);
+    SLABLINK(c, obj) = s->free;
+    s->free = obj;
+  }
+  slabpush(c, s);
+  c->nslab++;
+  return 0;
+}
+
+// Take one object from c's slabs.  Caller holds c->lock.
+static void*
+slabget(struct kmem_cache *c)
+{
+  struct slab *s;
+  char *obj;
+
+  if(c->partial == 0 && slabgrow(c) < 0)
+    return 0;
+  s = c->partial;
+  obj = s->free;
+  s->free = SLABLINK(c, obj);
+  if(++s->inuse == c->perslab)
+    slabunlink(c, s);
+  return obj;
+}
+
+// Return obj to its slab, freeing the slab's page if it is now
+// empty and not the only slab with free objects.
+// Caller holds c->lock.
+static void
+slabput(struct kmem_cache *c, char *obj)
+{
+  struct slab *s;
+
+  s = (struct slab*)PGROUNDDOWN((uint)obj);
+  if(s->cache != c)
+    panic("kmem_cache_free");
+  SLABLINK(c, obj) = s->free;
+  s->free = obj;
+  if(s->inuse-- == c->perslab)
+    slabpush(c, s);
+  if(s->inuse == 0 && (c->partial != s || s->next != 0)){
+    slabunlink(c, s);
+    c->nslab--;
+    kfree((char*)s);
+  }
+}
+
+// Allocate an object from cache c.
+// Returns 0 if memory is exhausted.
+void*
+kmem_cache_alloc(struct kmem_cache *c)
+{
+  struct slabcpu *pc;
+  void *obj;
+
+  pushcli();
+  pc = &c->cpu[cpuid()];
+  if(pc->n == 0){
+    acquire(&c->lock);
+    while(pc->n < SLABBATCH && (obj = slabget(c)) != 0)
+      pc->obj[pc->n++] = obj;
+    release(&c->lock);
+  }
+  obj = 0;
+  if(pc->n > 0)
+    obj = pc->obj[--pc->n];
+  popcli();
+  return obj;
+}
+
+// Return obj, which came from kmem_cache_alloc(c), to cache c.
+void
+kmem_cache_free(struct kmem_cache *c, void *obj)
+{
+  struct slabcpu *pc;
+
+  pushcli();
+  pc = &c->cpu[cpuid()];
+  if(pc->n == SLABCPU){
+    acquire(&c->lock);
+    while(pc->n > SLABCPU - SLABBATCH)
+      slabput(c, pc->obj[--pc->n]);
+    release(&c->lock);
+  }
+  pc->obj[pc->n++] = obj;
+  popcli();
+}
@@ -15,6 +15,7 @@ initlock(struct spinlock *lk, char *name)
   lk->name = name;
   lk->locked = 0;
   lk->cpu = 0;
+  lk->contended = 0;
 }
 
 // Acquire the lock.
@@ -28,9 +29,13 @@ acquire(struct spinlock *lk)
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  // The xchg is atomic.  While spinning, keep answering TLB
+  // shootdowns, which cannot be delivered with interrupts off.
+  if(xchg(&lk->locked, 1) != 0){
+    while(xchg(&lk->locked, 1) != 0)
+      tlbshootpoll();
+    lk->contended++;  // safe: we hold the lock now
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
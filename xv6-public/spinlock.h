@@ -7,5 +7,6 @@ struct spinlock {
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+  uint contended;    // Acquisitions that had to spin.
 };
 
@@ -0,0 +1,2492 @@
+
+_strace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  wait();
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 0c             	sub    $0xc,%esp
+      13:	8b 19                	mov    (%ecx),%ebx
+      15:	8b 71 04             	mov    0x4(%ecx),%esi
+  if(argc < 2)
+      18:	83 fb 01             	cmp    $0x1,%ebx
+      1b:	7e 54                	jle    71 <main+0x71>
+    usage();
+  if(strcmp(argv[1], "-s") == 0){
+      1d:	51                   	push   %ecx
+      1e:	51                   	push   %ecx
+      1f:	68 ec 12 00 00       	push   $0x12ec
+      24:	ff 76 04             	push   0x4(%esi)
+      27:	e8 e4 04 00 00       	call   510 <strcmp>
+      2c:	83 c4 10             	add    $0x10,%esp
+      2f:	85 c0                	test   %eax,%eax
+      31:	75 71                	jne    a4 <main+0xa4>
+    stats(argc > 2 ? argv[2] : 0);
+      33:	83 fb 02             	cmp    $0x2,%ebx
+      36:	0f 84 92 00 00 00    	je     ce <main+0xce>
+      3c:	8b 5e 08             	mov    0x8(%esi),%ebx
+  if(arg == 0 || (*arg >= '0' && *arg <= '9')){
+      3f:	85 db                	test   %ebx,%ebx
+      41:	74 3f                	je     82 <main+0x82>
+      43:	0f b6 03             	movzbl (%ebx),%eax
+      46:	83 e8 30             	sub    $0x30,%eax
+      49:	3c 09                	cmp    $0x9,%al
+      4b:	76 29                	jbe    76 <main+0x76>
+  } else if(strcmp(arg, "on") == 0)
+      4d:	50                   	push   %eax
+      4e:	50                   	push   %eax
+      4f:	68 06 13 00 00       	push   $0x1306
+      54:	53                   	push   %ebx
+      55:	e8 b6 04 00 00       	call   510 <strcmp>
+      5a:	83 c4 10             	add    $0x10,%esp
+      5d:	85 c0                	test   %eax,%eax
+      5f:	75 71                	jne    d2 <main+0xd2>
+    systrace(ST_STATS, 1);
+      61:	50                   	push   %eax
+      62:	50                   	push   %eax
+      63:	6a 01                	push   $0x1
+      65:	6a 01                	push   $0x1
+      67:	e8 2f 0d 00 00       	call   d9b <systrace>
+      6c:	83 c4 10             	add    $0x10,%esp
+      6f:	eb 2e                	jmp    9f <main+0x9f>
+    usage();
+      71:	e8 8a 01 00 00       	call   200 <usage>
+    if(sysstat(arg ? atoi(arg) : 0, &st) < 0){
+      76:	83 ec 0c             	sub    $0xc,%esp
+      79:	53                   	push   %ebx
+      7a:	e8 31 06 00 00       	call   6b0 <atoi>
+      7f:	83 c4 10             	add    $0x10,%esp
+      82:	52                   	push   %edx
+      83:	52                   	push   %edx
+      84:	68 a0 1c 00 00       	push   $0x1ca0
+      89:	50                   	push   %eax
+      8a:	e8 26 0d 00 00       	call   db5 <sysstat>
+      8f:	83 c4 10             	add    $0x10,%esp
+      92:	85 c0                	test   %eax,%eax
+      94:	0f 88 93 00 00 00    	js     12d <main+0x12d>
+    printstats();
+      9a:	e8 a1 00 00 00       	call   140 <printstats>
+    if(argc < 3)
+      usage();
+    run(argv + 2, 1);
+  } else
+    run(argv + 1, 0);
+  exit();
+      9f:	e8 83 09 00 00       	call   a27 <exit>
+  } else if(strcmp(argv[1], "-c") == 0){
+      a4:	50                   	push   %eax
+      a5:	50                   	push   %eax
+      a6:	68 13 13 00 00       	push   $0x1313
+      ab:	ff 76 04             	push   0x4(%esi)
+      ae:	e8 5d 04 00 00       	call   510 <strcmp>
+      b3:	83 c4 10             	add    $0x10,%esp
+      b6:	85 c0                	test   %eax,%eax
+      b8:	75 54                	jne    10e <main+0x10e>
+    if(argc < 3)
+      ba:	83 fb 02             	cmp    $0x2,%ebx
+      bd:	74 b2                	je     71 <main+0x71>
+    run(argv + 2, 1);
+      bf:	8d 46 08             	lea    0x8(%esi),%eax
+      c2:	ba 01 00 00 00       	mov    $0x1,%edx
+      c7:	e8 64 01 00 00       	call   230 <run>
+      cc:	eb d1                	jmp    9f <main+0x9f>
+    stats(argc > 2 ? argv[2] : 0);
+      ce:	31 db                	xor    %ebx,%ebx
+      d0:	eb b0                	jmp    82 <main+0x82>
+  else if(strcmp(arg, "off") == 0)
+      d2:	56                   	push   %esi
+      d3:	56                   	push   %esi
+      d4:	68 09 13 00 00       	push   $0x1309
+      d9:	53                   	push   %ebx
+      da:	e8 31 04 00 00       	call   510 <strcmp>
+      df:	83 c4 10             	add    $0x10,%esp
+      e2:	85 c0                	test   %eax,%eax
+      e4:	74 34                	je     11a <main+0x11a>
+  else if(strcmp(arg, "reset") == 0)
+      e6:	51                   	push   %ecx
+      e7:	51                   	push   %ecx
+      e8:	68 0d 13 00 00       	push   $0x130d
+      ed:	53                   	push   %ebx
+      ee:	e8 1d 04 00 00       	call   510 <strcmp>
+      f3:	83 c4 10             	add    $0x10,%esp
+      f6:	85 c0                	test   %eax,%eax
+      f8:	0f 85 73 ff ff ff    	jne    71 <main+0x71>
+    systrace(ST_RESET, 0);
+      fe:	52                   	push   %edx
+      ff:	52                   	push   %edx
+     100:	6a 00                	push   $0x0
+     102:	6a 02                	push   $0x2
+     104:	e8 92 0c 00 00       	call   d9b <systrace>
+     109:	83 c4 10             	add    $0x10,%esp
+     10c:	eb 91                	jmp    9f <main+0x9f>
+    run(argv + 1, 0);
+     10e:	8d 46 04             	lea    0x4(%esi),%eax
+     111:	31 d2                	xor    %edx,%edx
+     113:	e8 18 01 00 00       	call   230 <run>
+     118:	eb 85                	jmp    9f <main+0x9f>
+    systrace(ST_STATS, 0);
+     11a:	53                   	push   %ebx
+     11b:	53                   	push   %ebx
+     11c:	6a 00                	push   $0x0
+     11e:	6a 01                	push   $0x1
+     120:	e8 76 0c 00 00       	call   d9b <systrace>
+     125:	83 c4 10             	add    $0x10,%esp
+     128:	e9 72 ff ff ff       	jmp    9f <main+0x9f>
+      printf(2, "strace: no process %s\n", arg);
+     12d:	50                   	push   %eax
+     12e:	53                   	push   %ebx
+     12f:	68 ef 12 00 00       	push   $0x12ef
+     134:	6a 02                	push   $0x2
+     136:	e8 55 0d 00 00       	call   e90 <printf>
+      exit();
+     13b:	e8 e7 08 00 00       	call   a27 <exit>
+
+00000140 <printstats>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	57                   	push   %edi
+     144:	31 ff                	xor    %edi,%edi
+     146:	56                   	push   %esi
+     147:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     14c:	53                   	push   %ebx
+     14d:	83 ec 0c             	sub    $0xc,%esp
+     150:	eb 15                	jmp    167 <printstats+0x27>
+     152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < NSYSCALL; i++){
+     158:	83 c6 01             	add    $0x1,%esi
+     15b:	83 c7 60             	add    $0x60,%edi
+     15e:	83 fe 27             	cmp    $0x27,%esi
+     161:	0f 84 8e 00 00 00    	je     1f5 <printstats+0xb5>
+    if(st.count[i] == 0)
+     167:	8b 04 b5 a4 1c 00 00 	mov    0x1ca4(,%esi,4),%eax
+     16e:	85 c0                	test   %eax,%eax
+     170:	74 e6                	je     158 <printstats+0x18>
+  return "?";
+     172:	b9 80 12 00 00       	mov    $0x1280,%ecx
+  if(num > 0 && num < NSYSCALL && names[num])
+     177:	83 fe 26             	cmp    $0x26,%esi
+     17a:	77 11                	ja     18d <printstats+0x4d>
+     17c:	8b 0c b5 84 14 00 00 	mov    0x1484(,%esi,4),%ecx
+  return "?";
+     183:	ba 80 12 00 00       	mov    $0x1280,%edx
+     188:	85 c9                	test   %ecx,%ecx
+     18a:	0f 44 ca             	cmove  %edx,%ecx
+    printf(1, "%s %d ", name(i), st.count[i]);
+     18d:	50                   	push   %eax
+    for(b = 0; b < NSYSHIST; b++)
+     18e:	31 db                	xor    %ebx,%ebx
+    printf(1, "%s %d ", name(i), st.count[i]);
+     190:	51                   	push   %ecx
+     191:	68 82 12 00 00       	push   $0x1282
+     196:	6a 01                	push   $0x1
+     198:	e8 f3 0c 00 00       	call   e90 <printf>
+     19d:	83 c4 10             	add    $0x10,%esp
+     1a0:	eb 0e                	jmp    1b0 <printstats+0x70>
+     1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    for(b = 0; b < NSYSHIST; b++)
+     1a8:	83 c3 01             	add    $0x1,%ebx
+     1ab:	83 fb 18             	cmp    $0x18,%ebx
+     1ae:	74 24                	je     1d4 <printstats+0x94>
+      if(st.hist[i][b])
+     1b0:	8b 84 9f 40 1d 00 00 	mov    0x1d40(%edi,%ebx,4),%eax
+     1b7:	85 c0                	test   %eax,%eax
+     1b9:	74 ed                	je     1a8 <printstats+0x68>
+        printf(1, " 2^%d:%d", b, st.hist[i][b]);
+     1bb:	50                   	push   %eax
+     1bc:	53                   	push   %ebx
+    for(b = 0; b < NSYSHIST; b++)
+     1bd:	83 c3 01             	add    $0x1,%ebx
+        printf(1, " 2^%d:%d", b, st.hist[i][b]);
+     1c0:	68 89 12 00 00       	push   $0x1289
+     1c5:	6a 01                	push   $0x1
+     1c7:	e8 c4 0c 00 00       	call   e90 <printf>
+     1cc:	83 c4 10             	add    $0x10,%esp
+    for(b = 0; b < NSYSHIST; b++)
+     1cf:	83 fb 18             	cmp    $0x18,%ebx
+     1d2:	75 dc                	jne    1b0 <printstats+0x70>
+    printf(1, "\n");
+     1d4:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < NSYSCALL; i++){
+     1d7:	83 c6 01             	add    $0x1,%esi
+     1da:	83 c7 60             	add    $0x60,%edi
+    printf(1, "\n");
+     1dd:	68 aa 12 00 00       	push   $0x12aa
+     1e2:	6a 01                	push   $0x1
+     1e4:	e8 a7 0c 00 00       	call   e90 <printf>
+     1e9:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NSYSCALL; i++){
+     1ec:	83 fe 27             	cmp    $0x27,%esi
+     1ef:	0f 85 72 ff ff ff    	jne    167 <printstats+0x27>
+}
+     1f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1f8:	5b                   	pop    %ebx
+     1f9:	5e                   	pop    %esi
+     1fa:	5f                   	pop    %edi
+     1fb:	5d                   	pop    %ebp
+     1fc:	c3                   	ret
+     1fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000200 <usage>:
+{
+     200:	55                   	push   %ebp
+     201:	89 e5                	mov    %esp,%ebp
+     203:	83 ec 10             	sub    $0x10,%esp
+  printf(2, "usage: strace [-c] cmd [arg ...]\n");
+     206:	68 08 14 00 00       	push   $0x1408
+     20b:	6a 02                	push   $0x2
+     20d:	e8 7e 0c 00 00       	call   e90 <printf>
+  printf(2, "       strace -s [pid | on | off | reset]\n");
+     212:	58                   	pop    %eax
+     213:	5a                   	pop    %edx
+     214:	68 2c 14 00 00       	push   $0x142c
+     219:	6a 02                	push   $0x2
+     21b:	e8 70 0c 00 00       	call   e90 <printf>
+  exit();
+     220:	e8 02 08 00 00       	call   a27 <exit>
+     225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <run>:
+{
+     230:	55                   	push   %ebp
+     231:	89 e5                	mov    %esp,%ebp
+     233:	57                   	push   %edi
+     234:	56                   	push   %esi
+     235:	89 c6                	mov    %eax,%esi
+  if(pipe(fd) < 0){
+     237:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     23a:	53                   	push   %ebx
+     23b:	83 ec 58             	sub    $0x58,%esp
+     23e:	89 55 c0             	mov    %edx,-0x40(%ebp)
+  if(pipe(fd) < 0){
+     241:	50                   	push   %eax
+     242:	e8 14 08 00 00       	call   a5b <pipe>
+     247:	83 c4 10             	add    $0x10,%esp
+     24a:	85 c0                	test   %eax,%eax
+     24c:	0f 88 21 02 00 00    	js     473 <run+0x243>
+  if((pid = fork()) < 0){
+     252:	e8 b6 07 00 00       	call   a0d <fork>
+     257:	89 c3                	mov    %eax,%ebx
+     259:	85 c0                	test   %eax,%eax
+     25b:	0f 88 6a 02 00 00    	js     4cb <run+0x29b>
+  if(pid == 0){
+     261:	0f 84 1f 02 00 00    	je     486 <run+0x256>
+  close(fd[0]);
+     267:	83 ec 0c             	sub    $0xc,%esp
+     26a:	ff 75 e0             	push   -0x20(%ebp)
+     26d:	e8 37 08 00 00       	call   aa9 <close>
+  if(count)
+     272:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  was = 0;
+     275:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+  if(count)
+     27c:	83 c4 10             	add    $0x10,%esp
+     27f:	85 c0                	test   %eax,%eax
+     281:	0f 85 cf 01 00 00    	jne    456 <run+0x226>
+  systrace(ST_TRACE, pid);
+     287:	83 ec 08             	sub    $0x8,%esp
+  seq = 0;
+     28a:	31 ff                	xor    %edi,%edi
+  systrace(ST_TRACE, pid);
+     28c:	53                   	push   %ebx
+     28d:	6a 03                	push   $0x3
+     28f:	e8 07 0b 00 00       	call   d9b <systrace>
+  write(fd[1], "x", 1);
+     294:	83 c4 0c             	add    $0xc,%esp
+     297:	6a 01                	push   $0x1
+     299:	68 97 13 00 00       	push   $0x1397
+     29e:	ff 75 e4             	push   -0x1c(%ebp)
+     2a1:	e8 e9 07 00 00       	call   a8f <write>
+  close(fd[1]);
+     2a6:	5e                   	pop    %esi
+     2a7:	ff 75 e4             	push   -0x1c(%ebp)
+  seq = 0;
+     2aa:	89 fe                	mov    %edi,%esi
+  close(fd[1]);
+     2ac:	e8 f8 07 00 00       	call   aa9 <close>
+  seq = 0;
+     2b1:	89 5d b8             	mov    %ebx,-0x48(%ebp)
+  close(fd[1]);
+     2b4:	83 c4 10             	add    $0x10,%esp
+  while(!done && (n = traceread(ent, sizeof(ent)/sizeof(ent[0]))) > 0){
+     2b7:	83 ec 08             	sub    $0x8,%esp
+     2ba:	6a 10                	push   $0x10
+     2bc:	68 a0 1a 00 00       	push   $0x1aa0
+     2c1:	e8 09 0b 00 00       	call   dcf <traceread>
+     2c6:	83 c4 10             	add    $0x10,%esp
+     2c9:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     2cc:	85 c0                	test   %eax,%eax
+     2ce:	0f 8e 17 01 00 00    	jle    3eb <run+0x1bb>
+     2d4:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%ebp)
+     2db:	bb a0 1a 00 00       	mov    $0x1aa0,%ebx
+    for(i = 0; i < n; i++){
+     2e0:	31 ff                	xor    %edi,%edi
+     2e2:	eb 73                	jmp    357 <run+0x127>
+     2e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if(!count)
+     2e8:	8b 55 c0             	mov    -0x40(%ebp),%edx
+     2eb:	85 d2                	test   %edx,%edx
+     2ed:	75 59                	jne    348 <run+0x118>
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+     2ef:	8b 4b 1c             	mov    0x1c(%ebx),%ecx
+     2f2:	ba ff ff ff 7f       	mov    $0x7fffffff,%edx
+     2f7:	39 d1                	cmp    %edx,%ecx
+     2f9:	0f 46 d1             	cmovbe %ecx,%edx
+     2fc:	8b 4b 18             	mov    0x18(%ebx),%ecx
+     2ff:	89 55 c8             	mov    %edx,-0x38(%ebp)
+     302:	8b 53 0c             	mov    0xc(%ebx),%edx
+     305:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+     308:	8b 4b 14             	mov    0x14(%ebx),%ecx
+     30b:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  if(num > 0 && num < NSYSCALL && names[num])
+     30e:	8d 50 ff             	lea    -0x1(%eax),%edx
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+     311:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     314:	8b 4b 10             	mov    0x10(%ebx),%ecx
+  if(num > 0 && num < NSYSCALL && names[num])
+     317:	83 fa 26             	cmp    $0x26,%edx
+     31a:	0f 86 a8 00 00 00    	jbe    3c8 <run+0x198>
+  return "?";
+     320:	b8 80 12 00 00       	mov    $0x1280,%eax
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+     325:	83 ec 0c             	sub    $0xc,%esp
+     328:	ff 75 c8             	push   -0x38(%ebp)
+     32b:	ff 75 d4             	push   -0x2c(%ebp)
+     32e:	ff 75 d0             	push   -0x30(%ebp)
+     331:	51                   	push   %ecx
+     332:	ff 75 cc             	push   -0x34(%ebp)
+     335:	50                   	push   %eax
+     336:	ff 73 04             	push   0x4(%ebx)
+     339:	68 58 14 00 00       	push   $0x1458
+     33e:	6a 01                	push   $0x1
+     340:	e8 4b 0b 00 00       	call   e90 <printf>
+     345:	83 c4 30             	add    $0x30,%esp
+    for(i = 0; i < n; i++){
+     348:	83 c7 01             	add    $0x1,%edi
+     34b:	83 c3 20             	add    $0x20,%ebx
+     34e:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+     351:	0f 84 89 00 00 00    	je     3e0 <run+0x1b0>
+      if(seq != 0 && e->seq != seq)
+     357:	8b 03                	mov    (%ebx),%eax
+     359:	85 f6                	test   %esi,%esi
+     35b:	74 1b                	je     378 <run+0x148>
+     35d:	39 c6                	cmp    %eax,%esi
+     35f:	74 17                	je     378 <run+0x148>
+        printf(1, "... %d calls lost\n", e->seq - seq);
+     361:	83 ec 04             	sub    $0x4,%esp
+     364:	29 f0                	sub    %esi,%eax
+     366:	50                   	push   %eax
+     367:	68 d9 12 00 00       	push   $0x12d9
+     36c:	6a 01                	push   $0x1
+     36e:	e8 1d 0b 00 00       	call   e90 <printf>
+      seq = e->seq + 1;
+     373:	8b 03                	mov    (%ebx),%eax
+     375:	83 c4 10             	add    $0x10,%esp
+     378:	8d 70 01             	lea    0x1(%eax),%esi
+      if(e->num == SYS_exit){
+     37b:	8b 43 08             	mov    0x8(%ebx),%eax
+     37e:	83 f8 02             	cmp    $0x2,%eax
+     381:	0f 85 61 ff ff ff    	jne    2e8 <run+0xb8>
+        if(count)
+     387:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     38a:	85 c0                	test   %eax,%eax
+     38c:	0f 85 7e 00 00 00    	jne    410 <run+0x1e0>
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+     392:	8b 53 1c             	mov    0x1c(%ebx),%edx
+     395:	b8 ff ff ff 7f       	mov    $0x7fffffff,%eax
+     39a:	8b 4b 10             	mov    0x10(%ebx),%ecx
+        done = 1;
+     39d:	c7 45 bc 01 00 00 00 	movl   $0x1,-0x44(%ebp)
+     3a4:	39 c2                	cmp    %eax,%edx
+     3a6:	0f 46 c2             	cmovbe %edx,%eax
+     3a9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+     3ac:	8b 43 18             	mov    0x18(%ebx),%eax
+     3af:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     3b2:	8b 43 14             	mov    0x14(%ebx),%eax
+     3b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     3b8:	8b 43 0c             	mov    0xc(%ebx),%eax
+     3bb:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if(num > 0 && num < NSYSCALL && names[num])
+     3be:	b8 92 12 00 00       	mov    $0x1292,%eax
+     3c3:	e9 5d ff ff ff       	jmp    325 <run+0xf5>
+     3c8:	8b 04 85 80 14 00 00 	mov    0x1480(,%eax,4),%eax
+     3cf:	85 c0                	test   %eax,%eax
+     3d1:	0f 84 49 ff ff ff    	je     320 <run+0xf0>
+     3d7:	e9 49 ff ff ff       	jmp    325 <run+0xf5>
+     3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while(!done && (n = traceread(ent, sizeof(ent)/sizeof(ent[0]))) > 0){
+     3e0:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+     3e3:	85 c9                	test   %ecx,%ecx
+     3e5:	0f 84 cc fe ff ff    	je     2b7 <run+0x87>
+  if(count && sysstat(pid, &st) == 0)
+     3eb:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+     3ef:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+     3f2:	75 1f                	jne    413 <run+0x1e3>
+  systrace(ST_TRACE, -1);
+     3f4:	83 ec 08             	sub    $0x8,%esp
+     3f7:	6a ff                	push   $0xffffffff
+     3f9:	6a 03                	push   $0x3
+     3fb:	e8 9b 09 00 00       	call   d9b <systrace>
+     400:	83 c4 10             	add    $0x10,%esp
+  wait();
+     403:	e8 39 06 00 00       	call   a41 <wait>
+}
+     408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     40b:	5b                   	pop    %ebx
+     40c:	5e                   	pop    %esi
+     40d:	5f                   	pop    %edi
+     40e:	5d                   	pop    %ebp
+     40f:	c3                   	ret
+     410:	8b 5d b8             	mov    -0x48(%ebp),%ebx
+  if(count && sysstat(pid, &st) == 0)
+     413:	51                   	push   %ecx
+     414:	51                   	push   %ecx
+     415:	68 a0 1c 00 00       	push   $0x1ca0
+     41a:	53                   	push   %ebx
+     41b:	e8 95 09 00 00       	call   db5 <sysstat>
+     420:	83 c4 10             	add    $0x10,%esp
+     423:	85 c0                	test   %eax,%eax
+     425:	74 45                	je     46c <run+0x23c>
+  systrace(ST_TRACE, -1);
+     427:	52                   	push   %edx
+     428:	52                   	push   %edx
+     429:	6a ff                	push   $0xffffffff
+     42b:	6a 03                	push   $0x3
+     42d:	e8 69 09 00 00       	call   d9b <systrace>
+  if(count && !was)
+     432:	83 c4 10             	add    $0x10,%esp
+     435:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+     439:	75 0e                	jne    449 <run+0x219>
+    systrace(ST_STATS, 0);
+     43b:	50                   	push   %eax
+     43c:	50                   	push   %eax
+     43d:	6a 00                	push   $0x0
+     43f:	6a 01                	push   $0x1
+     441:	e8 55 09 00 00       	call   d9b <systrace>
+     446:	83 c4 10             	add    $0x10,%esp
+  wait();
+     449:	e8 f3 05 00 00       	call   a41 <wait>
+}
+     44e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     451:	5b                   	pop    %ebx
+     452:	5e                   	pop    %esi
+     453:	5f                   	pop    %edi
+     454:	5d                   	pop    %ebp
+     455:	c3                   	ret
+    was = systrace(ST_STATS, 1);
+     456:	57                   	push   %edi
+     457:	57                   	push   %edi
+     458:	6a 01                	push   $0x1
+     45a:	6a 01                	push   $0x1
+     45c:	e8 3a 09 00 00       	call   d9b <systrace>
+     461:	83 c4 10             	add    $0x10,%esp
+     464:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+     467:	e9 1b fe ff ff       	jmp    287 <run+0x57>
+    printstats();
+     46c:	e8 cf fc ff ff       	call   140 <printstats>
+     471:	eb b4                	jmp    427 <run+0x1f7>
+    printf(2, "strace: pipe failed\n");
+     473:	53                   	push   %ebx
+     474:	53                   	push   %ebx
+     475:	68 97 12 00 00       	push   $0x1297
+     47a:	6a 02                	push   $0x2
+     47c:	e8 0f 0a 00 00       	call   e90 <printf>
+    exit();
+     481:	e8 a1 05 00 00       	call   a27 <exit>
+    close(fd[1]);
+     486:	83 ec 0c             	sub    $0xc,%esp
+     489:	ff 75 e4             	push   -0x1c(%ebp)
+     48c:	e8 18 06 00 00       	call   aa9 <close>
+    read(fd[0], &c, 1);
+     491:	83 c4 0c             	add    $0xc,%esp
+     494:	8d 45 df             	lea    -0x21(%ebp),%eax
+     497:	6a 01                	push   $0x1
+     499:	50                   	push   %eax
+     49a:	ff 75 e0             	push   -0x20(%ebp)
+     49d:	e8 d3 05 00 00       	call   a75 <read>
+    close(fd[0]);
+     4a2:	58                   	pop    %eax
+     4a3:	ff 75 e0             	push   -0x20(%ebp)
+     4a6:	e8 fe 05 00 00       	call   aa9 <close>
+    exec(argv[0], argv);
+     4ab:	58                   	pop    %eax
+     4ac:	5a                   	pop    %edx
+     4ad:	56                   	push   %esi
+     4ae:	ff 36                	push   (%esi)
+     4b0:	e8 28 06 00 00       	call   add <exec>
+    printf(2, "strace: exec %s failed\n", argv[0]);
+     4b5:	83 c4 0c             	add    $0xc,%esp
+     4b8:	ff 36                	push   (%esi)
+     4ba:	68 c1 12 00 00       	push   $0x12c1
+     4bf:	6a 02                	push   $0x2
+     4c1:	e8 ca 09 00 00       	call   e90 <printf>
+    exit();
+     4c6:	e8 5c 05 00 00       	call   a27 <exit>
+    printf(2, "strace: fork failed\n");
+     4cb:	51                   	push   %ecx
+     4cc:	51                   	push   %ecx
+     4cd:	68 ac 12 00 00       	push   $0x12ac
+     4d2:	6a 02                	push   $0x2
+     4d4:	e8 b7 09 00 00       	call   e90 <printf>
+    exit();
+     4d9:	e8 49 05 00 00       	call   a27 <exit>
+     4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     4e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     4e1:	31 c0                	xor    %eax,%eax
+{
+     4e3:	89 e5                	mov    %esp,%ebp
+     4e5:	53                   	push   %ebx
+     4e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     4ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     4f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     4f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     4f7:	83 c0 01             	add    $0x1,%eax
+     4fa:	84 d2                	test   %dl,%dl
+     4fc:	75 f2                	jne    4f0 <strcpy+0x10>
+    ;
+  return os;
+}
+     4fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     501:	89 c8                	mov    %ecx,%eax
+     503:	c9                   	leave
+     504:	c3                   	ret
+     505:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     50c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     510:	55                   	push   %ebp
+     511:	89 e5                	mov    %esp,%ebp
+     513:	53                   	push   %ebx
+     514:	8b 55 08             	mov    0x8(%ebp),%edx
+     517:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     51a:	0f b6 02             	movzbl (%edx),%eax
+     51d:	84 c0                	test   %al,%al
+     51f:	75 17                	jne    538 <strcmp+0x28>
+     521:	eb 3a                	jmp    55d <strcmp+0x4d>
+     523:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     527:	90                   	nop
+     528:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     52c:	83 c2 01             	add    $0x1,%edx
+     52f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     532:	84 c0                	test   %al,%al
+     534:	74 1a                	je     550 <strcmp+0x40>
+    p++, q++;
+     536:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     538:	0f b6 19             	movzbl (%ecx),%ebx
+     53b:	38 c3                	cmp    %al,%bl
+     53d:	74 e9                	je     528 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     53f:	29 d8                	sub    %ebx,%eax
+}
+     541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     544:	c9                   	leave
+     545:	c3                   	ret
+     546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     54d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     550:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     554:	31 c0                	xor    %eax,%eax
+     556:	29 d8                	sub    %ebx,%eax
+}
+     558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     55b:	c9                   	leave
+     55c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     55d:	0f b6 19             	movzbl (%ecx),%ebx
+     560:	31 c0                	xor    %eax,%eax
+     562:	eb db                	jmp    53f <strcmp+0x2f>
+     564:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     56f:	90                   	nop
+
+00000570 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     570:	55                   	push   %ebp
+     571:	89 e5                	mov    %esp,%ebp
+     573:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     576:	80 3a 00             	cmpb   $0x0,(%edx)
+     579:	74 15                	je     590 <strlen+0x20>
+     57b:	31 c0                	xor    %eax,%eax
+     57d:	8d 76 00             	lea    0x0(%esi),%esi
+     580:	83 c0 01             	add    $0x1,%eax
+     583:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     587:	89 c1                	mov    %eax,%ecx
+     589:	75 f5                	jne    580 <strlen+0x10>
+    ;
+  return n;
+}
+     58b:	89 c8                	mov    %ecx,%eax
+     58d:	5d                   	pop    %ebp
+     58e:	c3                   	ret
+     58f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     590:	31 c9                	xor    %ecx,%ecx
+}
+     592:	5d                   	pop    %ebp
+     593:	89 c8                	mov    %ecx,%eax
+     595:	c3                   	ret
+     596:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     5a0:	55                   	push   %ebp
+     5a1:	89 e5                	mov    %esp,%ebp
+     5a3:	57                   	push   %edi
+     5a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     5a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     5aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5ad:	89 d7                	mov    %edx,%edi
+     5af:	fc                   	cld
+     5b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     5b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     5b5:	89 d0                	mov    %edx,%eax
+     5b7:	c9                   	leave
+     5b8:	c3                   	ret
+     5b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     5c0:	55                   	push   %ebp
+     5c1:	89 e5                	mov    %esp,%ebp
+     5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     5ca:	0f b6 10             	movzbl (%eax),%edx
+     5cd:	84 d2                	test   %dl,%dl
+     5cf:	75 12                	jne    5e3 <strchr+0x23>
+     5d1:	eb 1d                	jmp    5f0 <strchr+0x30>
+     5d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5d7:	90                   	nop
+     5d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     5dc:	83 c0 01             	add    $0x1,%eax
+     5df:	84 d2                	test   %dl,%dl
+     5e1:	74 0d                	je     5f0 <strchr+0x30>
+    if(*s == c)
+     5e3:	38 d1                	cmp    %dl,%cl
+     5e5:	75 f1                	jne    5d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     5e7:	5d                   	pop    %ebp
+     5e8:	c3                   	ret
+     5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     5f0:	31 c0                	xor    %eax,%eax
+}
+     5f2:	5d                   	pop    %ebp
+     5f3:	c3                   	ret
+     5f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     5ff:	90                   	nop
+
+00000600 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     600:	55                   	push   %ebp
+     601:	89 e5                	mov    %esp,%ebp
+     603:	57                   	push   %edi
+     604:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     605:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     608:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     609:	31 db                	xor    %ebx,%ebx
+{
+     60b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     60e:	eb 27                	jmp    637 <gets+0x37>
+    cc = read(0, &c, 1);
+     610:	83 ec 04             	sub    $0x4,%esp
+     613:	6a 01                	push   $0x1
+     615:	56                   	push   %esi
+     616:	6a 00                	push   $0x0
+     618:	e8 58 04 00 00       	call   a75 <read>
+    if(cc < 1)
+     61d:	83 c4 10             	add    $0x10,%esp
+     620:	85 c0                	test   %eax,%eax
+     622:	7e 1d                	jle    641 <gets+0x41>
+      break;
+    buf[i++] = c;
+     624:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     628:	8b 55 08             	mov    0x8(%ebp),%edx
+     62b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     62f:	3c 0a                	cmp    $0xa,%al
+     631:	74 10                	je     643 <gets+0x43>
+     633:	3c 0d                	cmp    $0xd,%al
+     635:	74 0c                	je     643 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     637:	89 df                	mov    %ebx,%edi
+     639:	83 c3 01             	add    $0x1,%ebx
+     63c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     63f:	7c cf                	jl     610 <gets+0x10>
+     641:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     643:	8b 45 08             	mov    0x8(%ebp),%eax
+     646:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     64a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     64d:	5b                   	pop    %ebx
+     64e:	5e                   	pop    %esi
+     64f:	5f                   	pop    %edi
+     650:	5d                   	pop    %ebp
+     651:	c3                   	ret
+     652:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     659:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     660:	55                   	push   %ebp
+     661:	89 e5                	mov    %esp,%ebp
+     663:	56                   	push   %esi
+     664:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     665:	83 ec 08             	sub    $0x8,%esp
+     668:	6a 00                	push   $0x0
+     66a:	ff 75 08             	push   0x8(%ebp)
+     66d:	e8 85 04 00 00       	call   af7 <open>
+  if(fd < 0)
+     672:	83 c4 10             	add    $0x10,%esp
+     675:	85 c0                	test   %eax,%eax
+     677:	78 27                	js     6a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     679:	83 ec 08             	sub    $0x8,%esp
+     67c:	ff 75 0c             	push   0xc(%ebp)
+     67f:	89 c3                	mov    %eax,%ebx
+     681:	50                   	push   %eax
+     682:	e8 be 04 00 00       	call   b45 <fstat>
+  close(fd);
+     687:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     68a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     68c:	e8 18 04 00 00       	call   aa9 <close>
+  return r;
+     691:	83 c4 10             	add    $0x10,%esp
+}
+     694:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     697:	89 f0                	mov    %esi,%eax
+     699:	5b                   	pop    %ebx
+     69a:	5e                   	pop    %esi
+     69b:	5d                   	pop    %ebp
+     69c:	c3                   	ret
+     69d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     6a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6a5:	eb ed                	jmp    694 <stat+0x34>
+     6a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ae:	66 90                	xchg   %ax,%ax
+
+000006b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     6b0:	55                   	push   %ebp
+     6b1:	89 e5                	mov    %esp,%ebp
+     6b3:	53                   	push   %ebx
+     6b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     6b7:	0f be 02             	movsbl (%edx),%eax
+     6ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     6bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     6c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     6c5:	77 1e                	ja     6e5 <atoi+0x35>
+     6c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     6d0:	83 c2 01             	add    $0x1,%edx
+     6d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     6d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     6da:	0f be 02             	movsbl (%edx),%eax
+     6dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     6e0:	80 fb 09             	cmp    $0x9,%bl
+     6e3:	76 eb                	jbe    6d0 <atoi+0x20>
+  return n;
+}
+     6e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e8:	89 c8                	mov    %ecx,%eax
+     6ea:	c9                   	leave
+     6eb:	c3                   	ret
+     6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     6f0:	55                   	push   %ebp
+     6f1:	89 e5                	mov    %esp,%ebp
+     6f3:	57                   	push   %edi
+     6f4:	56                   	push   %esi
+     6f5:	8b 45 10             	mov    0x10(%ebp),%eax
+     6f8:	8b 55 08             	mov    0x8(%ebp),%edx
+     6fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     6fe:	85 c0                	test   %eax,%eax
+     700:	7e 13                	jle    715 <memmove+0x25>
+     702:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     704:	89 d7                	mov    %edx,%edi
+     706:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     710:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     711:	39 f8                	cmp    %edi,%eax
+     713:	75 fb                	jne    710 <memmove+0x20>
+  return vdst;
+}
+     715:	5e                   	pop    %esi
+     716:	89 d0                	mov    %edx,%eax
+     718:	5f                   	pop    %edi
+     719:	5d                   	pop    %ebp
+     71a:	c3                   	ret
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+
+00000720 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     723:	8b 45 08             	mov    0x8(%ebp),%eax
+     726:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     72c:	5d                   	pop    %ebp
+     72d:	c3                   	ret
+     72e:	66 90                	xchg   %ax,%ax
+
+00000730 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+     730:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+     731:	31 c0                	xor    %eax,%eax
+     733:	ba 01 00 00 00       	mov    $0x1,%edx
+     738:	89 e5                	mov    %esp,%ebp
+     73a:	56                   	push   %esi
+     73b:	53                   	push   %ebx
+     73c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     73f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     743:	85 c0                	test   %eax,%eax
+     745:	74 32                	je     779 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+     747:	83 f8 02             	cmp    $0x2,%eax
+     74a:	74 0c                	je     758 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+     74c:	b8 02 00 00 00       	mov    $0x2,%eax
+     751:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+     754:	85 c0                	test   %eax,%eax
+     756:	74 21                	je     779 <mutex_lock+0x49>
+     758:	be 02 00 00 00       	mov    $0x2,%esi
+     75d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     760:	83 ec 04             	sub    $0x4,%esp
+     763:	6a 02                	push   $0x2
+     765:	6a 00                	push   $0x0
+     767:	53                   	push   %ebx
+     768:	e8 2a 05 00 00       	call   c97 <futex>
+     76d:	89 f0                	mov    %esi,%eax
+     76f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     772:	83 c4 10             	add    $0x10,%esp
+     775:	85 c0                	test   %eax,%eax
+     777:	75 e7                	jne    760 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+     779:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     77c:	5b                   	pop    %ebx
+     77d:	5e                   	pop    %esi
+     77e:	5d                   	pop    %ebp
+     77f:	c3                   	ret
+
+00000780 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+     780:	55                   	push   %ebp
+     781:	31 c0                	xor    %eax,%eax
+     783:	89 e5                	mov    %esp,%ebp
+     785:	83 ec 08             	sub    $0x8,%esp
+     788:	8b 55 08             	mov    0x8(%ebp),%edx
+     78b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     78e:	83 f8 02             	cmp    $0x2,%eax
+     791:	74 05                	je     798 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     793:	c9                   	leave
+     794:	c3                   	ret
+     795:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     798:	83 ec 04             	sub    $0x4,%esp
+     79b:	6a 01                	push   $0x1
+     79d:	6a 01                	push   $0x1
+     79f:	52                   	push   %edx
+     7a0:	e8 f2 04 00 00       	call   c97 <futex>
+     7a5:	83 c4 10             	add    $0x10,%esp
+}
+     7a8:	c9                   	leave
+     7a9:	c3                   	ret
+     7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007b0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+     7b0:	55                   	push   %ebp
+     7b1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     7bc:	5d                   	pop    %ebp
+     7bd:	c3                   	ret
+     7be:	66 90                	xchg   %ax,%ax
+
+000007c0 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+     7c0:	55                   	push   %ebp
+     7c1:	31 c0                	xor    %eax,%eax
+     7c3:	89 e5                	mov    %esp,%ebp
+     7c5:	57                   	push   %edi
+     7c6:	56                   	push   %esi
+     7c7:	53                   	push   %ebx
+     7c8:	83 ec 0c             	sub    $0xc,%esp
+     7cb:	8b 75 08             	mov    0x8(%ebp),%esi
+     7ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     7d1:	8b 3e                	mov    (%esi),%edi
+     7d3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     7d6:	83 f8 02             	cmp    $0x2,%eax
+     7d9:	74 5d                	je     838 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     7db:	83 ec 04             	sub    $0x4,%esp
+     7de:	57                   	push   %edi
+     7df:	6a 00                	push   $0x0
+     7e1:	56                   	push   %esi
+     7e2:	e8 b0 04 00 00       	call   c97 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+     7e7:	31 c0                	xor    %eax,%eax
+     7e9:	ba 01 00 00 00       	mov    $0x1,%edx
+     7ee:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     7f2:	83 c4 10             	add    $0x10,%esp
+     7f5:	85 c0                	test   %eax,%eax
+     7f7:	74 30                	je     829 <cond_wait+0x69>
+  if(c != 2)
+     7f9:	83 f8 02             	cmp    $0x2,%eax
+     7fc:	74 0c                	je     80a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+     7fe:	b8 02 00 00 00       	mov    $0x2,%eax
+     803:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     806:	85 c0                	test   %eax,%eax
+     808:	74 1f                	je     829 <cond_wait+0x69>
+     80a:	be 02 00 00 00       	mov    $0x2,%esi
+     80f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+     810:	83 ec 04             	sub    $0x4,%esp
+     813:	6a 02                	push   $0x2
+     815:	6a 00                	push   $0x0
+     817:	53                   	push   %ebx
+     818:	e8 7a 04 00 00       	call   c97 <futex>
+     81d:	89 f0                	mov    %esi,%eax
+     81f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+     822:	83 c4 10             	add    $0x10,%esp
+     825:	85 c0                	test   %eax,%eax
+     827:	75 e7                	jne    810 <cond_wait+0x50>
+  mutex_lock(m);
+}
+     829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     82c:	5b                   	pop    %ebx
+     82d:	5e                   	pop    %esi
+     82e:	5f                   	pop    %edi
+     82f:	5d                   	pop    %ebp
+     830:	c3                   	ret
+     831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     838:	83 ec 04             	sub    $0x4,%esp
+     83b:	6a 01                	push   $0x1
+     83d:	6a 01                	push   $0x1
+     83f:	53                   	push   %ebx
+     840:	e8 52 04 00 00       	call   c97 <futex>
+     845:	83 c4 10             	add    $0x10,%esp
+     848:	eb 91                	jmp    7db <cond_wait+0x1b>
+     84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000850 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+     854:	83 ec 04             	sub    $0x4,%esp
+     857:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     860:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     862:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+     865:	89 c8                	mov    %ecx,%eax
+     867:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     86b:	39 c1                	cmp    %eax,%ecx
+     86d:	75 f1                	jne    860 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+     86f:	83 ec 04             	sub    $0x4,%esp
+     872:	6a 01                	push   $0x1
+     874:	6a 01                	push   $0x1
+     876:	52                   	push   %edx
+     877:	e8 1b 04 00 00       	call   c97 <futex>
+}
+     87c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     87f:	83 c4 10             	add    $0x10,%esp
+     882:	c9                   	leave
+     883:	c3                   	ret
+     884:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     88b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     88f:	90                   	nop
+
+00000890 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	53                   	push   %ebx
+     894:	83 ec 04             	sub    $0x4,%esp
+     897:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+     89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+     8a0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     8a2:	8d 59 01             	lea    0x1(%ecx),%ebx
+     8a5:	89 c8                	mov    %ecx,%eax
+     8a7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+     8ab:	39 c1                	cmp    %eax,%ecx
+     8ad:	75 f1                	jne    8a0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+     8af:	83 ec 04             	sub    $0x4,%esp
+     8b2:	6a 40                	push   $0x40
+     8b4:	6a 01                	push   $0x1
+     8b6:	52                   	push   %edx
+     8b7:	e8 db 03 00 00       	call   c97 <futex>
+}
+     8bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8bf:	83 c4 10             	add    $0x10,%esp
+     8c2:	c9                   	leave
+     8c3:	c3                   	ret
+     8c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     8cf:	90                   	nop
+
+000008d0 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+     8d0:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+     8d5:	c3                   	ret
+     8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008e0 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+     8e0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+     8e5:	85 c0                	test   %eax,%eax
+     8e7:	74 07                	je     8f0 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+     8e9:	c3                   	ret
+     8ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+     8f0:	e9 d2 02 00 00       	jmp    bc7 <getpid>
+     8f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	57                   	push   %edi
+     904:	56                   	push   %esi
+     905:	53                   	push   %ebx
+     906:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+     909:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+     90b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     911:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     917:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     91c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     922:	89 45 e8             	mov    %eax,-0x18(%ebp)
+     925:	89 d0                	mov    %edx,%eax
+     927:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     92a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     930:	29 d9                	sub    %ebx,%ecx
+     932:	89 c6                	mov    %eax,%esi
+     934:	89 d7                	mov    %edx,%edi
+     936:	0f a5 c7             	shld   %cl,%eax,%edi
+     939:	d3 e6                	shl    %cl,%esi
+     93b:	31 c0                	xor    %eax,%eax
+     93d:	f6 c1 20             	test   $0x20,%cl
+     940:	0f 45 fe             	cmovne %esi,%edi
+     943:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     946:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     949:	89 d9                	mov    %ebx,%ecx
+     94b:	31 db                	xor    %ebx,%ebx
+     94d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     953:	0f ad d0             	shrd   %cl,%edx,%eax
+     956:	d3 ea                	shr    %cl,%edx
+     958:	f6 c1 20             	test   $0x20,%cl
+     95b:	0f 45 c2             	cmovne %edx,%eax
+     95e:	0f 45 d3             	cmovne %ebx,%edx
+     961:	01 f0                	add    %esi,%eax
+     963:	11 fa                	adc    %edi,%edx
+}
+     965:	83 c4 0c             	add    $0xc,%esp
+     968:	5b                   	pop    %ebx
+     969:	5e                   	pop    %esi
+     96a:	5f                   	pop    %edi
+     96b:	5d                   	pop    %ebp
+     96c:	c3                   	ret
+     96d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000970 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     970:	55                   	push   %ebp
+     971:	89 e5                	mov    %esp,%ebp
+     973:	57                   	push   %edi
+     974:	56                   	push   %esi
+     975:	53                   	push   %ebx
+     976:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+     979:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+     97d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+     980:	74 0e                	je     990 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+     982:	83 c4 1c             	add    $0x1c,%esp
+     985:	5b                   	pop    %ebx
+     986:	5e                   	pop    %esi
+     987:	5f                   	pop    %edi
+     988:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+     989:	e9 a5 03 00 00       	jmp    d33 <clock_gettime>
+     98e:	66 90                	xchg   %ax,%ax
+     990:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+     992:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+     998:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+     99e:	b9 20 00 00 00       	mov    $0x20,%ecx
+     9a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     9a6:	89 d0                	mov    %edx,%eax
+     9a8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     9ab:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     9b1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+     9b7:	89 c6                	mov    %eax,%esi
+     9b9:	89 d7                	mov    %edx,%edi
+     9bb:	0f a5 c7             	shld   %cl,%eax,%edi
+     9be:	d3 e6                	shl    %cl,%esi
+     9c0:	31 c0                	xor    %eax,%eax
+     9c2:	f6 c1 20             	test   $0x20,%cl
+     9c5:	0f 45 fe             	cmovne %esi,%edi
+     9c8:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+     9cb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     9ce:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+     9d5:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+     9db:	0f ad d0             	shrd   %cl,%edx,%eax
+     9de:	d3 ea                	shr    %cl,%edx
+     9e0:	f6 c1 20             	test   $0x20,%cl
+     9e3:	74 04                	je     9e9 <vclock_gettime+0x79>
+     9e5:	89 d0                	mov    %edx,%eax
+     9e7:	31 d2                	xor    %edx,%edx
+     9e9:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     9eb:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+     9f0:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+     9f2:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+     9f4:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+     9f6:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     9f8:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+     9fe:	29 c1                	sub    %eax,%ecx
+}
+     a00:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+     a02:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+     a05:	83 c4 1c             	add    $0x1c,%esp
+     a08:	5b                   	pop    %ebx
+     a09:	5e                   	pop    %esi
+     a0a:	5f                   	pop    %edi
+     a0b:	5d                   	pop    %ebp
+     a0c:	c3                   	ret
+
+00000a0d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+     a0d:	b8 01 00 00 00       	mov    $0x1,%eax
+     a12:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a19:	74 09                	je     a24 <fork+0x17>
+     a1b:	89 e1                	mov    %esp,%ecx
+     a1d:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a22:	0f 34                	sysenter
+     a24:	cd 40                	int    $0x40
+     a26:	c3                   	ret
+
+00000a27 <exit>:
+SYSCALL(exit)
+     a27:	b8 02 00 00 00       	mov    $0x2,%eax
+     a2c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a33:	74 09                	je     a3e <exit+0x17>
+     a35:	89 e1                	mov    %esp,%ecx
+     a37:	ba 40 0a 00 00       	mov    $0xa40,%edx
+     a3c:	0f 34                	sysenter
+     a3e:	cd 40                	int    $0x40
+     a40:	c3                   	ret
+
+00000a41 <wait>:
+SYSCALL(wait)
+     a41:	b8 03 00 00 00       	mov    $0x3,%eax
+     a46:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a4d:	74 09                	je     a58 <wait+0x17>
+     a4f:	89 e1                	mov    %esp,%ecx
+     a51:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a56:	0f 34                	sysenter
+     a58:	cd 40                	int    $0x40
+     a5a:	c3                   	ret
+
+00000a5b <pipe>:
+SYSCALL(pipe)
+     a5b:	b8 04 00 00 00       	mov    $0x4,%eax
+     a60:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a67:	74 09                	je     a72 <pipe+0x17>
+     a69:	89 e1                	mov    %esp,%ecx
+     a6b:	ba 74 0a 00 00       	mov    $0xa74,%edx
+     a70:	0f 34                	sysenter
+     a72:	cd 40                	int    $0x40
+     a74:	c3                   	ret
+
+00000a75 <read>:
+SYSCALL(read)
+     a75:	b8 05 00 00 00       	mov    $0x5,%eax
+     a7a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a81:	74 09                	je     a8c <read+0x17>
+     a83:	89 e1                	mov    %esp,%ecx
+     a85:	ba 8e 0a 00 00       	mov    $0xa8e,%edx
+     a8a:	0f 34                	sysenter
+     a8c:	cd 40                	int    $0x40
+     a8e:	c3                   	ret
+
+00000a8f <write>:
+SYSCALL(write)
+     a8f:	b8 10 00 00 00       	mov    $0x10,%eax
+     a94:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     a9b:	74 09                	je     aa6 <write+0x17>
+     a9d:	89 e1                	mov    %esp,%ecx
+     a9f:	ba a8 0a 00 00       	mov    $0xaa8,%edx
+     aa4:	0f 34                	sysenter
+     aa6:	cd 40                	int    $0x40
+     aa8:	c3                   	ret
+
+00000aa9 <close>:
+SYSCALL(close)
+     aa9:	b8 15 00 00 00       	mov    $0x15,%eax
+     aae:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ab5:	74 09                	je     ac0 <close+0x17>
+     ab7:	89 e1                	mov    %esp,%ecx
+     ab9:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     abe:	0f 34                	sysenter
+     ac0:	cd 40                	int    $0x40
+     ac2:	c3                   	ret
+
+00000ac3 <kill>:
+SYSCALL(kill)
+     ac3:	b8 06 00 00 00       	mov    $0x6,%eax
+     ac8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     acf:	74 09                	je     ada <kill+0x17>
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba dc 0a 00 00       	mov    $0xadc,%edx
+     ad8:	0f 34                	sysenter
+     ada:	cd 40                	int    $0x40
+     adc:	c3                   	ret
+
+00000add <exec>:
+SYSCALL(exec)
+     add:	b8 07 00 00 00       	mov    $0x7,%eax
+     ae2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ae9:	74 09                	je     af4 <exec+0x17>
+     aeb:	89 e1                	mov    %esp,%ecx
+     aed:	ba f6 0a 00 00       	mov    $0xaf6,%edx
+     af2:	0f 34                	sysenter
+     af4:	cd 40                	int    $0x40
+     af6:	c3                   	ret
+
+00000af7 <open>:
+SYSCALL(open)
+     af7:	b8 0f 00 00 00       	mov    $0xf,%eax
+     afc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b03:	74 09                	je     b0e <open+0x17>
+     b05:	89 e1                	mov    %esp,%ecx
+     b07:	ba 10 0b 00 00       	mov    $0xb10,%edx
+     b0c:	0f 34                	sysenter
+     b0e:	cd 40                	int    $0x40
+     b10:	c3                   	ret
+
+00000b11 <mknod>:
+SYSCALL(mknod)
+     b11:	b8 11 00 00 00       	mov    $0x11,%eax
+     b16:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b1d:	74 09                	je     b28 <mknod+0x17>
+     b1f:	89 e1                	mov    %esp,%ecx
+     b21:	ba 2a 0b 00 00       	mov    $0xb2a,%edx
+     b26:	0f 34                	sysenter
+     b28:	cd 40                	int    $0x40
+     b2a:	c3                   	ret
+
+00000b2b <unlink>:
+SYSCALL(unlink)
+     b2b:	b8 12 00 00 00       	mov    $0x12,%eax
+     b30:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b37:	74 09                	je     b42 <unlink+0x17>
+     b39:	89 e1                	mov    %esp,%ecx
+     b3b:	ba 44 0b 00 00       	mov    $0xb44,%edx
+     b40:	0f 34                	sysenter
+     b42:	cd 40                	int    $0x40
+     b44:	c3                   	ret
+
+00000b45 <fstat>:
+SYSCALL(fstat)
+     b45:	b8 08 00 00 00       	mov    $0x8,%eax
+     b4a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b51:	74 09                	je     b5c <fstat+0x17>
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5e 0b 00 00       	mov    $0xb5e,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	cd 40                	int    $0x40
+     b5e:	c3                   	ret
+
+00000b5f <link>:
+SYSCALL(link)
+     b5f:	b8 13 00 00 00       	mov    $0x13,%eax
+     b64:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b6b:	74 09                	je     b76 <link+0x17>
+     b6d:	89 e1                	mov    %esp,%ecx
+     b6f:	ba 78 0b 00 00       	mov    $0xb78,%edx
+     b74:	0f 34                	sysenter
+     b76:	cd 40                	int    $0x40
+     b78:	c3                   	ret
+
+00000b79 <mkdir>:
+SYSCALL(mkdir)
+     b79:	b8 14 00 00 00       	mov    $0x14,%eax
+     b7e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b85:	74 09                	je     b90 <mkdir+0x17>
+     b87:	89 e1                	mov    %esp,%ecx
+     b89:	ba 92 0b 00 00       	mov    $0xb92,%edx
+     b8e:	0f 34                	sysenter
+     b90:	cd 40                	int    $0x40
+     b92:	c3                   	ret
+
+00000b93 <chdir>:
+SYSCALL(chdir)
+     b93:	b8 09 00 00 00       	mov    $0x9,%eax
+     b98:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     b9f:	74 09                	je     baa <chdir+0x17>
+     ba1:	89 e1                	mov    %esp,%ecx
+     ba3:	ba ac 0b 00 00       	mov    $0xbac,%edx
+     ba8:	0f 34                	sysenter
+     baa:	cd 40                	int    $0x40
+     bac:	c3                   	ret
+
+00000bad <dup>:
+SYSCALL(dup)
+     bad:	b8 0a 00 00 00       	mov    $0xa,%eax
+     bb2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bb9:	74 09                	je     bc4 <dup+0x17>
+     bbb:	89 e1                	mov    %esp,%ecx
+     bbd:	ba c6 0b 00 00       	mov    $0xbc6,%edx
+     bc2:	0f 34                	sysenter
+     bc4:	cd 40                	int    $0x40
+     bc6:	c3                   	ret
+
+00000bc7 <getpid>:
+SYSCALL(getpid)
+     bc7:	b8 0b 00 00 00       	mov    $0xb,%eax
+     bcc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bd3:	74 09                	je     bde <getpid+0x17>
+     bd5:	89 e1                	mov    %esp,%ecx
+     bd7:	ba e0 0b 00 00       	mov    $0xbe0,%edx
+     bdc:	0f 34                	sysenter
+     bde:	cd 40                	int    $0x40
+     be0:	c3                   	ret
+
+00000be1 <sbrk>:
+SYSCALL(sbrk)
+     be1:	b8 0c 00 00 00       	mov    $0xc,%eax
+     be6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     bed:	74 09                	je     bf8 <sbrk+0x17>
+     bef:	89 e1                	mov    %esp,%ecx
+     bf1:	ba fa 0b 00 00       	mov    $0xbfa,%edx
+     bf6:	0f 34                	sysenter
+     bf8:	cd 40                	int    $0x40
+     bfa:	c3                   	ret
+
+00000bfb <sleep>:
+SYSCALL(sleep)
+     bfb:	b8 0d 00 00 00       	mov    $0xd,%eax
+     c00:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c07:	74 09                	je     c12 <sleep+0x17>
+     c09:	89 e1                	mov    %esp,%ecx
+     c0b:	ba 14 0c 00 00       	mov    $0xc14,%edx
+     c10:	0f 34                	sysenter
+     c12:	cd 40                	int    $0x40
+     c14:	c3                   	ret
+
+00000c15 <uptime>:
+SYSCALL(uptime)
+     c15:	b8 0e 00 00 00       	mov    $0xe,%eax
+     c1a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c21:	74 09                	je     c2c <uptime+0x17>
+     c23:	89 e1                	mov    %esp,%ecx
+     c25:	ba 2e 0c 00 00       	mov    $0xc2e,%edx
+     c2a:	0f 34                	sysenter
+     c2c:	cd 40                	int    $0x40
+     c2e:	c3                   	ret
+
+00000c2f <mmap>:
+SYSCALL(mmap)
+     c2f:	b8 16 00 00 00       	mov    $0x16,%eax
+     c34:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c3b:	74 09                	je     c46 <mmap+0x17>
+     c3d:	89 e1                	mov    %esp,%ecx
+     c3f:	ba 48 0c 00 00       	mov    $0xc48,%edx
+     c44:	0f 34                	sysenter
+     c46:	cd 40                	int    $0x40
+     c48:	c3                   	ret
+
+00000c49 <munmap>:
+SYSCALL(munmap)
+     c49:	b8 17 00 00 00       	mov    $0x17,%eax
+     c4e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c55:	74 09                	je     c60 <munmap+0x17>
+     c57:	89 e1                	mov    %esp,%ecx
+     c59:	ba 62 0c 00 00       	mov    $0xc62,%edx
+     c5e:	0f 34                	sysenter
+     c60:	cd 40                	int    $0x40
+     c62:	c3                   	ret
+
+00000c63 <clone>:
+SYSCALL(clone)
+     c63:	b8 18 00 00 00       	mov    $0x18,%eax
+     c68:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c6f:	74 09                	je     c7a <clone+0x17>
+     c71:	89 e1                	mov    %esp,%ecx
+     c73:	ba 7c 0c 00 00       	mov    $0xc7c,%edx
+     c78:	0f 34                	sysenter
+     c7a:	cd 40                	int    $0x40
+     c7c:	c3                   	ret
+
+00000c7d <join>:
+SYSCALL(join)
+     c7d:	b8 19 00 00 00       	mov    $0x19,%eax
+     c82:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     c89:	74 09                	je     c94 <join+0x17>
+     c8b:	89 e1                	mov    %esp,%ecx
+     c8d:	ba 96 0c 00 00       	mov    $0xc96,%edx
+     c92:	0f 34                	sysenter
+     c94:	cd 40                	int    $0x40
+     c96:	c3                   	ret
+
+00000c97 <futex>:
+SYSCALL(futex)
+     c97:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     c9c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ca3:	74 09                	je     cae <futex+0x17>
+     ca5:	89 e1                	mov    %esp,%ecx
+     ca7:	ba b0 0c 00 00       	mov    $0xcb0,%edx
+     cac:	0f 34                	sysenter
+     cae:	cd 40                	int    $0x40
+     cb0:	c3                   	ret
+
+00000cb1 <memstat>:
+SYSCALL(memstat)
+     cb1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     cb6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     cbd:	74 09                	je     cc8 <memstat+0x17>
+     cbf:	89 e1                	mov    %esp,%ecx
+     cc1:	ba ca 0c 00 00       	mov    $0xcca,%edx
+     cc6:	0f 34                	sysenter
+     cc8:	cd 40                	int    $0x40
+     cca:	c3                   	ret
+
+00000ccb <nice>:
+SYSCALL(nice)
+     ccb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     cd0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     cd7:	74 09                	je     ce2 <nice+0x17>
+     cd9:	89 e1                	mov    %esp,%ecx
+     cdb:	ba e4 0c 00 00       	mov    $0xce4,%edx
+     ce0:	0f 34                	sysenter
+     ce2:	cd 40                	int    $0x40
+     ce4:	c3                   	ret
+
+00000ce5 <setpriority>:
+SYSCALL(setpriority)
+     ce5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     cea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     cf1:	74 09                	je     cfc <setpriority+0x17>
+     cf3:	89 e1                	mov    %esp,%ecx
+     cf5:	ba fe 0c 00 00       	mov    $0xcfe,%edx
+     cfa:	0f 34                	sysenter
+     cfc:	cd 40                	int    $0x40
+     cfe:	c3                   	ret
+
+00000cff <getpinfo>:
+SYSCALL(getpinfo)
+     cff:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d04:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d0b:	74 09                	je     d16 <getpinfo+0x17>
+     d0d:	89 e1                	mov    %esp,%ecx
+     d0f:	ba 18 0d 00 00       	mov    $0xd18,%edx
+     d14:	0f 34                	sysenter
+     d16:	cd 40                	int    $0x40
+     d18:	c3                   	ret
+
+00000d19 <settickets>:
+SYSCALL(settickets)
+     d19:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d1e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d25:	74 09                	je     d30 <settickets+0x17>
+     d27:	89 e1                	mov    %esp,%ecx
+     d29:	ba 32 0d 00 00       	mov    $0xd32,%edx
+     d2e:	0f 34                	sysenter
+     d30:	cd 40                	int    $0x40
+     d32:	c3                   	ret
+
+00000d33 <clock_gettime>:
+SYSCALL(clock_gettime)
+     d33:	b8 20 00 00 00       	mov    $0x20,%eax
+     d38:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d3f:	74 09                	je     d4a <clock_gettime+0x17>
+     d41:	89 e1                	mov    %esp,%ecx
+     d43:	ba 4c 0d 00 00       	mov    $0xd4c,%edx
+     d48:	0f 34                	sysenter
+     d4a:	cd 40                	int    $0x40
+     d4c:	c3                   	ret
+
+00000d4d <batch>:
+SYSCALL(batch)
+     d4d:	b8 21 00 00 00       	mov    $0x21,%eax
+     d52:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d59:	74 09                	je     d64 <batch+0x17>
+     d5b:	89 e1                	mov    %esp,%ecx
+     d5d:	ba 66 0d 00 00       	mov    $0xd66,%edx
+     d62:	0f 34                	sysenter
+     d64:	cd 40                	int    $0x40
+     d66:	c3                   	ret
+
+00000d67 <aiosetup>:
+SYSCALL(aiosetup)
+     d67:	b8 22 00 00 00       	mov    $0x22,%eax
+     d6c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d73:	74 09                	je     d7e <aiosetup+0x17>
+     d75:	89 e1                	mov    %esp,%ecx
+     d77:	ba 80 0d 00 00       	mov    $0xd80,%edx
+     d7c:	0f 34                	sysenter
+     d7e:	cd 40                	int    $0x40
+     d80:	c3                   	ret
+
+00000d81 <aioenter>:
+SYSCALL(aioenter)
+     d81:	b8 23 00 00 00       	mov    $0x23,%eax
+     d86:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     d8d:	74 09                	je     d98 <aioenter+0x17>
+     d8f:	89 e1                	mov    %esp,%ecx
+     d91:	ba 9a 0d 00 00       	mov    $0xd9a,%edx
+     d96:	0f 34                	sysenter
+     d98:	cd 40                	int    $0x40
+     d9a:	c3                   	ret
+
+00000d9b <systrace>:
+SYSCALL(systrace)
+     d9b:	b8 24 00 00 00       	mov    $0x24,%eax
+     da0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     da7:	74 09                	je     db2 <systrace+0x17>
+     da9:	89 e1                	mov    %esp,%ecx
+     dab:	ba b4 0d 00 00       	mov    $0xdb4,%edx
+     db0:	0f 34                	sysenter
+     db2:	cd 40                	int    $0x40
+     db4:	c3                   	ret
+
+00000db5 <sysstat>:
+SYSCALL(sysstat)
+     db5:	b8 25 00 00 00       	mov    $0x25,%eax
+     dba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     dc1:	74 09                	je     dcc <sysstat+0x17>
+     dc3:	89 e1                	mov    %esp,%ecx
+     dc5:	ba ce 0d 00 00       	mov    $0xdce,%edx
+     dca:	0f 34                	sysenter
+     dcc:	cd 40                	int    $0x40
+     dce:	c3                   	ret
+
+00000dcf <traceread>:
+SYSCALL(traceread)
+     dcf:	b8 26 00 00 00       	mov    $0x26,%eax
+     dd4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+     ddb:	74 09                	je     de6 <traceread+0x17>
+     ddd:	89 e1                	mov    %esp,%ecx
+     ddf:	ba e8 0d 00 00       	mov    $0xde8,%edx
+     de4:	0f 34                	sysenter
+     de6:	cd 40                	int    $0x40
+     de8:	c3                   	ret
+     de9:	66 90                	xchg   %ax,%ax
+     deb:	66 90                	xchg   %ax,%ax
+     ded:	66 90                	xchg   %ax,%ax
+     def:	90                   	nop
+
+00000df0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     df0:	55                   	push   %ebp
+     df1:	89 e5                	mov    %esp,%ebp
+     df3:	57                   	push   %edi
+     df4:	56                   	push   %esi
+     df5:	53                   	push   %ebx
+     df6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     df8:	89 d1                	mov    %edx,%ecx
+{
+     dfa:	83 ec 3c             	sub    $0x3c,%esp
+     dfd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     e00:	85 d2                	test   %edx,%edx
+     e02:	0f 89 80 00 00 00    	jns    e88 <printint+0x98>
+     e08:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     e0c:	74 7a                	je     e88 <printint+0x98>
+    x = -xx;
+     e0e:	f7 d9                	neg    %ecx
+    neg = 1;
+     e10:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e15:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     e18:	31 f6                	xor    %esi,%esi
+     e1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     e20:	89 c8                	mov    %ecx,%eax
+     e22:	31 d2                	xor    %edx,%edx
+     e24:	89 f7                	mov    %esi,%edi
+     e26:	f7 f3                	div    %ebx
+     e28:	8d 76 01             	lea    0x1(%esi),%esi
+     e2b:	0f b6 92 80 15 00 00 	movzbl 0x1580(%edx),%edx
+     e32:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     e36:	89 ca                	mov    %ecx,%edx
+     e38:	89 c1                	mov    %eax,%ecx
+     e3a:	39 da                	cmp    %ebx,%edx
+     e3c:	73 e2                	jae    e20 <printint+0x30>
+  if(neg)
+     e3e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     e41:	85 c0                	test   %eax,%eax
+     e43:	74 07                	je     e4c <printint+0x5c>
+    buf[i++] = '-';
+     e45:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     e4a:	89 f7                	mov    %esi,%edi
+     e4c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     e4f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     e52:	01 df                	add    %ebx,%edi
+     e54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     e58:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     e5b:	83 ec 04             	sub    $0x4,%esp
+     e5e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     e61:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     e64:	6a 01                	push   $0x1
+     e66:	50                   	push   %eax
+     e67:	56                   	push   %esi
+     e68:	e8 22 fc ff ff       	call   a8f <write>
+  while(--i >= 0)
+     e6d:	89 f8                	mov    %edi,%eax
+     e6f:	83 c4 10             	add    $0x10,%esp
+     e72:	83 ef 01             	sub    $0x1,%edi
+     e75:	39 d8                	cmp    %ebx,%eax
+     e77:	75 df                	jne    e58 <printint+0x68>
+}
+     e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e7c:	5b                   	pop    %ebx
+     e7d:	5e                   	pop    %esi
+     e7e:	5f                   	pop    %edi
+     e7f:	5d                   	pop    %ebp
+     e80:	c3                   	ret
+     e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     e88:	31 c0                	xor    %eax,%eax
+     e8a:	eb 89                	jmp    e15 <printint+0x25>
+     e8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e90 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e90:	55                   	push   %ebp
+     e91:	89 e5                	mov    %esp,%ebp
+     e93:	57                   	push   %edi
+     e94:	56                   	push   %esi
+     e95:	53                   	push   %ebx
+     e96:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     e99:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     e9c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     e9f:	0f b6 1e             	movzbl (%esi),%ebx
+     ea2:	83 c6 01             	add    $0x1,%esi
+     ea5:	84 db                	test   %bl,%bl
+     ea7:	74 67                	je     f10 <printf+0x80>
+     ea9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     eac:	31 d2                	xor    %edx,%edx
+     eae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     eb1:	eb 34                	jmp    ee7 <printf+0x57>
+     eb3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     eb7:	90                   	nop
+     eb8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     ebb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     ec0:	83 f8 25             	cmp    $0x25,%eax
+     ec3:	74 18                	je     edd <printf+0x4d>
+  write(fd, &c, 1);
+     ec5:	83 ec 04             	sub    $0x4,%esp
+     ec8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     ecb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     ece:	6a 01                	push   $0x1
+     ed0:	50                   	push   %eax
+     ed1:	57                   	push   %edi
+     ed2:	e8 b8 fb ff ff       	call   a8f <write>
+     ed7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     eda:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     edd:	0f b6 1e             	movzbl (%esi),%ebx
+     ee0:	83 c6 01             	add    $0x1,%esi
+     ee3:	84 db                	test   %bl,%bl
+     ee5:	74 29                	je     f10 <printf+0x80>
+    c = fmt[i] & 0xff;
+     ee7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     eea:	85 d2                	test   %edx,%edx
+     eec:	74 ca                	je     eb8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     eee:	83 fa 25             	cmp    $0x25,%edx
+     ef1:	75 ea                	jne    edd <printf+0x4d>
+      if(c == 'd'){
+     ef3:	83 f8 25             	cmp    $0x25,%eax
+     ef6:	0f 84 24 01 00 00    	je     1020 <printf+0x190>
+     efc:	83 e8 63             	sub    $0x63,%eax
+     eff:	83 f8 15             	cmp    $0x15,%eax
+     f02:	77 1c                	ja     f20 <printf+0x90>
+     f04:	ff 24 85 28 15 00 00 	jmp    *0x1528(,%eax,4)
+     f0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f0f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     f10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f13:	5b                   	pop    %ebx
+     f14:	5e                   	pop    %esi
+     f15:	5f                   	pop    %edi
+     f16:	5d                   	pop    %ebp
+     f17:	c3                   	ret
+     f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f1f:	90                   	nop
+  write(fd, &c, 1);
+     f20:	83 ec 04             	sub    $0x4,%esp
+     f23:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     f26:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     f2a:	6a 01                	push   $0x1
+     f2c:	52                   	push   %edx
+     f2d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     f30:	57                   	push   %edi
+     f31:	e8 59 fb ff ff       	call   a8f <write>
+     f36:	83 c4 0c             	add    $0xc,%esp
+     f39:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     f3c:	6a 01                	push   $0x1
+     f3e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     f41:	52                   	push   %edx
+     f42:	57                   	push   %edi
+     f43:	e8 47 fb ff ff       	call   a8f <write>
+        putc(fd, c);
+     f48:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f4b:	31 d2                	xor    %edx,%edx
+     f4d:	eb 8e                	jmp    edd <printf+0x4d>
+     f4f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     f50:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     f53:	83 ec 0c             	sub    $0xc,%esp
+     f56:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f5b:	8b 13                	mov    (%ebx),%edx
+     f5d:	6a 00                	push   $0x0
+     f5f:	89 f8                	mov    %edi,%eax
+        ap++;
+     f61:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     f64:	e8 87 fe ff ff       	call   df0 <printint>
+        ap++;
+     f69:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     f6c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f6f:	31 d2                	xor    %edx,%edx
+     f71:	e9 67 ff ff ff       	jmp    edd <printf+0x4d>
+     f76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f7d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     f80:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     f83:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     f85:	83 c0 04             	add    $0x4,%eax
+     f88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     f8b:	85 db                	test   %ebx,%ebx
+     f8d:	0f 84 9d 00 00 00    	je     1030 <printf+0x1a0>
+        while(*s != 0){
+     f93:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     f96:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     f98:	84 c0                	test   %al,%al
+     f9a:	0f 84 3d ff ff ff    	je     edd <printf+0x4d>
+     fa0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     fa3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     fa6:	89 de                	mov    %ebx,%esi
+     fa8:	89 d3                	mov    %edx,%ebx
+     faa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     fb0:	83 ec 04             	sub    $0x4,%esp
+     fb3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     fb6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     fb9:	6a 01                	push   $0x1
+     fbb:	53                   	push   %ebx
+     fbc:	57                   	push   %edi
+     fbd:	e8 cd fa ff ff       	call   a8f <write>
+        while(*s != 0){
+     fc2:	0f b6 06             	movzbl (%esi),%eax
+     fc5:	83 c4 10             	add    $0x10,%esp
+     fc8:	84 c0                	test   %al,%al
+     fca:	75 e4                	jne    fb0 <printf+0x120>
+      state = 0;
+     fcc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     fcf:	31 d2                	xor    %edx,%edx
+     fd1:	e9 07 ff ff ff       	jmp    edd <printf+0x4d>
+     fd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     fdd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     fe0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     fe3:	83 ec 0c             	sub    $0xc,%esp
+     fe6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     feb:	8b 13                	mov    (%ebx),%edx
+     fed:	6a 01                	push   $0x1
+     fef:	e9 6b ff ff ff       	jmp    f5f <printf+0xcf>
+     ff4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     ff8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     ffb:	83 ec 04             	sub    $0x4,%esp
+     ffe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    1001:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    1003:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    1006:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    1009:	6a 01                	push   $0x1
+    100b:	52                   	push   %edx
+    100c:	57                   	push   %edi
+    100d:	e8 7d fa ff ff       	call   a8f <write>
+        ap++;
+    1012:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    1015:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1018:	31 d2                	xor    %edx,%edx
+    101a:	e9 be fe ff ff       	jmp    edd <printf+0x4d>
+    101f:	90                   	nop
+  write(fd, &c, 1);
+    1020:	83 ec 04             	sub    $0x4,%esp
+    1023:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    1026:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1029:	6a 01                	push   $0x1
+    102b:	e9 11 ff ff ff       	jmp    f41 <printf+0xb1>
+    1030:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    1035:	bb 20 15 00 00       	mov    $0x1520,%ebx
+    103a:	e9 61 ff ff ff       	jmp    fa0 <printf+0x110>
+    103f:	90                   	nop
+
+00001040 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    1040:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1041:	a1 40 2c 00 00       	mov    0x2c40,%eax
+{
+    1046:	89 e5                	mov    %esp,%ebp
+    1048:	57                   	push   %edi
+    1049:	56                   	push   %esi
+    104a:	53                   	push   %ebx
+    104b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    104e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1051:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1058:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    105a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    105c:	39 ca                	cmp    %ecx,%edx
+    105e:	73 30                	jae    1090 <free+0x50>
+    1060:	39 c1                	cmp    %eax,%ecx
+    1062:	72 04                	jb     1068 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1064:	39 c2                	cmp    %eax,%edx
+    1066:	72 f0                	jb     1058 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1068:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    106b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    106e:	39 f8                	cmp    %edi,%eax
+    1070:	74 2e                	je     10a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1072:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1075:	8b 42 04             	mov    0x4(%edx),%eax
+    1078:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    107b:	39 f1                	cmp    %esi,%ecx
+    107d:	74 38                	je     10b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    107f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1081:	5b                   	pop    %ebx
+  freep = p;
+    1082:	89 15 40 2c 00 00    	mov    %edx,0x2c40
+}
+    1088:	5e                   	pop    %esi
+    1089:	5f                   	pop    %edi
+    108a:	5d                   	pop    %ebp
+    108b:	c3                   	ret
+    108c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1090:	39 c1                	cmp    %eax,%ecx
+    1092:	72 d0                	jb     1064 <free+0x24>
+    1094:	eb c2                	jmp    1058 <free+0x18>
+    1096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    109d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    10a0:	03 70 04             	add    0x4(%eax),%esi
+    10a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    10a6:	8b 02                	mov    (%edx),%eax
+    10a8:	8b 00                	mov    (%eax),%eax
+    10aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    10ad:	8b 42 04             	mov    0x4(%edx),%eax
+    10b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    10b3:	39 f1                	cmp    %esi,%ecx
+    10b5:	75 c8                	jne    107f <free+0x3f>
+    p->s.size += bp->s.size;
+    10b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    10ba:	89 15 40 2c 00 00    	mov    %edx,0x2c40
+    p->s.size += bp->s.size;
+    10c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    10c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    10c6:	89 0a                	mov    %ecx,(%edx)
+}
+    10c8:	5b                   	pop    %ebx
+    10c9:	5e                   	pop    %esi
+    10ca:	5f                   	pop    %edi
+    10cb:	5d                   	pop    %ebp
+    10cc:	c3                   	ret
+    10cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000010d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	57                   	push   %edi
+    10d4:	56                   	push   %esi
+    10d5:	53                   	push   %ebx
+    10d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    10dc:	8b 15 40 2c 00 00    	mov    0x2c40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    10e2:	8d 78 07             	lea    0x7(%eax),%edi
+    10e5:	c1 ef 03             	shr    $0x3,%edi
+    10e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    10eb:	85 d2                	test   %edx,%edx
+    10ed:	0f 84 8d 00 00 00    	je     1180 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    10f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    10f5:	8b 48 04             	mov    0x4(%eax),%ecx
+    10f8:	39 f9                	cmp    %edi,%ecx
+    10fa:	73 64                	jae    1160 <malloc+0x90>
+  if(nu < 4096)
+    10fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    1101:	39 df                	cmp    %ebx,%edi
+    1103:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    1106:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    110d:	eb 0a                	jmp    1119 <malloc+0x49>
+    110f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    1110:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    1112:	8b 48 04             	mov    0x4(%eax),%ecx
+    1115:	39 f9                	cmp    %edi,%ecx
+    1117:	73 47                	jae    1160 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    1119:	89 c2                	mov    %eax,%edx
+    111b:	39 05 40 2c 00 00    	cmp    %eax,0x2c40
+    1121:	75 ed                	jne    1110 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    1123:	83 ec 0c             	sub    $0xc,%esp
+    1126:	56                   	push   %esi
+    1127:	e8 b5 fa ff ff       	call   be1 <sbrk>
+  if(p == (char*)-1)
+    112c:	83 c4 10             	add    $0x10,%esp
+    112f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1132:	74 1c                	je     1150 <malloc+0x80>
+  hp->s.size = nu;
+    1134:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    1137:	83 ec 0c             	sub    $0xc,%esp
+    113a:	83 c0 08             	add    $0x8,%eax
+    113d:	50                   	push   %eax
+    113e:	e8 fd fe ff ff       	call   1040 <free>
+  return freep;
+    1143:	8b 15 40 2c 00 00    	mov    0x2c40,%edx
+      if((p = morecore(nunits)) == 0)
+    1149:	83 c4 10             	add    $0x10,%esp
+    114c:	85 d2                	test   %edx,%edx
+    114e:	75 c0                	jne    1110 <malloc+0x40>
+        return 0;
+  }
+}
+    1150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1153:	31 c0                	xor    %eax,%eax
+}
+    1155:	5b                   	pop    %ebx
+    1156:	5e                   	pop    %esi
+    1157:	5f                   	pop    %edi
+    1158:	5d                   	pop    %ebp
+    1159:	c3                   	ret
+    115a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1160:	39 cf                	cmp    %ecx,%edi
+    1162:	74 4c                	je     11b0 <malloc+0xe0>
+        p->s.size -= nunits;
+    1164:	29 f9                	sub    %edi,%ecx
+    1166:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1169:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    116c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    116f:	89 15 40 2c 00 00    	mov    %edx,0x2c40
+}
+    1175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1178:	83 c0 08             	add    $0x8,%eax
+}
+    117b:	5b                   	pop    %ebx
+    117c:	5e                   	pop    %esi
+    117d:	5f                   	pop    %edi
+    117e:	5d                   	pop    %ebp
+    117f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1180:	c7 05 40 2c 00 00 44 	movl   $0x2c44,0x2c40
+    1187:	2c 00 00 
+    base.s.size = 0;
+    118a:	b8 44 2c 00 00       	mov    $0x2c44,%eax
+    base.s.ptr = freep = prevp = &base;
+    118f:	c7 05 44 2c 00 00 44 	movl   $0x2c44,0x2c44
+    1196:	2c 00 00 
+    base.s.size = 0;
+    1199:	c7 05 48 2c 00 00 00 	movl   $0x0,0x2c48
+    11a0:	00 00 00 
+    if(p->s.size >= nunits){
+    11a3:	e9 54 ff ff ff       	jmp    10fc <malloc+0x2c>
+    11a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    11af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    11b0:	8b 08                	mov    (%eax),%ecx
+    11b2:	89 0a                	mov    %ecx,(%edx)
+    11b4:	eb b9                	jmp    116f <malloc+0x9f>
+    11b6:	66 90                	xchg   %ax,%ax
+    11b8:	66 90                	xchg   %ax,%ax
+    11ba:	66 90                	xchg   %ax,%ax
+    11bc:	66 90                	xchg   %ax,%ax
+    11be:	66 90                	xchg   %ax,%ax
+
+000011c0 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    11c0:	55                   	push   %ebp
+    11c1:	89 e5                	mov    %esp,%ebp
+    11c3:	53                   	push   %ebx
+    11c4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+    11c7:	68 00 20 00 00       	push   $0x2000
+    11cc:	e8 ff fe ff ff       	call   10d0 <malloc>
+    11d1:	83 c4 10             	add    $0x10,%esp
+    11d4:	85 c0                	test   %eax,%eax
+    11d6:	74 47                	je     121f <thread_create+0x5f>
+    11d8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    11da:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+    11e0:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+    11e3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+    11e8:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+    11eb:	ff 75 0c             	push   0xc(%ebp)
+    11ee:	50                   	push   %eax
+    11ef:	ff 75 08             	push   0x8(%ebp)
+    11f2:	e8 6c fa ff ff       	call   c63 <clone>
+    11f7:	83 c4 10             	add    $0x10,%esp
+    11fa:	85 c0                	test   %eax,%eax
+    11fc:	78 0a                	js     1208 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+    11fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1201:	c9                   	leave
+    1202:	c3                   	ret
+    1203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1207:	90                   	nop
+    free(mem);
+    1208:	83 ec 0c             	sub    $0xc,%esp
+    120b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    120e:	53                   	push   %ebx
+    120f:	e8 2c fe ff ff       	call   1040 <free>
+    1214:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1217:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+    121a:	83 c4 10             	add    $0x10,%esp
+}
+    121d:	c9                   	leave
+    121e:	c3                   	ret
+    return -1;
+    121f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1224:	eb d8                	jmp    11fe <thread_create+0x3e>
+    1226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    122d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001230 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    1234:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    1237:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+    123a:	50                   	push   %eax
+    123b:	e8 3d fa ff ff       	call   c7d <join>
+    1240:	83 c4 10             	add    $0x10,%esp
+    1243:	85 c0                	test   %eax,%eax
+    1245:	78 21                	js     1268 <thread_join+0x38>
+    1247:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+    1249:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    124c:	83 ec 0c             	sub    $0xc,%esp
+    124f:	ff 70 fc             	push   -0x4(%eax)
+    1252:	e8 e9 fd ff ff       	call   1040 <free>
+  return pid;
+    1257:	83 c4 10             	add    $0x10,%esp
+}
+    125a:	89 d8                	mov    %ebx,%eax
+    125c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    125f:	c9                   	leave
+    1260:	c3                   	ret
+    1261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+    1268:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    126d:	eb eb                	jmp    125a <thread_join+0x2a>
@@ -0,0 +1,189 @@
+// Trace or count system calls.
+//
+//   strace cmd [arg ...]      print each call cmd makes
+//   strace -c cmd [arg ...]   print counts and latencies of cmd's calls
+//   strace -s [pid]           print the counts and latencies collected
+//                             system-wide, or for process pid
+//   strace -s on|off|reset    start, stop or zero the system-wide counts
+//
+// Latencies are in TSC cycles, as log2 buckets: "2^10:3" means
+// three calls took between 1024 and 2047 cycles.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "systrace.h"
+
+static char *names[NSYSCALL] = {
+[SYS_fork]          "fork",
+[SYS_exit]          "exit",
+[SYS_wait]          "wait",
+[SYS_pipe]          "pipe",
+[SYS_read]          "read",
+[SYS_kill]          "kill",
+[SYS_exec]          "exec",
+[SYS_fstat]         "fstat",
+[SYS_chdir]         "chdir",
+[SYS_dup]           "dup",
+[SYS_getpid]        "getpid",
+[SYS_sbrk]          "sbrk",
+[SYS_sleep]         "sleep",
+[SYS_uptime]        "uptime",
+[SYS_open]          "open",
+[SYS_write]         "write",
+[SYS_mknod]         "mknod",
+[SYS_unlink]        "unlink",
+[SYS_link]          "link",
+[SYS_mkdir]         "mkdir",
+[SYS_close]         "close",
+[SYS_mmap]          "mmap",
+[SYS_munmap]        "munmap",
+[SYS_clone]         "clone",
+[SYS_join]          "join",
+[SYS_futex]         "futex",
+[SYS_memstat]       "memstat",
+[SYS_nice]          "nice",
+[SYS_setpriority]   "setpriority",
+[SYS_getpinfo]      "getpinfo",
+[SYS_settickets]    "settickets",
+[SYS_clock_gettime] "clock_gettime",
+[SYS_batch]         "batch",
+[SYS_aiosetup]      "aiosetup",
+[SYS_aioenter]      "aioenter",
+[SYS_systrace]      "systrace",
+[SYS_sysstat]       "sysstat",
+[SYS_traceread]     "traceread",
+};
+
+struct sysstat st;
+struct traceent ent[16];
+
+static char*
+name(int num)
+{
+  if(num > 0 && num < NSYSCALL && names[num])
+    return names[num];
+  return "?";
+}
+
+static void
+printstats(void)
+{
+  int i, b;
+
+  for(i = 0; i < NSYSCALL; i++){
+    if(st.count[i] == 0)
+      continue;
+    printf(1, "%s %d ", name(i), st.count[i]);
+    for(b = 0; b < NSYSHIST; b++)
+      if(st.hist[i][b])
+        printf(1, " 2^%d:%d", b, st.hist[i][b]);
+    printf(1, "\n");
+  }
+}
+
+static void
+usage(void)
+{
+  printf(2, "usage: strace [-c] cmd [arg ...]\n");
+  printf(2, "       strace -s [pid | on | off | reset]\n");
+  exit();
+}
+
+static void
+stats(char *arg)
+{
+  if(arg == 0 || (*arg >= '0' && *arg <= '9')){
+    if(sysstat(arg ? atoi(arg) : 0, &st) < 0){
+      printf(2, "strace: no process %s\n", arg);
+      exit();
+    }
+    printstats();
+  } else if(strcmp(arg, "on") == 0)
+    systrace(ST_STATS, 1);
+  else if(strcmp(arg, "off") == 0)
+    systrace(ST_STATS, 0);
+  else if(strcmp(arg, "reset") == 0)
+    systrace(ST_RESET, 0);
+  else
+    usage();
+}
+
+// Run argv[0] in a child that waits on a pipe until
+// tracing is on, and trace it until it exits.
+static void
+run(char **argv, int count)
+{
+  int fd[2], pid, was, n, i, done;
+  uint seq;
+  struct traceent *e;
+  char c;
+
+  if(pipe(fd) < 0){
+    printf(2, "strace: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(2, "strace: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fd[1]);
+    read(fd[0], &c, 1);
+    close(fd[0]);
+    exec(argv[0], argv);
+    printf(2, "strace: exec %s failed\n", argv[0]);
+    exit();
+  }
+  close(fd[0]);
+  was = 0;
+  if(count)
+    was = systrace(ST_STATS, 1);
+  systrace(ST_TRACE, pid);
+  write(fd[1], "x", 1);
+  close(fd[1]);
+
+  seq = 0;
+  done = 0;
+  while(!done && (n = traceread(ent, sizeof(ent)/sizeof(ent[0]))) > 0){
+    for(i = 0; i < n; i++){
+      e = &ent[i];
+      if(seq != 0 && e->seq != seq)
+        printf(1, "... %d calls lost\n", e->seq - seq);
+      seq = e->seq + 1;
+      if(e->num == SYS_exit){
+        done = 1;
+        if(count)
+          break;
+      }
+      if(!count)
+        printf(1, "%d %s(%d, %d, %d) = %d  %d cycles\n", e->pid,
+               name(e->num), e->args[0], e->args[1], e->args[2],
+               e->ret, e->cycles > 0x7FFFFFFF ? 0x7FFFFFFF : e->cycles);
+    }
+  }
+  // The child is not reaped yet, so its counts are still there.
+  if(count && sysstat(pid, &st) == 0)
+    printstats();
+  systrace(ST_TRACE, -1);
+  if(count && !was)
+    systrace(ST_STATS, 0);
+  wait();
+}
+
+int
+main(int argc, char *argv[])
+{
+  if(argc < 2)
+    usage();
+  if(strcmp(argv[1], "-s") == 0){
+    stats(argc > 2 ? argv[2] : 0);
+  } else if(strcmp(argv[1], "-c") == 0){
+    if(argc < 3)
+      usage();
+    run(argv + 2, 1);
+  } else
+    run(argv + 1, 0);
+  exit();
+}
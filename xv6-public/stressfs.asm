@@ -0,0 +1,2084 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+   7:	b8 30 00 00 00       	mov    $0x30,%eax
+{
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  memset(data, 'a', sizeof(data));
+  14:	8d b5 e8 fd ff ff    	lea    -0x218(%ebp),%esi
+{
+  1a:	53                   	push   %ebx
+
+  for(i = 0; i < 4; i++)
+  1b:	31 db                	xor    %ebx,%ebx
+{
+  1d:	51                   	push   %ecx
+  1e:	81 ec 20 02 00 00    	sub    $0x220,%esp
+  char path[] = "stressfs0";
+  24:	66 89 85 e6 fd ff ff 	mov    %ax,-0x21a(%ebp)
+  2b:	c7 85 de fd ff ff 73 	movl   $0x65727473,-0x222(%ebp)
+  32:	74 72 65 
+  35:	c7 85 e2 fd ff ff 73 	movl   $0x73667373,-0x21e(%ebp)
+  3c:	73 66 73 
+  printf(1, "stressfs starting\n");
+  3f:	68 b0 0e 00 00       	push   $0xeb0
+  44:	6a 01                	push   $0x1
+  46:	e8 85 0a 00 00       	call   ad0 <printf>
+  memset(data, 'a', sizeof(data));
+  4b:	83 c4 0c             	add    $0xc,%esp
+  4e:	68 00 02 00 00       	push   $0x200
+  53:	6a 61                	push   $0x61
+  55:	56                   	push   %esi
+  56:	e8 85 01 00 00       	call   1e0 <memset>
+  5b:	83 c4 10             	add    $0x10,%esp
+    if(fork() > 0)
+  5e:	e8 ea 05 00 00       	call   64d <fork>
+  63:	85 c0                	test   %eax,%eax
+  65:	7f 08                	jg     6f <main+0x6f>
+  for(i = 0; i < 4; i++)
+  67:	83 c3 01             	add    $0x1,%ebx
+  6a:	83 fb 04             	cmp    $0x4,%ebx
+  6d:	75 ef                	jne    5e <main+0x5e>
+      break;
+
+  printf(1, "write %d\n", i);
+  6f:	83 ec 04             	sub    $0x4,%esp
+  72:	53                   	push   %ebx
+  73:	68 c3 0e 00 00       	push   $0xec3
+  78:	6a 01                	push   $0x1
+  7a:	e8 51 0a 00 00       	call   ad0 <printf>
+
+  path[8] += i;
+  7f:	00 9d e6 fd ff ff    	add    %bl,-0x21a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  85:	5f                   	pop    %edi
+  86:	bb 14 00 00 00       	mov    $0x14,%ebx
+  8b:	58                   	pop    %eax
+  8c:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  92:	68 02 02 00 00       	push   $0x202
+  97:	50                   	push   %eax
+  98:	e8 9a 06 00 00       	call   737 <open>
+  9d:	83 c4 10             	add    $0x10,%esp
+  a0:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++)
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  a8:	83 ec 04             	sub    $0x4,%esp
+  ab:	68 00 02 00 00       	push   $0x200
+  b0:	56                   	push   %esi
+  b1:	57                   	push   %edi
+  b2:	e8 18 06 00 00       	call   6cf <write>
+  for(i = 0; i < 20; i++)
+  b7:	83 c4 10             	add    $0x10,%esp
+  ba:	83 eb 01             	sub    $0x1,%ebx
+  bd:	75 e9                	jne    a8 <main+0xa8>
+  close(fd);
+  bf:	83 ec 0c             	sub    $0xc,%esp
+  c2:	57                   	push   %edi
+  c3:	e8 21 06 00 00       	call   6e9 <close>
+
+  printf(1, "read\n");
+  c8:	58                   	pop    %eax
+  c9:	5a                   	pop    %edx
+  ca:	68 cd 0e 00 00       	push   $0xecd
+  cf:	6a 01                	push   $0x1
+  d1:	e8 fa 09 00 00       	call   ad0 <printf>
+
+  fd = open(path, O_RDONLY);
+  d6:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+  dc:	59                   	pop    %ecx
+  dd:	5b                   	pop    %ebx
+  de:	6a 00                	push   $0x0
+  e0:	bb 14 00 00 00       	mov    $0x14,%ebx
+  e5:	50                   	push   %eax
+  e6:	e8 4c 06 00 00       	call   737 <open>
+  eb:	83 c4 10             	add    $0x10,%esp
+  ee:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < 20; i++)
+    read(fd, data, sizeof(data));
+  f0:	83 ec 04             	sub    $0x4,%esp
+  f3:	68 00 02 00 00       	push   $0x200
+  f8:	56                   	push   %esi
+  f9:	57                   	push   %edi
+  fa:	e8 b6 05 00 00       	call   6b5 <read>
+  for (i = 0; i < 20; i++)
+  ff:	83 c4 10             	add    $0x10,%esp
+ 102:	83 eb 01             	sub    $0x1,%ebx
+ 105:	75 e9                	jne    f0 <main+0xf0>
+  close(fd);
+ 107:	83 ec 0c             	sub    $0xc,%esp
+ 10a:	57                   	push   %edi
+ 10b:	e8 d9 05 00 00       	call   6e9 <close>
+
+  wait();
+ 110:	e8 6c 05 00 00       	call   681 <wait>
+
+  exit();
+ 115:	e8 4d 05 00 00       	call   667 <exit>
+ 11a:	66 90                	xchg   %ax,%ax
+ 11c:	66 90                	xchg   %ax,%ax
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 120:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 121:	31 c0                	xor    %eax,%eax
+{
+ 123:	89 e5                	mov    %esp,%ebp
+ 125:	53                   	push   %ebx
+ 126:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 130:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 134:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 137:	83 c0 01             	add    $0x1,%eax
+ 13a:	84 d2                	test   %dl,%dl
+ 13c:	75 f2                	jne    130 <strcpy+0x10>
+    ;
+  return os;
+}
+ 13e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 141:	89 c8                	mov    %ecx,%eax
+ 143:	c9                   	leave
+ 144:	c3                   	ret
+ 145:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	53                   	push   %ebx
+ 154:	8b 55 08             	mov    0x8(%ebp),%edx
+ 157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 15a:	0f b6 02             	movzbl (%edx),%eax
+ 15d:	84 c0                	test   %al,%al
+ 15f:	75 17                	jne    178 <strcmp+0x28>
+ 161:	eb 3a                	jmp    19d <strcmp+0x4d>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 16c:	83 c2 01             	add    $0x1,%edx
+ 16f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 172:	84 c0                	test   %al,%al
+ 174:	74 1a                	je     190 <strcmp+0x40>
+    p++, q++;
+ 176:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 178:	0f b6 19             	movzbl (%ecx),%ebx
+ 17b:	38 c3                	cmp    %al,%bl
+ 17d:	74 e9                	je     168 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 17f:	29 d8                	sub    %ebx,%eax
+}
+ 181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 184:	c9                   	leave
+ 185:	c3                   	ret
+ 186:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 190:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 194:	31 c0                	xor    %eax,%eax
+ 196:	29 d8                	sub    %ebx,%eax
+}
+ 198:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 19b:	c9                   	leave
+ 19c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 19d:	0f b6 19             	movzbl (%ecx),%ebx
+ 1a0:	31 c0                	xor    %eax,%eax
+ 1a2:	eb db                	jmp    17f <strcmp+0x2f>
+ 1a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1af:	90                   	nop
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1b9:	74 15                	je     1d0 <strlen+0x20>
+ 1bb:	31 c0                	xor    %eax,%eax
+ 1bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 1c0:	83 c0 01             	add    $0x1,%eax
+ 1c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1c7:	89 c1                	mov    %eax,%ecx
+ 1c9:	75 f5                	jne    1c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1cb:	89 c8                	mov    %ecx,%eax
+ 1cd:	5d                   	pop    %ebp
+ 1ce:	c3                   	ret
+ 1cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1d0:	31 c9                	xor    %ecx,%ecx
+}
+ 1d2:	5d                   	pop    %ebp
+ 1d3:	89 c8                	mov    %ecx,%eax
+ 1d5:	c3                   	ret
+ 1d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ed:	89 d7                	mov    %edx,%edi
+ 1ef:	fc                   	cld
+ 1f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1f5:	89 d0                	mov    %edx,%eax
+ 1f7:	c9                   	leave
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 20a:	0f b6 10             	movzbl (%eax),%edx
+ 20d:	84 d2                	test   %dl,%dl
+ 20f:	75 12                	jne    223 <strchr+0x23>
+ 211:	eb 1d                	jmp    230 <strchr+0x30>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 21c:	83 c0 01             	add    $0x1,%eax
+ 21f:	84 d2                	test   %dl,%dl
+ 221:	74 0d                	je     230 <strchr+0x30>
+    if(*s == c)
+ 223:	38 d1                	cmp    %dl,%cl
+ 225:	75 f1                	jne    218 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 227:	5d                   	pop    %ebp
+ 228:	c3                   	ret
+ 229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 230:	31 c0                	xor    %eax,%eax
+}
+ 232:	5d                   	pop    %ebp
+ 233:	c3                   	ret
+ 234:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 23f:	90                   	nop
+
+00000240 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 245:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 248:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 249:	31 db                	xor    %ebx,%ebx
+{
+ 24b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 24e:	eb 27                	jmp    277 <gets+0x37>
+    cc = read(0, &c, 1);
+ 250:	83 ec 04             	sub    $0x4,%esp
+ 253:	6a 01                	push   $0x1
+ 255:	56                   	push   %esi
+ 256:	6a 00                	push   $0x0
+ 258:	e8 58 04 00 00       	call   6b5 <read>
+    if(cc < 1)
+ 25d:	83 c4 10             	add    $0x10,%esp
+ 260:	85 c0                	test   %eax,%eax
+ 262:	7e 1d                	jle    281 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 264:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 268:	8b 55 08             	mov    0x8(%ebp),%edx
+ 26b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 26f:	3c 0a                	cmp    $0xa,%al
+ 271:	74 10                	je     283 <gets+0x43>
+ 273:	3c 0d                	cmp    $0xd,%al
+ 275:	74 0c                	je     283 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 277:	89 df                	mov    %ebx,%edi
+ 279:	83 c3 01             	add    $0x1,%ebx
+ 27c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 27f:	7c cf                	jl     250 <gets+0x10>
+ 281:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 283:	8b 45 08             	mov    0x8(%ebp),%eax
+ 286:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 28d:	5b                   	pop    %ebx
+ 28e:	5e                   	pop    %esi
+ 28f:	5f                   	pop    %edi
+ 290:	5d                   	pop    %ebp
+ 291:	c3                   	ret
+ 292:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	56                   	push   %esi
+ 2a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 2a5:	83 ec 08             	sub    $0x8,%esp
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	ff 75 08             	push   0x8(%ebp)
+ 2ad:	e8 85 04 00 00       	call   737 <open>
+  if(fd < 0)
+ 2b2:	83 c4 10             	add    $0x10,%esp
+ 2b5:	85 c0                	test   %eax,%eax
+ 2b7:	78 27                	js     2e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2b9:	83 ec 08             	sub    $0x8,%esp
+ 2bc:	ff 75 0c             	push   0xc(%ebp)
+ 2bf:	89 c3                	mov    %eax,%ebx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 be 04 00 00       	call   785 <fstat>
+  close(fd);
+ 2c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2cc:	e8 18 04 00 00       	call   6e9 <close>
+  return r;
+ 2d1:	83 c4 10             	add    $0x10,%esp
+}
+ 2d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2d7:	89 f0                	mov    %esi,%eax
+ 2d9:	5b                   	pop    %ebx
+ 2da:	5e                   	pop    %esi
+ 2db:	5d                   	pop    %ebp
+ 2dc:	c3                   	ret
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2e5:	eb ed                	jmp    2d4 <stat+0x34>
+ 2e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	53                   	push   %ebx
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2f7:	0f be 02             	movsbl (%edx),%eax
+ 2fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 300:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 305:	77 1e                	ja     325 <atoi+0x35>
+ 307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 310:	83 c2 01             	add    $0x1,%edx
+ 313:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 316:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 31a:	0f be 02             	movsbl (%edx),%eax
+ 31d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 320:	80 fb 09             	cmp    $0x9,%bl
+ 323:	76 eb                	jbe    310 <atoi+0x20>
+  return n;
+}
+ 325:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 328:	89 c8                	mov    %ecx,%eax
+ 32a:	c9                   	leave
+ 32b:	c3                   	ret
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	56                   	push   %esi
+ 335:	8b 45 10             	mov    0x10(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 33e:	85 c0                	test   %eax,%eax
+ 340:	7e 13                	jle    355 <memmove+0x25>
+ 342:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 344:	89 d7                	mov    %edx,%edi
+ 346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 350:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 351:	39 f8                	cmp    %edi,%eax
+ 353:	75 fb                	jne    350 <memmove+0x20>
+  return vdst;
+}
+ 355:	5e                   	pop    %esi
+ 356:	89 d0                	mov    %edx,%eax
+ 358:	5f                   	pop    %edi
+ 359:	5d                   	pop    %ebp
+ 35a:	c3                   	ret
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 36c:	5d                   	pop    %ebp
+ 36d:	c3                   	ret
+ 36e:	66 90                	xchg   %ax,%ax
+
+00000370 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 370:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 371:	31 c0                	xor    %eax,%eax
+ 373:	ba 01 00 00 00       	mov    $0x1,%edx
+ 378:	89 e5                	mov    %esp,%ebp
+ 37a:	56                   	push   %esi
+ 37b:	53                   	push   %ebx
+ 37c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 37f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 383:	85 c0                	test   %eax,%eax
+ 385:	74 32                	je     3b9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 387:	83 f8 02             	cmp    $0x2,%eax
+ 38a:	74 0c                	je     398 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 38c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 391:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 394:	85 c0                	test   %eax,%eax
+ 396:	74 21                	je     3b9 <mutex_lock+0x49>
+ 398:	be 02 00 00 00       	mov    $0x2,%esi
+ 39d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 02                	push   $0x2
+ 3a5:	6a 00                	push   $0x0
+ 3a7:	53                   	push   %ebx
+ 3a8:	e8 2a 05 00 00       	call   8d7 <futex>
+ 3ad:	89 f0                	mov    %esi,%eax
+ 3af:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	75 e7                	jne    3a0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 3b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5d                   	pop    %ebp
+ 3bf:	c3                   	ret
+
+000003c0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	31 c0                	xor    %eax,%eax
+ 3c3:	89 e5                	mov    %esp,%ebp
+ 3c5:	83 ec 08             	sub    $0x8,%esp
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3ce:	83 f8 02             	cmp    $0x2,%eax
+ 3d1:	74 05                	je     3d8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3d8:	83 ec 04             	sub    $0x4,%esp
+ 3db:	6a 01                	push   $0x1
+ 3dd:	6a 01                	push   $0x1
+ 3df:	52                   	push   %edx
+ 3e0:	e8 f2 04 00 00       	call   8d7 <futex>
+ 3e5:	83 c4 10             	add    $0x10,%esp
+}
+ 3e8:	c9                   	leave
+ 3e9:	c3                   	ret
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003f0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3fc:	5d                   	pop    %ebp
+ 3fd:	c3                   	ret
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 400:	55                   	push   %ebp
+ 401:	31 c0                	xor    %eax,%eax
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	57                   	push   %edi
+ 406:	56                   	push   %esi
+ 407:	53                   	push   %ebx
+ 408:	83 ec 0c             	sub    $0xc,%esp
+ 40b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 40e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 411:	8b 3e                	mov    (%esi),%edi
+ 413:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 416:	83 f8 02             	cmp    $0x2,%eax
+ 419:	74 5d                	je     478 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 41b:	83 ec 04             	sub    $0x4,%esp
+ 41e:	57                   	push   %edi
+ 41f:	6a 00                	push   $0x0
+ 421:	56                   	push   %esi
+ 422:	e8 b0 04 00 00       	call   8d7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 427:	31 c0                	xor    %eax,%eax
+ 429:	ba 01 00 00 00       	mov    $0x1,%edx
+ 42e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 432:	83 c4 10             	add    $0x10,%esp
+ 435:	85 c0                	test   %eax,%eax
+ 437:	74 30                	je     469 <cond_wait+0x69>
+  if(c != 2)
+ 439:	83 f8 02             	cmp    $0x2,%eax
+ 43c:	74 0c                	je     44a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 43e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 443:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 446:	85 c0                	test   %eax,%eax
+ 448:	74 1f                	je     469 <cond_wait+0x69>
+ 44a:	be 02 00 00 00       	mov    $0x2,%esi
+ 44f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 450:	83 ec 04             	sub    $0x4,%esp
+ 453:	6a 02                	push   $0x2
+ 455:	6a 00                	push   $0x0
+ 457:	53                   	push   %ebx
+ 458:	e8 7a 04 00 00       	call   8d7 <futex>
+ 45d:	89 f0                	mov    %esi,%eax
+ 45f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	75 e7                	jne    450 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 46c:	5b                   	pop    %ebx
+ 46d:	5e                   	pop    %esi
+ 46e:	5f                   	pop    %edi
+ 46f:	5d                   	pop    %ebp
+ 470:	c3                   	ret
+ 471:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 478:	83 ec 04             	sub    $0x4,%esp
+ 47b:	6a 01                	push   $0x1
+ 47d:	6a 01                	push   $0x1
+ 47f:	53                   	push   %ebx
+ 480:	e8 52 04 00 00       	call   8d7 <futex>
+ 485:	83 c4 10             	add    $0x10,%esp
+ 488:	eb 91                	jmp    41b <cond_wait+0x1b>
+ 48a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000490 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	53                   	push   %ebx
+ 494:	83 ec 04             	sub    $0x4,%esp
+ 497:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4a0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4a2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 4a5:	89 c8                	mov    %ecx,%eax
+ 4a7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4ab:	39 c1                	cmp    %eax,%ecx
+ 4ad:	75 f1                	jne    4a0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4af:	83 ec 04             	sub    $0x4,%esp
+ 4b2:	6a 01                	push   $0x1
+ 4b4:	6a 01                	push   $0x1
+ 4b6:	52                   	push   %edx
+ 4b7:	e8 1b 04 00 00       	call   8d7 <futex>
+}
+ 4bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4bf:	83 c4 10             	add    $0x10,%esp
+ 4c2:	c9                   	leave
+ 4c3:	c3                   	ret
+ 4c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+
+000004d0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	53                   	push   %ebx
+ 4d4:	83 ec 04             	sub    $0x4,%esp
+ 4d7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 4e0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4e2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 4e5:	89 c8                	mov    %ecx,%eax
+ 4e7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 4eb:	39 c1                	cmp    %eax,%ecx
+ 4ed:	75 f1                	jne    4e0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 4ef:	83 ec 04             	sub    $0x4,%esp
+ 4f2:	6a 40                	push   $0x40
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	52                   	push   %edx
+ 4f7:	e8 db 03 00 00       	call   8d7 <futex>
+}
+ 4fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4ff:	83 c4 10             	add    $0x10,%esp
+ 502:	c9                   	leave
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 510:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 515:	c3                   	ret
+ 516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000520 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 520:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 525:	85 c0                	test   %eax,%eax
+ 527:	74 07                	je     530 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 529:	c3                   	ret
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 530:	e9 d2 02 00 00       	jmp    807 <getpid>
+ 535:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000540 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	56                   	push   %esi
+ 545:	53                   	push   %ebx
+ 546:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 549:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 54b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 551:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 557:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 55c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 562:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 565:	89 d0                	mov    %edx,%eax
+ 567:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 56a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 570:	29 d9                	sub    %ebx,%ecx
+ 572:	89 c6                	mov    %eax,%esi
+ 574:	89 d7                	mov    %edx,%edi
+ 576:	0f a5 c7             	shld   %cl,%eax,%edi
+ 579:	d3 e6                	shl    %cl,%esi
+ 57b:	31 c0                	xor    %eax,%eax
+ 57d:	f6 c1 20             	test   $0x20,%cl
+ 580:	0f 45 fe             	cmovne %esi,%edi
+ 583:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 586:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 589:	89 d9                	mov    %ebx,%ecx
+ 58b:	31 db                	xor    %ebx,%ebx
+ 58d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 593:	0f ad d0             	shrd   %cl,%edx,%eax
+ 596:	d3 ea                	shr    %cl,%edx
+ 598:	f6 c1 20             	test   $0x20,%cl
+ 59b:	0f 45 c2             	cmovne %edx,%eax
+ 59e:	0f 45 d3             	cmovne %ebx,%edx
+ 5a1:	01 f0                	add    %esi,%eax
+ 5a3:	11 fa                	adc    %edi,%edx
+}
+ 5a5:	83 c4 0c             	add    $0xc,%esp
+ 5a8:	5b                   	pop    %ebx
+ 5a9:	5e                   	pop    %esi
+ 5aa:	5f                   	pop    %edi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000005b0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	53                   	push   %ebx
+ 5b6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 5b9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 5bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 5c0:	74 0e                	je     5d0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 5c2:	83 c4 1c             	add    $0x1c,%esp
+ 5c5:	5b                   	pop    %ebx
+ 5c6:	5e                   	pop    %esi
+ 5c7:	5f                   	pop    %edi
+ 5c8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 5c9:	e9 a5 03 00 00       	jmp    973 <clock_gettime>
+ 5ce:	66 90                	xchg   %ax,%ax
+ 5d0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 5d2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 5d8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5de:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 5e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5e6:	89 d0                	mov    %edx,%eax
+ 5e8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 5eb:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5f1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 5f7:	89 c6                	mov    %eax,%esi
+ 5f9:	89 d7                	mov    %edx,%edi
+ 5fb:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5fe:	d3 e6                	shl    %cl,%esi
+ 600:	31 c0                	xor    %eax,%eax
+ 602:	f6 c1 20             	test   $0x20,%cl
+ 605:	0f 45 fe             	cmovne %esi,%edi
+ 608:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 60b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 60e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 615:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 61b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 61e:	d3 ea                	shr    %cl,%edx
+ 620:	f6 c1 20             	test   $0x20,%cl
+ 623:	74 04                	je     629 <vclock_gettime+0x79>
+ 625:	89 d0                	mov    %edx,%eax
+ 627:	31 d2                	xor    %edx,%edx
+ 629:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 62b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 630:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 632:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 634:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 636:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 638:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 63e:	29 c1                	sub    %eax,%ecx
+}
+ 640:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 642:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 645:	83 c4 1c             	add    $0x1c,%esp
+ 648:	5b                   	pop    %ebx
+ 649:	5e                   	pop    %esi
+ 64a:	5f                   	pop    %edi
+ 64b:	5d                   	pop    %ebp
+ 64c:	c3                   	ret
+
+0000064d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 64d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 652:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 659:	74 09                	je     664 <fork+0x17>
+ 65b:	89 e1                	mov    %esp,%ecx
+ 65d:	ba 66 06 00 00       	mov    $0x666,%edx
+ 662:	0f 34                	sysenter
+ 664:	cd 40                	int    $0x40
+ 666:	c3                   	ret
+
+00000667 <exit>:
+SYSCALL(exit)
+ 667:	b8 02 00 00 00       	mov    $0x2,%eax
+ 66c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 673:	74 09                	je     67e <exit+0x17>
+ 675:	89 e1                	mov    %esp,%ecx
+ 677:	ba 80 06 00 00       	mov    $0x680,%edx
+ 67c:	0f 34                	sysenter
+ 67e:	cd 40                	int    $0x40
+ 680:	c3                   	ret
+
+00000681 <wait>:
+SYSCALL(wait)
+ 681:	b8 03 00 00 00       	mov    $0x3,%eax
+ 686:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 68d:	74 09                	je     698 <wait+0x17>
+ 68f:	89 e1                	mov    %esp,%ecx
+ 691:	ba 9a 06 00 00       	mov    $0x69a,%edx
+ 696:	0f 34                	sysenter
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <pipe>:
+SYSCALL(pipe)
+ 69b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a7:	74 09                	je     6b2 <pipe+0x17>
+ 6a9:	89 e1                	mov    %esp,%ecx
+ 6ab:	ba b4 06 00 00       	mov    $0x6b4,%edx
+ 6b0:	0f 34                	sysenter
+ 6b2:	cd 40                	int    $0x40
+ 6b4:	c3                   	ret
+
+000006b5 <read>:
+SYSCALL(read)
+ 6b5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6c1:	74 09                	je     6cc <read+0x17>
+ 6c3:	89 e1                	mov    %esp,%ecx
+ 6c5:	ba ce 06 00 00       	mov    $0x6ce,%edx
+ 6ca:	0f 34                	sysenter
+ 6cc:	cd 40                	int    $0x40
+ 6ce:	c3                   	ret
+
+000006cf <write>:
+SYSCALL(write)
+ 6cf:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6db:	74 09                	je     6e6 <write+0x17>
+ 6dd:	89 e1                	mov    %esp,%ecx
+ 6df:	ba e8 06 00 00       	mov    $0x6e8,%edx
+ 6e4:	0f 34                	sysenter
+ 6e6:	cd 40                	int    $0x40
+ 6e8:	c3                   	ret
+
+000006e9 <close>:
+SYSCALL(close)
+ 6e9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f5:	74 09                	je     700 <close+0x17>
+ 6f7:	89 e1                	mov    %esp,%ecx
+ 6f9:	ba 02 07 00 00       	mov    $0x702,%edx
+ 6fe:	0f 34                	sysenter
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <kill>:
+SYSCALL(kill)
+ 703:	b8 06 00 00 00       	mov    $0x6,%eax
+ 708:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 70f:	74 09                	je     71a <kill+0x17>
+ 711:	89 e1                	mov    %esp,%ecx
+ 713:	ba 1c 07 00 00       	mov    $0x71c,%edx
+ 718:	0f 34                	sysenter
+ 71a:	cd 40                	int    $0x40
+ 71c:	c3                   	ret
+
+0000071d <exec>:
+SYSCALL(exec)
+ 71d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 722:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 729:	74 09                	je     734 <exec+0x17>
+ 72b:	89 e1                	mov    %esp,%ecx
+ 72d:	ba 36 07 00 00       	mov    $0x736,%edx
+ 732:	0f 34                	sysenter
+ 734:	cd 40                	int    $0x40
+ 736:	c3                   	ret
+
+00000737 <open>:
+SYSCALL(open)
+ 737:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 73c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 743:	74 09                	je     74e <open+0x17>
+ 745:	89 e1                	mov    %esp,%ecx
+ 747:	ba 50 07 00 00       	mov    $0x750,%edx
+ 74c:	0f 34                	sysenter
+ 74e:	cd 40                	int    $0x40
+ 750:	c3                   	ret
+
+00000751 <mknod>:
+SYSCALL(mknod)
+ 751:	b8 11 00 00 00       	mov    $0x11,%eax
+ 756:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 75d:	74 09                	je     768 <mknod+0x17>
+ 75f:	89 e1                	mov    %esp,%ecx
+ 761:	ba 6a 07 00 00       	mov    $0x76a,%edx
+ 766:	0f 34                	sysenter
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <unlink>:
+SYSCALL(unlink)
+ 76b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 770:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 777:	74 09                	je     782 <unlink+0x17>
+ 779:	89 e1                	mov    %esp,%ecx
+ 77b:	ba 84 07 00 00       	mov    $0x784,%edx
+ 780:	0f 34                	sysenter
+ 782:	cd 40                	int    $0x40
+ 784:	c3                   	ret
+
+00000785 <fstat>:
+SYSCALL(fstat)
+ 785:	b8 08 00 00 00       	mov    $0x8,%eax
+ 78a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 791:	74 09                	je     79c <fstat+0x17>
+ 793:	89 e1                	mov    %esp,%ecx
+ 795:	ba 9e 07 00 00       	mov    $0x79e,%edx
+ 79a:	0f 34                	sysenter
+ 79c:	cd 40                	int    $0x40
+ 79e:	c3                   	ret
+
+0000079f <link>:
+SYSCALL(link)
+ 79f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ab:	74 09                	je     7b6 <link+0x17>
+ 7ad:	89 e1                	mov    %esp,%ecx
+ 7af:	ba b8 07 00 00       	mov    $0x7b8,%edx
+ 7b4:	0f 34                	sysenter
+ 7b6:	cd 40                	int    $0x40
+ 7b8:	c3                   	ret
+
+000007b9 <mkdir>:
+SYSCALL(mkdir)
+ 7b9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c5:	74 09                	je     7d0 <mkdir+0x17>
+ 7c7:	89 e1                	mov    %esp,%ecx
+ 7c9:	ba d2 07 00 00       	mov    $0x7d2,%edx
+ 7ce:	0f 34                	sysenter
+ 7d0:	cd 40                	int    $0x40
+ 7d2:	c3                   	ret
+
+000007d3 <chdir>:
+SYSCALL(chdir)
+ 7d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7df:	74 09                	je     7ea <chdir+0x17>
+ 7e1:	89 e1                	mov    %esp,%ecx
+ 7e3:	ba ec 07 00 00       	mov    $0x7ec,%edx
+ 7e8:	0f 34                	sysenter
+ 7ea:	cd 40                	int    $0x40
+ 7ec:	c3                   	ret
+
+000007ed <dup>:
+SYSCALL(dup)
+ 7ed:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f9:	74 09                	je     804 <dup+0x17>
+ 7fb:	89 e1                	mov    %esp,%ecx
+ 7fd:	ba 06 08 00 00       	mov    $0x806,%edx
+ 802:	0f 34                	sysenter
+ 804:	cd 40                	int    $0x40
+ 806:	c3                   	ret
+
+00000807 <getpid>:
+SYSCALL(getpid)
+ 807:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 80c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 813:	74 09                	je     81e <getpid+0x17>
+ 815:	89 e1                	mov    %esp,%ecx
+ 817:	ba 20 08 00 00       	mov    $0x820,%edx
+ 81c:	0f 34                	sysenter
+ 81e:	cd 40                	int    $0x40
+ 820:	c3                   	ret
+
+00000821 <sbrk>:
+SYSCALL(sbrk)
+ 821:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 826:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 82d:	74 09                	je     838 <sbrk+0x17>
+ 82f:	89 e1                	mov    %esp,%ecx
+ 831:	ba 3a 08 00 00       	mov    $0x83a,%edx
+ 836:	0f 34                	sysenter
+ 838:	cd 40                	int    $0x40
+ 83a:	c3                   	ret
+
+0000083b <sleep>:
+SYSCALL(sleep)
+ 83b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 840:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 847:	74 09                	je     852 <sleep+0x17>
+ 849:	89 e1                	mov    %esp,%ecx
+ 84b:	ba 54 08 00 00       	mov    $0x854,%edx
+ 850:	0f 34                	sysenter
+ 852:	cd 40                	int    $0x40
+ 854:	c3                   	ret
+
+00000855 <uptime>:
+SYSCALL(uptime)
+ 855:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 85a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 861:	74 09                	je     86c <uptime+0x17>
+ 863:	89 e1                	mov    %esp,%ecx
+ 865:	ba 6e 08 00 00       	mov    $0x86e,%edx
+ 86a:	0f 34                	sysenter
+ 86c:	cd 40                	int    $0x40
+ 86e:	c3                   	ret
+
+0000086f <mmap>:
+SYSCALL(mmap)
+ 86f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 874:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 87b:	74 09                	je     886 <mmap+0x17>
+ 87d:	89 e1                	mov    %esp,%ecx
+ 87f:	ba 88 08 00 00       	mov    $0x888,%edx
+ 884:	0f 34                	sysenter
+ 886:	cd 40                	int    $0x40
+ 888:	c3                   	ret
+
+00000889 <munmap>:
+SYSCALL(munmap)
+ 889:	b8 17 00 00 00       	mov    $0x17,%eax
+ 88e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 895:	74 09                	je     8a0 <munmap+0x17>
+ 897:	89 e1                	mov    %esp,%ecx
+ 899:	ba a2 08 00 00       	mov    $0x8a2,%edx
+ 89e:	0f 34                	sysenter
+ 8a0:	cd 40                	int    $0x40
+ 8a2:	c3                   	ret
+
+000008a3 <clone>:
+SYSCALL(clone)
+ 8a3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8a8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8af:	74 09                	je     8ba <clone+0x17>
+ 8b1:	89 e1                	mov    %esp,%ecx
+ 8b3:	ba bc 08 00 00       	mov    $0x8bc,%edx
+ 8b8:	0f 34                	sysenter
+ 8ba:	cd 40                	int    $0x40
+ 8bc:	c3                   	ret
+
+000008bd <join>:
+SYSCALL(join)
+ 8bd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8c2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c9:	74 09                	je     8d4 <join+0x17>
+ 8cb:	89 e1                	mov    %esp,%ecx
+ 8cd:	ba d6 08 00 00       	mov    $0x8d6,%edx
+ 8d2:	0f 34                	sysenter
+ 8d4:	cd 40                	int    $0x40
+ 8d6:	c3                   	ret
+
+000008d7 <futex>:
+SYSCALL(futex)
+ 8d7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8dc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8e3:	74 09                	je     8ee <futex+0x17>
+ 8e5:	89 e1                	mov    %esp,%ecx
+ 8e7:	ba f0 08 00 00       	mov    $0x8f0,%edx
+ 8ec:	0f 34                	sysenter
+ 8ee:	cd 40                	int    $0x40
+ 8f0:	c3                   	ret
+
+000008f1 <memstat>:
+SYSCALL(memstat)
+ 8f1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8f6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8fd:	74 09                	je     908 <memstat+0x17>
+ 8ff:	89 e1                	mov    %esp,%ecx
+ 901:	ba 0a 09 00 00       	mov    $0x90a,%edx
+ 906:	0f 34                	sysenter
+ 908:	cd 40                	int    $0x40
+ 90a:	c3                   	ret
+
+0000090b <nice>:
+SYSCALL(nice)
+ 90b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 910:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 917:	74 09                	je     922 <nice+0x17>
+ 919:	89 e1                	mov    %esp,%ecx
+ 91b:	ba 24 09 00 00       	mov    $0x924,%edx
+ 920:	0f 34                	sysenter
+ 922:	cd 40                	int    $0x40
+ 924:	c3                   	ret
+
+00000925 <setpriority>:
+SYSCALL(setpriority)
+ 925:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 92a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 931:	74 09                	je     93c <setpriority+0x17>
+ 933:	89 e1                	mov    %esp,%ecx
+ 935:	ba 3e 09 00 00       	mov    $0x93e,%edx
+ 93a:	0f 34                	sysenter
+ 93c:	cd 40                	int    $0x40
+ 93e:	c3                   	ret
+
+0000093f <getpinfo>:
+SYSCALL(getpinfo)
+ 93f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 944:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 94b:	74 09                	je     956 <getpinfo+0x17>
+ 94d:	89 e1                	mov    %esp,%ecx
+ 94f:	ba 58 09 00 00       	mov    $0x958,%edx
+ 954:	0f 34                	sysenter
+ 956:	cd 40                	int    $0x40
+ 958:	c3                   	ret
+
+00000959 <settickets>:
+SYSCALL(settickets)
+ 959:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 95e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 965:	74 09                	je     970 <settickets+0x17>
+ 967:	89 e1                	mov    %esp,%ecx
+ 969:	ba 72 09 00 00       	mov    $0x972,%edx
+ 96e:	0f 34                	sysenter
+ 970:	cd 40                	int    $0x40
+ 972:	c3                   	ret
+
+00000973 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 973:	b8 20 00 00 00       	mov    $0x20,%eax
+ 978:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 97f:	74 09                	je     98a <clock_gettime+0x17>
+ 981:	89 e1                	mov    %esp,%ecx
+ 983:	ba 8c 09 00 00       	mov    $0x98c,%edx
+ 988:	0f 34                	sysenter
+ 98a:	cd 40                	int    $0x40
+ 98c:	c3                   	ret
+
+0000098d <batch>:
+SYSCALL(batch)
+ 98d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 992:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 999:	74 09                	je     9a4 <batch+0x17>
+ 99b:	89 e1                	mov    %esp,%ecx
+ 99d:	ba a6 09 00 00       	mov    $0x9a6,%edx
+ 9a2:	0f 34                	sysenter
+ 9a4:	cd 40                	int    $0x40
+ 9a6:	c3                   	ret
+
+000009a7 <aiosetup>:
+SYSCALL(aiosetup)
+ 9a7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9ac:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9b3:	74 09                	je     9be <aiosetup+0x17>
+ 9b5:	89 e1                	mov    %esp,%ecx
+ 9b7:	ba c0 09 00 00       	mov    $0x9c0,%edx
+ 9bc:	0f 34                	sysenter
+ 9be:	cd 40                	int    $0x40
+ 9c0:	c3                   	ret
+
+000009c1 <aioenter>:
+SYSCALL(aioenter)
+ 9c1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9c6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9cd:	74 09                	je     9d8 <aioenter+0x17>
+ 9cf:	89 e1                	mov    %esp,%ecx
+ 9d1:	ba da 09 00 00       	mov    $0x9da,%edx
+ 9d6:	0f 34                	sysenter
+ 9d8:	cd 40                	int    $0x40
+ 9da:	c3                   	ret
+
+000009db <systrace>:
+SYSCALL(systrace)
+ 9db:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9e0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9e7:	74 09                	je     9f2 <systrace+0x17>
+ 9e9:	89 e1                	mov    %esp,%ecx
+ 9eb:	ba f4 09 00 00       	mov    $0x9f4,%edx
+ 9f0:	0f 34                	sysenter
+ 9f2:	cd 40                	int    $0x40
+ 9f4:	c3                   	ret
+
+000009f5 <sysstat>:
+SYSCALL(sysstat)
+ 9f5:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9fa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a01:	74 09                	je     a0c <sysstat+0x17>
+ a03:	89 e1                	mov    %esp,%ecx
+ a05:	ba 0e 0a 00 00       	mov    $0xa0e,%edx
+ a0a:	0f 34                	sysenter
+ a0c:	cd 40                	int    $0x40
+ a0e:	c3                   	ret
+
+00000a0f <traceread>:
+SYSCALL(traceread)
+ a0f:	b8 26 00 00 00       	mov    $0x26,%eax
+ a14:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a1b:	74 09                	je     a26 <traceread+0x17>
+ a1d:	89 e1                	mov    %esp,%ecx
+ a1f:	ba 28 0a 00 00       	mov    $0xa28,%edx
+ a24:	0f 34                	sysenter
+ a26:	cd 40                	int    $0x40
+ a28:	c3                   	ret
+ a29:	66 90                	xchg   %ax,%ax
+ a2b:	66 90                	xchg   %ax,%ax
+ a2d:	66 90                	xchg   %ax,%ax
+ a2f:	90                   	nop
+
+00000a30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a38:	89 d1                	mov    %edx,%ecx
+{
+ a3a:	83 ec 3c             	sub    $0x3c,%esp
+ a3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ a40:	85 d2                	test   %edx,%edx
+ a42:	0f 89 80 00 00 00    	jns    ac8 <printint+0x98>
+ a48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ a4c:	74 7a                	je     ac8 <printint+0x98>
+    x = -xx;
+ a4e:	f7 d9                	neg    %ecx
+    neg = 1;
+ a50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ a55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ a58:	31 f6                	xor    %esi,%esi
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ a60:	89 c8                	mov    %ecx,%eax
+ a62:	31 d2                	xor    %edx,%edx
+ a64:	89 f7                	mov    %esi,%edi
+ a66:	f7 f3                	div    %ebx
+ a68:	8d 76 01             	lea    0x1(%esi),%esi
+ a6b:	0f b6 92 34 0f 00 00 	movzbl 0xf34(%edx),%edx
+ a72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ a76:	89 ca                	mov    %ecx,%edx
+ a78:	89 c1                	mov    %eax,%ecx
+ a7a:	39 da                	cmp    %ebx,%edx
+ a7c:	73 e2                	jae    a60 <printint+0x30>
+  if(neg)
+ a7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a81:	85 c0                	test   %eax,%eax
+ a83:	74 07                	je     a8c <printint+0x5c>
+    buf[i++] = '-';
+ a85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a8a:	89 f7                	mov    %esi,%edi
+ a8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a92:	01 df                	add    %ebx,%edi
+ a94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a9b:	83 ec 04             	sub    $0x4,%esp
+ a9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ aa1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ aa4:	6a 01                	push   $0x1
+ aa6:	50                   	push   %eax
+ aa7:	56                   	push   %esi
+ aa8:	e8 22 fc ff ff       	call   6cf <write>
+  while(--i >= 0)
+ aad:	89 f8                	mov    %edi,%eax
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	83 ef 01             	sub    $0x1,%edi
+ ab5:	39 d8                	cmp    %ebx,%eax
+ ab7:	75 df                	jne    a98 <printint+0x68>
+}
+ ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abc:	5b                   	pop    %ebx
+ abd:	5e                   	pop    %esi
+ abe:	5f                   	pop    %edi
+ abf:	5d                   	pop    %ebp
+ ac0:	c3                   	ret
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ac8:	31 c0                	xor    %eax,%eax
+ aca:	eb 89                	jmp    a55 <printint+0x25>
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000ad0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+ ad6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ ad9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ adc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ adf:	0f b6 1e             	movzbl (%esi),%ebx
+ ae2:	83 c6 01             	add    $0x1,%esi
+ ae5:	84 db                	test   %bl,%bl
+ ae7:	74 67                	je     b50 <printf+0x80>
+ ae9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ aec:	31 d2                	xor    %edx,%edx
+ aee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ af1:	eb 34                	jmp    b27 <printf+0x57>
+ af3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ af7:	90                   	nop
+ af8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ afb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b00:	83 f8 25             	cmp    $0x25,%eax
+ b03:	74 18                	je     b1d <printf+0x4d>
+  write(fd, &c, 1);
+ b05:	83 ec 04             	sub    $0x4,%esp
+ b08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b0e:	6a 01                	push   $0x1
+ b10:	50                   	push   %eax
+ b11:	57                   	push   %edi
+ b12:	e8 b8 fb ff ff       	call   6cf <write>
+ b17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b1d:	0f b6 1e             	movzbl (%esi),%ebx
+ b20:	83 c6 01             	add    $0x1,%esi
+ b23:	84 db                	test   %bl,%bl
+ b25:	74 29                	je     b50 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b2a:	85 d2                	test   %edx,%edx
+ b2c:	74 ca                	je     af8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b2e:	83 fa 25             	cmp    $0x25,%edx
+ b31:	75 ea                	jne    b1d <printf+0x4d>
+      if(c == 'd'){
+ b33:	83 f8 25             	cmp    $0x25,%eax
+ b36:	0f 84 24 01 00 00    	je     c60 <printf+0x190>
+ b3c:	83 e8 63             	sub    $0x63,%eax
+ b3f:	83 f8 15             	cmp    $0x15,%eax
+ b42:	77 1c                	ja     b60 <printf+0x90>
+ b44:	ff 24 85 dc 0e 00 00 	jmp    *0xedc(,%eax,4)
+ b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ b50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b53:	5b                   	pop    %ebx
+ b54:	5e                   	pop    %esi
+ b55:	5f                   	pop    %edi
+ b56:	5d                   	pop    %ebp
+ b57:	c3                   	ret
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+  write(fd, &c, 1);
+ b60:	83 ec 04             	sub    $0x4,%esp
+ b63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ b6a:	6a 01                	push   $0x1
+ b6c:	52                   	push   %edx
+ b6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ b70:	57                   	push   %edi
+ b71:	e8 59 fb ff ff       	call   6cf <write>
+ b76:	83 c4 0c             	add    $0xc,%esp
+ b79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b7c:	6a 01                	push   $0x1
+ b7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b81:	52                   	push   %edx
+ b82:	57                   	push   %edi
+ b83:	e8 47 fb ff ff       	call   6cf <write>
+        putc(fd, c);
+ b88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b8b:	31 d2                	xor    %edx,%edx
+ b8d:	eb 8e                	jmp    b1d <printf+0x4d>
+ b8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b93:	83 ec 0c             	sub    $0xc,%esp
+ b96:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b9b:	8b 13                	mov    (%ebx),%edx
+ b9d:	6a 00                	push   $0x0
+ b9f:	89 f8                	mov    %edi,%eax
+        ap++;
+ ba1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ba4:	e8 87 fe ff ff       	call   a30 <printint>
+        ap++;
+ ba9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ baf:	31 d2                	xor    %edx,%edx
+ bb1:	e9 67 ff ff ff       	jmp    b1d <printf+0x4d>
+ bb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ bc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ bc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ bc5:	83 c0 04             	add    $0x4,%eax
+ bc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ bcb:	85 db                	test   %ebx,%ebx
+ bcd:	0f 84 9d 00 00 00    	je     c70 <printf+0x1a0>
+        while(*s != 0){
+ bd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ bd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ bd8:	84 c0                	test   %al,%al
+ bda:	0f 84 3d ff ff ff    	je     b1d <printf+0x4d>
+ be0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ be6:	89 de                	mov    %ebx,%esi
+ be8:	89 d3                	mov    %edx,%ebx
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ bf0:	83 ec 04             	sub    $0x4,%esp
+ bf3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ bf6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ bf9:	6a 01                	push   $0x1
+ bfb:	53                   	push   %ebx
+ bfc:	57                   	push   %edi
+ bfd:	e8 cd fa ff ff       	call   6cf <write>
+        while(*s != 0){
+ c02:	0f b6 06             	movzbl (%esi),%eax
+ c05:	83 c4 10             	add    $0x10,%esp
+ c08:	84 c0                	test   %al,%al
+ c0a:	75 e4                	jne    bf0 <printf+0x120>
+      state = 0;
+ c0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 07 ff ff ff       	jmp    b1d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c23:	83 ec 0c             	sub    $0xc,%esp
+ c26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c2b:	8b 13                	mov    (%ebx),%edx
+ c2d:	6a 01                	push   $0x1
+ c2f:	e9 6b ff ff ff       	jmp    b9f <printf+0xcf>
+ c34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c3b:	83 ec 04             	sub    $0x4,%esp
+ c3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ c41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ c43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ c46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ c49:	6a 01                	push   $0x1
+ c4b:	52                   	push   %edx
+ c4c:	57                   	push   %edi
+ c4d:	e8 7d fa ff ff       	call   6cf <write>
+        ap++;
+ c52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c58:	31 d2                	xor    %edx,%edx
+ c5a:	e9 be fe ff ff       	jmp    b1d <printf+0x4d>
+ c5f:	90                   	nop
+  write(fd, &c, 1);
+ c60:	83 ec 04             	sub    $0x4,%esp
+ c63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c69:	6a 01                	push   $0x1
+ c6b:	e9 11 ff ff ff       	jmp    b81 <printf+0xb1>
+ c70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ c75:	bb d3 0e 00 00       	mov    $0xed3,%ebx
+ c7a:	e9 61 ff ff ff       	jmp    be0 <printf+0x110>
+ c7f:	90                   	nop
+
+00000c80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c81:	a1 d0 13 00 00       	mov    0x13d0,%eax
+{
+ c86:	89 e5                	mov    %esp,%ebp
+ c88:	57                   	push   %edi
+ c89:	56                   	push   %esi
+ c8a:	53                   	push   %ebx
+ c8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c9c:	39 ca                	cmp    %ecx,%edx
+ c9e:	73 30                	jae    cd0 <free+0x50>
+ ca0:	39 c1                	cmp    %eax,%ecx
+ ca2:	72 04                	jb     ca8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ca4:	39 c2                	cmp    %eax,%edx
+ ca6:	72 f0                	jb     c98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ ca8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ cab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ cae:	39 f8                	cmp    %edi,%eax
+ cb0:	74 2e                	je     ce0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ cb2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ cb5:	8b 42 04             	mov    0x4(%edx),%eax
+ cb8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cbb:	39 f1                	cmp    %esi,%ecx
+ cbd:	74 38                	je     cf7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ cbf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ cc1:	5b                   	pop    %ebx
+  freep = p;
+ cc2:	89 15 d0 13 00 00    	mov    %edx,0x13d0
+}
+ cc8:	5e                   	pop    %esi
+ cc9:	5f                   	pop    %edi
+ cca:	5d                   	pop    %ebp
+ ccb:	c3                   	ret
+ ccc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cd0:	39 c1                	cmp    %eax,%ecx
+ cd2:	72 d0                	jb     ca4 <free+0x24>
+ cd4:	eb c2                	jmp    c98 <free+0x18>
+ cd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cdd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ce0:	03 70 04             	add    0x4(%eax),%esi
+ ce3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ce6:	8b 02                	mov    (%edx),%eax
+ ce8:	8b 00                	mov    (%eax),%eax
+ cea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ ced:	8b 42 04             	mov    0x4(%edx),%eax
+ cf0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ cf3:	39 f1                	cmp    %esi,%ecx
+ cf5:	75 c8                	jne    cbf <free+0x3f>
+    p->s.size += bp->s.size;
+ cf7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ cfa:	89 15 d0 13 00 00    	mov    %edx,0x13d0
+    p->s.size += bp->s.size;
+ d00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d06:	89 0a                	mov    %ecx,(%edx)
+}
+ d08:	5b                   	pop    %ebx
+ d09:	5e                   	pop    %esi
+ d0a:	5f                   	pop    %edi
+ d0b:	5d                   	pop    %ebp
+ d0c:	c3                   	ret
+ d0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	57                   	push   %edi
+ d14:	56                   	push   %esi
+ d15:	53                   	push   %ebx
+ d16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d1c:	8b 15 d0 13 00 00    	mov    0x13d0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d22:	8d 78 07             	lea    0x7(%eax),%edi
+ d25:	c1 ef 03             	shr    $0x3,%edi
+ d28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d2b:	85 d2                	test   %edx,%edx
+ d2d:	0f 84 8d 00 00 00    	je     dc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d35:	8b 48 04             	mov    0x4(%eax),%ecx
+ d38:	39 f9                	cmp    %edi,%ecx
+ d3a:	73 64                	jae    da0 <malloc+0x90>
+  if(nu < 4096)
+ d3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ d41:	39 df                	cmp    %ebx,%edi
+ d43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ d46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ d4d:	eb 0a                	jmp    d59 <malloc+0x49>
+ d4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d52:	8b 48 04             	mov    0x4(%eax),%ecx
+ d55:	39 f9                	cmp    %edi,%ecx
+ d57:	73 47                	jae    da0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ d59:	89 c2                	mov    %eax,%edx
+ d5b:	39 05 d0 13 00 00    	cmp    %eax,0x13d0
+ d61:	75 ed                	jne    d50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ d63:	83 ec 0c             	sub    $0xc,%esp
+ d66:	56                   	push   %esi
+ d67:	e8 b5 fa ff ff       	call   821 <sbrk>
+  if(p == (char*)-1)
+ d6c:	83 c4 10             	add    $0x10,%esp
+ d6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ d72:	74 1c                	je     d90 <malloc+0x80>
+  hp->s.size = nu;
+ d74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ d77:	83 ec 0c             	sub    $0xc,%esp
+ d7a:	83 c0 08             	add    $0x8,%eax
+ d7d:	50                   	push   %eax
+ d7e:	e8 fd fe ff ff       	call   c80 <free>
+  return freep;
+ d83:	8b 15 d0 13 00 00    	mov    0x13d0,%edx
+      if((p = morecore(nunits)) == 0)
+ d89:	83 c4 10             	add    $0x10,%esp
+ d8c:	85 d2                	test   %edx,%edx
+ d8e:	75 c0                	jne    d50 <malloc+0x40>
+        return 0;
+  }
+}
+ d90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d93:	31 c0                	xor    %eax,%eax
+}
+ d95:	5b                   	pop    %ebx
+ d96:	5e                   	pop    %esi
+ d97:	5f                   	pop    %edi
+ d98:	5d                   	pop    %ebp
+ d99:	c3                   	ret
+ d9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ da0:	39 cf                	cmp    %ecx,%edi
+ da2:	74 4c                	je     df0 <malloc+0xe0>
+        p->s.size -= nunits;
+ da4:	29 f9                	sub    %edi,%ecx
+ da6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ da9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ dac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ daf:	89 15 d0 13 00 00    	mov    %edx,0x13d0
+}
+ db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ db8:	83 c0 08             	add    $0x8,%eax
+}
+ dbb:	5b                   	pop    %ebx
+ dbc:	5e                   	pop    %esi
+ dbd:	5f                   	pop    %edi
+ dbe:	5d                   	pop    %ebp
+ dbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ dc0:	c7 05 d0 13 00 00 d4 	movl   $0x13d4,0x13d0
+ dc7:	13 00 00 
+    base.s.size = 0;
+ dca:	b8 d4 13 00 00       	mov    $0x13d4,%eax
+    base.s.ptr = freep = prevp = &base;
+ dcf:	c7 05 d4 13 00 00 d4 	movl   $0x13d4,0x13d4
+ dd6:	13 00 00 
+    base.s.size = 0;
+ dd9:	c7 05 d8 13 00 00 00 	movl   $0x0,0x13d8
+ de0:	00 00 00 
+    if(p->s.size >= nunits){
+ de3:	e9 54 ff ff ff       	jmp    d3c <malloc+0x2c>
+ de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ df0:	8b 08                	mov    (%eax),%ecx
+ df2:	89 0a                	mov    %ecx,(%edx)
+ df4:	eb b9                	jmp    daf <malloc+0x9f>
+ df6:	66 90                	xchg   %ax,%ax
+ df8:	66 90                	xchg   %ax,%ax
+ dfa:	66 90                	xchg   %ax,%ax
+ dfc:	66 90                	xchg   %ax,%ax
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	53                   	push   %ebx
+ e04:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ e07:	68 00 20 00 00       	push   $0x2000
+ e0c:	e8 ff fe ff ff       	call   d10 <malloc>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	85 c0                	test   %eax,%eax
+ e16:	74 47                	je     e5f <thread_create+0x5f>
+ e18:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e1a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ e20:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e23:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ e28:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ e2b:	ff 75 0c             	push   0xc(%ebp)
+ e2e:	50                   	push   %eax
+ e2f:	ff 75 08             	push   0x8(%ebp)
+ e32:	e8 6c fa ff ff       	call   8a3 <clone>
+ e37:	83 c4 10             	add    $0x10,%esp
+ e3a:	85 c0                	test   %eax,%eax
+ e3c:	78 0a                	js     e48 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e3e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e41:	c9                   	leave
+ e42:	c3                   	ret
+ e43:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ e47:	90                   	nop
+    free(mem);
+ e48:	83 ec 0c             	sub    $0xc,%esp
+ e4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e4e:	53                   	push   %ebx
+ e4f:	e8 2c fe ff ff       	call   c80 <free>
+ e54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e57:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ e5a:	83 c4 10             	add    $0x10,%esp
+}
+ e5d:	c9                   	leave
+ e5e:	c3                   	ret
+    return -1;
+ e5f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e64:	eb d8                	jmp    e3e <thread_create+0x3e>
+ e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000e70 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ e70:	55                   	push   %ebp
+ e71:	89 e5                	mov    %esp,%ebp
+ e73:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ e74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ e77:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ e7a:	50                   	push   %eax
+ e7b:	e8 3d fa ff ff       	call   8bd <join>
+ e80:	83 c4 10             	add    $0x10,%esp
+ e83:	85 c0                	test   %eax,%eax
+ e85:	78 21                	js     ea8 <thread_join+0x38>
+ e87:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ e89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8c:	83 ec 0c             	sub    $0xc,%esp
+ e8f:	ff 70 fc             	push   -0x4(%eax)
+ e92:	e8 e9 fd ff ff       	call   c80 <free>
+  return pid;
+ e97:	83 c4 10             	add    $0x10,%esp
+}
+ e9a:	89 d8                	mov    %ebx,%eax
+ e9c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e9f:	c9                   	leave
+ ea0:	c3                   	ret
+ ea1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ ea8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ ead:	eb eb                	jmp    e9a <thread_join+0x2a>
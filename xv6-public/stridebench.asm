@@ -0,0 +1,2211 @@
+
+_stridebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb f4 01 00 00       	mov    $0x1f4,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 48             	sub    $0x48,%esp
+  int i, t, pid[NSPIN];
+  uint t0[NSPIN], t1[NSPIN];
+  volatile int x;
+
+  t = T;
+  if(argc > 1)
+  19:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1c:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1f:	7e 10                	jle    31 <main+0x31>
+    t = atoi(argv[1]);
+  21:	83 ec 0c             	sub    $0xc,%esp
+  24:	ff 70 04             	push   0x4(%eax)
+  27:	e8 a4 03 00 00       	call   3d0 <atoi>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	89 c3                	mov    %eax,%ebx
+
+  for(i = 0; i < NSPIN; i++){
+  31:	31 ff                	xor    %edi,%edi
+  33:	8d 75 c4             	lea    -0x3c(%ebp),%esi
+    pid[i] = fork();
+  36:	e8 f2 06 00 00       	call   72d <fork>
+  3b:	89 04 be             	mov    %eax,(%esi,%edi,4)
+    if(pid[i] < 0){
+  3e:	85 c0                	test   %eax,%eax
+  40:	0f 88 da 00 00 00    	js     120 <main+0x120>
+      printf(2, "stridebench: fork failed\n");
+      exit();
+    }
+    if(pid[i] == 0){
+      settickets(100 * (i + 1));
+  46:	83 c7 01             	add    $0x1,%edi
+    if(pid[i] == 0){
+  49:	85 c0                	test   %eax,%eax
+  4b:	0f 84 e2 00 00 00    	je     133 <main+0x133>
+  for(i = 0; i < NSPIN; i++){
+  51:	83 ff 03             	cmp    $0x3,%edi
+  54:	75 e0                	jne    36 <main+0x36>
+        ;
+    }
+  }
+
+  // Let the spinners settle into the stride class first.
+  sleep(10);
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	6a 0a                	push   $0xa
+  5b:	e8 bb 08 00 00       	call   91b <sleep>
+  sample(pid, t0);
+  60:	58                   	pop    %eax
+  61:	8d 45 d0             	lea    -0x30(%ebp),%eax
+  64:	5a                   	pop    %edx
+  65:	50                   	push   %eax
+  66:	56                   	push   %esi
+  67:	e8 f4 00 00 00       	call   160 <sample>
+  sleep(t);
+  6c:	89 1c 24             	mov    %ebx,(%esp)
+  6f:	e8 a7 08 00 00       	call   91b <sleep>
+  sample(pid, t1);
+  74:	59                   	pop    %ecx
+  75:	5f                   	pop    %edi
+  76:	8d 7d dc             	lea    -0x24(%ebp),%edi
+  79:	57                   	push   %edi
+  7a:	56                   	push   %esi
+  7b:	e8 e0 00 00 00       	call   160 <sample>
+
+  for(i = 0; i < NSPIN; i++){
+    kill(pid[i]);
+  80:	58                   	pop    %eax
+  81:	ff 75 c4             	push   -0x3c(%ebp)
+  84:	e8 5a 07 00 00       	call   7e3 <kill>
+    wait();
+  89:	e8 d3 06 00 00       	call   761 <wait>
+    kill(pid[i]);
+  8e:	58                   	pop    %eax
+  8f:	ff 75 c8             	push   -0x38(%ebp)
+  92:	e8 4c 07 00 00       	call   7e3 <kill>
+    wait();
+  97:	e8 c5 06 00 00       	call   761 <wait>
+    kill(pid[i]);
+  9c:	58                   	pop    %eax
+  9d:	ff 75 cc             	push   -0x34(%ebp)
+  a0:	e8 3e 07 00 00       	call   7e3 <kill>
+    wait();
+  a5:	e8 b7 06 00 00       	call   761 <wait>
+  }
+
+  for(i = 0; i < NSPIN; i++)
+    t1[i] -= t0[i];
+  aa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  ad:	2b 45 d0             	sub    -0x30(%ebp),%eax
+  printf(1, "stridebench: %d ticks\n", t);
+  b0:	83 c4 0c             	add    $0xc,%esp
+    t1[i] -= t0[i];
+  b3:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  b6:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  b9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  bc:	29 45 e0             	sub    %eax,-0x20(%ebp)
+  bf:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  c2:	29 45 e4             	sub    %eax,-0x1c(%ebp)
+  printf(1, "stridebench: %d ticks\n", t);
+  c5:	53                   	push   %ebx
+  for(i = 0; i < NSPIN; i++)
+  c6:	31 db                	xor    %ebx,%ebx
+  printf(1, "stridebench: %d ticks\n", t);
+  c8:	68 c8 0f 00 00       	push   $0xfc8
+  cd:	6a 01                	push   $0x1
+  cf:	e8 dc 0a 00 00       	call   bb0 <printf>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	b9 64 00 00 00       	mov    $0x64,%ecx
+    printf(1, "  pid %d: %d tickets, %d ticks, ratio %d\n", pid[i],
+  dc:	8b 55 b4             	mov    -0x4c(%ebp),%edx
+  df:	31 c0                	xor    %eax,%eax
+  e1:	85 d2                	test   %edx,%edx
+  e3:	74 09                	je     ee <main+0xee>
+           100 * (i + 1), t1[i], t1[0] ? t1[i] * 100 / t1[0] : 0);
+  e5:	6b 04 9f 64          	imul   $0x64,(%edi,%ebx,4),%eax
+    printf(1, "  pid %d: %d tickets, %d ticks, ratio %d\n", pid[i],
+  e9:	31 d2                	xor    %edx,%edx
+  eb:	f7 75 b4             	divl   -0x4c(%ebp)
+  ee:	8b 14 9f             	mov    (%edi,%ebx,4),%edx
+  f1:	83 ec 08             	sub    $0x8,%esp
+           100 * (i + 1), t1[i], t1[0] ? t1[i] * 100 / t1[0] : 0);
+  f4:	83 c3 01             	add    $0x1,%ebx
+    printf(1, "  pid %d: %d tickets, %d ticks, ratio %d\n", pid[i],
+  f7:	50                   	push   %eax
+  f8:	52                   	push   %edx
+  f9:	51                   	push   %ecx
+  fa:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+  fd:	ff 74 9e fc          	push   -0x4(%esi,%ebx,4)
+ 101:	68 e0 0f 00 00       	push   $0xfe0
+ 106:	6a 01                	push   $0x1
+ 108:	e8 a3 0a 00 00       	call   bb0 <printf>
+  for(i = 0; i < NSPIN; i++)
+ 10d:	8b 4d b0             	mov    -0x50(%ebp),%ecx
+ 110:	83 c4 20             	add    $0x20,%esp
+ 113:	83 c1 64             	add    $0x64,%ecx
+ 116:	83 fb 03             	cmp    $0x3,%ebx
+ 119:	75 c1                	jne    dc <main+0xdc>
+  exit();
+ 11b:	e8 27 06 00 00       	call   747 <exit>
+      printf(2, "stridebench: fork failed\n");
+ 120:	50                   	push   %eax
+ 121:	50                   	push   %eax
+ 122:	68 ae 0f 00 00       	push   $0xfae
+ 127:	6a 02                	push   $0x2
+ 129:	e8 82 0a 00 00       	call   bb0 <printf>
+      exit();
+ 12e:	e8 14 06 00 00       	call   747 <exit>
+      settickets(100 * (i + 1));
+ 133:	6b ff 64             	imul   $0x64,%edi,%edi
+ 136:	83 ec 0c             	sub    $0xc,%esp
+ 139:	57                   	push   %edi
+ 13a:	e8 fa 08 00 00       	call   a39 <settickets>
+      for(x = 0;; x++)
+ 13f:	31 c0                	xor    %eax,%eax
+ 141:	83 c4 10             	add    $0x10,%esp
+ 144:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 147:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14e:	66 90                	xchg   %ax,%ax
+ 150:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 153:	83 c0 01             	add    $0x1,%eax
+ 156:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 159:	eb f5                	jmp    150 <main+0x150>
+ 15b:	66 90                	xchg   %ax,%ax
+ 15d:	66 90                	xchg   %ax,%ax
+ 15f:	90                   	nop
+
+00000160 <sample>:
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+ 165:	53                   	push   %ebx
+ 166:	83 ec 28             	sub    $0x28,%esp
+  if(getpinfo(&st) < 0){
+ 169:	68 40 15 00 00       	push   $0x1540
+ 16e:	e8 ac 08 00 00       	call   a1f <getpinfo>
+ 173:	83 c4 10             	add    $0x10,%esp
+ 176:	85 c0                	test   %eax,%eax
+ 178:	78 6b                	js     1e5 <sample+0x85>
+ 17a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 17d:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 180:	8d 4b 0c             	lea    0xc(%ebx),%ecx
+ 183:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    ticks[i] = 0;
+ 186:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    for(j = 0; j < NPROC; j++)
+ 18c:	31 c0                	xor    %eax,%eax
+ 18e:	eb 08                	jmp    198 <sample+0x38>
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	83 f8 40             	cmp    $0x40,%eax
+ 196:	74 38                	je     1d0 <sample+0x70>
+      if(st.inuse[j] && st.pid[j] == pid[i])
+ 198:	8b 14 85 40 15 00 00 	mov    0x1540(,%eax,4),%edx
+ 19f:	85 d2                	test   %edx,%edx
+ 1a1:	74 ed                	je     190 <sample+0x30>
+ 1a3:	8b 3b                	mov    (%ebx),%edi
+ 1a5:	39 3c 85 40 16 00 00 	cmp    %edi,0x1640(,%eax,4)
+ 1ac:	75 e2                	jne    190 <sample+0x30>
+ 1ae:	89 c7                	mov    %eax,%edi
+          ticks[i] += st.ticks[j][k];
+ 1b0:	8b 0e                	mov    (%esi),%ecx
+        for(k = 0; k < NMLFQ; k++)
+ 1b2:	31 d2                	xor    %edx,%edx
+ 1b4:	c1 e7 04             	shl    $0x4,%edi
+          ticks[i] += st.ticks[j][k];
+ 1b7:	03 8c 97 40 1c 00 00 	add    0x1c40(%edi,%edx,4),%ecx
+        for(k = 0; k < NMLFQ; k++)
+ 1be:	83 c2 01             	add    $0x1,%edx
+          ticks[i] += st.ticks[j][k];
+ 1c1:	89 0e                	mov    %ecx,(%esi)
+        for(k = 0; k < NMLFQ; k++)
+ 1c3:	83 fa 04             	cmp    $0x4,%edx
+ 1c6:	75 ef                	jne    1b7 <sample+0x57>
+    for(j = 0; j < NPROC; j++)
+ 1c8:	83 c0 01             	add    $0x1,%eax
+ 1cb:	83 f8 40             	cmp    $0x40,%eax
+ 1ce:	75 c8                	jne    198 <sample+0x38>
+  for(i = 0; i < NSPIN; i++){
+ 1d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 1d3:	83 c3 04             	add    $0x4,%ebx
+ 1d6:	83 c6 04             	add    $0x4,%esi
+ 1d9:	39 c3                	cmp    %eax,%ebx
+ 1db:	75 a9                	jne    186 <sample+0x26>
+}
+ 1dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1e0:	5b                   	pop    %ebx
+ 1e1:	5e                   	pop    %esi
+ 1e2:	5f                   	pop    %edi
+ 1e3:	5d                   	pop    %ebp
+ 1e4:	c3                   	ret
+    printf(2, "stridebench: getpinfo failed\n");
+ 1e5:	51                   	push   %ecx
+ 1e6:	51                   	push   %ecx
+ 1e7:	68 90 0f 00 00       	push   $0xf90
+ 1ec:	6a 02                	push   $0x2
+ 1ee:	e8 bd 09 00 00       	call   bb0 <printf>
+    exit();
+ 1f3:	e8 4f 05 00 00       	call   747 <exit>
+ 1f8:	66 90                	xchg   %ax,%ax
+ 1fa:	66 90                	xchg   %ax,%ax
+ 1fc:	66 90                	xchg   %ax,%ax
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 200:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 201:	31 c0                	xor    %eax,%eax
+{
+ 203:	89 e5                	mov    %esp,%ebp
+ 205:	53                   	push   %ebx
+ 206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 20c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 210:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 214:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 217:	83 c0 01             	add    $0x1,%eax
+ 21a:	84 d2                	test   %dl,%dl
+ 21c:	75 f2                	jne    210 <strcpy+0x10>
+    ;
+  return os;
+}
+ 21e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 221:	89 c8                	mov    %ecx,%eax
+ 223:	c9                   	leave
+ 224:	c3                   	ret
+ 225:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000230 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+ 237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 23a:	0f b6 02             	movzbl (%edx),%eax
+ 23d:	84 c0                	test   %al,%al
+ 23f:	75 17                	jne    258 <strcmp+0x28>
+ 241:	eb 3a                	jmp    27d <strcmp+0x4d>
+ 243:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 247:	90                   	nop
+ 248:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 24c:	83 c2 01             	add    $0x1,%edx
+ 24f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 252:	84 c0                	test   %al,%al
+ 254:	74 1a                	je     270 <strcmp+0x40>
+    p++, q++;
+ 256:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 258:	0f b6 19             	movzbl (%ecx),%ebx
+ 25b:	38 c3                	cmp    %al,%bl
+ 25d:	74 e9                	je     248 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 25f:	29 d8                	sub    %ebx,%eax
+}
+ 261:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 264:	c9                   	leave
+ 265:	c3                   	ret
+ 266:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 270:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 274:	31 c0                	xor    %eax,%eax
+ 276:	29 d8                	sub    %ebx,%eax
+}
+ 278:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 27b:	c9                   	leave
+ 27c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 27d:	0f b6 19             	movzbl (%ecx),%ebx
+ 280:	31 c0                	xor    %eax,%eax
+ 282:	eb db                	jmp    25f <strcmp+0x2f>
+ 284:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+
+00000290 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 296:	80 3a 00             	cmpb   $0x0,(%edx)
+ 299:	74 15                	je     2b0 <strlen+0x20>
+ 29b:	31 c0                	xor    %eax,%eax
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+ 2a0:	83 c0 01             	add    $0x1,%eax
+ 2a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2a7:	89 c1                	mov    %eax,%ecx
+ 2a9:	75 f5                	jne    2a0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2ab:	89 c8                	mov    %ecx,%eax
+ 2ad:	5d                   	pop    %ebp
+ 2ae:	c3                   	ret
+ 2af:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2b0:	31 c9                	xor    %ecx,%ecx
+}
+ 2b2:	5d                   	pop    %ebp
+ 2b3:	89 c8                	mov    %ecx,%eax
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	57                   	push   %edi
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2cd:	89 d7                	mov    %edx,%edi
+ 2cf:	fc                   	cld
+ 2d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2d5:	89 d0                	mov    %edx,%eax
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ea:	0f b6 10             	movzbl (%eax),%edx
+ 2ed:	84 d2                	test   %dl,%dl
+ 2ef:	75 12                	jne    303 <strchr+0x23>
+ 2f1:	eb 1d                	jmp    310 <strchr+0x30>
+ 2f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2f7:	90                   	nop
+ 2f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2fc:	83 c0 01             	add    $0x1,%eax
+ 2ff:	84 d2                	test   %dl,%dl
+ 301:	74 0d                	je     310 <strchr+0x30>
+    if(*s == c)
+ 303:	38 d1                	cmp    %dl,%cl
+ 305:	75 f1                	jne    2f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 310:	31 c0                	xor    %eax,%eax
+}
+ 312:	5d                   	pop    %ebp
+ 313:	c3                   	ret
+ 314:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 325:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 328:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 329:	31 db                	xor    %ebx,%ebx
+{
+ 32b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 32e:	eb 27                	jmp    357 <gets+0x37>
+    cc = read(0, &c, 1);
+ 330:	83 ec 04             	sub    $0x4,%esp
+ 333:	6a 01                	push   $0x1
+ 335:	56                   	push   %esi
+ 336:	6a 00                	push   $0x0
+ 338:	e8 58 04 00 00       	call   795 <read>
+    if(cc < 1)
+ 33d:	83 c4 10             	add    $0x10,%esp
+ 340:	85 c0                	test   %eax,%eax
+ 342:	7e 1d                	jle    361 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 344:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 34f:	3c 0a                	cmp    $0xa,%al
+ 351:	74 10                	je     363 <gets+0x43>
+ 353:	3c 0d                	cmp    $0xd,%al
+ 355:	74 0c                	je     363 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 357:	89 df                	mov    %ebx,%edi
+ 359:	83 c3 01             	add    $0x1,%ebx
+ 35c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 35f:	7c cf                	jl     330 <gets+0x10>
+ 361:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 36a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 36d:	5b                   	pop    %ebx
+ 36e:	5e                   	pop    %esi
+ 36f:	5f                   	pop    %edi
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	56                   	push   %esi
+ 384:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 385:	83 ec 08             	sub    $0x8,%esp
+ 388:	6a 00                	push   $0x0
+ 38a:	ff 75 08             	push   0x8(%ebp)
+ 38d:	e8 85 04 00 00       	call   817 <open>
+  if(fd < 0)
+ 392:	83 c4 10             	add    $0x10,%esp
+ 395:	85 c0                	test   %eax,%eax
+ 397:	78 27                	js     3c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	ff 75 0c             	push   0xc(%ebp)
+ 39f:	89 c3                	mov    %eax,%ebx
+ 3a1:	50                   	push   %eax
+ 3a2:	e8 be 04 00 00       	call   865 <fstat>
+  close(fd);
+ 3a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3ac:	e8 18 04 00 00       	call   7c9 <close>
+  return r;
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3b7:	89 f0                	mov    %esi,%eax
+ 3b9:	5b                   	pop    %ebx
+ 3ba:	5e                   	pop    %esi
+ 3bb:	5d                   	pop    %ebp
+ 3bc:	c3                   	ret
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3c5:	eb ed                	jmp    3b4 <stat+0x34>
+ 3c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3d7:	0f be 02             	movsbl (%edx),%eax
+ 3da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3e5:	77 1e                	ja     405 <atoi+0x35>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3f0:	83 c2 01             	add    $0x1,%edx
+ 3f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3fa:	0f be 02             	movsbl (%edx),%eax
+ 3fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 400:	80 fb 09             	cmp    $0x9,%bl
+ 403:	76 eb                	jbe    3f0 <atoi+0x20>
+  return n;
+}
+ 405:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 408:	89 c8                	mov    %ecx,%eax
+ 40a:	c9                   	leave
+ 40b:	c3                   	ret
+ 40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	57                   	push   %edi
+ 414:	56                   	push   %esi
+ 415:	8b 45 10             	mov    0x10(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 41e:	85 c0                	test   %eax,%eax
+ 420:	7e 13                	jle    435 <memmove+0x25>
+ 422:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 424:	89 d7                	mov    %edx,%edi
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 430:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 431:	39 f8                	cmp    %edi,%eax
+ 433:	75 fb                	jne    430 <memmove+0x20>
+  return vdst;
+}
+ 435:	5e                   	pop    %esi
+ 436:	89 d0                	mov    %edx,%eax
+ 438:	5f                   	pop    %edi
+ 439:	5d                   	pop    %ebp
+ 43a:	c3                   	ret
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 44c:	5d                   	pop    %ebp
+ 44d:	c3                   	ret
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 450:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 451:	31 c0                	xor    %eax,%eax
+ 453:	ba 01 00 00 00       	mov    $0x1,%edx
+ 458:	89 e5                	mov    %esp,%ebp
+ 45a:	56                   	push   %esi
+ 45b:	53                   	push   %ebx
+ 45c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 45f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 463:	85 c0                	test   %eax,%eax
+ 465:	74 32                	je     499 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 467:	83 f8 02             	cmp    $0x2,%eax
+ 46a:	74 0c                	je     478 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 46c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 471:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 474:	85 c0                	test   %eax,%eax
+ 476:	74 21                	je     499 <mutex_lock+0x49>
+ 478:	be 02 00 00 00       	mov    $0x2,%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 02                	push   $0x2
+ 485:	6a 00                	push   $0x0
+ 487:	53                   	push   %ebx
+ 488:	e8 2a 05 00 00       	call   9b7 <futex>
+ 48d:	89 f0                	mov    %esi,%eax
+ 48f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	75 e7                	jne    480 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 499:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5d                   	pop    %ebp
+ 49f:	c3                   	ret
+
+000004a0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	31 c0                	xor    %eax,%eax
+ 4a3:	89 e5                	mov    %esp,%ebp
+ 4a5:	83 ec 08             	sub    $0x8,%esp
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 4ae:	83 f8 02             	cmp    $0x2,%eax
+ 4b1:	74 05                	je     4b8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 4b3:	c9                   	leave
+ 4b4:	c3                   	ret
+ 4b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4b8:	83 ec 04             	sub    $0x4,%esp
+ 4bb:	6a 01                	push   $0x1
+ 4bd:	6a 01                	push   $0x1
+ 4bf:	52                   	push   %edx
+ 4c0:	e8 f2 04 00 00       	call   9b7 <futex>
+ 4c5:	83 c4 10             	add    $0x10,%esp
+}
+ 4c8:	c9                   	leave
+ 4c9:	c3                   	ret
+ 4ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004d0 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4dc:	5d                   	pop    %ebp
+ 4dd:	c3                   	ret
+ 4de:	66 90                	xchg   %ax,%ax
+
+000004e0 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	31 c0                	xor    %eax,%eax
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	57                   	push   %edi
+ 4e6:	56                   	push   %esi
+ 4e7:	53                   	push   %ebx
+ 4e8:	83 ec 0c             	sub    $0xc,%esp
+ 4eb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 4f1:	8b 3e                	mov    (%esi),%edi
+ 4f3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 4f6:	83 f8 02             	cmp    $0x2,%eax
+ 4f9:	74 5d                	je     558 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 4fb:	83 ec 04             	sub    $0x4,%esp
+ 4fe:	57                   	push   %edi
+ 4ff:	6a 00                	push   $0x0
+ 501:	56                   	push   %esi
+ 502:	e8 b0 04 00 00       	call   9b7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 507:	31 c0                	xor    %eax,%eax
+ 509:	ba 01 00 00 00       	mov    $0x1,%edx
+ 50e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 512:	83 c4 10             	add    $0x10,%esp
+ 515:	85 c0                	test   %eax,%eax
+ 517:	74 30                	je     549 <cond_wait+0x69>
+  if(c != 2)
+ 519:	83 f8 02             	cmp    $0x2,%eax
+ 51c:	74 0c                	je     52a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 51e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 523:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 526:	85 c0                	test   %eax,%eax
+ 528:	74 1f                	je     549 <cond_wait+0x69>
+ 52a:	be 02 00 00 00       	mov    $0x2,%esi
+ 52f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	6a 02                	push   $0x2
+ 535:	6a 00                	push   $0x0
+ 537:	53                   	push   %ebx
+ 538:	e8 7a 04 00 00       	call   9b7 <futex>
+ 53d:	89 f0                	mov    %esi,%eax
+ 53f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	85 c0                	test   %eax,%eax
+ 547:	75 e7                	jne    530 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 549:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 54c:	5b                   	pop    %ebx
+ 54d:	5e                   	pop    %esi
+ 54e:	5f                   	pop    %edi
+ 54f:	5d                   	pop    %ebp
+ 550:	c3                   	ret
+ 551:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 558:	83 ec 04             	sub    $0x4,%esp
+ 55b:	6a 01                	push   $0x1
+ 55d:	6a 01                	push   $0x1
+ 55f:	53                   	push   %ebx
+ 560:	e8 52 04 00 00       	call   9b7 <futex>
+ 565:	83 c4 10             	add    $0x10,%esp
+ 568:	eb 91                	jmp    4fb <cond_wait+0x1b>
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000570 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	83 ec 04             	sub    $0x4,%esp
+ 577:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 580:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 582:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 585:	89 c8                	mov    %ecx,%eax
+ 587:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 58b:	39 c1                	cmp    %eax,%ecx
+ 58d:	75 f1                	jne    580 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 58f:	83 ec 04             	sub    $0x4,%esp
+ 592:	6a 01                	push   $0x1
+ 594:	6a 01                	push   $0x1
+ 596:	52                   	push   %edx
+ 597:	e8 1b 04 00 00       	call   9b7 <futex>
+}
+ 59c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 59f:	83 c4 10             	add    $0x10,%esp
+ 5a2:	c9                   	leave
+ 5a3:	c3                   	ret
+ 5a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5af:	90                   	nop
+
+000005b0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	53                   	push   %ebx
+ 5b4:	83 ec 04             	sub    $0x4,%esp
+ 5b7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 5c0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 5c2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 5c5:	89 c8                	mov    %ecx,%eax
+ 5c7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 5cb:	39 c1                	cmp    %eax,%ecx
+ 5cd:	75 f1                	jne    5c0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 5cf:	83 ec 04             	sub    $0x4,%esp
+ 5d2:	6a 40                	push   $0x40
+ 5d4:	6a 01                	push   $0x1
+ 5d6:	52                   	push   %edx
+ 5d7:	e8 db 03 00 00       	call   9b7 <futex>
+}
+ 5dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	c9                   	leave
+ 5e3:	c3                   	ret
+ 5e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+
+000005f0 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 5f0:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 5f5:	c3                   	ret
+ 5f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000600 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 600:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 605:	85 c0                	test   %eax,%eax
+ 607:	74 07                	je     610 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 609:	c3                   	ret
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 610:	e9 d2 02 00 00       	jmp    8e7 <getpid>
+ 615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	57                   	push   %edi
+ 624:	56                   	push   %esi
+ 625:	53                   	push   %ebx
+ 626:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 629:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 62b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 631:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 637:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 63c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 642:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 645:	89 d0                	mov    %edx,%eax
+ 647:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 64a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 650:	29 d9                	sub    %ebx,%ecx
+ 652:	89 c6                	mov    %eax,%esi
+ 654:	89 d7                	mov    %edx,%edi
+ 656:	0f a5 c7             	shld   %cl,%eax,%edi
+ 659:	d3 e6                	shl    %cl,%esi
+ 65b:	31 c0                	xor    %eax,%eax
+ 65d:	f6 c1 20             	test   $0x20,%cl
+ 660:	0f 45 fe             	cmovne %esi,%edi
+ 663:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 666:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 669:	89 d9                	mov    %ebx,%ecx
+ 66b:	31 db                	xor    %ebx,%ebx
+ 66d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 673:	0f ad d0             	shrd   %cl,%edx,%eax
+ 676:	d3 ea                	shr    %cl,%edx
+ 678:	f6 c1 20             	test   $0x20,%cl
+ 67b:	0f 45 c2             	cmovne %edx,%eax
+ 67e:	0f 45 d3             	cmovne %ebx,%edx
+ 681:	01 f0                	add    %esi,%eax
+ 683:	11 fa                	adc    %edi,%edx
+}
+ 685:	83 c4 0c             	add    $0xc,%esp
+ 688:	5b                   	pop    %ebx
+ 689:	5e                   	pop    %esi
+ 68a:	5f                   	pop    %edi
+ 68b:	5d                   	pop    %ebp
+ 68c:	c3                   	ret
+ 68d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000690 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	53                   	push   %ebx
+ 696:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 699:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 69d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 6a0:	74 0e                	je     6b0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 6a2:	83 c4 1c             	add    $0x1c,%esp
+ 6a5:	5b                   	pop    %ebx
+ 6a6:	5e                   	pop    %esi
+ 6a7:	5f                   	pop    %edi
+ 6a8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 6a9:	e9 a5 03 00 00       	jmp    a53 <clock_gettime>
+ 6ae:	66 90                	xchg   %ax,%ax
+ 6b0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 6b2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 6b8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 6be:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 6c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 6c6:	89 d0                	mov    %edx,%eax
+ 6c8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 6cb:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 6d1:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 6d7:	89 c6                	mov    %eax,%esi
+ 6d9:	89 d7                	mov    %edx,%edi
+ 6db:	0f a5 c7             	shld   %cl,%eax,%edi
+ 6de:	d3 e6                	shl    %cl,%esi
+ 6e0:	31 c0                	xor    %eax,%eax
+ 6e2:	f6 c1 20             	test   $0x20,%cl
+ 6e5:	0f 45 fe             	cmovne %esi,%edi
+ 6e8:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 6eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 6ee:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 6f5:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 6fb:	0f ad d0             	shrd   %cl,%edx,%eax
+ 6fe:	d3 ea                	shr    %cl,%edx
+ 700:	f6 c1 20             	test   $0x20,%cl
+ 703:	74 04                	je     709 <vclock_gettime+0x79>
+ 705:	89 d0                	mov    %edx,%eax
+ 707:	31 d2                	xor    %edx,%edx
+ 709:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 70b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 710:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 712:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 714:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 716:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 718:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 71e:	29 c1                	sub    %eax,%ecx
+}
+ 720:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 722:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 725:	83 c4 1c             	add    $0x1c,%esp
+ 728:	5b                   	pop    %ebx
+ 729:	5e                   	pop    %esi
+ 72a:	5f                   	pop    %edi
+ 72b:	5d                   	pop    %ebp
+ 72c:	c3                   	ret
+
+0000072d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 72d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 732:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 739:	74 09                	je     744 <fork+0x17>
+ 73b:	89 e1                	mov    %esp,%ecx
+ 73d:	ba 46 07 00 00       	mov    $0x746,%edx
+ 742:	0f 34                	sysenter
+ 744:	cd 40                	int    $0x40
+ 746:	c3                   	ret
+
+00000747 <exit>:
+SYSCALL(exit)
+ 747:	b8 02 00 00 00       	mov    $0x2,%eax
+ 74c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 753:	74 09                	je     75e <exit+0x17>
+ 755:	89 e1                	mov    %esp,%ecx
+ 757:	ba 60 07 00 00       	mov    $0x760,%edx
+ 75c:	0f 34                	sysenter
+ 75e:	cd 40                	int    $0x40
+ 760:	c3                   	ret
+
+00000761 <wait>:
+SYSCALL(wait)
+ 761:	b8 03 00 00 00       	mov    $0x3,%eax
+ 766:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 76d:	74 09                	je     778 <wait+0x17>
+ 76f:	89 e1                	mov    %esp,%ecx
+ 771:	ba 7a 07 00 00       	mov    $0x77a,%edx
+ 776:	0f 34                	sysenter
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <pipe>:
+SYSCALL(pipe)
+ 77b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 780:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 787:	74 09                	je     792 <pipe+0x17>
+ 789:	89 e1                	mov    %esp,%ecx
+ 78b:	ba 94 07 00 00       	mov    $0x794,%edx
+ 790:	0f 34                	sysenter
+ 792:	cd 40                	int    $0x40
+ 794:	c3                   	ret
+
+00000795 <read>:
+SYSCALL(read)
+ 795:	b8 05 00 00 00       	mov    $0x5,%eax
+ 79a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a1:	74 09                	je     7ac <read+0x17>
+ 7a3:	89 e1                	mov    %esp,%ecx
+ 7a5:	ba ae 07 00 00       	mov    $0x7ae,%edx
+ 7aa:	0f 34                	sysenter
+ 7ac:	cd 40                	int    $0x40
+ 7ae:	c3                   	ret
+
+000007af <write>:
+SYSCALL(write)
+ 7af:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7b4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7bb:	74 09                	je     7c6 <write+0x17>
+ 7bd:	89 e1                	mov    %esp,%ecx
+ 7bf:	ba c8 07 00 00       	mov    $0x7c8,%edx
+ 7c4:	0f 34                	sysenter
+ 7c6:	cd 40                	int    $0x40
+ 7c8:	c3                   	ret
+
+000007c9 <close>:
+SYSCALL(close)
+ 7c9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7ce:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d5:	74 09                	je     7e0 <close+0x17>
+ 7d7:	89 e1                	mov    %esp,%ecx
+ 7d9:	ba e2 07 00 00       	mov    $0x7e2,%edx
+ 7de:	0f 34                	sysenter
+ 7e0:	cd 40                	int    $0x40
+ 7e2:	c3                   	ret
+
+000007e3 <kill>:
+SYSCALL(kill)
+ 7e3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7e8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ef:	74 09                	je     7fa <kill+0x17>
+ 7f1:	89 e1                	mov    %esp,%ecx
+ 7f3:	ba fc 07 00 00       	mov    $0x7fc,%edx
+ 7f8:	0f 34                	sysenter
+ 7fa:	cd 40                	int    $0x40
+ 7fc:	c3                   	ret
+
+000007fd <exec>:
+SYSCALL(exec)
+ 7fd:	b8 07 00 00 00       	mov    $0x7,%eax
+ 802:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 809:	74 09                	je     814 <exec+0x17>
+ 80b:	89 e1                	mov    %esp,%ecx
+ 80d:	ba 16 08 00 00       	mov    $0x816,%edx
+ 812:	0f 34                	sysenter
+ 814:	cd 40                	int    $0x40
+ 816:	c3                   	ret
+
+00000817 <open>:
+SYSCALL(open)
+ 817:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 81c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 823:	74 09                	je     82e <open+0x17>
+ 825:	89 e1                	mov    %esp,%ecx
+ 827:	ba 30 08 00 00       	mov    $0x830,%edx
+ 82c:	0f 34                	sysenter
+ 82e:	cd 40                	int    $0x40
+ 830:	c3                   	ret
+
+00000831 <mknod>:
+SYSCALL(mknod)
+ 831:	b8 11 00 00 00       	mov    $0x11,%eax
+ 836:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 83d:	74 09                	je     848 <mknod+0x17>
+ 83f:	89 e1                	mov    %esp,%ecx
+ 841:	ba 4a 08 00 00       	mov    $0x84a,%edx
+ 846:	0f 34                	sysenter
+ 848:	cd 40                	int    $0x40
+ 84a:	c3                   	ret
+
+0000084b <unlink>:
+SYSCALL(unlink)
+ 84b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 850:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 857:	74 09                	je     862 <unlink+0x17>
+ 859:	89 e1                	mov    %esp,%ecx
+ 85b:	ba 64 08 00 00       	mov    $0x864,%edx
+ 860:	0f 34                	sysenter
+ 862:	cd 40                	int    $0x40
+ 864:	c3                   	ret
+
+00000865 <fstat>:
+SYSCALL(fstat)
+ 865:	b8 08 00 00 00       	mov    $0x8,%eax
+ 86a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 871:	74 09                	je     87c <fstat+0x17>
+ 873:	89 e1                	mov    %esp,%ecx
+ 875:	ba 7e 08 00 00       	mov    $0x87e,%edx
+ 87a:	0f 34                	sysenter
+ 87c:	cd 40                	int    $0x40
+ 87e:	c3                   	ret
+
+0000087f <link>:
+SYSCALL(link)
+ 87f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 884:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 88b:	74 09                	je     896 <link+0x17>
+ 88d:	89 e1                	mov    %esp,%ecx
+ 88f:	ba 98 08 00 00       	mov    $0x898,%edx
+ 894:	0f 34                	sysenter
+ 896:	cd 40                	int    $0x40
+ 898:	c3                   	ret
+
+00000899 <mkdir>:
+SYSCALL(mkdir)
+ 899:	b8 14 00 00 00       	mov    $0x14,%eax
+ 89e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a5:	74 09                	je     8b0 <mkdir+0x17>
+ 8a7:	89 e1                	mov    %esp,%ecx
+ 8a9:	ba b2 08 00 00       	mov    $0x8b2,%edx
+ 8ae:	0f 34                	sysenter
+ 8b0:	cd 40                	int    $0x40
+ 8b2:	c3                   	ret
+
+000008b3 <chdir>:
+SYSCALL(chdir)
+ 8b3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8b8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8bf:	74 09                	je     8ca <chdir+0x17>
+ 8c1:	89 e1                	mov    %esp,%ecx
+ 8c3:	ba cc 08 00 00       	mov    $0x8cc,%edx
+ 8c8:	0f 34                	sysenter
+ 8ca:	cd 40                	int    $0x40
+ 8cc:	c3                   	ret
+
+000008cd <dup>:
+SYSCALL(dup)
+ 8cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8d9:	74 09                	je     8e4 <dup+0x17>
+ 8db:	89 e1                	mov    %esp,%ecx
+ 8dd:	ba e6 08 00 00       	mov    $0x8e6,%edx
+ 8e2:	0f 34                	sysenter
+ 8e4:	cd 40                	int    $0x40
+ 8e6:	c3                   	ret
+
+000008e7 <getpid>:
+SYSCALL(getpid)
+ 8e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f3:	74 09                	je     8fe <getpid+0x17>
+ 8f5:	89 e1                	mov    %esp,%ecx
+ 8f7:	ba 00 09 00 00       	mov    $0x900,%edx
+ 8fc:	0f 34                	sysenter
+ 8fe:	cd 40                	int    $0x40
+ 900:	c3                   	ret
+
+00000901 <sbrk>:
+SYSCALL(sbrk)
+ 901:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 906:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 90d:	74 09                	je     918 <sbrk+0x17>
+ 90f:	89 e1                	mov    %esp,%ecx
+ 911:	ba 1a 09 00 00       	mov    $0x91a,%edx
+ 916:	0f 34                	sysenter
+ 918:	cd 40                	int    $0x40
+ 91a:	c3                   	ret
+
+0000091b <sleep>:
+SYSCALL(sleep)
+ 91b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 920:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 927:	74 09                	je     932 <sleep+0x17>
+ 929:	89 e1                	mov    %esp,%ecx
+ 92b:	ba 34 09 00 00       	mov    $0x934,%edx
+ 930:	0f 34                	sysenter
+ 932:	cd 40                	int    $0x40
+ 934:	c3                   	ret
+
+00000935 <uptime>:
+SYSCALL(uptime)
+ 935:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 93a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 941:	74 09                	je     94c <uptime+0x17>
+ 943:	89 e1                	mov    %esp,%ecx
+ 945:	ba 4e 09 00 00       	mov    $0x94e,%edx
+ 94a:	0f 34                	sysenter
+ 94c:	cd 40                	int    $0x40
+ 94e:	c3                   	ret
+
+0000094f <mmap>:
+SYSCALL(mmap)
+ 94f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 954:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 95b:	74 09                	je     966 <mmap+0x17>
+ 95d:	89 e1                	mov    %esp,%ecx
+ 95f:	ba 68 09 00 00       	mov    $0x968,%edx
+ 964:	0f 34                	sysenter
+ 966:	cd 40                	int    $0x40
+ 968:	c3                   	ret
+
+00000969 <munmap>:
+SYSCALL(munmap)
+ 969:	b8 17 00 00 00       	mov    $0x17,%eax
+ 96e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 975:	74 09                	je     980 <munmap+0x17>
+ 977:	89 e1                	mov    %esp,%ecx
+ 979:	ba 82 09 00 00       	mov    $0x982,%edx
+ 97e:	0f 34                	sysenter
+ 980:	cd 40                	int    $0x40
+ 982:	c3                   	ret
+
+00000983 <clone>:
+SYSCALL(clone)
+ 983:	b8 18 00 00 00       	mov    $0x18,%eax
+ 988:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 98f:	74 09                	je     99a <clone+0x17>
+ 991:	89 e1                	mov    %esp,%ecx
+ 993:	ba 9c 09 00 00       	mov    $0x99c,%edx
+ 998:	0f 34                	sysenter
+ 99a:	cd 40                	int    $0x40
+ 99c:	c3                   	ret
+
+0000099d <join>:
+SYSCALL(join)
+ 99d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9a9:	74 09                	je     9b4 <join+0x17>
+ 9ab:	89 e1                	mov    %esp,%ecx
+ 9ad:	ba b6 09 00 00       	mov    $0x9b6,%edx
+ 9b2:	0f 34                	sysenter
+ 9b4:	cd 40                	int    $0x40
+ 9b6:	c3                   	ret
+
+000009b7 <futex>:
+SYSCALL(futex)
+ 9b7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9c3:	74 09                	je     9ce <futex+0x17>
+ 9c5:	89 e1                	mov    %esp,%ecx
+ 9c7:	ba d0 09 00 00       	mov    $0x9d0,%edx
+ 9cc:	0f 34                	sysenter
+ 9ce:	cd 40                	int    $0x40
+ 9d0:	c3                   	ret
+
+000009d1 <memstat>:
+SYSCALL(memstat)
+ 9d1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9dd:	74 09                	je     9e8 <memstat+0x17>
+ 9df:	89 e1                	mov    %esp,%ecx
+ 9e1:	ba ea 09 00 00       	mov    $0x9ea,%edx
+ 9e6:	0f 34                	sysenter
+ 9e8:	cd 40                	int    $0x40
+ 9ea:	c3                   	ret
+
+000009eb <nice>:
+SYSCALL(nice)
+ 9eb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 9f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9f7:	74 09                	je     a02 <nice+0x17>
+ 9f9:	89 e1                	mov    %esp,%ecx
+ 9fb:	ba 04 0a 00 00       	mov    $0xa04,%edx
+ a00:	0f 34                	sysenter
+ a02:	cd 40                	int    $0x40
+ a04:	c3                   	ret
+
+00000a05 <setpriority>:
+SYSCALL(setpriority)
+ a05:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a0a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a11:	74 09                	je     a1c <setpriority+0x17>
+ a13:	89 e1                	mov    %esp,%ecx
+ a15:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+ a1a:	0f 34                	sysenter
+ a1c:	cd 40                	int    $0x40
+ a1e:	c3                   	ret
+
+00000a1f <getpinfo>:
+SYSCALL(getpinfo)
+ a1f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a24:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a2b:	74 09                	je     a36 <getpinfo+0x17>
+ a2d:	89 e1                	mov    %esp,%ecx
+ a2f:	ba 38 0a 00 00       	mov    $0xa38,%edx
+ a34:	0f 34                	sysenter
+ a36:	cd 40                	int    $0x40
+ a38:	c3                   	ret
+
+00000a39 <settickets>:
+SYSCALL(settickets)
+ a39:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a3e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a45:	74 09                	je     a50 <settickets+0x17>
+ a47:	89 e1                	mov    %esp,%ecx
+ a49:	ba 52 0a 00 00       	mov    $0xa52,%edx
+ a4e:	0f 34                	sysenter
+ a50:	cd 40                	int    $0x40
+ a52:	c3                   	ret
+
+00000a53 <clock_gettime>:
+SYSCALL(clock_gettime)
+ a53:	b8 20 00 00 00       	mov    $0x20,%eax
+ a58:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a5f:	74 09                	je     a6a <clock_gettime+0x17>
+ a61:	89 e1                	mov    %esp,%ecx
+ a63:	ba 6c 0a 00 00       	mov    $0xa6c,%edx
+ a68:	0f 34                	sysenter
+ a6a:	cd 40                	int    $0x40
+ a6c:	c3                   	ret
+
+00000a6d <batch>:
+SYSCALL(batch)
+ a6d:	b8 21 00 00 00       	mov    $0x21,%eax
+ a72:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a79:	74 09                	je     a84 <batch+0x17>
+ a7b:	89 e1                	mov    %esp,%ecx
+ a7d:	ba 86 0a 00 00       	mov    $0xa86,%edx
+ a82:	0f 34                	sysenter
+ a84:	cd 40                	int    $0x40
+ a86:	c3                   	ret
+
+00000a87 <aiosetup>:
+SYSCALL(aiosetup)
+ a87:	b8 22 00 00 00       	mov    $0x22,%eax
+ a8c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a93:	74 09                	je     a9e <aiosetup+0x17>
+ a95:	89 e1                	mov    %esp,%ecx
+ a97:	ba a0 0a 00 00       	mov    $0xaa0,%edx
+ a9c:	0f 34                	sysenter
+ a9e:	cd 40                	int    $0x40
+ aa0:	c3                   	ret
+
+00000aa1 <aioenter>:
+SYSCALL(aioenter)
+ aa1:	b8 23 00 00 00       	mov    $0x23,%eax
+ aa6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ aad:	74 09                	je     ab8 <aioenter+0x17>
+ aaf:	89 e1                	mov    %esp,%ecx
+ ab1:	ba ba 0a 00 00       	mov    $0xaba,%edx
+ ab6:	0f 34                	sysenter
+ ab8:	cd 40                	int    $0x40
+ aba:	c3                   	ret
+
+00000abb <systrace>:
+SYSCALL(systrace)
+ abb:	b8 24 00 00 00       	mov    $0x24,%eax
+ ac0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ ac7:	74 09                	je     ad2 <systrace+0x17>
+ ac9:	89 e1                	mov    %esp,%ecx
+ acb:	ba d4 0a 00 00       	mov    $0xad4,%edx
+ ad0:	0f 34                	sysenter
+ ad2:	cd 40                	int    $0x40
+ ad4:	c3                   	ret
+
+00000ad5 <sysstat>:
+SYSCALL(sysstat)
+ ad5:	b8 25 00 00 00       	mov    $0x25,%eax
+ ada:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ ae1:	74 09                	je     aec <sysstat+0x17>
+ ae3:	89 e1                	mov    %esp,%ecx
+ ae5:	ba ee 0a 00 00       	mov    $0xaee,%edx
+ aea:	0f 34                	sysenter
+ aec:	cd 40                	int    $0x40
+ aee:	c3                   	ret
+
+00000aef <traceread>:
+SYSCALL(traceread)
+ aef:	b8 26 00 00 00       	mov    $0x26,%eax
+ af4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ afb:	74 09                	je     b06 <traceread+0x17>
+ afd:	89 e1                	mov    %esp,%ecx
+ aff:	ba 08 0b 00 00       	mov    $0xb08,%edx
+ b04:	0f 34                	sysenter
+ b06:	cd 40                	int    $0x40
+ b08:	c3                   	ret
+ b09:	66 90                	xchg   %ax,%ax
+ b0b:	66 90                	xchg   %ax,%ax
+ b0d:	66 90                	xchg   %ax,%ax
+ b0f:	90                   	nop
+
+00000b10 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ b18:	89 d1                	mov    %edx,%ecx
+{
+ b1a:	83 ec 3c             	sub    $0x3c,%esp
+ b1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ b20:	85 d2                	test   %edx,%edx
+ b22:	0f 89 80 00 00 00    	jns    ba8 <printint+0x98>
+ b28:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ b2c:	74 7a                	je     ba8 <printint+0x98>
+    x = -xx;
+ b2e:	f7 d9                	neg    %ecx
+    neg = 1;
+ b30:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ b35:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ b38:	31 f6                	xor    %esi,%esi
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ b40:	89 c8                	mov    %ecx,%eax
+ b42:	31 d2                	xor    %edx,%edx
+ b44:	89 f7                	mov    %esi,%edi
+ b46:	f7 f3                	div    %ebx
+ b48:	8d 76 01             	lea    0x1(%esi),%esi
+ b4b:	0f b6 92 6c 10 00 00 	movzbl 0x106c(%edx),%edx
+ b52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ b56:	89 ca                	mov    %ecx,%edx
+ b58:	89 c1                	mov    %eax,%ecx
+ b5a:	39 da                	cmp    %ebx,%edx
+ b5c:	73 e2                	jae    b40 <printint+0x30>
+  if(neg)
+ b5e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b61:	85 c0                	test   %eax,%eax
+ b63:	74 07                	je     b6c <printint+0x5c>
+    buf[i++] = '-';
+ b65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ b6a:	89 f7                	mov    %esi,%edi
+ b6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ b6f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ b72:	01 df                	add    %ebx,%edi
+ b74:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ b78:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ b7b:	83 ec 04             	sub    $0x4,%esp
+ b7e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ b81:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ b84:	6a 01                	push   $0x1
+ b86:	50                   	push   %eax
+ b87:	56                   	push   %esi
+ b88:	e8 22 fc ff ff       	call   7af <write>
+  while(--i >= 0)
+ b8d:	89 f8                	mov    %edi,%eax
+ b8f:	83 c4 10             	add    $0x10,%esp
+ b92:	83 ef 01             	sub    $0x1,%edi
+ b95:	39 d8                	cmp    %ebx,%eax
+ b97:	75 df                	jne    b78 <printint+0x68>
+}
+ b99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b9c:	5b                   	pop    %ebx
+ b9d:	5e                   	pop    %esi
+ b9e:	5f                   	pop    %edi
+ b9f:	5d                   	pop    %ebp
+ ba0:	c3                   	ret
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ ba8:	31 c0                	xor    %eax,%eax
+ baa:	eb 89                	jmp    b35 <printint+0x25>
+ bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000bb0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	57                   	push   %edi
+ bb4:	56                   	push   %esi
+ bb5:	53                   	push   %ebx
+ bb6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ bb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ bbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ bbf:	0f b6 1e             	movzbl (%esi),%ebx
+ bc2:	83 c6 01             	add    $0x1,%esi
+ bc5:	84 db                	test   %bl,%bl
+ bc7:	74 67                	je     c30 <printf+0x80>
+ bc9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ bcc:	31 d2                	xor    %edx,%edx
+ bce:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ bd1:	eb 34                	jmp    c07 <printf+0x57>
+ bd3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bd7:	90                   	nop
+ bd8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ bdb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ be0:	83 f8 25             	cmp    $0x25,%eax
+ be3:	74 18                	je     bfd <printf+0x4d>
+  write(fd, &c, 1);
+ be5:	83 ec 04             	sub    $0x4,%esp
+ be8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ beb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bee:	6a 01                	push   $0x1
+ bf0:	50                   	push   %eax
+ bf1:	57                   	push   %edi
+ bf2:	e8 b8 fb ff ff       	call   7af <write>
+ bf7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ bfa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ bfd:	0f b6 1e             	movzbl (%esi),%ebx
+ c00:	83 c6 01             	add    $0x1,%esi
+ c03:	84 db                	test   %bl,%bl
+ c05:	74 29                	je     c30 <printf+0x80>
+    c = fmt[i] & 0xff;
+ c07:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ c0a:	85 d2                	test   %edx,%edx
+ c0c:	74 ca                	je     bd8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ c0e:	83 fa 25             	cmp    $0x25,%edx
+ c11:	75 ea                	jne    bfd <printf+0x4d>
+      if(c == 'd'){
+ c13:	83 f8 25             	cmp    $0x25,%eax
+ c16:	0f 84 24 01 00 00    	je     d40 <printf+0x190>
+ c1c:	83 e8 63             	sub    $0x63,%eax
+ c1f:	83 f8 15             	cmp    $0x15,%eax
+ c22:	77 1c                	ja     c40 <printf+0x90>
+ c24:	ff 24 85 14 10 00 00 	jmp    *0x1014(,%eax,4)
+ c2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c2f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ c30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c33:	5b                   	pop    %ebx
+ c34:	5e                   	pop    %esi
+ c35:	5f                   	pop    %edi
+ c36:	5d                   	pop    %ebp
+ c37:	c3                   	ret
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+  write(fd, &c, 1);
+ c40:	83 ec 04             	sub    $0x4,%esp
+ c43:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c46:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ c4a:	6a 01                	push   $0x1
+ c4c:	52                   	push   %edx
+ c4d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ c50:	57                   	push   %edi
+ c51:	e8 59 fb ff ff       	call   7af <write>
+ c56:	83 c4 0c             	add    $0xc,%esp
+ c59:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ c5c:	6a 01                	push   $0x1
+ c5e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ c61:	52                   	push   %edx
+ c62:	57                   	push   %edi
+ c63:	e8 47 fb ff ff       	call   7af <write>
+        putc(fd, c);
+ c68:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c6b:	31 d2                	xor    %edx,%edx
+ c6d:	eb 8e                	jmp    bfd <printf+0x4d>
+ c6f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ c70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c73:	83 ec 0c             	sub    $0xc,%esp
+ c76:	b9 10 00 00 00       	mov    $0x10,%ecx
+ c7b:	8b 13                	mov    (%ebx),%edx
+ c7d:	6a 00                	push   $0x0
+ c7f:	89 f8                	mov    %edi,%eax
+        ap++;
+ c81:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ c84:	e8 87 fe ff ff       	call   b10 <printint>
+        ap++;
+ c89:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c8c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c8f:	31 d2                	xor    %edx,%edx
+ c91:	e9 67 ff ff ff       	jmp    bfd <printf+0x4d>
+ c96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c9d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ ca0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ ca3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ca5:	83 c0 04             	add    $0x4,%eax
+ ca8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ cab:	85 db                	test   %ebx,%ebx
+ cad:	0f 84 9d 00 00 00    	je     d50 <printf+0x1a0>
+        while(*s != 0){
+ cb3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ cb6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ cb8:	84 c0                	test   %al,%al
+ cba:	0f 84 3d ff ff ff    	je     bfd <printf+0x4d>
+ cc0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cc3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ cc6:	89 de                	mov    %ebx,%esi
+ cc8:	89 d3                	mov    %edx,%ebx
+ cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ cd0:	83 ec 04             	sub    $0x4,%esp
+ cd3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ cd6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ cd9:	6a 01                	push   $0x1
+ cdb:	53                   	push   %ebx
+ cdc:	57                   	push   %edi
+ cdd:	e8 cd fa ff ff       	call   7af <write>
+        while(*s != 0){
+ ce2:	0f b6 06             	movzbl (%esi),%eax
+ ce5:	83 c4 10             	add    $0x10,%esp
+ ce8:	84 c0                	test   %al,%al
+ cea:	75 e4                	jne    cd0 <printf+0x120>
+      state = 0;
+ cec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ cef:	31 d2                	xor    %edx,%edx
+ cf1:	e9 07 ff ff ff       	jmp    bfd <printf+0x4d>
+ cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cfd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ d00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ d03:	83 ec 0c             	sub    $0xc,%esp
+ d06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ d0b:	8b 13                	mov    (%ebx),%edx
+ d0d:	6a 01                	push   $0x1
+ d0f:	e9 6b ff ff ff       	jmp    c7f <printf+0xcf>
+ d14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ d18:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ d1b:	83 ec 04             	sub    $0x4,%esp
+ d1e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ d21:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ d23:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ d26:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ d29:	6a 01                	push   $0x1
+ d2b:	52                   	push   %edx
+ d2c:	57                   	push   %edi
+ d2d:	e8 7d fa ff ff       	call   7af <write>
+        ap++;
+ d32:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ d35:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ d38:	31 d2                	xor    %edx,%edx
+ d3a:	e9 be fe ff ff       	jmp    bfd <printf+0x4d>
+ d3f:	90                   	nop
+  write(fd, &c, 1);
+ d40:	83 ec 04             	sub    $0x4,%esp
+ d43:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ d46:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ d49:	6a 01                	push   $0x1
+ d4b:	e9 11 ff ff ff       	jmp    c61 <printf+0xb1>
+ d50:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ d55:	bb 0a 10 00 00       	mov    $0x100a,%ebx
+ d5a:	e9 61 ff ff ff       	jmp    cc0 <printf+0x110>
+ d5f:	90                   	nop
+
+00000d60 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d60:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d61:	a1 40 20 00 00       	mov    0x2040,%eax
+{
+ d66:	89 e5                	mov    %esp,%ebp
+ d68:	57                   	push   %edi
+ d69:	56                   	push   %esi
+ d6a:	53                   	push   %ebx
+ d6b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ d6e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d78:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d7a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d7c:	39 ca                	cmp    %ecx,%edx
+ d7e:	73 30                	jae    db0 <free+0x50>
+ d80:	39 c1                	cmp    %eax,%ecx
+ d82:	72 04                	jb     d88 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d84:	39 c2                	cmp    %eax,%edx
+ d86:	72 f0                	jb     d78 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d88:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d8b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d8e:	39 f8                	cmp    %edi,%eax
+ d90:	74 2e                	je     dc0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d92:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d95:	8b 42 04             	mov    0x4(%edx),%eax
+ d98:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d9b:	39 f1                	cmp    %esi,%ecx
+ d9d:	74 38                	je     dd7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d9f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ da1:	5b                   	pop    %ebx
+  freep = p;
+ da2:	89 15 40 20 00 00    	mov    %edx,0x2040
+}
+ da8:	5e                   	pop    %esi
+ da9:	5f                   	pop    %edi
+ daa:	5d                   	pop    %ebp
+ dab:	c3                   	ret
+ dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ db0:	39 c1                	cmp    %eax,%ecx
+ db2:	72 d0                	jb     d84 <free+0x24>
+ db4:	eb c2                	jmp    d78 <free+0x18>
+ db6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dbd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ dc0:	03 70 04             	add    0x4(%eax),%esi
+ dc3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dc6:	8b 02                	mov    (%edx),%eax
+ dc8:	8b 00                	mov    (%eax),%eax
+ dca:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ dcd:	8b 42 04             	mov    0x4(%edx),%eax
+ dd0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ dd3:	39 f1                	cmp    %esi,%ecx
+ dd5:	75 c8                	jne    d9f <free+0x3f>
+    p->s.size += bp->s.size;
+ dd7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ dda:	89 15 40 20 00 00    	mov    %edx,0x2040
+    p->s.size += bp->s.size;
+ de0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ de3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ de6:	89 0a                	mov    %ecx,(%edx)
+}
+ de8:	5b                   	pop    %ebx
+ de9:	5e                   	pop    %esi
+ dea:	5f                   	pop    %edi
+ deb:	5d                   	pop    %ebp
+ dec:	c3                   	ret
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	57                   	push   %edi
+ df4:	56                   	push   %esi
+ df5:	53                   	push   %ebx
+ df6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ df9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ dfc:	8b 15 40 20 00 00    	mov    0x2040,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e02:	8d 78 07             	lea    0x7(%eax),%edi
+ e05:	c1 ef 03             	shr    $0x3,%edi
+ e08:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ e0b:	85 d2                	test   %edx,%edx
+ e0d:	0f 84 8d 00 00 00    	je     ea0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e13:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e15:	8b 48 04             	mov    0x4(%eax),%ecx
+ e18:	39 f9                	cmp    %edi,%ecx
+ e1a:	73 64                	jae    e80 <malloc+0x90>
+  if(nu < 4096)
+ e1c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ e21:	39 df                	cmp    %ebx,%edi
+ e23:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ e26:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ e2d:	eb 0a                	jmp    e39 <malloc+0x49>
+ e2f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e30:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ e32:	8b 48 04             	mov    0x4(%eax),%ecx
+ e35:	39 f9                	cmp    %edi,%ecx
+ e37:	73 47                	jae    e80 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ e39:	89 c2                	mov    %eax,%edx
+ e3b:	39 05 40 20 00 00    	cmp    %eax,0x2040
+ e41:	75 ed                	jne    e30 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ e43:	83 ec 0c             	sub    $0xc,%esp
+ e46:	56                   	push   %esi
+ e47:	e8 b5 fa ff ff       	call   901 <sbrk>
+  if(p == (char*)-1)
+ e4c:	83 c4 10             	add    $0x10,%esp
+ e4f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ e52:	74 1c                	je     e70 <malloc+0x80>
+  hp->s.size = nu;
+ e54:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ e57:	83 ec 0c             	sub    $0xc,%esp
+ e5a:	83 c0 08             	add    $0x8,%eax
+ e5d:	50                   	push   %eax
+ e5e:	e8 fd fe ff ff       	call   d60 <free>
+  return freep;
+ e63:	8b 15 40 20 00 00    	mov    0x2040,%edx
+      if((p = morecore(nunits)) == 0)
+ e69:	83 c4 10             	add    $0x10,%esp
+ e6c:	85 d2                	test   %edx,%edx
+ e6e:	75 c0                	jne    e30 <malloc+0x40>
+        return 0;
+  }
+}
+ e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ e73:	31 c0                	xor    %eax,%eax
+}
+ e75:	5b                   	pop    %ebx
+ e76:	5e                   	pop    %esi
+ e77:	5f                   	pop    %edi
+ e78:	5d                   	pop    %ebp
+ e79:	c3                   	ret
+ e7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e80:	39 cf                	cmp    %ecx,%edi
+ e82:	74 4c                	je     ed0 <malloc+0xe0>
+        p->s.size -= nunits;
+ e84:	29 f9                	sub    %edi,%ecx
+ e86:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e89:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e8c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e8f:	89 15 40 20 00 00    	mov    %edx,0x2040
+}
+ e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e98:	83 c0 08             	add    $0x8,%eax
+}
+ e9b:	5b                   	pop    %ebx
+ e9c:	5e                   	pop    %esi
+ e9d:	5f                   	pop    %edi
+ e9e:	5d                   	pop    %ebp
+ e9f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ea0:	c7 05 40 20 00 00 44 	movl   $0x2044,0x2040
+ ea7:	20 00 00 
+    base.s.size = 0;
+ eaa:	b8 44 20 00 00       	mov    $0x2044,%eax
+    base.s.ptr = freep = prevp = &base;
+ eaf:	c7 05 44 20 00 00 44 	movl   $0x2044,0x2044
+ eb6:	20 00 00 
+    base.s.size = 0;
+ eb9:	c7 05 48 20 00 00 00 	movl   $0x0,0x2048
+ ec0:	00 00 00 
+    if(p->s.size >= nunits){
+ ec3:	e9 54 ff ff ff       	jmp    e1c <malloc+0x2c>
+ ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ed0:	8b 08                	mov    (%eax),%ecx
+ ed2:	89 0a                	mov    %ecx,(%edx)
+ ed4:	eb b9                	jmp    e8f <malloc+0x9f>
+ ed6:	66 90                	xchg   %ax,%ax
+ ed8:	66 90                	xchg   %ax,%ax
+ eda:	66 90                	xchg   %ax,%ax
+ edc:	66 90                	xchg   %ax,%ax
+ ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ee0:	55                   	push   %ebp
+ ee1:	89 e5                	mov    %esp,%ebp
+ ee3:	53                   	push   %ebx
+ ee4:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ ee7:	68 00 20 00 00       	push   $0x2000
+ eec:	e8 ff fe ff ff       	call   df0 <malloc>
+ ef1:	83 c4 10             	add    $0x10,%esp
+ ef4:	85 c0                	test   %eax,%eax
+ ef6:	74 47                	je     f3f <thread_create+0x5f>
+ ef8:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ efa:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ f00:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ f03:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ f08:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ f0b:	ff 75 0c             	push   0xc(%ebp)
+ f0e:	50                   	push   %eax
+ f0f:	ff 75 08             	push   0x8(%ebp)
+ f12:	e8 6c fa ff ff       	call   983 <clone>
+ f17:	83 c4 10             	add    $0x10,%esp
+ f1a:	85 c0                	test   %eax,%eax
+ f1c:	78 0a                	js     f28 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ f1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f21:	c9                   	leave
+ f22:	c3                   	ret
+ f23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ f27:	90                   	nop
+    free(mem);
+ f28:	83 ec 0c             	sub    $0xc,%esp
+ f2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f2e:	53                   	push   %ebx
+ f2f:	e8 2c fe ff ff       	call   d60 <free>
+ f34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f37:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ f3a:	83 c4 10             	add    $0x10,%esp
+}
+ f3d:	c9                   	leave
+ f3e:	c3                   	ret
+    return -1;
+ f3f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f44:	eb d8                	jmp    f1e <thread_create+0x3e>
+ f46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ f4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000f50 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ f50:	55                   	push   %ebp
+ f51:	89 e5                	mov    %esp,%ebp
+ f53:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ f54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ f57:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ f5a:	50                   	push   %eax
+ f5b:	e8 3d fa ff ff       	call   99d <join>
+ f60:	83 c4 10             	add    $0x10,%esp
+ f63:	85 c0                	test   %eax,%eax
+ f65:	78 21                	js     f88 <thread_join+0x38>
+ f67:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ f69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f6c:	83 ec 0c             	sub    $0xc,%esp
+ f6f:	ff 70 fc             	push   -0x4(%eax)
+ f72:	e8 e9 fd ff ff       	call   d60 <free>
+  return pid;
+ f77:	83 c4 10             	add    $0x10,%esp
+}
+ f7a:	89 d8                	mov    %ebx,%eax
+ f7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ f7f:	c9                   	leave
+ f80:	c3                   	ret
+ f81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ f88:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ f8d:	eb eb                	jmp    f7a <thread_join+0x2a>
@@ -0,0 +1,79 @@
+// Stride scheduling benchmark.
+// Starts three CPU-bound processes holding tickets in the ratio
+// 1:2:3, lets them compete for T ticks, and reports the ticks each
+// one ran, from getpinfo(), relative to the first.  Shares are
+// kept per CPU, so run it with CPUS=1 to see the 100:200:300 split.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+
+#define NSPIN 3
+#define T     500
+
+struct pstat st;
+
+// Total ticks run so far by each of the NSPIN processes in pid[].
+void
+sample(int *pid, uint *ticks)
+{
+  int i, j, k;
+
+  if(getpinfo(&st) < 0){
+    printf(2, "stridebench: getpinfo failed\n");
+    exit();
+  }
+  for(i = 0; i < NSPIN; i++){
+    ticks[i] = 0;
+    for(j = 0; j < NPROC; j++)
+      if(st.inuse[j] && st.pid[j] == pid[i])
+        for(k = 0; k < NMLFQ; k++)
+          ticks[i] += st.ticks[j][k];
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, t, pid[NSPIN];
+  uint t0[NSPIN], t1[NSPIN];
+  volatile int x;
+
+  t = T;
+  if(argc > 1)
+    t = atoi(argv[1]);
+
+  for(i = 0; i < NSPIN; i++){
+    pid[i] = fork();
+    if(pid[i] < 0){
+      printf(2, "stridebench: fork failed\n");
+      exit();
+    }
+    if(pid[i] == 0){
+      settickets(100 * (i + 1));
+      for(x = 0;; x++)
+        ;
+    }
+  }
+
+  // Let the spinners settle into the stride class first.
+  sleep(10);
+  sample(pid, t0);
+  sleep(t);
+  sample(pid, t1);
+
+  for(i = 0; i < NSPIN; i++){
+    kill(pid[i]);
+    wait();
+  }
+
+  for(i = 0; i < NSPIN; i++)
+    t1[i] -= t0[i];
+  printf(1, "stridebench: %d ticks\n", t);
+  for(i = 0; i < NSPIN; i++)
+    printf(1, "  pid %d: %d tickets, %d ticks, ratio %d\n", pid[i],
+           100 * (i + 1), t1[i], t1[0] ? t1[i] * 100 / t1[0] : 0);
+  exit();
+}
@@ -6,8 +6,12 @@
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "batch.h"
 
-// User code makes a system call with INT T_SYSCALL.
+// User code makes a system call with sysenter, when the CPU
+// has it, or else with INT T_SYSCALL (see usys.S).  Either way
+// syscall() is called with the same trap frame: from trap(), or
+// from sysentertrap() via sysentry in trapasm.S.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
@@ -105,6 +109,21 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_mmap(void);
 extern int sys_munmap(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex(void);
+extern int sys_memstat(void);
+extern int sys_nice(void);
+extern int sys_setpriority(void);
+extern int sys_getpinfo(void);
+extern int sys_settickets(void);
+extern int sys_clock_gettime(void);
+static int sys_batch(void);
+extern int sys_aiosetup(void);
+extern int sys_aioenter(void);
+extern int sys_systrace(void);
+extern int sys_sysstat(void);
+extern int sys_traceread(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,6 +149,21 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_mmap]    sys_mmap,
 [SYS_munmap]  sys_munmap,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex]   sys_futex,
+[SYS_memstat] sys_memstat,
+[SYS_nice]    sys_nice,
+[SYS_setpriority] sys_setpriority,
+[SYS_getpinfo] sys_getpinfo,
+[SYS_settickets] sys_settickets,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_batch]   sys_batch,
+[SYS_aiosetup] sys_aiosetup,
+[SYS_aioenter] sys_aioenter,
+[SYS_systrace] sys_systrace,
+[SYS_sysstat] sys_sysstat,
+[SYS_traceread] sys_traceread,
 };
 
 void
@@ -140,10 +174,68 @@ syscall(void)
 
   num = curproc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
-    curproc->tf->eax = syscalls[num]();
+    if(systracing)
+      curproc->tf->eax = systracecall(num, syscalls[num]);
+    else
+      curproc->tf->eax = syscalls[num]();
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
     curproc->tf->eax = -1;
   }
 }
+
+// Run n system calls described by the batchcall records at
+// calls[0..n-1], in order, in this one kernel entry, storing each
+// result in its record's ret.  The record's num word stands in
+// for the return address that the saved user %esp points at on a
+// normal system call, so pointing %esp at it lets argint() and the
+// rest fetch the record's args unchanged.  Calls that create or
+// replace processes or address spaces are refused with -1.
+// Returns the number of calls run.
+static int
+sys_batch(void)
+{
+  struct proc *curproc = myproc();
+  struct batchcall *calls, *c;
+  uint esp;
+  int n, flags, i, ret;
+
+  if(argint(1, &n) < 0 || argint(2, &flags) < 0 || n < 0)
+    return -1;
+  if(argptr(0, (void*)&calls, n*sizeof(*calls)) < 0)
+    return -1;
+
+  esp = curproc->tf->esp;
+  for(i = 0; i < n && !curproc->killed; i++){
+    c = &calls[i];
+    // An sbrk() earlier in the batch may have freed the records.
+    if((uint)(c + 1) > curproc->sz)
+      break;
+    switch(c->num){
+    case SYS_fork:
+    case SYS_exec:
+    case SYS_clone:
+    case SYS_batch:
+      ret = -1;
+      break;
+    default:
+      curproc->tf->esp = (uint)c;
+      curproc->tf->eax = c->num;
+      syscall();
+      ret = curproc->tf->eax;
+      break;
+    }
+    if((uint)(c + 1) > curproc->sz){
+      i++;
+      break;
+    }
+    c->ret = ret;
+    if(ret == -1 && (flags & BATCH_STOPERR)){
+      i++;
+      break;
+    }
+  }
+  curproc->tf->esp = esp;
+  return i;
+}
@@ -21,4 +21,19 @@
 #define SYS_mkdir  20
 #define SYS_close  21
 #define SYS_mmap   22
-#define SYS_munmap 23
\ No newline at end of file
+#define SYS_munmap 23
+#define SYS_clone  24
+#define SYS_join   25
+#define SYS_futex  26
+#define SYS_memstat 27
+#define SYS_nice   28
+#define SYS_setpriority 29
+#define SYS_getpinfo 30
+#define SYS_settickets 31
+#define SYS_clock_gettime 32
+#define SYS_batch  33
+#define SYS_aiosetup 34
+#define SYS_aioenter 35
+#define SYS_systrace 36
+#define SYS_sysstat 37
+#define SYS_traceread 38
@@ -231,6 +231,8 @@ sys_unlink(void)
 
   ip->nlink--;
   iupdate(ip);
+  if(ip->nlink == 0)
+    excacheinval(ip->dev, ip->inum);
   iunlockput(ip);
 
   end_op();
@@ -521,4 +523,20 @@ sys_munmap(void)
   }
 
   return do_munmap(addrInt, length);
-}
\ No newline at end of file
+}
+
+int
+sys_aiosetup(void)
+{
+  return aiosetup();
+}
+
+int
+sys_aioenter(void)
+{
+  int n, minwait;
+
+  if(argint(0, &n) < 0 || argint(1, &minwait) < 0)
+    return -1;
+  return aioenter(n, minwait);
+}
@@ -5,6 +5,11 @@
 #include "param.h"
 #include "mmu.h"
 #include "proc.h"
+#include "futex.h"
+#include "memstat.h"
+#include "pstat.h"
+#include "clock.h"
+#include "systrace.h"
 
 
 int
@@ -26,6 +31,93 @@ sys_wait(void)
   return wait();
 }
 
+int
+sys_clone(void)
+{
+  int fn, stack, arg;
+
+  if(argint(0, &fn) < 0 || argint(1, &stack) < 0 || argint(2, &arg) < 0)
+    return -1;
+  return clone((void(*)(void*))fn, (void*)stack, (void*)arg);
+}
+
+int
+sys_join(void)
+{
+  char *stack;
+
+  if(argptr(0, &stack, sizeof(void*)) < 0)
+    return -1;
+  return join((void**)stack);
+}
+
+int
+sys_futex(void)
+{
+  int addr, op, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(addr, val);
+  case FUTEX_WAKE:
+    return futexwake(addr, val);
+  }
+  return -1;
+}
+
+int
+sys_memstat(void)
+{
+  struct memstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  kmemstat(st);
+  return 0;
+}
+
+int
+sys_nice(void)
+{
+  int incr;
+
+  if(argint(0, &incr) < 0)
+    return -1;
+  return nice(incr);
+}
+
+int
+sys_setpriority(void)
+{
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(1, &n) < 0)
+    return -1;
+  return setpriority(pid, n);
+}
+
+int
+sys_settickets(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return settickets(n);
+}
+
+int
+sys_getpinfo(void)
+{
+  struct pstat *st;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return getpinfo(st);
+}
+
 int
 sys_kill(void)
 {
@@ -60,23 +152,66 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
+  if(n < 0)
+    n = 0;
+  return sleepticks(n);
+}
+
+int
+sys_clock_gettime(void)
+{
+  int clk;
+  struct timespec *ts;
+
+  if(argint(0, &clk) < 0 || argptr(1, (void*)&ts, sizeof(*ts)) < 0)
+    return -1;
+  if(clk != CLOCK_MONOTONIC)
+    return -1;
+  nssplit(nsecs(), &ts->tv_sec, &ts->tv_nsec);
   return 0;
 }
 
+int
+sys_systrace(void)
+{
+  int cmd, arg;
+
+  if(argint(0, &cmd) < 0 || argint(1, &arg) < 0)
+    return -1;
+  return systrace(cmd, arg);
+}
+
+int
+sys_sysstat(void)
+{
+  int pid;
+  struct sysstat *st;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  return sysstat(pid, st);
+}
+
+int
+sys_traceread(void)
+{
+  int n;
+  struct traceent *buf;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  // No more than NTRACE entries are ever waiting; clamping first
+  // also keeps n*sizeof(*buf) from overflowing.
+  if(n > NTRACE)
+    n = NTRACE;
+  if(argptr(0, (void*)&buf, n*sizeof(*buf)) < 0)
+    return -1;
+  return traceread(buf, n);
+}
+
 // return how many clock tick interrupts have occurred
 // since start.
 int
@@ -0,0 +1,227 @@
+// System call statistics and tracing.
+//
+// systrace(ST_STATS, 1) makes syscall() time every call with the
+// TSC and count it by number and log2 latency, both for the
+// calling process, in a page allocated on its first counted call,
+// and system-wide, in per-CPU tables that sysstat(0, ...) sums.
+//
+// systrace(ST_TRACE, pid) records each call of pid, or of every
+// process, into a ring that traceread() drains.  The process that
+// turned tracing on is never traced, so reading the ring does not
+// fill it, and tracing stops when it exits.
+//
+// With both off, syscall() tests only systracing.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "proc.h"
+#include "spinlock.h"
+#include "syscall.h"
+#include "systrace.h"
+
+#define TR_STATS 1   // systracing bit: counting calls
+#define TR_TRACE 2   // systracing bit: recording calls into the ring
+
+int systracing;
+
+static struct sysstat cpustat[NCPU];
+
+static struct {
+  struct spinlock lock;        // protects all but cpustat; sets systracing
+  struct traceent ent[NTRACE];
+  uint seq;                    // next entry to record
+  uint rseq;                   // next entry to read
+  int pid;                     // traced process, or 0 for all
+  int tracer;                  // process reading the ring
+} trace;
+
+void
+systraceinit(void)
+{
+  initlock(&trace.lock, "trace");
+}
+
+static int
+traced(struct proc *p)
+{
+  return (systracing & TR_TRACE) && p->pid != trace.tracer &&
+         (trace.pid == 0 || trace.pid == p->pid);
+}
+
+// Record a call in the ring, overwriting the oldest entry
+// if the reader has fallen behind.
+static void
+record(struct proc *p, int num, int *args, int ret, uint64 cycles)
+{
+  struct traceent *e;
+  int i;
+
+  acquire(&trace.lock);
+  if(traced(p)){
+    e = &trace.ent[trace.seq % NTRACE];
+    e->seq = trace.seq++;
+    e->pid = p->pid;
+    e->num = num;
+    for(i = 0; i < TRACE_NARG; i++)
+      e->args[i] = args[i];
+    e->ret = ret;
+    e->cycles = cycles >> 32 ? ~0 : cycles;
+    if(trace.seq - trace.rseq > NTRACE)
+      trace.rseq = trace.seq - NTRACE;
+    wakeup(&trace);
+  }
+  release(&trace.lock);
+}
+
+static int
+histbucket(uint64 cycles)
+{
+  int b;
+
+  if(cycles >> 32)
+    return NSYSHIST - 1;
+  if((uint)cycles == 0)
+    return 0;
+  b = 31 - __builtin_clz((uint)cycles);
+  return b < NSYSHIST ? b : NSYSHIST - 1;
+}
+
+// Run system call num, which is fn, for syscall() and account
+// for it.  Called only while systracing is set.
+int
+systracecall(int num, int (*fn)(void))
+{
+  struct proc *p = myproc();
+  struct sysstat *st;
+  uint64 t;
+  int args[TRACE_NARG], ret, i, b, tr;
+
+  if(num >= NSYSCALL)
+    return fn();
+  // Fetch the arguments first: the call may change the stack.
+  if((tr = traced(p)) != 0)
+    for(i = 0; i < TRACE_NARG; i++)
+      if(argint(i, &args[i]) < 0)
+        args[i] = 0;
+  t = rdtsc();
+  ret = fn();
+  t = rdtsc() - t;
+
+  if(systracing & TR_STATS){
+    b = histbucket(t);
+    if(p->sysstat == 0 && (p->sysstat = (struct sysstat*)kalloc()) != 0)
+      memset(p->sysstat, 0, PGSIZE);
+    if((st = p->sysstat) != 0){
+      st->count[num]++;
+      st->hist[num][b]++;
+    }
+    pushcli();
+    st = &cpustat[cpuid()];
+    st->count[num]++;
+    st->hist[num][b]++;
+    popcli();
+  }
+  if(tr)
+    record(p, num, args, ret, t);
+  return ret;
+}
+
+// Called by exit(): record the exit, so that a tracer learns
+// of it, and stop tracing if p was the tracer.
+void
+systraceexit(struct proc *p)
+{
+  int args[TRACE_NARG];
+
+  if((systracing & TR_TRACE) == 0)
+    return;
+  memset(args, 0, sizeof(args));
+  record(p, SYS_exit, args, 0, 0);
+  acquire(&trace.lock);
+  if(p->pid == trace.tracer){
+    systracing &= ~TR_TRACE;
+    trace.tracer = 0;
+    wakeup(&trace);
+  }
+  release(&trace.lock);
+}
+
+// Carry out systrace() command cmd.  ST_STATS returns whether
+// calls were being counted; the others return 0.
+int
+systrace(int cmd, int arg)
+{
+  int r;
+
+  r = 0;
+  acquire(&trace.lock);
+  switch(cmd){
+  case ST_STATS:
+    r = (systracing & TR_STATS) != 0;
+    if(arg)
+      systracing |= TR_STATS;
+    else
+      systracing &= ~TR_STATS;
+    break;
+  case ST_RESET:
+    memset(cpustat, 0, sizeof(cpustat));
+    break;
+  case ST_TRACE:
+    if(arg < 0){
+      systracing &= ~TR_TRACE;
+      trace.tracer = 0;
+    } else {
+      trace.pid = arg;
+      trace.tracer = myproc()->pid;
+      trace.rseq = trace.seq;
+      systracing |= TR_TRACE;
+    }
+    wakeup(&trace);
+    break;
+  default:
+    r = -1;
+  }
+  release(&trace.lock);
+  return r;
+}
+
+// Copy the system-wide statistics, or those of process pid,
+// to st.  Returns -1 if there is no such process.
+int
+sysstat(int pid, struct sysstat *st)
+{
+  int c, i, j;
+
+  if(pid != 0)
+    return procsysstat(pid, st);
+  memset(st, 0, sizeof(*st));
+  for(c = 0; c < ncpu; c++){
+    for(i = 0; i < NSYSCALL; i++){
+      st->count[i] += cpustat[c].count[i];
+      for(j = 0; j < NSYSHIST; j++)
+        st->hist[i][j] += cpustat[c].hist[i][j];
+    }
+  }
+  return 0;
+}
+
+// Copy up to n trace entries to buf, waiting for at least one
+// while tracing is on.  Returns the number copied.
+int
+traceread(struct traceent *buf, int n)
+{
+  int i;
+
+  acquire(&trace.lock);
+  while(trace.rseq == trace.seq && (systracing & TR_TRACE) &&
+        !myproc()->killed)
+    sleep(&trace, &trace.lock);
+  for(i = 0; i < n && trace.rseq != trace.seq; i++)
+    buf[i] = trace.ent[trace.rseq++ % NTRACE];
+  release(&trace.lock);
+  return i;
+}
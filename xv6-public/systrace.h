@@ -0,0 +1,31 @@
+// System call statistics and tracing; see systrace.c.
+
+#define NSYSCALL   40   // system call numbers counted; above every SYS_
+#define NSYSHIST   24   // latency buckets; the last also holds slower calls
+#define NTRACE    256   // entries in the trace ring; a power of 2
+#define TRACE_NARG  3   // arguments recorded per call
+
+// systrace() commands
+#define ST_STATS  1     // arg 1 to count calls and time them, 0 to stop
+#define ST_RESET  2     // zero the system-wide statistics
+#define ST_TRACE  3     // trace process arg (0 for all), -1 to stop
+
+// Counts and latencies of each system call, for one process or
+// for the whole system.  A call of c TSC cycles is counted in
+// hist[num][b] with 2^b <= c < 2^(b+1).
+struct sysstat {
+  uint count[NSYSCALL];
+  uint hist[NSYSCALL][NSYSHIST];
+};
+
+// One traced call, read with traceread().  Entries are numbered
+// from 0, so a gap in seq means the reader fell behind and the
+// ring overwrote entries.  exit() is recorded with ret 0.
+struct traceent {
+  uint seq;
+  int pid;
+  int num;                 // system call number
+  int args[TRACE_NARG];    // first words of its arguments
+  int ret;
+  uint cycles;             // TSC cycles spent in the call
+};
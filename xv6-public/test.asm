@@ -0,0 +1,2043 @@
+
+_test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmap.h"
+int main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+    // }
+    // printf(1, "%s\n", addr6d); //this one also doesn't fail
+    //printf(1, "d\n");
+    
+    char* addrTest = (char*)0x100000;
+    addrTest[0] = 'a';
+   f:	c6 05 00 00 10 00 61 	movb   $0x61,0x100000
+
+    //new test: test7
+    char* addr7 = mmap((void*)0, 100, PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	6a 00                	push   $0x0
+  1b:	6a ff                	push   $0xffffffff
+  1d:	6a 05                	push   $0x5
+  1f:	6a 03                	push   $0x3
+  21:	6a 64                	push   $0x64
+  23:	6a 00                	push   $0x0
+  25:	e8 c5 07 00 00       	call   7ef <mmap>
+
+    printf(1, "addr7: %p\n", addr7);
+  2a:	83 c4 1c             	add    $0x1c,%esp
+  2d:	50                   	push   %eax
+    char* addr7 = mmap((void*)0, 100, PROT_READ|PROT_WRITE, MAP_ANONYMOUS|MAP_PRIVATE, -1, 0);
+  2e:	89 c3                	mov    %eax,%ebx
+    printf(1, "addr7: %p\n", addr7);
+  30:	68 30 0e 00 00       	push   $0xe30
+  35:	6a 01                	push   $0x1
+  37:	e8 14 0a 00 00       	call   a50 <printf>
+
+    addr7[0] = 'a';
+  3c:	0f b7 05 8a 0e 00 00 	movzwl 0xe8a,%eax
+    addr7[1] = '\0';
+
+    printf(1, "testing original value: %s\n", addr7);
+  43:	83 c4 0c             	add    $0xc,%esp
+    addr7[0] = 'a';
+  46:	66 89 03             	mov    %ax,(%ebx)
+    printf(1, "testing original value: %s\n", addr7);
+  49:	53                   	push   %ebx
+  4a:	68 3b 0e 00 00       	push   $0xe3b
+  4f:	6a 01                	push   $0x1
+  51:	e8 fa 09 00 00       	call   a50 <printf>
+
+    int pid = fork();
+  56:	e8 72 05 00 00       	call   5cd <fork>
+
+    if(pid == 0) { //child
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	85 c0                	test   %eax,%eax
+  60:	75 16                	jne    78 <main+0x78>
+        //addr7[0] = 'b';
+        printf(1, "child val: %s\n", addr7);
+  62:	52                   	push   %edx
+  63:	53                   	push   %ebx
+  64:	68 57 0e 00 00       	push   $0xe57
+  69:	6a 01                	push   $0x1
+  6b:	e8 e0 09 00 00       	call   a50 <printf>
+  70:	83 c4 10             	add    $0x10,%esp
+    // charVers[1] = '\0';
+
+    // printf(1, "val: %s\n", charVers);
+    */
+
+    exit();
+  73:	e8 6f 05 00 00       	call   5e7 <exit>
+        wait();
+  78:	e8 84 05 00 00       	call   601 <wait>
+        printf(1, "parent process: %p\n", addr7);
+  7d:	50                   	push   %eax
+  7e:	53                   	push   %ebx
+  7f:	68 66 0e 00 00       	push   $0xe66
+  84:	6a 01                	push   $0x1
+  86:	e8 c5 09 00 00       	call   a50 <printf>
+        printf(1, "parent val: %s\n", addr7);
+  8b:	83 c4 0c             	add    $0xc,%esp
+  8e:	53                   	push   %ebx
+  8f:	68 7a 0e 00 00       	push   $0xe7a
+  94:	6a 01                	push   $0x1
+  96:	e8 b5 09 00 00       	call   a50 <printf>
+  9b:	83 c4 10             	add    $0x10,%esp
+  9e:	eb d3                	jmp    73 <main+0x73>
+
+000000a0 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  a1:	31 c0                	xor    %eax,%eax
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	53                   	push   %ebx
+  a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  b7:	83 c0 01             	add    $0x1,%eax
+  ba:	84 d2                	test   %dl,%dl
+  bc:	75 f2                	jne    b0 <strcpy+0x10>
+    ;
+  return os;
+}
+  be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c1:	89 c8                	mov    %ecx,%eax
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+  c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	53                   	push   %ebx
+  d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  da:	0f b6 02             	movzbl (%edx),%eax
+  dd:	84 c0                	test   %al,%al
+  df:	75 17                	jne    f8 <strcmp+0x28>
+  e1:	eb 3a                	jmp    11d <strcmp+0x4d>
+  e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  e7:	90                   	nop
+  e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ec:	83 c2 01             	add    $0x1,%edx
+  ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  f2:	84 c0                	test   %al,%al
+  f4:	74 1a                	je     110 <strcmp+0x40>
+    p++, q++;
+  f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  f8:	0f b6 19             	movzbl (%ecx),%ebx
+  fb:	38 c3                	cmp    %al,%bl
+  fd:	74 e9                	je     e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  ff:	29 d8                	sub    %ebx,%eax
+}
+ 101:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 104:	c9                   	leave
+ 105:	c3                   	ret
+ 106:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 110:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 114:	31 c0                	xor    %eax,%eax
+ 116:	29 d8                	sub    %ebx,%eax
+}
+ 118:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 11b:	c9                   	leave
+ 11c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 11d:	0f b6 19             	movzbl (%ecx),%ebx
+ 120:	31 c0                	xor    %eax,%eax
+ 122:	eb db                	jmp    ff <strcmp+0x2f>
+ 124:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 12f:	90                   	nop
+
+00000130 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 136:	80 3a 00             	cmpb   $0x0,(%edx)
+ 139:	74 15                	je     150 <strlen+0x20>
+ 13b:	31 c0                	xor    %eax,%eax
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+ 140:	83 c0 01             	add    $0x1,%eax
+ 143:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 147:	89 c1                	mov    %eax,%ecx
+ 149:	75 f5                	jne    140 <strlen+0x10>
+    ;
+  return n;
+}
+ 14b:	89 c8                	mov    %ecx,%eax
+ 14d:	5d                   	pop    %ebp
+ 14e:	c3                   	ret
+ 14f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 150:	31 c9                	xor    %ecx,%ecx
+}
+ 152:	5d                   	pop    %ebp
+ 153:	89 c8                	mov    %ecx,%eax
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000160 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 16a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16d:	89 d7                	mov    %edx,%edi
+ 16f:	fc                   	cld
+ 170:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 172:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 175:	89 d0                	mov    %edx,%eax
+ 177:	c9                   	leave
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000180 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 45 08             	mov    0x8(%ebp),%eax
+ 186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 18a:	0f b6 10             	movzbl (%eax),%edx
+ 18d:	84 d2                	test   %dl,%dl
+ 18f:	75 12                	jne    1a3 <strchr+0x23>
+ 191:	eb 1d                	jmp    1b0 <strchr+0x30>
+ 193:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 197:	90                   	nop
+ 198:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 19c:	83 c0 01             	add    $0x1,%eax
+ 19f:	84 d2                	test   %dl,%dl
+ 1a1:	74 0d                	je     1b0 <strchr+0x30>
+    if(*s == c)
+ 1a3:	38 d1                	cmp    %dl,%cl
+ 1a5:	75 f1                	jne    198 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1a7:	5d                   	pop    %ebp
+ 1a8:	c3                   	ret
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1b0:	31 c0                	xor    %eax,%eax
+}
+ 1b2:	5d                   	pop    %ebp
+ 1b3:	c3                   	ret
+ 1b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+
+000001c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	57                   	push   %edi
+ 1c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1c9:	31 db                	xor    %ebx,%ebx
+{
+ 1cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ce:	eb 27                	jmp    1f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1d0:	83 ec 04             	sub    $0x4,%esp
+ 1d3:	6a 01                	push   $0x1
+ 1d5:	56                   	push   %esi
+ 1d6:	6a 00                	push   $0x0
+ 1d8:	e8 58 04 00 00       	call   635 <read>
+    if(cc < 1)
+ 1dd:	83 c4 10             	add    $0x10,%esp
+ 1e0:	85 c0                	test   %eax,%eax
+ 1e2:	7e 1d                	jle    201 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1ef:	3c 0a                	cmp    $0xa,%al
+ 1f1:	74 10                	je     203 <gets+0x43>
+ 1f3:	3c 0d                	cmp    $0xd,%al
+ 1f5:	74 0c                	je     203 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1f7:	89 df                	mov    %ebx,%edi
+ 1f9:	83 c3 01             	add    $0x1,%ebx
+ 1fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1ff:	7c cf                	jl     1d0 <gets+0x10>
+ 201:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 20a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 20d:	5b                   	pop    %ebx
+ 20e:	5e                   	pop    %esi
+ 20f:	5f                   	pop    %edi
+ 210:	5d                   	pop    %ebp
+ 211:	c3                   	ret
+ 212:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	56                   	push   %esi
+ 224:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	6a 00                	push   $0x0
+ 22a:	ff 75 08             	push   0x8(%ebp)
+ 22d:	e8 85 04 00 00       	call   6b7 <open>
+  if(fd < 0)
+ 232:	83 c4 10             	add    $0x10,%esp
+ 235:	85 c0                	test   %eax,%eax
+ 237:	78 27                	js     260 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 239:	83 ec 08             	sub    $0x8,%esp
+ 23c:	ff 75 0c             	push   0xc(%ebp)
+ 23f:	89 c3                	mov    %eax,%ebx
+ 241:	50                   	push   %eax
+ 242:	e8 be 04 00 00       	call   705 <fstat>
+  close(fd);
+ 247:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 24a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 24c:	e8 18 04 00 00       	call   669 <close>
+  return r;
+ 251:	83 c4 10             	add    $0x10,%esp
+}
+ 254:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 257:	89 f0                	mov    %esi,%eax
+ 259:	5b                   	pop    %ebx
+ 25a:	5e                   	pop    %esi
+ 25b:	5d                   	pop    %ebp
+ 25c:	c3                   	ret
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 260:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 265:	eb ed                	jmp    254 <stat+0x34>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+
+00000270 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	53                   	push   %ebx
+ 274:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 277:	0f be 02             	movsbl (%edx),%eax
+ 27a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 27d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 280:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 285:	77 1e                	ja     2a5 <atoi+0x35>
+ 287:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 290:	83 c2 01             	add    $0x1,%edx
+ 293:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 296:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 29a:	0f be 02             	movsbl (%edx),%eax
+ 29d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2a0:	80 fb 09             	cmp    $0x9,%bl
+ 2a3:	76 eb                	jbe    290 <atoi+0x20>
+  return n;
+}
+ 2a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a8:	89 c8                	mov    %ecx,%eax
+ 2aa:	c9                   	leave
+ 2ab:	c3                   	ret
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+ 2b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2be:	85 c0                	test   %eax,%eax
+ 2c0:	7e 13                	jle    2d5 <memmove+0x25>
+ 2c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2c4:	89 d7                	mov    %edx,%edi
+ 2c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2d1:	39 f8                	cmp    %edi,%eax
+ 2d3:	75 fb                	jne    2d0 <memmove+0x20>
+  return vdst;
+}
+ 2d5:	5e                   	pop    %esi
+ 2d6:	89 d0                	mov    %edx,%eax
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2ec:	5d                   	pop    %ebp
+ 2ed:	c3                   	ret
+ 2ee:	66 90                	xchg   %ax,%ax
+
+000002f0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 2f0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 2f1:	31 c0                	xor    %eax,%eax
+ 2f3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 2f8:	89 e5                	mov    %esp,%ebp
+ 2fa:	56                   	push   %esi
+ 2fb:	53                   	push   %ebx
+ 2fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2ff:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 303:	85 c0                	test   %eax,%eax
+ 305:	74 32                	je     339 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 307:	83 f8 02             	cmp    $0x2,%eax
+ 30a:	74 0c                	je     318 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 30c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 311:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 314:	85 c0                	test   %eax,%eax
+ 316:	74 21                	je     339 <mutex_lock+0x49>
+ 318:	be 02 00 00 00       	mov    $0x2,%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 02                	push   $0x2
+ 325:	6a 00                	push   $0x0
+ 327:	53                   	push   %ebx
+ 328:	e8 2a 05 00 00       	call   857 <futex>
+ 32d:	89 f0                	mov    %esi,%eax
+ 32f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	85 c0                	test   %eax,%eax
+ 337:	75 e7                	jne    320 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 339:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 33c:	5b                   	pop    %ebx
+ 33d:	5e                   	pop    %esi
+ 33e:	5d                   	pop    %ebp
+ 33f:	c3                   	ret
+
+00000340 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 340:	55                   	push   %ebp
+ 341:	31 c0                	xor    %eax,%eax
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 34e:	83 f8 02             	cmp    $0x2,%eax
+ 351:	74 05                	je     358 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 353:	c9                   	leave
+ 354:	c3                   	ret
+ 355:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 358:	83 ec 04             	sub    $0x4,%esp
+ 35b:	6a 01                	push   $0x1
+ 35d:	6a 01                	push   $0x1
+ 35f:	52                   	push   %edx
+ 360:	e8 f2 04 00 00       	call   857 <futex>
+ 365:	83 c4 10             	add    $0x10,%esp
+}
+ 368:	c9                   	leave
+ 369:	c3                   	ret
+ 36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000370 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 373:	8b 45 08             	mov    0x8(%ebp),%eax
+ 376:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 37c:	5d                   	pop    %ebp
+ 37d:	c3                   	ret
+ 37e:	66 90                	xchg   %ax,%ax
+
+00000380 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 380:	55                   	push   %ebp
+ 381:	31 c0                	xor    %eax,%eax
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	57                   	push   %edi
+ 386:	56                   	push   %esi
+ 387:	53                   	push   %ebx
+ 388:	83 ec 0c             	sub    $0xc,%esp
+ 38b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 38e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 391:	8b 3e                	mov    (%esi),%edi
+ 393:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 396:	83 f8 02             	cmp    $0x2,%eax
+ 399:	74 5d                	je     3f8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 39b:	83 ec 04             	sub    $0x4,%esp
+ 39e:	57                   	push   %edi
+ 39f:	6a 00                	push   $0x0
+ 3a1:	56                   	push   %esi
+ 3a2:	e8 b0 04 00 00       	call   857 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3a7:	31 c0                	xor    %eax,%eax
+ 3a9:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3ae:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	74 30                	je     3e9 <cond_wait+0x69>
+  if(c != 2)
+ 3b9:	83 f8 02             	cmp    $0x2,%eax
+ 3bc:	74 0c                	je     3ca <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 3be:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c3:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3c6:	85 c0                	test   %eax,%eax
+ 3c8:	74 1f                	je     3e9 <cond_wait+0x69>
+ 3ca:	be 02 00 00 00       	mov    $0x2,%esi
+ 3cf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 02                	push   $0x2
+ 3d5:	6a 00                	push   $0x0
+ 3d7:	53                   	push   %ebx
+ 3d8:	e8 7a 04 00 00       	call   857 <futex>
+ 3dd:	89 f0                	mov    %esi,%eax
+ 3df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	75 e7                	jne    3d0 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 3e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ec:	5b                   	pop    %ebx
+ 3ed:	5e                   	pop    %esi
+ 3ee:	5f                   	pop    %edi
+ 3ef:	5d                   	pop    %ebp
+ 3f0:	c3                   	ret
+ 3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3f8:	83 ec 04             	sub    $0x4,%esp
+ 3fb:	6a 01                	push   $0x1
+ 3fd:	6a 01                	push   $0x1
+ 3ff:	53                   	push   %ebx
+ 400:	e8 52 04 00 00       	call   857 <futex>
+ 405:	83 c4 10             	add    $0x10,%esp
+ 408:	eb 91                	jmp    39b <cond_wait+0x1b>
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	53                   	push   %ebx
+ 414:	83 ec 04             	sub    $0x4,%esp
+ 417:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 420:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 422:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 425:	89 c8                	mov    %ecx,%eax
+ 427:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 42b:	39 c1                	cmp    %eax,%ecx
+ 42d:	75 f1                	jne    420 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 42f:	83 ec 04             	sub    $0x4,%esp
+ 432:	6a 01                	push   $0x1
+ 434:	6a 01                	push   $0x1
+ 436:	52                   	push   %edx
+ 437:	e8 1b 04 00 00       	call   857 <futex>
+}
+ 43c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 43f:	83 c4 10             	add    $0x10,%esp
+ 442:	c9                   	leave
+ 443:	c3                   	ret
+ 444:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+
+00000450 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	83 ec 04             	sub    $0x4,%esp
+ 457:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 45a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 460:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 462:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 465:	89 c8                	mov    %ecx,%eax
+ 467:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 46b:	39 c1                	cmp    %eax,%ecx
+ 46d:	75 f1                	jne    460 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 46f:	83 ec 04             	sub    $0x4,%esp
+ 472:	6a 40                	push   $0x40
+ 474:	6a 01                	push   $0x1
+ 476:	52                   	push   %edx
+ 477:	e8 db 03 00 00       	call   857 <futex>
+}
+ 47c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	c9                   	leave
+ 483:	c3                   	ret
+ 484:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 490:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 495:	c3                   	ret
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004a0 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 4a0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 4a5:	85 c0                	test   %eax,%eax
+ 4a7:	74 07                	je     4b0 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 4a9:	c3                   	ret
+ 4aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 4b0:	e9 d2 02 00 00       	jmp    787 <getpid>
+ 4b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 4c9:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 4cb:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 4d1:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4d7:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 4dc:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4e2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 4e5:	89 d0                	mov    %edx,%eax
+ 4e7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 4ea:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4f0:	29 d9                	sub    %ebx,%ecx
+ 4f2:	89 c6                	mov    %eax,%esi
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 4f9:	d3 e6                	shl    %cl,%esi
+ 4fb:	31 c0                	xor    %eax,%eax
+ 4fd:	f6 c1 20             	test   $0x20,%cl
+ 500:	0f 45 fe             	cmovne %esi,%edi
+ 503:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 506:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 509:	89 d9                	mov    %ebx,%ecx
+ 50b:	31 db                	xor    %ebx,%ebx
+ 50d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 513:	0f ad d0             	shrd   %cl,%edx,%eax
+ 516:	d3 ea                	shr    %cl,%edx
+ 518:	f6 c1 20             	test   $0x20,%cl
+ 51b:	0f 45 c2             	cmovne %edx,%eax
+ 51e:	0f 45 d3             	cmovne %ebx,%edx
+ 521:	01 f0                	add    %esi,%eax
+ 523:	11 fa                	adc    %edi,%edx
+}
+ 525:	83 c4 0c             	add    $0xc,%esp
+ 528:	5b                   	pop    %ebx
+ 529:	5e                   	pop    %esi
+ 52a:	5f                   	pop    %edi
+ 52b:	5d                   	pop    %ebp
+ 52c:	c3                   	ret
+ 52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	53                   	push   %ebx
+ 536:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 539:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 53d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 540:	74 0e                	je     550 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 542:	83 c4 1c             	add    $0x1c,%esp
+ 545:	5b                   	pop    %ebx
+ 546:	5e                   	pop    %esi
+ 547:	5f                   	pop    %edi
+ 548:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 549:	e9 a5 03 00 00       	jmp    8f3 <clock_gettime>
+ 54e:	66 90                	xchg   %ax,%ax
+ 550:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 552:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 558:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 55e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 563:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 566:	89 d0                	mov    %edx,%eax
+ 568:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 56b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 571:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 577:	89 c6                	mov    %eax,%esi
+ 579:	89 d7                	mov    %edx,%edi
+ 57b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 57e:	d3 e6                	shl    %cl,%esi
+ 580:	31 c0                	xor    %eax,%eax
+ 582:	f6 c1 20             	test   $0x20,%cl
+ 585:	0f 45 fe             	cmovne %esi,%edi
+ 588:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 58b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 58e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 595:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 59b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 59e:	d3 ea                	shr    %cl,%edx
+ 5a0:	f6 c1 20             	test   $0x20,%cl
+ 5a3:	74 04                	je     5a9 <vclock_gettime+0x79>
+ 5a5:	89 d0                	mov    %edx,%eax
+ 5a7:	31 d2                	xor    %edx,%edx
+ 5a9:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 5ab:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 5b0:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 5b2:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 5b4:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 5b6:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 5b8:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 5be:	29 c1                	sub    %eax,%ecx
+}
+ 5c0:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 5c2:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 5c5:	83 c4 1c             	add    $0x1c,%esp
+ 5c8:	5b                   	pop    %ebx
+ 5c9:	5e                   	pop    %esi
+ 5ca:	5f                   	pop    %edi
+ 5cb:	5d                   	pop    %ebp
+ 5cc:	c3                   	ret
+
+000005cd <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 5cd:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5d9:	74 09                	je     5e4 <fork+0x17>
+ 5db:	89 e1                	mov    %esp,%ecx
+ 5dd:	ba e6 05 00 00       	mov    $0x5e6,%edx
+ 5e2:	0f 34                	sysenter
+ 5e4:	cd 40                	int    $0x40
+ 5e6:	c3                   	ret
+
+000005e7 <exit>:
+SYSCALL(exit)
+ 5e7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5f3:	74 09                	je     5fe <exit+0x17>
+ 5f5:	89 e1                	mov    %esp,%ecx
+ 5f7:	ba 00 06 00 00       	mov    $0x600,%edx
+ 5fc:	0f 34                	sysenter
+ 5fe:	cd 40                	int    $0x40
+ 600:	c3                   	ret
+
+00000601 <wait>:
+SYSCALL(wait)
+ 601:	b8 03 00 00 00       	mov    $0x3,%eax
+ 606:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 60d:	74 09                	je     618 <wait+0x17>
+ 60f:	89 e1                	mov    %esp,%ecx
+ 611:	ba 1a 06 00 00       	mov    $0x61a,%edx
+ 616:	0f 34                	sysenter
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <pipe>:
+SYSCALL(pipe)
+ 61b:	b8 04 00 00 00       	mov    $0x4,%eax
+ 620:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 627:	74 09                	je     632 <pipe+0x17>
+ 629:	89 e1                	mov    %esp,%ecx
+ 62b:	ba 34 06 00 00       	mov    $0x634,%edx
+ 630:	0f 34                	sysenter
+ 632:	cd 40                	int    $0x40
+ 634:	c3                   	ret
+
+00000635 <read>:
+SYSCALL(read)
+ 635:	b8 05 00 00 00       	mov    $0x5,%eax
+ 63a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 641:	74 09                	je     64c <read+0x17>
+ 643:	89 e1                	mov    %esp,%ecx
+ 645:	ba 4e 06 00 00       	mov    $0x64e,%edx
+ 64a:	0f 34                	sysenter
+ 64c:	cd 40                	int    $0x40
+ 64e:	c3                   	ret
+
+0000064f <write>:
+SYSCALL(write)
+ 64f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 654:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 65b:	74 09                	je     666 <write+0x17>
+ 65d:	89 e1                	mov    %esp,%ecx
+ 65f:	ba 68 06 00 00       	mov    $0x668,%edx
+ 664:	0f 34                	sysenter
+ 666:	cd 40                	int    $0x40
+ 668:	c3                   	ret
+
+00000669 <close>:
+SYSCALL(close)
+ 669:	b8 15 00 00 00       	mov    $0x15,%eax
+ 66e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 675:	74 09                	je     680 <close+0x17>
+ 677:	89 e1                	mov    %esp,%ecx
+ 679:	ba 82 06 00 00       	mov    $0x682,%edx
+ 67e:	0f 34                	sysenter
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <kill>:
+SYSCALL(kill)
+ 683:	b8 06 00 00 00       	mov    $0x6,%eax
+ 688:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 68f:	74 09                	je     69a <kill+0x17>
+ 691:	89 e1                	mov    %esp,%ecx
+ 693:	ba 9c 06 00 00       	mov    $0x69c,%edx
+ 698:	0f 34                	sysenter
+ 69a:	cd 40                	int    $0x40
+ 69c:	c3                   	ret
+
+0000069d <exec>:
+SYSCALL(exec)
+ 69d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a9:	74 09                	je     6b4 <exec+0x17>
+ 6ab:	89 e1                	mov    %esp,%ecx
+ 6ad:	ba b6 06 00 00       	mov    $0x6b6,%edx
+ 6b2:	0f 34                	sysenter
+ 6b4:	cd 40                	int    $0x40
+ 6b6:	c3                   	ret
+
+000006b7 <open>:
+SYSCALL(open)
+ 6b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6c3:	74 09                	je     6ce <open+0x17>
+ 6c5:	89 e1                	mov    %esp,%ecx
+ 6c7:	ba d0 06 00 00       	mov    $0x6d0,%edx
+ 6cc:	0f 34                	sysenter
+ 6ce:	cd 40                	int    $0x40
+ 6d0:	c3                   	ret
+
+000006d1 <mknod>:
+SYSCALL(mknod)
+ 6d1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6dd:	74 09                	je     6e8 <mknod+0x17>
+ 6df:	89 e1                	mov    %esp,%ecx
+ 6e1:	ba ea 06 00 00       	mov    $0x6ea,%edx
+ 6e6:	0f 34                	sysenter
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <unlink>:
+SYSCALL(unlink)
+ 6eb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6f7:	74 09                	je     702 <unlink+0x17>
+ 6f9:	89 e1                	mov    %esp,%ecx
+ 6fb:	ba 04 07 00 00       	mov    $0x704,%edx
+ 700:	0f 34                	sysenter
+ 702:	cd 40                	int    $0x40
+ 704:	c3                   	ret
+
+00000705 <fstat>:
+SYSCALL(fstat)
+ 705:	b8 08 00 00 00       	mov    $0x8,%eax
+ 70a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 711:	74 09                	je     71c <fstat+0x17>
+ 713:	89 e1                	mov    %esp,%ecx
+ 715:	ba 1e 07 00 00       	mov    $0x71e,%edx
+ 71a:	0f 34                	sysenter
+ 71c:	cd 40                	int    $0x40
+ 71e:	c3                   	ret
+
+0000071f <link>:
+SYSCALL(link)
+ 71f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 724:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 72b:	74 09                	je     736 <link+0x17>
+ 72d:	89 e1                	mov    %esp,%ecx
+ 72f:	ba 38 07 00 00       	mov    $0x738,%edx
+ 734:	0f 34                	sysenter
+ 736:	cd 40                	int    $0x40
+ 738:	c3                   	ret
+
+00000739 <mkdir>:
+SYSCALL(mkdir)
+ 739:	b8 14 00 00 00       	mov    $0x14,%eax
+ 73e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 745:	74 09                	je     750 <mkdir+0x17>
+ 747:	89 e1                	mov    %esp,%ecx
+ 749:	ba 52 07 00 00       	mov    $0x752,%edx
+ 74e:	0f 34                	sysenter
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <chdir>:
+SYSCALL(chdir)
+ 753:	b8 09 00 00 00       	mov    $0x9,%eax
+ 758:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 75f:	74 09                	je     76a <chdir+0x17>
+ 761:	89 e1                	mov    %esp,%ecx
+ 763:	ba 6c 07 00 00       	mov    $0x76c,%edx
+ 768:	0f 34                	sysenter
+ 76a:	cd 40                	int    $0x40
+ 76c:	c3                   	ret
+
+0000076d <dup>:
+SYSCALL(dup)
+ 76d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 772:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 779:	74 09                	je     784 <dup+0x17>
+ 77b:	89 e1                	mov    %esp,%ecx
+ 77d:	ba 86 07 00 00       	mov    $0x786,%edx
+ 782:	0f 34                	sysenter
+ 784:	cd 40                	int    $0x40
+ 786:	c3                   	ret
+
+00000787 <getpid>:
+SYSCALL(getpid)
+ 787:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 78c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 793:	74 09                	je     79e <getpid+0x17>
+ 795:	89 e1                	mov    %esp,%ecx
+ 797:	ba a0 07 00 00       	mov    $0x7a0,%edx
+ 79c:	0f 34                	sysenter
+ 79e:	cd 40                	int    $0x40
+ 7a0:	c3                   	ret
+
+000007a1 <sbrk>:
+SYSCALL(sbrk)
+ 7a1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7a6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7ad:	74 09                	je     7b8 <sbrk+0x17>
+ 7af:	89 e1                	mov    %esp,%ecx
+ 7b1:	ba ba 07 00 00       	mov    $0x7ba,%edx
+ 7b6:	0f 34                	sysenter
+ 7b8:	cd 40                	int    $0x40
+ 7ba:	c3                   	ret
+
+000007bb <sleep>:
+SYSCALL(sleep)
+ 7bb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7c0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7c7:	74 09                	je     7d2 <sleep+0x17>
+ 7c9:	89 e1                	mov    %esp,%ecx
+ 7cb:	ba d4 07 00 00       	mov    $0x7d4,%edx
+ 7d0:	0f 34                	sysenter
+ 7d2:	cd 40                	int    $0x40
+ 7d4:	c3                   	ret
+
+000007d5 <uptime>:
+SYSCALL(uptime)
+ 7d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7da:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7e1:	74 09                	je     7ec <uptime+0x17>
+ 7e3:	89 e1                	mov    %esp,%ecx
+ 7e5:	ba ee 07 00 00       	mov    $0x7ee,%edx
+ 7ea:	0f 34                	sysenter
+ 7ec:	cd 40                	int    $0x40
+ 7ee:	c3                   	ret
+
+000007ef <mmap>:
+SYSCALL(mmap)
+ 7ef:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7f4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7fb:	74 09                	je     806 <mmap+0x17>
+ 7fd:	89 e1                	mov    %esp,%ecx
+ 7ff:	ba 08 08 00 00       	mov    $0x808,%edx
+ 804:	0f 34                	sysenter
+ 806:	cd 40                	int    $0x40
+ 808:	c3                   	ret
+
+00000809 <munmap>:
+SYSCALL(munmap)
+ 809:	b8 17 00 00 00       	mov    $0x17,%eax
+ 80e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 815:	74 09                	je     820 <munmap+0x17>
+ 817:	89 e1                	mov    %esp,%ecx
+ 819:	ba 22 08 00 00       	mov    $0x822,%edx
+ 81e:	0f 34                	sysenter
+ 820:	cd 40                	int    $0x40
+ 822:	c3                   	ret
+
+00000823 <clone>:
+SYSCALL(clone)
+ 823:	b8 18 00 00 00       	mov    $0x18,%eax
+ 828:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 82f:	74 09                	je     83a <clone+0x17>
+ 831:	89 e1                	mov    %esp,%ecx
+ 833:	ba 3c 08 00 00       	mov    $0x83c,%edx
+ 838:	0f 34                	sysenter
+ 83a:	cd 40                	int    $0x40
+ 83c:	c3                   	ret
+
+0000083d <join>:
+SYSCALL(join)
+ 83d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 842:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 849:	74 09                	je     854 <join+0x17>
+ 84b:	89 e1                	mov    %esp,%ecx
+ 84d:	ba 56 08 00 00       	mov    $0x856,%edx
+ 852:	0f 34                	sysenter
+ 854:	cd 40                	int    $0x40
+ 856:	c3                   	ret
+
+00000857 <futex>:
+SYSCALL(futex)
+ 857:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 85c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 863:	74 09                	je     86e <futex+0x17>
+ 865:	89 e1                	mov    %esp,%ecx
+ 867:	ba 70 08 00 00       	mov    $0x870,%edx
+ 86c:	0f 34                	sysenter
+ 86e:	cd 40                	int    $0x40
+ 870:	c3                   	ret
+
+00000871 <memstat>:
+SYSCALL(memstat)
+ 871:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 876:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 87d:	74 09                	je     888 <memstat+0x17>
+ 87f:	89 e1                	mov    %esp,%ecx
+ 881:	ba 8a 08 00 00       	mov    $0x88a,%edx
+ 886:	0f 34                	sysenter
+ 888:	cd 40                	int    $0x40
+ 88a:	c3                   	ret
+
+0000088b <nice>:
+SYSCALL(nice)
+ 88b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 890:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 897:	74 09                	je     8a2 <nice+0x17>
+ 899:	89 e1                	mov    %esp,%ecx
+ 89b:	ba a4 08 00 00       	mov    $0x8a4,%edx
+ 8a0:	0f 34                	sysenter
+ 8a2:	cd 40                	int    $0x40
+ 8a4:	c3                   	ret
+
+000008a5 <setpriority>:
+SYSCALL(setpriority)
+ 8a5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8aa:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8b1:	74 09                	je     8bc <setpriority+0x17>
+ 8b3:	89 e1                	mov    %esp,%ecx
+ 8b5:	ba be 08 00 00       	mov    $0x8be,%edx
+ 8ba:	0f 34                	sysenter
+ 8bc:	cd 40                	int    $0x40
+ 8be:	c3                   	ret
+
+000008bf <getpinfo>:
+SYSCALL(getpinfo)
+ 8bf:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8c4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8cb:	74 09                	je     8d6 <getpinfo+0x17>
+ 8cd:	89 e1                	mov    %esp,%ecx
+ 8cf:	ba d8 08 00 00       	mov    $0x8d8,%edx
+ 8d4:	0f 34                	sysenter
+ 8d6:	cd 40                	int    $0x40
+ 8d8:	c3                   	ret
+
+000008d9 <settickets>:
+SYSCALL(settickets)
+ 8d9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8de:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8e5:	74 09                	je     8f0 <settickets+0x17>
+ 8e7:	89 e1                	mov    %esp,%ecx
+ 8e9:	ba f2 08 00 00       	mov    $0x8f2,%edx
+ 8ee:	0f 34                	sysenter
+ 8f0:	cd 40                	int    $0x40
+ 8f2:	c3                   	ret
+
+000008f3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 8f3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8f8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8ff:	74 09                	je     90a <clock_gettime+0x17>
+ 901:	89 e1                	mov    %esp,%ecx
+ 903:	ba 0c 09 00 00       	mov    $0x90c,%edx
+ 908:	0f 34                	sysenter
+ 90a:	cd 40                	int    $0x40
+ 90c:	c3                   	ret
+
+0000090d <batch>:
+SYSCALL(batch)
+ 90d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 912:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 919:	74 09                	je     924 <batch+0x17>
+ 91b:	89 e1                	mov    %esp,%ecx
+ 91d:	ba 26 09 00 00       	mov    $0x926,%edx
+ 922:	0f 34                	sysenter
+ 924:	cd 40                	int    $0x40
+ 926:	c3                   	ret
+
+00000927 <aiosetup>:
+SYSCALL(aiosetup)
+ 927:	b8 22 00 00 00       	mov    $0x22,%eax
+ 92c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 933:	74 09                	je     93e <aiosetup+0x17>
+ 935:	89 e1                	mov    %esp,%ecx
+ 937:	ba 40 09 00 00       	mov    $0x940,%edx
+ 93c:	0f 34                	sysenter
+ 93e:	cd 40                	int    $0x40
+ 940:	c3                   	ret
+
+00000941 <aioenter>:
+SYSCALL(aioenter)
+ 941:	b8 23 00 00 00       	mov    $0x23,%eax
+ 946:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 94d:	74 09                	je     958 <aioenter+0x17>
+ 94f:	89 e1                	mov    %esp,%ecx
+ 951:	ba 5a 09 00 00       	mov    $0x95a,%edx
+ 956:	0f 34                	sysenter
+ 958:	cd 40                	int    $0x40
+ 95a:	c3                   	ret
+
+0000095b <systrace>:
+SYSCALL(systrace)
+ 95b:	b8 24 00 00 00       	mov    $0x24,%eax
+ 960:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 967:	74 09                	je     972 <systrace+0x17>
+ 969:	89 e1                	mov    %esp,%ecx
+ 96b:	ba 74 09 00 00       	mov    $0x974,%edx
+ 970:	0f 34                	sysenter
+ 972:	cd 40                	int    $0x40
+ 974:	c3                   	ret
+
+00000975 <sysstat>:
+SYSCALL(sysstat)
+ 975:	b8 25 00 00 00       	mov    $0x25,%eax
+ 97a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 981:	74 09                	je     98c <sysstat+0x17>
+ 983:	89 e1                	mov    %esp,%ecx
+ 985:	ba 8e 09 00 00       	mov    $0x98e,%edx
+ 98a:	0f 34                	sysenter
+ 98c:	cd 40                	int    $0x40
+ 98e:	c3                   	ret
+
+0000098f <traceread>:
+SYSCALL(traceread)
+ 98f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 994:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 99b:	74 09                	je     9a6 <traceread+0x17>
+ 99d:	89 e1                	mov    %esp,%ecx
+ 99f:	ba a8 09 00 00       	mov    $0x9a8,%edx
+ 9a4:	0f 34                	sysenter
+ 9a6:	cd 40                	int    $0x40
+ 9a8:	c3                   	ret
+ 9a9:	66 90                	xchg   %ax,%ax
+ 9ab:	66 90                	xchg   %ax,%ax
+ 9ad:	66 90                	xchg   %ax,%ax
+ 9af:	90                   	nop
+
+000009b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+ 9b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 9b8:	89 d1                	mov    %edx,%ecx
+{
+ 9ba:	83 ec 3c             	sub    $0x3c,%esp
+ 9bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 9c0:	85 d2                	test   %edx,%edx
+ 9c2:	0f 89 80 00 00 00    	jns    a48 <printint+0x98>
+ 9c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 9cc:	74 7a                	je     a48 <printint+0x98>
+    x = -xx;
+ 9ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 9d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 9d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 9d8:	31 f6                	xor    %esi,%esi
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 9e0:	89 c8                	mov    %ecx,%eax
+ 9e2:	31 d2                	xor    %edx,%edx
+ 9e4:	89 f7                	mov    %esi,%edi
+ 9e6:	f7 f3                	div    %ebx
+ 9e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 9eb:	0f b6 92 ec 0e 00 00 	movzbl 0xeec(%edx),%edx
+ 9f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 9f6:	89 ca                	mov    %ecx,%edx
+ 9f8:	89 c1                	mov    %eax,%ecx
+ 9fa:	39 da                	cmp    %ebx,%edx
+ 9fc:	73 e2                	jae    9e0 <printint+0x30>
+  if(neg)
+ 9fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a01:	85 c0                	test   %eax,%eax
+ a03:	74 07                	je     a0c <printint+0x5c>
+    buf[i++] = '-';
+ a05:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ a0a:	89 f7                	mov    %esi,%edi
+ a0c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ a0f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ a12:	01 df                	add    %ebx,%edi
+ a14:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ a18:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ a1b:	83 ec 04             	sub    $0x4,%esp
+ a1e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ a21:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ a24:	6a 01                	push   $0x1
+ a26:	50                   	push   %eax
+ a27:	56                   	push   %esi
+ a28:	e8 22 fc ff ff       	call   64f <write>
+  while(--i >= 0)
+ a2d:	89 f8                	mov    %edi,%eax
+ a2f:	83 c4 10             	add    $0x10,%esp
+ a32:	83 ef 01             	sub    $0x1,%edi
+ a35:	39 d8                	cmp    %ebx,%eax
+ a37:	75 df                	jne    a18 <printint+0x68>
+}
+ a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a3c:	5b                   	pop    %ebx
+ a3d:	5e                   	pop    %esi
+ a3e:	5f                   	pop    %edi
+ a3f:	5d                   	pop    %ebp
+ a40:	c3                   	ret
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ a48:	31 c0                	xor    %eax,%eax
+ a4a:	eb 89                	jmp    9d5 <printint+0x25>
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ a59:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ a5c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ a5f:	0f b6 1e             	movzbl (%esi),%ebx
+ a62:	83 c6 01             	add    $0x1,%esi
+ a65:	84 db                	test   %bl,%bl
+ a67:	74 67                	je     ad0 <printf+0x80>
+ a69:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a6c:	31 d2                	xor    %edx,%edx
+ a6e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a71:	eb 34                	jmp    aa7 <printf+0x57>
+ a73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a77:	90                   	nop
+ a78:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a7b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a80:	83 f8 25             	cmp    $0x25,%eax
+ a83:	74 18                	je     a9d <printf+0x4d>
+  write(fd, &c, 1);
+ a85:	83 ec 04             	sub    $0x4,%esp
+ a88:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a8b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a8e:	6a 01                	push   $0x1
+ a90:	50                   	push   %eax
+ a91:	57                   	push   %edi
+ a92:	e8 b8 fb ff ff       	call   64f <write>
+ a97:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a9d:	0f b6 1e             	movzbl (%esi),%ebx
+ aa0:	83 c6 01             	add    $0x1,%esi
+ aa3:	84 db                	test   %bl,%bl
+ aa5:	74 29                	je     ad0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ aa7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ aaa:	85 d2                	test   %edx,%edx
+ aac:	74 ca                	je     a78 <printf+0x28>
+      }
+    } else if(state == '%'){
+ aae:	83 fa 25             	cmp    $0x25,%edx
+ ab1:	75 ea                	jne    a9d <printf+0x4d>
+      if(c == 'd'){
+ ab3:	83 f8 25             	cmp    $0x25,%eax
+ ab6:	0f 84 24 01 00 00    	je     be0 <printf+0x190>
+ abc:	83 e8 63             	sub    $0x63,%eax
+ abf:	83 f8 15             	cmp    $0x15,%eax
+ ac2:	77 1c                	ja     ae0 <printf+0x90>
+ ac4:	ff 24 85 94 0e 00 00 	jmp    *0xe94(,%eax,4)
+ acb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ad3:	5b                   	pop    %ebx
+ ad4:	5e                   	pop    %esi
+ ad5:	5f                   	pop    %edi
+ ad6:	5d                   	pop    %ebp
+ ad7:	c3                   	ret
+ ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ adf:	90                   	nop
+  write(fd, &c, 1);
+ ae0:	83 ec 04             	sub    $0x4,%esp
+ ae3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ae6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ aea:	6a 01                	push   $0x1
+ aec:	52                   	push   %edx
+ aed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ af0:	57                   	push   %edi
+ af1:	e8 59 fb ff ff       	call   64f <write>
+ af6:	83 c4 0c             	add    $0xc,%esp
+ af9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ afc:	6a 01                	push   $0x1
+ afe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ b01:	52                   	push   %edx
+ b02:	57                   	push   %edi
+ b03:	e8 47 fb ff ff       	call   64f <write>
+        putc(fd, c);
+ b08:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b0b:	31 d2                	xor    %edx,%edx
+ b0d:	eb 8e                	jmp    a9d <printf+0x4d>
+ b0f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ b10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	b9 10 00 00 00       	mov    $0x10,%ecx
+ b1b:	8b 13                	mov    (%ebx),%edx
+ b1d:	6a 00                	push   $0x0
+ b1f:	89 f8                	mov    %edi,%eax
+        ap++;
+ b21:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ b24:	e8 87 fe ff ff       	call   9b0 <printint>
+        ap++;
+ b29:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b2c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b2f:	31 d2                	xor    %edx,%edx
+ b31:	e9 67 ff ff ff       	jmp    a9d <printf+0x4d>
+ b36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ b40:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ b43:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ b45:	83 c0 04             	add    $0x4,%eax
+ b48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ b4b:	85 db                	test   %ebx,%ebx
+ b4d:	0f 84 9d 00 00 00    	je     bf0 <printf+0x1a0>
+        while(*s != 0){
+ b53:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ b56:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ b58:	84 c0                	test   %al,%al
+ b5a:	0f 84 3d ff ff ff    	je     a9d <printf+0x4d>
+ b60:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b63:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b66:	89 de                	mov    %ebx,%esi
+ b68:	89 d3                	mov    %edx,%ebx
+ b6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b70:	83 ec 04             	sub    $0x4,%esp
+ b73:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b76:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b79:	6a 01                	push   $0x1
+ b7b:	53                   	push   %ebx
+ b7c:	57                   	push   %edi
+ b7d:	e8 cd fa ff ff       	call   64f <write>
+        while(*s != 0){
+ b82:	0f b6 06             	movzbl (%esi),%eax
+ b85:	83 c4 10             	add    $0x10,%esp
+ b88:	84 c0                	test   %al,%al
+ b8a:	75 e4                	jne    b70 <printf+0x120>
+      state = 0;
+ b8c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b8f:	31 d2                	xor    %edx,%edx
+ b91:	e9 07 ff ff ff       	jmp    a9d <printf+0x4d>
+ b96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ ba0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ba3:	83 ec 0c             	sub    $0xc,%esp
+ ba6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ bab:	8b 13                	mov    (%ebx),%edx
+ bad:	6a 01                	push   $0x1
+ baf:	e9 6b ff ff ff       	jmp    b1f <printf+0xcf>
+ bb4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ bb8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ bbb:	83 ec 04             	sub    $0x4,%esp
+ bbe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ bc1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ bc3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ bc6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ bc9:	6a 01                	push   $0x1
+ bcb:	52                   	push   %edx
+ bcc:	57                   	push   %edi
+ bcd:	e8 7d fa ff ff       	call   64f <write>
+        ap++;
+ bd2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ bd5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ bd8:	31 d2                	xor    %edx,%edx
+ bda:	e9 be fe ff ff       	jmp    a9d <printf+0x4d>
+ bdf:	90                   	nop
+  write(fd, &c, 1);
+ be0:	83 ec 04             	sub    $0x4,%esp
+ be3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ be6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ be9:	6a 01                	push   $0x1
+ beb:	e9 11 ff ff ff       	jmp    b01 <printf+0xb1>
+ bf0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ bf5:	bb 8c 0e 00 00       	mov    $0xe8c,%ebx
+ bfa:	e9 61 ff ff ff       	jmp    b60 <printf+0x110>
+ bff:	90                   	nop
+
+00000c00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c01:	a1 7c 13 00 00       	mov    0x137c,%eax
+{
+ c06:	89 e5                	mov    %esp,%ebp
+ c08:	57                   	push   %edi
+ c09:	56                   	push   %esi
+ c0a:	53                   	push   %ebx
+ c0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ c0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c1c:	39 ca                	cmp    %ecx,%edx
+ c1e:	73 30                	jae    c50 <free+0x50>
+ c20:	39 c1                	cmp    %eax,%ecx
+ c22:	72 04                	jb     c28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c24:	39 c2                	cmp    %eax,%edx
+ c26:	72 f0                	jb     c18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ c2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ c2e:	39 f8                	cmp    %edi,%eax
+ c30:	74 2e                	je     c60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ c35:	8b 42 04             	mov    0x4(%edx),%eax
+ c38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c3b:	39 f1                	cmp    %esi,%ecx
+ c3d:	74 38                	je     c77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ c3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ c41:	5b                   	pop    %ebx
+  freep = p;
+ c42:	89 15 7c 13 00 00    	mov    %edx,0x137c
+}
+ c48:	5e                   	pop    %esi
+ c49:	5f                   	pop    %edi
+ c4a:	5d                   	pop    %ebp
+ c4b:	c3                   	ret
+ c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c50:	39 c1                	cmp    %eax,%ecx
+ c52:	72 d0                	jb     c24 <free+0x24>
+ c54:	eb c2                	jmp    c18 <free+0x18>
+ c56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c60:	03 70 04             	add    0x4(%eax),%esi
+ c63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c66:	8b 02                	mov    (%edx),%eax
+ c68:	8b 00                	mov    (%eax),%eax
+ c6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c6d:	8b 42 04             	mov    0x4(%edx),%eax
+ c70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c73:	39 f1                	cmp    %esi,%ecx
+ c75:	75 c8                	jne    c3f <free+0x3f>
+    p->s.size += bp->s.size;
+ c77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c7a:	89 15 7c 13 00 00    	mov    %edx,0x137c
+    p->s.size += bp->s.size;
+ c80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c86:	89 0a                	mov    %ecx,(%edx)
+}
+ c88:	5b                   	pop    %ebx
+ c89:	5e                   	pop    %esi
+ c8a:	5f                   	pop    %edi
+ c8b:	5d                   	pop    %ebp
+ c8c:	c3                   	ret
+ c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+ c96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c9c:	8b 15 7c 13 00 00    	mov    0x137c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ca2:	8d 78 07             	lea    0x7(%eax),%edi
+ ca5:	c1 ef 03             	shr    $0x3,%edi
+ ca8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ cab:	85 d2                	test   %edx,%edx
+ cad:	0f 84 8d 00 00 00    	je     d40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cb3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cb5:	8b 48 04             	mov    0x4(%eax),%ecx
+ cb8:	39 f9                	cmp    %edi,%ecx
+ cba:	73 64                	jae    d20 <malloc+0x90>
+  if(nu < 4096)
+ cbc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ cc1:	39 df                	cmp    %ebx,%edi
+ cc3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ cc6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ ccd:	eb 0a                	jmp    cd9 <malloc+0x49>
+ ccf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ cd2:	8b 48 04             	mov    0x4(%eax),%ecx
+ cd5:	39 f9                	cmp    %edi,%ecx
+ cd7:	73 47                	jae    d20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ cd9:	89 c2                	mov    %eax,%edx
+ cdb:	39 05 7c 13 00 00    	cmp    %eax,0x137c
+ ce1:	75 ed                	jne    cd0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ce3:	83 ec 0c             	sub    $0xc,%esp
+ ce6:	56                   	push   %esi
+ ce7:	e8 b5 fa ff ff       	call   7a1 <sbrk>
+  if(p == (char*)-1)
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ cf2:	74 1c                	je     d10 <malloc+0x80>
+  hp->s.size = nu;
+ cf4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ cf7:	83 ec 0c             	sub    $0xc,%esp
+ cfa:	83 c0 08             	add    $0x8,%eax
+ cfd:	50                   	push   %eax
+ cfe:	e8 fd fe ff ff       	call   c00 <free>
+  return freep;
+ d03:	8b 15 7c 13 00 00    	mov    0x137c,%edx
+      if((p = morecore(nunits)) == 0)
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	85 d2                	test   %edx,%edx
+ d0e:	75 c0                	jne    cd0 <malloc+0x40>
+        return 0;
+  }
+}
+ d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ d13:	31 c0                	xor    %eax,%eax
+}
+ d15:	5b                   	pop    %ebx
+ d16:	5e                   	pop    %esi
+ d17:	5f                   	pop    %edi
+ d18:	5d                   	pop    %ebp
+ d19:	c3                   	ret
+ d1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ d20:	39 cf                	cmp    %ecx,%edi
+ d22:	74 4c                	je     d70 <malloc+0xe0>
+        p->s.size -= nunits;
+ d24:	29 f9                	sub    %edi,%ecx
+ d26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ d29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ d2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ d2f:	89 15 7c 13 00 00    	mov    %edx,0x137c
+}
+ d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ d38:	83 c0 08             	add    $0x8,%eax
+}
+ d3b:	5b                   	pop    %ebx
+ d3c:	5e                   	pop    %esi
+ d3d:	5f                   	pop    %edi
+ d3e:	5d                   	pop    %ebp
+ d3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ d40:	c7 05 7c 13 00 00 80 	movl   $0x1380,0x137c
+ d47:	13 00 00 
+    base.s.size = 0;
+ d4a:	b8 80 13 00 00       	mov    $0x1380,%eax
+    base.s.ptr = freep = prevp = &base;
+ d4f:	c7 05 80 13 00 00 80 	movl   $0x1380,0x1380
+ d56:	13 00 00 
+    base.s.size = 0;
+ d59:	c7 05 84 13 00 00 00 	movl   $0x0,0x1384
+ d60:	00 00 00 
+    if(p->s.size >= nunits){
+ d63:	e9 54 ff ff ff       	jmp    cbc <malloc+0x2c>
+ d68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d70:	8b 08                	mov    (%eax),%ecx
+ d72:	89 0a                	mov    %ecx,(%edx)
+ d74:	eb b9                	jmp    d2f <malloc+0x9f>
+ d76:	66 90                	xchg   %ax,%ax
+ d78:	66 90                	xchg   %ax,%ax
+ d7a:	66 90                	xchg   %ax,%ax
+ d7c:	66 90                	xchg   %ax,%ax
+ d7e:	66 90                	xchg   %ax,%ax
+
+00000d80 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d80:	55                   	push   %ebp
+ d81:	89 e5                	mov    %esp,%ebp
+ d83:	53                   	push   %ebx
+ d84:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ d87:	68 00 20 00 00       	push   $0x2000
+ d8c:	e8 ff fe ff ff       	call   c90 <malloc>
+ d91:	83 c4 10             	add    $0x10,%esp
+ d94:	85 c0                	test   %eax,%eax
+ d96:	74 47                	je     ddf <thread_create+0x5f>
+ d98:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d9a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ da0:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ da3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ da8:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ dab:	ff 75 0c             	push   0xc(%ebp)
+ dae:	50                   	push   %eax
+ daf:	ff 75 08             	push   0x8(%ebp)
+ db2:	e8 6c fa ff ff       	call   823 <clone>
+ db7:	83 c4 10             	add    $0x10,%esp
+ dba:	85 c0                	test   %eax,%eax
+ dbc:	78 0a                	js     dc8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ dbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ dc1:	c9                   	leave
+ dc2:	c3                   	ret
+ dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ dc7:	90                   	nop
+    free(mem);
+ dc8:	83 ec 0c             	sub    $0xc,%esp
+ dcb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dce:	53                   	push   %ebx
+ dcf:	e8 2c fe ff ff       	call   c00 <free>
+ dd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ dd7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ dda:	83 c4 10             	add    $0x10,%esp
+}
+ ddd:	c9                   	leave
+ dde:	c3                   	ret
+    return -1;
+ ddf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ de4:	eb d8                	jmp    dbe <thread_create+0x3e>
+ de6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ded:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000df0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ df0:	55                   	push   %ebp
+ df1:	89 e5                	mov    %esp,%ebp
+ df3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ df4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ df7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ dfa:	50                   	push   %eax
+ dfb:	e8 3d fa ff ff       	call   83d <join>
+ e00:	83 c4 10             	add    $0x10,%esp
+ e03:	85 c0                	test   %eax,%eax
+ e05:	78 21                	js     e28 <thread_join+0x38>
+ e07:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ e09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e0c:	83 ec 0c             	sub    $0xc,%esp
+ e0f:	ff 70 fc             	push   -0x4(%eax)
+ e12:	e8 e9 fd ff ff       	call   c00 <free>
+  return pid;
+ e17:	83 c4 10             	add    $0x10,%esp
+}
+ e1a:	89 d8                	mov    %ebx,%eax
+ e1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ e1f:	c9                   	leave
+ e20:	c3                   	ret
+ e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ e28:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ e2d:	eb eb                	jmp    e1a <thread_join+0x2a>
@@ -0,0 +1,79 @@
+// Timer queue.
+//
+// A process sleeping for a number of ticks puts a timer, on its
+// own kernel stack, on a queue sorted by deadline.  Each tick, CPU 0
+// wakes only the processes whose deadlines have passed, taking them
+// off the front of the queue, instead of waking every sleeper to
+// check the time for itself.  Inserting is linear in the number of
+// sleepers; the tick handler's work is linear in the number expired.
+//
+// The queue is protected by tickslock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+struct timer {
+  uint deadline;        // value of ticks at which to wake
+  struct proc *proc;
+  int expired;
+  struct timer *next;
+};
+
+static struct timer *timerq;  // sorted by deadline
+
+// Deadlines wrap around with ticks; compare by difference.
+static int
+before(uint a, uint b)
+{
+  return (int)(a - b) < 0;
+}
+
+// Sleep for n ticks.  Returns -1 if killed first.
+int
+sleepticks(uint n)
+{
+  struct timer t, **pp;
+
+  acquire(&tickslock);
+  t.deadline = ticks + n;
+  t.proc = myproc();
+  t.expired = n == 0;
+  if(!t.expired){
+    pp = &timerq;
+    while(*pp && !before(t.deadline, (*pp)->deadline))
+      pp = &(*pp)->next;
+    t.next = *pp;
+    *pp = &t;
+  }
+  while(!t.expired){
+    if(myproc()->killed){
+      for(pp = &timerq; *pp != &t; pp = &(*pp)->next)
+        ;
+      *pp = t.next;
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&t, &tickslock);
+  }
+  release(&tickslock);
+  return 0;
+}
+
+// Wake the processes whose deadlines have passed.
+// Called on CPU 0's timer tick with tickslock held.
+void
+timerexpire(void)
+{
+  struct timer *t;
+
+  while((t = timerq) != 0 && !before(ticks, t->deadline)){
+    timerq = t->next;
+    t->expired = 1;
+    wakeproc(t->proc, t);
+  }
+}
@@ -32,10 +32,28 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// System calls made with sysenter come here from sysentry in
+// trapasm.S, bypassing trap()'s dispatch.  Returns with
+// interrupts off, for sysexit.
+void
+sysentertrap(struct trapframe *tf)
+{
+  sti();
+  if(myproc()->killed)
+    exit();
+  myproc()->tf = tf;
+  syscall();
+  if(myproc()->killed)
+    exit();
+  cli();
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+  int resched = 0;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -51,9 +69,11 @@ trap(struct trapframe *tf)
     if(cpuid() == 0){
       acquire(&tickslock);
       ticks++;
-      wakeup(&ticks);
+      vdsotick();
+      timerexpire();
       release(&tickslock);
     }
+    resched = schedtick();
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -71,6 +91,15 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_TLBFLUSH:
+    tlbshootpoll();
+    lapiceoi();
+    break;
+  case T_WAKEUP:
+    // Nothing to do: the interrupt has already ended the hlt
+    // in idle(), and the scheduler will look at its queue.
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -103,10 +132,10 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU when its time slice is up
+  // or a higher priority process is waiting.
   // If interrupts were on while locks held, would need to check nlock.
-  if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(myproc() && myproc()->state == RUNNING && resched)
     yield();
 
   // Check if the process has been killed since we yielded
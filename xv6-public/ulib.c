@@ -3,6 +3,10 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "param.h"
+#include "futex.h"
+#include "clock.h"
+#include "vdso.h"
 
 char*
 strcpy(char *s, const char *t)
@@ -104,3 +108,124 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex(&m->state, FUTEX_WAIT, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+  mutex_lock(m);
+}
+
+static void
+cond_bump(struct cond *c)
+{
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+}
+
+// Clock and pid read straight from the kernel's vdso pages,
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+}
+
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+    pid = getpid();
+  return pid;
+}
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+}
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
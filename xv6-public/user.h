@@ -1,5 +1,21 @@
 struct stat;
 struct rtcdate;
+struct memstat;
+struct pstat;
+struct timespec;
+struct batchcall;
+struct aioring;
+struct sysstat;
+struct traceent;
+
+// Futex-based locks; see ulib.c.
+struct mutex {
+  volatile uint state;  // 0 free, 1 held, 2 held with waiters
+};
+
+struct cond {
+  volatile uint seq;    // bumped by every signal
+};
 
 // system calls
 int fork(void);
@@ -25,6 +41,21 @@ int sleep(int);
 int uptime(void);
 void *mmap(void *addr, int length, int prot, int flags, int fd, int offset);
 int munmap(void *addr, int length);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex(volatile uint*, int, uint);
+int memstat(struct memstat*);
+int nice(int);
+int setpriority(int, int);
+int getpinfo(struct pstat*);
+int settickets(int);
+int clock_gettime(int, struct timespec*);
+int batch(struct batchcall*, int, int);
+struct aioring* aiosetup(void);
+int aioenter(int, int);
+int systrace(int, int);
+int sysstat(int, struct sysstat*);
+int traceread(struct traceent*, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -39,3 +70,16 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
+uint vuptime(void);
+int vgetpid(void);
+uint64 vnsecs(void);
+int vclock_gettime(int, struct timespec*);
@@ -1347,7 +1347,8 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 is NINODE, the most entries kept cached once
+  // unreferenced; going past it checks that none are leaked
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
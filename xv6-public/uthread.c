@@ -0,0 +1,39 @@
+// User-level thread helpers on top of clone() and join().
+// Kept out of ulib.c because they need malloc().
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "mmu.h"
+
+// Start a thread running fn(arg) on a fresh one-page stack.
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+    free(mem);
+  return pid;
+}
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+    return -1;
+  free(((void**)stack)[-1]);
+  return pid;
+}
@@ -0,0 +1,80 @@
+// Kernel data pages mapped read-only into user space.
+//
+// One page, shared by every address space, holds the tick count
+// and the TSC-to-nanoseconds conversion that lapicinit() measured;
+// CPU 0 updates the tick count on every timer interrupt.  A second
+// page per address space holds the pid.  exec(), fork() and
+// userinit() map both, at VDSO and VDSOPROC; freevm() frees the
+// second along with the rest of the user pages but must not free
+// the first, so it unmaps it first.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "vm.h"
+#include "vdso.h"
+
+static struct vdso *vdso;
+
+// Allocate and fill in the shared page.
+// Must run after lapicinit() has calibrated the TSC.
+void
+vdsoinit(void)
+{
+  if((vdso = (struct vdso*)kalloc()) == 0)
+    panic("vdsoinit");
+  memset(vdso, 0, PGSIZE);
+  vdso->sysenter = sysenter;
+  vdso->hz = HZ;
+  tscparams(&vdso->nsmult, &vdso->nsshift, &vdso->tsc0);
+}
+
+// Publish the tick count.  Called on CPU 0's timer tick.
+void
+vdsotick(void)
+{
+  vdso->ticks = ticks;
+}
+
+// Map the shared page and a new per-process page for pid
+// into pgdir.  Returns -1 if out of memory.
+int
+vdsomap(pde_t *pgdir, int pid)
+{
+  char *mem;
+
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  ((struct vdsoproc*)mem)->pid = pid;
+  if(mappages(pgdir, (char*)VDSOPROC, PGSIZE, V2P(mem), PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  if(mappages(pgdir, (char*)VDSO, PGSIZE, V2P(vdso), PTE_U) < 0)
+    return -1;
+  return 0;
+}
+
+// Remove the shared page from pgdir, so that freevm() does
+// not free it.
+void
+vdsounmap(pde_t *pgdir)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, (char*)VDSO, 0)) != 0)
+    *pte = 0;
+}
+
+// Set the pid published in pgdir's per-process page.
+void
+vdsosetpid(pde_t *pgdir, int pid)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, (char*)VDSOPROC, 0)) != 0 && (*pte & PTE_P))
+    ((struct vdsoproc*)P2V(PTE_ADDR(*pte)))->pid = pid;
+}
@@ -0,0 +1,23 @@
+// Read-only pages the kernel maps into every user address space,
+// just below KERNBASE, so user code can read the clock and its pid
+// without a system call (see vdso.c, and the v* functions in ulib.c).
+
+#define VDSO      0x7FFFE000   // struct vdso, one page shared by all
+#define VDSOPROC  0x7FFFF000   // struct vdsoproc, one per address space
+
+#define VDSO_SYSENTER VDSO   // offset of sysenter, for usys.S
+
+#ifndef __ASSEMBLER__
+struct vdso {
+  uint sysenter;         // system calls may use sysenter (see usys.S)
+  volatile uint ticks;   // timer interrupts since boot, as uptime()
+  uint hz;               // ticks per second
+  uint nsmult;           // ns since boot =
+  uint nsshift;          //   (rdtsc() - tsc0) * nsmult >> nsshift
+  uint64 tsc0;
+};
+
+struct vdsoproc {
+  int pid;               // 0 if threads share the page: ask getpid()
+};
+#endif
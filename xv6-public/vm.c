@@ -6,11 +6,14 @@
 #include "mmu.h"
 #include "proc.h"
 #include "elf.h"
+#include "traps.h"
 #include "vm.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
+static void sysenterinit(void);
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -28,6 +31,30 @@ seginit(void)
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
   lgdt(c->gdt, sizeof(c->gdt));
+  sysenterinit();
+}
+
+// Let user code enter the kernel with sysenter, if this CPU has
+// it.  sysenter loads %cs from MSR_SYSENTER_CS and %ss from the
+// next descriptor, and sysexit the user %cs and %ss from the two
+// after that, which is the order of the SEG_ descriptors.
+// switchuvm() points MSR_SYSENTER_ESP at each process's kernel
+// stack.  int $T_SYSCALL keeps working either way.
+int sysenter;
+
+static void
+sysenterinit(void)
+{
+  extern char sysentry[];
+  uint edx;
+
+  cpuidinfo(1, 0, 0, 0, &edx);
+  if((edx & CPUID_SEP) == 0)
+    return;
+  wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+  wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+  wrmsr(MSR_SYSENTER_ESP, 0);
+  sysenter = 1;
 }
 
 // Return the address of the PTE in page table pgdir
@@ -93,16 +120,23 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP,
+//   data..KERNBASE+phystop: mapped to V2P(data)..phystop,
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (phystop, found by
+// physmeminit()) (directly addressable from end..P2V(phystop)).
+// Memory above the first 4MB is mapped with 4MB pages, so that a
+// large machine does not need a page-table page per 4MB.
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  They are marked PTE_G so that, once
+// pgeinit() has turned on CR4.PGE, their TLB entries survive the
+// lcr3() in switchuvm() and switchkvm(); only user entries are
+// flushed on a context switch.
+#define KMAP4K (4*1024*1024)  // end of memory mapped with 4KB pages
+
 static struct kmap {
   void *virt;
   uint phys_start;
@@ -111,40 +145,69 @@ static struct kmap {
 } kmap[] = {
  { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
  { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
+ { (void*)data,     V2P(data),     KMAP4K,    PTE_W}, // kern data+memory
  { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
 };
 
 // Set up kernel part of a page table.
+// The kernel half is built once, in kpgdir, by kvmalloc().  Every
+// other page table shares kpgdir's page-table pages by copying its
+// PDEs for KERNBASE and above, so kernel mappings must all be in
+// place before the first user page table is made, and freevm()
+// must never free page-table pages above KERNBASE.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (P2V(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
-      freevm(pgdir);
-      return 0;
-    }
+  memset(pgdir, 0, PDX(KERNBASE)*sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES-PDX(KERNBASE))*sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes.  Its kernel half is shared by
+// every page table that setupkvm() makes.
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+  uint pa;
+
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+    panic("kvmalloc");
+  memset(kpgdir, 0, PGSIZE);
+  if (P2V(phystop) > (void*)DEVSPACE)
+    panic("phystop too high");
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(mappages(kpgdir, k->virt, k->phys_end - k->phys_start,
+                (uint)k->phys_start, k->perm | PTE_G) < 0)
+      panic("kvmalloc: mappages");
+  for(pa = KMAP4K; pa < phystop; pa += 1<<PDXSHIFT)
+    kpgdir[PDX(P2V(pa))] = pa | PTE_P | PTE_W | PTE_PS | PTE_G;
   switchkvm();
 }
 
+// Turn on global pages on this CPU, if it has them, so the PTE_G
+// kernel mappings stay in the TLB across page table switches.
+// Run once on each CPU after kvmalloc().  A NOPGE build leaves
+// CR4.PGE off; the CPU then ignores PTE_G.
+void
+pgeinit(void)
+{
+  uint edx;
+
+#ifdef NOPGE
+  return;
+#endif
+  cpuidinfo(1, 0, 0, 0, &edx);
+  if(edx & CPUID_PGE)
+    lcr4(rcr4() | CR4_PGE);
+}
+
 // Switch h/w page table register to the kernel-only page table,
 // for when no process is running.
 void
@@ -174,10 +237,109 @@ switchuvm(struct proc *p)
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
+  if(sysenter)
+    wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
   lcr3(V2P(p->pgdir));  // switch to process's address space
   popcli();
 }
 
+//PAGEBREAK!
+// TLB invalidation.
+//
+// A CPU caches translations from the page table it is running on,
+// so clearing or restricting a present PTE in a page table that is
+// loaded somewhere must be followed by a flush on every such CPU.
+// Locally that is an invlpg per page.  Other CPUs that may be
+// running on the same page table (threads sharing pgdir) are sent a
+// T_TLBFLUSH IPI and flush the same range themselves.
+//
+// Only one shootdown is in flight at a time.  CPUs waiting for it,
+// or spinning in acquire() with interrupts off, call tlbshootpoll()
+// so that two CPUs shooting at each other cannot deadlock.
+
+#define TLBFLUSHMAX 32  // above this many pages, reload cr3 instead
+
+static struct {
+  volatile uint busy;       // a shootdown is being set up or is in flight
+  pde_t *volatile pgdir;    // page table whose entries changed
+  volatile uint va;         // first page to flush
+  volatile uint npages;     // number of pages to flush
+  volatile uint pending;    // bit per CPU that has not flushed yet
+} tlbshoot;
+
+// Flush npages pages at va from this CPU's TLB if pgdir is loaded.
+static void
+tlbflushlocal(pde_t *pgdir, uint va, uint npages)
+{
+  uint i;
+
+  if(rcr3() != V2P(pgdir))
+    return;
+  if(npages > TLBFLUSHMAX){
+    lcr3(V2P(pgdir));
+    return;
+  }
+  for(i = 0; i < npages; i++)
+    invlpg((char*)va + i*PGSIZE);
+}
+
+// Service a shootdown directed at this CPU, if there is one.
+// Called from the T_TLBFLUSH handler and from spin loops;
+// interrupts must be disabled.
+void
+tlbshootpoll(void)
+{
+  uint bit;
+
+  if(tlbshoot.pending == 0)
+    return;
+  bit = 1 << cpuid();
+  if((tlbshoot.pending & bit) == 0)
+    return;
+  tlbflushlocal(tlbshoot.pgdir, tlbshoot.va, tlbshoot.npages);
+  __sync_fetch_and_and(&tlbshoot.pending, ~bit);
+}
+
+// Invalidate the TLB entries for npages pages starting at va in
+// pgdir, on this CPU and on any other CPU running on pgdir.
+// Call after changing the PTEs and before freeing the pages they
+// pointed to.  Must not be called while holding a spinlock that
+// another CPU might be waiting for with interrupts enabled.
+void
+tlbinval(pde_t *pgdir, uint va, uint npages)
+{
+  struct cpu *c, *me;
+  uint mask;
+
+  if(npages == 0)
+    return;
+  va = PGROUNDDOWN(va);
+  pushcli();
+  me = mycpu();
+  tlbflushlocal(pgdir, va, npages);
+
+  mask = 0;
+  for(c = cpus; c < cpus+ncpu; c++)
+    if(c != me && c->proc && c->proc->pgdir == pgdir)
+      mask |= 1 << (c - cpus);
+  if(mask){
+    while(xchg(&tlbshoot.busy, 1) != 0)
+      tlbshootpoll();
+    tlbshoot.pgdir = pgdir;
+    tlbshoot.va = va;
+    tlbshoot.npages = npages;
+    __sync_synchronize();
+    tlbshoot.pending = mask;
+    for(c = cpus; c < cpus+ncpu; c++)
+      if(mask & (1 << (c - cpus)))
+        lapicsendipi(c->apicid, T_TLBFLUSH);
+    while(tlbshoot.pending)
+      ;
+    xchg(&tlbshoot.busy, 0);
+  }
+  popcli();
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -279,6 +441,39 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Like deallocuvm(), but for a page table that other CPUs may be
+// running on (threads sharing an address space): the PTEs are
+// cleared and shot down from every TLB before the pages are freed.
+// Returns the new process size.
+int
+shrinkuvm(pde_t *pgdir, uint oldsz, uint newsz)
+{
+  pte_t *pte;
+  uint a;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else
+      *pte &= ~PTE_P;
+  }
+  tlbinval(pgdir, PGROUNDUP(newsz), (PGROUNDUP(oldsz) - PGROUNDUP(newsz)) / PGSIZE);
+  for(a = PGROUNDUP(newsz); a < oldsz; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte != 0){
+      kfree(P2V(PTE_ADDR(*pte)));
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -288,8 +483,10 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
+  vdsounmap(pgdir);
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  // Page-table pages above KERNBASE belong to kpgdir (see setupkvm).
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -353,7 +550,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -0,0 +1,12 @@
+// An address space: the page table and memory mappings shared by a
+// process and the threads it creates with clone().  Each proc keeps
+// a copy of pgdir in p->pgdir; the page table is freed only when
+// the last proc using it is reaped.  Needs sleeplock.h and proc.h.
+struct vmspace {
+  int ref;                       // procs using this address space
+  pde_t *pgdir;                  // page table
+  struct sleeplock lock;         // serializes mmap, munmap, sbrk and aiosetup
+  struct mmap mmaps[MAX_MMAPS];  // Array to hold memory mappings
+  int num_mmaps;                 // Number of active memory mappings
+  struct aioctx *aio;            // Asynchronous I/O rings, or 0 (see aio.c)
+};
@@ -0,0 +1,2143 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 00 07 00 00       	call   749 <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 3a 07 00 00       	call   797 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 33 0f 00 00       	push   $0xf33
+  6e:	6a 01                	push   $0x1
+  70:	e8 bb 0a 00 00       	call   b30 <printf>
+      exit();
+  75:	e8 4d 06 00 00       	call   6c7 <exit>
+  }
+  exit();
+  7a:	e8 48 06 00 00       	call   6c7 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 25 0f 00 00       	push   $0xf25
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 35 06 00 00       	call   6c7 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 80 14 00 00       	push   $0x1480
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 40 06 00 00       	call   715 <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 80 14 00 00 	movsbl 0x1480(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 10 0f 00 00       	push   $0xf10
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 26 0f 00 00       	push   $0xf26
+ 155:	6a 01                	push   $0x1
+ 157:	e8 d4 09 00 00       	call   b30 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 16 0f 00 00       	push   $0xf16
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 bb 09 00 00       	call   b30 <printf>
+    exit();
+ 175:	e8 4d 05 00 00       	call   6c7 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 58 04 00 00       	call   715 <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 85 04 00 00       	call   797 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 be 04 00 00       	call   7e5 <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 18 04 00 00       	call   749 <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 3d0:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3d1:	31 c0                	xor    %eax,%eax
+ 3d3:	ba 01 00 00 00       	mov    $0x1,%edx
+ 3d8:	89 e5                	mov    %esp,%ebp
+ 3da:	56                   	push   %esi
+ 3db:	53                   	push   %ebx
+ 3dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3df:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3e3:	85 c0                	test   %eax,%eax
+ 3e5:	74 32                	je     419 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 3e7:	83 f8 02             	cmp    $0x2,%eax
+ 3ea:	74 0c                	je     3f8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 3ec:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3f1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 3f4:	85 c0                	test   %eax,%eax
+ 3f6:	74 21                	je     419 <mutex_lock+0x49>
+ 3f8:	be 02 00 00 00       	mov    $0x2,%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 02                	push   $0x2
+ 405:	6a 00                	push   $0x0
+ 407:	53                   	push   %ebx
+ 408:	e8 2a 05 00 00       	call   937 <futex>
+ 40d:	89 f0                	mov    %esi,%eax
+ 40f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	75 e7                	jne    400 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 419:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 41c:	5b                   	pop    %ebx
+ 41d:	5e                   	pop    %esi
+ 41e:	5d                   	pop    %ebp
+ 41f:	c3                   	ret
+
+00000420 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	31 c0                	xor    %eax,%eax
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	83 ec 08             	sub    $0x8,%esp
+ 428:	8b 55 08             	mov    0x8(%ebp),%edx
+ 42b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 42e:	83 f8 02             	cmp    $0x2,%eax
+ 431:	74 05                	je     438 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 433:	c9                   	leave
+ 434:	c3                   	ret
+ 435:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 438:	83 ec 04             	sub    $0x4,%esp
+ 43b:	6a 01                	push   $0x1
+ 43d:	6a 01                	push   $0x1
+ 43f:	52                   	push   %edx
+ 440:	e8 f2 04 00 00       	call   937 <futex>
+ 445:	83 c4 10             	add    $0x10,%esp
+}
+ 448:	c9                   	leave
+ 449:	c3                   	ret
+ 44a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000450 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 45c:	5d                   	pop    %ebp
+ 45d:	c3                   	ret
+ 45e:	66 90                	xchg   %ax,%ax
+
+00000460 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 460:	55                   	push   %ebp
+ 461:	31 c0                	xor    %eax,%eax
+ 463:	89 e5                	mov    %esp,%ebp
+ 465:	57                   	push   %edi
+ 466:	56                   	push   %esi
+ 467:	53                   	push   %ebx
+ 468:	83 ec 0c             	sub    $0xc,%esp
+ 46b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 46e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 471:	8b 3e                	mov    (%esi),%edi
+ 473:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 476:	83 f8 02             	cmp    $0x2,%eax
+ 479:	74 5d                	je     4d8 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 47b:	83 ec 04             	sub    $0x4,%esp
+ 47e:	57                   	push   %edi
+ 47f:	6a 00                	push   $0x0
+ 481:	56                   	push   %esi
+ 482:	e8 b0 04 00 00       	call   937 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 487:	31 c0                	xor    %eax,%eax
+ 489:	ba 01 00 00 00       	mov    $0x1,%edx
+ 48e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	74 30                	je     4c9 <cond_wait+0x69>
+  if(c != 2)
+ 499:	83 f8 02             	cmp    $0x2,%eax
+ 49c:	74 0c                	je     4aa <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 49e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a3:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 4a6:	85 c0                	test   %eax,%eax
+ 4a8:	74 1f                	je     4c9 <cond_wait+0x69>
+ 4aa:	be 02 00 00 00       	mov    $0x2,%esi
+ 4af:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 4b0:	83 ec 04             	sub    $0x4,%esp
+ 4b3:	6a 02                	push   $0x2
+ 4b5:	6a 00                	push   $0x0
+ 4b7:	53                   	push   %ebx
+ 4b8:	e8 7a 04 00 00       	call   937 <futex>
+ 4bd:	89 f0                	mov    %esi,%eax
+ 4bf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 4c2:	83 c4 10             	add    $0x10,%esp
+ 4c5:	85 c0                	test   %eax,%eax
+ 4c7:	75 e7                	jne    4b0 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 4c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cc:	5b                   	pop    %ebx
+ 4cd:	5e                   	pop    %esi
+ 4ce:	5f                   	pop    %edi
+ 4cf:	5d                   	pop    %ebp
+ 4d0:	c3                   	ret
+ 4d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4d8:	83 ec 04             	sub    $0x4,%esp
+ 4db:	6a 01                	push   $0x1
+ 4dd:	6a 01                	push   $0x1
+ 4df:	53                   	push   %ebx
+ 4e0:	e8 52 04 00 00       	call   937 <futex>
+ 4e5:	83 c4 10             	add    $0x10,%esp
+ 4e8:	eb 91                	jmp    47b <cond_wait+0x1b>
+ 4ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004f0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	53                   	push   %ebx
+ 4f4:	83 ec 04             	sub    $0x4,%esp
+ 4f7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 4fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 500:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 502:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 505:	89 c8                	mov    %ecx,%eax
+ 507:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 50b:	39 c1                	cmp    %eax,%ecx
+ 50d:	75 f1                	jne    500 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 50f:	83 ec 04             	sub    $0x4,%esp
+ 512:	6a 01                	push   $0x1
+ 514:	6a 01                	push   $0x1
+ 516:	52                   	push   %edx
+ 517:	e8 1b 04 00 00       	call   937 <futex>
+}
+ 51c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 51f:	83 c4 10             	add    $0x10,%esp
+ 522:	c9                   	leave
+ 523:	c3                   	ret
+ 524:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+
+00000530 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	83 ec 04             	sub    $0x4,%esp
+ 537:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 540:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 542:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 545:	89 c8                	mov    %ecx,%eax
+ 547:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 54b:	39 c1                	cmp    %eax,%ecx
+ 54d:	75 f1                	jne    540 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 54f:	83 ec 04             	sub    $0x4,%esp
+ 552:	6a 40                	push   $0x40
+ 554:	6a 01                	push   $0x1
+ 556:	52                   	push   %edx
+ 557:	e8 db 03 00 00       	call   937 <futex>
+}
+ 55c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	c9                   	leave
+ 563:	c3                   	ret
+ 564:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 570:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 575:	c3                   	ret
+ 576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 57d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000580 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 580:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 585:	85 c0                	test   %eax,%eax
+ 587:	74 07                	je     590 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 589:	c3                   	ret
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 590:	e9 d2 02 00 00       	jmp    867 <getpid>
+ 595:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005a0 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 5a9:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 5ab:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 5b1:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5b7:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5bc:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 5c2:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 5c5:	89 d0                	mov    %edx,%eax
+ 5c7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 5ca:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5d0:	29 d9                	sub    %ebx,%ecx
+ 5d2:	89 c6                	mov    %eax,%esi
+ 5d4:	89 d7                	mov    %edx,%edi
+ 5d6:	0f a5 c7             	shld   %cl,%eax,%edi
+ 5d9:	d3 e6                	shl    %cl,%esi
+ 5db:	31 c0                	xor    %eax,%eax
+ 5dd:	f6 c1 20             	test   $0x20,%cl
+ 5e0:	0f 45 fe             	cmovne %esi,%edi
+ 5e3:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 5e6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 5e9:	89 d9                	mov    %ebx,%ecx
+ 5eb:	31 db                	xor    %ebx,%ebx
+ 5ed:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 5f3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 5f6:	d3 ea                	shr    %cl,%edx
+ 5f8:	f6 c1 20             	test   $0x20,%cl
+ 5fb:	0f 45 c2             	cmovne %edx,%eax
+ 5fe:	0f 45 d3             	cmovne %ebx,%edx
+ 601:	01 f0                	add    %esi,%eax
+ 603:	11 fa                	adc    %edi,%edx
+}
+ 605:	83 c4 0c             	add    $0xc,%esp
+ 608:	5b                   	pop    %ebx
+ 609:	5e                   	pop    %esi
+ 60a:	5f                   	pop    %edi
+ 60b:	5d                   	pop    %ebp
+ 60c:	c3                   	ret
+ 60d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000610 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	57                   	push   %edi
+ 614:	56                   	push   %esi
+ 615:	53                   	push   %ebx
+ 616:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 619:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 61d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 620:	74 0e                	je     630 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 622:	83 c4 1c             	add    $0x1c,%esp
+ 625:	5b                   	pop    %ebx
+ 626:	5e                   	pop    %esi
+ 627:	5f                   	pop    %edi
+ 628:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 629:	e9 a5 03 00 00       	jmp    9d3 <clock_gettime>
+ 62e:	66 90                	xchg   %ax,%ax
+ 630:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 632:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 638:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 63e:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 643:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 646:	89 d0                	mov    %edx,%eax
+ 648:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 64b:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 651:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 657:	89 c6                	mov    %eax,%esi
+ 659:	89 d7                	mov    %edx,%edi
+ 65b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 65e:	d3 e6                	shl    %cl,%esi
+ 660:	31 c0                	xor    %eax,%eax
+ 662:	f6 c1 20             	test   $0x20,%cl
+ 665:	0f 45 fe             	cmovne %esi,%edi
+ 668:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 66b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 66e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 675:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 67b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 67e:	d3 ea                	shr    %cl,%edx
+ 680:	f6 c1 20             	test   $0x20,%cl
+ 683:	74 04                	je     689 <vclock_gettime+0x79>
+ 685:	89 d0                	mov    %edx,%eax
+ 687:	31 d2                	xor    %edx,%edx
+ 689:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 68b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 690:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 692:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 694:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 696:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 698:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 69e:	29 c1                	sub    %eax,%ecx
+}
+ 6a0:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 6a2:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 6a5:	83 c4 1c             	add    $0x1c,%esp
+ 6a8:	5b                   	pop    %ebx
+ 6a9:	5e                   	pop    %esi
+ 6aa:	5f                   	pop    %edi
+ 6ab:	5d                   	pop    %ebp
+ 6ac:	c3                   	ret
+
+000006ad <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 6ad:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6b2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6b9:	74 09                	je     6c4 <fork+0x17>
+ 6bb:	89 e1                	mov    %esp,%ecx
+ 6bd:	ba c6 06 00 00       	mov    $0x6c6,%edx
+ 6c2:	0f 34                	sysenter
+ 6c4:	cd 40                	int    $0x40
+ 6c6:	c3                   	ret
+
+000006c7 <exit>:
+SYSCALL(exit)
+ 6c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6cc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6d3:	74 09                	je     6de <exit+0x17>
+ 6d5:	89 e1                	mov    %esp,%ecx
+ 6d7:	ba e0 06 00 00       	mov    $0x6e0,%edx
+ 6dc:	0f 34                	sysenter
+ 6de:	cd 40                	int    $0x40
+ 6e0:	c3                   	ret
+
+000006e1 <wait>:
+SYSCALL(wait)
+ 6e1:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6e6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6ed:	74 09                	je     6f8 <wait+0x17>
+ 6ef:	89 e1                	mov    %esp,%ecx
+ 6f1:	ba fa 06 00 00       	mov    $0x6fa,%edx
+ 6f6:	0f 34                	sysenter
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <pipe>:
+SYSCALL(pipe)
+ 6fb:	b8 04 00 00 00       	mov    $0x4,%eax
+ 700:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 707:	74 09                	je     712 <pipe+0x17>
+ 709:	89 e1                	mov    %esp,%ecx
+ 70b:	ba 14 07 00 00       	mov    $0x714,%edx
+ 710:	0f 34                	sysenter
+ 712:	cd 40                	int    $0x40
+ 714:	c3                   	ret
+
+00000715 <read>:
+SYSCALL(read)
+ 715:	b8 05 00 00 00       	mov    $0x5,%eax
+ 71a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 721:	74 09                	je     72c <read+0x17>
+ 723:	89 e1                	mov    %esp,%ecx
+ 725:	ba 2e 07 00 00       	mov    $0x72e,%edx
+ 72a:	0f 34                	sysenter
+ 72c:	cd 40                	int    $0x40
+ 72e:	c3                   	ret
+
+0000072f <write>:
+SYSCALL(write)
+ 72f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 734:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 73b:	74 09                	je     746 <write+0x17>
+ 73d:	89 e1                	mov    %esp,%ecx
+ 73f:	ba 48 07 00 00       	mov    $0x748,%edx
+ 744:	0f 34                	sysenter
+ 746:	cd 40                	int    $0x40
+ 748:	c3                   	ret
+
+00000749 <close>:
+SYSCALL(close)
+ 749:	b8 15 00 00 00       	mov    $0x15,%eax
+ 74e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 755:	74 09                	je     760 <close+0x17>
+ 757:	89 e1                	mov    %esp,%ecx
+ 759:	ba 62 07 00 00       	mov    $0x762,%edx
+ 75e:	0f 34                	sysenter
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <kill>:
+SYSCALL(kill)
+ 763:	b8 06 00 00 00       	mov    $0x6,%eax
+ 768:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 76f:	74 09                	je     77a <kill+0x17>
+ 771:	89 e1                	mov    %esp,%ecx
+ 773:	ba 7c 07 00 00       	mov    $0x77c,%edx
+ 778:	0f 34                	sysenter
+ 77a:	cd 40                	int    $0x40
+ 77c:	c3                   	ret
+
+0000077d <exec>:
+SYSCALL(exec)
+ 77d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 782:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 789:	74 09                	je     794 <exec+0x17>
+ 78b:	89 e1                	mov    %esp,%ecx
+ 78d:	ba 96 07 00 00       	mov    $0x796,%edx
+ 792:	0f 34                	sysenter
+ 794:	cd 40                	int    $0x40
+ 796:	c3                   	ret
+
+00000797 <open>:
+SYSCALL(open)
+ 797:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 79c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a3:	74 09                	je     7ae <open+0x17>
+ 7a5:	89 e1                	mov    %esp,%ecx
+ 7a7:	ba b0 07 00 00       	mov    $0x7b0,%edx
+ 7ac:	0f 34                	sysenter
+ 7ae:	cd 40                	int    $0x40
+ 7b0:	c3                   	ret
+
+000007b1 <mknod>:
+SYSCALL(mknod)
+ 7b1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7b6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7bd:	74 09                	je     7c8 <mknod+0x17>
+ 7bf:	89 e1                	mov    %esp,%ecx
+ 7c1:	ba ca 07 00 00       	mov    $0x7ca,%edx
+ 7c6:	0f 34                	sysenter
+ 7c8:	cd 40                	int    $0x40
+ 7ca:	c3                   	ret
+
+000007cb <unlink>:
+SYSCALL(unlink)
+ 7cb:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7d0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d7:	74 09                	je     7e2 <unlink+0x17>
+ 7d9:	89 e1                	mov    %esp,%ecx
+ 7db:	ba e4 07 00 00       	mov    $0x7e4,%edx
+ 7e0:	0f 34                	sysenter
+ 7e2:	cd 40                	int    $0x40
+ 7e4:	c3                   	ret
+
+000007e5 <fstat>:
+SYSCALL(fstat)
+ 7e5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ea:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f1:	74 09                	je     7fc <fstat+0x17>
+ 7f3:	89 e1                	mov    %esp,%ecx
+ 7f5:	ba fe 07 00 00       	mov    $0x7fe,%edx
+ 7fa:	0f 34                	sysenter
+ 7fc:	cd 40                	int    $0x40
+ 7fe:	c3                   	ret
+
+000007ff <link>:
+SYSCALL(link)
+ 7ff:	b8 13 00 00 00       	mov    $0x13,%eax
+ 804:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 80b:	74 09                	je     816 <link+0x17>
+ 80d:	89 e1                	mov    %esp,%ecx
+ 80f:	ba 18 08 00 00       	mov    $0x818,%edx
+ 814:	0f 34                	sysenter
+ 816:	cd 40                	int    $0x40
+ 818:	c3                   	ret
+
+00000819 <mkdir>:
+SYSCALL(mkdir)
+ 819:	b8 14 00 00 00       	mov    $0x14,%eax
+ 81e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 825:	74 09                	je     830 <mkdir+0x17>
+ 827:	89 e1                	mov    %esp,%ecx
+ 829:	ba 32 08 00 00       	mov    $0x832,%edx
+ 82e:	0f 34                	sysenter
+ 830:	cd 40                	int    $0x40
+ 832:	c3                   	ret
+
+00000833 <chdir>:
+SYSCALL(chdir)
+ 833:	b8 09 00 00 00       	mov    $0x9,%eax
+ 838:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 83f:	74 09                	je     84a <chdir+0x17>
+ 841:	89 e1                	mov    %esp,%ecx
+ 843:	ba 4c 08 00 00       	mov    $0x84c,%edx
+ 848:	0f 34                	sysenter
+ 84a:	cd 40                	int    $0x40
+ 84c:	c3                   	ret
+
+0000084d <dup>:
+SYSCALL(dup)
+ 84d:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 852:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 859:	74 09                	je     864 <dup+0x17>
+ 85b:	89 e1                	mov    %esp,%ecx
+ 85d:	ba 66 08 00 00       	mov    $0x866,%edx
+ 862:	0f 34                	sysenter
+ 864:	cd 40                	int    $0x40
+ 866:	c3                   	ret
+
+00000867 <getpid>:
+SYSCALL(getpid)
+ 867:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 86c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 873:	74 09                	je     87e <getpid+0x17>
+ 875:	89 e1                	mov    %esp,%ecx
+ 877:	ba 80 08 00 00       	mov    $0x880,%edx
+ 87c:	0f 34                	sysenter
+ 87e:	cd 40                	int    $0x40
+ 880:	c3                   	ret
+
+00000881 <sbrk>:
+SYSCALL(sbrk)
+ 881:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 886:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 88d:	74 09                	je     898 <sbrk+0x17>
+ 88f:	89 e1                	mov    %esp,%ecx
+ 891:	ba 9a 08 00 00       	mov    $0x89a,%edx
+ 896:	0f 34                	sysenter
+ 898:	cd 40                	int    $0x40
+ 89a:	c3                   	ret
+
+0000089b <sleep>:
+SYSCALL(sleep)
+ 89b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8a0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a7:	74 09                	je     8b2 <sleep+0x17>
+ 8a9:	89 e1                	mov    %esp,%ecx
+ 8ab:	ba b4 08 00 00       	mov    $0x8b4,%edx
+ 8b0:	0f 34                	sysenter
+ 8b2:	cd 40                	int    $0x40
+ 8b4:	c3                   	ret
+
+000008b5 <uptime>:
+SYSCALL(uptime)
+ 8b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8ba:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c1:	74 09                	je     8cc <uptime+0x17>
+ 8c3:	89 e1                	mov    %esp,%ecx
+ 8c5:	ba ce 08 00 00       	mov    $0x8ce,%edx
+ 8ca:	0f 34                	sysenter
+ 8cc:	cd 40                	int    $0x40
+ 8ce:	c3                   	ret
+
+000008cf <mmap>:
+SYSCALL(mmap)
+ 8cf:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8d4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8db:	74 09                	je     8e6 <mmap+0x17>
+ 8dd:	89 e1                	mov    %esp,%ecx
+ 8df:	ba e8 08 00 00       	mov    $0x8e8,%edx
+ 8e4:	0f 34                	sysenter
+ 8e6:	cd 40                	int    $0x40
+ 8e8:	c3                   	ret
+
+000008e9 <munmap>:
+SYSCALL(munmap)
+ 8e9:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8ee:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f5:	74 09                	je     900 <munmap+0x17>
+ 8f7:	89 e1                	mov    %esp,%ecx
+ 8f9:	ba 02 09 00 00       	mov    $0x902,%edx
+ 8fe:	0f 34                	sysenter
+ 900:	cd 40                	int    $0x40
+ 902:	c3                   	ret
+
+00000903 <clone>:
+SYSCALL(clone)
+ 903:	b8 18 00 00 00       	mov    $0x18,%eax
+ 908:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 90f:	74 09                	je     91a <clone+0x17>
+ 911:	89 e1                	mov    %esp,%ecx
+ 913:	ba 1c 09 00 00       	mov    $0x91c,%edx
+ 918:	0f 34                	sysenter
+ 91a:	cd 40                	int    $0x40
+ 91c:	c3                   	ret
+
+0000091d <join>:
+SYSCALL(join)
+ 91d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 922:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 929:	74 09                	je     934 <join+0x17>
+ 92b:	89 e1                	mov    %esp,%ecx
+ 92d:	ba 36 09 00 00       	mov    $0x936,%edx
+ 932:	0f 34                	sysenter
+ 934:	cd 40                	int    $0x40
+ 936:	c3                   	ret
+
+00000937 <futex>:
+SYSCALL(futex)
+ 937:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 93c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 943:	74 09                	je     94e <futex+0x17>
+ 945:	89 e1                	mov    %esp,%ecx
+ 947:	ba 50 09 00 00       	mov    $0x950,%edx
+ 94c:	0f 34                	sysenter
+ 94e:	cd 40                	int    $0x40
+ 950:	c3                   	ret
+
+00000951 <memstat>:
+SYSCALL(memstat)
+ 951:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 956:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 95d:	74 09                	je     968 <memstat+0x17>
+ 95f:	89 e1                	mov    %esp,%ecx
+ 961:	ba 6a 09 00 00       	mov    $0x96a,%edx
+ 966:	0f 34                	sysenter
+ 968:	cd 40                	int    $0x40
+ 96a:	c3                   	ret
+
+0000096b <nice>:
+SYSCALL(nice)
+ 96b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 970:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 977:	74 09                	je     982 <nice+0x17>
+ 979:	89 e1                	mov    %esp,%ecx
+ 97b:	ba 84 09 00 00       	mov    $0x984,%edx
+ 980:	0f 34                	sysenter
+ 982:	cd 40                	int    $0x40
+ 984:	c3                   	ret
+
+00000985 <setpriority>:
+SYSCALL(setpriority)
+ 985:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 98a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 991:	74 09                	je     99c <setpriority+0x17>
+ 993:	89 e1                	mov    %esp,%ecx
+ 995:	ba 9e 09 00 00       	mov    $0x99e,%edx
+ 99a:	0f 34                	sysenter
+ 99c:	cd 40                	int    $0x40
+ 99e:	c3                   	ret
+
+0000099f <getpinfo>:
+SYSCALL(getpinfo)
+ 99f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9a4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9ab:	74 09                	je     9b6 <getpinfo+0x17>
+ 9ad:	89 e1                	mov    %esp,%ecx
+ 9af:	ba b8 09 00 00       	mov    $0x9b8,%edx
+ 9b4:	0f 34                	sysenter
+ 9b6:	cd 40                	int    $0x40
+ 9b8:	c3                   	ret
+
+000009b9 <settickets>:
+SYSCALL(settickets)
+ 9b9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9be:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9c5:	74 09                	je     9d0 <settickets+0x17>
+ 9c7:	89 e1                	mov    %esp,%ecx
+ 9c9:	ba d2 09 00 00       	mov    $0x9d2,%edx
+ 9ce:	0f 34                	sysenter
+ 9d0:	cd 40                	int    $0x40
+ 9d2:	c3                   	ret
+
+000009d3 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 9d3:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9d8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9df:	74 09                	je     9ea <clock_gettime+0x17>
+ 9e1:	89 e1                	mov    %esp,%ecx
+ 9e3:	ba ec 09 00 00       	mov    $0x9ec,%edx
+ 9e8:	0f 34                	sysenter
+ 9ea:	cd 40                	int    $0x40
+ 9ec:	c3                   	ret
+
+000009ed <batch>:
+SYSCALL(batch)
+ 9ed:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9f2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 9f9:	74 09                	je     a04 <batch+0x17>
+ 9fb:	89 e1                	mov    %esp,%ecx
+ 9fd:	ba 06 0a 00 00       	mov    $0xa06,%edx
+ a02:	0f 34                	sysenter
+ a04:	cd 40                	int    $0x40
+ a06:	c3                   	ret
+
+00000a07 <aiosetup>:
+SYSCALL(aiosetup)
+ a07:	b8 22 00 00 00       	mov    $0x22,%eax
+ a0c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a13:	74 09                	je     a1e <aiosetup+0x17>
+ a15:	89 e1                	mov    %esp,%ecx
+ a17:	ba 20 0a 00 00       	mov    $0xa20,%edx
+ a1c:	0f 34                	sysenter
+ a1e:	cd 40                	int    $0x40
+ a20:	c3                   	ret
+
+00000a21 <aioenter>:
+SYSCALL(aioenter)
+ a21:	b8 23 00 00 00       	mov    $0x23,%eax
+ a26:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a2d:	74 09                	je     a38 <aioenter+0x17>
+ a2f:	89 e1                	mov    %esp,%ecx
+ a31:	ba 3a 0a 00 00       	mov    $0xa3a,%edx
+ a36:	0f 34                	sysenter
+ a38:	cd 40                	int    $0x40
+ a3a:	c3                   	ret
+
+00000a3b <systrace>:
+SYSCALL(systrace)
+ a3b:	b8 24 00 00 00       	mov    $0x24,%eax
+ a40:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a47:	74 09                	je     a52 <systrace+0x17>
+ a49:	89 e1                	mov    %esp,%ecx
+ a4b:	ba 54 0a 00 00       	mov    $0xa54,%edx
+ a50:	0f 34                	sysenter
+ a52:	cd 40                	int    $0x40
+ a54:	c3                   	ret
+
+00000a55 <sysstat>:
+SYSCALL(sysstat)
+ a55:	b8 25 00 00 00       	mov    $0x25,%eax
+ a5a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a61:	74 09                	je     a6c <sysstat+0x17>
+ a63:	89 e1                	mov    %esp,%ecx
+ a65:	ba 6e 0a 00 00       	mov    $0xa6e,%edx
+ a6a:	0f 34                	sysenter
+ a6c:	cd 40                	int    $0x40
+ a6e:	c3                   	ret
+
+00000a6f <traceread>:
+SYSCALL(traceread)
+ a6f:	b8 26 00 00 00       	mov    $0x26,%eax
+ a74:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ a7b:	74 09                	je     a86 <traceread+0x17>
+ a7d:	89 e1                	mov    %esp,%ecx
+ a7f:	ba 88 0a 00 00       	mov    $0xa88,%edx
+ a84:	0f 34                	sysenter
+ a86:	cd 40                	int    $0x40
+ a88:	c3                   	ret
+ a89:	66 90                	xchg   %ax,%ax
+ a8b:	66 90                	xchg   %ax,%ax
+ a8d:	66 90                	xchg   %ax,%ax
+ a8f:	90                   	nop
+
+00000a90 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ a98:	89 d1                	mov    %edx,%ecx
+{
+ a9a:	83 ec 3c             	sub    $0x3c,%esp
+ a9d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ aa0:	85 d2                	test   %edx,%edx
+ aa2:	0f 89 80 00 00 00    	jns    b28 <printint+0x98>
+ aa8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ aac:	74 7a                	je     b28 <printint+0x98>
+    x = -xx;
+ aae:	f7 d9                	neg    %ecx
+    neg = 1;
+ ab0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ ab5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ ab8:	31 f6                	xor    %esi,%esi
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ ac0:	89 c8                	mov    %ecx,%eax
+ ac2:	31 d2                	xor    %edx,%edx
+ ac4:	89 f7                	mov    %esi,%edi
+ ac6:	f7 f3                	div    %ebx
+ ac8:	8d 76 01             	lea    0x1(%esi),%esi
+ acb:	0f b6 92 a8 0f 00 00 	movzbl 0xfa8(%edx),%edx
+ ad2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ ad6:	89 ca                	mov    %ecx,%edx
+ ad8:	89 c1                	mov    %eax,%ecx
+ ada:	39 da                	cmp    %ebx,%edx
+ adc:	73 e2                	jae    ac0 <printint+0x30>
+  if(neg)
+ ade:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ ae1:	85 c0                	test   %eax,%eax
+ ae3:	74 07                	je     aec <printint+0x5c>
+    buf[i++] = '-';
+ ae5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ aea:	89 f7                	mov    %esi,%edi
+ aec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ aef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ af2:	01 df                	add    %ebx,%edi
+ af4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ af8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ afb:	83 ec 04             	sub    $0x4,%esp
+ afe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ b01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ b04:	6a 01                	push   $0x1
+ b06:	50                   	push   %eax
+ b07:	56                   	push   %esi
+ b08:	e8 22 fc ff ff       	call   72f <write>
+  while(--i >= 0)
+ b0d:	89 f8                	mov    %edi,%eax
+ b0f:	83 c4 10             	add    $0x10,%esp
+ b12:	83 ef 01             	sub    $0x1,%edi
+ b15:	39 d8                	cmp    %ebx,%eax
+ b17:	75 df                	jne    af8 <printint+0x68>
+}
+ b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b1c:	5b                   	pop    %ebx
+ b1d:	5e                   	pop    %esi
+ b1e:	5f                   	pop    %edi
+ b1f:	5d                   	pop    %ebp
+ b20:	c3                   	ret
+ b21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ b28:	31 c0                	xor    %eax,%eax
+ b2a:	eb 89                	jmp    ab5 <printint+0x25>
+ b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000b30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ b30:	55                   	push   %ebp
+ b31:	89 e5                	mov    %esp,%ebp
+ b33:	57                   	push   %edi
+ b34:	56                   	push   %esi
+ b35:	53                   	push   %ebx
+ b36:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ b39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ b3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ b3f:	0f b6 1e             	movzbl (%esi),%ebx
+ b42:	83 c6 01             	add    $0x1,%esi
+ b45:	84 db                	test   %bl,%bl
+ b47:	74 67                	je     bb0 <printf+0x80>
+ b49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ b4c:	31 d2                	xor    %edx,%edx
+ b4e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ b51:	eb 34                	jmp    b87 <printf+0x57>
+ b53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b57:	90                   	nop
+ b58:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ b5b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ b60:	83 f8 25             	cmp    $0x25,%eax
+ b63:	74 18                	je     b7d <printf+0x4d>
+  write(fd, &c, 1);
+ b65:	83 ec 04             	sub    $0x4,%esp
+ b68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ b6b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b6e:	6a 01                	push   $0x1
+ b70:	50                   	push   %eax
+ b71:	57                   	push   %edi
+ b72:	e8 b8 fb ff ff       	call   72f <write>
+ b77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ b7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ b7d:	0f b6 1e             	movzbl (%esi),%ebx
+ b80:	83 c6 01             	add    $0x1,%esi
+ b83:	84 db                	test   %bl,%bl
+ b85:	74 29                	je     bb0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ b87:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ b8a:	85 d2                	test   %edx,%edx
+ b8c:	74 ca                	je     b58 <printf+0x28>
+      }
+    } else if(state == '%'){
+ b8e:	83 fa 25             	cmp    $0x25,%edx
+ b91:	75 ea                	jne    b7d <printf+0x4d>
+      if(c == 'd'){
+ b93:	83 f8 25             	cmp    $0x25,%eax
+ b96:	0f 84 24 01 00 00    	je     cc0 <printf+0x190>
+ b9c:	83 e8 63             	sub    $0x63,%eax
+ b9f:	83 f8 15             	cmp    $0x15,%eax
+ ba2:	77 1c                	ja     bc0 <printf+0x90>
+ ba4:	ff 24 85 50 0f 00 00 	jmp    *0xf50(,%eax,4)
+ bab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bb3:	5b                   	pop    %ebx
+ bb4:	5e                   	pop    %esi
+ bb5:	5f                   	pop    %edi
+ bb6:	5d                   	pop    %ebp
+ bb7:	c3                   	ret
+ bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bbf:	90                   	nop
+  write(fd, &c, 1);
+ bc0:	83 ec 04             	sub    $0x4,%esp
+ bc3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ bc6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ bca:	6a 01                	push   $0x1
+ bcc:	52                   	push   %edx
+ bcd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ bd0:	57                   	push   %edi
+ bd1:	e8 59 fb ff ff       	call   72f <write>
+ bd6:	83 c4 0c             	add    $0xc,%esp
+ bd9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ bdc:	6a 01                	push   $0x1
+ bde:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ be1:	52                   	push   %edx
+ be2:	57                   	push   %edi
+ be3:	e8 47 fb ff ff       	call   72f <write>
+        putc(fd, c);
+ be8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ beb:	31 d2                	xor    %edx,%edx
+ bed:	eb 8e                	jmp    b7d <printf+0x4d>
+ bef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ bf0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ bf3:	83 ec 0c             	sub    $0xc,%esp
+ bf6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ bfb:	8b 13                	mov    (%ebx),%edx
+ bfd:	6a 00                	push   $0x0
+ bff:	89 f8                	mov    %edi,%eax
+        ap++;
+ c01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ c04:	e8 87 fe ff ff       	call   a90 <printint>
+        ap++;
+ c09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ c0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ c0f:	31 d2                	xor    %edx,%edx
+ c11:	e9 67 ff ff ff       	jmp    b7d <printf+0x4d>
+ c16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ c20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ c23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ c25:	83 c0 04             	add    $0x4,%eax
+ c28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ c2b:	85 db                	test   %ebx,%ebx
+ c2d:	0f 84 9d 00 00 00    	je     cd0 <printf+0x1a0>
+        while(*s != 0){
+ c33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ c36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ c38:	84 c0                	test   %al,%al
+ c3a:	0f 84 3d ff ff ff    	je     b7d <printf+0x4d>
+ c40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ c43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ c46:	89 de                	mov    %ebx,%esi
+ c48:	89 d3                	mov    %edx,%ebx
+ c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ c50:	83 ec 04             	sub    $0x4,%esp
+ c53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ c56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ c59:	6a 01                	push   $0x1
+ c5b:	53                   	push   %ebx
+ c5c:	57                   	push   %edi
+ c5d:	e8 cd fa ff ff       	call   72f <write>
+        while(*s != 0){
+ c62:	0f b6 06             	movzbl (%esi),%eax
+ c65:	83 c4 10             	add    $0x10,%esp
+ c68:	84 c0                	test   %al,%al
+ c6a:	75 e4                	jne    c50 <printf+0x120>
+      state = 0;
+ c6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c6f:	31 d2                	xor    %edx,%edx
+ c71:	e9 07 ff ff ff       	jmp    b7d <printf+0x4d>
+ c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ c80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ c83:	83 ec 0c             	sub    $0xc,%esp
+ c86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ c8b:	8b 13                	mov    (%ebx),%edx
+ c8d:	6a 01                	push   $0x1
+ c8f:	e9 6b ff ff ff       	jmp    bff <printf+0xcf>
+ c94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ c98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ c9b:	83 ec 04             	sub    $0x4,%esp
+ c9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ca1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ca3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ca6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ca9:	6a 01                	push   $0x1
+ cab:	52                   	push   %edx
+ cac:	57                   	push   %edi
+ cad:	e8 7d fa ff ff       	call   72f <write>
+        ap++;
+ cb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ cb5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ cb8:	31 d2                	xor    %edx,%edx
+ cba:	e9 be fe ff ff       	jmp    b7d <printf+0x4d>
+ cbf:	90                   	nop
+  write(fd, &c, 1);
+ cc0:	83 ec 04             	sub    $0x4,%esp
+ cc3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ cc6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ cc9:	6a 01                	push   $0x1
+ ccb:	e9 11 ff ff ff       	jmp    be1 <printf+0xb1>
+ cd0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ cd5:	bb 47 0f 00 00       	mov    $0xf47,%ebx
+ cda:	e9 61 ff ff ff       	jmp    c40 <printf+0x110>
+ cdf:	90                   	nop
+
+00000ce0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ce0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ce1:	a1 80 16 00 00       	mov    0x1680,%eax
+{
+ ce6:	89 e5                	mov    %esp,%ebp
+ ce8:	57                   	push   %edi
+ ce9:	56                   	push   %esi
+ cea:	53                   	push   %ebx
+ ceb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ cee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ cfc:	39 ca                	cmp    %ecx,%edx
+ cfe:	73 30                	jae    d30 <free+0x50>
+ d00:	39 c1                	cmp    %eax,%ecx
+ d02:	72 04                	jb     d08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d04:	39 c2                	cmp    %eax,%edx
+ d06:	72 f0                	jb     cf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ d0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ d0e:	39 f8                	cmp    %edi,%eax
+ d10:	74 2e                	je     d40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ d15:	8b 42 04             	mov    0x4(%edx),%eax
+ d18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d1b:	39 f1                	cmp    %esi,%ecx
+ d1d:	74 38                	je     d57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ d1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ d21:	5b                   	pop    %ebx
+  freep = p;
+ d22:	89 15 80 16 00 00    	mov    %edx,0x1680
+}
+ d28:	5e                   	pop    %esi
+ d29:	5f                   	pop    %edi
+ d2a:	5d                   	pop    %ebp
+ d2b:	c3                   	ret
+ d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d30:	39 c1                	cmp    %eax,%ecx
+ d32:	72 d0                	jb     d04 <free+0x24>
+ d34:	eb c2                	jmp    cf8 <free+0x18>
+ d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ d40:	03 70 04             	add    0x4(%eax),%esi
+ d43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d46:	8b 02                	mov    (%edx),%eax
+ d48:	8b 00                	mov    (%eax),%eax
+ d4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ d4d:	8b 42 04             	mov    0x4(%edx),%eax
+ d50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ d53:	39 f1                	cmp    %esi,%ecx
+ d55:	75 c8                	jne    d1f <free+0x3f>
+    p->s.size += bp->s.size;
+ d57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ d5a:	89 15 80 16 00 00    	mov    %edx,0x1680
+    p->s.size += bp->s.size;
+ d60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ d63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ d66:	89 0a                	mov    %ecx,(%edx)
+}
+ d68:	5b                   	pop    %ebx
+ d69:	5e                   	pop    %esi
+ d6a:	5f                   	pop    %edi
+ d6b:	5d                   	pop    %ebp
+ d6c:	c3                   	ret
+ d6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ d70:	55                   	push   %ebp
+ d71:	89 e5                	mov    %esp,%ebp
+ d73:	57                   	push   %edi
+ d74:	56                   	push   %esi
+ d75:	53                   	push   %ebx
+ d76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ d7c:	8b 15 80 16 00 00    	mov    0x1680,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d82:	8d 78 07             	lea    0x7(%eax),%edi
+ d85:	c1 ef 03             	shr    $0x3,%edi
+ d88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ d8b:	85 d2                	test   %edx,%edx
+ d8d:	0f 84 8d 00 00 00    	je     e20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ d95:	8b 48 04             	mov    0x4(%eax),%ecx
+ d98:	39 f9                	cmp    %edi,%ecx
+ d9a:	73 64                	jae    e00 <malloc+0x90>
+  if(nu < 4096)
+ d9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ da1:	39 df                	cmp    %ebx,%edi
+ da3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ da6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ dad:	eb 0a                	jmp    db9 <malloc+0x49>
+ daf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ db0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ db2:	8b 48 04             	mov    0x4(%eax),%ecx
+ db5:	39 f9                	cmp    %edi,%ecx
+ db7:	73 47                	jae    e00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ db9:	89 c2                	mov    %eax,%edx
+ dbb:	39 05 80 16 00 00    	cmp    %eax,0x1680
+ dc1:	75 ed                	jne    db0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ dc3:	83 ec 0c             	sub    $0xc,%esp
+ dc6:	56                   	push   %esi
+ dc7:	e8 b5 fa ff ff       	call   881 <sbrk>
+  if(p == (char*)-1)
+ dcc:	83 c4 10             	add    $0x10,%esp
+ dcf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ dd2:	74 1c                	je     df0 <malloc+0x80>
+  hp->s.size = nu;
+ dd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ dd7:	83 ec 0c             	sub    $0xc,%esp
+ dda:	83 c0 08             	add    $0x8,%eax
+ ddd:	50                   	push   %eax
+ dde:	e8 fd fe ff ff       	call   ce0 <free>
+  return freep;
+ de3:	8b 15 80 16 00 00    	mov    0x1680,%edx
+      if((p = morecore(nunits)) == 0)
+ de9:	83 c4 10             	add    $0x10,%esp
+ dec:	85 d2                	test   %edx,%edx
+ dee:	75 c0                	jne    db0 <malloc+0x40>
+        return 0;
+  }
+}
+ df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ df3:	31 c0                	xor    %eax,%eax
+}
+ df5:	5b                   	pop    %ebx
+ df6:	5e                   	pop    %esi
+ df7:	5f                   	pop    %edi
+ df8:	5d                   	pop    %ebp
+ df9:	c3                   	ret
+ dfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ e00:	39 cf                	cmp    %ecx,%edi
+ e02:	74 4c                	je     e50 <malloc+0xe0>
+        p->s.size -= nunits;
+ e04:	29 f9                	sub    %edi,%ecx
+ e06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ e09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ e0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ e0f:	89 15 80 16 00 00    	mov    %edx,0x1680
+}
+ e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ e18:	83 c0 08             	add    $0x8,%eax
+}
+ e1b:	5b                   	pop    %ebx
+ e1c:	5e                   	pop    %esi
+ e1d:	5f                   	pop    %edi
+ e1e:	5d                   	pop    %ebp
+ e1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ e20:	c7 05 80 16 00 00 84 	movl   $0x1684,0x1680
+ e27:	16 00 00 
+    base.s.size = 0;
+ e2a:	b8 84 16 00 00       	mov    $0x1684,%eax
+    base.s.ptr = freep = prevp = &base;
+ e2f:	c7 05 84 16 00 00 84 	movl   $0x1684,0x1684
+ e36:	16 00 00 
+    base.s.size = 0;
+ e39:	c7 05 88 16 00 00 00 	movl   $0x0,0x1688
+ e40:	00 00 00 
+    if(p->s.size >= nunits){
+ e43:	e9 54 ff ff ff       	jmp    d9c <malloc+0x2c>
+ e48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ e50:	8b 08                	mov    (%eax),%ecx
+ e52:	89 0a                	mov    %ecx,(%edx)
+ e54:	eb b9                	jmp    e0f <malloc+0x9f>
+ e56:	66 90                	xchg   %ax,%ax
+ e58:	66 90                	xchg   %ax,%ax
+ e5a:	66 90                	xchg   %ax,%ax
+ e5c:	66 90                	xchg   %ax,%ax
+ e5e:	66 90                	xchg   %ax,%ax
+
+00000e60 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e60:	55                   	push   %ebp
+ e61:	89 e5                	mov    %esp,%ebp
+ e63:	53                   	push   %ebx
+ e64:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ e67:	68 00 20 00 00       	push   $0x2000
+ e6c:	e8 ff fe ff ff       	call   d70 <malloc>
+ e71:	83 c4 10             	add    $0x10,%esp
+ e74:	85 c0                	test   %eax,%eax
+ e76:	74 47                	je     ebf <thread_create+0x5f>
+ e78:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e7a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ e80:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ e83:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ e88:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ e8b:	ff 75 0c             	push   0xc(%ebp)
+ e8e:	50                   	push   %eax
+ e8f:	ff 75 08             	push   0x8(%ebp)
+ e92:	e8 6c fa ff ff       	call   903 <clone>
+ e97:	83 c4 10             	add    $0x10,%esp
+ e9a:	85 c0                	test   %eax,%eax
+ e9c:	78 0a                	js     ea8 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ e9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ ea1:	c9                   	leave
+ ea2:	c3                   	ret
+ ea3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ea7:	90                   	nop
+    free(mem);
+ ea8:	83 ec 0c             	sub    $0xc,%esp
+ eab:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ eae:	53                   	push   %ebx
+ eaf:	e8 2c fe ff ff       	call   ce0 <free>
+ eb4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ eb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ eba:	83 c4 10             	add    $0x10,%esp
+}
+ ebd:	c9                   	leave
+ ebe:	c3                   	ret
+    return -1;
+ ebf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ec4:	eb d8                	jmp    e9e <thread_create+0x3e>
+ ec6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ecd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ed0 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ ed0:	55                   	push   %ebp
+ ed1:	89 e5                	mov    %esp,%ebp
+ ed3:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ ed4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ed7:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ eda:	50                   	push   %eax
+ edb:	e8 3d fa ff ff       	call   91d <join>
+ ee0:	83 c4 10             	add    $0x10,%esp
+ ee3:	85 c0                	test   %eax,%eax
+ ee5:	78 21                	js     f08 <thread_join+0x38>
+ ee7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eec:	83 ec 0c             	sub    $0xc,%esp
+ eef:	ff 70 fc             	push   -0x4(%eax)
+ ef2:	e8 e9 fd ff ff       	call   ce0 <free>
+  return pid;
+ ef7:	83 c4 10             	add    $0x10,%esp
+}
+ efa:	89 d8                	mov    %ebx,%eax
+ efc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ eff:	c9                   	leave
+ f00:	c3                   	ret
+ f01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ f08:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ f0d:	eb eb                	jmp    efa <thread_join+0x2a>
@@ -117,6 +117,15 @@ sti(void)
   asm volatile("sti");
 }
 
+// Enable interrupts and halt until the next one.  An interrupt
+// cannot be taken between the two instructions, so one that is
+// pending, or arrives, when sti runs still ends the hlt.
+static inline void
+stihlt(void)
+{
+  asm volatile("sti; hlt" : : : "memory");
+}
+
 static inline uint
 xchg(volatile uint *addr, uint newval)
 {
@@ -130,6 +139,47 @@ xchg(volatile uint *addr, uint newval)
   return result;
 }
 
+// Atomically set *addr to newval if it holds old.
+// Returns the value *addr held before.
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+               "=a" (result), "+m" (*addr) :
+               "r" (newval), "0" (old) :
+               "cc");
+  return result;
+}
+
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+  return val;
+}
+
+static inline void
+wrmsr(uint msr, uint64 val)
+{
+  asm volatile("wrmsr" : : "c" (msr), "A" (val));
+}
+
+// Divide a 64-bit n by d; the quotient must fit in 32 bits.
+// (There is no libgcc for a full 64-bit division.)
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+  return q;
+}
+
 static inline uint
 rcr2(void)
 {
@@ -144,6 +194,52 @@ lcr3(uint val)
   asm volatile("movl %0,%%cr3" : : "r" (val));
 }
 
+static inline uint
+rcr3(void)
+{
+  uint val;
+  asm volatile("movl %%cr3,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+invlpg(void *va)
+{
+  asm volatile("invlpg (%0)" : : "r" (va) : "memory");
+}
+
+static inline uint
+rcr4(void)
+{
+  uint val;
+  asm volatile("movl %%cr4,%0" : "=r" (val));
+  return val;
+}
+
+static inline void
+lcr4(uint val)
+{
+  asm volatile("movl %0,%%cr4" : : "r" (val));
+}
+
+static inline void
+cpuidinfo(uint info, uint *eaxp, uint *ebxp, uint *ecxp, uint *edxp)
+{
+  uint eax, ebx, ecx, edx;
+
+  asm volatile("cpuid" :
+               "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx) :
+               "a" (info));
+  if(eaxp)
+    *eaxp = eax;
+  if(ebxp)
+    *ebxp = ebx;
+  if(ecxp)
+    *ecxp = ecx;
+  if(edxp)
+    *edxp = edx;
+}
+
 //PAGEBREAK: 36
 // Layout of the trap frame built on the stack by the
 // hardware and by trapasm.S, and passed to trap().
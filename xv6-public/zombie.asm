@@ -0,0 +1,1975 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 47 05 00 00       	call   55d <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 27 07 00 00       	call   74b <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 4b 05 00 00       	call   577 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "clock.h"
+#include "vdso.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 58 04 00 00       	call   5c5 <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 85 04 00 00       	call   647 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 be 04 00 00       	call   695 <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 18 04 00 00       	call   5f9 <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <mutex_init>:
+// Mutexes and condition variables on top of futex().
+// The uncontended paths never enter the kernel.
+
+void
+mutex_init(struct mutex *m)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 27c:	5d                   	pop    %ebp
+ 27d:	c3                   	ret
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <mutex_lock>:
+
+void
+mutex_lock(struct mutex *m)
+{
+ 280:	55                   	push   %ebp
+static inline uint
+cmpxchg(volatile uint *addr, uint old, uint newval)
+{
+  uint result;
+
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 281:	31 c0                	xor    %eax,%eax
+ 283:	ba 01 00 00 00       	mov    $0x1,%edx
+ 288:	89 e5                	mov    %esp,%ebp
+ 28a:	56                   	push   %esi
+ 28b:	53                   	push   %ebx
+ 28c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 28f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 293:	85 c0                	test   %eax,%eax
+ 295:	74 32                	je     2c9 <mutex_lock+0x49>
+    return;
+  // Contended: mark the lock as having waiters and sleep
+  // until the holder hands it back.
+  if(c != 2)
+ 297:	83 f8 02             	cmp    $0x2,%eax
+ 29a:	74 0c                	je     2a8 <mutex_lock+0x28>
+  asm volatile("lock; xchgl %0, %1" :
+ 29c:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2a1:	f0 87 03             	lock xchg %eax,(%ebx)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+ 2a4:	85 c0                	test   %eax,%eax
+ 2a6:	74 21                	je     2c9 <mutex_lock+0x49>
+ 2a8:	be 02 00 00 00       	mov    $0x2,%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 02                	push   $0x2
+ 2b5:	6a 00                	push   $0x0
+ 2b7:	53                   	push   %ebx
+ 2b8:	e8 2a 05 00 00       	call   7e7 <futex>
+ 2bd:	89 f0                	mov    %esi,%eax
+ 2bf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 2c2:	83 c4 10             	add    $0x10,%esp
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	75 e7                	jne    2b0 <mutex_lock+0x30>
+    c = xchg(&m->state, 2);
+  }
+}
+ 2c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2cc:	5b                   	pop    %ebx
+ 2cd:	5e                   	pop    %esi
+ 2ce:	5d                   	pop    %ebp
+ 2cf:	c3                   	ret
+
+000002d0 <mutex_unlock>:
+
+void
+mutex_unlock(struct mutex *m)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	31 c0                	xor    %eax,%eax
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	83 ec 08             	sub    $0x8,%esp
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 2de:	83 f8 02             	cmp    $0x2,%eax
+ 2e1:	74 05                	je     2e8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+ 2e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 2e8:	83 ec 04             	sub    $0x4,%esp
+ 2eb:	6a 01                	push   $0x1
+ 2ed:	6a 01                	push   $0x1
+ 2ef:	52                   	push   %edx
+ 2f0:	e8 f2 04 00 00       	call   7e7 <futex>
+ 2f5:	83 c4 10             	add    $0x10,%esp
+}
+ 2f8:	c9                   	leave
+ 2f9:	c3                   	ret
+ 2fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000300 <cond_init>:
+
+void
+cond_init(struct cond *c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 30c:	5d                   	pop    %ebp
+ 30d:	c3                   	ret
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <cond_wait>:
+// Atomically release m and wait for a signal on c,
+// then reacquire m.  Spurious wakeups are possible,
+// so callers must recheck their condition.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	31 c0                	xor    %eax,%eax
+ 313:	89 e5                	mov    %esp,%ebp
+ 315:	57                   	push   %edi
+ 316:	56                   	push   %esi
+ 317:	53                   	push   %ebx
+ 318:	83 ec 0c             	sub    $0xc,%esp
+ 31b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 31e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 321:	8b 3e                	mov    (%esi),%edi
+ 323:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 326:	83 f8 02             	cmp    $0x2,%eax
+ 329:	74 5d                	je     388 <cond_wait+0x78>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 32b:	83 ec 04             	sub    $0x4,%esp
+ 32e:	57                   	push   %edi
+ 32f:	6a 00                	push   $0x0
+ 331:	56                   	push   %esi
+ 332:	e8 b0 04 00 00       	call   7e7 <futex>
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 337:	31 c0                	xor    %eax,%eax
+ 339:	ba 01 00 00 00       	mov    $0x1,%edx
+ 33e:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 342:	83 c4 10             	add    $0x10,%esp
+ 345:	85 c0                	test   %eax,%eax
+ 347:	74 30                	je     379 <cond_wait+0x69>
+  if(c != 2)
+ 349:	83 f8 02             	cmp    $0x2,%eax
+ 34c:	74 0c                	je     35a <cond_wait+0x4a>
+  asm volatile("lock; xchgl %0, %1" :
+ 34e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 353:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 356:	85 c0                	test   %eax,%eax
+ 358:	74 1f                	je     379 <cond_wait+0x69>
+ 35a:	be 02 00 00 00       	mov    $0x2,%esi
+ 35f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 02                	push   $0x2
+ 365:	6a 00                	push   $0x0
+ 367:	53                   	push   %ebx
+ 368:	e8 7a 04 00 00       	call   7e7 <futex>
+ 36d:	89 f0                	mov    %esi,%eax
+ 36f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(c != 0){
+ 372:	83 c4 10             	add    $0x10,%esp
+ 375:	85 c0                	test   %eax,%eax
+ 377:	75 e7                	jne    360 <cond_wait+0x50>
+  mutex_lock(m);
+}
+ 379:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37c:	5b                   	pop    %ebx
+ 37d:	5e                   	pop    %esi
+ 37e:	5f                   	pop    %edi
+ 37f:	5d                   	pop    %ebp
+ 380:	c3                   	ret
+ 381:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 388:	83 ec 04             	sub    $0x4,%esp
+ 38b:	6a 01                	push   $0x1
+ 38d:	6a 01                	push   $0x1
+ 38f:	53                   	push   %ebx
+ 390:	e8 52 04 00 00       	call   7e7 <futex>
+ 395:	83 c4 10             	add    $0x10,%esp
+ 398:	eb 91                	jmp    32b <cond_wait+0x1b>
+ 39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003a0 <cond_signal>:
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	83 ec 04             	sub    $0x4,%esp
+ 3a7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 3aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 3b0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 3b2:	8d 59 01             	lea    0x1(%ecx),%ebx
+  asm volatile("lock; cmpxchgl %2, %1" :
+ 3b5:	89 c8                	mov    %ecx,%eax
+ 3b7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 3bb:	39 c1                	cmp    %eax,%ecx
+ 3bd:	75 f1                	jne    3b0 <cond_signal+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 3bf:	83 ec 04             	sub    $0x4,%esp
+ 3c2:	6a 01                	push   $0x1
+ 3c4:	6a 01                	push   $0x1
+ 3c6:	52                   	push   %edx
+ 3c7:	e8 1b 04 00 00       	call   7e7 <futex>
+}
+ 3cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	c9                   	leave
+ 3d3:	c3                   	ret
+ 3d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	53                   	push   %ebx
+ 3e4:	83 ec 04             	sub    $0x4,%esp
+ 3e7:	8b 55 08             	mov    0x8(%ebp),%edx
+cond_bump(struct cond *c)
+ 3ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    seq = c->seq;
+ 3f0:	8b 0a                	mov    (%edx),%ecx
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 3f2:	8d 59 01             	lea    0x1(%ecx),%ebx
+ 3f5:	89 c8                	mov    %ecx,%eax
+ 3f7:	f0 0f b1 1a          	lock cmpxchg %ebx,(%edx)
+ 3fb:	39 c1                	cmp    %eax,%ecx
+ 3fd:	75 f1                	jne    3f0 <cond_broadcast+0x10>
+  cond_bump(c);
+  futex(&c->seq, FUTEX_WAKE, NPROC);
+ 3ff:	83 ec 04             	sub    $0x4,%esp
+ 402:	6a 40                	push   $0x40
+ 404:	6a 01                	push   $0x1
+ 406:	52                   	push   %edx
+ 407:	e8 db 03 00 00       	call   7e7 <futex>
+}
+ 40c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 40f:	83 c4 10             	add    $0x10,%esp
+ 412:	c9                   	leave
+ 413:	c3                   	ret
+ 414:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 41f:	90                   	nop
+
+00000420 <vuptime>:
+// without a system call.
+
+uint
+vuptime(void)
+{
+  return ((struct vdso*)VDSO)->ticks;
+ 420:	a1 04 e0 ff 7f       	mov    0x7fffe004,%eax
+}
+ 425:	c3                   	ret
+ 426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <vgetpid>:
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) == 0)
+ 430:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+ 435:	85 c0                	test   %eax,%eax
+ 437:	74 07                	je     440 <vgetpid+0x10>
+    pid = getpid();
+  return pid;
+}
+ 439:	c3                   	ret
+ 43a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pid = getpid();
+ 440:	e9 d2 02 00 00       	jmp    717 <getpid>
+ 445:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <vnsecs>:
+
+// Nanoseconds since boot.
+uint64
+vnsecs(void)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	57                   	push   %edi
+ 454:	56                   	push   %esi
+ 455:	53                   	push   %ebx
+ 456:	83 ec 0c             	sub    $0xc,%esp
+static inline uint64
+rdtsc(void)
+{
+  uint64 val;
+
+  asm volatile("rdtsc" : "=A" (val));
+ 459:	0f 31                	rdtsc
+  struct vdso *v = (struct vdso*)VDSO;
+  uint64 d;
+
+  d = rdtsc() - v->tsc0;
+ 45b:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 461:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 467:	b9 20 00 00 00       	mov    $0x20,%ecx
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 46c:	8b 1d 10 e0 ff 7f    	mov    0x7fffe010,%ebx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 472:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 47a:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 480:	29 d9                	sub    %ebx,%ecx
+ 482:	89 c6                	mov    %eax,%esi
+ 484:	89 d7                	mov    %edx,%edi
+ 486:	0f a5 c7             	shld   %cl,%eax,%edi
+ 489:	d3 e6                	shl    %cl,%esi
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	f6 c1 20             	test   $0x20,%cl
+ 490:	0f 45 fe             	cmovne %esi,%edi
+ 493:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 496:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 499:	89 d9                	mov    %ebx,%ecx
+ 49b:	31 db                	xor    %ebx,%ebx
+ 49d:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 4a3:	0f ad d0             	shrd   %cl,%edx,%eax
+ 4a6:	d3 ea                	shr    %cl,%edx
+ 4a8:	f6 c1 20             	test   $0x20,%cl
+ 4ab:	0f 45 c2             	cmovne %edx,%eax
+ 4ae:	0f 45 d3             	cmovne %ebx,%edx
+ 4b1:	01 f0                	add    %esi,%eax
+ 4b3:	11 fa                	adc    %edi,%edx
+}
+ 4b5:	83 c4 0c             	add    $0xc,%esp
+ 4b8:	5b                   	pop    %ebx
+ 4b9:	5e                   	pop    %esi
+ 4ba:	5f                   	pop    %edi
+ 4bb:	5d                   	pop    %ebp
+ 4bc:	c3                   	ret
+ 4bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004c0 <vclock_gettime>:
+
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+ 4c5:	53                   	push   %ebx
+ 4c6:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ns;
+
+  if(clk != CLOCK_MONOTONIC)
+ 4c9:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+{
+ 4cd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(clk != CLOCK_MONOTONIC)
+ 4d0:	74 0e                	je     4e0 <vclock_gettime+0x20>
+    return clock_gettime(clk, ts);
+  ns = vnsecs();
+  ts->tv_sec = divl(ns, 1000000000);
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+  return 0;
+}
+ 4d2:	83 c4 1c             	add    $0x1c,%esp
+ 4d5:	5b                   	pop    %ebx
+ 4d6:	5e                   	pop    %esi
+ 4d7:	5f                   	pop    %edi
+ 4d8:	5d                   	pop    %ebp
+    return clock_gettime(clk, ts);
+ 4d9:	e9 a5 03 00 00       	jmp    883 <clock_gettime>
+ 4de:	66 90                	xchg   %ax,%ax
+ 4e0:	0f 31                	rdtsc
+  d = rdtsc() - v->tsc0;
+ 4e2:	2b 05 14 e0 ff 7f    	sub    0x7fffe014,%eax
+ 4e8:	1b 15 18 e0 ff 7f    	sbb    0x7fffe018,%edx
+         ((uint64)(uint)(d >> 32) * v->nsmult << (32 - v->nsshift));
+ 4ee:	b9 20 00 00 00       	mov    $0x20,%ecx
+ 4f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 4fb:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 501:	2b 0d 10 e0 ff 7f    	sub    0x7fffe010,%ecx
+ 507:	89 c6                	mov    %eax,%esi
+ 509:	89 d7                	mov    %edx,%edi
+ 50b:	0f a5 c7             	shld   %cl,%eax,%edi
+ 50e:	d3 e6                	shl    %cl,%esi
+ 510:	31 c0                	xor    %eax,%eax
+ 512:	f6 c1 20             	test   $0x20,%cl
+ 515:	0f 45 fe             	cmovne %esi,%edi
+ 518:	0f 45 f0             	cmovne %eax,%esi
+  return ((uint64)(uint)d * v->nsmult >> v->nsshift) +
+ 51b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 51e:	0f b6 0d 10 e0 ff 7f 	movzbl 0x7fffe010,%ecx
+ 525:	f7 25 0c e0 ff 7f    	mull   0x7fffe00c
+ 52b:	0f ad d0             	shrd   %cl,%edx,%eax
+ 52e:	d3 ea                	shr    %cl,%edx
+ 530:	f6 c1 20             	test   $0x20,%cl
+ 533:	74 04                	je     539 <vclock_gettime+0x79>
+ 535:	89 d0                	mov    %edx,%eax
+ 537:	31 d2                	xor    %edx,%edx
+ 539:	01 f0                	add    %esi,%eax
+static inline uint
+divl(uint64 n, uint d)
+{
+  uint q, r;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 53b:	be 00 ca 9a 3b       	mov    $0x3b9aca00,%esi
+ 540:	11 fa                	adc    %edi,%edx
+               : "a" ((uint)n), "d" ((uint)(n >> 32)), "rm" (d));
+ 542:	89 c1                	mov    %eax,%ecx
+  asm volatile("divl %4" : "=a" (q), "=d" (r)
+ 544:	f7 f6                	div    %esi
+  ts->tv_sec = divl(ns, 1000000000);
+ 546:	89 03                	mov    %eax,(%ebx)
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 548:	69 c0 00 ca 9a 3b    	imul   $0x3b9aca00,%eax,%eax
+ 54e:	29 c1                	sub    %eax,%ecx
+}
+ 550:	31 c0                	xor    %eax,%eax
+  ts->tv_nsec = ns - (uint64)ts->tv_sec * 1000000000;
+ 552:	89 4b 04             	mov    %ecx,0x4(%ebx)
+}
+ 555:	83 c4 1c             	add    $0x1c,%esp
+ 558:	5b                   	pop    %ebx
+ 559:	5e                   	pop    %esi
+ 55a:	5f                   	pop    %edi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+
+0000055d <fork>:
+  1: \
+    int $T_SYSCALL; \
+  2: \
+    ret
+
+SYSCALL(fork)
+ 55d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 562:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 569:	74 09                	je     574 <fork+0x17>
+ 56b:	89 e1                	mov    %esp,%ecx
+ 56d:	ba 76 05 00 00       	mov    $0x576,%edx
+ 572:	0f 34                	sysenter
+ 574:	cd 40                	int    $0x40
+ 576:	c3                   	ret
+
+00000577 <exit>:
+SYSCALL(exit)
+ 577:	b8 02 00 00 00       	mov    $0x2,%eax
+ 57c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 583:	74 09                	je     58e <exit+0x17>
+ 585:	89 e1                	mov    %esp,%ecx
+ 587:	ba 90 05 00 00       	mov    $0x590,%edx
+ 58c:	0f 34                	sysenter
+ 58e:	cd 40                	int    $0x40
+ 590:	c3                   	ret
+
+00000591 <wait>:
+SYSCALL(wait)
+ 591:	b8 03 00 00 00       	mov    $0x3,%eax
+ 596:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 59d:	74 09                	je     5a8 <wait+0x17>
+ 59f:	89 e1                	mov    %esp,%ecx
+ 5a1:	ba aa 05 00 00       	mov    $0x5aa,%edx
+ 5a6:	0f 34                	sysenter
+ 5a8:	cd 40                	int    $0x40
+ 5aa:	c3                   	ret
+
+000005ab <pipe>:
+SYSCALL(pipe)
+ 5ab:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5b0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5b7:	74 09                	je     5c2 <pipe+0x17>
+ 5b9:	89 e1                	mov    %esp,%ecx
+ 5bb:	ba c4 05 00 00       	mov    $0x5c4,%edx
+ 5c0:	0f 34                	sysenter
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	c3                   	ret
+
+000005c5 <read>:
+SYSCALL(read)
+ 5c5:	b8 05 00 00 00       	mov    $0x5,%eax
+ 5ca:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5d1:	74 09                	je     5dc <read+0x17>
+ 5d3:	89 e1                	mov    %esp,%ecx
+ 5d5:	ba de 05 00 00       	mov    $0x5de,%edx
+ 5da:	0f 34                	sysenter
+ 5dc:	cd 40                	int    $0x40
+ 5de:	c3                   	ret
+
+000005df <write>:
+SYSCALL(write)
+ 5df:	b8 10 00 00 00       	mov    $0x10,%eax
+ 5e4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 5eb:	74 09                	je     5f6 <write+0x17>
+ 5ed:	89 e1                	mov    %esp,%ecx
+ 5ef:	ba f8 05 00 00       	mov    $0x5f8,%edx
+ 5f4:	0f 34                	sysenter
+ 5f6:	cd 40                	int    $0x40
+ 5f8:	c3                   	ret
+
+000005f9 <close>:
+SYSCALL(close)
+ 5f9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5fe:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 605:	74 09                	je     610 <close+0x17>
+ 607:	89 e1                	mov    %esp,%ecx
+ 609:	ba 12 06 00 00       	mov    $0x612,%edx
+ 60e:	0f 34                	sysenter
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 61f:	74 09                	je     62a <kill+0x17>
+ 621:	89 e1                	mov    %esp,%ecx
+ 623:	ba 2c 06 00 00       	mov    $0x62c,%edx
+ 628:	0f 34                	sysenter
+ 62a:	cd 40                	int    $0x40
+ 62c:	c3                   	ret
+
+0000062d <exec>:
+SYSCALL(exec)
+ 62d:	b8 07 00 00 00       	mov    $0x7,%eax
+ 632:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 639:	74 09                	je     644 <exec+0x17>
+ 63b:	89 e1                	mov    %esp,%ecx
+ 63d:	ba 46 06 00 00       	mov    $0x646,%edx
+ 642:	0f 34                	sysenter
+ 644:	cd 40                	int    $0x40
+ 646:	c3                   	ret
+
+00000647 <open>:
+SYSCALL(open)
+ 647:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 64c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 653:	74 09                	je     65e <open+0x17>
+ 655:	89 e1                	mov    %esp,%ecx
+ 657:	ba 60 06 00 00       	mov    $0x660,%edx
+ 65c:	0f 34                	sysenter
+ 65e:	cd 40                	int    $0x40
+ 660:	c3                   	ret
+
+00000661 <mknod>:
+SYSCALL(mknod)
+ 661:	b8 11 00 00 00       	mov    $0x11,%eax
+ 666:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 66d:	74 09                	je     678 <mknod+0x17>
+ 66f:	89 e1                	mov    %esp,%ecx
+ 671:	ba 7a 06 00 00       	mov    $0x67a,%edx
+ 676:	0f 34                	sysenter
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <unlink>:
+SYSCALL(unlink)
+ 67b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 680:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 687:	74 09                	je     692 <unlink+0x17>
+ 689:	89 e1                	mov    %esp,%ecx
+ 68b:	ba 94 06 00 00       	mov    $0x694,%edx
+ 690:	0f 34                	sysenter
+ 692:	cd 40                	int    $0x40
+ 694:	c3                   	ret
+
+00000695 <fstat>:
+SYSCALL(fstat)
+ 695:	b8 08 00 00 00       	mov    $0x8,%eax
+ 69a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6a1:	74 09                	je     6ac <fstat+0x17>
+ 6a3:	89 e1                	mov    %esp,%ecx
+ 6a5:	ba ae 06 00 00       	mov    $0x6ae,%edx
+ 6aa:	0f 34                	sysenter
+ 6ac:	cd 40                	int    $0x40
+ 6ae:	c3                   	ret
+
+000006af <link>:
+SYSCALL(link)
+ 6af:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6b4:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6bb:	74 09                	je     6c6 <link+0x17>
+ 6bd:	89 e1                	mov    %esp,%ecx
+ 6bf:	ba c8 06 00 00       	mov    $0x6c8,%edx
+ 6c4:	0f 34                	sysenter
+ 6c6:	cd 40                	int    $0x40
+ 6c8:	c3                   	ret
+
+000006c9 <mkdir>:
+SYSCALL(mkdir)
+ 6c9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6ce:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6d5:	74 09                	je     6e0 <mkdir+0x17>
+ 6d7:	89 e1                	mov    %esp,%ecx
+ 6d9:	ba e2 06 00 00       	mov    $0x6e2,%edx
+ 6de:	0f 34                	sysenter
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <chdir>:
+SYSCALL(chdir)
+ 6e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6e8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 6ef:	74 09                	je     6fa <chdir+0x17>
+ 6f1:	89 e1                	mov    %esp,%ecx
+ 6f3:	ba fc 06 00 00       	mov    $0x6fc,%edx
+ 6f8:	0f 34                	sysenter
+ 6fa:	cd 40                	int    $0x40
+ 6fc:	c3                   	ret
+
+000006fd <dup>:
+SYSCALL(dup)
+ 6fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 702:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 709:	74 09                	je     714 <dup+0x17>
+ 70b:	89 e1                	mov    %esp,%ecx
+ 70d:	ba 16 07 00 00       	mov    $0x716,%edx
+ 712:	0f 34                	sysenter
+ 714:	cd 40                	int    $0x40
+ 716:	c3                   	ret
+
+00000717 <getpid>:
+SYSCALL(getpid)
+ 717:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 71c:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 723:	74 09                	je     72e <getpid+0x17>
+ 725:	89 e1                	mov    %esp,%ecx
+ 727:	ba 30 07 00 00       	mov    $0x730,%edx
+ 72c:	0f 34                	sysenter
+ 72e:	cd 40                	int    $0x40
+ 730:	c3                   	ret
+
+00000731 <sbrk>:
+SYSCALL(sbrk)
+ 731:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 736:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 73d:	74 09                	je     748 <sbrk+0x17>
+ 73f:	89 e1                	mov    %esp,%ecx
+ 741:	ba 4a 07 00 00       	mov    $0x74a,%edx
+ 746:	0f 34                	sysenter
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <sleep>:
+SYSCALL(sleep)
+ 74b:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 750:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 757:	74 09                	je     762 <sleep+0x17>
+ 759:	89 e1                	mov    %esp,%ecx
+ 75b:	ba 64 07 00 00       	mov    $0x764,%edx
+ 760:	0f 34                	sysenter
+ 762:	cd 40                	int    $0x40
+ 764:	c3                   	ret
+
+00000765 <uptime>:
+SYSCALL(uptime)
+ 765:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 76a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 771:	74 09                	je     77c <uptime+0x17>
+ 773:	89 e1                	mov    %esp,%ecx
+ 775:	ba 7e 07 00 00       	mov    $0x77e,%edx
+ 77a:	0f 34                	sysenter
+ 77c:	cd 40                	int    $0x40
+ 77e:	c3                   	ret
+
+0000077f <mmap>:
+SYSCALL(mmap)
+ 77f:	b8 16 00 00 00       	mov    $0x16,%eax
+ 784:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 78b:	74 09                	je     796 <mmap+0x17>
+ 78d:	89 e1                	mov    %esp,%ecx
+ 78f:	ba 98 07 00 00       	mov    $0x798,%edx
+ 794:	0f 34                	sysenter
+ 796:	cd 40                	int    $0x40
+ 798:	c3                   	ret
+
+00000799 <munmap>:
+SYSCALL(munmap)
+ 799:	b8 17 00 00 00       	mov    $0x17,%eax
+ 79e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7a5:	74 09                	je     7b0 <munmap+0x17>
+ 7a7:	89 e1                	mov    %esp,%ecx
+ 7a9:	ba b2 07 00 00       	mov    $0x7b2,%edx
+ 7ae:	0f 34                	sysenter
+ 7b0:	cd 40                	int    $0x40
+ 7b2:	c3                   	ret
+
+000007b3 <clone>:
+SYSCALL(clone)
+ 7b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7b8:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7bf:	74 09                	je     7ca <clone+0x17>
+ 7c1:	89 e1                	mov    %esp,%ecx
+ 7c3:	ba cc 07 00 00       	mov    $0x7cc,%edx
+ 7c8:	0f 34                	sysenter
+ 7ca:	cd 40                	int    $0x40
+ 7cc:	c3                   	ret
+
+000007cd <join>:
+SYSCALL(join)
+ 7cd:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7d2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7d9:	74 09                	je     7e4 <join+0x17>
+ 7db:	89 e1                	mov    %esp,%ecx
+ 7dd:	ba e6 07 00 00       	mov    $0x7e6,%edx
+ 7e2:	0f 34                	sysenter
+ 7e4:	cd 40                	int    $0x40
+ 7e6:	c3                   	ret
+
+000007e7 <futex>:
+SYSCALL(futex)
+ 7e7:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ec:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 7f3:	74 09                	je     7fe <futex+0x17>
+ 7f5:	89 e1                	mov    %esp,%ecx
+ 7f7:	ba 00 08 00 00       	mov    $0x800,%edx
+ 7fc:	0f 34                	sysenter
+ 7fe:	cd 40                	int    $0x40
+ 800:	c3                   	ret
+
+00000801 <memstat>:
+SYSCALL(memstat)
+ 801:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 806:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 80d:	74 09                	je     818 <memstat+0x17>
+ 80f:	89 e1                	mov    %esp,%ecx
+ 811:	ba 1a 08 00 00       	mov    $0x81a,%edx
+ 816:	0f 34                	sysenter
+ 818:	cd 40                	int    $0x40
+ 81a:	c3                   	ret
+
+0000081b <nice>:
+SYSCALL(nice)
+ 81b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 820:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 827:	74 09                	je     832 <nice+0x17>
+ 829:	89 e1                	mov    %esp,%ecx
+ 82b:	ba 34 08 00 00       	mov    $0x834,%edx
+ 830:	0f 34                	sysenter
+ 832:	cd 40                	int    $0x40
+ 834:	c3                   	ret
+
+00000835 <setpriority>:
+SYSCALL(setpriority)
+ 835:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 83a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 841:	74 09                	je     84c <setpriority+0x17>
+ 843:	89 e1                	mov    %esp,%ecx
+ 845:	ba 4e 08 00 00       	mov    $0x84e,%edx
+ 84a:	0f 34                	sysenter
+ 84c:	cd 40                	int    $0x40
+ 84e:	c3                   	ret
+
+0000084f <getpinfo>:
+SYSCALL(getpinfo)
+ 84f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 854:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 85b:	74 09                	je     866 <getpinfo+0x17>
+ 85d:	89 e1                	mov    %esp,%ecx
+ 85f:	ba 68 08 00 00       	mov    $0x868,%edx
+ 864:	0f 34                	sysenter
+ 866:	cd 40                	int    $0x40
+ 868:	c3                   	ret
+
+00000869 <settickets>:
+SYSCALL(settickets)
+ 869:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 86e:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 875:	74 09                	je     880 <settickets+0x17>
+ 877:	89 e1                	mov    %esp,%ecx
+ 879:	ba 82 08 00 00       	mov    $0x882,%edx
+ 87e:	0f 34                	sysenter
+ 880:	cd 40                	int    $0x40
+ 882:	c3                   	ret
+
+00000883 <clock_gettime>:
+SYSCALL(clock_gettime)
+ 883:	b8 20 00 00 00       	mov    $0x20,%eax
+ 888:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 88f:	74 09                	je     89a <clock_gettime+0x17>
+ 891:	89 e1                	mov    %esp,%ecx
+ 893:	ba 9c 08 00 00       	mov    $0x89c,%edx
+ 898:	0f 34                	sysenter
+ 89a:	cd 40                	int    $0x40
+ 89c:	c3                   	ret
+
+0000089d <batch>:
+SYSCALL(batch)
+ 89d:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8a2:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8a9:	74 09                	je     8b4 <batch+0x17>
+ 8ab:	89 e1                	mov    %esp,%ecx
+ 8ad:	ba b6 08 00 00       	mov    $0x8b6,%edx
+ 8b2:	0f 34                	sysenter
+ 8b4:	cd 40                	int    $0x40
+ 8b6:	c3                   	ret
+
+000008b7 <aiosetup>:
+SYSCALL(aiosetup)
+ 8b7:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8bc:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8c3:	74 09                	je     8ce <aiosetup+0x17>
+ 8c5:	89 e1                	mov    %esp,%ecx
+ 8c7:	ba d0 08 00 00       	mov    $0x8d0,%edx
+ 8cc:	0f 34                	sysenter
+ 8ce:	cd 40                	int    $0x40
+ 8d0:	c3                   	ret
+
+000008d1 <aioenter>:
+SYSCALL(aioenter)
+ 8d1:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8d6:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8dd:	74 09                	je     8e8 <aioenter+0x17>
+ 8df:	89 e1                	mov    %esp,%ecx
+ 8e1:	ba ea 08 00 00       	mov    $0x8ea,%edx
+ 8e6:	0f 34                	sysenter
+ 8e8:	cd 40                	int    $0x40
+ 8ea:	c3                   	ret
+
+000008eb <systrace>:
+SYSCALL(systrace)
+ 8eb:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8f0:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 8f7:	74 09                	je     902 <systrace+0x17>
+ 8f9:	89 e1                	mov    %esp,%ecx
+ 8fb:	ba 04 09 00 00       	mov    $0x904,%edx
+ 900:	0f 34                	sysenter
+ 902:	cd 40                	int    $0x40
+ 904:	c3                   	ret
+
+00000905 <sysstat>:
+SYSCALL(sysstat)
+ 905:	b8 25 00 00 00       	mov    $0x25,%eax
+ 90a:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 911:	74 09                	je     91c <sysstat+0x17>
+ 913:	89 e1                	mov    %esp,%ecx
+ 915:	ba 1e 09 00 00       	mov    $0x91e,%edx
+ 91a:	0f 34                	sysenter
+ 91c:	cd 40                	int    $0x40
+ 91e:	c3                   	ret
+
+0000091f <traceread>:
+SYSCALL(traceread)
+ 91f:	b8 26 00 00 00       	mov    $0x26,%eax
+ 924:	83 3d 00 e0 ff 7f 00 	cmpl   $0x0,0x7fffe000
+ 92b:	74 09                	je     936 <traceread+0x17>
+ 92d:	89 e1                	mov    %esp,%ecx
+ 92f:	ba 38 09 00 00       	mov    $0x938,%edx
+ 934:	0f 34                	sysenter
+ 936:	cd 40                	int    $0x40
+ 938:	c3                   	ret
+ 939:	66 90                	xchg   %ax,%ax
+ 93b:	66 90                	xchg   %ax,%ax
+ 93d:	66 90                	xchg   %ax,%ax
+ 93f:	90                   	nop
+
+00000940 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 948:	89 d1                	mov    %edx,%ecx
+{
+ 94a:	83 ec 3c             	sub    $0x3c,%esp
+ 94d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 950:	85 d2                	test   %edx,%edx
+ 952:	0f 89 80 00 00 00    	jns    9d8 <printint+0x98>
+ 958:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 95c:	74 7a                	je     9d8 <printint+0x98>
+    x = -xx;
+ 95e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 960:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 965:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 968:	31 f6                	xor    %esi,%esi
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 970:	89 c8                	mov    %ecx,%eax
+ 972:	31 d2                	xor    %edx,%edx
+ 974:	89 f7                	mov    %esi,%edi
+ 976:	f7 f3                	div    %ebx
+ 978:	8d 76 01             	lea    0x1(%esi),%esi
+ 97b:	0f b6 92 20 0e 00 00 	movzbl 0xe20(%edx),%edx
+ 982:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 986:	89 ca                	mov    %ecx,%edx
+ 988:	89 c1                	mov    %eax,%ecx
+ 98a:	39 da                	cmp    %ebx,%edx
+ 98c:	73 e2                	jae    970 <printint+0x30>
+  if(neg)
+ 98e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 991:	85 c0                	test   %eax,%eax
+ 993:	74 07                	je     99c <printint+0x5c>
+    buf[i++] = '-';
+ 995:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 99a:	89 f7                	mov    %esi,%edi
+ 99c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 99f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9a2:	01 df                	add    %ebx,%edi
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9b4:	6a 01                	push   $0x1
+ 9b6:	50                   	push   %eax
+ 9b7:	56                   	push   %esi
+ 9b8:	e8 22 fc ff ff       	call   5df <write>
+  while(--i >= 0)
+ 9bd:	89 f8                	mov    %edi,%eax
+ 9bf:	83 c4 10             	add    $0x10,%esp
+ 9c2:	83 ef 01             	sub    $0x1,%edi
+ 9c5:	39 d8                	cmp    %ebx,%eax
+ 9c7:	75 df                	jne    9a8 <printint+0x68>
+}
+ 9c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9cc:	5b                   	pop    %ebx
+ 9cd:	5e                   	pop    %esi
+ 9ce:	5f                   	pop    %edi
+ 9cf:	5d                   	pop    %ebp
+ 9d0:	c3                   	ret
+ 9d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9d8:	31 c0                	xor    %eax,%eax
+ 9da:	eb 89                	jmp    965 <printint+0x25>
+ 9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9e0:	55                   	push   %ebp
+ 9e1:	89 e5                	mov    %esp,%ebp
+ 9e3:	57                   	push   %edi
+ 9e4:	56                   	push   %esi
+ 9e5:	53                   	push   %ebx
+ 9e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9ef:	0f b6 1e             	movzbl (%esi),%ebx
+ 9f2:	83 c6 01             	add    $0x1,%esi
+ 9f5:	84 db                	test   %bl,%bl
+ 9f7:	74 67                	je     a60 <printf+0x80>
+ 9f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9fc:	31 d2                	xor    %edx,%edx
+ 9fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a01:	eb 34                	jmp    a37 <printf+0x57>
+ a03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a07:	90                   	nop
+ a08:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a0b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a10:	83 f8 25             	cmp    $0x25,%eax
+ a13:	74 18                	je     a2d <printf+0x4d>
+  write(fd, &c, 1);
+ a15:	83 ec 04             	sub    $0x4,%esp
+ a18:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a1b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a1e:	6a 01                	push   $0x1
+ a20:	50                   	push   %eax
+ a21:	57                   	push   %edi
+ a22:	e8 b8 fb ff ff       	call   5df <write>
+ a27:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a2d:	0f b6 1e             	movzbl (%esi),%ebx
+ a30:	83 c6 01             	add    $0x1,%esi
+ a33:	84 db                	test   %bl,%bl
+ a35:	74 29                	je     a60 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a37:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a3a:	85 d2                	test   %edx,%edx
+ a3c:	74 ca                	je     a08 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a3e:	83 fa 25             	cmp    $0x25,%edx
+ a41:	75 ea                	jne    a2d <printf+0x4d>
+      if(c == 'd'){
+ a43:	83 f8 25             	cmp    $0x25,%eax
+ a46:	0f 84 24 01 00 00    	je     b70 <printf+0x190>
+ a4c:	83 e8 63             	sub    $0x63,%eax
+ a4f:	83 f8 15             	cmp    $0x15,%eax
+ a52:	77 1c                	ja     a70 <printf+0x90>
+ a54:	ff 24 85 c8 0d 00 00 	jmp    *0xdc8(,%eax,4)
+ a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a63:	5b                   	pop    %ebx
+ a64:	5e                   	pop    %esi
+ a65:	5f                   	pop    %edi
+ a66:	5d                   	pop    %ebp
+ a67:	c3                   	ret
+ a68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+  write(fd, &c, 1);
+ a70:	83 ec 04             	sub    $0x4,%esp
+ a73:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a76:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a7a:	6a 01                	push   $0x1
+ a7c:	52                   	push   %edx
+ a7d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a80:	57                   	push   %edi
+ a81:	e8 59 fb ff ff       	call   5df <write>
+ a86:	83 c4 0c             	add    $0xc,%esp
+ a89:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a8c:	6a 01                	push   $0x1
+ a8e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a91:	52                   	push   %edx
+ a92:	57                   	push   %edi
+ a93:	e8 47 fb ff ff       	call   5df <write>
+        putc(fd, c);
+ a98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a9b:	31 d2                	xor    %edx,%edx
+ a9d:	eb 8e                	jmp    a2d <printf+0x4d>
+ a9f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ aa0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ aa3:	83 ec 0c             	sub    $0xc,%esp
+ aa6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ aab:	8b 13                	mov    (%ebx),%edx
+ aad:	6a 00                	push   $0x0
+ aaf:	89 f8                	mov    %edi,%eax
+        ap++;
+ ab1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ab4:	e8 87 fe ff ff       	call   940 <printint>
+        ap++;
+ ab9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ abc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ abf:	31 d2                	xor    %edx,%edx
+ ac1:	e9 67 ff ff ff       	jmp    a2d <printf+0x4d>
+ ac6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ ad0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ ad3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ad5:	83 c0 04             	add    $0x4,%eax
+ ad8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ adb:	85 db                	test   %ebx,%ebx
+ add:	0f 84 9d 00 00 00    	je     b80 <printf+0x1a0>
+        while(*s != 0){
+ ae3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ ae6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ ae8:	84 c0                	test   %al,%al
+ aea:	0f 84 3d ff ff ff    	je     a2d <printf+0x4d>
+ af0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ af3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ af6:	89 de                	mov    %ebx,%esi
+ af8:	89 d3                	mov    %edx,%ebx
+ afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b00:	83 ec 04             	sub    $0x4,%esp
+ b03:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b06:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b09:	6a 01                	push   $0x1
+ b0b:	53                   	push   %ebx
+ b0c:	57                   	push   %edi
+ b0d:	e8 cd fa ff ff       	call   5df <write>
+        while(*s != 0){
+ b12:	0f b6 06             	movzbl (%esi),%eax
+ b15:	83 c4 10             	add    $0x10,%esp
+ b18:	84 c0                	test   %al,%al
+ b1a:	75 e4                	jne    b00 <printf+0x120>
+      state = 0;
+ b1c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b1f:	31 d2                	xor    %edx,%edx
+ b21:	e9 07 ff ff ff       	jmp    a2d <printf+0x4d>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b30:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b33:	83 ec 0c             	sub    $0xc,%esp
+ b36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b3b:	8b 13                	mov    (%ebx),%edx
+ b3d:	6a 01                	push   $0x1
+ b3f:	e9 6b ff ff ff       	jmp    aaf <printf+0xcf>
+ b44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b48:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b4b:	83 ec 04             	sub    $0x4,%esp
+ b4e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b51:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b53:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b56:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b59:	6a 01                	push   $0x1
+ b5b:	52                   	push   %edx
+ b5c:	57                   	push   %edi
+ b5d:	e8 7d fa ff ff       	call   5df <write>
+        ap++;
+ b62:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b65:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b68:	31 d2                	xor    %edx,%edx
+ b6a:	e9 be fe ff ff       	jmp    a2d <printf+0x4d>
+ b6f:	90                   	nop
+  write(fd, &c, 1);
+ b70:	83 ec 04             	sub    $0x4,%esp
+ b73:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b76:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b79:	6a 01                	push   $0x1
+ b7b:	e9 11 ff ff ff       	jmp    a91 <printf+0xb1>
+ b80:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b85:	bb c0 0d 00 00       	mov    $0xdc0,%ebx
+ b8a:	e9 61 ff ff ff       	jmp    af0 <printf+0x110>
+ b8f:	90                   	nop
+
+00000b90 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b90:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b91:	a1 ac 12 00 00       	mov    0x12ac,%eax
+{
+ b96:	89 e5                	mov    %esp,%ebp
+ b98:	57                   	push   %edi
+ b99:	56                   	push   %esi
+ b9a:	53                   	push   %ebx
+ b9b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b9e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ baa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bac:	39 ca                	cmp    %ecx,%edx
+ bae:	73 30                	jae    be0 <free+0x50>
+ bb0:	39 c1                	cmp    %eax,%ecx
+ bb2:	72 04                	jb     bb8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bb4:	39 c2                	cmp    %eax,%edx
+ bb6:	72 f0                	jb     ba8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bb8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bbb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bbe:	39 f8                	cmp    %edi,%eax
+ bc0:	74 2e                	je     bf0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bc2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bc5:	8b 42 04             	mov    0x4(%edx),%eax
+ bc8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bcb:	39 f1                	cmp    %esi,%ecx
+ bcd:	74 38                	je     c07 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bcf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ bd1:	5b                   	pop    %ebx
+  freep = p;
+ bd2:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ bd8:	5e                   	pop    %esi
+ bd9:	5f                   	pop    %edi
+ bda:	5d                   	pop    %ebp
+ bdb:	c3                   	ret
+ bdc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ be0:	39 c1                	cmp    %eax,%ecx
+ be2:	72 d0                	jb     bb4 <free+0x24>
+ be4:	eb c2                	jmp    ba8 <free+0x18>
+ be6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ bf0:	03 70 04             	add    0x4(%eax),%esi
+ bf3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bf6:	8b 02                	mov    (%edx),%eax
+ bf8:	8b 00                	mov    (%eax),%eax
+ bfa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bfd:	8b 42 04             	mov    0x4(%edx),%eax
+ c00:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c03:	39 f1                	cmp    %esi,%ecx
+ c05:	75 c8                	jne    bcf <free+0x3f>
+    p->s.size += bp->s.size;
+ c07:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c0a:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+    p->s.size += bp->s.size;
+ c10:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c13:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c16:	89 0a                	mov    %ecx,(%edx)
+}
+ c18:	5b                   	pop    %ebx
+ c19:	5e                   	pop    %esi
+ c1a:	5f                   	pop    %edi
+ c1b:	5d                   	pop    %ebp
+ c1c:	c3                   	ret
+ c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c20 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+ c26:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c2c:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c32:	8d 78 07             	lea    0x7(%eax),%edi
+ c35:	c1 ef 03             	shr    $0x3,%edi
+ c38:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c3b:	85 d2                	test   %edx,%edx
+ c3d:	0f 84 8d 00 00 00    	je     cd0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c43:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c45:	8b 48 04             	mov    0x4(%eax),%ecx
+ c48:	39 f9                	cmp    %edi,%ecx
+ c4a:	73 64                	jae    cb0 <malloc+0x90>
+  if(nu < 4096)
+ c4c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c51:	39 df                	cmp    %ebx,%edi
+ c53:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c56:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c5d:	eb 0a                	jmp    c69 <malloc+0x49>
+ c5f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c60:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c62:	8b 48 04             	mov    0x4(%eax),%ecx
+ c65:	39 f9                	cmp    %edi,%ecx
+ c67:	73 47                	jae    cb0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c69:	89 c2                	mov    %eax,%edx
+ c6b:	39 05 ac 12 00 00    	cmp    %eax,0x12ac
+ c71:	75 ed                	jne    c60 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c73:	83 ec 0c             	sub    $0xc,%esp
+ c76:	56                   	push   %esi
+ c77:	e8 b5 fa ff ff       	call   731 <sbrk>
+  if(p == (char*)-1)
+ c7c:	83 c4 10             	add    $0x10,%esp
+ c7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c82:	74 1c                	je     ca0 <malloc+0x80>
+  hp->s.size = nu;
+ c84:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c87:	83 ec 0c             	sub    $0xc,%esp
+ c8a:	83 c0 08             	add    $0x8,%eax
+ c8d:	50                   	push   %eax
+ c8e:	e8 fd fe ff ff       	call   b90 <free>
+  return freep;
+ c93:	8b 15 ac 12 00 00    	mov    0x12ac,%edx
+      if((p = morecore(nunits)) == 0)
+ c99:	83 c4 10             	add    $0x10,%esp
+ c9c:	85 d2                	test   %edx,%edx
+ c9e:	75 c0                	jne    c60 <malloc+0x40>
+        return 0;
+  }
+}
+ ca0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ca3:	31 c0                	xor    %eax,%eax
+}
+ ca5:	5b                   	pop    %ebx
+ ca6:	5e                   	pop    %esi
+ ca7:	5f                   	pop    %edi
+ ca8:	5d                   	pop    %ebp
+ ca9:	c3                   	ret
+ caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cb0:	39 cf                	cmp    %ecx,%edi
+ cb2:	74 4c                	je     d00 <malloc+0xe0>
+        p->s.size -= nunits;
+ cb4:	29 f9                	sub    %edi,%ecx
+ cb6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cb9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ cbc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ cbf:	89 15 ac 12 00 00    	mov    %edx,0x12ac
+}
+ cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cc8:	83 c0 08             	add    $0x8,%eax
+}
+ ccb:	5b                   	pop    %ebx
+ ccc:	5e                   	pop    %esi
+ ccd:	5f                   	pop    %edi
+ cce:	5d                   	pop    %ebp
+ ccf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ cd0:	c7 05 ac 12 00 00 b0 	movl   $0x12b0,0x12ac
+ cd7:	12 00 00 
+    base.s.size = 0;
+ cda:	b8 b0 12 00 00       	mov    $0x12b0,%eax
+    base.s.ptr = freep = prevp = &base;
+ cdf:	c7 05 b0 12 00 00 b0 	movl   $0x12b0,0x12b0
+ ce6:	12 00 00 
+    base.s.size = 0;
+ ce9:	c7 05 b4 12 00 00 00 	movl   $0x0,0x12b4
+ cf0:	00 00 00 
+    if(p->s.size >= nunits){
+ cf3:	e9 54 ff ff ff       	jmp    c4c <malloc+0x2c>
+ cf8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d00:	8b 08                	mov    (%eax),%ecx
+ d02:	89 0a                	mov    %ecx,(%edx)
+ d04:	eb b9                	jmp    cbf <malloc+0x9f>
+ d06:	66 90                	xchg   %ax,%ax
+ d08:	66 90                	xchg   %ax,%ax
+ d0a:	66 90                	xchg   %ax,%ax
+ d0c:	66 90                	xchg   %ax,%ax
+ d0e:	66 90                	xchg   %ax,%ax
+
+00000d10 <thread_create>:
+// The stack comes from malloc(); the pointer malloc() returned is
+// kept in the word below the page-aligned stack so that
+// thread_join() can free it.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d10:	55                   	push   %ebp
+ d11:	89 e5                	mov    %esp,%ebp
+ d13:	53                   	push   %ebx
+ d14:	83 ec 20             	sub    $0x20,%esp
+  char *mem, *stack;
+  int pid;
+
+  if((mem = malloc(2*PGSIZE)) == 0)
+ d17:	68 00 20 00 00       	push   $0x2000
+ d1c:	e8 ff fe ff ff       	call   c20 <malloc>
+ d21:	83 c4 10             	add    $0x10,%esp
+ d24:	85 c0                	test   %eax,%eax
+ d26:	74 47                	je     d6f <thread_create+0x5f>
+ d28:	89 c3                	mov    %eax,%ebx
+    return -1;
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d2a:	8d 80 03 10 00 00    	lea    0x1003(%eax),%eax
+  ((void**)stack)[-1] = mem;
+  if((pid = clone(fn, stack, arg)) < 0)
+ d30:	83 ec 04             	sub    $0x4,%esp
+  stack = (char*)PGROUNDUP((uint)mem + sizeof(void*));
+ d33:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  ((void**)stack)[-1] = mem;
+ d38:	89 58 fc             	mov    %ebx,-0x4(%eax)
+  if((pid = clone(fn, stack, arg)) < 0)
+ d3b:	ff 75 0c             	push   0xc(%ebp)
+ d3e:	50                   	push   %eax
+ d3f:	ff 75 08             	push   0x8(%ebp)
+ d42:	e8 6c fa ff ff       	call   7b3 <clone>
+ d47:	83 c4 10             	add    $0x10,%esp
+ d4a:	85 c0                	test   %eax,%eax
+ d4c:	78 0a                	js     d58 <thread_create+0x48>
+    free(mem);
+  return pid;
+}
+ d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ d51:	c9                   	leave
+ d52:	c3                   	ret
+ d53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d57:	90                   	nop
+    free(mem);
+ d58:	83 ec 0c             	sub    $0xc,%esp
+ d5b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d5e:	53                   	push   %ebx
+ d5f:	e8 2c fe ff ff       	call   b90 <free>
+ d64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    free(mem);
+ d6a:	83 c4 10             	add    $0x10,%esp
+}
+ d6d:	c9                   	leave
+ d6e:	c3                   	ret
+    return -1;
+ d6f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d74:	eb d8                	jmp    d4e <thread_create+0x3e>
+ d76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d80 <thread_join>:
+
+// Wait for a thread started by thread_create() and free its stack.
+int
+thread_join(void)
+{
+ d80:	55                   	push   %ebp
+ d81:	89 e5                	mov    %esp,%ebp
+ d83:	53                   	push   %ebx
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) < 0)
+ d84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ d87:	83 ec 20             	sub    $0x20,%esp
+  if((pid = join(&stack)) < 0)
+ d8a:	50                   	push   %eax
+ d8b:	e8 3d fa ff ff       	call   7cd <join>
+ d90:	83 c4 10             	add    $0x10,%esp
+ d93:	85 c0                	test   %eax,%eax
+ d95:	78 21                	js     db8 <thread_join+0x38>
+ d97:	89 c3                	mov    %eax,%ebx
+    return -1;
+  free(((void**)stack)[-1]);
+ d99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d9c:	83 ec 0c             	sub    $0xc,%esp
+ d9f:	ff 70 fc             	push   -0x4(%eax)
+ da2:	e8 e9 fd ff ff       	call   b90 <free>
+  return pid;
+ da7:	83 c4 10             	add    $0x10,%esp
+}
+ daa:	89 d8                	mov    %ebx,%eax
+ dac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ daf:	c9                   	leave
+ db0:	c3                   	ret
+ db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+ db8:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+ dbd:	eb eb                	jmp    daa <thread_join+0x2a>